@@ -552,7 +552,12 @@ namespace FrameTL
     
     // Get the process id of the current processor.
     // We need to have m processors, so that the id's are 0,...m-1.
-    int i = MPI::COMM_WORLD.Get_rank();
+    int i;
+    MPI_Comm_rank(MPI_COMM_WORLD, &i);
+
+    // transport of the global intermediate approximations and of the residual norms
+    PatchExchange<PROBLEM> exchange(P);
+    ScalarSum residual_sum;
 
     int k = 0;
 
@@ -562,11 +567,6 @@ namespace FrameTL
     tstart = clock();
     double local_eps = 1.0;
 
-    // Syncronize all processors.
-    // Each processor stops at this point and waits until all processors
-    // have reached this barrier.
-    MPI::COMM_WORLD.Barrier();
-
     // #####################################################################################
     // The adaptive algorithm.
     // #####################################################################################
@@ -621,33 +621,13 @@ namespace FrameTL
 	uks[i] = u_k_sparse + (m*alpha*precond_r_i);
 	//xks[i] = precond_r_i;
 	
+	// Every processor sends the changes of its global intermediate approximation
+	// to all the others and sums up the uks[i]. There is no need for the master
+	// to collect and broadcast them, and no additional synchronization.
+	exchange.exchange(uks[i], tmp);
+	u_k = (1./m)*tmp;
 	tmp.clear();
 
-	// syncronize processors after they have solved their local problem
-	MPI::COMM_WORLD.Barrier();
-	if (i!=0) {
-	  // All slaves send the global intermediate approximation to the master
-	  // processor with rank 0.
-	  send_to_Master<PROBLEM>(uks[i]);
-	}
-	else {
-	  // The master receives all local contributions and merges them
-	  // into 'tmp', which means that we sum up the uks[i] over i \neq 0.
-	  receive_all_parts(P, tmp);
-	}
-
-	// syncronize (maybe this is used too frequently)
-	MPI::COMM_WORLD.Barrier();
-	// The master adds its own contribution.
-	if (i==0) {
-	  tmp = tmp + uks[0];
-	  u_k = (1./m)*tmp;
-	}
- 	// Now pass new global approximation to all slaves.
-	MPI::COMM_WORLD.Barrier();
- 	broadcast_vec_from_Master(P, u_k);
-	MPI::COMM_WORLD.Barrier();
-
 	cout << "degrees of freedom: " << u_k.size() << endl;
       }
 
@@ -684,24 +664,14 @@ namespace FrameTL
       cout << "fsize exact res on patch " << i << " = " << f.size() << endl;
 
       APPLY(P, i, u_k, 1.0e-8, w, jmax, CDD1);
-      tmp2.clear();
-      
-      MPI::COMM_WORLD.Barrier();
-      if (i!=0) {
-	// all slaves send the local contribution to master
-	send_to_Master<PROBLEM>(f-w);
-      }
-      else {
-	// The master receives all local contributions and merges them
-	// into 'tmp', which is the same as summing up the uks[i] over i \neq 0.
-	receive_all_parts(P, tmp2);
-	// The master adds its own contribution.
-	tmp2 += f-w;
-      }
-      
+
+      // The patchwise parts of the residual have disjoint supports, so that
+      // only the squares of their norms have to be summed up.
+      residual_sum.start(l2_norm_sqr(f-w));
+
       // The master performs output.
       if (i==0) {
-	double residual_norm = l2_norm(tmp2);
+	double residual_norm = sqrt(residual_sum.finish());
 	cout << "norm of global residual = " << residual_norm  << endl;
 
 	char name1[128];
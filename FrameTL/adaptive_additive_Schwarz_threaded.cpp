@@ -0,0 +1,173 @@
+// implementation for adaptive_additive_Schwarz_threaded.h
+
+#include <cmath>
+#include <cdd1_local.h>
+
+namespace FrameTL
+{
+  template <class PROBLEM>
+  void AddSchw_threaded(const PROBLEM& P, const double epsilon,
+			Array1D<InfiniteVector<double, typename PROBLEM::Index> >& approximations)
+  {
+    typedef typename PROBLEM::WaveletBasis::IntervalBasis Basis1D;
+    const int jmax = JMAX;
+    typedef typename PROBLEM::Index Index;
+
+    const int d = Basis1D::primal_polynomial_degree();
+
+    // #####################################################################################
+    // Setup of constants, the same as in AddSchw().
+    // #####################################################################################
+#ifdef TWO_D
+#ifdef RINGDOMAIN
+    const double mu = 4.0*1.6544; // energy norm of the exact solution
+    const double rho = 0.2;
+#else
+    const double mu = 1.6544; // energy norm of the exact solution
+    const double rho = 0.2996;
+#endif
+    const double M = 1.0; // we choose the most optimistic case
+#endif
+#ifdef ONE_D
+    const double mu = 7.44609; // energy norm of the exact solution
+    const double M = 1.0; // we choose the most optimistic case
+    const double rho = 0.1837;
+#endif
+
+    // number of patches
+    const int m = P.basis().n_p();
+
+    const double C = m;
+    const double sigma = std::max(1./M, C + 1./M) + 0.1;
+    const int K = std::max(1,(int)ceil(log(1.0/(2.0 * M * sigma)) / log(rho)));
+
+    int L = 0;
+#ifdef ONE_D
+    switch (d) {
+    case 2: L = 10; break;
+    case 3: L = 8; break;
+    case 4: L = 9; break;
+    };
+#endif
+#ifdef TWO_D
+    switch (d) {
+    case 2: L = 8; break;
+#ifdef RINGDOMAIN
+    case 3: L = 8; break;
+#else
+    case 3: L = 23; break;
+#endif
+    case 4: L = 11; break;
+    };
+#endif
+
+    // relaxation parameter
+#ifdef RINGDOMAIN
+    const double alpha = 0.5;
+#else
+    const double alpha = 1.0/m;
+#endif
+
+    cout << "AddSchw_threaded: epsilon = " << epsilon << endl
+	 << "mu = " << mu << endl
+	 << "M = " << M << endl
+	 << "rho = " <<  rho << endl
+	 << "sigma = " << sigma << endl
+	 << "K = " << K << endl
+	 << "L = " << L << endl;
+#if PARALLEL_PATCHES==1
+    cout << "AddSchw_threaded: " << omp_get_max_threads() << " threads for " << m << " patches" << endl;
+#endif
+
+    // the norm estimates may be computed on their first call, this has to happen before the threads start
+    P.norm_A();
+    P.norm_Ainv();
+
+    InfiniteVector<double, Index> u_k, f, w, tmp, tmp2;
+
+    // local approximations which are used as starting vectors for the next local solves
+    Array1D<InfiniteVector<double, Index> > xks(m);
+    // global intermediate iterates of the patches
+    Array1D<InfiniteVector<double, Index> > uks(m);
+
+    // times needed for the local solves in the previous sweep
+    Array1D<double> costs(m);
+    for (int i = 0; i < m; i++)
+      costs[i] = 0.;
+    Array1D<int> order;
+
+    double local_eps = 1.0;
+
+    // #####################################################################################
+    // The adaptive algorithm.
+    // #####################################################################################
+    for (int l = 1; l < L; l++) {
+      for (int p = 1; p <= K; p++) {
+	local_eps = 10.0*mu*pow(2.0*pow(rho,K)*M*sigma,l-1)*pow(rho,p)/(alpha*m*K);
+	cout << "AddSchw_threaded: l = " << l << ", p = " << p
+	     << ", tolerance for solution of local problems = " << local_eps << endl;
+
+	patch_schedule(costs, order);
+
+	// The local problems of one sweep only depend on u_k, so they can be solved concurrently.
+#if PARALLEL_PATCHES==1
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+	for (int n = 0; n < m; n++) {
+	  const int i = order[n];
+	  const double start = patch_clock();
+
+	  InfiniteVector<double, Index> u_k_sparse, u_k_very_sparse, rhs, precond_r_i;
+#ifdef RINGDOMAIN
+	  thin_out_ring(P, i, u_k, u_k_sparse, u_k_very_sparse);
+#else
+	  thin_out(P, i, u_k, u_k_sparse, u_k_very_sparse);
+#endif
+	  rhs = u_k-u_k_sparse;
+	  rhs.compress(1.0e-15);
+	  rhs = u_k-((1./(m*alpha))*rhs);
+	  rhs.compress(1.0e-15);
+
+	  CDD1_LOCAL_SOLVE(P, i, local_eps, xks[i], precond_r_i, rhs, jmax, CDD1);
+
+	  xks[i] = precond_r_i;
+	  uks[i] = u_k_sparse + (m*alpha*precond_r_i);
+
+	  costs[i] = patch_clock()-start;
+	} // end loop over the patches
+
+	// compute the average of the global intermediate iterates
+	tmp.clear();
+	for (int i = 0; i < m; i++)
+	  tmp += uks[i];
+	u_k = (1./m)*tmp;
+	cout << "AddSchw_threaded: degrees of freedom: " << u_k.size() << endl;
+      } // end loop p
+
+      // coarsening
+      const double coarse_tol = (sigma - 1./M)*2.0*pow(rho,K)*mu*pow(2.0*pow(rho,K)*M*sigma,l-1)
+#ifdef RINGDOMAIN
+	*0.1
+#endif
+	;
+      u_k.COARSE(coarse_tol, tmp2);
+      u_k = tmp2;
+      cout << "AddSchw_threaded: degrees of freedom after coarsening: " << u_k.size() << endl;
+
+      // global residual
+      RHS_threaded(P, 1.0e-8, f);
+      APPLY_threaded(P, u_k, 1.0e-8, w, jmax, CDD1);
+      cout << "AddSchw_threaded: norm of global residual = " << l2_norm(f-w) << endl;
+    } // end loop L
+
+    // collect final approximation and its local parts
+    approximations[m] = u_k;
+    for (int i = 0; i < m; i++) {
+      approximations[i].clear();
+      for (typename InfiniteVector<double, Index>::const_iterator it = u_k.begin(), itend = u_k.end();
+	   it != itend; ++it)
+	if (it.index().p() == i)
+	  approximations[i].set_coefficient(it.index(),*it);
+    }
+  }
+}
@@ -0,0 +1,48 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of FrameTL - the Wavelet Template Library        |
+// |                                                                    |
+// | Copyright (c) 2002-2010                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _FRAME_TL_ADDITIVE_THREADED_H
+#define _FRAME_TL_ADDITIVE_THREADED_H
+
+#include <algebra/infinite_vector.h>
+#include <adaptive_additive_Schwarz.h>
+#include <threaded.h>
+
+namespace FrameTL
+{
+  /*!
+    \file adaptive_additive_Schwarz_threaded.h
+    Shared-memory parallel implementation of the adaptive additive Schwarz frame method.
+   */
+
+  /*! \brief Adaptive additive Schwarz wavelet frame algorithm from PhD thesis Werner 2009.
+
+    \param P The cached discrete problem.
+    \param epsilon The target \f$\ell_2\f$-accuracy of the algorithm.
+    \param approximations An array of length number of patches+1. We return in this array
+    the local discrete approximations on each patch.
+    The last entry contains the final global discrete approximation at termination.
+
+    This is the same iteration as AddSchw(), but the local auxiliary problems of one
+    sweep are solved concurrently by OpenMP threads instead of one after another
+    (cf. the MPI version in adaptive_additive_Schwarz_parallel.h, which needs one process
+    per patch). All threads share the cached problem P, see threaded.h for the requirements.
+    The patches are handed out dynamically, the most expensive ones of the previous sweep first.
+    Since the local solves are independent and the global iterate is summed up in
+    the order of the patches, the iterates do not depend on the number of threads.
+    The Matlab output files of AddSchw() are not written.
+   */
+  template <class PROBLEM>
+  void AddSchw_threaded(const PROBLEM& P, const double epsilon,
+			Array1D<InfiniteVector<double, typename PROBLEM::Index> >& approximations);
+}
+
+#include <adaptive_additive_Schwarz_threaded.cpp>
+
+#endif
@@ -1,68 +1,46 @@
 // implementation for parallel.h
 
-#include <parallel.h>
-
+#include <cstddef>
+#include <limits>
 
 namespace FrameTL
 {
 
-  void setup_coefficient_datatype () {
-    int array_of_block_lenghts[NBLOCKS] = {1, 1};
-    
-    MPI::Aint array_of_displacements[NBLOCKS];
-    //MPI::Datatype array_of_types[NBLOCKS] = {MPI::INT, MPI::DOUBLE};
-    MPI_Datatype array_of_types[NBLOCKS] = {MPI::INT, MPI::DOUBLE};
-    
-    cout << "Groesse eines int = " << sizeof(int) << endl;
-    
-//     Coefficient dummy[10];
-//     array_of_displacements[0] = 0;
-//     MPI_Address (&dummy[0].val, &array_of_displacements[1]);
-//     array_of_displacements[1]-=array_of_displacements[0];
-//     cout << "disp = " << array_of_displacements[0] << " " << array_of_displacements[1] << endl;
-    
-    // determine the lower bound and extent of an int
-    MPI_Aint extent = 0;
-    MPI::Aint lb = 0;
-    MPI::INT.Get_extent(lb, extent);
-    array_of_displacements[0] = lb;
-
-    // #####################################################################################
-    // Here we have to very carefull. On our 32Bit systems in the group one has to put
-    // array_of_displacements[1] = extent; (and extent is equal to 4)
-    // On a 64Bit system like the Marc Cluster it has to be 
-    // array_of_displacements[1] = 8;
-    // #####################################################################################
-    //array_of_displacements[1] = 8;
-    MPI::DOUBLE.Get_extent(lb, extent);
-    array_of_displacements[1] = extent;
-    // #####################################################################################
-    
-    cout << "extent = " << extent << endl;
-    cout << "NBLOCKS = "  << NBLOCKS <<  endl;
-
-
-//     coefficient_datatype = MPI::Datatype::Create_struct(2,
-// 							array_of_block_lenghts,
-// 							array_of_displacements,
-// 							array_of_types
-// 							);
-//     coefficient_datatype.Commit();
-
-    MPI_Type_struct (2, array_of_block_lenghts, array_of_displacements, array_of_types, &coefficient_datatype);
-    MPI_Type_commit(&coefficient_datatype);
+  inline
+  MPI_Datatype& coefficient_datatype() {
+    static MPI_Datatype datatype = MPI_DATATYPE_NULL;
+    return datatype;
+  }
 
+  inline
+  void setup_coefficient_datatype () {
+    if (coefficient_datatype() != MPI_DATATYPE_NULL)
+      return;
+
+    // the displacements are taken from the struct itself, so that the padding
+    // between the int and the double is correct on 32 and 64 bit systems
+    int array_of_block_lengths[2] = {1, 1};
+    MPI_Aint array_of_displacements[2] = {offsetof(Coefficient, num), offsetof(Coefficient, val)};
+    MPI_Datatype array_of_types[2] = {MPI_INT, MPI_DOUBLE};
+
+    MPI_Datatype tmp;
+    MPI_Type_create_struct(2, array_of_block_lengths, array_of_displacements, array_of_types, &tmp);
+    // the extent has to include the trailing padding for arrays of Coefficient's
+    MPI_Type_create_resized(tmp, 0, sizeof(Coefficient), &coefficient_datatype());
+    MPI_Type_free(&tmp);
+    MPI_Type_commit(&coefficient_datatype());
   }
 
   template <class PROBLEM>
   inline
   void send_to_Master (const InfiniteVector<double, typename PROBLEM::Index>& v) {
     int size = v.size();
-    MPI::COMM_WORLD.Send( &size, 1, MPI::INT, MASTER, 0);
-    
-    Coefficient out_vec[size];
-    to_array(v, out_vec);
-    MPI::COMM_WORLD.Send( &out_vec, size, coefficient_datatype, MASTER, 0);
+    MPI_Send(&size, 1, MPI_INT, MASTER, 0, MPI_COMM_WORLD);
+
+    std::vector<Coefficient> out_vec(size);
+    if (size > 0)
+      to_array(v, &out_vec[0]);
+    MPI_Send(size > 0 ? &out_vec[0] : 0, size, coefficient_datatype(), MASTER, 0, MPI_COMM_WORLD);
   }
 
   template <class PROBLEM>
@@ -70,50 +48,201 @@ namespace FrameTL
   void receive_all_parts (const PROBLEM& P,
 			  InfiniteVector<double, typename PROBLEM::Index>& v) {
     const int number_patches = P.basis().n_p();
-    int buffer_sizes[number_patches-1];
+    std::vector<int> buffer_sizes(number_patches);
     for (int i = 1; i < number_patches; i++)
-      MPI::COMM_WORLD.Recv( &buffer_sizes[i-1], 1, MPI::INT, i, 0);
-    
+      MPI_Recv(&buffer_sizes[i], 1, MPI_INT, i, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+    std::vector<Coefficient> in_vec;
     for (int i = 1; i < number_patches; i++) {
-      Coefficient in_vec[buffer_sizes[i-1]];
-      MPI::COMM_WORLD.Recv( &in_vec, buffer_sizes[i-1], coefficient_datatype, i, 0);
-      InfiniteVector<double, typename PROBLEM::Index> help;	  
-      array_to_map (in_vec, &P.basis(), help, buffer_sizes[i-1]);
+      in_vec.resize(buffer_sizes[i]);
+      MPI_Recv(buffer_sizes[i] > 0 ? &in_vec[0] : 0, buffer_sizes[i], coefficient_datatype(),
+	       i, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      InfiniteVector<double, typename PROBLEM::Index> help;
+      if (buffer_sizes[i] > 0)
+	array_to_map (&in_vec[0], &P.basis(), help, buffer_sizes[i]);
       v += help;
-      //v.merge(help);
     }
   }
 
-  /*
-   */
   template <class PROBLEM>
   inline
   void broadcast_vec_from_Master (const PROBLEM& P,
-			      InfiniteVector<double, typename PROBLEM::Index>& v) {
-    int p = MPI::COMM_WORLD.Get_rank();
+				  InfiniteVector<double, typename PROBLEM::Index>& v) {
+    int p;
+    MPI_Comm_rank(MPI_COMM_WORLD, &p);
     int current_support_size  = 0;
     if (p == MASTER) {
       current_support_size = v.size();
     }
-    
+
     // tell the slaves about the support size of the current approximation
-    MPI::COMM_WORLD.Bcast( &current_support_size, 1, MPI::INT, MASTER );
+    MPI_Bcast(&current_support_size, 1, MPI_INT, MASTER, MPI_COMM_WORLD);
 
     // send the current approximation to all the slaves
-    Coefficient v_vec[current_support_size];
+    std::vector<Coefficient> v_vec(current_support_size);
+    if (current_support_size == 0) {
+      v.clear();
+      return;
+    }
     if (p == MASTER)
-      to_array(v, v_vec);
-    MPI::COMM_WORLD.Bcast( &v_vec, current_support_size, coefficient_datatype, MASTER);
+      to_array(v, &v_vec[0]);
+    MPI_Bcast(&v_vec[0], current_support_size, coefficient_datatype(), MASTER, MPI_COMM_WORLD);
     if (p != MASTER) {
-      array_to_map (v_vec, &P.basis(), v, current_support_size);
+      array_to_map (&v_vec[0], &P.basis(), v, current_support_size);
     }
   }
 
+  inline
   void broadcast_double_from_Master (double& d)
   {
-    //MPI::DOUBLE dd(d);
-    MPI::COMM_WORLD.Bcast( &d, 1, MPI::DOUBLE, MASTER );
+    MPI_Bcast(&d, 1, MPI_DOUBLE, MASTER, MPI_COMM_WORLD);
+  }
+
+
+  template <class PROBLEM>
+  PatchExchange<PROBLEM>::PatchExchange(const PROBLEM& P, MPI_Comm comm)
+    : P_(P), comm_(comm), pending_(false)
+  {
+    setup_coefficient_datatype();
+    MPI_Comm_rank(comm_, &rank_);
+    MPI_Comm_size(comm_, &size_);
+    contributions_.resize(size_);
+    counts_.resize(size_);
+    displacements_.resize(size_);
+  }
+
+  template <class PROBLEM>
+  PatchExchange<PROBLEM>::~PatchExchange()
+  {
+    if (pending_)
+      MPI_Wait(&request_, MPI_STATUS_IGNORE);
+  }
+
+  template <class PROBLEM>
+  void
+  PatchExchange<PROBLEM>::start(const InfiniteVector<double, Index>& contribution)
+  {
+    // the coefficients which differ from the previous contribution
+    // (both vectors are traversed in the order of the indices)
+    InfiniteVector<double, Index>& old(contributions_[rank_]);
+    send_buffer_.clear();
+    Coefficient c;
+    typename InfiniteVector<double, Index>::const_iterator
+      it(contribution.begin()), itend(contribution.end()),
+      oldit(old.begin()), oldend(old.end());
+    while (it != itend || oldit != oldend) {
+      if (oldit == oldend || (it != itend && it.index() < oldit.index())) {
+	// new coefficient
+	if (*it != 0.) {
+	  c.num = it.index().number(); c.val = *it;
+	  send_buffer_.push_back(c);
+	}
+	++it;
+      } else if (it == itend || oldit.index() < it.index()) {
+	// vanished coefficient
+	c.num = oldit.index().number(); c.val = 0.;
+	send_buffer_.push_back(c);
+	++oldit;
+      } else {
+	if (*it != *oldit) {
+	  c.num = it.index().number(); c.val = *it;
+	  send_buffer_.push_back(c);
+	}
+	++it;
+	++oldit;
+      }
+    }
+
+    // the message sizes are small, these are exchanged at once
+    int count = send_buffer_.size();
+    MPI_Allgather(&count, 1, MPI_INT, &counts_[0], 1, MPI_INT, comm_);
+    int total = 0;
+    for (int r = 0; r < size_; r++) {
+      displacements_[r] = total;
+      total += counts_[r];
+    }
+    receive_buffer_.resize(total);
+
+    // empty messages still need a valid address
+    Coefficient* sendbuf = count > 0 ? &send_buffer_[0] : &dummy_;
+    Coefficient* recvbuf = total > 0 ? &receive_buffer_[0] : &dummy_;
+#if MPI_VERSION >= 3
+    MPI_Iallgatherv(sendbuf, count, coefficient_datatype(),
+		    recvbuf, &counts_[0], &displacements_[0], coefficient_datatype(),
+		    comm_, &request_);
+    pending_ = true;
+#else
+    MPI_Allgatherv(sendbuf, count, coefficient_datatype(),
+		   recvbuf, &counts_[0], &displacements_[0], coefficient_datatype(),
+		   comm_);
+#endif
+
+    // meanwhile, the own contribution can be stored
+    old = contribution;
+    old.compress(std::numeric_limits<double>::denorm_min()); // remove zeros
+  }
+
+  template <class PROBLEM>
+  void
+  PatchExchange<PROBLEM>::finish(InfiniteVector<double, Index>& sum)
+  {
+    if (pending_) {
+      MPI_Wait(&request_, MPI_STATUS_IGNORE);
+      pending_ = false;
+    }
+
+    // apply the changes of the other processors
+    for (int r = 0; r < size_; r++) {
+      if (r == rank_ || counts_[r] == 0) continue;
+      InfiniteVector<double, Index>& v(contributions_[r]);
+      for (int n = displacements_[r]; n < displacements_[r]+counts_[r]; n++)
+	v.set_coefficient(Index(receive_buffer_[n].num, &P_.basis()), receive_buffer_[n].val);
+      v.compress(std::numeric_limits<double>::denorm_min()); // remove vanished coefficients
+    }
+
+    sum.clear();
+    for (int r = 0; r < size_; r++)
+      sum += contributions_[r];
+  }
+
+
+  inline
+  ScalarSum::ScalarSum(MPI_Comm comm)
+    : comm_(comm), value_(0.), sum_(0.), pending_(false)
+  {
   }
 
+  inline
+  ScalarSum::~ScalarSum()
+  {
+    if (pending_)
+      MPI_Wait(&request_, MPI_STATUS_IGNORE);
+  }
+
+  inline
+  void
+  ScalarSum::start(const double value)
+  {
+    if (pending_)
+      MPI_Wait(&request_, MPI_STATUS_IGNORE);
+    value_ = value;
+#if MPI_VERSION >= 3
+    MPI_Iallreduce(&value_, &sum_, 1, MPI_DOUBLE, MPI_SUM, comm_, &request_);
+    pending_ = true;
+#else
+    MPI_Allreduce(&value_, &sum_, 1, MPI_DOUBLE, MPI_SUM, comm_);
+#endif
+  }
+
+  inline
+  double
+  ScalarSum::finish()
+  {
+    if (pending_) {
+      MPI_Wait(&request_, MPI_STATUS_IGNORE);
+      pending_ = false;
+    }
+    return sum_;
+  }
 
 }
@@ -10,9 +10,17 @@
 #ifndef _FRAME_TL_PARALLEL_H
 #define _FRAME_TL_PARALLEL_H
 
-#define NBLOCKS 2
+#include <vector>
+#include <mpi.h>
+#include <utils/array1d.h>
+#include <algebra/infinite_vector.h>
+#include <frame_index.h>
+
 #define MASTER 0
 
+using MathTL::Array1D;
+using MathTL::InfiniteVector;
+
 namespace FrameTL
 {
 
@@ -20,15 +28,21 @@ namespace FrameTL
     \file parallel.h
     Routines for the parallelization of adaptive frame
     domain decomposition methods.
+    All messages are kept in heap buffers, so that the size of the
+    vectors is not limited by the stack size.
   */
 
-
-  //MPI::Datatype coefficient_datatype;
-  MPI_Datatype coefficient_datatype;
+  /*!
+    The mpi datatype for a Coefficient, see setup_coefficient_datatype()
+    (MPI_DATATYPE_NULL before). It is a static variable of this function,
+    so that including parallel.h in several translation units defines it only once.
+  */
+  MPI_Datatype& coefficient_datatype();
 
   /*!
     Create mpi datatype, consisting of an int and a double.
-    Don't forget to call this routine at the very beginning of the mpi program.
+    Don't forget to call this routine at the very beginning of the mpi program
+    (PatchExchange does this on its own).
    */
   void setup_coefficient_datatype ();
 
@@ -63,7 +77,108 @@ namespace FrameTL
     The master processor sends a double to all other (slave) processors.
    */
   void broadcast_double_from_Master (double& d);
-  
+
+  /*!
+    Exchange of the contributions of the processors in the parallel adaptive Schwarz methods.
+
+    Every processor owns one contribution (e.g., the global intermediate iterate
+    computed from its local problem), and every processor needs the sum of all of them.
+    Instead of collecting the contributions on the master and broadcasting the sum
+    (send_to_Master(), receive_all_parts(), broadcast_vec_from_Master()),
+    every processor keeps a copy of the contributions of all processors. In each exchange,
+    only the coefficients which have changed since the previous exchange are sent to
+    all processors at once (MPI_Allgatherv), coefficients which vanished are sent as zeros.
+    The message buffers are reused from one exchange to the next.
+
+    The exchange is split into start() and finish(), so that a processor can do further
+    work while the messages are in transit (with MPI-3, the data are sent by MPI_Iallgatherv).
+    Since the exchanged changes are applied in the order of the processors,
+    the sum is the same on all processors.
+  */
+  template <class PROBLEM>
+  class PatchExchange
+  {
+  public:
+    typedef typename PROBLEM::Index Index;
+
+    /*!
+      constructor from the problem (for the reconstruction of the indices)
+      and the communicator
+    */
+    PatchExchange(const PROBLEM& P, MPI_Comm comm = MPI_COMM_WORLD);
+
+    //! destructor, completes a pending exchange
+    ~PatchExchange();
+
+    //! start the exchange of the new contribution of this processor
+    void start(const InfiniteVector<double, Index>& contribution);
+
+    //! complete the exchange, sum is the sum of the contributions of all processors
+    void finish(InfiniteVector<double, Index>& sum);
+
+    //! start() and finish() at once
+    void exchange(const InfiniteVector<double, Index>& contribution,
+		  InfiniteVector<double, Index>& sum)
+    {
+      start(contribution);
+      finish(sum);
+    }
+
+    //! the last exchanged contribution of the processor with the given rank
+    const InfiniteVector<double, Index>& contribution(const int rank) const
+    {
+      return contributions_[rank];
+    }
+
+    //! number of coefficients sent by this processor in the last exchange
+    unsigned int last_sent() const { return send_buffer_.size(); }
+
+    //! number of coefficients received by this processor in the last exchange
+    unsigned int last_received() const { return receive_buffer_.size()-send_buffer_.size(); }
+
+  protected:
+    const PROBLEM& P_;
+    MPI_Comm comm_;
+    int rank_, size_;
+
+    //! the contributions of all processors, as of the last exchange
+    Array1D<InfiniteVector<double, Index> > contributions_;
+
+    //! message buffers
+    std::vector<Coefficient> send_buffer_, receive_buffer_;
+    std::vector<int> counts_, displacements_;
+    Coefficient dummy_;
+
+    MPI_Request request_;
+    bool pending_;
+  };
+
+  /*!
+    Sum of a double over all processors (e.g., the squared norms of the parts
+    of a residual belonging to the different patches), which can be
+    completed later on, like PatchExchange.
+  */
+  class ScalarSum
+  {
+  public:
+    //! constructor from the communicator
+    ScalarSum(MPI_Comm comm = MPI_COMM_WORLD);
+
+    //! destructor, completes a pending sum
+    ~ScalarSum();
+
+    //! start the summation of the local values
+    void start(const double value);
+
+    //! complete the summation and return the sum
+    double finish();
+
+  protected:
+    MPI_Comm comm_;
+    double value_, sum_;
+    MPI_Request request_;
+    bool pending_;
+  };
 
 }
 
@@ -0,0 +1,68 @@
+// implementation for richardson_threaded.h
+
+#include <cmath>
+
+namespace FrameTL
+{
+  template <class PROBLEM>
+  void richardson_SOLVE_threaded(const PROBLEM& P, const double epsilon,
+				 InfiniteVector<double, typename PROBLEM::Index>& u_epsilon,
+				 Array1D<InfiniteVector<double, typename PROBLEM::Index> >& approximations,
+				 const double omega,
+				 const double rho,
+				 const unsigned int maxloops)
+  {
+    typedef typename PROBLEM::Index Index;
+    const int jmax = JMAX;
+
+    const double nu = P.norm_Ainv()*P.F_norm();
+    cout << "Rich_SOLVE_threaded: nu=" << nu << ", omega=" << omega << ", rho=" << rho << endl;
+
+    // desired error reduction factor theta < 1/3
+    const double theta = 0.333;
+
+    // compute minimal K such that 3*rho^K < theta
+    const int K = (int) ceil(log(theta/3.0) / log(rho));
+
+    u_epsilon.clear();
+
+    unsigned int loops = 0;
+    bool exit = false;
+    double epsilon_k = nu;
+    InfiniteVector<double,Index> f, v, Av, r;
+
+    while (!exit) {
+      epsilon_k *= 3*pow(rho, K) / theta;
+      const double eta = theta * epsilon_k / (6*omega*K);
+      cout << "Rich_SOLVE_threaded: epsilon_k=" << epsilon_k << ", eta=" << eta << endl;
+
+      RHS_threaded(P, eta, f);
+      for (int j = 1; j <= K; j++) {
+	APPLY_threaded(P, v, eta, Av, jmax, CDD1);
+	r = f - Av;
+	v += omega * r;
+	++loops;
+
+	const double residual_norm = l2_norm(r);
+	cout << "Rich_SOLVE_threaded: loop " << loops << ", ||f-Av||=" << residual_norm
+	     << ", active indices: " << v.size() << endl;
+
+	if (residual_norm < epsilon || loops == maxloops) {
+	  exit = true;
+	  break;
+	}
+      }
+    }
+    u_epsilon = v;
+
+    // collect final approximation and its local parts
+    approximations[P.basis().n_p()] = u_epsilon;
+    for (int i = 0; i < P.basis().n_p(); i++) {
+      approximations[i].clear();
+      for (typename InfiniteVector<double, Index>::const_iterator it = u_epsilon.begin(), itend = u_epsilon.end();
+	   it != itend; ++it)
+	if (it.index().p() == i)
+	  approximations[i].set_coefficient(it.index(),*it);
+    }
+  }
+}
@@ -0,0 +1,50 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of FrameTL - the Wavelet Template Library        |
+// |                                                                    |
+// | Copyright (c) 2002-2010                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _FRAME_TL_RICHARDSON_THREADED_H
+#define _FRAME_TL_RICHARDSON_THREADED_H
+
+#include <algebra/infinite_vector.h>
+#include <threaded.h>
+
+namespace FrameTL
+{
+  /*!
+    \file richardson_threaded.h
+    Shared-memory parallel implementation of the adaptive Richardson frame method.
+   */
+
+  /*!
+    Adaptive Richardson iteration v <- v + omega*(F-Av) for the frame discretization,
+    as richardson_SOLVE(). The right-hand side and the application of the stiffness matrix
+    are set up patchwise, the patches being processed concurrently by OpenMP threads
+    which share the cached problem P (see threaded.h).
+    The iteration stops as soon as the approximate residual is below epsilon
+    or after maxloops iterations.
+
+    \param P The cached discrete problem.
+    \param epsilon The target accuracy for the residual.
+    \param u_epsilon The final approximation.
+    \param approximations An array of length number of patches+1, containing the local parts
+    of u_epsilon on each patch and u_epsilon itself in the last entry.
+    \param omega The relaxation parameter.
+    \param rho The estimated error reduction of one step.
+  */
+  template <class PROBLEM>
+  void richardson_SOLVE_threaded(const PROBLEM& P, const double epsilon,
+				 InfiniteVector<double, typename PROBLEM::Index>& u_epsilon,
+				 Array1D<InfiniteVector<double, typename PROBLEM::Index> >& approximations,
+				 const double omega = 0.4,
+				 const double rho = 0.8,
+				 const unsigned int maxloops = 5000);
+}
+
+#include <richardson_threaded.cpp>
+
+#endif
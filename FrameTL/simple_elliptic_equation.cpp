@@ -276,23 +276,24 @@ namespace FrameTL
      // integrals arising when we make use of the tensor product structure. This costs quite
      // some memory, but really speeds up the algorithm!
 #ifndef ONE_D
-
-    typename One_D_IntegralCache::iterator col_lb(one_d_integrals.lower_bound(lambda));
-    typename One_D_IntegralCache::iterator col_it(col_lb);
-    if (col_lb == one_d_integrals.end() ||
-	one_d_integrals.key_comp()(lambda,col_lb->first))
-      {
-	// insert a new column
-	typedef typename One_D_IntegralCache::value_type value_type;
-	col_it = one_d_integrals.insert(col_lb, value_type(lambda, Column1D()));
+    // The cache is shared by the threads of the patch-parallel solvers (see threaded.h),
+    // so it is only accessed within a critical section. The integral itself is
+    // computed outside; if two threads compute the same integral, both get the same value.
+    bool cached = false;
+#if PARALLEL_PATCHES==1
+#pragma omp critical (simple_elliptic_one_d_integrals)
+#endif
+    {
+      typename One_D_IntegralCache::const_iterator col_it(one_d_integrals.find(lambda));
+      if (col_it != one_d_integrals.end()) {
+	typename Column1D::const_iterator it(col_it->second.find(mu));
+	if (it != col_it->second.end()) {
+	  res = it->second;
+	  cached = true;
+	}
       }
-    
-    Column1D& col(col_it->second);
-    
-    typename Column1D::iterator lb(col.lower_bound(mu));
-    typename Column1D::iterator it(lb);
-    if (lb == col.end() ||
-	col.key_comp()(mu, lb->first))
+    }
+    if (!cached)
       {
 #endif
 	// compute 1D irregular grid
@@ -355,12 +356,11 @@ namespace FrameTL
 
 	// in the 2D case store the calculated value
 #ifndef ONE_D
-	typedef typename Column1D::value_type value_type;
-	it = col.insert(lb, value_type(mu, res));
+#if PARALLEL_PATCHES==1
+#pragma omp critical (simple_elliptic_one_d_integrals)
+#endif
+	one_d_integrals[lambda].insert(std::make_pair(mu, res));
       }
-    else {
-      res = it->second;
-    }
 #endif
     return res;
   }
@@ -52,7 +52,8 @@ namespace FrameTL
   SimpleEllipticEquation<IBASIS,DIM>::compute_rhs()
   {
     cout << "SimpleEllipticEquation(): precompute right-hand side..." << endl;
-    int rank = MPI::COMM_WORLD.Get_rank();
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
     typedef AggregatedFrame<IBASIS,DIM> Frame;
     typedef typename Frame::Index Index;
@@ -0,0 +1,9 @@
+fid_vector=fopen('stiff_diagonal_poisson_interval_lap07_d3_dT3.bin', 'r');
+n=fread(fid_vector, 1, 'int');
+m=fread(fid_vector, 1, 'int');
+l=fread(fid_vector, 1, 'int');
+i=fread(fid_vector, l, 'int');
+j=fread(fid_vector, l, 'int');
+s=fread(fid_vector, l, 'double');
+stiff_diagonal_poisson_1D_lap07_d3_dT3=sparse(i,j,s,n,m);
+fclose(fid_vector);
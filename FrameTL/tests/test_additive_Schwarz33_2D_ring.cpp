@@ -88,11 +88,11 @@ using namespace WaveletTL;
 int main(int argc, char* argv[])
 {
 #ifdef PARALLEL
-  MPI::Init (argc, argv);
+  MPI_Init (&argc, &argv);
   int rank, size;
   
-  size = MPI::COMM_WORLD.Get_size ( );
-  rank = MPI::COMM_WORLD.Get_rank ( );
+  MPI_Comm_size (MPI_COMM_WORLD, &size);
+  MPI_Comm_rank (MPI_COMM_WORLD, &rank);
 
   setup_coefficient_datatype();
 #endif
@@ -461,7 +461,7 @@ int main(int argc, char* argv[])
 
   
 #ifdef PARALLEL
-  MPI::Finalize();
+  MPI_Finalize();
 #endif
 
   return 0;
@@ -0,0 +1,133 @@
+#define PARALLEL_PATCHES 1
+
+#define _WAVELETTL_GALERKINUTILS_VERBOSITY 0
+#define _WAVELETTL_CDD1_VERBOSITY 0
+
+#define OVERLAP 0.7
+
+#define JMAX 8
+
+#define SPARSE
+#define ONE_D
+
+#include <iostream>
+#include <time.h>
+#include <interval/p_basis.h>
+#include <simple_elliptic_equation.h>
+#include <algebra/infinite_vector.h>
+#include <cube/cube_basis.h>
+#include <frame_index.h>
+#include <adaptive_additive_Schwarz_threaded.h>
+#include <richardson_threaded.h>
+#include <galerkin/cached_problem.h>
+
+#if PARALLEL_PATCHES==1
+#include <omp.h>
+#endif
+
+using std::cout;
+using std::endl;
+
+using FrameTL::SimpleEllipticEquation;
+using FrameTL::AggregatedFrame;
+using MathTL::PoissonBVP;
+using MathTL::InfiniteVector;
+using WaveletTL::CachedProblemLocal;
+
+using namespace std;
+using namespace FrameTL;
+using namespace MathTL;
+using namespace WaveletTL;
+
+/*
+  Tests for the shared-memory parallel frame solvers on the interval (0,1),
+  covered by two overlapping patches:
+  the threaded additive Schwarz method has to yield the same iterate as
+  the sequential one, and the threaded Richardson iteration has to converge.
+*/
+
+int main()
+{
+  cout << "Testing the threaded adaptive additive Schwarz and Richardson methods in 1D..." << endl;
+#if PARALLEL_PATCHES==1
+  cout << "number of threads: " << omp_get_max_threads() << endl;
+#endif
+
+  const int DIM = 1;
+  const int jmax = JMAX;
+  const int d = 3, dT = 3;
+
+  typedef PBasis<d,dT> Basis1D;
+  typedef AggregatedFrame<Basis1D,1,1> Frame1D;
+  typedef Frame1D::Index Index;
+
+  Matrix<double> A(DIM,DIM);
+  A(0,0) = OVERLAP;
+  Point<1> b;
+  b[0] = 0.;
+  AffineLinearMapping<1> affineP(A,b);
+
+  Matrix<double> A2(DIM,DIM);
+  A2(0,0) = OVERLAP;
+  Point<1> b2;
+  b2[0] = 1-A2.get_entry(0,0);
+  AffineLinearMapping<1> affineP2(A2,b2);
+
+  Array1D<Chart<DIM,DIM>* > charts(2);
+  charts[0] = &affineP;
+  charts[1] = &affineP2;
+
+  SymmetricMatrix<bool> adj(2);
+  adj(0,0) = 1;
+  adj(1,1) = 1;
+  adj(1,0) = 1;
+  adj(0,1) = 1;
+
+  Array1D<FixedArray1D<int,2*DIM> > bc(2);
+  FixedArray1D<int,2*DIM> bound_1;
+  bound_1[0] = 1;
+  bound_1[1] = d-1;
+  bc[0] = bound_1;
+  FixedArray1D<int,2*DIM> bound_2;
+  bound_2[0] = d-1;
+  bound_2[1] = 1;
+  bc[1] = bound_2;
+
+  Atlas<DIM,DIM> interval(charts,adj);
+  Frame1D frame(&interval, bc, jmax);
+
+  Singularity1D_RHS_2<double> sing1D;
+  PoissonBVP<DIM> poisson(&sing1D);
+  SimpleEllipticEquation<Basis1D,DIM> discrete_poisson(&poisson, &frame, jmax);
+  discrete_poisson.set_norm_A(3.6548);
+  discrete_poisson.set_Ainv(1.0/0.146);
+
+  const double epsilon = 1.0e-3;
+
+  Array1D<InfiniteVector<double, Index> > approximations(frame.n_p()+1),
+    approximations_threaded(frame.n_p()+1);
+
+  {
+    CachedProblemLocal<SimpleEllipticEquation<Basis1D,DIM> > problem(&discrete_poisson, 3.6548, 1.0/0.146);
+    AddSchw(problem, epsilon, approximations);
+  }
+  {
+    CachedProblemLocal<SimpleEllipticEquation<Basis1D,DIM> > problem(&discrete_poisson, 3.6548, 1.0/0.146);
+    AddSchw_threaded(problem, epsilon, approximations_threaded);
+  }
+  cout << "* additive Schwarz: difference between the sequential and the threaded iterate: "
+       << linfty_norm(approximations[frame.n_p()]-approximations_threaded[frame.n_p()])
+       << " (" << approximations[frame.n_p()].size() << " coefficients)" << endl;
+
+  {
+    CachedProblemLocal<SimpleEllipticEquation<Basis1D,DIM> > problem(&discrete_poisson, 3.6548, 1.0/0.146);
+    InfiniteVector<double, Index> u_epsilon, f, w;
+    richardson_SOLVE_threaded(problem, epsilon, u_epsilon, approximations_threaded);
+    RHS_threaded(problem, 1.0e-8, f);
+    APPLY_threaded(problem, u_epsilon, 1.0e-8, w, jmax, CDD1);
+    cout << "* Richardson: residual of the threaded iterate: " << l2_norm(f-w)
+	 << " (" << u_epsilon.size() << " coefficients)" << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,161 @@
+#define _WAVELETTL_GALERKINUTILS_VERBOSITY 0
+#define _WAVELETTL_CDD1_VERBOSITY 0
+
+#define OVERLAP 0.7
+
+#define JMAX 8
+
+#define SPARSE
+#define ONE_D
+
+#include <mpi.h>
+#include <iostream>
+#include <time.h>
+#include <interval/p_basis.h>
+#include <simple_elliptic_equation.h>
+#include <algebra/infinite_vector.h>
+#include <frame_index.h>
+#include <adaptive_additive_Schwarz_parallel.h>
+#include <galerkin/cached_problem.h>
+#include <parallel.h>
+
+using std::cout;
+using std::endl;
+
+using FrameTL::SimpleEllipticEquation;
+using FrameTL::AggregatedFrame;
+using MathTL::PoissonBVP;
+using MathTL::InfiniteVector;
+using WaveletTL::CachedProblemLocal;
+
+using namespace std;
+using namespace FrameTL;
+using namespace MathTL;
+using namespace WaveletTL;
+
+/*
+  Tests for the mpi transport of the parallel frame solvers, to be run with
+  two processors, e.g., "mpirun -np 2 ./test_parallel_exchange":
+  the sum of the contributions exchanged by PatchExchange has to agree with
+  the sum computed on each processor by hand, and the parallel adaptive additive
+  Schwarz method on the interval (0,1), covered by two overlapping patches,
+  has to converge.
+*/
+
+// a contribution of the processor 'rank' in exchange number 'round',
+// some coefficients change, some vanish and some are added from one round to the next
+template <class PROBLEM>
+void contribution(const PROBLEM& P, const int rank, const int round,
+		  InfiniteVector<double, typename PROBLEM::Index>& v)
+{
+  typedef typename PROBLEM::Index Index;
+  v.clear();
+  const int n = P.basis().degrees_of_freedom() / 4;
+  // rounds 2 and 3 agree, so that the second of them sends nothing
+  const int r = round == 3 ? 2 : round;
+  for (int k = 0; k < n; k++) {
+    if ((k + rank + r) % 3 == 0) continue;
+    v.set_coefficient(Index(k+rank, &P.basis()), (rank+1) + k % (r+2));
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  MPI_Init(&argc, &argv);
+  int rank, size;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  if (rank == 0)
+    cout << "Testing the mpi transport of the parallel frame solvers on " << size << " processors..." << endl;
+
+  const int DIM = 1;
+  const int jmax = JMAX;
+  const int d = 3, dT = 3;
+
+  typedef PBasis<d,dT> Basis1D;
+  typedef AggregatedFrame<Basis1D,1,1> Frame1D;
+  typedef Frame1D::Index Index;
+
+  Matrix<double> A(DIM,DIM);
+  A(0,0) = OVERLAP;
+  Point<1> b;
+  b[0] = 0.;
+  AffineLinearMapping<1> affineP(A,b);
+
+  Matrix<double> A2(DIM,DIM);
+  A2(0,0) = OVERLAP;
+  Point<1> b2;
+  b2[0] = 1-A2.get_entry(0,0);
+  AffineLinearMapping<1> affineP2(A2,b2);
+
+  Array1D<Chart<DIM,DIM>* > charts(2);
+  charts[0] = &affineP;
+  charts[1] = &affineP2;
+
+  SymmetricMatrix<bool> adj(2);
+  adj(0,0) = 1;
+  adj(1,1) = 1;
+  adj(1,0) = 1;
+  adj(0,1) = 1;
+
+  Array1D<FixedArray1D<int,2*DIM> > bc(2);
+  FixedArray1D<int,2*DIM> bound_1;
+  bound_1[0] = 1;
+  bound_1[1] = d-1;
+  bc[0] = bound_1;
+  FixedArray1D<int,2*DIM> bound_2;
+  bound_2[0] = d-1;
+  bound_2[1] = 1;
+  bc[1] = bound_2;
+
+  Atlas<DIM,DIM> interval(charts,adj);
+  Frame1D frame(&interval, bc, jmax);
+
+  Singularity1D_RHS_2<double> sing1D;
+  PoissonBVP<DIM> poisson(&sing1D);
+  SimpleEllipticEquation<Basis1D,DIM> discrete_poisson(&poisson, &frame, jmax);
+  discrete_poisson.set_norm_A(3.6548);
+  discrete_poisson.set_Ainv(1.0/0.146);
+
+  {
+    PatchExchange<SimpleEllipticEquation<Basis1D,DIM> > exchange(discrete_poisson);
+    InfiniteVector<double, Index> v, sum, expected, help;
+    bool ok = true;
+    for (int round = 0; round < 4; round++) {
+      contribution(discrete_poisson, rank, round, v);
+      exchange.exchange(v, sum);
+      expected.clear();
+      for (int r = 0; r < size; r++) {
+	contribution(discrete_poisson, r, round, help);
+	expected += help;
+      }
+      const double error = linfty_norm(sum-expected);
+      if (error > 0. || sum.size() != expected.size()) ok = false;
+      if (rank == 0)
+	cout << "* exchange " << round << ": sent " << exchange.last_sent()
+	     << " coefficients, received " << exchange.last_received()
+	     << ", error in the sum " << error << endl;
+    }
+
+    ScalarSum scalar_sum;
+    scalar_sum.start(rank+1.);
+    const double s = scalar_sum.finish();
+    if (s != size*(size+1)/2.) ok = false;
+
+    if (rank == 0)
+      cout << "* exchange of contributions and scalar sum " << (ok ? "OK" : "failed") << endl;
+  }
+
+  if (size == frame.n_p()) {
+    const double epsilon = 1.0e-3;
+    Array1D<InfiniteVector<double, Index> > approximations(frame.n_p()+1);
+    CachedProblemLocal<SimpleEllipticEquation<Basis1D,DIM> > problem(&discrete_poisson, 3.6548, 1.0/0.146);
+    AddSchw(problem, epsilon, approximations);
+    if (rank == 0)
+      cout << "* parallel additive Schwarz: " << approximations[frame.n_p()].size() << " coefficients" << endl;
+  }
+
+  MPI_Finalize();
+  return 0;
+}
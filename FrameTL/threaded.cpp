@@ -0,0 +1,84 @@
+// implementation for threaded.h
+
+#include <cmath>
+#include <ctime>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <adaptive/apply.h>
+
+#if PARALLEL_PATCHES==1
+#include <omp.h>
+#endif
+
+namespace FrameTL
+{
+  inline
+  void patch_schedule(const Array1D<double>& costs, Array1D<int>& order)
+  {
+    std::vector<std::pair<double,int> > sorted(costs.size());
+    for (unsigned int i = 0; i < costs.size(); i++)
+      sorted[i] = std::make_pair(-costs[i], (int)i);
+    std::sort(sorted.begin(), sorted.end());
+
+    order.resize(costs.size());
+    for (unsigned int i = 0; i < costs.size(); i++)
+      order[i] = sorted[i].second;
+  }
+
+  inline
+  double patch_clock()
+  {
+#if PARALLEL_PATCHES==1
+    return omp_get_wtime();
+#else
+    return (double)clock()/CLOCKS_PER_SEC;
+#endif
+  }
+
+  template <class PROBLEM>
+  void RHS_threaded(const PROBLEM& P, const double eta,
+		    InfiniteVector<double, typename PROBLEM::Index>& f)
+  {
+    const int m = P.basis().n_p();
+    const double eta_p = eta/sqrt((double)m);
+
+    // the parts of the patches have disjoint supports
+    Array1D<InfiniteVector<double, typename PROBLEM::Index> > fs(m);
+#if PARALLEL_PATCHES==1
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+    for (int p = 0; p < m; p++)
+      P.RHS(eta_p, p, fs[p]);
+
+    f.clear();
+    for (int p = 0; p < m; p++)
+      f += fs[p];
+  }
+
+  template <class PROBLEM>
+  void APPLY_threaded(const PROBLEM& P,
+		      const InfiniteVector<double, typename PROBLEM::Index>& v,
+		      const double eta,
+		      InfiniteVector<double, typename PROBLEM::Index>& w,
+		      const int jmax,
+		      const CompressionStrategy strategy)
+  {
+    const int m = P.basis().n_p();
+    const double eta_p = eta/sqrt((double)m);
+
+    // norm_A() may be computed on its first call, so make sure this happens before the threads start
+    P.norm_A();
+
+    Array1D<InfiniteVector<double, typename PROBLEM::Index> > ws(m);
+#if PARALLEL_PATCHES==1
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+    for (int p = 0; p < m; p++)
+      APPLY(P, p, v, eta_p, ws[p], jmax, strategy);
+
+    w.clear();
+    for (int p = 0; p < m; p++)
+      w += ws[p];
+  }
+}
@@ -0,0 +1,76 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of FrameTL - the Wavelet Template Library        |
+// |                                                                    |
+// | Copyright (c) 2002-2010                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _FRAME_TL_THREADED_H
+#define _FRAME_TL_THREADED_H
+
+#include <utils/array1d.h>
+#include <algebra/infinite_vector.h>
+#include <adaptive/compression.h>
+
+using MathTL::Array1D;
+using MathTL::InfiniteVector;
+using WaveletTL::CompressionStrategy;
+
+namespace FrameTL
+{
+  /*!
+    \file threaded.h
+    Routines for the shared-memory parallelization of adaptive frame
+    domain decomposition methods, the counterpart of parallel.h.
+
+    With PARALLEL_PATCHES==1, the patches are processed concurrently by OpenMP
+    threads within one process, all threads work on the same cached problem
+    (the 1D integral cache of SimpleEllipticEquation is locked under the same
+    switch, so it has to be defined before including it). This requires that the cached
+    problem keeps the entries of the rows of different patches apart
+    (as CachedProblemLocal does, where a thread working on patch p only touches
+    the cache of patch p) and that the bilinear form of the uncached problem can be
+    evaluated concurrently (see SimpleEllipticEquation).
+    Otherwise, the patches are processed one after another.
+  */
+
+  /*!
+    Order in which the patches are handed out to the threads:
+    patches with larger costs (e.g., the time needed for them in the previous sweep)
+    come first. With dynamic scheduling, the expensive patches are started
+    at once and the threads which finish early take over the cheap ones.
+  */
+  void patch_schedule(const Array1D<double>& costs, Array1D<int>& order);
+
+  /*!
+    wall clock time in seconds, used for measuring the costs of the patches
+  */
+  double patch_clock();
+
+  /*!
+    Approximate the coefficients of the right-hand side within an \f$\ell_2\f$ tolerance eta,
+    the parts belonging to the different patches are set up concurrently.
+  */
+  template <class PROBLEM>
+  void RHS_threaded(const PROBLEM& P, const double eta,
+		    InfiniteVector<double, typename PROBLEM::Index>& f);
+
+  /*!
+    Approximate w = Av within an \f$\ell_2\f$ tolerance eta.
+    The rows belonging to the different patches are computed concurrently
+    by APPLY(P, p, ...), each of them within the tolerance eta/sqrt(number of patches).
+  */
+  template <class PROBLEM>
+  void APPLY_threaded(const PROBLEM& P,
+		      const InfiniteVector<double, typename PROBLEM::Index>& v,
+		      const double eta,
+		      InfiniteVector<double, typename PROBLEM::Index>& w,
+		      const int jmax,
+		      const CompressionStrategy strategy);
+}
+
+#include <threaded.cpp>
+
+#endif
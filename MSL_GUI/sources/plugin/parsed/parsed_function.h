@@ -27,6 +27,11 @@
 #ifndef PARSED_FUNCTION_H
 #define PARSED_FUNCTION_H
 
+#include <array>
+#include <vector>
+#include <QMutex>
+#include <QMutexLocker>
+
 #include "parsedfunction_base.h"
 #include "MathTL/utils/function.h"
 
@@ -43,8 +48,27 @@ public:
 
     void vector_value(const MathTL::Point<DIM>& p, MathTL::Vector<double>& values) const override;
 
+    /* Evaluates the (last) expression at all points under a single lock. Large batches use
+       muParser's bulk mode, which only pays off when muParser is built with MUP_USE_OPENMP;
+       otherwise, the compiled bytecode is evaluated point by point, since every bulk
+       evaluation parses the expression anew. */
+    void values(const MathTL::Array1D<MathTL::Point<DIM> >& points,
+                MathTL::Array1D<double>& results,
+                const unsigned int component = 0) const override;
+
 private:
-    mutable MathTL::Point<DIM> evalPoint_;
+    // binds the parser variables to evalPoints_ with room for 'capacity' points per coordinate
+    void bindVariables(const int capacity) const;
+
+    std::array<QString, DIM> funcVariables_;
+
+    // The parser variable of coordinate i is bound to evalPoints_[i*capacity_], so that the
+    // n-th point of a bulk evaluation is read from evalPoints_[i*capacity_ + n].
+    mutable std::vector<double> evalPoints_;
+    mutable int capacity_;
+
+    // muParser evaluates in its own (shared) buffers, so evaluations must not overlap
+    mutable QMutex mutex_;
 };
 
 
@@ -58,10 +82,22 @@ template<unsigned int DIM>
 ParsedFunction<DIM>::ParsedFunction(const std::array<QString, DIM>& funcVariables,
                                     const unsigned int n_components,
                                     const double initial_time)
-    : ParsedFunctionBase(), MathTL::Function<DIM>(n_components, initial_time)
+    : ParsedFunctionBase(), MathTL::Function<DIM>(n_components, initial_time),
+      funcVariables_(funcVariables)
+{
+    bindVariables(1);
+}
+
+
+
+template<unsigned int DIM>
+void ParsedFunction<DIM>::bindVariables(const int capacity) const
 {
+    capacity_ = capacity;
+    evalPoints_.resize(DIM*capacity);
     for (int i = 0; i < DIM; ++i)
-        defineVariable(funcVariables[i], &evalPoint_[i]);
+        const_cast<ParsedFunction<DIM>*>(this)->defineVariable(funcVariables_[i],
+                                                               &evalPoints_[i*capacity]);
 }
 
 
@@ -70,7 +106,9 @@ template<unsigned int DIM>
 double ParsedFunction<DIM>::value(const MathTL::Point<DIM>& p, const unsigned int component) const
 {
 //    assert(component == MathTL::Function<DIM>::n_components-1);
-    evalPoint_ = p;
+    QMutexLocker locker(&mutex_);
+    for (int i = 0; i < DIM; ++i)
+        evalPoints_[i*capacity_] = p[i];
     return parser_.Eval();
 }
 
@@ -80,7 +118,9 @@ template<unsigned int DIM>
 void ParsedFunction<DIM>::vector_value(const MathTL::Point<DIM>& p, MathTL::Vector<double>& values)
 const
 {
-    evalPoint_ = p;
+    QMutexLocker locker(&mutex_);
+    for (int i = 0; i < DIM; ++i)
+        evalPoints_[i*capacity_] = p[i];
     int number_of_expressions;
     double* v = parser_.Eval(number_of_expressions);
 //    assert(values.size() >= number_of_expressions);
@@ -91,4 +131,38 @@ const
 
 
 
+template<unsigned int DIM>
+void ParsedFunction<DIM>::values(const MathTL::Array1D<MathTL::Point<DIM> >& points,
+                                 MathTL::Array1D<double>& results,
+                                 const unsigned int component) const
+{
+//    assert(component == MathTL::Function<DIM>::n_components-1);
+    const int n = points.size();
+    results.resize(n);
+    QMutexLocker locker(&mutex_);
+
+#ifdef MUP_USE_OPENMP
+    // below this size, muParser considers the bulk mode not worthwhile
+    if (n >= 2000)
+    {
+        if (n > capacity_)
+            bindVariables(n);
+        for (int m = 0; m < n; ++m)
+            for (int i = 0; i < DIM; ++i)
+                evalPoints_[i*capacity_ + m] = points[m][i];
+        const_cast<mu::Parser&>(parser_).Eval(&results[0], n);
+        return;
+    }
+#endif
+
+    for (int m = 0; m < n; ++m)
+    {
+        for (int i = 0; i < DIM; ++i)
+            evalPoints_[i*capacity_] = points[m][i];
+        results[m] = parser_.Eval();
+    }
+}
+
+
+
 #endif // PARSED_FUNCTION_H
@@ -0,0 +1,277 @@
+// implementation for csr_matrix.h
+
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MathTL
+{
+  template <class C>
+  CSRMatrix<C>::CSRMatrix(const size_type m, const size_type n)
+    : row_ptr_(0), columns_(0), values_(0), rowdim_(0), coldim_(0)
+  {
+    allocate(m, n, 0);
+  }
+
+  template <class C>
+  CSRMatrix<C>::CSRMatrix(const CSRMatrix<C>& M)
+    : row_ptr_(0), columns_(0), values_(0), rowdim_(0), coldim_(0)
+  {
+    *this = M;
+  }
+
+  template <class C>
+  CSRMatrix<C>::CSRMatrix(const SparseMatrix<C>& M)
+    : row_ptr_(0), columns_(0), values_(0), rowdim_(0), coldim_(0)
+  {
+    *this = M;
+  }
+
+  template <class C>
+  CSRMatrix<C>::~CSRMatrix()
+  {
+    kill();
+  }
+
+  template <class C>
+  void CSRMatrix<C>::kill()
+  {
+    delete[] row_ptr_;
+    delete[] columns_;
+    delete[] values_;
+    row_ptr_ = 0;
+    columns_ = 0;
+    values_ = 0;
+    rowdim_ = coldim_ = 0;
+  }
+
+  template <class C>
+  void CSRMatrix<C>::allocate(const size_type m, const size_type n, const size_type nnz)
+  {
+    kill();
+    rowdim_ = m;
+    coldim_ = n;
+    row_ptr_ = new size_type[m+1];
+    std::fill(row_ptr_, row_ptr_+m+1, size_type(0));
+    if (nnz > 0) {
+      columns_ = new index_type[nnz];
+      values_ = new C[nnz];
+    }
+  }
+
+  template <class C>
+  MatrixBlock<C>*
+  CSRMatrix<C>::clone() const
+  {
+    return new CSRMatrix<C>(*this);
+  }
+
+  template <class C>
+  MatrixBlock<C>*
+  CSRMatrix<C>::clone_transposed() const
+  {
+    CSRMatrix<C>* Mt = new CSRMatrix<C>();
+    transpose(*Mt);
+    return Mt;
+  }
+
+  template <class C>
+  const C
+  CSRMatrix<C>::get_entry(const size_type row, const size_type column) const
+  {
+    assert(row < rowdim_ && column < coldim_);
+    const index_type* first(columns_+row_ptr_[row]);
+    const index_type* last(columns_+row_ptr_[row+1]);
+    const index_type* it(std::lower_bound(first, last, (index_type)column));
+    if (it != last && *it == column)
+      return values_[it-columns_];
+    return C(0);
+  }
+
+  template <class C>
+  CSRMatrix<C>& CSRMatrix<C>::operator = (const CSRMatrix<C>& M)
+  {
+    if (this != &M) {
+      allocate(M.rowdim_, M.coldim_, M.size());
+      std::copy(M.row_ptr_, M.row_ptr_+rowdim_+1, row_ptr_);
+      std::copy(M.columns_, M.columns_+M.size(), columns_);
+      std::copy(M.values_, M.values_+M.size(), values_);
+    }
+    return *this;
+  }
+
+  template <class C>
+  CSRMatrix<C>& CSRMatrix<C>::operator = (const SparseMatrix<C>& M)
+  {
+    allocate(M.row_dimension(), M.column_dimension(), M.size());
+    size_type k(0);
+    for (size_type row(0); row < rowdim_; row++) {
+      row_ptr_[row] = k;
+      for (size_type n(0), nend(M.entries_in_row(row)); n < nend; n++, k++) {
+	columns_[k] = M.get_nth_index(row, n);
+	values_[k] = M.get_nth_entry(row, n);
+      }
+    }
+    row_ptr_[rowdim_] = k;
+    return *this;
+  }
+
+  template <class C>
+  void CSRMatrix<C>::get_sparse_matrix(SparseMatrix<C>& M) const
+  {
+    M.resize(rowdim_, coldim_);
+    for (size_type row(0); row < rowdim_; row++) {
+      std::list<size_type> indices;
+      std::list<C> entries;
+      for (size_type k(row_ptr_[row]); k < row_ptr_[row+1]; k++) {
+	indices.push_back(columns_[k]);
+	entries.push_back(values_[k]);
+      }
+      M.set_row(row, indices, entries);
+    }
+  }
+
+  template <class C>
+  void CSRMatrix<C>::transpose(CSRMatrix<C>& Mt) const
+  {
+    // counting sort of the entries by column,
+    // traversing the rows in increasing order keeps the new column indices sorted
+    Mt.allocate(coldim_, rowdim_, size());
+    for (size_type k(0); k < size(); k++)
+      Mt.row_ptr_[columns_[k]+1]++;
+    for (size_type j(0); j < coldim_; j++)
+      Mt.row_ptr_[j+1] += Mt.row_ptr_[j];
+    size_type* next(new size_type[coldim_+1]);
+    std::copy(Mt.row_ptr_, Mt.row_ptr_+coldim_+1, next);
+    for (size_type i(0); i < rowdim_; i++)
+      for (size_type k(row_ptr_[i]); k < row_ptr_[i+1]; k++) {
+	const size_type pos(next[columns_[k]]++);
+	Mt.columns_[pos] = i;
+	Mt.values_[pos] = values_[k];
+      }
+    delete[] next;
+  }
+
+  template <class C>
+  template <class VECTOR>
+  void CSRMatrix<C>::apply(const VECTOR& x, VECTOR& Mx) const
+  {
+    assert(Mx.size() == rowdim_);
+#if PARALLEL==1
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_type i=0; i < rowdim_; i++) {
+      C help(0);
+      for (size_type k(row_ptr_[i]), kend(row_ptr_[i+1]); k < kend; k++)
+	help += values_[k] * x[columns_[k]];
+      Mx[i] = help;
+    }
+  }
+
+  template <class C>
+  void CSRMatrix<C>::apply(const Vector<C>& x, Vector<C>& Mx) const
+  {
+    apply<Vector<C> >(x, Mx);
+  }
+
+  template <class C>
+  void CSRMatrix<C>::apply(const Matrix<C>& X, Matrix<C>& MX) const
+  {
+    assert(X.row_dimension() == coldim_);
+    assert(MX.row_dimension() == rowdim_ && MX.column_dimension() == X.column_dimension());
+    const size_type nvectors(X.column_dimension());
+    // the row data are reused for all columns of X, while they are in the cache
+#if PARALLEL==1
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_type i=0; i < rowdim_; i++) {
+      for (size_type l(0); l < nvectors; l++) {
+	C help(0);
+	for (size_type k(row_ptr_[i]), kend(row_ptr_[i+1]); k < kend; k++)
+	  help += values_[k] * X(columns_[k], l);
+	MX(i, l) = help;
+      }
+    }
+  }
+
+  template <class C>
+  template <class VECTOR>
+  void CSRMatrix<C>::apply_transposed(const VECTOR& x, VECTOR& Mtx) const
+  {
+    assert(Mtx.size() == coldim_);
+
+#if PARALLEL==1 && defined(_OPENMP)
+    if (omp_get_max_threads() > 1) {
+      // scattering into Mtx would be a race, so each thread accumulates
+      // into its own vector, the partial results are summed up afterwards
+      C* partial(new C[omp_get_max_threads()*coldim_]);
+#pragma omp parallel
+      {
+	const int nthreads(omp_get_num_threads());
+	C* y(partial + omp_get_thread_num()*coldim_);
+	std::fill(y, y+coldim_, C(0));
+#pragma omp for schedule(static)
+	for (size_type i=0; i < rowdim_; i++) {
+	  const C xi(x[i]);
+	  for (size_type k(row_ptr_[i]), kend(row_ptr_[i+1]); k < kend; k++)
+	    y[columns_[k]] += values_[k] * xi;
+	}
+#pragma omp for schedule(static)
+	for (size_type j=0; j < coldim_; j++) {
+	  C help(0);
+	  for (int t(0); t < nthreads; t++)
+	    help += partial[t*coldim_+j];
+	  Mtx[j] = help;
+	}
+      }
+      delete[] partial;
+      return;
+    }
+#endif
+
+    for (size_type j(0); j < coldim_; j++)
+      Mtx[j] = C(0);
+    for (size_type i(0); i < rowdim_; i++) {
+      const C xi(x[i]);
+      for (size_type k(row_ptr_[i]), kend(row_ptr_[i+1]); k < kend; k++)
+	Mtx[columns_[k]] += values_[k] * xi;
+    }
+  }
+
+  template <class C>
+  void CSRMatrix<C>::apply_transposed(const Vector<C>& x, Vector<C>& Mtx) const
+  {
+    apply_transposed<Vector<C> >(x, Mtx);
+  }
+
+  template <class C>
+  void CSRMatrix<C>::print(std::ostream &os,
+			   const unsigned int tabwidth,
+			   const unsigned int precision) const
+  {
+    if (row_dimension() == 0)
+      os << "[]" << std::endl; // Matlab style
+    else
+      {
+	unsigned int old_precision = os.precision(precision);
+	for (size_type i(0); i < row_dimension(); ++i)
+	  {
+	    for (size_type j(0); j < column_dimension(); ++j)
+	      os << std::setw(tabwidth) << std::setprecision(precision)
+		 << get_entry(i, j);
+	    os << std::endl;
+	  }
+	os.precision(old_precision);
+      }
+  }
+
+  template <class C>
+  std::ostream& operator << (std::ostream& os, const CSRMatrix<C>& M)
+  {
+    M.print(os);
+    return os;
+  }
+}
@@ -0,0 +1,226 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of MathTL - the Mathematical Template Library    |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _MATHTL_CSR_MATRIX_H
+#define _MATHTL_CSR_MATRIX_H
+
+#include <iostream>
+
+#include <algebra/vector.h>
+#include <algebra/matrix.h>
+#include <algebra/matrix_block.h>
+#include <algebra/sparse_matrix.h>
+
+namespace MathTL
+{
+  /*!
+    This class models finite, sparsely populated matrices
+      M = (m_{i,j})_{0<=i<m, 0<=j<n}
+    with entries from an arbitrary (scalar) class C, in compressed sparse row
+    format (CSR, see [N]) with contiguous storage:
+    - values_[row_ptr_[i]], ..., values_[row_ptr_[i+1]-1] are the nontrivial entries of row i,
+    - columns_[row_ptr_[i]], ..., columns_[row_ptr_[i+1]-1] are their (sorted) column indices.
+
+    In contrast to SparseMatrix, which uses one allocation per row and is suitable
+    for assembling a matrix entry by entry, CSRMatrix is a static format,
+    meant for the repeated matrix-vector multiplications of iterative solvers
+    like CG(), i.e., a matrix is assembled as a SparseMatrix and then converted.
+    The matrix-vector products traverse three arrays sequentially.
+    With PARALLEL==1, the rows are distributed over the OpenMP threads; the transposed
+    product then accumulates into thread-local vectors, which are summed up afterwards.
+
+    Reference:
+    [N] http://www.netlib.org/linalg/html_templates/node91.html
+  */
+  template <class C>
+  class CSRMatrix
+    : public MatrixBlock<C>
+  {
+  public:
+    /*!
+      type of indexes and size type (cf. STL containers)
+     */
+    typedef typename Vector<C>::size_type size_type;
+
+    /*!
+      type of the stored column indices
+    */
+    typedef unsigned int index_type;
+
+    /*!
+      construct m*n rectangular zero matrix
+    */
+    explicit CSRMatrix(const size_type row_dimension = 0, const size_type column_dimension = 0);
+
+    /*!
+      copy constructor
+    */
+    CSRMatrix(const CSRMatrix<C>& M);
+
+    /*!
+      conversion from a SparseMatrix
+    */
+    explicit CSRMatrix(const SparseMatrix<C>& M);
+
+    /*!
+      destructor
+    */
+    ~CSRMatrix();
+
+    //! clone the matrix (requirement from MatrixBlock)
+    MatrixBlock<C>* clone() const;
+
+    //! transpose the matrix (requirement from MatrixBlock)
+    MatrixBlock<C>* clone_transposed() const;
+
+    /*!
+      row dimension
+    */
+    const size_type row_dimension() const { return rowdim_; }
+
+    /*!
+      column dimension
+    */
+    const size_type column_dimension() const { return coldim_; }
+
+    /*!
+      number of nonzero entries
+    */
+    const size_type size() const { return row_ptr_[rowdim_]; }
+
+    /*!
+      return true if matrix is empty (cf. STL containers)
+    */
+    bool empty() const { return rowdim_ == 0 || coldim_ == 0; }
+
+    /*!
+      number of nonzero entries in a given row
+    */
+    const size_type entries_in_row(const size_type row) const
+    {
+      return row_ptr_[row+1]-row_ptr_[row];
+    }
+
+    /*!
+      read access to the column index of the n-th nontrivial element in a given row
+    */
+    const size_type get_nth_index(const size_type row, const size_type n) const
+    {
+      return columns_[row_ptr_[row]+n];
+    }
+
+    /*!
+      read access to the n-th nontrivial element in a given row
+    */
+    const C get_nth_entry(const size_type row, const size_type n) const
+    {
+      return values_[row_ptr_[row]+n];
+    }
+
+    /*!
+      read-only access to a single matrix entry (binary search)
+    */
+    const C get_entry(const size_type row, const size_type column) const;
+
+    /*!
+      assignment from another CSR matrix
+    */
+    CSRMatrix<C>& operator = (const CSRMatrix<C>& M);
+
+    /*!
+      assignment from (conversion of) a SparseMatrix
+    */
+    CSRMatrix<C>& operator = (const SparseMatrix<C>& M);
+
+    /*!
+      conversion into a SparseMatrix
+    */
+    void get_sparse_matrix(SparseMatrix<C>& M) const;
+
+    /*!
+      compute the transposed matrix
+    */
+    void transpose(CSRMatrix<C>& Mt) const;
+
+    /*!
+      matrix-vector multiplication Mx = (*this) * x;
+      we assume that the vector Mx has the correct size and
+      is not identical to x
+    */
+    template <class VECTOR>
+    void apply(const VECTOR& x, VECTOR& Mx) const;
+
+    //! special version for Vector<C> (requirement from MatrixBlock)
+    void apply(const Vector<C>& x, Vector<C>& Mx) const;
+
+    /*!
+      matrix-matrix multiplication MX = (*this) * X with a dense matrix X,
+      i.e., the simultaneous application to the columns of X;
+      we assume that MX has the correct size and is not identical to X
+    */
+    void apply(const Matrix<C>& X, Matrix<C>& MX) const;
+
+    /*!
+      transposed matrix-vector multiplication Mtx = (*this)^T * x;
+      we assume that the vector Mtx has the correct size and
+      is not identical to x
+    */
+    template <class VECTOR>
+    void apply_transposed(const VECTOR& x, VECTOR& Mtx) const;
+
+    //! special version for Vector<C> (requirement from MatrixBlock)
+    void apply_transposed(const Vector<C>& x, Vector<C>& Mtx) const;
+
+    /*!
+      stream output with user-defined tabwidth and precision
+      (cf. deal.II)
+    */
+    void print(std::ostream& os,
+	       const unsigned int tabwidth = 8,
+	       const unsigned int precision = 3) const;
+
+  protected:
+    /*!
+      allocate storage for a matrix with a given number of nonzero entries,
+      the row pointers are set to zero
+    */
+    void allocate(const size_type rows, const size_type columns, const size_type nnz);
+
+    /*!
+      deallocate all memory
+    */
+    void kill();
+
+    //! row pointers, row_ptr_[rowdim_] is the number of nonzero entries
+    size_type* row_ptr_;
+
+    //! column indices of the nonzero entries
+    index_type* columns_;
+
+    //! the nonzero entries
+    C* values_;
+
+    //! row dimension
+    size_type rowdim_;
+
+    //! column dimension
+    size_type coldim_;
+  };
+
+  /*!
+    Matlab-style stream output as a dense matrix
+  */
+  template <class C>
+  std::ostream& operator << (std::ostream& os, const CSRMatrix<C>& M);
+}
+
+// include implementation of inline functions
+#include <algebra/csr_matrix.cpp>
+
+#endif
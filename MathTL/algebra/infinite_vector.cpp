@@ -14,139 +14,187 @@ using std::endl;
 
 namespace MathTL
 {
-  template <class C, class I>
-  InfiniteVector<C,I>::InfiniteVector()
-    : std::map<I,C>()
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S>::InfiniteVector()
+    : S()
   {
   }
 
-  template <class C, class I>
-  InfiniteVector<C,I>::InfiniteVector(const InfiniteVector<C,I>& v)
-    : std::map<I,C>(v)
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S>::InfiniteVector(const InfiniteVector<C,I,S>& v)
+    : S(v)
   {
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
+  template <class S2>
+  InfiniteVector<C,I,S>::InfiniteVector(const InfiniteVector<C,I,S2>& v)
+    : S()
+  {
+    typename S::iterator hint(S::end());
+    for (typename InfiniteVector<C,I,S2>::const_iterator it(v.begin()), itend(v.end());
+	 it != itend; ++it)
+      {
+	hint = S::insert(hint, typename S::value_type(it.index(), *it));
+	++hint;
+      }
+  }
+
+  template <class C, class I, class S>
   inline
   bool
-  InfiniteVector<C,I>::operator == (const InfiniteVector<C,I>& v) const
+  InfiniteVector<C,I,S>::operator == (const InfiniteVector<C,I,S>& v) const
   {
     return std::equal(begin(), end(), v.begin());
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   bool
-  InfiniteVector<C,I>::operator != (const InfiniteVector<C,I>& v) const
+  InfiniteVector<C,I,S>::operator != (const InfiniteVector<C,I,S>& v) const
   {
     return !((*this) == v);
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  C InfiniteVector<C,I>::operator [] (const I& index) const
+  C InfiniteVector<C,I,S>::operator [] (const I& index) const
   {
     return get_coefficient(index);
   }
 
-  template <class C, class I>
-  C InfiniteVector<C,I>::get_coefficient(const I& index) const
+  template <class C, class I, class S>
+  C InfiniteVector<C,I,S>::get_coefficient(const I& index) const
   {
-    typename std::map<I,C>::const_iterator it(this->lower_bound(index));
-    if (it != std::map<I,C>::end())
+    typename S::const_iterator it(this->lower_bound(index));
+    if (it != S::end())
       {
-	if (!std::map<I,C>::key_comp()(index, it->first))
+	if (!S::key_comp()(index, it->first))
 	  return it->second;
       }
     return C(0);
   }
 
-  template <class C, class I>
-  C& InfiniteVector<C,I>::operator [] (const I& index)
+  template <class C, class I, class S>
+  C& InfiniteVector<C,I,S>::operator [] (const I& index)
   {
     // efficient add-or-update, cf. Meyers, Effective STL
-    typename std::map<I,C>::iterator it(this->lower_bound(index));
-    if (it != std::map<I,C>::end() &&
-	!std::map<I,C>::key_comp()(index, it->first))
+    typename S::iterator it(this->lower_bound(index));
+    if (it != S::end() &&
+	!S::key_comp()(index, it->first))
       return it->second;
     else
-      return std::map<I,C>::insert(it, typename std::map<I,C>::value_type(index, C(0)))->second;
-// alternative: return std::map<I,C>::insert(typename std::map<I,C>::value_type(index, C(0))).first->second;
-  }
-
-  template <class C, class I>
-  void InfiniteVector<C,I>::set_coefficient(const I& index, const C value)
-  {
-    typename std::map<I,C>::iterator it(this->lower_bound(index));
-    if (it != std::map<I,C>::end() &&
-	!std::map<I,C>::key_comp()(index,it->first)) {
+      return S::insert(it, typename S::value_type(index, C(0)))->second;
+// alternative: return S::insert(typename S::value_type(index, C(0))).first->second;
+  }
+
+  /*
+    Writing access to the underlying map of an InfiniteVector.
+    For a generic (std::map-like) storage policy, we do an immediate add-or-update.
+    The flat storage SortedArrayMap buffers the operation instead, since an
+    insertion into the middle of the array would cost O(N).
+  */
+  template <class C, class I, class S>
+  void storage_set_coefficient(S& s, const I& index, const C value)
+  {
+    typename S::iterator it(s.lower_bound(index));
+    if (it != s.end() &&
+	!s.key_comp()(index,it->first)) {
       it->second = value;
     }
     else {
-      std::map<I,C>::insert(it, typename std::map<I,C>::value_type(index, value));
-      //std::map<I,C>::insert(typename std::map<I,C>::value_type(index, value));
+      s.insert(it, typename S::value_type(index, value));
+      //s.insert(typename S::value_type(index, value));
     }
   }
 
   template <class C, class I>
-  void InfiniteVector<C,I>::add_coefficient(const I& index, const C increment)
+  inline
+  void storage_set_coefficient(SortedArrayMap<I,C>& s, const I& index, const C value)
+  {
+    s.buffer_set(index, value);
+  }
+
+  template <class C, class I, class S>
+  void storage_add_coefficient(S& s, const I& index, const C increment)
   {
     // efficient add-or-update, cf. Meyers, Effective STL
-    typename std::map<I,C>::iterator it(this->lower_bound(index));
-    if (it != std::map<I,C>::end() &&
-	!std::map<I,C>::key_comp()(index, it->first)) {
+    typename S::iterator it(s.lower_bound(index));
+    if (it != s.end() &&
+	!s.key_comp()(index, it->first)) {
       // we already have a nontrivial coefficient
       if ((it->second += increment) == C(0))
-	std::map<I,C>::erase(it);
+	s.erase(it);
     } else {
       // insert the increment as new coefficient
-      std::map<I,C>::insert(it, typename std::map<I,C>::value_type(index, increment));
+      s.insert(it, typename S::value_type(index, increment));
     }
   }
 
   template <class C, class I>
-  InfiniteVector<C,I>&
-  InfiniteVector<C,I>::operator = (const InfiniteVector<C,I>& v)
+  inline
+  void storage_add_coefficient(SortedArrayMap<I,C>& s, const I& index, const C increment)
   {
-    std::map<I,C>::operator = (v);
+    s.buffer_add(index, increment);
+  }
+
+  template <class C, class I, class S>
+  inline
+  void InfiniteVector<C,I,S>::set_coefficient(const I& index, const C value)
+  {
+    storage_set_coefficient(static_cast<S&>(*this), index, value);
+  }
+
+  template <class C, class I, class S>
+  inline
+  void InfiniteVector<C,I,S>::add_coefficient(const I& index, const C increment)
+  {
+    storage_add_coefficient(static_cast<S&>(*this), index, increment);
+  }
+
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S>&
+  InfiniteVector<C,I,S>::operator = (const InfiniteVector<C,I,S>& v)
+  {
+    S::operator = (v);
     return *this;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  void InfiniteVector<C,I>::swap(InfiniteVector<C,I>& v)
+  void InfiniteVector<C,I,S>::swap(InfiniteVector<C,I,S>& v)
   {
-    std::map<I,C>::swap(v);
+    S::swap(v);
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  void InfiniteVector<C,I>::clear()
+  void InfiniteVector<C,I,S>::clear()
   {
-    std::map<I,C>::clear();
+    S::clear();
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  size_t InfiniteVector<C,I>::size() const
+  size_t InfiniteVector<C,I,S>::size() const
   {
-    return std::map<I,C>::size();
+    return S::size();
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   void
-  InfiniteVector<C,I>::support(std::set<I>& supp) const
+  InfiniteVector<C,I,S>::support(std::set<I>& supp) const
   {
     supp.clear();
     for (const_iterator it(begin()), itend(end()); it != itend; ++it)
       supp.insert(supp.end(), it.index());
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   void
-  InfiniteVector<C,I>::clip(const std::set<I>& supp)
+  InfiniteVector<C,I,S>::clip(const std::set<I>& supp)
   {
-    std::map<I,C> v;
+    S v;
 
     const_iterator it(begin()), itend(end());
     typename std::set<I>::const_iterator suppit(supp.begin()), suppend(supp.end());
@@ -157,30 +205,30 @@ namespace MathTL
 	  v.insert(v.end(), std::pair<I,C>(it.index(), *it));
       }
 
-    std::map<I,C>::swap(v);
+    S::swap(v);
   }
 
-  template <class C, class I>
-  void InfiniteVector<C,I>::compress(const double eta)
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::compress(const double eta)
   {
     // a hardcore STL implementation inspired by Meyers, Effective STL:
-    std::map<I,C> v;
-    remove_copy_if(std::map<I,C>::begin(),
-		   std::map<I,C>::end(),
+    S v;
+    remove_copy_if(S::begin(),
+		   S::end(),
 		   std::inserter(v, v.end()),
 		   threshold_criterion<I,C>(eta));
-    std::map<I,C>::swap(v);
+    S::swap(v);
   }
   
-  template <class C, class I>
-  void InfiniteVector<C,I>::shrinkage(const double mu)
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::shrinkage(const double mu)
   {
     compress(mu);
     // a hardcore STL implementation inspired by Meyers, Effective STL:
-    for (typename InfiniteVector<C,I>::const_iterator it(begin()),
+    for (typename InfiniteVector<C,I,S>::const_iterator it(begin()),
  	   itend(end()); it != itend; ++it){
 //        if(*it<=mu)
-//            std::map<I,C>::erase(it.index());
+//            S::erase(it.index());
         if(*it>mu)
           set_coefficient(it.index(), *it-0.5*mu);  
         if(*it < -mu)
@@ -188,18 +236,18 @@ namespace MathTL
     }
   }
 
-  template <class C, class I>
-  void InfiniteVector<C,I>::add(const InfiniteVector<C,I>& v)
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::add(const InfiniteVector<C,I,S>& v)
   {
 #if 1
-    std::map<I,C> help;
+    S help;
 
     // The following O(N) algorithm is adapted from the STL algorithm set_union(),
     // cf. stl_algo.h ...
 
-    typename InfiniteVector<C,I>::const_iterator it(begin()), itend(end()),
+    typename InfiniteVector<C,I,S>::const_iterator it(begin()), itend(end()),
       itv(v.begin()), itvend(v.end());
-    typename std::map<I,C>::iterator hint(help.begin()), hint2(help.begin());
+    typename S::iterator hint(help.begin()), hint2(help.begin());
 
     while (it != itend && itv != itvend)
       {
@@ -244,10 +292,10 @@ namespace MathTL
 	++itv;
       }
 
-    std::map<I,C>::swap(help);
+    S::swap(help);
 #else
     // the following code can be optimized (not O(N) now)
-    typename InfiniteVector<C,I>::const_iterator itv(v.begin()), itvend(v.end());
+    typename InfiniteVector<C,I,S>::const_iterator itv(v.begin()), itvend(v.end());
     for (; itv != itvend; ++itv)
       {
 	C help(get_coefficient(itv.index()) + *itv);
@@ -255,23 +303,23 @@ namespace MathTL
 	if (help != C(0))
 	  set_coefficient(itv.index(), help);
 	else
-	  std::map<I,C>::erase(itv.index());
+	  S::erase(itv.index());
       }
 #endif
   }
 
-  template <class C, class I>
-  void InfiniteVector<C,I>::add(const C s, const InfiniteVector<C,I>& v)
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::add(const C s, const InfiniteVector<C,I,S>& v)
   {
 #if 1
-    std::map<I,C> help;
+    S help;
 
     // The following O(N) algorithm is adapted from the STL algorithm set_union(),
     // cf. stl_algo.h ...
 
-    typename InfiniteVector<C,I>::const_iterator it(begin()), itend(end()),
+    typename InfiniteVector<C,I,S>::const_iterator it(begin()), itend(end()),
       itv(v.begin()), itvend(v.end());
-    typename std::map<I,C>::iterator hint(help.begin()), hint2(help.begin());
+    typename S::iterator hint(help.begin()), hint2(help.begin());
 
     while (it != itend && itv != itvend)
       {
@@ -316,33 +364,33 @@ namespace MathTL
 	++itv;
       }
 
-    std::map<I,C>::swap(help);
+    S::swap(help);
 #else
     // the following code can be optimized (not O(N) now)
-    typename InfiniteVector<C,I>::const_iterator itv(v.begin()), itvend(v.end());
+    typename InfiniteVector<C,I,S>::const_iterator itv(v.begin()), itvend(v.end());
     for (; itv != itvend; ++itv)
       {
 	C help(get_coefficient(itv.index()) + s * *itv);
 	if (help != C(0))
 	  set_coefficient(itv.index(), help);
 	else
-	  std::map<I,C>::erase(itv.index());
+	  S::erase(itv.index());
       }
 #endif
   }
 
-  template <class C, class I>
-  void InfiniteVector<C,I>::sadd(const C s, const InfiniteVector<C,I>& v)
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::sadd(const C s, const InfiniteVector<C,I,S>& v)
   {
 #if 1
-    std::map<I,C> help;
+    S help;
 
     // The following O(N) algorithm is adapted from the STL algorithm set_union(),
     // cf. stl_algo.h ...
 
-    typename InfiniteVector<C,I>::const_iterator it(begin()), itend(end()),
+    typename InfiniteVector<C,I,S>::const_iterator it(begin()), itend(end()),
       itv(v.begin()), itvend(v.end());
-    typename std::map<I,C>::iterator hint(help.begin()), hint2(help.begin());
+    typename S::iterator hint(help.begin()), hint2(help.begin());
 
     while (it != itend && itv != itvend)
       {
@@ -387,64 +435,64 @@ namespace MathTL
 	++itv;
       }
 
-    std::map<I,C>::swap(help);
+    S::swap(help);
 #else
     // the following code can be optimized (not O(N) now)
-    typename InfiniteVector<C,I>::const_iterator itv(v.begin()), itvend(v.end());
+    typename InfiniteVector<C,I,S>::const_iterator itv(v.begin()), itvend(v.end());
     for (; itv != itvend; ++itv)
       {
 	C help(s * get_coefficient(itv.index()) + *itv);
 	if (help != C(0))
 	  set_coefficient(itv.index(), help);
 	else
-	  std::map<I,C>::erase(itv.index());
+	  S::erase(itv.index());
       }
 #endif
   }
 
-  template <class C, class I>
-  void InfiniteVector<C,I>::scale(const C s)
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::scale(const C s)
   {
     if (s == C(0))
       clear();
     else
       {
-	typename std::map<I,C>::iterator it(std::map<I,C>::begin()),
-	  itend(std::map<I,C>::end());
+	typename S::iterator it(S::begin()),
+	  itend(S::end());
 	while(it != itend)
 	  (*it++).second *= s;
       }
   }
 
-  template <class C, class I>
-  void InfiniteVector<C,I>::scale(const InfiniteDiagonalMatrix<C,I>* D, const int k)
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::scale(const InfiniteDiagonalMatrix<C,I>* D, const int k)
   {
-    for (typename std::map<I,C>::iterator it(std::map<I,C>::begin()),
-	   itend(std::map<I,C>::end());
+    for (typename S::iterator it(S::begin()),
+	   itend(S::end());
 	 it != itend; ++it)
       it->second *= pow(D->diag(it->first), k);
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  InfiniteVector<C,I>& InfiniteVector<C,I>::operator += (const InfiniteVector<C,I>& v)
+  InfiniteVector<C,I,S>& InfiniteVector<C,I,S>::operator += (const InfiniteVector<C,I,S>& v)
   {
     add(v);
     return *this;
   }
 
-  template <class C, class I>
-  void InfiniteVector<C,I>::subtract(const InfiniteVector<C,I>& v)
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::subtract(const InfiniteVector<C,I,S>& v)
   {
 #if 1
-    std::map<I,C> help;
+    S help;
 
     // The following O(N) algorithm is adapted from the STL algorithm set_union(),
     // cf. stl_algo.h ...
 
-    typename InfiniteVector<C,I>::const_iterator it(begin()), itend(end()),
+    typename InfiniteVector<C,I,S>::const_iterator it(begin()), itend(end()),
       itv(v.begin()), itvend(v.end());
-    typename std::map<I,C>::iterator hint(help.begin()), hint2(help.begin());
+    typename S::iterator hint(help.begin()), hint2(help.begin());
 
     while (it != itend && itv != itvend)
       {
@@ -489,52 +537,52 @@ namespace MathTL
 	++itv;
       }
 
-    std::map<I,C>::swap(help);
+    S::swap(help);
 #else
     // the following code can be optimized (not O(N) now)
-    typename InfiniteVector<C,I>::const_iterator itv(v.begin()), itvend(v.end());
+    typename InfiniteVector<C,I,S>::const_iterator itv(v.begin()), itvend(v.end());
     for (; itv != itvend; ++itv)
       {
 	C help(get_coefficient(itv.index()) - *itv);
 	if (help != C(0))
 	  set_coefficient(itv.index(), help);
 	else
-	  std::map<I,C>::erase(itv.index());
+	  S::erase(itv.index());
       }
 #endif
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  InfiniteVector<C,I>& InfiniteVector<C,I>::operator -= (const InfiniteVector<C,I>& v)
+  InfiniteVector<C,I,S>& InfiniteVector<C,I,S>::operator -= (const InfiniteVector<C,I,S>& v)
   {
     subtract(v);
     return *this;
   }
    
-  template <class C, class I>
-  InfiniteVector<C,I>& InfiniteVector<C,I>::operator *= (const C s)
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S>& InfiniteVector<C,I,S>::operator *= (const C s)
   {
     scale(s);
     return *this;
   }
 
-  template <class C, class I>
-  InfiniteVector<C,I>& InfiniteVector<C,I>::operator /= (const C s)
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S>& InfiniteVector<C,I,S>::operator /= (const C s)
   {
     // we don't catch the division by zero exception here!
     return (*this *= 1.0/s);
   }
 
-  template <class C, class I>
-  const C InfiniteVector<C,I>::operator * (const InfiniteVector<C,I>& v) const
+  template <class C, class I, class S>
+  const C InfiniteVector<C,I,S>::operator * (const InfiniteVector<C,I,S>& v) const
   {
-    if (this == reinterpret_cast<const InfiniteVector<C,I>*>(&v))
+    if (this == reinterpret_cast<const InfiniteVector<C,I,S>*>(&v))
       return l2_norm_sqr(*this);
 
     C r(0);
     
-    for (typename InfiniteVector<C,I>::const_iterator
+    for (typename InfiniteVector<C,I,S>::const_iterator
 	   it(begin()),
 	   itend(end()),
 	   itv(v.begin()),
@@ -550,11 +598,11 @@ namespace MathTL
     return r;
   }
 
-  template <class C, class I>
-  double operator * (const InfiniteVector<C,I>& v, const InfiniteVector<C,I>& w)
+  template <class C, class I, class S>
+  double operator * (const InfiniteVector<C,I,S>& v, const InfiniteVector<C,I,S>& w)
   {
     double r(0);
-    typedef typename InfiniteVector<C,I>::const_iterator const_iterator;
+    typedef typename InfiniteVector<C,I,S>::const_iterator const_iterator;
     const_iterator itv(v.begin()), itvend(v.end()), itw(w.begin()), itwend(w.end());
     for (; itv != itvend && itw != itwend; ++itv)
       {
@@ -565,8 +613,8 @@ namespace MathTL
     return r;
   }
 
-  template <class C, class I>
-  double InfiniteVector<C,I>::weak_norm(const double tau) const
+  template <class C, class I, class S>
+  double InfiniteVector<C,I,S>::weak_norm(const double tau) const
   {
     double r(0.0);
 
@@ -593,65 +641,120 @@ namespace MathTL
     return r;
   }
 
-  template <class C, class I>
-  void InfiniteVector<C,I>::COARSE(const double eps, InfiniteVector<C,I>& v) const
-  {
-    // We use a straightforward implementation with complexity O(N*log(N)):
-    // - sort my entries in modulus
-    //   1. possibility: use a helper multimap object
-    //   2. possibility: use a sorted vector (preferred solution, since no
-    //                   slow insertion sort algorithm is launched!)
-    // - insert the largest in modulus entries into v until
-    //     \|*this-v\|_{\ell_2}\le\epsilon
-    //
-    // Another possibility would be binary binning, which we will implement
-    // in a later stage of the library!
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::binary_binning(const double r, const unsigned int q,
+					     std::vector<std::pair<I,C> >& sv,
+					     std::vector<unsigned int>& offsets) const
+  {
+    // bin number of each entry, |x|/r = m*2^e with 1/2 <= m < 1,
+    // i.e., |x| in (2^{-(i+1)}r,2^{-i}r] for i = -e (m > 1/2) or i = 1-e (m = 1/2)
+    std::vector<unsigned int> bin(size());
+    offsets.assign(q+2, 0);
+    unsigned int id(0);
+    for (const_iterator it(begin()), itend(end()); it != itend; ++it, ++id) {
+      int e;
+      const double m(frexp(fabs(*it)/r, &e));
+      if (m == 0)
+	bin[id] = q;
+      else {
+	const int i(m == 0.5 ? 1-e : -e);
+	bin[id] = i <= 0 ? 0 : std::min(q, (unsigned int) i);
+      }
+      offsets[bin[id]+1]++;
+    }
+
+    // counting sort, the entries of each bin keep their order
+    for (unsigned int i(1); i <= q+1; i++)
+      offsets[i] += offsets[i-1];
+    std::vector<unsigned int> pos(offsets.begin(), offsets.end()-1);
+    sv.resize(size());
+    id = 0;
+    for (const_iterator it(begin()), itend(end()); it != itend; ++it, ++id)
+      sv[pos[bin[id]]++] = std::pair<I,C>(it.index(), *it);
+  }
+
+  template <class C, class I, class S>
+  void InfiniteVector<C,I,S>::COARSE(const double eps, InfiniteVector<C,I,S>& v,
+				     const CoarseStrategy strategy) const
+  {
+    // We insert the largest in modulus entries into v until
+    //   \|*this-v\|_{\ell_2}\le\epsilon
+    // (at least the largest entry). To find them, we either
+    // - sort my entries in modulus (complexity O(N*log(N))), using a sorted vector
+    //   (preferred to a helper multimap object, since no slow insertion sort
+    //   algorithm is launched!), or
+    // - use binary binning (complexity O(N)): starting with the smallest entries,
+    //   complete bins are dropped as long as the tolerance is not exceeded,
+    //   only the bin in which the tolerance is reached has to be sorted.
+    // In both cases, we sum up the dropped entries instead of the kept ones
+    // (\|*this-v\|^2 instead of \|v\|^2 >= \|*this\|^2-\epsilon^2), since the
+    // latter criterion suffers from cancellation if \epsilon << \|*this\|.
 
     v.clear();
     if (size() > 0) {
       if (eps == 0)
 	v = *this;
       else {
-	
-	// prepare vector to be sorted
-	
-	std::vector<std::pair<I,C> > sv(size());
-	
+	std::vector<std::pair<I,C> > sv;
+	typename std::vector<std::pair<I,C> >::iterator last;
+	const double bound(eps*eps);
+	double dropnorm(0);
+	const double max_abs(strategy == coarse_sort ? 0 : linfty_norm(*this));
+
+	if (max_abs == 0) {
+	  // prepare vector to be sorted
+	  sv.resize(size());
+	  unsigned int id(0);
+	  for (const_iterator it(begin()), itend(end()); it != itend; ++it, ++id)
+	    sv[id] = std::pair<I,C>(it.index(), *it); // can't use make_pair for gcc 2.95
+
+	  // sort vector (Introsort, O(N*log N))
+	  sort(sv.begin(), sv.end(), decreasing_order());
+	  last = sv.end();
+	} else {
+	  // Setup the bins with respect to the largest entry. The entries of the
+	  // q-th bin have squared l_2 norm <= N*4^{-q}*max_abs^2 <= eps^2.
+	  const unsigned int q = (unsigned int)
+	    std::min(std::max(ceil(log(sqrt((double)size())*max_abs/eps)/M_LN2), 0.), 2048.);
+	  std::vector<unsigned int> offsets;
+	  binary_binning(max_abs, q, sv, offsets);
+
+	  // drop complete bins as long as the tolerance is not exceeded
+	  // (the 0-th bin contains the largest entry, which is always kept)
+	  unsigned int bin(q);
+	  for (; bin > 0; bin--) {
+	    double binnorm(0);
+	    for (unsigned int id(offsets[bin]); id < offsets[bin+1]; id++)
+	      binnorm += sv[id].second * sv[id].second;
+	    if (dropnorm + binnorm > bound)
+	      break;
+	    dropnorm += binnorm;
+	  }
 
-	//abort();
-	unsigned int id(0);
-	for (const_iterator it(begin()), itend(end()); it != itend; ++it, ++id) {
-	  //cout << it.index() << endl;
-	  sv[id] = std::pair<I,C>(it.index(), *it); // can't use make_pair for gcc 2.95
+	  // sort the bin in which the tolerance is reached
+	  sort(sv.begin() + offsets[bin], sv.begin() + offsets[bin+1], decreasing_order());
+	  last = sv.begin() + offsets[bin+1];
 	}
 
-	// sort vector (Introsort, O(N*log N))
-	sort(sv.begin(), sv.end(), decreasing_order());
-	// insert largest in modulus entries until tolerance is reached
-	double coarsenorm(0);
-	double nrm(l2_norm(*this));
-	double bound(nrm*nrm - eps*eps);
-	typename std::vector<std::pair<I,C> >::iterator it(sv.begin());
-	do
-	  {
-	    coarsenorm += it->second * it->second;
-	    ++it;
-	  }
-	while ((it != sv.end()) && (coarsenorm < bound));
-	sv.erase(it, sv.end());
+	// drop the smallest entries of the sorted range as long as the tolerance is not exceeded
+	while (last - sv.begin() > 1
+	       && dropnorm + (last-1)->second * (last-1)->second <= bound) {
+	  --last;
+	  dropnorm += last->second * last->second;
+	}
 
-	// insert relevant entries in v (-> insertion sort, we hope that
-	// the number of entries is neglectible)
-	for (unsigned int i(0); i < sv.size(); i++)
-	  v.set_coefficient(sv[i].first, sv[i].second);
+	// insert relevant entries in v, in the order of their indices
+	sort(sv.begin(), last);
+	for (typename std::vector<std::pair<I,C> >::const_iterator it(sv.begin()); it != last; ++it)
+	  v.set_coefficient(it->first, it->second);
       }
     }
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   const double
-  InfiniteVector<C,I>::wrmsqr_norm(const double atol, const double rtol,
-				   const InfiniteVector<C,I>& v, const InfiniteVector<C,I>& w) const
+  InfiniteVector<C,I,S>::wrmsqr_norm(const double atol, const double rtol,
+				     const InfiniteVector<C,I,S>& v, const InfiniteVector<C,I,S>& w) const
   {
     double result = 0;
     
@@ -666,205 +769,205 @@ namespace MathTL
     return result == 0 ? 0 : sqrt(result/size());
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  InfiniteVector<C,I>::const_iterator::
-  const_iterator(const typename std::map<I,C>::const_iterator& entry)
-    : std::map<I,C>::const_iterator(entry)
+  InfiniteVector<C,I,S>::const_iterator::
+  const_iterator(const typename S::const_iterator& entry)
+    : S::const_iterator(entry)
   {
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  typename InfiniteVector<C,I>::const_iterator
-  InfiniteVector<C,I>::begin() const
+  typename InfiniteVector<C,I,S>::const_iterator
+  InfiniteVector<C,I,S>::begin() const
   {
-    return const_iterator(std::map<I,C>::begin());
+    return const_iterator(S::begin());
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  typename InfiniteVector<C,I>::const_iterator
-  InfiniteVector<C,I>::end() const
+  typename InfiniteVector<C,I,S>::const_iterator
+  InfiniteVector<C,I,S>::end() const
   {
-    return const_iterator(std::map<I,C>::end());
+    return const_iterator(S::end());
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   const C&
-  InfiniteVector<C,I>::const_iterator::operator * () const
+  InfiniteVector<C,I,S>::const_iterator::operator * () const
   {
-    return (std::map<I,C>::const_iterator::operator *()).second;
+    return (S::const_iterator::operator *()).second;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   const C*
-  InfiniteVector<C,I>::const_iterator::operator -> () const
+  InfiniteVector<C,I,S>::const_iterator::operator -> () const
   {
-    return &((std::map<I,C>::const_iterator::operator *()).second);
+    return &((S::const_iterator::operator *()).second);
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  I InfiniteVector<C,I>::const_iterator::index() const
+  I InfiniteVector<C,I,S>::const_iterator::index() const
   {
-    return (std::map<I,C>::const_iterator::operator *()).first;
+    return (S::const_iterator::operator *()).first;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  typename InfiniteVector<C,I>::const_iterator&
-  InfiniteVector<C,I>::const_iterator::operator ++ ()
+  typename InfiniteVector<C,I,S>::const_iterator&
+  InfiniteVector<C,I,S>::const_iterator::operator ++ ()
   {
-    std::map<I,C>::const_iterator::operator ++ ();
+    S::const_iterator::operator ++ ();
     return *this;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  typename InfiniteVector<C,I>::const_iterator
-  InfiniteVector<C,I>::const_iterator::operator ++ (int step)
+  typename InfiniteVector<C,I,S>::const_iterator
+  InfiniteVector<C,I,S>::const_iterator::operator ++ (int step)
   {
-    typename InfiniteVector<C,I>::const_iterator r(*this);
-    std::map<I,C>::const_iterator::operator ++ (step);
+    typename InfiniteVector<C,I,S>::const_iterator r(*this);
+    S::const_iterator::operator ++ (step);
     return r;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   bool
-  InfiniteVector<C,I>::const_iterator::
+  InfiniteVector<C,I,S>::const_iterator::
   operator == (const const_iterator& it) const
   {
     // quick, dirty hack
-    return (static_cast<typename std::map<I,C>::const_iterator>(*this)
-	    == static_cast<typename std::map<I,C>::const_iterator>(it));
+    return (static_cast<typename S::const_iterator>(*this)
+	    == static_cast<typename S::const_iterator>(it));
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   bool
-  InfiniteVector<C,I>::const_iterator::
+  InfiniteVector<C,I,S>::const_iterator::
   operator != (const const_iterator& it) const
   {
     return !(*this == it);
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   bool
-  InfiniteVector<C,I>::const_iterator::
+  InfiniteVector<C,I,S>::const_iterator::
   operator < (const const_iterator& it) const
   {
     return (index() < it.index());
   }
 
-  template <class C, class I>
-  InfiniteVector<C,I>::const_reverse_iterator::
-  const_reverse_iterator(const std::reverse_iterator<typename std::map<I,C>::const_iterator>& entry)
-    : std::reverse_iterator<typename std::map<I,C>::const_iterator>(entry)
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S>::const_reverse_iterator::
+  const_reverse_iterator(const std::reverse_iterator<typename S::const_iterator>& entry)
+    : std::reverse_iterator<typename S::const_iterator>(entry)
   {
   }
 
-  template <class C, class I>
-  typename InfiniteVector<C,I>::const_reverse_iterator
-  InfiniteVector<C,I>::rbegin() const
+  template <class C, class I, class S>
+  typename InfiniteVector<C,I,S>::const_reverse_iterator
+  InfiniteVector<C,I,S>::rbegin() const
   {
-    return const_reverse_iterator(std::reverse_iterator<typename std::map<I,C>::const_iterator>
-				  (std::map<I,C>::end()));
+    return const_reverse_iterator(std::reverse_iterator<typename S::const_iterator>
+				  (S::end()));
   }
 
-  template <class C, class I>
-  typename InfiniteVector<C,I>::const_reverse_iterator
-  InfiniteVector<C,I>::rend() const
+  template <class C, class I, class S>
+  typename InfiniteVector<C,I,S>::const_reverse_iterator
+  InfiniteVector<C,I,S>::rend() const
   {
-    return const_reverse_iterator(std::reverse_iterator<typename std::map<I,C>::const_iterator>
-				  (std::map<I,C>::begin()));
+    return const_reverse_iterator(std::reverse_iterator<typename S::const_iterator>
+				  (S::begin()));
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   const C&
-  InfiniteVector<C,I>::const_reverse_iterator::operator * () const
+  InfiniteVector<C,I,S>::const_reverse_iterator::operator * () const
   {
-    return (std::reverse_iterator<typename std::map<I,C>::const_iterator>::operator *()).second;
+    return (std::reverse_iterator<typename S::const_iterator>::operator *()).second;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   const C*
-  InfiniteVector<C,I>::const_reverse_iterator::operator -> () const
+  InfiniteVector<C,I,S>::const_reverse_iterator::operator -> () const
   {
-    return &(std::reverse_iterator<typename std::map<I,C>::const_iterator>::operator *).second;
+    return &(std::reverse_iterator<typename S::const_iterator>::operator *).second;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  I InfiniteVector<C,I>::const_reverse_iterator::index() const
+  I InfiniteVector<C,I,S>::const_reverse_iterator::index() const
   {
-    return (std::reverse_iterator<typename std::map<I,C>::const_iterator>::operator *()).first;
+    return (std::reverse_iterator<typename S::const_iterator>::operator *()).first;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  typename InfiniteVector<C,I>::const_reverse_iterator&
-  InfiniteVector<C,I>::const_reverse_iterator::operator ++ ()
+  typename InfiniteVector<C,I,S>::const_reverse_iterator&
+  InfiniteVector<C,I,S>::const_reverse_iterator::operator ++ ()
   {
-    std::reverse_iterator<typename std::map<I,C>::const_iterator>::operator ++ ();
+    std::reverse_iterator<typename S::const_iterator>::operator ++ ();
     return *this;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  typename InfiniteVector<C,I>::const_reverse_iterator
-  InfiniteVector<C,I>::const_reverse_iterator::operator ++ (int step)
+  typename InfiniteVector<C,I,S>::const_reverse_iterator
+  InfiniteVector<C,I,S>::const_reverse_iterator::operator ++ (int step)
   {
-    typename InfiniteVector<C,I>::const_reverse_iterator r(*this);
-    std::reverse_iterator<typename std::map<I,C>::const_iterator>::operator ++ (step);
+    typename InfiniteVector<C,I,S>::const_reverse_iterator r(*this);
+    std::reverse_iterator<typename S::const_iterator>::operator ++ (step);
     return r;
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   bool
-  InfiniteVector<C,I>::const_reverse_iterator::
+  InfiniteVector<C,I,S>::const_reverse_iterator::
   operator == (const const_reverse_iterator& it) const
   {
     // quick, dirty hack
-    return (static_cast<std::reverse_iterator<typename std::map<I,C>::const_iterator> >(*this)
-	    == static_cast<std::reverse_iterator<typename std::map<I,C>::const_iterator> >(it));
+    return (static_cast<std::reverse_iterator<typename S::const_iterator> >(*this)
+	    == static_cast<std::reverse_iterator<typename S::const_iterator> >(it));
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   bool
-  InfiniteVector<C,I>::const_reverse_iterator::
+  InfiniteVector<C,I,S>::const_reverse_iterator::
   operator != (const const_reverse_iterator& it) const
   {
     return !(*this == it);
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
   bool
-  InfiniteVector<C,I>::const_reverse_iterator::
+  InfiniteVector<C,I,S>::const_reverse_iterator::
   operator < (const const_reverse_iterator& it) const
   {
     return (index() < it.index());
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   inline
-  void swap(InfiniteVector<C,I>& v1, InfiniteVector<C,I>& v2)
+  void swap(InfiniteVector<C,I,S>& v1, InfiniteVector<C,I,S>& v2)
   {
     v1.swap(v2);
   }
 
-  template <class C, class I>
+  template <class C, class I, class S>
   std::ostream& operator << (std::ostream& os,
-			     const InfiniteVector<C,I>& v)
+			     const InfiniteVector<C,I,S>& v)
   {
     if (v.begin() ==  v.end())
       {
@@ -872,7 +975,7 @@ namespace MathTL
       }
     else
       {
-	for (typename InfiniteVector<C,I>::const_iterator it(v.begin());
+	for (typename InfiniteVector<C,I,S>::const_iterator it(v.begin());
 	     it != v.end(); ++it)
 	  {
 	    os << it.index() << ": " << *it << std::endl;
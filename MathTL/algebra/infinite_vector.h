@@ -12,9 +12,11 @@
 
 #include <set>
 #include <map>
+#include <vector>
 #include <algorithm>
 #include <iterator>
 #include <utils/array1d.h>
+#include <utils/sorted_array_map.h>
 #include <algebra/infinite_matrix.h>
 
 // external functionality, for convenience:
@@ -23,6 +25,25 @@
 
 namespace MathTL
 {
+  /*!
+    strategies for InfiniteVector::COARSE():
+    - coarse_sort:    sort all entries by modulus, O(N*log N)
+    - coarse_binning: binary binning of the entries by modulus (quasi-sorting, cf. [B],[S]),
+                      O(N) plus the sort of the single bin in which the tolerance is reached
+    Both strategies yield the same (optimal) result, up to entries of equal modulus
+    and roundoff in the stopping criterion.
+
+    References:
+    [B] Barinka:
+        Fast Computation Tools for Adaptive Wavelet Schemes
+    [S] Stevenson:
+        Adaptive Solution of Operator Equations using Wavelet Frames
+  */
+  enum CoarseStrategy {
+    coarse_sort,
+    coarse_binning
+  };
+
   /*!
     A model class InfiniteVector<C,I> for inherently sparse,
     arbitrarily indexed vectors
@@ -33,10 +54,18 @@ namespace MathTL
     Although internally, we will model InfiniteVector as a map<I,C>,
     the access to the vector entries takes place by a nested iterator
     class (compare the deal.II matrix classes) which is STL-compatible.
+
+    The underlying map can be exchanged by the storage policy S.
+    Besides the default std::map<I,C>, one can use the flat storage
+    SortedArrayMap<I,C> (see utils/sorted_array_map.h), which keeps the
+    entries in one contiguous sorted array. Then all O(N) algorithms
+    (add(), sadd(), scale(), COARSE(), norms, ...) run over contiguous memory,
+    and set_coefficient()/add_coefficient() are buffered and merged in a batch
+    upon the next reading access.
   */
-  template <class C, class I = int>
+  template <class C, class I = int, class S = std::map<I,C> >
   class InfiniteVector
-    : protected std::map<I,C>
+    : protected S
   {
   public:
     /*!
@@ -47,44 +76,51 @@ namespace MathTL
     /*!
       copy constructor
     */
-    InfiniteVector(const InfiniteVector<C,I>& v);
+    InfiniteVector(const InfiniteVector<C,I,S>& v);
+
+    /*!
+      copy constructor from a vector with another storage policy
+    */
+    template <class S2>
+    explicit InfiniteVector(const InfiniteVector<C,I,S2>& v);
 
     /*!
       STL-compliant const_iterator scanning the nontrivial entries
     */
     class const_iterator
-      : protected std::map<I,C>::const_iterator
+      : protected S::const_iterator
     {
     public:
       /*!
 	make iterator category accessible
+	(only the increment is provided, independent of the storage policy)
       */
-      typedef typename std::map<I,C>::const_iterator::iterator_category iterator_category;
+      typedef std::forward_iterator_tag iterator_category;
 
       /*!
 	make value type accessible
       */
-      typedef typename std::map<I,C>::const_iterator::value_type value_type;
+      typedef typename S::const_iterator::value_type value_type;
 
       /*!
 	make difference type accessible
       */
-      typedef typename std::map<I,C>::const_iterator::difference_type difference_type;
+      typedef typename S::const_iterator::difference_type difference_type;
 
       /*!
 	make pointer type accessible
       */
-      typedef typename std::map<I,C>::const_iterator::pointer pointer;
+      typedef typename S::const_iterator::pointer pointer;
 
       /*!
 	make reference type accessible
       */
-      typedef typename std::map<I,C>::const_iterator::reference reference;
+      typedef typename S::const_iterator::reference reference;
 
       /*!
 	constructs a const_iterator from a map::const_iterator
       */
-      const_iterator(const typename std::map<I,C>::const_iterator& entry);
+      const_iterator(const typename S::const_iterator& entry);
 
       /*!
 	prefix increment of the const_iterator
@@ -143,13 +179,13 @@ namespace MathTL
       in a reverse way
     */
     class const_reverse_iterator
-      : protected std::reverse_iterator<typename std::map<I,C>::const_iterator>
+      : protected std::reverse_iterator<typename S::const_iterator>
     {
     public:
       /*!
 	constructs a const_reverse_iterator from a map::const_iterator
       */
-      const_reverse_iterator(const std::reverse_iterator<typename std::map<I,C>::const_iterator>& entry);
+      const_reverse_iterator(const std::reverse_iterator<typename S::const_iterator>& entry);
 
       /*!
 	prefix increment of the const_reverse_iterator
@@ -206,17 +242,17 @@ namespace MathTL
     /*!
       assignment from another vector
     */
-    InfiniteVector<C,I>& operator = (const InfiniteVector<C,I>& v);
+    InfiniteVector<C,I,S>& operator = (const InfiniteVector<C,I,S>& v);
 
     /*!
       swap components of two vectors
     */
-    void swap (InfiniteVector<C,I>& v);
+    void swap (InfiniteVector<C,I,S>& v);
 
     /*!
       test emptyness
     */
-    inline bool empty() const { return std::map<I,C>::empty(); }
+    inline bool empty() const { return S::empty(); }
 
     /*!
       set infinite vector to zero
@@ -226,12 +262,12 @@ namespace MathTL
     /*!
       equality test
     */
-    bool operator == (const InfiniteVector<C,I>& v) const;
+    bool operator == (const InfiniteVector<C,I,S>& v) const;
 
     /*!
       non-equality test
     */
-    bool operator != (const InfiniteVector<C,I>& v) const;
+    bool operator != (const InfiniteVector<C,I,S>& v) const;
 
     /*!
       read-only access to the vector entries
@@ -284,18 +320,18 @@ namespace MathTL
     /*!
       in place summation *this += v
     */
-    void add(const InfiniteVector<C,I>& v);
+    void add(const InfiniteVector<C,I,S>& v);
 
     /*!
       in place summation *this += s*v
     */
-    void add(const C s, const InfiniteVector<C,I>& v);
+    void add(const C s, const InfiniteVector<C,I,S>& v);
 
     /*!
       in place summation *this = s*(*this) + v
       (AXPY level 1 BLAS routine)
     */
-    void sadd(const C s, const InfiniteVector<C,I>& v);
+    void sadd(const C s, const InfiniteVector<C,I,S>& v);
 
     /*!
       in place scaling *this *= s
@@ -310,32 +346,32 @@ namespace MathTL
     /*!
       in place summation
     */
-    InfiniteVector<C,I>& operator += (const InfiniteVector<C,I>& v);
+    InfiniteVector<C,I,S>& operator += (const InfiniteVector<C,I,S>& v);
 
     /*!
       in place subtraction *this -= v
     */
-    void subtract(const InfiniteVector<C,I>& v);
+    void subtract(const InfiniteVector<C,I,S>& v);
 
     /*!
       in place subtraction
     */
-    InfiniteVector<C,I>& operator -= (const InfiniteVector<C,I>& v);
+    InfiniteVector<C,I,S>& operator -= (const InfiniteVector<C,I,S>& v);
 
     /*!
       in place multiplication with a scalar
     */
-    InfiniteVector<C,I>& operator *= (const C c);
+    InfiniteVector<C,I,S>& operator *= (const C c);
     
     /*!
       in place division by a (nontrivial) scalar
     */
-    InfiniteVector<C,I>& operator /= (const C c);
+    InfiniteVector<C,I,S>& operator /= (const C c);
 
     /*!
       inner product
     */
-    const C operator * (const InfiniteVector<C,I>& v) const;
+    const C operator * (const InfiniteVector<C,I,S>& v) const;
 
     /*!
       helper struct to handle decreasing order in modulus
@@ -362,16 +398,32 @@ namespace MathTL
       Computes optimal v such that \|*this-v\|_{\ell_2}\le\epsilon;
       "optimal" means taking the largest entries in modulus of *this.
       The vector v does not have to be initialized, it will be cleared
-      at the beginning of the algorithm
+      at the beginning of the algorithm.
+      The exact sort (coarse_sort) is kept for verification purposes.
+    */
+    void COARSE(const double eps, InfiniteVector<C,I,S>& v,
+		const CoarseStrategy strategy = coarse_binning) const;
+
+    /*!
+      Binary binning (quasi-sorting) of the entries by modulus in O(N) operations:
+      For a reference value r>0, the i-th bin contains the entries with modulus in
+      the interval (2^{-(i+1)}r,2^{-i}r], 0 <= i <= q-1, the remaining entries
+      (with even smaller modulus) are collected in the q-th bin (the entries with
+      modulus larger than r are put into the 0-th bin).
+      The bins are stored consecutively in sv, the i-th bin is the range
+      [offsets[i],offsets[i+1]) (offsets has q+2 entries). Within a bin,
+      the entries are ordered by their index.
     */
-    void COARSE(const double eps, InfiniteVector<C,I>& v) const;
+    void binary_binning(const double r, const unsigned int q,
+			std::vector<std::pair<I,C> >& sv,
+			std::vector<unsigned int>& offsets) const;
     
 //     /*!
 //       Computes v such that \|*this-v\|_{\ell_2}\le\epsilon;
 //       In contrast to the usual coarse routine, here the 
 //       This routine is a suggestion from Rob Stevenson.
 //     */
-//     void COARSE(const double eps, InfiniteVector<C,I>& v) const;
+//     void COARSE(const double eps, InfiniteVector<C,I,S>& v) const;
 
     /*!
       weighted root mean square norm
@@ -381,7 +433,7 @@ namespace MathTL
       of template functions is not allowed in C++)
     */
     const double wrmsqr_norm(const double atol, const double rtol,
-			     const InfiniteVector<C,I>& v, const InfiniteVector<C,I>& w) const; 
+			     const InfiniteVector<C,I,S>& v, const InfiniteVector<C,I,S>& w) const; 
   };
   
   /*!
@@ -389,11 +441,11 @@ namespace MathTL
     (you should avoid using this operator, since it requires one vector
     to be copied. Use += or add() instead!)
    */
-  template <class C, class I>
-  InfiniteVector<C,I> operator + (const InfiniteVector<C,I>& v1,
-				  const InfiniteVector<C,I>& v2)
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S> operator + (const InfiniteVector<C,I,S>& v1,
+				    const InfiniteVector<C,I,S>& v2)
   {
-    InfiniteVector<C,I> r(v1);
+    InfiniteVector<C,I,S> r(v1);
     r += v2;
     return r;
   }
@@ -403,29 +455,29 @@ namespace MathTL
     (you should avoid using this operator, since it requires one vector
     to be copied. Use -= or sadd() instead!)
    */
-  template <class C, class I>
-  InfiniteVector<C,I> operator - (const InfiniteVector<C,I>& v1,
-				  const InfiniteVector<C,I>& v2)
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S> operator - (const InfiniteVector<C,I,S>& v1,
+				    const InfiniteVector<C,I,S>& v2)
   {
-    InfiniteVector<C,I> r(v1);
+    InfiniteVector<C,I,S> r(v1);
     r -= v2;
     return r;
   }
 
   //! sign
-  template <class C, class I>
-  InfiniteVector<C,I> operator - (const InfiniteVector<C,I>& v)
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S> operator - (const InfiniteVector<C,I,S>& v)
   {
-    InfiniteVector<C,I> r(v);
+    InfiniteVector<C,I,S> r(v);
     r -= C(-1);
     return r;
   }
 
   //! scalar multiplication
-  template <class C, class I>
-  InfiniteVector<C,I> operator * (const C c, const InfiniteVector<C,I>& v)
+  template <class C, class I, class S>
+  InfiniteVector<C,I,S> operator * (const C c, const InfiniteVector<C,I,S>& v)
   {
-     InfiniteVector<C,I> r(v);
+     InfiniteVector<C,I,S> r(v);
      r *= c;
      return r;
   }
@@ -433,14 +485,14 @@ namespace MathTL
   /*!
     swap the values of two infinite vectors
   */
-  template <class C, class I>
-  void swap(InfiniteVector<C,I>& v1, InfiniteVector<C,I>& v2);
+  template <class C, class I, class S>
+  void swap(InfiniteVector<C,I,S>& v1, InfiniteVector<C,I,S>& v2);
 
   /*!
     stream output for infinite vectors
   */
-  template<class C, class I>
-  std::ostream& operator << (std::ostream& os, const InfiniteVector<C,I>& v);
+  template<class C, class I, class S>
+  std::ostream& operator << (std::ostream& os, const InfiniteVector<C,I,S>& v);
 }
 
 // include implementation of inline functions
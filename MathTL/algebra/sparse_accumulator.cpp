@@ -0,0 +1,110 @@
+// implementation for sparse_accumulator.h
+
+#include <algorithm>
+#include <utility>
+
+namespace MathTL
+{
+  template <class C>
+  SparseAccumulator<C>::SparseAccumulator(const size_type s)
+    : size_(s), indices_(), values_(), slots_()
+  {
+  }
+
+  template <class C>
+  void
+  SparseAccumulator<C>::resize(const size_type s)
+  {
+    size_ = s;
+    clear();
+  }
+
+  template <class C>
+  void
+  SparseAccumulator<C>::clear()
+  {
+    indices_.clear();
+    values_.clear();
+    slots_.clear();
+  }
+
+  template <class C>
+  inline
+  int
+  SparseAccumulator<C>::position(const size_type i) const
+  {
+    if (slots_.empty()) return -1;
+    const size_type mask(slots_.size()-1);
+    for (size_type h((i * 2654435761u) & mask);; h = (h+1) & mask) {
+      const int pos(slots_[h]);
+      if (pos < 0 || indices_[pos] == i) return pos;
+    }
+  }
+
+  template <class C>
+  inline
+  C
+  SparseAccumulator<C>::operator () (const size_type i) const
+  {
+    const int pos(position(i));
+    return pos < 0 ? C(0) : values_[pos];
+  }
+
+  template <class C>
+  inline
+  C&
+  SparseAccumulator<C>::operator [] (const size_type i)
+  {
+    const int pos(position(i));
+    if (pos >= 0) return values_[pos];
+
+    // keep the load factor of the hash table below 1/2
+    if (2*(indices_.size()+1) > slots_.size())
+      rehash(std::max((size_type)64, (size_type)(2*slots_.size())));
+
+    const size_type mask(slots_.size()-1);
+    size_type h((i * 2654435761u) & mask);
+    while (slots_[h] >= 0) h = (h+1) & mask;
+    slots_[h] = indices_.size();
+    indices_.push_back(i);
+    values_.push_back(C(0));
+    return values_.back();
+  }
+
+  template <class C>
+  void
+  SparseAccumulator<C>::rehash(const size_type capacity)
+  {
+    slots_.assign(capacity, -1);
+    const size_type mask(capacity-1);
+    for (size_type pos(0); pos < indices_.size(); pos++) {
+      size_type h((indices_[pos] * 2654435761u) & mask);
+      while (slots_[h] >= 0) h = (h+1) & mask;
+      slots_[h] = pos;
+    }
+  }
+
+  template <class C>
+  void
+  SparseAccumulator<C>::sort()
+  {
+    std::vector<std::pair<size_type, C> > entries(indices_.size());
+    for (size_type k(0); k < indices_.size(); k++)
+      entries[k] = std::make_pair(indices_[k], values_[k]);
+    std::sort(entries.begin(), entries.end());
+    for (size_type k(0); k < indices_.size(); k++) {
+      indices_[k] = entries[k].first;
+      values_[k] = entries[k].second;
+    }
+    if (!slots_.empty())
+      rehash(slots_.size());
+  }
+
+  template <class C>
+  std::ostream& operator << (std::ostream& os, const SparseAccumulator<C>& v)
+  {
+    for (typename SparseAccumulator<C>::size_type k(0); k < v.n_touched(); k++)
+      os << "(" << v.touched_index(k) << ", " << v.touched_value(k) << ")" << std::endl;
+    return os;
+  }
+}
@@ -0,0 +1,125 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of MathTL - the Mathematical Template Library    |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _MATHTL_SPARSE_ACCUMULATOR_H
+#define _MATHTL_SPARSE_ACCUMULATOR_H
+
+#include <vector>
+#include <iostream>
+
+namespace MathTL
+{
+  /*!
+    A sparse accumulator for vectors
+      x = (x_0, ... ,x_{n-1})
+    of a (possibly huge) logical dimension n, of which only a few entries are
+    written to, like the result vectors of the APPLY routines.
+
+    The writing access via operator [] has the same semantics as for Vector<C>,
+    so that routines like w[i] += ... can be used with both vector classes.
+    Entries which have not been accessed are zero.
+    Internally, the accessed ("touched") entries are stored in the order of
+    their first access, and their positions are found via an open-addressing
+    hash table (linear probing). Hence, the memory consumption and the cost of
+    clear() and of traversing the entries are proportional to the number of
+    touched entries, not to n.
+  */
+  template <class C>
+  class SparseAccumulator
+  {
+  public:
+    /*!
+      value type (cf. STL containers)
+    */
+    typedef C value_type;
+
+    /*!
+      size type (cf. STL containers)
+    */
+    typedef unsigned int size_type;
+
+    /*!
+      default constructor, yields an accumulator of logical dimension s
+    */
+    explicit SparseAccumulator(const size_type s = 0);
+
+    /*!
+      logical dimension n
+    */
+    size_type size() const { return size_; }
+
+    /*!
+      set the logical dimension, all entries are cleared
+    */
+    void resize(const size_type s);
+
+    /*!
+      remove all entries, the logical dimension is kept
+    */
+    void clear();
+
+    /*!
+      read access to the i-th entry (zero if it has not been touched)
+    */
+    C operator () (const size_type i) const;
+
+    /*!
+      read-write access to the i-th entry,
+      an untouched entry is created with value zero
+    */
+    C& operator [] (const size_type i);
+
+    /*!
+      number of touched entries
+    */
+    size_type n_touched() const { return indices_.size(); }
+
+    /*!
+      index of the k-th touched entry
+    */
+    size_type touched_index(const size_type k) const { return indices_[k]; }
+
+    /*!
+      value of the k-th touched entry
+    */
+    C touched_value(const size_type k) const { return values_[k]; }
+
+    /*!
+      sort the touched entries by their index
+    */
+    void sort();
+
+  protected:
+    //! position of entry i in indices_/values_, or -1
+    int position(const size_type i) const;
+
+    //! rebuild the hash table with a given capacity (power of 2)
+    void rehash(const size_type capacity);
+
+    //! logical dimension
+    size_type size_;
+
+    //! touched indices and the corresponding values
+    std::vector<size_type> indices_;
+    std::vector<C> values_;
+
+    //! hash table, empty slots are -1
+    std::vector<int> slots_;
+  };
+
+  /*!
+    stream output for sparse accumulators (touched entries only)
+  */
+  template <class C>
+  std::ostream& operator << (std::ostream& os, const SparseAccumulator<C>& v);
+}
+
+#include <algebra/sparse_accumulator.cpp>
+
+#endif
@@ -0,0 +1,640 @@
+// implementation for binary_io.h
+
+#include <cassert>
+
+namespace MathTL
+{
+  // magic number and endianness marker of the file header
+  static const char binary_io_magic[8] = { 'M', 'T', 'L', 'B', 'I', 'N', '0', '2' };
+  static const uint32_t binary_io_endianness = 0x01020304;
+
+  // encodings
+  static const uint32_t binary_double = 0;
+  static const uint32_t binary_float = 1;
+  static const uint32_t binary_varint = 2;
+  static const uint32_t binary_compressed = 4;
+
+  // field ids
+  static const uint32_t binary_values = 0;
+  static const uint32_t binary_indices = 1;
+  static const uint32_t binary_gridx = 2;
+  static const uint32_t binary_gridy = 3;
+
+  // number of padding bytes to a multiple of 8
+  inline uint64_t binary_io_padding(const uint64_t bytes)
+  {
+    return (8 - bytes%8) % 8;
+  }
+
+  inline
+  BinaryOutput::BinaryOutput(const char* filename,
+			     const bool append,
+			     const bool single_precision,
+			     const bool compress,
+			     const unsigned int chunk_size)
+    : single_precision_(single_precision), compress_(compress),
+      chunk_size_(chunk_size > 0 ? chunk_size : 1),
+      encoding_(0), buffered_(0), field_bytes_(0), last_index_(0)
+  {
+#if MATHTL_BINARY_IO_ZLIB!=1
+    if (compress_) {
+      std::cout << "BinaryOutput: compiled without zlib support, writing uncompressed data" << std::endl;
+      compress_ = false;
+    }
+#endif
+
+    bool new_file = true;
+    if (append) {
+      std::ifstream is(filename, std::ios::in|std::ios::binary);
+      if (is.good()) {
+	char magic[8];
+	is.read(magic, 8);
+	new_file = !is.good() || memcmp(magic, binary_io_magic, 8) != 0;
+      }
+    }
+
+    os_.open(filename, std::ios::out|std::ios::binary|(append && !new_file ? std::ios::app : std::ios::trunc));
+    if (!os_.is_open()) {
+      std::cout << "BinaryOutput: Could not open file " << filename << std::endl;
+      return;
+    }
+    if (new_file) {
+      const uint32_t reserved = 0;
+      os_.write(binary_io_magic, 8);
+      os_.write((const char*)&binary_io_endianness, sizeof(uint32_t));
+      os_.write((const char*)&reserved, sizeof(uint32_t));
+    }
+  }
+
+  inline
+  void
+  BinaryOutput::write_record_header(const uint32_t kind, const uint32_t fields, const long tag,
+				    const uint64_t rows, const uint64_t columns)
+  {
+    BinaryRecordHeader header;
+    header.kind = kind;
+    header.fields = fields;
+    header.tag = tag;
+    header.rows = rows;
+    header.columns = columns;
+    os_.write((const char*)&header, sizeof(BinaryRecordHeader));
+  }
+
+  inline
+  void
+  BinaryOutput::write_chunk(const char* data, const uint64_t bytes, const bool may_compress)
+  {
+    BinaryChunkHeader header;
+    header.raw_bytes = bytes;
+    header.stored_bytes = bytes;
+    const char* payload = data;
+#if MATHTL_BINARY_IO_ZLIB==1
+    std::vector<char> compressed;
+    if (may_compress && bytes > 0) {
+      uLongf length = compressBound(bytes);
+      compressed.resize(length);
+      compress2((Bytef*)&compressed[0], &length, (const Bytef*)data, bytes, Z_DEFAULT_COMPRESSION);
+      header.stored_bytes = length;
+      payload = &compressed[0];
+    }
+#endif
+    os_.write((const char*)&header, sizeof(BinaryChunkHeader));
+    os_.write(payload, header.stored_bytes);
+    const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    os_.write(zeros, binary_io_padding(header.stored_bytes));
+  }
+
+  inline
+  void
+  BinaryOutput::begin_values(const uint32_t id, const uint64_t count)
+  {
+    encoding_ = (single_precision_ ? binary_float : binary_double) | (compress_ ? binary_compressed : 0);
+
+    // uncompressed fields are a single chunk, so that they are contiguous in the file
+    BinaryFieldHeader header;
+    header.id = id;
+    header.encoding = encoding_;
+    header.count = count;
+    header.chunks = compress_ ? (count+chunk_size_-1)/chunk_size_ : 1;
+    os_.write((const char*)&header, sizeof(BinaryFieldHeader));
+
+    if (!compress_) {
+      const uint64_t entry_bytes = single_precision_ ? sizeof(float) : sizeof(double);
+      if (count > (uint64_t)-1 / entry_bytes) {
+	std::cout << "BinaryOutput: field with " << count << " entries is too large" << std::endl;
+	os_.setstate(std::ios::failbit);
+	return;
+      }
+      BinaryChunkHeader chunk;
+      chunk.raw_bytes = chunk.stored_bytes = count * entry_bytes;
+      os_.write((const char*)&chunk, sizeof(BinaryChunkHeader));
+      field_bytes_ = chunk.raw_bytes;
+    }
+
+    buffer_.clear();
+    buffered_ = 0;
+  }
+
+  inline
+  void
+  BinaryOutput::begin_indices(const uint32_t id, const uint64_t count)
+  {
+    encoding_ = binary_varint | (compress_ ? binary_compressed : 0);
+
+    BinaryFieldHeader header;
+    header.id = id;
+    header.encoding = encoding_;
+    header.count = count;
+    header.chunks = (count+chunk_size_-1)/chunk_size_;
+    os_.write((const char*)&header, sizeof(BinaryFieldHeader));
+
+    buffer_.clear();
+    buffered_ = 0;
+    last_index_ = 0;
+  }
+
+  inline
+  void
+  BinaryOutput::push_value(const double x)
+  {
+    if (single_precision_) {
+      const float y = x;
+      buffer_.insert(buffer_.end(), (const char*)&y, (const char*)&y + sizeof(float));
+    } else
+      buffer_.insert(buffer_.end(), (const char*)&x, (const char*)&x + sizeof(double));
+    if (++buffered_ == chunk_size_)
+      flush_chunk();
+  }
+
+  inline
+  void
+  BinaryOutput::push_index(const long k)
+  {
+    // zigzag encoding of the difference, then 7 bits per byte
+    const int64_t d = k - last_index_;
+    last_index_ = k;
+    uint64_t z = ((uint64_t)d << 1) ^ (uint64_t)(d >> 63);
+    while (z >= 0x80) {
+      buffer_.push_back((char)((z & 0x7f) | 0x80));
+      z >>= 7;
+    }
+    buffer_.push_back((char)z);
+    if (++buffered_ == chunk_size_)
+      flush_chunk();
+  }
+
+  inline
+  void
+  BinaryOutput::flush_chunk()
+  {
+    if (buffered_ == 0) return;
+    if (encoding_ & (binary_compressed|binary_varint))
+      write_chunk(&buffer_[0], buffer_.size(), (encoding_ & binary_compressed) != 0);
+    else
+      os_.write(&buffer_[0], buffer_.size()); // part of the single chunk of the field
+    buffer_.clear();
+    buffered_ = 0;
+  }
+
+  inline
+  void
+  BinaryOutput::end_field()
+  {
+    flush_chunk();
+    if ((encoding_ & (binary_compressed|binary_varint)) == 0) {
+      // padding of the single chunk
+      const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+      os_.write(zeros, binary_io_padding(field_bytes_));
+    }
+  }
+
+  template <class C>
+  void
+  BinaryOutput::write(const Vector<C>& v, const long tag)
+  {
+    write_record_header(binary_vector, 1, tag, v.size(), 1);
+    begin_values(binary_values, v.size());
+    for (unsigned int i = 0; i < v.size(); i++)
+      push_value(v[i]);
+    end_field();
+    os_.flush();
+  }
+
+  template <class C>
+  void
+  BinaryOutput::write(const InfiniteVector<C,int>& v, const long tag)
+  {
+    write_record_header(binary_infinite_vector, 2, tag, v.size(), 1);
+    begin_indices(binary_indices, v.size());
+    for (typename InfiniteVector<C,int>::const_iterator it(v.begin()); it != v.end(); ++it)
+      push_index(it.index());
+    end_field();
+    begin_values(binary_values, v.size());
+    for (typename InfiniteVector<C,int>::const_iterator it(v.begin()); it != v.end(); ++it)
+      push_value(*it);
+    end_field();
+    os_.flush();
+  }
+
+  template <class C>
+  void
+  BinaryOutput::write(const SampledMapping<1,C>& s, const long tag)
+  {
+    const Array1D<double>& points(s.points());
+    write_record_header(binary_sampled_mapping_1d, 2, tag, 1, points.size());
+    begin_values(binary_gridx, points.size());
+    for (unsigned int i = 0; i < points.size(); i++)
+      push_value(points[i]);
+    end_field();
+    begin_values(binary_values, points.size());
+    for (unsigned int i = 0; i < points.size(); i++)
+      push_value(s.values()[i]);
+    end_field();
+    os_.flush();
+  }
+
+  template <class C>
+  void
+  BinaryOutput::write(const SampledMapping<2,C>& s, const long tag)
+  {
+    const unsigned int rows = s.values().row_dimension(), columns = s.values().column_dimension();
+    write_record_header(binary_sampled_mapping_2d, 3, tag, rows, columns);
+    begin_values(binary_gridx, rows*columns);
+    for (unsigned int i = 0; i < rows; i++)
+      for (unsigned int j = 0; j < columns; j++)
+	push_value(s.gridx().get_entry(i, j));
+    end_field();
+    begin_values(binary_gridy, rows*columns);
+    for (unsigned int i = 0; i < rows; i++)
+      for (unsigned int j = 0; j < columns; j++)
+	push_value(s.gridy().get_entry(i, j));
+    end_field();
+    begin_values(binary_values, rows*columns);
+    for (unsigned int i = 0; i < rows; i++)
+      for (unsigned int j = 0; j < columns; j++)
+	push_value(s.values().get_entry(i, j));
+    end_field();
+    os_.flush();
+  }
+
+  inline
+  BinaryInput::BinaryInput(const char* filename)
+    : data_(0), size_(0), mapped_(false), good_(false), truncated_(false)
+  {
+#ifdef _MATHTL_BINARY_IO_MMAP
+    const int fd = open(filename, O_RDONLY);
+    if (fd >= 0) {
+      struct stat st;
+      if (fstat(fd, &st) == 0 && st.st_size > 0) {
+	void* p = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (p != MAP_FAILED) {
+	  data_ = (const char*)p;
+	  size_ = st.st_size;
+	  mapped_ = true;
+	}
+      }
+      ::close(fd);
+    }
+#endif
+    if (!mapped_) {
+      std::ifstream is(filename, std::ios::in|std::ios::binary);
+      if (!is.good()) {
+	std::cout << "BinaryInput: Could not open file " << filename << std::endl;
+	return;
+      }
+      is.seekg(0, std::ios::end);
+      size_ = is.tellg();
+      is.seekg(0, std::ios::beg);
+      memory_.resize(size_ + 8); // double alignment of std::vector<char> is not guaranteed
+      const size_t shift = binary_io_padding((size_t)&memory_[0] % 8);
+      is.read(&memory_[shift], size_);
+      data_ = &memory_[shift];
+    }
+    scan();
+  }
+
+  inline
+  BinaryInput::~BinaryInput()
+  {
+#ifdef _MATHTL_BINARY_IO_MMAP
+    if (mapped_)
+      munmap((void*)data_, size_);
+#endif
+  }
+
+  inline
+  void
+  BinaryInput::scan()
+  {
+    if (size_ < 16 || memcmp(data_, binary_io_magic, 8) != 0) {
+      std::cout << "BinaryInput: not a binary MathTL file" << std::endl;
+      return;
+    }
+    if (*(const uint32_t*)(data_+8) != binary_io_endianness) {
+      std::cout << "BinaryInput: file was written with a different byte order" << std::endl;
+      return;
+    }
+
+    size_t offset = 16;
+    while (offset < size_) {
+      Record record;
+      if (!scan_record(offset, record)) {
+	// keep the complete records before an incomplete one
+	std::cout << "BinaryInput: file is truncated after " << records_.size() << " records" << std::endl;
+	truncated_ = true;
+	break;
+      }
+      records_.push_back(record);
+    }
+    good_ = true;
+  }
+
+  inline
+  bool
+  BinaryInput::scan_record(size_t& offset, Record& record) const
+  {
+    if (sizeof(BinaryRecordHeader) > size_ - offset) return false;
+    memcpy(&record.header, data_+offset, sizeof(BinaryRecordHeader));
+    offset += sizeof(BinaryRecordHeader);
+    for (unsigned int f = 0; f < record.header.fields; f++) {
+      if (sizeof(BinaryFieldHeader) > size_ - offset) return false;
+      Field field;
+      memcpy(&field.header, data_+offset, sizeof(BinaryFieldHeader));
+      offset += sizeof(BinaryFieldHeader);
+      field.offset = offset;
+      for (uint64_t c = 0; c < field.header.chunks; c++) {
+	if (sizeof(BinaryChunkHeader) > size_ - offset) return false;
+	BinaryChunkHeader chunk;
+	memcpy(&chunk, data_+offset, sizeof(BinaryChunkHeader));
+	offset += sizeof(BinaryChunkHeader);
+	if (chunk.stored_bytes > size_ - offset) return false;
+	offset += chunk.stored_bytes;
+	offset += std::min((uint64_t)(size_ - offset), binary_io_padding(chunk.stored_bytes));
+      }
+      record.fields.push_back(field);
+    }
+    return true;
+  }
+
+  inline
+  const BinaryInput::Field*
+  BinaryInput::field(const unsigned int r, const uint32_t id) const
+  {
+    assert(r < records_.size());
+    for (unsigned int f = 0; f < records_[r].fields.size(); f++)
+      if (records_[r].fields[f].header.id == id)
+	return &records_[r].fields[f];
+    return 0;
+  }
+
+  inline
+  const double*
+  BinaryInput::values(const unsigned int r) const
+  {
+    const Field* f = field(r, binary_values);
+    if (f == 0 || f->header.encoding != binary_double || f->header.chunks != 1)
+      return 0;
+    BinaryChunkHeader header;
+    memcpy(&header, data_+f->offset, sizeof(BinaryChunkHeader));
+    if (header.stored_bytes != header.raw_bytes
+	|| header.raw_bytes / sizeof(double) != f->header.count
+	|| header.raw_bytes % sizeof(double) != 0)
+      return 0;
+    return (const double*)(data_ + f->offset + sizeof(BinaryChunkHeader));
+  }
+
+  inline
+  const char*
+  BinaryInput::chunk(const size_t offset, BinaryChunkHeader& header, std::vector<char>& buffer) const
+  {
+    memcpy(&header, data_+offset, sizeof(BinaryChunkHeader));
+    const char* payload = data_ + offset + sizeof(BinaryChunkHeader);
+    if (header.stored_bytes == header.raw_bytes)
+      return payload;
+#if MATHTL_BINARY_IO_ZLIB==1
+    // zlib does not compress by more than a factor of about 1000
+    if (header.raw_bytes / 1024 > header.stored_bytes) {
+      std::cout << "BinaryInput: corrupt compressed chunk" << std::endl;
+      return 0;
+    }
+    buffer.resize(header.raw_bytes);
+    uLongf length = header.raw_bytes;
+    if (header.raw_bytes > 0 && length == header.raw_bytes
+	&& uncompress((Bytef*)&buffer[0], &length, (const Bytef*)payload, header.stored_bytes) == Z_OK
+	&& length == header.raw_bytes)
+      return &buffer[0];
+    std::cout << "BinaryInput: corrupt compressed chunk" << std::endl;
+    return 0;
+#else
+    std::cout << "BinaryInput: compiled without zlib support, cannot read compressed data" << std::endl;
+    return 0;
+#endif
+  }
+
+  inline
+  bool
+  BinaryInput::decode_values(const Field& f, std::vector<double>& values) const
+  {
+    const uint32_t encoding = f.header.encoding & ~binary_compressed;
+    const size_t entry_bytes = encoding == binary_float ? sizeof(float) : sizeof(double);
+    bool ok = encoding == binary_double || encoding == binary_float;
+    values.resize(ok ? f.header.count : 0);
+    std::vector<char> buffer;
+    size_t offset = f.offset, n = 0;
+    for (uint64_t c = 0; c < f.header.chunks && ok; c++) {
+      BinaryChunkHeader header;
+      const char* payload = chunk(offset, header, buffer);
+      // each chunk has to hold a whole number of entries and must not exceed the field
+      const uint64_t entries = header.raw_bytes / entry_bytes;
+      ok = payload != 0 && header.raw_bytes % entry_bytes == 0 && entries <= values.size() - n;
+      if (!ok) break;
+      if (encoding == binary_float) {
+	for (uint64_t b = 0; b < header.raw_bytes; b += sizeof(float), n++) {
+	  float y;
+	  memcpy(&y, payload+b, sizeof(float));
+	  values[n] = y;
+	}
+      } else if (entries > 0) {
+	memcpy(&values[n], payload, header.raw_bytes);
+	n += entries;
+      }
+      offset += sizeof(BinaryChunkHeader) + header.stored_bytes + binary_io_padding(header.stored_bytes);
+    }
+    if (!ok || n != values.size()) {
+      std::cout << "BinaryInput: corrupt field of values" << std::endl;
+      values.clear();
+      return false;
+    }
+    return true;
+  }
+
+  inline
+  bool
+  BinaryInput::decode_indices(const Field& f, std::vector<long>& indices) const
+  {
+    bool ok = (f.header.encoding & ~binary_compressed) == binary_varint;
+    indices.resize(ok ? f.header.count : 0);
+    std::vector<char> buffer;
+    size_t offset = f.offset, n = 0;
+    long k = 0;
+    for (uint64_t c = 0; c < f.header.chunks && ok; c++) {
+      BinaryChunkHeader header;
+      const unsigned char* payload = (const unsigned char*)chunk(offset, header, buffer);
+      ok = payload != 0;
+      for (uint64_t b = 0; ok && b < header.raw_bytes; n++) {
+	ok = n < indices.size();
+	uint64_t z = 0;
+	int shift = 0;
+	unsigned char byte = 0x80;
+	for (; ok && (byte & 0x80); shift += 7) {
+	  ok = b < header.raw_bytes && shift < 64;
+	  if (ok) {
+	    byte = payload[b++];
+	    z |= (uint64_t)(byte & 0x7f) << shift;
+	  }
+	}
+	if (ok) {
+	  k += (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+	  indices[n] = k;
+	}
+      }
+      offset += sizeof(BinaryChunkHeader) + header.stored_bytes + binary_io_padding(header.stored_bytes);
+    }
+    if (!ok || n != indices.size()) {
+      std::cout << "BinaryInput: corrupt field of indices" << std::endl;
+      indices.clear();
+      return false;
+    }
+    return true;
+  }
+
+  template <class C>
+  bool
+  BinaryInput::read(const unsigned int r, Vector<C>& v) const
+  {
+    const Field* f = field(r, binary_values);
+    std::vector<double> values;
+    if (f == 0 || !decode_values(*f, values))
+      return false;
+    v.resize(values.size(), false);
+    for (unsigned int i = 0; i < values.size(); i++)
+      v[i] = values[i];
+    return true;
+  }
+
+  template <class C>
+  bool
+  BinaryInput::read(const unsigned int r, InfiniteVector<C,int>& v) const
+  {
+    const Field* fi = field(r, binary_indices);
+    const Field* fv = field(r, binary_values);
+    std::vector<long> indices;
+    std::vector<double> values;
+    if (fi == 0 || fv == 0 || !decode_indices(*fi, indices) || !decode_values(*fv, values)
+	|| indices.size() != values.size())
+      return false;
+    v.clear();
+    for (unsigned int i = 0; i < indices.size(); i++)
+      v.set_coefficient(indices[i], values[i]);
+    return true;
+  }
+
+  template <class C>
+  bool
+  BinaryInput::read(const unsigned int r, SampledMapping<1,C>& s) const
+  {
+    const Field* fx = field(r, binary_gridx);
+    const Field* fv = field(r, binary_values);
+    std::vector<double> x, values;
+    if (fx == 0 || fv == 0 || !decode_values(*fx, x) || !decode_values(*fv, values)
+	|| x.size() != values.size())
+      return false;
+    Array1D<double> points(x.size());
+    Array1D<C> svalues(values.size());
+    for (unsigned int i = 0; i < x.size(); i++) {
+      points[i] = x[i];
+      svalues[i] = values[i];
+    }
+    s = SampledMapping<1,C>(Grid<1>(points), svalues);
+    return true;
+  }
+
+  template <class C>
+  bool
+  BinaryInput::read(const unsigned int r, SampledMapping<2,C>& s) const
+  {
+    const Field* fx = field(r, binary_gridx);
+    const Field* fy = field(r, binary_gridy);
+    const Field* fv = field(r, binary_values);
+    std::vector<double> x, y, values;
+    if (fx == 0 || fy == 0 || fv == 0
+	|| !decode_values(*fx, x) || !decode_values(*fy, y) || !decode_values(*fv, values))
+      return false;
+    const unsigned int rows = records_[r].header.rows, columns = records_[r].header.columns;
+    if (records_[r].header.rows != rows || records_[r].header.columns != columns
+	|| x.size() != (uint64_t)rows*columns || y.size() != x.size() || values.size() != x.size())
+      return false;
+    Matrix<double> gridx(rows, columns), gridy(rows, columns);
+    Matrix<C> svalues(rows, columns);
+    for (unsigned int i = 0, n = 0; i < rows; i++)
+      for (unsigned int j = 0; j < columns; j++, n++) {
+	gridx.set_entry(i, j, x[n]);
+	gridy.set_entry(i, j, y[n]);
+	svalues.set_entry(i, j, values[n]);
+      }
+    s = SampledMapping<2,C>(Grid<2>(gridx, gridy), svalues);
+    return true;
+  }
+
+  inline
+  void
+  binary_to_matlab(const char* filename, std::ostream& os)
+  {
+    BinaryInput input(filename);
+    if (!input.good()) return;
+    for (unsigned int r = 0; r < input.records(); r++) {
+      os << "% record " << r << ", tag " << input.tag(r) << std::endl;
+      switch (input.kind(r)) {
+      case binary_sampled_mapping_1d: {
+	SampledMapping<1> s;
+	if (!input.read(r, s)) break;
+	s.matlab_output(os);
+	continue;
+      }
+      case binary_sampled_mapping_2d: {
+	SampledMapping<2> s;
+	if (!input.read(r, s)) break;
+	s.matlab_output(os);
+	continue;
+      }
+      case binary_vector: {
+	Vector<double> v;
+	if (!input.read(r, v)) break;
+	os << "v = [";
+	for (unsigned int i = 0; i < v.size(); i++)
+	  os << (i > 0 ? " " : "") << v[i];
+	os << "];" << std::endl;
+	continue;
+      }
+      case binary_infinite_vector: {
+	InfiniteVector<double,int> v;
+	if (!input.read(r, v)) break;
+	os << "indices = [";
+	for (InfiniteVector<double,int>::const_iterator it(v.begin()); it != v.end(); ++it)
+	  os << (it == v.begin() ? "" : " ") << it.index();
+	os << "];" << std::endl << "values = [";
+	for (InfiniteVector<double,int>::const_iterator it(v.begin()); it != v.end(); ++it)
+	  os << (it == v.begin() ? "" : " ") << *it;
+	os << "];" << std::endl;
+	continue;
+      }
+      default:
+	os << "% unknown record" << std::endl;
+	continue;
+      }
+      os << "% corrupt record" << std::endl;
+    }
+    if (input.truncated())
+      os << "% truncated record" << std::endl;
+  }
+}
@@ -0,0 +1,272 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of MathTL - the Mathematical Template Library    |
+// |                                                                    |
+// | Copyright (c) 2002-2014                                            |
+// | Thorsten Raasch, Manuel Werner, Ulrich Friedrich                   |
+// +--------------------------------------------------------------------+
+
+#ifndef _MATHTL_BINARY_IO_H
+#define _MATHTL_BINARY_IO_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstring>
+#include <stdint.h>
+
+#include <algebra/vector.h>
+#include <algebra/matrix.h>
+#include <algebra/infinite_vector.h>
+#include <geometry/grid.h>
+#include <geometry/sampled_mapping.h>
+#include <utils/array1d.h>
+
+// define MATHTL_BINARY_IO_ZLIB=1 (and link with -lz) to enable compressed output
+#if MATHTL_BINARY_IO_ZLIB==1
+#include <zlib.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define _MATHTL_BINARY_IO_MMAP 1
+#endif
+
+namespace MathTL
+{
+  /*
+    Binary output of sampled mappings and coefficient vectors.
+
+    A file consists of a 16 byte file header ("MTLBIN02" and an endianness marker)
+    and an arbitrary number of records, so that several objects (e.g., the iterates
+    of a solver) can be appended one after the other. Each record consists of
+
+      - a record header: kind of object, a user defined tag (e.g., the iteration number),
+        the dimensions (rows/columns of the grid, length of the vector), number of fields,
+      - the fields (values, indices, grid coordinates), each with a field header
+        (id, encoding, number of entries, number of chunks), followed by its chunks.
+
+    Each chunk has a header (64 bit raw and stored size in bytes) and a payload which is padded
+    to a multiple of 8 bytes, so that uncompressed double precision fields, which are
+    written as a single chunk, can be accessed in place in a memory mapped file.
+    Values can optionally be stored in single precision and (with MATHTL_BINARY_IO_ZLIB==1)
+    be compressed chunk by chunk. Indices of sparse vectors are stored as variable-length
+    integers of the (zigzag encoded) differences of consecutive indices.
+    All data is written in the byte order of the machine.
+  */
+
+  //! kinds of records
+  enum BinaryRecordKind {
+    binary_sampled_mapping_1d = 1,
+    binary_sampled_mapping_2d = 2,
+    binary_vector = 3,
+    binary_infinite_vector = 4
+  };
+
+  //! header of a record
+  struct BinaryRecordHeader
+  {
+    uint32_t kind;
+    uint32_t fields;
+    int64_t tag;
+    uint64_t rows;
+    uint64_t columns;
+  };
+
+  //! header of a field
+  struct BinaryFieldHeader
+  {
+    uint32_t id;       // 0: values, 1: indices, 2: x coordinates, 3: y coordinates
+    uint32_t encoding; // 0: double, 1: float, 2: varint differences; +4: zlib compressed
+    uint64_t count;
+    uint64_t chunks;
+  };
+
+  //! header of a chunk
+  struct BinaryChunkHeader
+  {
+    uint64_t raw_bytes;
+    uint64_t stored_bytes;
+  };
+
+  /*!
+    incremental binary output of sampled mappings and coefficient vectors into a file,
+    the records are flushed after writing
+  */
+  class BinaryOutput
+  {
+  public:
+    /*!
+      open a file for writing (or appending to an existing file); values can be stored
+      in single precision, and be compressed (with MATHTL_BINARY_IO_ZLIB==1);
+      chunk_size is the number of entries per chunk
+    */
+    BinaryOutput(const char* filename,
+		 const bool append = false,
+		 const bool single_precision = false,
+		 const bool compress = false,
+		 const unsigned int chunk_size = 1<<16);
+
+    //! destructor, closes the file
+    ~BinaryOutput() { close(); }
+
+    //! check whether all output succeeded
+    bool good() const { return os_.good(); }
+
+    //! close the file
+    void close() { if (os_.is_open()) os_.close(); }
+
+    //! write a dense vector
+    template <class C>
+    void write(const Vector<C>& v, const long tag = 0);
+
+    //! write a sparse coefficient vector
+    template <class C>
+    void write(const InfiniteVector<C,int>& v, const long tag = 0);
+
+    //! write a 1D sampled mapping (grid and values)
+    template <class C>
+    void write(const SampledMapping<1,C>& s, const long tag = 0);
+
+    //! write a 2D sampled mapping (grid and values)
+    template <class C>
+    void write(const SampledMapping<2,C>& s, const long tag = 0);
+
+  protected:
+    std::ofstream os_;
+    bool single_precision_, compress_;
+    unsigned int chunk_size_;
+
+    // state of the field being written
+    uint32_t encoding_;
+    std::vector<char> buffer_;
+    unsigned int buffered_;
+    uint64_t field_bytes_;
+    long last_index_;
+
+    void write_record_header(const uint32_t kind, const uint32_t fields, const long tag,
+			     const uint64_t rows, const uint64_t columns);
+
+    // start a field of values or indices with count entries
+    void begin_values(const uint32_t id, const uint64_t count);
+    void begin_indices(const uint32_t id, const uint64_t count);
+
+    // append an entry to the current field
+    void push_value(const double x);
+    void push_index(const long k);
+
+    // write the buffered entries as a chunk
+    void flush_chunk();
+    void end_field();
+
+    void write_chunk(const char* data, const uint64_t bytes, const bool may_compress);
+  };
+
+  /*!
+    reading binary files written by BinaryOutput,
+    the file is memory mapped where possible (otherwise read into memory)
+  */
+  class BinaryInput
+  {
+  public:
+    //! open a file and scan its records
+    BinaryInput(const char* filename);
+
+    //! destructor, unmaps the file
+    ~BinaryInput();
+
+    //! check whether the file could be opened and scanned
+    bool good() const { return good_; }
+
+    /*!
+      check whether the file ends with an incomplete record (e.g., written by an
+      interrupted program); the complete records before it can still be read
+    */
+    bool truncated() const { return truncated_; }
+
+    //! number of records
+    unsigned int records() const { return records_.size(); }
+
+    //! kind, tag and dimensions of the r-th record
+    int kind(const unsigned int r) const { return records_[r].header.kind; }
+    long tag(const unsigned int r) const { return records_[r].header.tag; }
+    unsigned long rows(const unsigned int r) const { return records_[r].header.rows; }
+    unsigned long columns(const unsigned int r) const { return records_[r].header.columns; }
+
+    /*!
+      direct access to the values of the r-th record in the mapped file,
+      if they are stored uncompressed in double precision (0 otherwise)
+    */
+    const double* values(const unsigned int r) const;
+
+    /*
+      The following routines read the r-th record, they return false
+      (and do not modify the argument) if the record is corrupt.
+    */
+
+    //! read the r-th record into a dense vector
+    template <class C>
+    bool read(const unsigned int r, Vector<C>& v) const;
+
+    //! read the r-th record into a sparse coefficient vector
+    template <class C>
+    bool read(const unsigned int r, InfiniteVector<C,int>& v) const;
+
+    //! read the r-th record into a 1D sampled mapping
+    template <class C>
+    bool read(const unsigned int r, SampledMapping<1,C>& s) const;
+
+    //! read the r-th record into a 2D sampled mapping
+    template <class C>
+    bool read(const unsigned int r, SampledMapping<2,C>& s) const;
+
+  protected:
+    const char* data_;
+    size_t size_;
+    bool mapped_, good_, truncated_;
+    std::vector<char> memory_;
+
+    struct Field
+    {
+      BinaryFieldHeader header;
+      size_t offset; // of the first chunk header
+    };
+
+    struct Record
+    {
+      BinaryRecordHeader header;
+      std::vector<Field> fields;
+    };
+
+    std::vector<Record> records_;
+
+    void scan();
+
+    // scan the record at a given offset, false if it is incomplete
+    bool scan_record(size_t& offset, Record& record) const;
+
+    // find a field of a record, 0 if it does not exist
+    const Field* field(const unsigned int r, const uint32_t id) const;
+
+    // decode a field, false if it is corrupt
+    bool decode_values(const Field& f, std::vector<double>& values) const;
+    bool decode_indices(const Field& f, std::vector<long>& indices) const;
+
+    // payload of a chunk, uncompressed (0 if it cannot be uncompressed)
+    const char* chunk(const size_t offset, BinaryChunkHeader& header, std::vector<char>& buffer) const;
+  };
+
+  /*!
+    convert all records of a binary file into the Matlab text format of
+    SampledMapping::matlab_output(), vectors are written as [x_1 ... x_n]
+  */
+  void binary_to_matlab(const char* filename, std::ostream& os);
+}
+
+#include <io/binary_io.cpp>
+
+#endif
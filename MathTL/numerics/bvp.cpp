@@ -12,7 +12,7 @@ namespace MathTL
   EllipticBVP<DIM>::EllipticBVP(const Function<DIM>* a,
 				const Function<DIM>* q,
 				const Function<DIM>* f)
-    : a_(a), q_(q), f_(f)
+    : a_(a), q_(q), f_(f), bulk_f_(false)
   {
   }
 
@@ -28,18 +28,21 @@ namespace MathTL
   PoissonBVP<DIM>::PoissonBVP(const Function<DIM>* f)
     : EllipticBVP<DIM>(f, f, f)
   {
+    this->bulk_f_ = true;
   }
 
   template <unsigned int DIM>
   PoissonBVP_Coeff<DIM>::PoissonBVP_Coeff(const Function<DIM>* a, const Function<DIM>* f)
     : EllipticBVP<DIM>(a, f, f)
   {
+    this->bulk_f_ = true;
   }
 
   template <unsigned int DIM>
   PoissonBVP_Coeff<DIM>::PoissonBVP_Coeff(const Function<DIM>* a, const Function<DIM>* f, const Function<DIM>* f_ar)
     : EllipticBVP<DIM>(a, f, f), f_ar_(f_ar)
   {
+    this->bulk_f_ = true;
   }
 
   template <unsigned int DIM>
@@ -51,10 +54,49 @@ namespace MathTL
 
 
 
+  template <unsigned int DIM>
+  SeparableBVP<DIM>::SeparableBVP(const FixedArray1D<const Function<1>*,DIM>& a_factors,
+				  const Function<DIM>* f)
+    : EllipticBVP<DIM>(f, f, f), a_factors_(a_factors), has_q_(false)
+  {
+    this->bulk_f_ = true;
+  }
+
+  template <unsigned int DIM>
+  SeparableBVP<DIM>::SeparableBVP(const FixedArray1D<const Function<1>*,DIM>& a_factors,
+				  const FixedArray1D<const Function<1>*,DIM>& q_factors,
+				  const Function<DIM>* f)
+    : EllipticBVP<DIM>(f, f, f), a_factors_(a_factors), q_factors_(q_factors), has_q_(true)
+  {
+    this->bulk_f_ = true;
+  }
+
+  template <unsigned int DIM>
+  const double
+  SeparableBVP<DIM>::a(const Point<DIM>& x) const
+  {
+    double r = 1.0;
+    for (unsigned int i = 0; i < DIM; i++)
+      r *= a_factor(i, x[i]);
+    return r;
+  }
+
+  template <unsigned int DIM>
+  const double
+  SeparableBVP<DIM>::q(const Point<DIM>& x) const
+  {
+    if (!has_q_) return 0.0;
+    double r = 1.0;
+    for (unsigned int i = 0; i < DIM; i++)
+      r *= q_factor(i, x[i]);
+    return r;
+  }
+
   template <unsigned int DIM>
   IdentityBVP<DIM>::IdentityBVP(const Function<DIM>* f)
     : EllipticBVP<DIM>(f, f, f)
   {
+    this->bulk_f_ = true;
   }
 
   template <unsigned int DIM>
@@ -108,6 +108,33 @@ namespace MathTL
     {
         return false;
     }
+
+    /*!
+      flag to indicate whether the coefficients are separable, i.e.,
+        a(x) = a_0(x_0)*...*a_{d-1}(x_{d-1}),  q(x) = q_0(x_0)*...*q_{d-1}(x_{d-1}),
+      so that the bilinear form on tensor product functions factorizes
+      into 1D integrals
+    */
+    virtual const bool separable_coefficients() const
+    {
+      return false;
+    }
+
+    /*!
+      i-th factor a_i of a separable diffusion coefficient
+    */
+    virtual const double a_factor(const unsigned int i, const double t) const
+    {
+      return 1.0;
+    }
+
+    /*!
+      i-th factor q_i of a separable reaction coefficient
+    */
+    virtual const double q_factor(const unsigned int i, const double t) const
+    {
+      return 1.0;
+    }
     
     /*!
       right-hand side f
@@ -117,6 +144,44 @@ namespace MathTL
       return f_->value(x);
     }
 
+    /*!
+      diffusion coefficient a at several points at once
+      (calls a() for each point, so that overridden versions of a() are respected)
+    */
+    virtual void a_values(const Array1D<Point<DIM> >& points, Array1D<double>& values) const
+    {
+      values.resize(points.size());
+      for (unsigned int i = 0; i < points.size(); i++)
+	values[i] = a(points[i]);
+    }
+
+    /*!
+      reaction coefficient q at several points at once
+      (calls q() for each point, so that overridden versions of q() are respected)
+    */
+    virtual void q_values(const Array1D<Point<DIM> >& points, Array1D<double>& values) const
+    {
+      values.resize(points.size());
+      for (unsigned int i = 0; i < points.size(); i++)
+	values[i] = q(points[i]);
+    }
+
+    /*!
+      right-hand side f at several points at once
+      (calls f() for each point, so that overridden versions of f() are respected;
+      derived classes which keep f() set bulk_f_ to use Function::values() instead)
+    */
+    virtual void f_values(const Array1D<Point<DIM> >& points, Array1D<double>& values) const
+    {
+      if (bulk_f_)
+	f_->values(points, values);
+      else {
+	values.resize(points.size());
+	for (unsigned int i = 0; i < points.size(); i++)
+	  values[i] = f(points[i]);
+      }
+    }
+
     /*!
       set the right-hand side to another function
     */
@@ -131,6 +196,9 @@ namespace MathTL
     
     //! right-hand side
     const Function<DIM>* f_;
+
+    //! flag whether f() is f_->value(), so that f_values() can use f_->values()
+    bool bulk_f_;
   };
 
   /*!
@@ -216,6 +284,73 @@ namespace MathTL
   
   
 
+  /*!
+    An elliptic boundary value problem with separable coefficients
+      a(x) = a_0(x_0)*...*a_{d-1}(x_{d-1}),  q(x) = q_0(x_0)*...*q_{d-1}(x_{d-1})
+    on a d-dimensional domain. If no factors of q are given, q vanishes.
+  */
+  template <unsigned int DIM>
+  class SeparableBVP
+    : public EllipticBVP<DIM>
+  {
+  public:
+    /*!
+      constructor with given factors of the diffusion coefficient and right-hand side
+    */
+    SeparableBVP(const FixedArray1D<const Function<1>*,DIM>& a_factors,
+		 const Function<DIM>* f);
+
+    /*!
+      constructor with given factors of the coefficients and right-hand side
+    */
+    SeparableBVP(const FixedArray1D<const Function<1>*,DIM>& a_factors,
+		 const FixedArray1D<const Function<1>*,DIM>& q_factors,
+		 const Function<DIM>* f);
+
+    /*!
+      diffusion coefficient a
+     */
+    const double a(const Point<DIM>& x) const;
+
+    /*!
+      reaction coefficient q
+    */
+    const double q(const Point<DIM>& x) const;
+
+    /*!
+      flag for separable coefficients
+    */
+    const bool separable_coefficients() const { return true; }
+
+    /*!
+      i-th factor of the diffusion coefficient
+    */
+    const double a_factor(const unsigned int i, const double t) const
+    {
+      return a_factors_[i]->value(Point<1>(t));
+    }
+
+    /*!
+      i-th factor of the reaction coefficient
+    */
+    const double q_factor(const unsigned int i, const double t) const
+    {
+      return has_q_ ? q_factors_[i]->value(Point<1>(t)) : 0.0;
+    }
+
+  protected:
+    //! factors of the diffusion coefficient
+    FixedArray1D<const Function<1>*,DIM> a_factors_;
+
+    //! factors of the reaction coefficient
+    FixedArray1D<const Function<1>*,DIM> q_factors_;
+
+    //! flag whether q is nontrivial
+    bool has_q_;
+  };
+
+
+
   /*!
     The Identity equation on a d-dimensional domain
       u(x) = f(x).
@@ -1,5 +1,6 @@
 #include <cassert>
 #include <cmath>
+#include <algorithm>
 #include <algebra/vector.h>
 #include <algebra/atra.h>
 #include <algebra/shifted_matrix.h>
@@ -349,6 +350,56 @@ namespace MathTL
     return sqrt(CondSymm(AtrA<MATRIX>(A), tol, maxit));
   }
 
+  // number of eigenvalues < x of the symmetric tridiagonal matrix (alpha,gamma), via the LDL^T
+  // decomposition of T-xI (Sturm sequence)
+  template <class ARRAY>
+  unsigned int TridiagonalEigenvaluesBelow(const ARRAY& alpha, const ARRAY& gamma,
+					   const unsigned int n, const double x)
+  {
+    unsigned int count = 0;
+    double q = 1.0;
+    for (unsigned int i = 0; i < n; i++) {
+      q = alpha[i] - x - (i > 0 ? gamma[i]*gamma[i]/q : 0.0);
+      if (q == 0.0) q = -1e-300; // perturb exact zeros
+      if (q < 0) count++;
+    }
+    return count;
+  }
+
+  template <class ARRAY>
+  void TridiagonalExtremalEigenvalues(const ARRAY& alpha, const ARRAY& gamma, const unsigned int n,
+				      double& lambdamin, double& lambdamax,
+				      const double tol)
+  {
+    assert(n > 0);
+    // Gershgorin bounds for the whole spectrum
+    double lower = alpha[0], upper = alpha[0];
+    for (unsigned int i = 0; i < n; i++) {
+      const double r = (i > 0 ? fabs(gamma[i]) : 0.0) + (i+1 < n ? fabs(gamma[i+1]) : 0.0);
+      lower = std::min(lower, alpha[i]-r);
+      upper = std::max(upper, alpha[i]+r);
+    }
+    const double eps = tol * std::max(fabs(lower), fabs(upper)) + 1e-300;
+
+    // smallest eigenvalue: smallest x with at least one eigenvalue below x
+    double a = lower, b = upper;
+    while (b-a > eps) {
+      const double x = 0.5*(a+b);
+      if (x <= a || x >= b) break;
+      if (TridiagonalEigenvaluesBelow(alpha, gamma, n, x) >= 1) b = x; else a = x;
+    }
+    lambdamin = 0.5*(a+b);
+
+    // largest eigenvalue: smallest x with all eigenvalues below x
+    a = lower, b = upper;
+    while (b-a > eps) {
+      const double x = 0.5*(a+b);
+      if (x <= a || x >= b) break;
+      if (TridiagonalEigenvaluesBelow(alpha, gamma, n, x) >= n) b = x; else a = x;
+    }
+    lambdamax = 0.5*(a+b);
+  }
+
   template <class MATRIX>
   void LanczosIteration(const MATRIX& A, const double tol,
 			double& lambdamin, double& lambdamax,
@@ -359,8 +410,15 @@ namespace MathTL
 
     Array1D<double> alpha(maxit), gamma(maxit+1);
 
-    Vector<double> dk(n); // start vector d^{(0)}
-    for (unsigned int i(0); i < dk.size(); i++) dk[i] = random_double();
+    // start vector d^{(0)}: pseudo-random entries from a fixed seed, so that
+    // the estimates are reproducible (and, unlike a constant vector, not
+    // orthogonal to eigenvectors of symmetric structured matrices)
+    Vector<double> dk(n);
+    unsigned long seed = 12345;
+    for (unsigned int i(0); i < dk.size(); i++) {
+      seed = (1103515245UL*seed + 12345UL) % 2147483648UL;
+      dk[i] = seed / 2147483648.0;
+    }
 //     cout << "d^{(0)}=" << dk << endl;
     gamma[0] = l2_norm(dk);
 //     cout << "gamma_{0}=" << gamma[0] << endl;
@@ -384,29 +442,17 @@ namespace MathTL
       gamma[k] = l2_norm(dk);
 //       cout << "gamma_{" << k << "}=" << gamma[k] << endl;
 
-      SymmetricMatrix<double> M(k);
-      for (unsigned int i = 0; i < k; i++) {
- 	M.set_entry(i, i, alpha[i]);
- 	if (i > 0)   M.set_entry(i, i-1, gamma[i]);
- 	if (i < k-1) M.set_entry(i, i+1, gamma[i+1]);
-      }
-
-//       cout << "Mk=" << endl;
-//       cout << M;
-
-      Matrix<double> evecs;
-      Vector<double> evals;
-      SymmEigenvalues(M, evals, evecs);
-
-//       cout << "eigenvalues of M_{" << k << "}: " << evals << endl;
+      // extremal eigenvalues of the tridiagonal matrix M_k = tridiag(gamma,alpha,gamma)
+      double mumin, mumax;
+      TridiagonalExtremalEigenvalues(alpha, gamma, k, mumin, mumax);
 
       if (k > 2)
-	change = std::max(fabs((lambdamin-evals[0])/lambdamin),
-			  fabs((lambdamax-evals[k-1])/lambdamax));
+	change = std::max(fabs((lambdamin-mumin)/lambdamin),
+			  fabs((lambdamax-mumax)/lambdamax));
       
       if (k >= 2) {
-	lambdamin = evals[0];
-	lambdamax = evals[k-1];
+	lambdamin = mumin;
+	lambdamax = mumax;
       }
     }
   }
@@ -64,12 +64,26 @@ namespace MathTL
   /*!
     Lanczos iteration, compute a finite subset (here the extremal points) of the spectrum of a symmetric matrix
     The iteration stops if the extremal eigenvalues have changed only below a given (relative) tolerance.
+    Both ends of the spectrum are estimated from the same Krylov space, A is only accessed via
+    A.apply(), and the extremal eigenvalues of the tridiagonal Lanczos matrix are computed by
+    bisection, see TridiagonalExtremalEigenvalues(). The start vector is generated from a fixed
+    seed, so that repeated runs for the same matrix give the same estimates.
    */
   template <class MATRIX>
   void LanczosIteration(const MATRIX& A, const double tol,
 			double& lambdamin, double& lambdamax,
 			const unsigned int maxit, unsigned int &iterations);
 
+  /*!
+    extremal eigenvalues of the symmetric tridiagonal n x n matrix with diagonal
+    alpha[0],...,alpha[n-1] and offdiagonal entries gamma[1],...,gamma[n-1],
+    computed by bisection with Sturm sequences within a relative tolerance tol
+  */
+  template <class ARRAY>
+  void TridiagonalExtremalEigenvalues(const ARRAY& alpha, const ARRAY& gamma, const unsigned int n,
+				      double& lambdamin, double& lambdamax,
+				      const double tol = 1e-12);
+
   //! solve symmetric eigenvalue problem
   /*!
     Solve the symmetric eigenvalue problem
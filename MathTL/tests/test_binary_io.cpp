@@ -0,0 +1,171 @@
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <vector>
+#include <algebra/vector.h>
+#include <algebra/infinite_vector.h>
+#include <geometry/grid.h>
+#include <geometry/sampled_mapping.h>
+#include <io/binary_io.h>
+
+#ifndef MATHTL_BINARY_IO_ZLIB
+#define MATHTL_BINARY_IO_ZLIB 0
+#endif
+
+using std::cout;
+using std::endl;
+
+using namespace MathTL;
+
+class TestFunction2 : public Function<2>
+{
+public:
+  TestFunction2() : Function<2>(1) {}
+  virtual ~TestFunction2(){}
+  double value(const Point<2>& p,
+	       const unsigned int component = 0) const
+  {
+    return sin(p[0])*p[1];
+  }
+
+  void vector_value(const Point<2> &p,
+		    Vector<double>& values) const
+  {
+    values.resize(1, false);
+    values[0] = value(p);
+  }
+};
+
+int main()
+{
+  cout << "Testing binary output of sampled mappings and coefficient vectors..." << endl;
+
+  Vector<double> v(1000);
+  for (unsigned int i = 0; i < v.size(); i++)
+    v[i] = cos((double)i);
+
+  InfiniteVector<double,int> w;
+  for (int k = -500; k < 100000; k += 37)
+    w.set_coefficient(k, 1.0/(k+1000));
+
+  TestFunction2 f;
+  SampledMapping<2> s2(Grid<2>(Point<2>(0,0), Point<2>(1,2), 60, 40), f);
+  Array1D<double> points(101), values(101);
+  for (unsigned int i = 0; i < points.size(); i++) {
+    points[i] = i/100.;
+    values[i] = exp(points[i]);
+  }
+  SampledMapping<1> s1(Grid<1>(points), values);
+
+  // small chunks, so that compressed fields consist of several chunks
+  const bool compress = MATHTL_BINARY_IO_ZLIB==1;
+  for (int single_precision = 0; single_precision <= 1; single_precision++) {
+    cout << "* " << (single_precision ? "single" : "double") << " precision:" << endl;
+    {
+      BinaryOutput out("test_binary_io.dat", false, single_precision, compress, 100);
+      out.write(v, 1);
+      out.write(w, 2);
+    }
+    {
+      // append to the same file
+      BinaryOutput out("test_binary_io.dat", true, single_precision, compress, 100);
+      out.write(s1, 3);
+      out.write(s2, 4);
+      cout << "  writing " << (out.good() ? "succeeded" : "failed") << endl;
+    }
+
+    BinaryInput in("test_binary_io.dat");
+    cout << "  " << in.records() << " records, tags";
+    for (unsigned int r = 0; r < in.records(); r++)
+      cout << " " << in.tag(r);
+    cout << endl;
+
+    Vector<double> vread;
+    in.read(0, vread);
+    double err = 0;
+    for (unsigned int i = 0; i < v.size(); i++)
+      err = std::max(err, fabs(v[i]-vread[i]));
+    cout << "  error for the dense vector: " << err << endl;
+    if (!single_precision && !compress)
+      cout << "  direct access to the mapped values "
+	   << (in.values(0) != 0 && in.values(0)[17] == v[17] ? "works" : "fails") << endl;
+
+    InfiniteVector<double,int> wread;
+    in.read(1, wread);
+    cout << "  error for the sparse vector: " << linfty_norm(w-wread)
+	 << " (" << wread.size() << " of " << w.size() << " entries)" << endl;
+
+    SampledMapping<1> s1read;
+    in.read(2, s1read);
+    err = 0;
+    for (unsigned int i = 0; i < points.size(); i++)
+      err = std::max(err, fabs(s1read.points()[i]-points[i]) + fabs(s1read.values()[i]-values[i]));
+    cout << "  error for the 1D sampled mapping: " << err << endl;
+
+    SampledMapping<2> s2read;
+    in.read(3, s2read);
+    err = 0;
+    for (unsigned int i = 0; i < s2.values().row_dimension(); i++)
+      for (unsigned int j = 0; j < s2.values().column_dimension(); j++)
+	err = std::max(err, fabs(s2read.gridx()(i,j)-s2.gridx()(i,j))
+		       + fabs(s2read.gridy()(i,j)-s2.gridy()(i,j))
+		       + fabs(s2read.values()(i,j)-s2.values()(i,j)));
+    cout << "  error for the 2D sampled mapping: " << err << endl;
+  }
+
+  cout << "* truncated and corrupt files:" << endl;
+  {
+    BinaryOutput out("test_binary_io.dat");
+    out.write(v, 1);
+    out.write(w, 2);
+    out.write(s1, 3);
+  }
+  std::vector<char> bytes;
+  {
+    std::ifstream is("test_binary_io.dat", std::ios::in|std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+  }
+  {
+    // an interrupted writer: the last record is incomplete
+    std::ofstream os("test_binary_io_truncated.dat", std::ios::out|std::ios::binary);
+    os.write(&bytes[0], bytes.size()-500);
+  }
+  {
+    BinaryInput in("test_binary_io_truncated.dat");
+    InfiniteVector<double,int> wread;
+    const bool ok = in.good() && in.truncated() && in.records() == 2 && in.read(1, wread);
+    cout << "  truncated file: " << in.records() << " complete records, "
+	 << (ok && linfty_norm(w-wread) == 0 ? "readable" : "not readable") << endl;
+  }
+  {
+    // field headers with too small numbers of entries (at the offsets for double precision)
+    const size_t vcount = 16+sizeof(BinaryRecordHeader)+8;
+    const size_t wcount = vcount+16+sizeof(BinaryChunkHeader)+v.size()*sizeof(double)+sizeof(BinaryRecordHeader)+8;
+    const uint64_t count = 10;
+    memcpy(&bytes[vcount], &count, sizeof(uint64_t));
+    memcpy(&bytes[wcount], &count, sizeof(uint64_t));
+    std::ofstream os("test_binary_io_corrupt.dat", std::ios::out|std::ios::binary);
+    os.write(&bytes[0], bytes.size());
+  }
+  {
+    BinaryInput in("test_binary_io_corrupt.dat");
+    Vector<double> vread;
+    InfiniteVector<double,int> wread;
+    SampledMapping<1> s1read;
+    const bool vok = in.read(0, vread), wok = in.read(1, wread), sok = in.read(2, s1read);
+    cout << "  corrupt file: dense vector " << (vok ? "read" : "rejected")
+	 << ", sparse vector " << (wok ? "read" : "rejected")
+	 << ", intact sampled mapping " << (sok ? "read" : "rejected") << endl;
+  }
+  remove("test_binary_io_truncated.dat");
+  remove("test_binary_io_corrupt.dat");
+
+  cout << "* conversion to Matlab format (test_binary_io.m)" << endl;
+  std::ofstream os("test_binary_io.m");
+  binary_to_matlab("test_binary_io.dat", os);
+  os.close();
+
+  return 0;
+}
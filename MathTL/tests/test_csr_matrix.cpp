@@ -0,0 +1,101 @@
+#include <cstdlib>
+#include <iostream>
+#include <algebra/vector.h>
+#include <algebra/matrix.h>
+#include <algebra/sparse_matrix.h>
+#include <algebra/csr_matrix.h>
+#include <numerics/iteratsolv.h>
+
+using std::cout;
+using std::endl;
+using namespace MathTL;
+
+int main()
+{
+  cout << "Testing the class CSRMatrix ..." << endl;
+
+  cout << "- an empty 2x3 matrix:" << endl;
+  CSRMatrix<double> E(2, 3);
+  cout << E;
+
+  cout << "- conversion of a 3x2 sparse matrix:" << endl;
+  SparseMatrix<double> S(3, 2);
+  S.set_entry(0, 0, -3);
+  S.set_entry(0, 1, 2);
+  S.set_entry(1, 0, 1);
+  S.set_entry(2, 1, 3);
+  CSRMatrix<double> M(S);
+  cout << M;
+  cout << "  (" << M.size() << " nonzero entries, M(2,1)=" << M.get_entry(2, 1)
+       << ", M(1,1)=" << M.get_entry(1, 1) << ")" << endl;
+
+  cout << "- the transposed matrix:" << endl;
+  CSRMatrix<double> Mt;
+  M.transpose(Mt);
+  cout << Mt;
+
+  Vector<double> x(2, "1 -1"), Mx(3), Mtx(2);
+  M.apply(x, Mx);
+  cout << "- M*x with x=" << x << ": " << Mx << endl;
+  M.apply_transposed(Mx, Mtx);
+  cout << "- M^T*(M*x): " << Mtx << endl;
+
+  cout << "- a large random sparse matrix, comparison with SparseMatrix:" << endl;
+  const unsigned int n(2000);
+  SparseMatrix<double> A(n, n);
+  for (unsigned int i(0); i < n; i++) {
+    A.set_entry(i, i, 10.0);
+    for (unsigned int k(0); k < 8; k++) {
+      const unsigned int j(rand() % n);
+      if (j != i) {
+	const double value((double)rand()/RAND_MAX);
+	A.set_entry(i, j, value);
+      }
+    }
+  }
+  CSRMatrix<double> B(A);
+  Vector<double> y(n), Ay(n), By(n), Aty(n), Bty(n);
+  for (unsigned int i(0); i < n; i++)
+    y[i] = (double)rand()/RAND_MAX - 0.5;
+  A.apply(y, Ay);
+  B.apply(y, By);
+  A.apply_transposed(y, Aty);
+  B.apply_transposed(y, Bty);
+  cout << "  nonzero entries: " << A.size() << " (SparseMatrix), " << B.size() << " (CSRMatrix)" << endl;
+  cout << "  ||A*y-B*y||_infty=" << linfty_norm(Ay-By)
+       << ", ||A^T*y-B^T*y||_infty=" << linfty_norm(Aty-Bty) << endl;
+
+  SparseMatrix<double> C;
+  B.get_sparse_matrix(C);
+  cout << "  conversion back to SparseMatrix, ||A-C||_1=" << row_sum_norm(A-C) << endl;
+
+  cout << "- multiplication with a dense matrix (3 columns):" << endl;
+  Matrix<double> X(n, 3), BX(n, 3);
+  for (unsigned int l(0); l < 3; l++)
+    for (unsigned int i(0); i < n; i++)
+      X(i, l) = y[(i+l*17) % n];
+  B.apply(X, BX);
+  double maxerr(0);
+  for (unsigned int l(0); l < 3; l++) {
+    Vector<double> xl(n), Bxl(n);
+    for (unsigned int i(0); i < n; i++)
+      xl[i] = X(i, l);
+    B.apply(xl, Bxl);
+    for (unsigned int i(0); i < n; i++)
+      maxerr = std::max(maxerr, fabs(Bxl[i]-BX(i, l)));
+  }
+  cout << "  maximal deviation from the columnwise products: " << maxerr << endl;
+
+  cout << "- CG for the symmetric matrix B+B^T:" << endl;
+  SparseMatrix<double> Asym(A);
+  Asym.add(1.0, transpose(A));
+  CSRMatrix<double> Bsym(Asym);
+  Vector<double> xk(n), xl(n);
+  unsigned int iterations_sparse(0), iterations_csr(0);
+  CG(Asym, y, xk, 1e-12, 250, iterations_sparse);
+  CG(Bsym, y, xl, 1e-12, 250, iterations_csr);
+  cout << "  " << iterations_sparse << " (SparseMatrix) vs. " << iterations_csr
+       << " (CSRMatrix) iterations, ||x_sparse-x_csr||_infty=" << linfty_norm(xk-xl) << endl;
+
+  return 0;
+}
@@ -94,5 +94,16 @@ int main()
   cout << "  lambdamin=" << lambdamin << ", lambdamax=" << lambdamax
        << ", " << iterations << " iterations needed" << endl;
 
+  cout << "- extremal eigenvalues of the tridiagonal matrix A by bisection:" << endl;
+  Array1D<double> alpha(banddim), gamma(banddim);
+  for (unsigned int i(0); i < banddim; i++) {
+    alpha[i] = 2;
+    gamma[i] = -1; // gamma[0] is not used
+  }
+  TridiagonalExtremalEigenvalues(alpha, gamma, banddim, lambdamin, lambdamax);
+  cout << "  lambdamin=" << lambdamin << ", lambdamax=" << lambdamax
+       << ", errors " << fabs(lambdamin-(2-2*cos(M_PI/(banddim+1))))
+       << ", " << fabs(lambdamax-(2-2*cos(banddim*M_PI/(banddim+1)))) << endl;
+
   return 0;
 }
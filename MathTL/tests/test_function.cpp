@@ -31,4 +31,12 @@ int main()
   ProductFunction<2> pf0(&cf0, &cf0);
   cout << "- a product of two constants, evaluated at some point: "
        << pf0.value(Point<2>(1,2)) << endl;
+
+  Array1D<Point<2> > points(3);
+  points[0] = Point<2>(0,0);
+  points[1] = Point<2>(1,2);
+  points[2] = Point<2>(-1,0.5);
+  Array1D<double> values;
+  pf0.values(points, values);
+  cout << "- the same product, evaluated at three points at once: " << values << endl;
 }
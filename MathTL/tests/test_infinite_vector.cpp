@@ -113,7 +113,24 @@ int main()
   cout << "- COARSE(" << eps << ",w) yields w with ";
   v.COARSE(eps,w);
   cout << w.size() << " entries and ||v-w||_2=" << l2_norm(v-w) << endl;
-  
+
+  cout << "- comparing COARSE with binary binning and with exact sorting:" << endl;
+  for (eps = 0.01; eps <= 20.0; eps *= 4.0) {
+    InfiniteVector<float> wsort;
+    v.COARSE(eps, w, coarse_binning);
+    v.COARSE(eps, wsort, coarse_sort);
+    cout << "  eps=" << eps << ": " << w.size() << " (binning) vs. " << wsort.size()
+	 << " (sorting) entries, ||w_binning-w_sorting||_2=" << l2_norm(w-wsort) << endl;
+  }
+
+  cout << "- COARSE with a tolerance much smaller than ||u||_2:" << endl;
+  InfiniteVector<double> u, uc;
+  for (unsigned int i=0; i < 1000; i++)
+    u[i] = pow((double)rand()/(double)RAND_MAX, 8) * (i % 2 == 0 ? 1e3 : 1e-9);
+  u.COARSE(1e-9, uc);
+  cout << "  ||u||_2=" << l2_norm(u) << ", COARSE(1e-9) yields " << uc.size()
+       << " entries, ||u-uc||_2 <= 1e-9? " << (l2_norm(u-uc) <= 1e-9 ? "yes" : "no") << endl;
+
   cout << "- some weak \\ell_\\tau norms of v:" << endl;
   for (double tau(1.8); tau >= 0.2; tau -= 0.2)
     {
@@ -175,6 +192,32 @@ int main()
   SquaresPlusOne S1;
   w.scale(&S1, -1);
   cout << "w weighted with an instance of SquaresPlusOne, exponent -1: " << endl << w;
+
+  cout << "- testing the flat storage policy SortedArrayMap:" << endl;
+  typedef InfiniteVector<double,int,SortedArrayMap<int,double> > FlatVector;
+  FlatVector fv, fw;
+  for (unsigned int i=0; i < 1000; i++)
+    fv.set_coefficient((i*367)%1000, v.get_coefficient(i)+i); // random-order, buffered
+  fv.add_coefficient(3, -fv.get_coefficient(3)); // removes the entry
+  fv.add_coefficient(1000, 1.0);
+  fv.add_coefficient(1000, 1.0);
+  cout << "  size: " << fv.size() << ", fv[1000]=" << fv[1000]
+       << ", fv[3]=" << fv[3] << ", ||fv||_2=" << l2_norm(fv) << endl;
+  InfiniteVector<double,int> mv;
+  for (FlatVector::const_iterator it(fv.begin()), itend(fv.end()); it != itend; ++it)
+    mv.set_coefficient(it.index(), *it);
+  FlatVector fmv(mv);
+  cout << "  conversion from std::map storage preserves the entries? "
+       << (fmv == fv ? "yes" : "no") << endl;
+  fw = fv;
+  fw.sadd(-2.0, fv);
+  fw.add(1.0, fv);
+  cout << "  ||(-2*fv+fv)+fv||_2=" << l2_norm(fw) << " (should be 0)" << endl;
+  fv.COARSE(100.0, fw);
+  InfiniteVector<double,int> mw;
+  mv.COARSE(100.0, mw);
+  cout << "  COARSE(100) yields " << fw.size() << " entries (map storage: "
+       << mw.size() << ")" << endl;
   
   return 0;
 }
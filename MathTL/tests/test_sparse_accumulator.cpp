@@ -0,0 +1,58 @@
+#include <iostream>
+#include <algebra/vector.h>
+#include <algebra/sparse_accumulator.h>
+
+using std::cout;
+using std::endl;
+using namespace MathTL;
+
+int main()
+{
+  cout << "Testing the sparse accumulator class ..." << endl;
+
+  SparseAccumulator<double> v(1000000);
+  cout << "- an empty accumulator of logical dimension " << v.size()
+       << " with " << v.n_touched() << " touched entries" << endl;
+
+  cout << "- writing access on v:" << endl;
+  v[999999] += 1;
+  v[42] += 2;
+  v[7] = 3;
+  v[42] += 4;
+  cout << v;
+
+  cout << "- read access v(42)=" << v(42) << ", v(43)=" << v(43) << endl;
+
+  cout << "- after sorting:" << endl;
+  v.sort();
+  cout << v;
+  cout << "- v(42) after sorting: " << v(42) << endl;
+
+  cout << "- accumulating the same random updates into a Vector<double> and a SparseAccumulator<double>:" << endl;
+  const unsigned int n = 100000;
+  Vector<double> dense(n);
+  SparseAccumulator<double> sparse(n);
+  unsigned int seed = 1;
+  for (unsigned int k = 0; k < 20000; k++) {
+    seed = seed * 1103515245u + 12345u;
+    const unsigned int i = (seed / 65536) % n;
+    const double value = (double)(seed % 1000) / 1000.;
+    dense[i] += value;
+    sparse[i] += value;
+  }
+  bool equal = true;
+  unsigned int nonzeros = 0;
+  for (unsigned int i = 0; i < n; i++) {
+    if (dense[i] != sparse(i)) equal = false;
+    if (dense[i] != 0.) nonzeros++;
+  }
+  cout << "  touched entries: " << sparse.n_touched()
+       << ", nonzero entries of the dense vector: " << nonzeros << endl;
+  cout << "  are the two vectors equal? " << (equal ? "yes" : "no") << endl;
+
+  cout << "- clearing the accumulator:" << endl;
+  sparse.clear();
+  cout << "  touched entries: " << sparse.n_touched() << ", sparse(42)=" << sparse(42) << endl;
+
+  return 0;
+}
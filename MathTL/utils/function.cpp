@@ -19,6 +19,17 @@ namespace MathTL
   {
   } 
   
+  template <unsigned int DIM, class VALUE>
+  void
+  Function<DIM, VALUE>::values(const Array1D<Point<DIM,VALUE> >& points,
+			       Array1D<VALUE>& results,
+			       const unsigned int component) const
+  {
+    results.resize(points.size());
+    for (unsigned int i = 0; i < points.size(); i++)
+      results[i] = value(points[i], component);
+  }
+
   template <unsigned int DIM, class VALUE>
   inline
   const typename Function<DIM, VALUE>::size_type
@@ -11,6 +11,7 @@
 #define _MATHTL_FUNCTION_H
 
 #include <algebra/vector.h>
+#include <utils/array1d.h>
 #include <utils/function_time.h>
 #include <geometry/point.h>
 
@@ -71,6 +72,17 @@ namespace MathTL
     virtual void vector_value(const Point<DIM,VALUE> &p,
 			      Vector<VALUE>& values) const = 0;
 
+    /*!
+      evaluate (a component of) the function at several points at once,
+        results[i] = value(points[i], component)
+      (results will be resized appropriately);
+      the default implementation calls value() for each point,
+      derived classes may override this with a faster bulk evaluation
+    */
+    virtual void values(const Array1D<Point<DIM,VALUE> >& points,
+			Array1D<VALUE>& results,
+			const unsigned int component = 0) const;
+
     /*!
       (estimate of) memory consumption in bytes
     */
@@ -0,0 +1,105 @@
+// implementation for packed_key.h
+
+#include <cassert>
+
+namespace MathTL
+{
+  template <unsigned int WORDS>
+  inline
+  PackedKey<WORDS>::PackedKey()
+  {
+    for (unsigned int i(0); i < WORDS; i++)
+      words_[i] = 0;
+  }
+
+  template <unsigned int WORDS>
+  inline
+  void
+  PackedKey<WORDS>::put(unsigned int& pos, const unsigned long long value, const unsigned int width)
+  {
+    assert(width <= 64 && pos + width <= bits);
+    assert(width == 64 || value < (1ULL << width));
+
+    // a field may straddle two words
+    unsigned int done(0);
+    while (done < width) {
+      const unsigned int word(pos / 64), offset(pos % 64);
+      const unsigned int n(width-done < 64-offset ? width-done : 64-offset);
+      const unsigned long long chunk((value >> (width-done-n)) & (n == 64 ? ~0ULL : (1ULL << n)-1));
+      words_[word] |= chunk << (64-offset-n);
+      pos += n;
+      done += n;
+    }
+  }
+
+  template <unsigned int WORDS>
+  inline
+  void
+  PackedKey<WORDS>::put_signed(unsigned int& pos, const long long value, const unsigned int width)
+  {
+    assert(width < 64);
+    assert(value >= -(1LL << (width-1)) && value < (1LL << (width-1)));
+    put(pos, (unsigned long long)(value + (1LL << (width-1))), width);
+  }
+
+  template <unsigned int WORDS>
+  inline
+  unsigned long long
+  PackedKey<WORDS>::get(unsigned int& pos, const unsigned int width) const
+  {
+    assert(width <= 64 && pos + width <= bits);
+
+    unsigned long long value(0);
+    unsigned int done(0);
+    while (done < width) {
+      const unsigned int word(pos / 64), offset(pos % 64);
+      const unsigned int n(width-done < 64-offset ? width-done : 64-offset);
+      const unsigned long long chunk((words_[word] >> (64-offset-n)) & (n == 64 ? ~0ULL : (1ULL << n)-1));
+      value = (n == 64 ? 0 : value << n) | chunk;
+      pos += n;
+      done += n;
+    }
+    return value;
+  }
+
+  template <unsigned int WORDS>
+  inline
+  long long
+  PackedKey<WORDS>::get_signed(unsigned int& pos, const unsigned int width) const
+  {
+    return (long long)get(pos, width) - (1LL << (width-1));
+  }
+
+  template <unsigned int WORDS>
+  inline
+  bool
+  PackedKey<WORDS>::operator == (const PackedKey& key) const
+  {
+    for (unsigned int i(0); i < WORDS; i++)
+      if (words_[i] != key.words_[i])
+	return false;
+    return true;
+  }
+
+  template <unsigned int WORDS>
+  inline
+  bool
+  PackedKey<WORDS>::operator < (const PackedKey& key) const
+  {
+    for (unsigned int i(0); i < WORDS; i++)
+      if (words_[i] != key.words_[i])
+	return words_[i] < key.words_[i];
+    return false;
+  }
+
+  template <unsigned int WORDS>
+  std::ostream& operator << (std::ostream& os, const PackedKey<WORDS>& key)
+  {
+    const std::ios_base::fmtflags flags(os.flags());
+    os << std::hex;
+    for (unsigned int i(0); i < WORDS; i++)
+      os << (i > 0 ? ":" : "") << key.word(i);
+    os.flags(flags);
+    return os;
+  }
+}
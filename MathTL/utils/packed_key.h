@@ -0,0 +1,99 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of MathTL - the Mathematical Template Library    |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _MATHTL_PACKED_KEY_H
+#define _MATHTL_PACKED_KEY_H
+
+#include <iostream>
+
+namespace MathTL
+{
+  /*!
+    A fixed-size bit string of WORDS 64-bit words, e.g., as a compact key
+    for the wavelet index classes with their (p,)j,e,k multiindices.
+
+    The fields are written from the most significant bit of the first word on,
+    so that comparing two keys word by word is the lexicographic comparison
+    of their field tuples. Signed fields are stored with a bias, which preserves
+    their order, too.
+
+    In contrast to an index object (with three or four MultiIndex members,
+    each of them with its own heap allocation, and a basis pointer), a key
+    occupies 8*WORDS bytes and is compared by at most WORDS integer comparisons.
+  */
+  template <unsigned int WORDS>
+  class PackedKey
+  {
+  public:
+    /*!
+      number of bits
+    */
+    static const unsigned int bits = 64*WORDS;
+
+    /*!
+      default constructor, all bits are zero
+    */
+    PackedKey();
+
+    /*!
+      store a nonnegative field value < 2^width at the bit position pos,
+      pos is advanced by width
+    */
+    void put(unsigned int& pos, const unsigned long long value, const unsigned int width);
+
+    /*!
+      store a signed field value with -2^(width-1) <= value < 2^(width-1)
+    */
+    void put_signed(unsigned int& pos, const long long value, const unsigned int width);
+
+    /*!
+      read the nonnegative field of the given width at the bit position pos,
+      pos is advanced by width
+    */
+    unsigned long long get(unsigned int& pos, const unsigned int width) const;
+
+    /*!
+      read a signed field (see put_signed())
+    */
+    long long get_signed(unsigned int& pos, const unsigned int width) const;
+
+    /*!
+      i-th word
+    */
+    unsigned long long word(const unsigned int i) const { return words_[i]; }
+
+    //! check equality
+    bool operator == (const PackedKey& key) const;
+
+    //! check non-equality
+    bool operator != (const PackedKey& key) const
+    { return !(*this == key); }
+
+    //! lexicographic order of the fields
+    bool operator < (const PackedKey& key) const;
+
+    //! lexicographic order <=
+    bool operator <= (const PackedKey& key) const
+    { return !(key < *this); }
+
+  protected:
+    //! the bits, most significant bit first
+    unsigned long long words_[WORDS];
+  };
+
+  /*!
+    stream output of the words (hexadecimal)
+  */
+  template <unsigned int WORDS>
+  std::ostream& operator << (std::ostream& os, const PackedKey<WORDS>& key);
+}
+
+#include "utils/packed_key.cpp"
+
+#endif
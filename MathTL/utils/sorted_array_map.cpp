@@ -0,0 +1,266 @@
+// implementation for sorted_array_map.h
+
+#include <algorithm>
+
+namespace MathTL
+{
+  template <class K, class T>
+  inline
+  SortedArrayMap<K,T>::SortedArrayMap()
+    : entries_(), pending_()
+  {
+  }
+
+  template <class K, class T>
+  inline
+  SortedArrayMap<K,T>::SortedArrayMap(const SortedArrayMap<K,T>& m)
+    : entries_(), pending_()
+  {
+    m.consolidate();
+    entries_ = m.entries_;
+  }
+
+  template <class K, class T>
+  SortedArrayMap<K,T>&
+  SortedArrayMap<K,T>::operator = (const SortedArrayMap<K,T>& m)
+  {
+    if (this != &m) {
+      m.consolidate();
+      entries_ = m.entries_;
+      pending_.clear();
+    }
+    return *this;
+  }
+
+  template <class K, class T>
+  inline
+  typename SortedArrayMap<K,T>::iterator
+  SortedArrayMap<K,T>::begin()
+  {
+    consolidate();
+    return entries_.begin();
+  }
+
+  template <class K, class T>
+  inline
+  typename SortedArrayMap<K,T>::const_iterator
+  SortedArrayMap<K,T>::begin() const
+  {
+    consolidate();
+    return entries_.begin();
+  }
+
+  template <class K, class T>
+  inline
+  typename SortedArrayMap<K,T>::iterator
+  SortedArrayMap<K,T>::end()
+  {
+    consolidate();
+    return entries_.end();
+  }
+
+  template <class K, class T>
+  inline
+  typename SortedArrayMap<K,T>::const_iterator
+  SortedArrayMap<K,T>::end() const
+  {
+    consolidate();
+    return entries_.end();
+  }
+
+  template <class K, class T>
+  inline
+  bool
+  SortedArrayMap<K,T>::empty() const
+  {
+    consolidate();
+    return entries_.empty();
+  }
+
+  template <class K, class T>
+  inline
+  typename SortedArrayMap<K,T>::size_type
+  SortedArrayMap<K,T>::size() const
+  {
+    consolidate();
+    return entries_.size();
+  }
+
+  template <class K, class T>
+  inline
+  void
+  SortedArrayMap<K,T>::reserve(const size_type n)
+  {
+    entries_.reserve(n);
+  }
+
+  template <class K, class T>
+  inline
+  void
+  SortedArrayMap<K,T>::clear()
+  {
+    entries_.clear();
+    pending_.clear();
+  }
+
+  template <class K, class T>
+  inline
+  void
+  SortedArrayMap<K,T>::swap(SortedArrayMap<K,T>& m)
+  {
+    entries_.swap(m.entries_);
+    pending_.swap(m.pending_);
+  }
+
+  template <class K, class T>
+  inline
+  typename SortedArrayMap<K,T>::key_compare
+  SortedArrayMap<K,T>::key_comp() const
+  {
+    return key_compare();
+  }
+
+  template <class K, class T>
+  inline
+  typename SortedArrayMap<K,T>::iterator
+  SortedArrayMap<K,T>::lower_bound(const K& k)
+  {
+    consolidate();
+    return std::lower_bound(entries_.begin(), entries_.end(), k, key_order());
+  }
+
+  template <class K, class T>
+  inline
+  typename SortedArrayMap<K,T>::const_iterator
+  SortedArrayMap<K,T>::lower_bound(const K& k) const
+  {
+    consolidate();
+    return std::lower_bound(entries_.begin(), entries_.end(), k, key_order());
+  }
+
+  template <class K, class T>
+  typename SortedArrayMap<K,T>::iterator
+  SortedArrayMap<K,T>::insert(iterator hint, const value_type& x)
+  {
+    if (!pending_.empty()) {
+      // the hint may refer to the unconsolidated array, so we ignore it
+      return insert(x).first;
+    }
+
+    // fast path: appending behind the last entry
+    if (entries_.empty() || entries_.back().first < x.first) {
+      entries_.push_back(x);
+      return entries_.end()-1;
+    }
+
+    // use the hint if x fits directly in front of it
+    if ((hint == entries_.end() || x.first < hint->first)
+	&& (hint == entries_.begin() || (hint-1)->first < x.first))
+      return entries_.insert(hint, x);
+
+    return insert(x).first;
+  }
+
+  template <class K, class T>
+  std::pair<typename SortedArrayMap<K,T>::iterator, bool>
+  SortedArrayMap<K,T>::insert(const value_type& x)
+  {
+    iterator it(lower_bound(x.first));
+    if (it != entries_.end() && !(x.first < it->first))
+      return std::pair<iterator,bool>(it, false);
+    return std::pair<iterator,bool>(entries_.insert(it, x), true);
+  }
+
+  template <class K, class T>
+  inline
+  void
+  SortedArrayMap<K,T>::erase(iterator position)
+  {
+    entries_.erase(position);
+  }
+
+  template <class K, class T>
+  typename SortedArrayMap<K,T>::size_type
+  SortedArrayMap<K,T>::erase(const K& k)
+  {
+    iterator it(lower_bound(k));
+    if (it != entries_.end() && !(k < it->first)) {
+      entries_.erase(it);
+      return 1;
+    }
+    return 0;
+  }
+
+  template <class K, class T>
+  inline
+  void
+  SortedArrayMap<K,T>::buffer_set(const K& k, const T& value)
+  {
+    PendingEntry e;
+    e.key = k;
+    e.value = value;
+    e.accumulate = false;
+    pending_.push_back(e);
+  }
+
+  template <class K, class T>
+  inline
+  void
+  SortedArrayMap<K,T>::buffer_add(const K& k, const T& increment)
+  {
+    PendingEntry e;
+    e.key = k;
+    e.value = increment;
+    e.accumulate = true;
+    pending_.push_back(e);
+  }
+
+  template <class K, class T>
+  void
+  SortedArrayMap<K,T>::consolidate() const
+  {
+    if (pending_.empty()) return;
+
+    // the stable sort preserves the order of several write operations on the same key
+    std::stable_sort(pending_.begin(), pending_.end(), pending_order());
+
+    // merge the sorted buffer with the sorted array, cf. set_union() from stl_algo.h
+    std::vector<value_type> merged;
+    merged.reserve(entries_.size() + pending_.size());
+
+    typename std::vector<value_type>::const_iterator it(entries_.begin()), itend(entries_.end());
+    typename std::vector<PendingEntry>::const_iterator pit(pending_.begin()), pitend(pending_.end());
+    while (pit != pitend)
+      {
+	const K key(pit->key);
+	while (it != itend && it->first < key)
+	  merged.push_back(*it++);
+
+	bool present(false);
+	T value(0);
+	if (it != itend && !(key < it->first)) {
+	  present = true;
+	  value = it->second;
+	  ++it;
+	}
+
+	// replay all write operations on this key in their original order
+	for (; pit != pitend && !(key < pit->key); ++pit) {
+	  if (pit->accumulate && present) {
+	    value += pit->value;
+	    present = (value != T(0));
+	  } else {
+	    value = pit->value;
+	    present = true;
+	  }
+	}
+
+	if (present)
+	  merged.push_back(value_type(key, value));
+      }
+    merged.insert(merged.end(), it, itend);
+
+    entries_.swap(merged);
+    pending_.clear();
+  }
+}
@@ -0,0 +1,241 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of MathTL - the Mathematical Template Library    |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _MATHTL_SORTED_ARRAY_MAP_H
+#define _MATHTL_SORTED_ARRAY_MAP_H
+
+#include <vector>
+#include <utility>
+#include <functional>
+
+namespace MathTL
+{
+  /*!
+    A flat replacement for std::map<K,T>, storing the (key,value) pairs
+    in one contiguous array which is kept sorted w.r.t. operator < on K.
+
+    SortedArrayMap implements the subset of the std::map interface which
+    is used by InfiniteVector<C,I,S>, so that it can be plugged in as
+    the storage policy S, e.g.,
+
+      InfiniteVector<double, Index, SortedArrayMap<Index,double> > v;
+
+    Compared to std::map, there is no heap node per entry and a linear
+    scan through the entries is a sequential memory access. Insertions
+    behind the last entry (as they occur in all O(N) merge algorithms
+    like InfiniteVector::add()) have amortized constant cost, whereas
+    insertions in the middle of the array cost O(N).
+
+    To support random-order assembly, writing access can also be buffered:
+    buffer_set() and buffer_add() only append to an unsorted buffer, which
+    is merged into the array in O(N + P*log(P)) by consolidate(). All other
+    methods consolidate first, so the buffer is invisible to the user.
+    Note that this happens also in the const methods, so a buffered map
+    should be consolidated before it is read concurrently by several threads.
+  */
+  template <class K, class T>
+  class SortedArrayMap
+  {
+  public:
+    /*!
+      key type (cf. STL containers)
+    */
+    typedef K key_type;
+
+    /*!
+      mapped type (cf. STL containers)
+    */
+    typedef T mapped_type;
+
+    /*!
+      value type (cf. STL containers)
+    */
+    typedef std::pair<K,T> value_type;
+
+    /*!
+      key comparison (cf. STL containers)
+    */
+    typedef std::less<K> key_compare;
+
+    /*!
+      iterator type (cf. STL containers)
+    */
+    typedef typename std::vector<value_type>::iterator iterator;
+
+    /*!
+      const iterator type (cf. STL containers)
+    */
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+    /*!
+      size type (cf. STL containers)
+    */
+    typedef typename std::vector<value_type>::size_type size_type;
+
+    /*!
+      default constructor, yields an empty map
+    */
+    SortedArrayMap();
+
+    /*!
+      copy constructor
+    */
+    SortedArrayMap(const SortedArrayMap<K,T>& m);
+
+    /*!
+      assignment
+    */
+    SortedArrayMap<K,T>& operator = (const SortedArrayMap<K,T>& m);
+
+    /*!
+      iterator pointing to the first entry
+    */
+    iterator begin();
+
+    /*!
+      const iterator pointing to the first entry
+    */
+    const_iterator begin() const;
+
+    /*!
+      iterator pointing to one after the last entry
+    */
+    iterator end();
+
+    /*!
+      const iterator pointing to one after the last entry
+    */
+    const_iterator end() const;
+
+    /*!
+      test emptyness
+    */
+    bool empty() const;
+
+    /*!
+      number of entries
+    */
+    size_type size() const;
+
+    /*!
+      reserve memory for n entries
+    */
+    void reserve(const size_type n);
+
+    /*!
+      remove all entries
+    */
+    void clear();
+
+    /*!
+      swap contents with another map
+    */
+    void swap(SortedArrayMap<K,T>& m);
+
+    /*!
+      key comparison object (cf. STL containers)
+    */
+    key_compare key_comp() const;
+
+    /*!
+      first entry whose key is not less than k
+    */
+    iterator lower_bound(const K& k);
+
+    /*!
+      first entry whose key is not less than k
+    */
+    const_iterator lower_bound(const K& k) const;
+
+    /*!
+      insert an entry (if its key is not yet present), using a position hint;
+      inserting behind the last entry takes amortized constant time
+    */
+    iterator insert(iterator hint, const value_type& x);
+
+    /*!
+      insert an entry (if its key is not yet present)
+    */
+    std::pair<iterator,bool> insert(const value_type& x);
+
+    /*!
+      remove the entry at a given position
+    */
+    void erase(iterator position);
+
+    /*!
+      remove the entry with a given key, returns the number of removed entries
+    */
+    size_type erase(const K& k);
+
+    /*!
+      buffered writing access, *this[k] = value
+    */
+    void buffer_set(const K& k, const T& value);
+
+    /*!
+      buffered writing access, *this[k] += increment;
+      an entry which becomes zero by this is removed
+      (cf. InfiniteVector::add_coefficient())
+    */
+    void buffer_add(const K& k, const T& increment);
+
+    /*!
+      merge the write buffer into the sorted array
+    */
+    void consolidate() const;
+
+  protected:
+    /*!
+      buffered write operation
+    */
+    struct PendingEntry
+    {
+      K key;
+      T value;
+      bool accumulate;
+    };
+
+    /*!
+      helper struct to sort the buffered write operations by key
+    */
+    struct pending_order
+    {
+      inline bool operator () (const PendingEntry& e1, const PendingEntry& e2) const
+      {
+	return e1.key < e2.key;
+      }
+    };
+
+    /*!
+      helper struct to compare entries and keys
+    */
+    struct key_order
+    {
+      inline bool operator () (const value_type& x, const K& k) const
+      {
+	return x.first < k;
+      }
+    };
+
+    /*!
+      the sorted entries
+    */
+    mutable std::vector<value_type> entries_;
+
+    /*!
+      the write buffer
+    */
+    mutable std::vector<PendingEntry> pending_;
+  };
+}
+
+#include <utils/sorted_array_map.cpp>
+
+#endif
@@ -296,7 +296,7 @@ inline unsigned int log2(const unsigned int n)
  * 
  * T = const Array1D < MultiIndex<int,DIM> >  == j0
  * Assumption: f < DIM, otherwise nothing will be compared!
- *
+ */
 template<class T> 
 struct index_cmp
 {
@@ -322,11 +322,11 @@ struct index_cmp
     const unsigned int from;
 };
 
-
+/*
  * Similar, but the last entry of arr is ignored. This is relevant for the first level j_ with a certain norm \|j_\|. 
  * All but the last entry of such a level are equal to j0()[patch][i]. 
  * However, the last entry is of some value independent of j0()[patch][DIM-1]
- 
+ */
 template<class T> 
 struct index_cmp_ignoreLastEntry
 {
@@ -351,14 +351,14 @@ struct index_cmp_ignoreLastEntry
     const T arr;
     const unsigned int from;
 };
- For sorting arrays, e.g., multiindices, by their values from position 
+/* For sorting arrays, e.g., multiindices, by their values from position 
  * 
  * DIM-1 to 0 (reversed order in the dimensions)
  * 
  * (ordering w.r.t. entry in the array, i.e., a and b, is not reversed)
  * 
  * T = const Array1D < MultiIndex<int,DIM>>  == j0
- *
+ */
 template<class T> 
 struct index_cmp_reversed
 {
@@ -382,5 +382,5 @@ struct index_cmp_reversed
     }
     const T arr;
 };
-*/
+
 #endif
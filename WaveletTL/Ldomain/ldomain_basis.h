@@ -166,6 +166,9 @@ namespace WaveletTL
       setup_full_collection();
     }
 
+    //! maximal level
+    inline const int jmax() const { return jmax_; }
+
     //! get the wavelet index corresponding to a specified number
     const inline Index* get_wavelet (const int number) const {
       return &full_collection[number];
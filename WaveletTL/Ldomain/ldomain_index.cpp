@@ -26,6 +26,21 @@ namespace WaveletTL
   {
   }
 
+  template <class IBASIS>
+  LDomainIndex<IBASIS>::LDomainIndex(const key_type& key,
+				     const LDomainBasis<IBASIS>* basis)
+    : basis_(basis)
+  {
+    unsigned int pos(0);
+    j_ = key.get(pos, 6);
+    e_[0] = key.get(pos, 1);
+    e_[1] = key.get(pos, 1);
+    p_ = key.get(pos, 3);
+    pos += 1+key_translation_bits+1; // the 1-norm of k is redundant
+    k_[0] = key.get_signed(pos, key_translation_bits);
+    k_[1] = key.get_signed(pos, key_translation_bits);
+  }
+
   template <class IBASIS>
   LDomainIndex<IBASIS>::LDomainIndex(const LDomainIndex& lambda)
     : basis_(lambda.basis_), j_(lambda.j_), e_(lambda.e_), p_(lambda.p_), k_(lambda.k_)
@@ -234,6 +249,27 @@ namespace WaveletTL
 	    );
   }
 
+  template <class IBASIS>
+  typename LDomainIndex<IBASIS>::key_type
+  LDomainIndex<IBASIS>::key() const
+  {
+    // the fields in the order of "<": j, e (the types are ordered lexicographically),
+    // p and k, which MultiIndex orders by the unsigned 1-norm first,
+    // so that negative 1-norms come after the nonnegative ones
+    key_type key;
+    unsigned int pos(0);
+    key.put(pos, j_, 6);
+    key.put(pos, e_[0], 1);
+    key.put(pos, e_[1], 1);
+    key.put(pos, p_, 3);
+    const int degree(k_[0]+k_[1]);
+    key.put(pos, degree < 0 ? 1 : 0, 1);
+    key.put_signed(pos, degree, key_translation_bits+1);
+    key.put_signed(pos, k_[0], key_translation_bits);
+    key.put_signed(pos, k_[1], key_translation_bits);
+    return key;
+  }
+
   template <class IBASIS>
   const int
   LDomainIndex<IBASIS>::number() const
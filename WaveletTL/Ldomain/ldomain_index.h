@@ -15,8 +15,10 @@ using std::cout;
 using std::endl;
 
 #include <utils/multiindex.h>
+#include <utils/packed_key.h>
 
 using MathTL::MultiIndex;
+using MathTL::PackedKey;
 
 namespace WaveletTL
 {
@@ -47,6 +49,12 @@ namespace WaveletTL
     //! translation index type
     typedef MultiIndex<int,2> translation_type;
 
+    //! packed key type, see key()
+    typedef PackedKey<1> key_type;
+
+    //! bit width of the (biased) translation indices in the packed key
+    static const unsigned int key_translation_bits = 17;
+
     /*!
       constructor with a given L-domain basis
       (also serves as a default constructor, but yields an invalid index
@@ -61,6 +69,9 @@ namespace WaveletTL
 		 const translation_type& k,
 		 const LDomainBasis<IBASIS>* basis);
 
+    //! constructor from a packed key, see key()
+    LDomainIndex(const key_type& key, const LDomainBasis<IBASIS>* basis);
+
     //! copy constructor
     LDomainIndex(const LDomainIndex& lambda);
 
@@ -106,6 +117,14 @@ namespace WaveletTL
       on the level j.
     */
     const int number() const;
+
+    /*!
+      Compact key of the index: (j,e,p,k) packed into one 64-bit word.
+      Keys are ordered like the indices ("<", including the ordering of k by
+      its unsigned 1-norm as in MultiIndex). Levels up to 63 and translations
+      |k_i| < 2^16 can be represented.
+    */
+    key_type key() const;
     
   protected:
     //! pointer to the underlying basis
@@ -1,15 +1,165 @@
 // implementation for APPLY
 
 #include <utils/array1d.h>
+#include <algebra/sparse_accumulator.h>
 #include <list>
 #include <map>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 
 using MathTL::Array1D;
+using MathTL::SparseAccumulator;
 
 namespace WaveletTL
 {
+  /*
+    helpers for APPLY_QUARKLET (parallel or sparse accumulation):
+    the column index of an entry of v, both for Index and for integer (number) coefficients
+  */
+  template <class PROBLEM>
+  inline
+  const typename PROBLEM::Index&
+  apply_column_index(const PROBLEM& P, const typename PROBLEM::Index& lambda)
+  {
+    return lambda;
+  }
+
+  template <class PROBLEM>
+  inline
+  const typename PROBLEM::Index&
+  apply_column_index(const PROBLEM& P, const int lambda)
+  {
+    return *(P.frame().get_quarklet(lambda));
+  }
+
+  /*
+    helpers for the sparse accumulation in APPLY_QUARKLET:
+    store an entry of the result, both for Index and for integer (number) coefficients
+  */
+  template <class PROBLEM>
+  inline
+  void
+  apply_set_quarklet(const PROBLEM& P, const unsigned int i, const double value,
+		     InfiniteVector<double, typename PROBLEM::Index>& w)
+  {
+    w.set_coefficient(*(P.frame().get_quarklet(i)), value);
+  }
+
+  template <class PROBLEM>
+  inline
+  void
+  apply_set_quarklet(const PROBLEM& P, const unsigned int i, const double value,
+		     InfiniteVector<double,int>& w)
+  {
+    w.set_coefficient(i, value);
+  }
+
+  /*
+    Sparse accumulation of w = \sum_{k=0}^\ell A_{J-k}v_{[k]} (apply_accumulation()==sparse_accumulation).
+
+    Instead of a Vector<double> of length degrees_of_freedom(), which has to be allocated,
+    zeroed and scanned completely in each call, the columns are accumulated into a
+    SparseAccumulator<double>, so that the cost of the accumulation and of the copy into w
+    is proportional to the number of entries actually written.
+    The routines return false if the problem class does not support writing into a
+    SparseAccumulator (cf. SparseAccumulationTraits); then the caller uses the dense vector.
+  */
+  template <class PROBLEM, bool SUPPORTED = SparseAccumulationTraits<PROBLEM>::supported>
+  struct SparseApply
+  {
+    template <class INDEX>
+    static bool apply(const PROBLEM& P,
+		      const std::list<std::list<std::pair<INDEX, double> > >& vks,
+		      const int J,
+		      InfiniteVector<double, typename PROBLEM::Index>& w,
+		      const int jmax,
+		      const CompressionStrategy strategy)
+    {
+      return false;
+    }
+
+    template <class INDEX>
+    static bool apply_quarklet(const PROBLEM& P,
+			       const std::list<std::list<std::pair<INDEX, double> > >& vks,
+			       const int J,
+			       InfiniteVector<double, INDEX>& w,
+			       const int jmax,
+			       const CompressionStrategy strategy,
+			       const int pmax,
+			       const double a,
+			       const double b)
+    {
+      return false;
+    }
+  };
+
+  template <class PROBLEM>
+  struct SparseApply<PROBLEM, true>
+  {
+    template <class INDEX>
+    static bool apply(const PROBLEM& P,
+		      const std::list<std::list<std::pair<INDEX, double> > >& vks,
+		      const int J,
+		      InfiniteVector<double, typename PROBLEM::Index>& w,
+		      const int jmax,
+		      const CompressionStrategy strategy)
+    {
+      SparseAccumulator<double> ww(P.basis().degrees_of_freedom());
+      int k = 0;
+      for (typename std::list<std::list<std::pair<INDEX, double> > >::const_iterator it(vks.begin());
+	   it != vks.end(); ++it, ++k)
+	for (typename std::list<std::pair<INDEX, double> >::const_iterator itk(it->begin());
+	     itk != it->end(); ++itk)
+	  add_compressed_column(P, itk->second, itk->first, J-k, ww, jmax, strategy, true);
+
+      // copy ww into w, in increasing order of the indices
+      ww.sort();
+      for (unsigned int n = 0; n < ww.n_touched(); n++)
+	if (ww.touched_value(n) != 0.)
+	  w.set_coefficient(*(P.basis().get_wavelet(ww.touched_index(n))), ww.touched_value(n));
+      return true;
+    }
+
+    template <class INDEX>
+    static bool apply_quarklet(const PROBLEM& P,
+			       const std::list<std::list<std::pair<INDEX, double> > >& vks,
+			       const int J,
+			       InfiniteVector<double, INDEX>& w,
+			       const int jmax,
+			       const CompressionStrategy strategy,
+			       const int pmax,
+			       const double a,
+			       const double b)
+    {
+#if PARALLEL_ADD_COLUMN==1
+      // the levels of one column are added concurrently, which needs the dense vector
+      return false;
+#else
+      SparseAccumulator<double> ww(P.frame().degrees_of_freedom());
+      int k = 0;
+      for (typename std::list<std::list<std::pair<INDEX, double> > >::const_iterator it(vks.begin());
+	   it != vks.end(); ++it, ++k)
+	for (typename std::list<std::pair<INDEX, double> >::const_iterator itk(it->begin());
+	     itk != it->end(); ++itk)
+	  add_compressed_column_quarklet(P, itk->second, apply_column_index(P, itk->first),
+					 J-k, ww, jmax, strategy, true, pmax, a, b);
+
+      // copy ww into w, in increasing order of the indices
+      ww.sort();
+      for (unsigned int n = 0; n < ww.n_touched(); n++)
+	if (ww.touched_value(n) != 0.)
+	  apply_set_quarklet(P, ww.touched_index(n), ww.touched_value(n), w);
+      return true;
+#endif
+    }
+  };
+
   template <class PROBLEM>
   void APPLY_TEST(const PROBLEM& P,
 		  const InfiniteVector<double, typename PROBLEM::Index>& v,
@@ -39,18 +189,10 @@ namespace WaveletTL
       // Setup the bins: The i-th bin contains the entries of v with modulus in the interval
       // (2^{-(i+1)}||v||,2^{-i}||v||], 0 <= i <= q-1, the remaining elements (with even smaller modulus)
       // are collected in the q-th bin.
-      Array1D<std::list<std::pair<Index, double> > > bins(q+1);
-      for (typename InfiniteVector<double,Index>::const_iterator it(v.begin());
- 	   it != v.end(); ++it) {
- 	const unsigned int i = std::min(q, (unsigned int)floor(-log(fabs(*it)/norm_v)/M_LN2));
-	bins[i].push_back(std::make_pair(it.index(), *it));
-      }
-      // glue all the bins together
-      Array1D<std::pair<Index, double> > v_binned(v.size());
-      for (unsigned int bin = 0, id = 0; bin <= q; bin++)
-	for (typename std::list<std::pair<Index, double> >::const_iterator it(bins[bin].begin());
-	     it != bins[bin].end(); ++it, ++id)
-	  v_binned[id] = *it;
+      // (counting sort, the bins are stored consecutively in v_binned)
+      std::vector<std::pair<Index, double> > v_binned;
+      std::vector<unsigned int> bin_offsets;
+      v.binary_binning(norm_v, q, v_binned, bin_offsets);
 
       const double theta = 0.5;
       // setup the segments v_{[0]},...,v_{[\ell]},
@@ -213,21 +355,10 @@ namespace WaveletTL
       // Setup the bins: The i-th bin contains the entries of v with modulus in the interval
       // (2^{-(i+1)}||v||,2^{-i}||v||], 0 <= i <= q-1, the remaining elements (with even smaller modulus)
       // are collected in the q-th bin.
-      Array1D<std::list<std::pair<Index, double> > > bins(q+1);
-      for (typename InfiniteVector<double,Index>::const_iterator it(v.begin());
- 	   it != v.end(); ++it) {
- 	const unsigned int i = std::min(q, (unsigned int)floor(-log(fabs(*it)/norm_v)/M_LN2));
-	bins[i].push_back(std::make_pair(it.index(), *it));
-      }
-
-
-
-      // glue all the bins together
-      Array1D<std::pair<Index, double> > v_binned(v.size());
-      for (unsigned int bin = 0, id = 0; bin <= q; bin++)
-	for (typename std::list<std::pair<Index, double> >::const_iterator it(bins[bin].begin());
-	     it != bins[bin].end(); ++it, ++id)
-	  v_binned[id] = *it;
+      // (counting sort, the bins are stored consecutively in v_binned)
+      std::vector<std::pair<Index, double> > v_binned;
+      std::vector<unsigned int> bin_offsets;
+      v.binary_binning(norm_v, q, v_binned, bin_offsets);
 
       const double theta = 0.5;
       // setup the segments v_{[0]},...,v_{[\ell]},
@@ -387,20 +518,10 @@ namespace WaveletTL
       // Setup the bins: The i-th bin contains the entries of v with modulus in the interval
       // (2^{-(i+1)}||v||,2^{-i}||v||], 0 <= i <= q-1, the remaining elements (with even smaller modulus)
       // are collected in the q-th bin.
-      Array1D<std::list<std::pair<Index, double> > > bins(q+1);
-      for (typename InfiniteVector<double,Index>::const_iterator it(v.begin());
- 	   it != v.end(); ++it) {
- 	const unsigned int i = std::min(q, (unsigned int)floor(-log(fabs(*it)/norm_v)/M_LN2));
-	bins[i].push_back(std::make_pair(it.index(), *it));
-        //cout << i << ", " << it.index() << ", " << *it << endl;
-      }
-      
-      // glue all the bins together
-      Array1D<std::pair<Index, double> > v_binned(v.size());
-      for (unsigned int bin = 0, id = 0; bin <= q; bin++)
-	for (typename std::list<std::pair<Index, double> >::const_iterator it(bins[bin].begin());
-	     it != bins[bin].end(); ++it, ++id)
-	  v_binned[id] = *it;
+      // (counting sort, the bins are stored consecutively in v_binned)
+      std::vector<std::pair<Index, double> > v_binned;
+      std::vector<unsigned int> bin_offsets;
+      v.binary_binning(norm_v, q, v_binned, bin_offsets);
 
       const double theta = 0.5;
       // setup the segments v_{[0]},...,v_{[\ell]},
@@ -455,6 +576,10 @@ namespace WaveletTL
 
       //cout << "done binning in apply..." << endl;
 
+      if (apply_accumulation() == sparse_accumulation
+	  && SparseApply<PROBLEM>::apply(P, vks, J, w, jmax, strategy))
+	return;
+
       Vector<double> ww(P.basis().degrees_of_freedom());
  //     cout << "AUSGEFÜHRT PART2: " << P.basis().degrees_of_freedom() << endl;//HIER WEITERMACHEN @PHK
       //cout << *(P.basis().get_wavelet(4000)) << endl;
@@ -488,6 +613,197 @@ namespace WaveletTL
 //    cout << "bin raus" << endl;
   }
 
+#if PARALLEL_APPLY==1
+  /*
+    thread-local accumulation buffers of apply_quarklet_parallel():
+    a SparseAccumulator<double> if the problem class can write into it (cf. SparseAccumulationTraits),
+    otherwise a dense Vector<double>
+  */
+  template <class PROBLEM, bool SPARSE = SparseAccumulationTraits<PROBLEM>::supported>
+  struct ParallelApplyBuffer
+  {
+    typedef Vector<double> type;
+  };
+
+  template <class PROBLEM>
+  struct ParallelApplyBuffer<PROBLEM, true>
+  {
+    typedef SparseAccumulator<double> type;
+  };
+
+  //! block size for the reduction of dense buffers in apply_quarklet_parallel()
+  static const int apply_parallel_block_size = 1024;
+
+  /*
+    prepare the reduction of a thread-local buffer (called by its own thread):
+    for a dense buffer, mark the blocks with nonzero entries,
+    a sparse buffer is sorted by the indices of its entries
+  */
+  inline
+  void apply_parallel_prepare(Vector<double>& buffer, std::vector<char>& touched)
+  {
+    const int n = buffer.size();
+    touched.assign((n+apply_parallel_block_size-1)/apply_parallel_block_size, 0);
+    for (int i = 0; i < n; i++)
+      if (buffer[i] != 0.) {
+	touched[i/apply_parallel_block_size] = 1;
+	i = (i/apply_parallel_block_size+1)*apply_parallel_block_size-1; // skip the rest of the block
+      }
+  }
+
+  inline
+  void apply_parallel_prepare(SparseAccumulator<double>& buffer, std::vector<char>& touched)
+  {
+    buffer.sort();
+  }
+
+  /*
+    ww += sum of the thread-local buffers, called by all threads of the team;
+    each entry of ww is updated by one thread, always in the same order of the buffers
+  */
+  inline
+  void apply_parallel_reduce(const std::vector<Vector<double>*>& buffers,
+			     const std::vector<std::vector<char> >& touched,
+			     const int thread, const int nthreads,
+			     Vector<double>& ww)
+  {
+    // only the blocks with nonzero entries are merged
+    const int n = ww.size(), nblocks = (n+apply_parallel_block_size-1)/apply_parallel_block_size;
+#pragma omp for schedule(static)
+    for (int b = 0; b < nblocks; b++)
+      for (int t = 0; t < nthreads; t++)
+	if (touched[t][b]) {
+	  const Vector<double>& buffer(*buffers[t]);
+	  for (int i = b*apply_parallel_block_size; i < std::min(n, (b+1)*apply_parallel_block_size); i++)
+	    ww[i] += buffer[i];
+	}
+  }
+
+  inline
+  void apply_parallel_reduce(const std::vector<SparseAccumulator<double>*>& buffers,
+			     const std::vector<std::vector<char> >& touched,
+			     const int thread, const int nthreads,
+			     Vector<double>& ww)
+  {
+    // each thread merges the entries of one index range, found by binary search in the sorted buffers
+    const unsigned int n = ww.size();
+    const unsigned int lo = (unsigned int)((double)n*thread/nthreads);
+    const unsigned int hi = (unsigned int)((double)n*(thread+1)/nthreads);
+    for (int t = 0; t < nthreads; t++) {
+      const SparseAccumulator<double>& buffer(*buffers[t]);
+      unsigned int first = 0, last = buffer.n_touched();
+      while (first < last) {
+	const unsigned int middle = (first+last)/2;
+	if (buffer.touched_index(middle) < lo)
+	  first = middle+1;
+	else
+	  last = middle;
+      }
+      for (unsigned int k = first; k < buffer.n_touched() && buffer.touched_index(k) < hi; k++)
+	ww[buffer.touched_index(k)] += buffer.touched_value(k);
+    }
+#pragma omp barrier
+  }
+
+  /*
+    Parallel computation of ww += \sum_{k=0}^\ell A_{J-k}v_{[k]} for APPLY_QUARKLET.
+
+    The columns of all segments v_{[k]} are gathered in one work list, so that the
+    threads are balanced over single columns instead of whole segments.
+    The cost of a column of A_{J-k} is dominated by the number of levels and polynomial
+    degrees in the compression ball, which grows like 2^{J-k}. The work list is processed
+    in the order of decreasing estimated cost (largest columns first).
+
+    Each thread accumulates into its own buffer, a SparseAccumulator<double> if the problem
+    class supports it (and PARALLEL_ADD_COLUMN!=1), so that the memory and the cost of the
+    reduction are proportional to the number of entries written. Otherwise, dense buffers
+    are used, of which only the blocks with nonzero entries are merged.
+    Each entry of ww is summed up by one thread, always in the same order of the buffers.
+    With PARALLEL_APPLY_DETERMINISTIC==1, the columns are assigned to the threads by a
+    static greedy partition of the estimated costs instead of dynamic scheduling,
+    so that the result does not depend on the timing of the threads
+    (for a fixed number of threads).
+  */
+  template <class PROBLEM, class INDEX>
+  void apply_quarklet_parallel(const PROBLEM& P,
+			       const std::list<std::list<std::pair<INDEX, double> > >& vks,
+			       const unsigned int J,
+			       Vector<double>& ww,
+			       const int jmax,
+			       const CompressionStrategy strategy,
+			       const int pmax,
+			       const double a,
+			       const double b)
+  {
+#if PARALLEL_ADD_COLUMN==1
+    // the levels of one column are added concurrently, which needs dense buffers
+    typedef Vector<double> Buffer;
+#else
+    typedef typename ParallelApplyBuffer<PROBLEM>::type Buffer;
+#endif
+
+    // setup the work list, the segments are ordered by decreasing J-k
+    std::vector<const std::pair<INDEX, double>*> columns;
+    std::vector<int> radii;
+    std::vector<double> costs;
+    unsigned int k = 0;
+    for (typename std::list<std::list<std::pair<INDEX, double> > >::const_iterator it(vks.begin());
+	 it != vks.end(); ++it, ++k)
+      for (typename std::list<std::pair<INDEX, double> >::const_iterator itk(it->begin());
+	   itk != it->end(); ++itk) {
+	columns.push_back(&(*itk));
+	radii.push_back(J-k);
+	costs.push_back(ldexp(1.0, J-k));
+      }
+    const int ncolumns = columns.size();
+    const int n = ww.size();
+
+    std::vector<Buffer*> buffers(NUM_THREADS, (Buffer*)0);
+    std::vector<std::vector<char> > touched(NUM_THREADS);
+    std::vector<int> owner(ncolumns, 0);
+
+#pragma omp parallel num_threads(NUM_THREADS)
+    {
+#ifdef _OPENMP
+      const int thread = omp_get_thread_num(), nthreads = omp_get_num_threads();
+#else
+      const int thread = 0, nthreads = 1;
+#endif
+      // the buffer is allocated (and first touched) by its own thread
+      Buffer local(n);
+      buffers[thread] = &local;
+
+#if PARALLEL_APPLY_DETERMINISTIC==1
+#pragma omp single
+      {
+	// greedy partition: each column goes to the thread with the least work so far
+	std::vector<double> load(nthreads, 0.0);
+	for (int i = 0; i < ncolumns; i++) {
+	  const int t = std::min_element(load.begin(), load.end()) - load.begin();
+	  owner[i] = t;
+	  load[t] += costs[i];
+	}
+      }
+      for (int i = 0; i < ncolumns; i++)
+	if (owner[i] == thread)
+	  add_compressed_column_quarklet(P, columns[i]->second, apply_column_index(P, columns[i]->first),
+					 radii[i], local, jmax, strategy, true, pmax, a, b);
+#else
+#pragma omp for schedule(dynamic) nowait
+      for (int i = 0; i < ncolumns; i++)
+	add_compressed_column_quarklet(P, columns[i]->second, apply_column_index(P, columns[i]->first),
+				       radii[i], local, jmax, strategy, true, pmax, a, b);
+#endif
+
+      apply_parallel_prepare(local, touched[thread]);
+
+#pragma omp barrier
+      // the barrier at the end of the reduction keeps the buffers alive until all threads are done
+      apply_parallel_reduce(buffers, touched, thread, nthreads, ww);
+    }
+  }
+#endif
+
   template <class PROBLEM>
   void APPLY_QUARKLET(const PROBLEM& P,
 	     const InfiniteVector<double, typename PROBLEM::Index>& v,
@@ -524,20 +840,10 @@ namespace WaveletTL
       // Setup the bins: The i-th bin contains the entries of v with modulus in the interval
       // (2^{-(i+1)}||v||,2^{-i}||v||], 0 <= i <= q-1, the remaining elements (with even smaller modulus)
       // are collected in the q-th bin.
-      Array1D<std::list<std::pair<Index, double> > > bins(q+1);
-      for (typename InfiniteVector<double,Index>::const_iterator it(v.begin());
- 	   it != v.end(); ++it) {
- 	const unsigned int i = std::min(q, (unsigned int)floor(-log(fabs(*it)/norm_v)/M_LN2));
-	bins[i].push_back(std::make_pair(it.index(), *it));
-        //cout << i << ", " << it.index() << ", " << *it << endl;
-      }
-      
-      // glue all the bins together
-      Array1D<std::pair<Index, double> > v_binned(v.size());
-      for (unsigned int bin = 0, id = 0; bin <= q; bin++)
-	for (typename std::list<std::pair<Index, double> >::const_iterator it(bins[bin].begin());
-	     it != bins[bin].end(); ++it, ++id)
-	  v_binned[id] = *it;
+      // (counting sort, the bins are stored consecutively in v_binned)
+      std::vector<std::pair<Index, double> > v_binned;
+      std::vector<unsigned int> bin_offsets;
+      v.binary_binning(norm_v, q, v_binned, bin_offsets);
 
       const double theta = 0.5;
       // setup the segments v_{[0]},...,v_{[\ell]},
@@ -601,6 +907,12 @@ namespace WaveletTL
 
       //cout << "done binning in apply..." << endl;
 
+#if PARALLEL_APPLY!=1
+      if (apply_accumulation() == sparse_accumulation
+	  && SparseApply<PROBLEM>::apply_quarklet(P, vks, J, w, jmax, strategy, pmax, a, b))
+	return;
+#endif
+
       Vector<double> ww(P.frame().degrees_of_freedom());
       //Vector<double> wwhelp(P.frame().degrees_of_freedom());
       //cout << ww<<endl;
@@ -609,64 +921,15 @@ namespace WaveletTL
       // compute w = \sum_{k=0}^\ell A_{J-k}v_{[k]}
 //      for(int i=0;i<vksize.size();i++) cout<<vksize[i]<<endl;
 #if PARALLEL_APPLY==1
-      //outer loop parallelization
-#pragma omp parallel num_threads(NUM_THREADS)
-{             
-          #pragma omp for nowait schedule(dynamic)
-      for(k=0;k<ell;k++){
-          typename std::list<std::list<std::pair<Index, double> > >::const_iterator it(vks.begin());
-          advance(it, k); 
-          unsigned int z = 0;
-            for (typename std::list<std::pair<Index, double> >::const_iterator itk(it->begin());
-	     itk != it->end(); ++itk,++z) {
-          
-          //inner loop parallelization
-//          k = 0;
-//          for (typename std::list<std::list<std::pair<Index, double> > >::const_iterator it(vks.begin());
-//	      k <= ell; ++it, ++k) {
-////              cout <<vksize[k]<<endl;
-////              int my_num_threads = (vksize[k]>=64) ? 8 : 1;
-//#pragma omp parallel //num_threads(my_num_threads)
-//{
-////            if(omp_get_thread_num()==0)
-////                cout<<"number of threads: "<<omp_get_num_threads()<<endl;
-//            Vector<double> wwprivate(P.frame().degrees_of_freedom()); 
-//            unsigned int z = 0;
-//#pragma omp for
-//            for(int z=0;z<vksize[k];z++){
-//              typename std::list<std::pair<Index, double> >::const_iterator itk(it->begin());
-//              advance(itk,z);          
-              
-            
+      // outer loop parallelization with thread-local accumulation buffers
+      apply_quarklet_parallel(P, vks, J, ww, jmax, strategy, pmax, a, b);
 #else
       k = 0;
       for (typename std::list<std::list<std::pair<Index, double> > >::const_iterator it(vks.begin());
-	   k <= ell; ++it, ++k) {
-           unsigned int z = 0;
-            for (typename std::list<std::pair<Index, double> >::const_iterator itk(it->begin());
-	     itk != it->end(); ++itk,++z) {
-#endif
-          //  Vector<double> wwhelp(P.frame().degrees_of_freedom());
-	  //add_compressed_column(P, itk->second, itk->first, J-k, ww, jmax, strategy);
-//            cout << "J-k = " << J-k << endl;
-//            cout << "addcompressed wird ausgeführt" << endl;
-//            cout << itk->second << ", " << itk->first << endl;
-            //cout << "Beginn cc" << endl;
-           // add_compressed_column_quarklet(P, itk->second, itk->first, J-k, ww, jmax, strategy, true, pmax, a, b);
-           //Vector<double> wwhelp(P.frame().degrees_of_freedom());
-
-            add_compressed_column_quarklet(P, itk->second, itk->first, J-k, ww, jmax, strategy, true, pmax, a, b);
-
-//          cout << "Ende cc" << endl;
-          //cout << ww << endl;
-	  //z++;
-	}
-//        cout<<"z="<<z<<":"<<vksize[k]<<endl;
-           //outer loop or collapse parallelization
-      }
-            
-#if PARALLEL_APPLY==1
-} 
+	   k <= ell; ++it, ++k)
+	for (typename std::list<std::pair<Index, double> >::const_iterator itk(it->begin());
+	     itk != it->end(); ++itk)
+	  add_compressed_column_quarklet(P, itk->second, itk->first, J-k, ww, jmax, strategy, true, pmax, a, b);
 #endif
 //       }
 //      cout<<"k= "<<k<<endl;
@@ -719,20 +982,10 @@ namespace WaveletTL
       // Setup the bins: The i-th bin contains the entries of v with modulus in the interval
       // (2^{-(i+1)}||v||,2^{-i}||v||], 0 <= i <= q-1, the remaining elements (with even smaller modulus)
       // are collected in the q-th bin.
-      Array1D<std::list<std::pair<int, double> > > bins(q+1);
-      for (typename InfiniteVector<double,int>::const_iterator it(v.begin());
- 	   it != v.end(); ++it) {
- 	const unsigned int i = std::min(q, (unsigned int)floor(-log(fabs(*it)/norm_v)/M_LN2));
-	bins[i].push_back(std::make_pair(it.index(), *it));
-        //cout << i << ", " << it.index() << ", " << *it << endl;
-      }
-      
-      // glue all the bins together
-      Array1D<std::pair<int, double> > v_binned(v.size());
-      for (unsigned int bin = 0, id = 0; bin <= q; bin++)
-	for (typename std::list<std::pair<int, double> >::const_iterator it(bins[bin].begin());
-	     it != bins[bin].end(); ++it, ++id)
-	  v_binned[id] = *it;
+      // (counting sort, the bins are stored consecutively in v_binned)
+      std::vector<std::pair<int, double> > v_binned;
+      std::vector<unsigned int> bin_offsets;
+      v.binary_binning(norm_v, q, v_binned, bin_offsets);
 
       const double theta = 0.5;
       // setup the segments v_{[0]},...,v_{[\ell]},
@@ -796,6 +1049,12 @@ namespace WaveletTL
 
       //cout << "done binning in apply..." << endl;
 
+#if PARALLEL_APPLY!=1
+      if (apply_accumulation() == sparse_accumulation
+	  && SparseApply<PROBLEM>::apply_quarklet(P, vks, J, w, jmax, strategy, pmax, a, b))
+	return;
+#endif
+
       Vector<double> ww(P.frame().degrees_of_freedom());
       //Vector<double> wwhelp(P.frame().degrees_of_freedom());
       //cout << ww<<endl;
@@ -804,60 +1063,15 @@ namespace WaveletTL
       // compute w = \sum_{k=0}^\ell A_{J-k}v_{[k]}
 //      for(int i=0;i<vksize.size();i++) cout<<vksize[i]<<endl;
 #if PARALLEL_APPLY==1
-////      //outer loop parallelization
-#pragma omp parallel num_threads(NUM_THREADS)
-{              
-          #pragma omp for nowait schedule(dynamic)
-      for(k=0;k<ell;k++){
-          typename std::list<std::list<std::pair<int, double> > >::const_iterator it(vks.begin());
-          advance(it, k); 
-          unsigned int z = 0;
-            for (typename std::list<std::pair<int, double> >::const_iterator itk(it->begin());
-	     itk != it->end(); ++itk,++z) {
-          
-          //inner loop parallelization, slower than outer
-//          k = 0;
-//          for (typename std::list<std::list<std::pair<int, double> > >::const_iterator it(vks.begin());
-//	      k <= ell; ++it, ++k) {
-////              cout <<vksize[k]<<endl;
-////              int my_num_threads = (vksize[k]>=64) ? 8 : 1;
-//#pragma omp parallel num_threads(2) //num_threads(my_num_threads)
-//{
-////            if(omp_get_thread_num()==0)
-////                cout<<"number of threads: "<<omp_get_num_threads()<<endl;
-//            unsigned int z = 0;
-//#pragma omp for nowait
-//            for(int z=0;z<vksize[k];z++){
-//              typename std::list<std::pair<int, double> >::const_iterator itk(it->begin());
-//              advance(itk,z);          
-              
+      // outer loop parallelization with thread-local accumulation buffers
+      apply_quarklet_parallel(P, vks, J, ww, jmax, strategy, pmax, a, b);
 #else
       k = 0;
       for (typename std::list<std::list<std::pair<int, double> > >::const_iterator it(vks.begin());
-	   k <= ell; ++it, ++k) {
-           unsigned int z = 0;
-            for (typename std::list<std::pair<int, double> >::const_iterator itk(it->begin());
-	     itk != it->end(); ++itk,++z) {
-#endif
-          //  Vector<double> wwhelp(P.frame().degrees_of_freedom());
-	  //add_compressed_column(P, itk->second, itk->first, J-k, ww, jmax, strategy);
-//            cout << "J-k = " << J-k << endl;
-//            cout << "addcompressed wird ausgeführt" << endl;
-//            cout << itk->second << ", " << itk->first << endl;
-            //cout << "Beginn cc" << endl;
-           // add_compressed_column_quarklet(P, itk->second, itk->first, J-k, ww, jmax, strategy, true, pmax, a, b);
-           //Vector<double> wwhelp(P.frame().degrees_of_freedom());
-
-            add_compressed_column_quarklet(P, itk->second, *(P.frame().get_quarklet(itk->first)), J-k, ww, jmax, strategy, true, pmax, a, b);
-
-//          cout << "Ende cc" << endl;
-          //cout << ww << endl;
-	  //z++;
-	}
-      }
-//        cout<<"z="<<z<<":"<<vksize[k]<<endl;
-#if PARALLEL_APPLY==1
-      } 
+	   k <= ell; ++it, ++k)
+	for (typename std::list<std::pair<int, double> >::const_iterator itk(it->begin());
+	     itk != it->end(); ++itk)
+	  add_compressed_column_quarklet(P, itk->second, *(P.frame().get_quarklet(itk->first)), J-k, ww, jmax, strategy, true, pmax, a, b);
 #endif
        
 //      cout<<"k= "<<k<<endl;
@@ -892,18 +1106,10 @@ namespace WaveletTL
       const double norm_A = P.norm_A();
       
       const unsigned int q = (unsigned int) std::max(ceil(log(sqrt((double)v.size())*norm_v*norm_A*2/eta)/M_LN2), 0.);
-      Array1D<std::list<std::pair<Index, double> > > bins(q+1);
-      for (typename InfiniteVector<double,Index>::const_iterator it(v.begin());
- 	   it != v.end(); ++it) {
- 	const unsigned int i = std::min(q, (unsigned int)floor(-log(fabs(*it)/norm_v)/M_LN2));
-	bins[i].push_back(std::make_pair(it.index(), *it));
-      }
-      
-      Array1D<std::pair<Index, double> > v_binned(v.size());
-      for (unsigned int bin = 0, id = 0; bin <= q; bin++)
-	for (typename std::list<std::pair<Index, double> >::const_iterator it(bins[bin].begin());
-	     it != bins[bin].end(); ++it, ++id)
-	  v_binned[id] = *it;
+      // (counting sort, the bins are stored consecutively in v_binned)
+      std::vector<std::pair<Index, double> > v_binned;
+      std::vector<unsigned int> bin_offsets;
+      v.binary_binning(norm_v, q, v_binned, bin_offsets);
 
       const double theta = 0.5;
       const double threshold = eta*eta*theta*theta/(norm_A*norm_A);
@@ -1006,18 +1212,10 @@ namespace WaveletTL
       // Setup the bins: The i-th bin contains the entries of v with modulus in the interval
       // (2^{-(i+1)}||v||,2^{-i}||v||], 0 <= i <= q-1, the remaining elements (with even smaller modulus)
       // are collected in the q-th bin.
-      Array1D<std::list<std::pair<Index, double> > > bins(q+1);
-      for (typename InfiniteVector<double,Index>::const_iterator it(v.begin());
- 	   it != v.end(); ++it) {
- 	const unsigned int i = std::min(q, (unsigned int)floor(-log(fabs(*it)/norm_v)/M_LN2));
-	bins[i].push_back(std::make_pair(it.index(), *it));
-      }
-      // glue all the bins together
-      Array1D<std::pair<Index, double> > v_binned(v.size());
-      for (unsigned int bin = 0, id = 0; bin <= q; bin++)
-	for (typename std::list<std::pair<Index, double> >::const_iterator it(bins[bin].begin());
-	     it != bins[bin].end(); ++it, ++id)
-	  v_binned[id] = *it;
+      // (counting sort, the bins are stored consecutively in v_binned)
+      std::vector<std::pair<Index, double> > v_binned;
+      std::vector<unsigned int> bin_offsets;
+      v.binary_binning(norm_v, q, v_binned, bin_offsets);
 
       const double theta = 0.5;
       // setup the segments v_{[0]},...,v_{[\ell]},
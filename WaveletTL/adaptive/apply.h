@@ -19,6 +19,36 @@ namespace WaveletTL
 {
     using MathTL::InfiniteVector;
 
+  /*!
+    accumulation of the result in APPLY and APPLY_QUARKLET:
+    - dense_accumulation: the columns of A are added into a Vector<double> of length
+      degrees_of_freedom(), which is scanned completely afterwards,
+    - sparse_accumulation: the columns of A are added into a SparseAccumulator<double>,
+      the cost does not depend on degrees_of_freedom() but only on the number of
+      entries written (recommended for large jmax and small v).
+    The sparse variant is only used if the problem class supports it
+    (cf. SparseAccumulationTraits in compression.h), otherwise and with PARALLEL_APPLY==1,
+    the dense vector is used.
+  */
+  enum ApplyAccumulation {
+    dense_accumulation,
+    sparse_accumulation
+  };
+
+  /*!
+    read/write access to the accumulation used by APPLY and APPLY_QUARKLET,
+    the default can be set at compile time with APPLY_SPARSE_ACCUMULATION==1
+  */
+  inline ApplyAccumulation& apply_accumulation()
+  {
+#if APPLY_SPARSE_ACCUMULATION==1
+    static ApplyAccumulation accumulation(sparse_accumulation);
+#else
+    static ApplyAccumulation accumulation(dense_accumulation);
+#endif
+    return accumulation;
+  }
+
   /*!
     Apply the stiffness matrix A of an infinite-dimensional equation
 
@@ -63,6 +93,14 @@ namespace WaveletTL
 	     const CompressionStrategy strategy = St04a);
   
   
+  /*!
+    APPLY for quarklet frames.
+    With PARALLEL_APPLY==1, the columns are processed by NUM_THREADS threads,
+    each accumulating into its own buffer, which is sparse if the problem class
+    supports it (cf. apply_quarklet_parallel() in apply.cpp).
+    If PARALLEL_APPLY_DETERMINISTIC==1 in addition, the result does not depend
+    on the scheduling of the threads.
+  */
   template <class PROBLEM>
   void APPLY_QUARKLET(const PROBLEM& P,
 	     const InfiniteVector<double, typename PROBLEM::Index>& v,
@@ -3,186 +3,213 @@
 namespace WaveletTL
 {
     template <class PROBLEM>
-    void APPLY_TENSOR(PROBLEM& P,
+    bool apply_tensor_radii(const PROBLEM& P,
             const InfiniteVector<double, typename PROBLEM::Index>& v,
             const double eta,
-            InfiniteVector<double, typename PROBLEM::Index>& w,
-            const int jmax,
-            const CompressionStrategy strategy,
-            const bool preconditioning)
+            double& norm_v,
+            Array1D<int>& jp_tilde)
     {
-        // Remark: Remark from APPLY applies here as well, since binary binning part is the similar.
-        // linfty norm is used, resulting in the Factor 2 for p.
-        
         typedef typename PROBLEM::Index Index;
-        w.clear();
-        if (v.size() > 0) 
-        {
-            // compute the number of bins V_0,...,V_q
-            const double norm_v = linfty_norm(v);         
-#if _APPLY_TENSOR_DEBUGMODE == 1
-            if (norm_v > 1e+10)
-            {
-                cout << "APPLY_TENSOR (Index):: l_infty norm of v is too high!"<<endl;
-                cout << "v = " << v << endl;
-            }
-#endif
-            // Explicit sorting into bins is not necessary!
-            // We may compute the bin number, norm of all entries in the bins, and number of entries in each bin non the less.
-            // this enables us to compute the j_p in [DSS]
-            
-            // Theory: The i-th bin contains the entries of v with modulus in the interval
-            // (2^{-(i+1)/2}||v||_\infty,2^{-i/2}||v||_\infty], 0 <= i <= q-1, the remaining elements (with even smaller modulus)
-            // are collected in the q-th bin.
-            // q is chosen s.t. elements not in any bin have norm <= threshold (= eta/(2*norm_A))
-            // The entries not in any bin are discarded.
-            const double norm_A = P.norm_A();
-            double threshold = eta/2.0/norm_A;
-            //const unsigned int q = (unsigned int) std::max(2*ceil(log(sqrt((double)v.size())*norm_v*norm_A*2.0/eta)/M_LN2), 0.);
-            const unsigned int q = std::max ((unsigned int)1, 2*log2( (unsigned int) std::max(1, (int) ceil (sqrt(v.size())*norm_v/threshold) ) ) );
+        // compute the number of bins V_0,...,V_q
+        norm_v = linfty_norm(v);         
 #if _APPLY_TENSOR_DEBUGMODE == 1
-            assert (q == (unsigned int) std::max(2*ceil(log(sqrt((double)v.size())*norm_v*norm_A*2.0/eta)/M_LN2), 0.) );
+        if (norm_v > 1e+10)
+        {
+            cout << "APPLY_TENSOR (Index):: l_infty norm of v is too high!"<<endl;
+            cout << "v = " << v << endl;
+        }
 #endif
-            Array1D<double> bin_norm_sqr(q); //square norm of the coeffs in the bins
-            Array1D<int> bin_size(q); // number of entries in each bin
-            // the bin number corresponding to an entry of v is computed twice in this code. storing it into an InfiniteVector is probably not faster
-            //InfiniteVector<int, typename PROBLEM::Index> bin_number; // for each entry of v: store its bin - so the binnumber has to be computed only once - may be unnecessary
+        // Explicit sorting into bins is not necessary!
+        // We may compute the bin number, norm of all entries in the bins, and number of entries in each bin non the less.
+        // this enables us to compute the j_p in [DSS]
+        
+        // Theory: The i-th bin contains the entries of v with modulus in the interval
+        // (2^{-(i+1)/2}||v||_\infty,2^{-i/2}||v||_\infty], 0 <= i <= q-1, the remaining elements (with even smaller modulus)
+        // are collected in the q-th bin.
+        // q is chosen s.t. elements not in any bin have norm <= threshold (= eta/(2*norm_A))
+        // The entries not in any bin are discarded.
+        const double norm_A = P.norm_A();
+        double threshold = eta/2.0/norm_A;
+        //const unsigned int q = (unsigned int) std::max(2*ceil(log(sqrt((double)v.size())*norm_v*norm_A*2.0/eta)/M_LN2), 0.);
+        const unsigned int q = std::max ((unsigned int)1, 2*log2( (unsigned int) std::max(1, (int) ceil (sqrt(v.size())*norm_v/threshold) ) ) );
 #if _APPLY_TENSOR_DEBUGMODE == 1
-            for (unsigned int i=0; i< q;++i)
-            {
-                assert (bin_norm_sqr[i] == 0);
-                assert (bin_size[i] == 0);
-            }
+        assert (q == (unsigned int) std::max(2*ceil(log(sqrt((double)v.size())*norm_v*norm_A*2.0/eta)/M_LN2), 0.) );
 #endif
+        Array1D<double> bin_norm_sqr(q); //square norm of the coeffs in the bins
+        Array1D<int> bin_size(q); // number of entries in each bin
+        // the bin number corresponding to an entry of v is computed twice in this code. storing it into an InfiniteVector is probably not faster
+        //InfiniteVector<int, typename PROBLEM::Index> bin_number; // for each entry of v: store its bin - so the binnumber has to be computed only once - may be unnecessary
+        // Array1D does not initialize built-in types
+        for (unsigned int i=0; i< q;++i)
+        {
+            bin_norm_sqr[i] = 0;
+            bin_size[i] = 0;
+        }
+        {
+            unsigned int temp_i;
+            for (typename InfiniteVector<double,Index>::const_iterator it(v.begin());it != v.end(); ++it)
             {
-                unsigned int temp_i;
-                for (typename InfiniteVector<double,Index>::const_iterator it(v.begin());it != v.end(); ++it)
-                {
-                    //const unsigned int i = std::min(q, (unsigned int)floor(-2*log(fabs(*it)/norm_v)/M_LN2));
-                    //i = std::min(q, (unsigned int)floor(-2*log(fabs(*it)/norm_v)/M_LN2));
-                    //temp_i = std::min(q, 2*floor(log2(floor(norm_v/fabs(*it)))) );
+                //const unsigned int i = std::min(q, (unsigned int)floor(-2*log(fabs(*it)/norm_v)/M_LN2));
+                //i = std::min(q, (unsigned int)floor(-2*log(fabs(*it)/norm_v)/M_LN2));
+                //temp_i = std::min(q, 2*floor(log2(floor(norm_v/fabs(*it)))) );
 #if _APPLY_TENSOR_DEBUGMODE == 1
-                    assert (std::min(q, 2*floor(log2(floor(norm_v/fabs(*it)))) ) = std::min(q, (unsigned int)floor(-2*log(fabs(*it)/norm_v)/M_LN2)));
+                assert (std::min(q, 2*floor(log2(floor(norm_v/fabs(*it)))) ) = std::min(q, (unsigned int)floor(-2*log(fabs(*it)/norm_v)/M_LN2)));
 #endif
-                    temp_i = 2*log2(floor(norm_v/fabs(*it))) -1; // bins: 1,...,q but observe temp_i: 0,...,q-1
-                    if (temp_i < q)
-                    {
-                        //bins[i].push_back(std::make_pair(it.index(), *it));
-                        bin_norm_sqr[temp_i] += (*it)*(*it);
-                        bin_size[temp_i] += 1;
-                    }
+                temp_i = (unsigned int)floor(2*log(norm_v/fabs(*it))/M_LN2); // bins: 1,...,q but observe temp_i: 0,...,q-1
+                if (temp_i < q)
+                {
+                    //bins[i].push_back(std::make_pair(it.index(), *it));
+                    bin_norm_sqr[temp_i] += (*it)*(*it);
+                    bin_size[temp_i] += 1;
                 }
-            } // end of sorting into bins
-            
-            // In difference to the isotropic APPLY we use the bins directly as the segments v_{[0]},...,v_{[\ell]}.
-            // [DSS]: compute smallest \ell such that
-            //   ||v-\sum_{k=0}^\ell v_{[k]}|| <= threshold
-            // i.e.
-            //   ||v-\sum_{k=0}^\ell v_{[k]}||^2 <= threshold^2,
-            // where threshold = eta * theta / ||A||, theta = 1/2
-            threshold = threshold*threshold;
-            double delta(l2_norm_sqr(v));
-            //double bound = temp_d - threshold;
-            unsigned int ell=0, num_of_relevant_entries(0); // number of bins needed to approximate v; number_of_coeffs in the first ell buckets
-            if (delta <= threshold)
-            {
-                // v is well approximated by 0
-                return;
             }
-            else
+        } // end of sorting into bins
+        
+        // In difference to the isotropic APPLY we use the bins directly as the segments v_{[0]},...,v_{[\ell]}.
+        // [DSS]: compute smallest \ell such that
+        //   ||v-\sum_{k=0}^\ell v_{[k]}|| <= threshold
+        // i.e.
+        //   ||v-\sum_{k=0}^\ell v_{[k]}||^2 <= threshold^2,
+        // where threshold = eta * theta / ||A||, theta = 1/2
+        threshold = threshold*threshold;
+        double delta(l2_norm_sqr(v));
+        //double bound = temp_d - threshold;
+        unsigned int ell=0, num_of_relevant_entries(0); // number of bins needed to approximate v; number_of_coeffs in the first ell buckets
+        if (delta <= threshold)
+        {
+            // v is well approximated by 0
+            return false;
+        }
+        else
+        {
+            while (delta > threshold)
             {
-                while (delta > threshold)
+                num_of_relevant_entries += bin_size[ell];
+                delta -= bin_norm_sqr[ell];
+                //bound -= bin_norm_sqr[ell];
+                ell++;
+                if (ell >= q)
                 {
-                    num_of_relevant_entries += bin_size[ell];
-                    delta -= bin_norm_sqr[ell];
-                    //bound -= bin_norm_sqr[ell];
-                    ell++;
-                    if (ell > q)
-                    {
-                        break;
-                    }
+                    break;
                 }
             }
-            // we need buckets 0,...,ell-1
-            
-            
+            if (delta < 0)
+            {
+                delta = 0;
+            }
+        }
+        // we need buckets 0,...,ell-1
+        
+        
 #if 0 // compute ell in a different way to check validity of code. needs explicit computation of bins
-            double bound = l2_norm_sqr(v) - threshold;
-            //double error_sqr = l2_norm_sqr(v);
-            double new_norm_sqr(0);
-            //Array1D<double> bin_norm_sqr(q+1); //square norm of the coeffs in the bins
-            unsigned int ell2(0);
-            unsigned int num_relevant_entries=0;
-            if (l2_norm_sqr(v) > threshold)
+        double bound = l2_norm_sqr(v) - threshold;
+        //double error_sqr = l2_norm_sqr(v);
+        double new_norm_sqr(0);
+        //Array1D<double> bin_norm_sqr(q+1); //square norm of the coeffs in the bins
+        unsigned int ell2(0);
+        unsigned int num_relevant_entries=0;
+        if (l2_norm_sqr(v) > threshold)
+        {
+            unsigned int vsize = v.size();
+            while (true)
             {
-                unsigned int vsize = v.size();
-                while (true)
+                bin_norm_sqr[ell2]=0;
+                for (typename std::list<std::pair<Index, double> >::const_iterator it(bins[ell].begin()), itend(bins[ell].end()); it != itend; ++it)
                 {
-                    bin_norm_sqr[ell2]=0;
-                    for (typename std::list<std::pair<Index, double> >::const_iterator it(bins[ell].begin()), itend(bins[ell].end()); it != itend; ++it)
-                    {
-                        bin_norm_sqr[ell] += (it->second) * (it->second);
-                        //num_relevant_entries++;
-                    }
-                    if (bin_norm_sqr[ell2] < 1e-15 && bins[ell2].size() > 0) // this bin contains only very small coefs. Thus it and all later bins are not of any importance
-                    {
-                        //error_sqr = threshold; // we are near the machine limit
-                        if (ell2 > 0)
-                        {
-                            --ell2;
-                        }
-                        break;
-                    }
-                    num_relevant_entries += bins[ell2].size();
-                    new_norm_sqr += bin_norm_sqr[ell2];
-                    //error_sqr -= bin_norm_sqr[ell2];
-                    if (new_norm_sqr >= bound)
-                        //if (error_sqr <= threshold)
-                    {
-                        break;
-                    }
-                    else if (num_relevant_entries == vsize)
-                    {
-                        //error_sqr = 0;
-                        break;
-                    }
-                    else
+                    bin_norm_sqr[ell] += (it->second) * (it->second);
+                    //num_relevant_entries++;
+                }
+                if (bin_norm_sqr[ell2] < 1e-15 && bins[ell2].size() > 0) // this bin contains only very small coefs. Thus it and all later bins are not of any importance
+                {
+                    //error_sqr = threshold; // we are near the machine limit
+                    if (ell2 > 0)
                     {
-                        ell2++;
+                        --ell2;
                     }
+                    break;
+                }
+                num_relevant_entries += bins[ell2].size();
+                new_norm_sqr += bin_norm_sqr[ell2];
+                //error_sqr -= bin_norm_sqr[ell2];
+                if (new_norm_sqr >= bound)
+                    //if (error_sqr <= threshold)
+                {
+                    break;
+                }
+                else if (num_relevant_entries == vsize)
+                {
+                    //error_sqr = 0;
+                    break;
+                }
+                else
+                {
+                    ell2++;
                 }
             }
-            assert (ell == ell2);
+        }
+        assert (ell == ell2);
 #endif
-            // Compute z = \sum_{p=0}^ell A^{jp}v_{[p]},
-            // where A^{(jp)} is the optimal approximation matrix for each bin.
-            // Optimality is meant in the sense that the computational effort is minimal and the error bound is met.
-            // The computation is tailored for biorthogonal anisotropical wavelets:
-            // A^{jp} has C*jp^dim nontrivial entries per row/column which need C*jp^dim many operations to be computed, further
-            // \| A -A^{jp} \| \leq D 2^{-\rho jp} (A is compressible with s* = \infty)
-            // jp is computed such that effort for apply is minimal, i.e.,
-            // \sum _{p=0}^ell C*jp^dim * bin_size[p] -> minimal,
-            // under the error bound condition
-            // \sum_{p=0}^ell D*s^{-\rho jp} \|v_p\|_2 \leq eta-delta,
-            // where rho < 1/2 is the compressibility of A (valid for biorthogonl anisotropical wavelets)
-            // eta is the target accuracy of APPLY,
-            // delta = \|A\|\|v - \sum_{p=1}^\ell v_p\|_2 (<= eta/2)
-            delta = sqrt(delta) * norm_A;
-            assert (delta <= eta/2);
-            // we use the formula for jp tilde from [DSS] for orthogonal wavelets, i.e., effort C*jp^1.
-            // effect: error \eta-\delta is met, but effort may be suboptimal
-            // => with D = P.alphak(p)
-            //jp_tilde = ceil (log(sqrt(bin_norm_sqr[p])*num_relevant_entries*P.alphak(p)/(bin_size[p]*(eta-delta)))/M_LN2 );
-            
-            Array1D<int> jp_tilde(ell);
-            for (unsigned int i = 0; i < ell; ++i)
+        // Compute z = \sum_{p=0}^ell A^{jp}v_{[p]},
+        // where A^{(jp)} is the optimal approximation matrix for each bin.
+        // Optimality is meant in the sense that the computational effort is minimal and the error bound is met.
+        // The computation is tailored for biorthogonal anisotropical wavelets:
+        // A^{jp} has C*jp^dim nontrivial entries per row/column which need C*jp^dim many operations to be computed, further
+        // \| A -A^{jp} \| \leq D 2^{-\rho jp} (A is compressible with s* = \infty)
+        // jp is computed such that effort for apply is minimal, i.e.,
+        // \sum _{p=0}^ell C*jp^dim * bin_size[p] -> minimal,
+        // under the error bound condition
+        // \sum_{p=0}^ell D*s^{-\rho jp} \|v_p\|_2 \leq eta-delta,
+        // where rho < 1/2 is the compressibility of A (valid for biorthogonl anisotropical wavelets)
+        // eta is the target accuracy of APPLY,
+        // delta = \|A\|\|v - \sum_{p=1}^\ell v_p\|_2 (<= eta/2)
+        delta = sqrt(delta) * norm_A;
+        assert (delta <= eta/2);
+        // we use the formula for jp tilde from [DSS] for orthogonal wavelets, i.e., effort C*jp^1.
+        // effect: error \eta-\delta is met, but effort may be suboptimal
+        // => with D = P.alphak(p)
+        //jp_tilde = ceil (log(sqrt(bin_norm_sqr[p])*num_relevant_entries*P.alphak(p)/(bin_size[p]*(eta-delta)))/M_LN2 );
+        
+        jp_tilde.resize(ell);
+        for (unsigned int i = 0; i < ell; ++i)
+        {
+            //jp_tilde[i] = ceil (log(sqrt(bin_norm_sqr[i])*num_of_relevant_entries*P.alphak(i)/(bin_size[i]*(eta-delta)))/M_LN2 ); 
+            if (bin_size[i] > 0)
             {
-                //jp_tilde[i] = ceil (log(sqrt(bin_norm_sqr[i])*num_of_relevant_entries*P.alphak(i)/(bin_size[i]*(eta-delta)))/M_LN2 ); 
-                jp_tilde[i] = ceil (log2(ceil (sqrt(bin_norm_sqr[i]) * num_of_relevant_entries * P.alphak(i) / (bin_size[i]*(eta-delta))))  );
-#if _APPLY_TENSOR_DEBUGMODE == 1
-                assert (jp_tilde[i] ==  ceil (log(sqrt(bin_norm_sqr[i])*num_of_relevant_entries*P.alphak(i)/(bin_size[i]*(eta-delta)))/M_LN2 ) );
-#endif
+                jp_tilde[i] = (int)ceil (log(sqrt(bin_norm_sqr[i]) * num_of_relevant_entries * P.alphak(i) / (bin_size[i]*(eta-delta))) / M_LN2 );
+            }
+            else
+            {
+                jp_tilde[i] = 0;
             }
+        }
+        return true;
+    }
+
+    template <class PROBLEM>
+    void APPLY_TENSOR(PROBLEM& P,
+            const InfiniteVector<double, typename PROBLEM::Index>& v,
+            const double eta,
+            InfiniteVector<double, typename PROBLEM::Index>& w,
+            const int jmax,
+            const CompressionStrategy strategy,
+            const bool preconditioning)
+    {
+        // Remark: Remark from APPLY applies here as well, since binary binning part is the similar.
+        // linfty norm is used, resulting in the Factor 2 for p.
+        
+        typedef typename PROBLEM::Index Index;
+        w.clear();
+        if (v.size() > 0) 
+        {
+            double norm_v;
+            Array1D<int> jp_tilde;
+            if (!apply_tensor_radii(P, v, eta, norm_v, jp_tilde))
+            {
+                // v is well approximated by 0
+                return;
+            }
+            const unsigned int ell = jp_tilde.size();
+
             // hack: We work with full vectors (of size degrees_of_freedom).
             // We do this because adding sparse vectors seems to be inefficient.
             // Below we will then copy ww into the sparse vector w.
@@ -193,13 +220,12 @@ namespace WaveletTL
             // compute w = \sum_{k=0}^\ell A_{J-k}v_{[k]}
             for (typename InfiniteVector<double,Index>::const_iterator it(v.begin()), itend(v.end());it != itend; ++it)
             {
-#if _APPLY_TENSOR_DEBUGMODE == 1
-                assert ( (2*log2(floor(norm_v/fabs(*it))) -1) >= 0 );
-                assert ( (2*log2(floor(norm_v/fabs(*it))) -1) < ell );
-#endif
-                //temp_i = 2*log2(floor(norm_v/fabs(*it))) -1
                 //add_compressed_column_tensor(P, *it, it, jp_tilde[2*log2(floor(norm_v/fabs(*it))) -1], ww, jmax, strategy, preconditioning);
-                P.add_ball(it.index(),ww,jp_tilde[2*log2(floor(norm_v/fabs(*it))) -1],*it,jmax,strategy,preconditioning);
+                const unsigned int temp_i = (unsigned int)floor(2*log(norm_v/fabs(*it))/M_LN2);
+                if (temp_i < ell)
+                {
+                    P.add_ball(it.index(),ww,jp_tilde[temp_i],*it,jmax,strategy,preconditioning);
+                }
             }
             // copy ww into w
             for (unsigned int i = 0; i < ww.size(); i++) 
@@ -491,4 +517,162 @@ namespace WaveletTL
         }
     }    
 
+    template <class PROBLEM>
+    void APPLY_TENSOR_KRONECKER(PROBLEM& P,
+            const InfiniteVector<double, typename PROBLEM::Index>& v,
+            const double eta,
+            InfiniteVector<double, typename PROBLEM::Index>& w,
+            const int jmax,
+            const bool preconditioning)
+    {
+        typedef typename PROBLEM::Index Index;
+        typedef typename PROBLEM::WaveletBasis::IntervalBasis IBASIS;
+        typedef typename IBASIS::Index Index1D;
+        const unsigned int DIM = PROBLEM::space_dimension;
+
+        double a, q;
+        if (!P.kronecker_coefficients(a, q))
+        {
+            // no Kronecker structure, use the entrywise version
+            APPLY_TENSOR(P, v, eta, w, jmax, tensor_simple, preconditioning);
+            return;
+        }
+
+        w.clear();
+        if (v.size() == 0) return;
+
+        // the same segments and compression radii as in APPLY_TENSOR
+        double norm_v;
+        Array1D<int> jp_tilde;
+        if (!apply_tensor_radii(P, v, eta, norm_v, jp_tilde))
+        {
+            // v is well approximated by 0
+            return;
+        }
+        const unsigned int ell = jp_tilde.size();
+
+        const typename PROBLEM::WaveletBasis& basis(P.basis());
+        const typename Index::level_type j0(basis.j0());
+        const int maxlevel = std::min(jmax, (int)basis.get_jmax());
+
+        // The current (intermediate) vector is indexed by the numbers of the 1D indices in each
+        // direction and the remaining radius of the level ball, cf. add_level_recurse().
+        // For each of the DIM+1 Kronecker products, the partial product is stored,
+        // entry i belongs to the term with S_i, entry DIM to the term q*M x ... x M.
+        typedef MultiIndex<int,DIM+1> Key;
+        typedef FixedVector<double,DIM+1> Values;
+        typedef std::map<Key,Values> IntermediateVector;
+        IntermediateVector current, next;
+
+        double mass, stiffness;
+        FixedArray1D<Index1D,DIM> lambda1d;
+        for (typename InfiniteVector<double,Index>::const_iterator it(v.begin()), itend(v.end()); it != itend; ++it)
+        {
+            const unsigned int temp_i = (unsigned int)floor(2*log(norm_v/fabs(*it))/M_LN2);
+            if (temp_i >= ell || jp_tilde[temp_i] < 0) continue;
+
+            Key key;
+            for (unsigned int i = 0; i < DIM; i++)
+            {
+                lambda1d[i] = Index1D(it.index().j()[i], it.index().e()[i], it.index().k()[i], basis.bases()[i]);
+                key[i] = lambda1d[i].number();
+            }
+            key[DIM] = jp_tilde[temp_i];
+
+            double value = *it;
+            if (preconditioning)
+                value /= apply_tensor_kronecker_diagonal(P, lambda1d, a, q);
+            Values& values(current[key]);
+            for (unsigned int t = 0; t <= DIM; t++)
+                values[t] += value;
+        }
+
+        // apply the 1D matrices along each direction, only the entries with
+        // level in the ball around the level of the column are computed
+        std::list<Index1D> targets, wavelets;
+        for (unsigned int i = 0; i < DIM; i++)
+        {
+            for (typename IntermediateVector::const_iterator it(current.begin()), itend(current.end()); it != itend; ++it)
+            {
+                const Index1D lambda(it->first[i], basis.bases()[i]);
+                const int radius = it->first[DIM];
+
+                // the levels in the directions 0,...,i-1 are final, in the directions i+1,...,DIM-1
+                // they cannot drop below j0
+                int level_sum = 0;
+                for (unsigned int k = 0; k < i; k++)
+                    level_sum += Index1D(it->first[k], basis.bases()[k]).j();
+                for (unsigned int k = i+1; k < DIM; k++)
+                    level_sum += j0[k];
+
+                for (int level = std::max(j0[i], lambda.j()-radius);
+                     level <= lambda.j()+radius && level_sum+level <= maxlevel; level++)
+                {
+                    intersecting_wavelets(*basis.bases()[i], lambda, level, level == j0[i], targets);
+                    if (level == j0[i])
+                    {
+                        // the level j0 contains the generators and the wavelets
+                        intersecting_wavelets(*basis.bases()[i], lambda, level, false, wavelets);
+                        targets.splice(targets.end(), wavelets);
+                    }
+                    Key key(it->first);
+                    key[DIM] = radius - abs(level-lambda.j());
+                    for (typename std::list<Index1D>::const_iterator mu(targets.begin()), muend(targets.end()); mu != muend; ++mu)
+                    {
+                        P.integrals_1D(i, *mu, lambda, mass, stiffness);
+                        if (mass == 0. && stiffness == 0.) continue;
+                        key[i] = mu->number();
+                        Values& values(next[key]);
+                        for (unsigned int t = 0; t <= DIM; t++)
+                            values[t] += (t == i ? stiffness : mass) * it->second[t];
+                    }
+                }
+            }
+            current.swap(next);
+            next.clear();
+        }
+
+        // sum up the Kronecker products
+        typename Index::level_type j, e, k;
+        for (typename IntermediateVector::const_iterator it(current.begin()), itend(current.end()); it != itend; ++it)
+        {
+            for (unsigned int i = 0; i < DIM; i++)
+            {
+                lambda1d[i] = Index1D(it->first[i], basis.bases()[i]);
+                j[i] = lambda1d[i].j();
+                e[i] = lambda1d[i].e();
+                k[i] = lambda1d[i].k();
+            }
+            double value = q * it->second[DIM];
+            for (unsigned int i = 0; i < DIM; i++)
+                value += a * it->second[i];
+            if (value == 0.) continue;
+            if (preconditioning)
+                value /= apply_tensor_kronecker_diagonal(P, lambda1d, a, q);
+            w.add_coefficient(Index(j, e, k, &basis), value);
+        }
+    }
+
+    template <class PROBLEM, class INDEX1D, unsigned int DIM>
+    double apply_tensor_kronecker_diagonal(const PROBLEM& P,
+            const FixedArray1D<INDEX1D,DIM>& lambda,
+            const double a,
+            const double q)
+    {
+        // D(lambda)^2 = a(lambda,lambda) = a * \sum_i (S_i)_{lambda,lambda} \prod_{k\neq i} (M_k)_{lambda,lambda}
+        //                                + q * \prod_k (M_k)_{lambda,lambda}
+        FixedArray1D<double,DIM> mass, stiffness;
+        for (unsigned int i = 0; i < DIM; i++)
+            P.integrals_1D(i, lambda[i], lambda[i], mass[i], stiffness[i]);
+        double r = 0, product = 1;
+        for (unsigned int i = 0; i < DIM; i++)
+        {
+            double share = stiffness[i];
+            for (unsigned int k = 0; k < DIM; k++)
+                if (k != i) share *= mass[k];
+            r += a * share;
+            product *= mass[i];
+        }
+        return sqrt(r + q * product);
+    }
 }
@@ -14,6 +14,9 @@
 #include <adaptive/compression.h>
 #include <utils/array1d.h>
 #include <utils/tiny_tools.h>
+#include <utils/fixed_array1d.h>
+#include <utils/multiindex.h>
+#include <algebra/fixed_vector.h>
 
 #include <iostream>
 #include <list>
@@ -22,6 +25,9 @@
 #include <algorithm>
 
 using MathTL::Array1D;
+using MathTL::FixedArray1D;
+using MathTL::FixedVector;
+using MathTL::MultiIndex;
 
 
 namespace WaveletTL
@@ -95,6 +101,57 @@ namespace WaveletTL
           const CompressionStrategy strategy = tensor_simple,
           const bool preconditioning = true);
 
+  /*
+   * Variant of APPLY_TENSOR for operators which are a short sum of Kronecker products of
+   * 1D matrices, like -div(a grad u)+qu with constant coefficients on TensorBasis, cf.
+   * TensorEquation::kronecker_coefficients(). PROBLEM has to provide the routines
+   *
+   *   bool kronecker_coefficients(double& a, double& q) const
+   *   void integrals_1D(const unsigned int i, const Index1D& lambda, const Index1D& mu,
+   *                     double& mass, double& stiffness) const
+   *
+   * If there is no Kronecker structure, APPLY_TENSOR is called.
+   *
+   * The segments of v and the radii of the level balls are the same as in APPLY_TENSOR,
+   * so w consists of the same entries of Av and the same error bound holds.
+   * Instead of computing each entry of a column by itself, the 1D matrices are applied
+   * along each direction one after the other (sum factorization), see
+   * [KS] Kestler, Stevenson: Fast evaluation of system matrices w.r.t. multi-tree collections
+   *      of tensor product refinable basis functions.
+   * Neighbouring columns share the intermediate results, so that for dense parts of v
+   * the cost per entry grows like DIM*C instead of C^DIM (C: 1D entries per column and level).
+   * Only the 1D integrals are cached, no entries of A.
+   */
+  template <class PROBLEM>
+  void APPLY_TENSOR_KRONECKER(PROBLEM& P,
+          const InfiniteVector<double, typename PROBLEM::Index>& v,
+          const double eta,
+          InfiniteVector<double, typename PROBLEM::Index>& w,
+          const int jmax = 99,
+          const bool preconditioning = true);
+
+  /*
+   * Binning of APPLY_TENSOR: compute ||v||_infty and the radii jp_tilde of the level balls
+   * for the segments of v (the segment of an entry is floor(2*log2(||v||_infty/|v_lambda|))).
+   * Returns false if v is well approximated by 0.
+   */
+  template <class PROBLEM>
+  bool apply_tensor_radii(const PROBLEM& P,
+          const InfiniteVector<double, typename PROBLEM::Index>& v,
+          const double eta,
+          double& norm_v,
+          Array1D<int>& jp_tilde);
+
+  /*
+   * diagonal preconditioner sqrt(a(lambda,lambda)) of an operator with Kronecker structure,
+   * lambda given by its 1D components
+   */
+  template <class PROBLEM, class INDEX1D, unsigned int DIM>
+  double apply_tensor_kronecker_diagonal(const PROBLEM& P,
+          const FixedArray1D<INDEX1D,DIM>& lambda,
+          const double a,
+          const double q);
+
 }
 
 #include <adaptive/apply_tensor.cpp>
@@ -270,7 +270,9 @@ namespace WaveletTL
     {
         set<INDEX> Lambda_k(Lambda), Lambda_kplus1;
         unsigned int k = 0;
-        GALERKIN(P, params, F, Lambda_k, v, delta, params.q3*delta/params.c2, u_Lambda_k, jmax, strategy);
+        // the Galerkin matrices for the growing index sets Lambda_k are set up incrementally
+        StiffnessMatrixCache<INDEX> stiffness;
+        GALERKIN(P, params, F, Lambda_k, v, delta, params.q3*delta/params.c2, u_Lambda_k, jmax, strategy, &stiffness);
         while (true) 
         {
             logger.checkAbortConditions();
@@ -286,7 +288,7 @@ namespace WaveletTL
               v_hat.support(Lambda_hat);
               break;
             }
-            GALERKIN(P, params, F, Lambda_kplus1, u_Lambda_k, params.q0*delta, params.q3*delta/params.c2, v_hat, jmax, strategy);
+            GALERKIN(P, params, F, Lambda_kplus1, u_Lambda_k, params.q0*delta, params.q3*delta/params.c2, v_hat, jmax, strategy, &stiffness);
             u_Lambda_k.swap(v_hat);
 #if _WAVELETTL_CDD1_VERBOSITY >= 2
             cout << "u_Lambda_k = " << endl << u_Lambda_k << endl;
@@ -309,7 +311,8 @@ namespace WaveletTL
             const double eta,
             InfiniteVector<double, INDEX>& u_bar,
             const int jmax,
-            const CompressionStrategy strategy)
+            const CompressionStrategy strategy,
+            StiffnessMatrixCache<INDEX>* stiffness)
     {
 #if 0
         // original GALERKIN version from [CDD1],[BB+]
@@ -349,9 +352,13 @@ namespace WaveletTL
         u_bar.clear();
         if (Lambda.size() > 0) 
         {
-            // setup A_Lambda and f_Lambda
-            SparseMatrix<double> A_Lambda;
-            setup_stiffness_matrix(P, Lambda, A_Lambda);
+            // setup A_Lambda (reusing the previous Galerkin matrix, if available) and f_Lambda
+            SparseMatrix<double> A_Lambda_local;
+            if (stiffness)
+                setup_stiffness_matrix(P, Lambda, *stiffness);
+            else
+                setup_stiffness_matrix(P, Lambda, A_Lambda_local);
+            const SparseMatrix<double>& A_Lambda(stiffness ? stiffness->A : A_Lambda_local);
 #if _WAVELETTL_CDD1_VERBOSITY >= 2
             cout << "... GALERKIN: A_Lambda=" << endl << A_Lambda;
 #endif
@@ -367,8 +374,10 @@ namespace WaveletTL
                     it != itend; ++it, ++id)
                 xk[id] = v.get_coefficient(*it);
             unsigned int iterations = 0;
-            //       CG(A_Lambda, F_Lambda, xk, eta, 150, iterations);
-            CG(A_Lambda, F_Lambda, xk, 1e-15, 250, iterations);
+            // the CG iteration runs on the contiguous CSR copy of A_Lambda
+            const CSRMatrix<double> A_Lambda_csr(A_Lambda);
+            //       CG(A_Lambda_csr, F_Lambda, xk, eta, 150, iterations);
+            CG(A_Lambda_csr, F_Lambda, xk, 1e-15, 250, iterations);
 #if _WAVELETTL_CDD1_VERBOSITY >= 1
             cout << "... GALERKIN done, " << iterations << " CG iterations needed" << endl;
 #endif
@@ -18,6 +18,8 @@
 #include <algorithm>
 
 #include <algebra/sparse_matrix.h>
+#include <algebra/csr_matrix.h>
+#include <galerkin/galerkin_utils.h>
 #include <algebra/vector.h>
 #include <numerics/iteratsolv.h>
 #if _WAVELETTL_USE_TBASIS == 1
@@ -32,6 +34,7 @@ using std::set;
 using std::cout;
 using std::endl;
 using MathTL::SparseMatrix;
+using MathTL::CSRMatrix;
 using MathTL::Vector;
 using MathTL::CG;
 
@@ -245,6 +248,8 @@ namespace WaveletTL
       index set Lambda, such that ||u_Lambda-v||_2 <= delta, and a target accuracy eta,
       compute an approximation u_bar to u_Lambda which is supported on Lambda and satisfies
       ||u_bar-u_Lambda||_2 <= eta.
+      If a stiffness matrix cache is given, the Galerkin matrix of the previous call is
+      updated instead of being set up from scratch (see update_stiffness_matrix()).
     */
     template <class PROBLEM, typename INDEX>
     void GALERKIN(PROBLEM& P, const CDD1Parameters& params,
@@ -255,7 +260,8 @@ namespace WaveletTL
                   const double eta,
                   InfiniteVector<double, INDEX>& ubar,
                   const int jmax = 99,
-                  const CompressionStrategy strategy = St04a);
+                  const CompressionStrategy strategy = St04a,
+                  StiffnessMatrixCache<INDEX>* stiffness = 0);
     
     
     /*!
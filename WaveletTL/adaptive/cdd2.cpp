@@ -32,34 +32,44 @@ namespace WaveletTL
   template <class PROBLEM>
   void CDD2_SOLVE(const PROBLEM& P, const double nu, const double epsilon,
                   InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& u_epsilon,
-                  const unsigned int maxlevel, CompressionStrategy strategy)
+                  const unsigned int maxlevel, CompressionStrategy strategy,
+                  SolverCheckpoint* checkpoint)
   {
     typedef typename PROBLEM::WaveletBasis::Index Index;
 
-    // compute optimal relaxation parameter omega
-    const double omega = 2.0 / (P.norm_A() + 1.0/P.norm_Ainv());
-    //const double omega = 0.2;
-    cout << "CDD2_SOLVE: omega=" << omega << endl;
-
-    // compute spectral norm rho
-    const double cond_A = P.norm_A() * P.norm_Ainv();
-    const double rho = (cond_A - 1.0) / (cond_A + 1.0);
-    cout << "CDD2_SOLVE: rho=" << rho << endl;
-
     // desired error reduction factor theta < 1/3
     //     const double theta = 2.0/7.0;
     const double theta = 0.333;
     cout << "CDD2_SOLVE: theta=" << theta << endl;
 
-    // compute minimal K such that 3*rho^K < theta
-    const int K = (int) ceil(log10(theta/3.0) / log10(rho));
-    cout << "CDD2_SOLVE: K=" << K << endl << endl;
-
-    u_epsilon.clear();
-    
-//    cout << "TEST_epsilon_k: " << 
+    double omega, rho, epsilon_k = nu, eta;
+    int K;
+    unsigned int iteration = 0;
+    Vector<double> parameters;
+    if (checkpoint && checkpoint->load(checkpoint_cdd2, P.basis(), iteration, parameters, u_epsilon)) {
+      // the tolerance schedule of the interrupted run, saves the computation of the norms
+      epsilon_k = parameters[0];
+      omega = parameters[1];
+      rho = parameters[2];
+      K = (int) parameters[3];
+    } else {
+      // compute optimal relaxation parameter omega
+      omega = 2.0 / (P.norm_A() + 1.0/P.norm_Ainv());
+      //const double omega = 0.2;
+      cout << "CDD2_SOLVE: omega=" << omega << endl;
+
+      // compute spectral norm rho
+      const double cond_A = P.norm_A() * P.norm_Ainv();
+      rho = (cond_A - 1.0) / (cond_A + 1.0);
+      cout << "CDD2_SOLVE: rho=" << rho << endl;
+
+      // compute minimal K such that 3*rho^K < theta
+      K = (int) ceil(log10(theta/3.0) / log10(rho));
+      cout << "CDD2_SOLVE: K=" << K << endl << endl;
+
+      u_epsilon.clear();
+    }
     
-    double epsilon_k = nu, eta;
         InfiniteVector<double,Index> f, v, Av, tempAv;
 #if _WAVELETTL_USE_TBASIS == 1
         Array1D<int> jp_guess(0);
@@ -114,7 +124,15 @@ namespace WaveletTL
       v.COARSE((1-theta)*epsilon_k, u_epsilon);
 //      v.COARSE(1.0e-6, u_epsilon);
       
-      
+      ++iteration;
+      if (checkpoint && checkpoint->due(iteration)) {
+        parameters.resize(4, false);
+        parameters[0] = epsilon_k;
+        parameters[1] = omega;
+        parameters[2] = rho;
+        parameters[3] = K;
+        checkpoint->save(checkpoint_cdd2, iteration, parameters, u_epsilon);
+      }
       
       
 //      cout << "f:" << endl<< f << endl;
@@ -131,30 +149,45 @@ namespace WaveletTL
   template <class PROBLEM>
     void CDD2_SOLVE(PROBLEM& P, const double nu, const double epsilon,
             InfiniteVector<double, int>& u_epsilon,
-            const unsigned int maxlevel)
+            const unsigned int maxlevel,
+            SolverCheckpoint* checkpoint)
     {
 //typedef typename PROBLEM::WaveletBasis::Index Index;
 
-        // compute optimal relaxation parameter omega
-        const double omega = 2.0 / (P.norm_A() + 1.0/P.norm_Ainv());
-        cout << "CDD2_SOLVE: omega=" << omega << endl;
-
-        // compute spectral norm rho
-        const double cond_A = P.norm_A() * P.norm_Ainv();
-        const double rho = (cond_A - 1.0) / (cond_A + 1.0);
-        cout << "CDD2_SOLVE: rho=" << rho << endl;
-
         // desired error reduction factor theta < 1/3
         const double theta = 0.333;
         cout << "CDD2_SOLVE: theta=" << theta << endl;
 
-        // compute minimal K such that 3*rho^K < theta
-        const int K = (int) ceil(log10(theta/3.0) / log10(rho));
-        cout << "CDD2_SOLVE: K=" << K << endl;
+        double omega, rho, epsilon_k = nu, eta;
+        int K;
+        unsigned int iteration = 0;
+        Vector<double> parameters;
+        if (checkpoint && checkpoint->load(checkpoint_cdd2, P.basis(), iteration, parameters, u_epsilon))
+        {
+            // the tolerance schedule of the interrupted run, saves the computation of the norms
+            epsilon_k = parameters[0];
+            omega = parameters[1];
+            rho = parameters[2];
+            K = (int) parameters[3];
+        }
+        else
+        {
+            // compute optimal relaxation parameter omega
+            omega = 2.0 / (P.norm_A() + 1.0/P.norm_Ainv());
+            cout << "CDD2_SOLVE: omega=" << omega << endl;
+
+            // compute spectral norm rho
+            const double cond_A = P.norm_A() * P.norm_Ainv();
+            rho = (cond_A - 1.0) / (cond_A + 1.0);
+            cout << "CDD2_SOLVE: rho=" << rho << endl;
+
+            // compute minimal K such that 3*rho^K < theta
+            K = (int) ceil(log10(theta/3.0) / log10(rho));
+            cout << "CDD2_SOLVE: K=" << K << endl;
 
-        u_epsilon.clear(); 
+            u_epsilon.clear(); 
+        }
         
-        double epsilon_k = nu, eta;
         InfiniteVector<double,int> f, v, Av;
         
 #if _WAVELETTL_USE_TBASIS == 1
@@ -190,6 +223,17 @@ namespace WaveletTL
             cout << "coarse tol = " << (1-theta)*epsilon_k << endl;
             v.COARSE(std::min((1-theta)*epsilon_k,1.0e-6), u_epsilon);
             cout << "CDD2:: v.size() = " << v.size() << endl;
+
+            ++iteration;
+            if (checkpoint && checkpoint->due(iteration))
+            {
+                parameters.resize(4, false);
+                parameters[0] = epsilon_k;
+                parameters[1] = omega;
+                parameters[2] = rho;
+                parameters[3] = K;
+                checkpoint->save(checkpoint_cdd2, iteration, parameters, u_epsilon);
+            }
         } 
     }
   
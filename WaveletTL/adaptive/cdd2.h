@@ -11,6 +11,7 @@
 #define _WAVELETTL_CDD2_H
 
 #include <algebra/infinite_vector.h>
+#include <adaptive/solver_checkpoint.h>
 
 namespace WaveletTL
 {
@@ -29,6 +30,10 @@ namespace WaveletTL
     The routine has to be given an estimate of ||u|| <= nu = epsilon_0, which may be
     computed beforehand like nu:=||A^{-1}||*||F||.
 
+    If a checkpoint is given, the iterate and the tolerance schedule are saved
+    after every checkpoint->interval() outer iterations, and the solver resumes
+    from an existing checkpoint file, see SolverCheckpoint.
+
     References:
     [CDD2] Cohen/Dahmen/DeVore,
            Adaptive Wavelet Methods II - Beyond the Elliptic Case
@@ -41,13 +46,15 @@ namespace WaveletTL
   template <class PROBLEM>
   void CDD2_SOLVE(const PROBLEM& P, const double nu, const double epsilon,
 		         InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& u_epsilon,
-                         const unsigned int maxlevel = 12, const CompressionStrategy strategy = CDD1);
+                         const unsigned int maxlevel = 12, const CompressionStrategy strategy = CDD1,
+                         SolverCheckpoint* checkpoint = 0);
                          
   /* same with int instead of Index */
   template <class PROBLEM>
   void CDD2_SOLVE(const PROBLEM& P, const double nu, const double epsilon,
 		         InfiniteVector<double, int>& u_epsilon,
-                         const unsigned int maxlevel = 12);
+                         const unsigned int maxlevel = 12,
+                         SolverCheckpoint* checkpoint = 0);
   
   template <class PROBLEM>
   void CDD2_QUARKLET_SOLVE(const PROBLEM& P, const double nu, const double epsilon,
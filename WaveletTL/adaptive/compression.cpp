@@ -6,14 +6,14 @@
 namespace WaveletTL
 {
 
-  template <class PROBLEM>
+  template <class PROBLEM, class VECTOR>
   void
   add_compressed_column(const PROBLEM& P,
 			const double factor,
 			const typename PROBLEM::Index& lambda,
 			const int J,
 			//InfiniteVector<double, typename PROBLEM::Index>& w,
-			Vector<double>& w,
+			VECTOR& w,
 			const int jmax,
 			const CompressionStrategy strategy,
                         const bool preconditioning) //a and b prefactors in strategy DKOR
@@ -114,14 +114,14 @@ namespace WaveletTL
 #endif
   }
   
-  template <class PROBLEM>
+  template <class PROBLEM, class VECTOR>
   void
   add_compressed_column_quarklet(const PROBLEM& P,
 			const double factor,
 			const typename PROBLEM::Index& lambda,
 			const int J,
 			//InfiniteVector<double, typename PROBLEM::Index>& w,
-			Vector<double>& w,
+			VECTOR& w,
 			const int jmax,
 			const CompressionStrategy strategy,
                         const bool preconditioning,
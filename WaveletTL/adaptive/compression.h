@@ -73,22 +73,35 @@ namespace WaveletTL
 
   using MathTL::Vector;
 
+  /*!
+    The result vector w of the routines below is usually a Vector<double> of length
+    P.degrees_of_freedom(), but any vector class with writing access w[i] += ...
+    (e.g. SparseAccumulator<double>) can be used, if the problem class P supports it.
+    Problem classes which can write into such vectors specialize this traits class
+    and set supported = true, cf. CachedProblem.
+  */
   template <class PROBLEM>
+  struct SparseAccumulationTraits
+  {
+    static const bool supported = false;
+  };
+
+  template <class PROBLEM, class VECTOR>
   void add_compressed_column(const PROBLEM& P,
 			     const double factor,
 			     const typename PROBLEM::Index& lambda,
 			     const int J,
-			     Vector<double>& w,
+			     VECTOR& w,
 			     const int jmax = 999,
 			     const CompressionStrategy strategy = St04a,
                              const bool preconditioning = true);
   
-  template <class PROBLEM>
+  template <class PROBLEM, class VECTOR>
   void add_compressed_column_quarklet(const PROBLEM& P,
 			     const double factor,
 			     const typename PROBLEM::Index& lambda,
 			     const int J,
-			     Vector<double>& w,
+			     VECTOR& w,
 			     const int jmax = 999,
 			     const CompressionStrategy strategy = DKR,
                              const bool preconditioning = true,// only relevant for the anisotropic case
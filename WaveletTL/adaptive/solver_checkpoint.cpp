@@ -0,0 +1,146 @@
+// implementation for solver_checkpoint.h
+
+#include <cstdio>
+#include <fstream>
+
+namespace WaveletTL
+{
+  inline
+  SolverCheckpoint::SolverCheckpoint(const char* filename,
+				     const unsigned int interval,
+				     const bool resume)
+    : filename_(filename), interval_(interval), resume_(resume)
+  {
+  }
+
+  // number of an index (the ints of the int versions of the solvers are numbers already)
+  template <class INDEX>
+  inline int checkpoint_number(const INDEX& lambda) { return lambda.number(); }
+
+  inline int checkpoint_number(const int lambda) { return lambda; }
+
+  // reconstruct an index from its number
+  template <class INDEX, class WBASIS>
+  inline void checkpoint_index(const int number, const WBASIS& basis, INDEX& lambda)
+  {
+    lambda = INDEX(number, &basis);
+  }
+
+  template <class WBASIS>
+  inline void checkpoint_index(const int number, const WBASIS& basis, int& lambda)
+  {
+    lambda = number;
+  }
+
+  template <class INDEX>
+  bool
+  SolverCheckpoint::save(const CheckpointSolver solver,
+			 const unsigned int iteration,
+			 const Vector<double>& parameters,
+			 const InfiniteVector<double,INDEX>& u,
+			 const std::set<INDEX>& Lambda) const
+  {
+    // the header: solver, iteration counter, parameters
+    Vector<double> header(2+parameters.size());
+    header[0] = solver;
+    header[1] = iteration;
+    for (unsigned int i = 0; i < parameters.size(); i++)
+      header[2+i] = parameters[i];
+
+    InfiniteVector<double,int> u_numbers, Lambda_numbers;
+    for (typename InfiniteVector<double,INDEX>::const_iterator it(u.begin()), itend(u.end());
+	 it != itend; ++it)
+      u_numbers.set_coefficient(checkpoint_number(it.index()), *it);
+    for (typename std::set<INDEX>::const_iterator it(Lambda.begin()), itend(Lambda.end());
+	 it != itend; ++it)
+      Lambda_numbers.set_coefficient(checkpoint_number(*it), 1.0);
+
+    const std::string tmpname(filename_ + ".tmp");
+    bool ok;
+    {
+      MathTL::BinaryOutput os(tmpname.c_str());
+      os.write(header, 0);
+      os.write(u_numbers, 1);
+      os.write(Lambda_numbers, 2);
+      ok = os.good();
+    }
+    if (ok)
+      ok = rename(tmpname.c_str(), filename_.c_str()) == 0;
+    if (!ok) {
+      std::cout << "SolverCheckpoint: Could not write file " << filename_ << std::endl;
+      remove(tmpname.c_str());
+      return false;
+    }
+
+    save_cache(iteration);
+    return true;
+  }
+
+  template <class INDEX, class WBASIS>
+  bool
+  SolverCheckpoint::load(const CheckpointSolver solver,
+			 const WBASIS& basis,
+			 unsigned int& iteration,
+			 Vector<double>& parameters,
+			 InfiniteVector<double,INDEX>& u,
+			 std::set<INDEX>& Lambda)
+  {
+    if (!resume_) return false;
+    {
+      std::ifstream test(filename_.c_str());
+      if (!test.good()) return false;
+    }
+
+    MathTL::BinaryInput is(filename_.c_str());
+    if (!is.good() || is.records() != 3) {
+      std::cout << "SolverCheckpoint: " << filename_ << " is not a valid checkpoint file" << std::endl;
+      return false;
+    }
+
+    Vector<double> header;
+    InfiniteVector<double,int> u_numbers, Lambda_numbers;
+    if (!is.read(0, header) || !is.read(1, u_numbers) || !is.read(2, Lambda_numbers)) {
+      std::cout << "SolverCheckpoint: " << filename_ << " is corrupt" << std::endl;
+      return false;
+    }
+    if (header.size() < 2 || (int)header[0] != solver) {
+      std::cout << "SolverCheckpoint: " << filename_ << " was written by another solver" << std::endl;
+      return false;
+    }
+    iteration = (unsigned int)header[1];
+    parameters.resize(header.size()-2, false);
+    for (unsigned int i = 0; i < parameters.size(); i++)
+      parameters[i] = header[2+i];
+
+    INDEX lambda;
+    u.clear();
+    for (InfiniteVector<double,int>::const_iterator it(u_numbers.begin()), itend(u_numbers.end());
+	 it != itend; ++it) {
+      checkpoint_index(it.index(), basis, lambda);
+      u.set_coefficient(lambda, *it);
+    }
+    Lambda.clear();
+    for (InfiniteVector<double,int>::const_iterator it(Lambda_numbers.begin()), itend(Lambda_numbers.end());
+	 it != itend; ++it) {
+      checkpoint_index(it.index(), basis, lambda);
+      Lambda.insert(lambda);
+    }
+
+    load_cache();
+
+    std::cout << "SolverCheckpoint: resuming from " << filename_ << " after iteration " << iteration << std::endl;
+    return true;
+  }
+
+  template <class INDEX, class WBASIS>
+  bool
+  SolverCheckpoint::load(const CheckpointSolver solver,
+			 const WBASIS& basis,
+			 unsigned int& iteration,
+			 Vector<double>& parameters,
+			 InfiniteVector<double,INDEX>& u)
+  {
+    std::set<INDEX> Lambda;
+    return load(solver, basis, iteration, parameters, u, Lambda);
+  }
+}
@@ -0,0 +1,173 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of WaveletTL - the Wavelet Template Library      |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _WAVELETTL_SOLVER_CHECKPOINT_H
+#define _WAVELETTL_SOLVER_CHECKPOINT_H
+
+#include <set>
+#include <string>
+#include <algebra/vector.h>
+#include <algebra/infinite_vector.h>
+#include <io/binary_io.h>
+
+using MathTL::Vector;
+using MathTL::InfiniteVector;
+
+namespace WaveletTL
+{
+  //! the solvers which can be checkpointed
+  enum CheckpointSolver {
+    checkpoint_cdd2 = 1,
+    checkpoint_awgm = 2,
+    checkpoint_steepest_descent = 3
+  };
+
+  /*!
+    Checkpoint/restart for the adaptive solvers CDD2_SOLVE, AWGM_SOLVE and
+    steepest_descent_ks_SOLVE.
+
+    A solver which is given a checkpoint writes its state every interval() iterations
+    into a file: the iteration counter, the parameters of the tolerance schedule
+    (e.g., epsilon_k and the constants derived from norm_A() and norm_Ainv()),
+    the current iterate and, for AWGM_SOLVE, the active index set.
+    The file is written into a temporary file first, which is then renamed,
+    so that an interrupted run always leaves a complete checkpoint.
+
+    If the checkpoint file exists when the solver is started (and resume is enabled),
+    the solver continues from the stored state instead of starting from scratch,
+    i.e., the restart is done by calling the solver again with the same arguments.
+
+    Indices are stored via their number(), so the basis has to be the same
+    when resuming (including jmax).
+  */
+  class SolverCheckpoint
+  {
+  public:
+    /*!
+      constructor from the file name and the number of iterations between two
+      checkpoints; with resume=false, an existing file is ignored (and overwritten)
+    */
+    SolverCheckpoint(const char* filename,
+		     const unsigned int interval = 1,
+		     const bool resume = true);
+
+    //! virtual destructor
+    virtual ~SolverCheckpoint() {}
+
+    //! the checkpoint file
+    const std::string& filename() const { return filename_; }
+
+    //! number of iterations between two checkpoints
+    unsigned int interval() const { return interval_; }
+
+    //! check whether a checkpoint has to be written after iteration k
+    bool due(const unsigned int k) const { return interval_ > 0 && k % interval_ == 0; }
+
+    /*!
+      write the state of a solver: iteration counter, parameters, iterate u
+      and active index set Lambda (may be empty)
+    */
+    template <class INDEX>
+    bool save(const CheckpointSolver solver,
+	      const unsigned int iteration,
+	      const Vector<double>& parameters,
+	      const InfiniteVector<double,INDEX>& u,
+	      const std::set<INDEX>& Lambda = std::set<INDEX>()) const;
+
+    /*!
+      read the state of a solver, returns false if resuming is disabled,
+      there is no checkpoint file or it has been written by another solver;
+      the basis is needed to reconstruct the indices from their numbers
+    */
+    template <class INDEX, class WBASIS>
+    bool load(const CheckpointSolver solver,
+	      const WBASIS& basis,
+	      unsigned int& iteration,
+	      Vector<double>& parameters,
+	      InfiniteVector<double,INDEX>& u,
+	      std::set<INDEX>& Lambda);
+
+    //! same without an active index set
+    template <class INDEX, class WBASIS>
+    bool load(const CheckpointSolver solver,
+	      const WBASIS& basis,
+	      unsigned int& iteration,
+	      Vector<double>& parameters,
+	      InfiniteVector<double,INDEX>& u);
+
+  protected:
+    std::string filename_;
+    unsigned int interval_;
+    bool resume_;
+
+    /*!
+      hooks to save/restore further state with each checkpoint (written after
+      the given iteration), e.g. the entries cache of the problem (see CachedSolverCheckpoint)
+    */
+    virtual void save_cache(const unsigned int iteration) const {}
+    virtual void load_cache() {}
+  };
+
+  /*!
+    A checkpoint which also saves the entries cache of a cached problem
+    (CachedProblem, CachedTProblem, see their save_cache() and load_cache()),
+    so that the stiffness entries computed so far are not lost on a restart.
+    Since the whole cache is written, this is done less often than the checkpoints
+    of the iterate: with the first checkpoint after every cache_interval iterations.
+    A cache that is older than the iterate is harmless, missing entries are
+    simply recomputed after a restart. However, since St04a caches only the entries
+    needed by the first APPLY of a column, the resumed run may then differ from an
+    uninterrupted one in the last digits; for bitwise identical results,
+    choose cache_interval = 1.
+  */
+  template <class PROBLEM>
+  class CachedSolverCheckpoint
+    : public SolverCheckpoint
+  {
+  public:
+    /*!
+      constructor from the cached problem, the checkpoint file, the number of
+      iterations between two checkpoints, the cache file
+      (with the description of the problem, see CachedProblem::load_cache())
+      and the number of iterations between two saves of the cache
+    */
+    CachedSolverCheckpoint(PROBLEM* problem,
+			   const char* filename,
+			   const char* cache_filename,
+			   const std::string& description = "",
+			   const unsigned int interval = 1,
+			   const bool resume = true,
+			   const unsigned int cache_interval = 100)
+      : SolverCheckpoint(filename, interval, resume),
+	problem_(problem), cache_filename_(cache_filename), description_(description),
+	cache_interval_(cache_interval), last_cache_iteration_(0) {}
+
+  protected:
+    PROBLEM* problem_;
+    std::string cache_filename_, description_;
+
+    //! number of iterations between two saves of the cache
+    unsigned int cache_interval_;
+
+    //! iteration after which the cache has been saved last
+    mutable unsigned int last_cache_iteration_;
+
+    void save_cache(const unsigned int iteration) const {
+      if (cache_interval_ > 0 && iteration >= last_cache_iteration_ + cache_interval_) {
+	problem_->save_cache(cache_filename_.c_str(), description_);
+	last_cache_iteration_ = iteration;
+      }
+    }
+    void load_cache() { problem_->load_cache(cache_filename_.c_str(), description_); }
+  };
+}
+
+#include <adaptive/solver_checkpoint.cpp>
+
+#endif
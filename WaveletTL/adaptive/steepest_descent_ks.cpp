@@ -14,7 +14,8 @@ namespace WaveletTL{
 
   template <class PROBLEM>
   void steepest_descent_ks_SOLVE(const PROBLEM& P,  const double epsilon,
-			      InfiniteVector<double, typename PROBLEM::Index>& approximations)
+			      InfiniteVector<double, typename PROBLEM::Index>& approximations,
+			      SolverCheckpoint* checkpoint)
   {
 
     // promal and dual spline orders of the wavelets
@@ -127,9 +128,22 @@ namespace WaveletTL{
 
     double dd = 0.5;
 
+    // resume from a checkpoint, if possible
+    unsigned int i_start = 1;
+    bool resumed = false;
+    Vector<double> parameters;
+    if (checkpoint && checkpoint->load(checkpoint_steepest_descent, P.basis(), loops, parameters, w)) {
+      i_start = (unsigned int) parameters[0];
+      omega_i = parameters[1];
+      niter = (unsigned int) parameters[2];
+      dd = parameters[3];
+      resumed = true;
+    }
+
     // the adaptive algorithm
-    for (unsigned int i = 1; i <= K; i++) {
-      omega_i *= beta;
+    for (unsigned int i = i_start; i <= K; i++) {
+      if (!resumed || i > i_start)
+	omega_i *= beta;
       double xi_i = omega_i / ((1+3.0*mu)*C3*M);
       double nu_i = 0.;
 
@@ -312,6 +326,17 @@ namespace WaveletTL{
 	    break;
 	  }
 
+	// checkpoint after the stopping criterion, so that a resumed run
+	// repeats the last descent step of a finished run (and stops there again)
+	if (checkpoint && checkpoint->due(loops)) {
+	  parameters.resize(4, false);
+	  parameters[0] = i;
+	  parameters[1] = omega_i;
+	  parameters[2] = niter;
+	  parameters[3] = dd;
+	  checkpoint->save(checkpoint_steepest_descent, loops, parameters, w);
+	}
+
 	}//end while
       
 	cout << "#######################" << endl;
@@ -11,6 +11,7 @@
 #define _WAVELET_TL_STEEPEST_DESCENT_KS_H
 
 #include <algebra/infinite_vector.h>
+#include <adaptive/solver_checkpoint.h>
 
 namespace WaveletTL
 {
@@ -28,10 +29,14 @@ namespace WaveletTL
     \param P The cached discrete problem.
     \param epsilon The target \f$\ell_2\f$-accuracy of the algorithm.
     \param approximations We return the discrete approximations.    
+    \param checkpoint If given, the iterate and the tolerance schedule are saved every
+    checkpoint->interval() descent steps, and the solver resumes from an existing
+    checkpoint file (see SolverCheckpoint).
   */
   template <class PROBLEM>
   void steepest_descent_ks_SOLVE(const PROBLEM& P, const double epsilon,
-			      InfiniteVector<double, typename PROBLEM::Index>& approximations);
+			      InfiniteVector<double, typename PROBLEM::Index>& approximations,
+			      SolverCheckpoint* checkpoint = 0);
   
   template <class PROBLEM>
   void steepest_descent_ks_QUARKLET_SOLVE(const PROBLEM& P, const double epsilon,
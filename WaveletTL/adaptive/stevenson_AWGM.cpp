@@ -28,10 +28,11 @@ void AWGM_SOLVE(const PROBLEM& P, const double epsilon,
                const double gamma,
                const double theta,
                const InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& guess,
-               const CompressionStrategy strategy)
+               const CompressionStrategy strategy,
+               SolverCheckpoint* checkpoint)
 {
     // Start with nu_{-1} = ||F||_2
-    AWGM_SOLVE(P, epsilon, u_epsilon, jmax, P.F_norm(), logger, alpha, omega, gamma, theta, guess, strategy);
+    AWGM_SOLVE(P, epsilon, u_epsilon, jmax, P.F_norm(), logger, alpha, omega, gamma, theta, guess, strategy, checkpoint);
 }
 
 
@@ -47,7 +48,8 @@ void AWGM_SOLVE(const PROBLEM& P, const double epsilon,
                const double gamma,
                const double theta,
                const InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& guess,
-               const CompressionStrategy strategy)
+               const CompressionStrategy strategy,
+               SolverCheckpoint* checkpoint)
 {
     unsigned int k = 0; // iteration counter
     double nu = nu_neg1;
@@ -57,8 +59,17 @@ void AWGM_SOLVE(const PROBLEM& P, const double epsilon,
     set<Index> Lambda, supp_r_coarse;
     InfiniteVector<double, Index> r, r_help, g;
 
-    u_epsilon = guess;
-    u_epsilon.support(Lambda);
+    // the Galerkin matrices for the growing index sets Lambda are set up incrementally
+    StiffnessMatrixCache<Index> stiffness;
+
+    Vector<double> parameters;
+    if (checkpoint && checkpoint->load(checkpoint_awgm, P.basis(), k, parameters, u_epsilon, Lambda))
+        nu = parameters[0];
+    else
+    {
+        u_epsilon = guess;
+        u_epsilon.support(Lambda);
+    }
 
     logger.startClock();
 
@@ -87,9 +98,15 @@ void AWGM_SOLVE(const PROBLEM& P, const double epsilon,
 
         P.RHS(gamma*nu, g);
         g.clip(Lambda);
-        GALSOLVE(P, Lambda, g, u_epsilon, (1+gamma)*nu, gamma*nu);
+        GALSOLVE(P, Lambda, g, u_epsilon, (1+gamma)*nu, gamma*nu, &stiffness);
 
         ++k;
+        if (checkpoint && checkpoint->due(k))
+        {
+            parameters.resize(1, false);
+            parameters[0] = nu;
+            checkpoint->save(checkpoint_awgm, k, parameters, u_epsilon, Lambda);
+        }
     }
 
     cout << "GHS_SOLVE: done!" << endl;
@@ -102,13 +119,18 @@ void GALSOLVE(const PROBLEM& P, const set<typename PROBLEM::WaveletBasis::Index>
               const InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& g_Lambda,
               InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& w_Lambda,
               const double delta,
-              const double epsilon)
+              const double epsilon,
+              StiffnessMatrixCache<typename PROBLEM::WaveletBasis::Index>* stiffness)
 {
     typedef typename PROBLEM::WaveletBasis::Index Index;
 
-    // setup A_Lambda
-    SparseMatrix<double> A_Lambda;
-    setup_stiffness_matrix(P, Lambda, A_Lambda);
+    // setup A_Lambda (reusing the previous Galerkin matrix, if available)
+    SparseMatrix<double> A_Lambda_local;
+    if (stiffness)
+        setup_stiffness_matrix(P, Lambda, *stiffness);
+    else
+        setup_stiffness_matrix(P, Lambda, A_Lambda_local);
+    const SparseMatrix<double>& A_Lambda(stiffness ? stiffness->A : A_Lambda_local);
 
     // setup right-hand side
     Vector<double> g(Lambda.size());
@@ -127,7 +149,9 @@ void GALSOLVE(const PROBLEM& P, const set<typename PROBLEM::WaveletBasis::Index>
 #endif
 
     unsigned int iterations = 0;
-    if(!MathTL::CG(A_Lambda, g, xk, epsilon/delta, 250, iterations))
+    // the CG iteration runs on the contiguous CSR copy of A_Lambda
+    const CSRMatrix<double> A_Lambda_csr(A_Lambda);
+    if(!MathTL::CG(A_Lambda_csr, g, xk, epsilon/delta, 250, iterations))
         cout << "GALSOLVE: CG could not reach tolerance within 250 iterations!" << endl;
 
     id = 0;
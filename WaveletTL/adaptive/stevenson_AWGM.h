@@ -16,8 +16,11 @@
 
 #include <set>
 #include <algebra/infinite_vector.h>
+#include <algebra/csr_matrix.h>
+#include <galerkin/galerkin_utils.h>
 #include <adaptive/compression.h>
 #include <adaptive/apply.h>
+#include <adaptive/solver_checkpoint.h>
 #include <utils/convergence_logger.h>
 
 
@@ -41,6 +44,9 @@ namespace WaveletTL
     ||F-Au_epsilon||_2 <= epsilon.
 
   You can specify a maximal level jmax for the internal APPLY calls.
+  If a checkpoint is given, the iterate, the active set Lambda and nu are saved
+  every checkpoint->interval() iterations, and the solver resumes from an existing
+  checkpoint file (see SolverCheckpoint).
 
   References:
   [GHS07]  T. Gantumur, H. Harbrecht, R.P. Stevenson, An Optimal Adaptive Wavelet Method
@@ -55,6 +61,7 @@ namespace WaveletTL
 
 using std::set;
 using MathTL::InfiniteVector;
+using MathTL::CSRMatrix;
 
 
 
@@ -75,10 +82,11 @@ void AWGM_SOLVE(const PROBLEM& P, const double epsilon,
                 const double theta = 0.4,
                 const InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& guess = InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>(),
   #if _WAVELETTL_USE_TBASIS == 1
-                const CompressionStrategy strategy = tensor_simple);
+                const CompressionStrategy strategy = tensor_simple,
   #else
-                const CompressionStrategy strategy = St04a);
+                const CompressionStrategy strategy = St04a,
   #endif
+                SolverCheckpoint* checkpoint = 0);
 
 
 
@@ -97,22 +105,26 @@ void AWGM_SOLVE(const PROBLEM& P, const double epsilon,
                 const double theta = 0.4,
                 const InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& guess = InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>(),
   #if _WAVELETTL_USE_TBASIS == 1
-                const CompressionStrategy strategy = tensor_simple);
+                const CompressionStrategy strategy = tensor_simple,
   #else
-                const CompressionStrategy strategy = St04a);
+                const CompressionStrategy strategy = St04a,
   #endif
+                SolverCheckpoint* checkpoint = 0);
 
 
 
 /*
  * A simplified version of GALSOLVE from [GHS07].
+ * If a stiffness matrix cache is given, the Galerkin matrix of the previous call
+ * is updated instead of being set up from scratch (see update_stiffness_matrix()).
  */
 template <class PROBLEM>
 void GALSOLVE(const PROBLEM& P, const set<typename PROBLEM::WaveletBasis::Index>& Lambda,
               const InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& g_Lambda,
               InfiniteVector<double, typename PROBLEM::WaveletBasis::Index>& w_Lambda,
               const double delta,
-              const double epsilon);
+              const double epsilon,
+              StiffnessMatrixCache<typename PROBLEM::WaveletBasis::Index>* stiffness = 0);
 
 }
 
@@ -0,0 +1,128 @@
+// Benchmarks for a Sturm boundary value problem on the interval (PBasis):
+// - APPLY with a cold and a warm entries cache,
+// - COARSE with sorting and with binary binning,
+// - setup_stiffness_matrix() on the support of the APPLY result (warm cache),
+// - CG with SparseMatrix and CSRMatrix.
+
+#define _DIM 1
+#define BASIS
+
+#include <iostream>
+#include <set>
+
+#include <algebra/infinite_vector.h>
+#include <algebra/sparse_matrix.h>
+#include <algebra/csr_matrix.h>
+#include <algebra/vector.h>
+#include <numerics/sturm_bvp.h>
+#include <numerics/iteratsolv.h>
+
+#include <interval/p_basis.h>
+#include <galerkin/sturm_equation.h>
+#include <galerkin/cached_problem.h>
+#include <galerkin/galerkin_utils.h>
+#include <adaptive/apply.h>
+#include <adaptive/compression.h>
+
+using namespace MathTL;
+
+#include <galerkin/TestProblem.h>
+#include "benchmark.h"
+
+using namespace WaveletTL;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  BenchmarkOptions options(argc, argv, BenchmarkOptions::parse_list("6,8,10"));
+  BenchmarkReport report(options.output);
+
+  typedef PBasis<3,3> Basis;
+  typedef Basis::Index Index;
+  typedef SturmEquation<Basis> Problem;
+  const char* problem_name = "PBasis<3,3>";
+
+  TestProblem<2> T;
+
+  for (unsigned int jn = 0; jn < options.jmax.size(); jn++) {
+    const int jmax = options.jmax[jn];
+    Basis basis(true, true);
+    basis.set_jmax(jmax);
+    Problem eq(T, basis);
+    CachedProblem<Problem> ceq(&eq, 1.0, 1.0);
+
+    InfiniteVector<double,Index> F, w;
+    ceq.RHS(1e-6, F);
+    const double eta = 1e-4 * l2_norm(F);
+
+    for (unsigned int tn = 0; tn < options.threads.size(); tn++) {
+      const int threads = options.threads[tn];
+      set_benchmark_threads(threads);
+      vector<double> cold, warm;
+
+      // APPLY, cold cache (including the computation of all needed entries) and warm cache
+      for (int r = 0; r < options.repetitions; r++) {
+	ceq.clear_cache();
+	double tstart = wall_time();
+	APPLY(ceq, F, eta, w, jmax, St04a);
+	cold.push_back(wall_time()-tstart);
+	tstart = wall_time();
+	APPLY(ceq, F, eta, w, jmax, St04a);
+	warm.push_back(wall_time()-tstart);
+      }
+      report.add("apply_cold", problem_name, jmax, threads, cold, w.size());
+      report.add("apply_warm", problem_name, jmax, threads, warm, w.size());
+
+      // COARSE of the APPLY result
+      vector<double> sorted, binned;
+      InfiniteVector<double,Index> v;
+      const double epsilon = 1e-2 * l2_norm(w);
+      for (int r = 0; r < options.repetitions; r++) {
+	double tstart = wall_time();
+	w.COARSE(epsilon, v, coarse_sort);
+	sorted.push_back(wall_time()-tstart);
+	tstart = wall_time();
+	w.COARSE(epsilon, v, coarse_binning);
+	binned.push_back(wall_time()-tstart);
+      }
+      report.add("coarse_sort", problem_name, jmax, threads, sorted, v.size());
+      report.add("coarse_binning", problem_name, jmax, threads, binned, v.size());
+
+      // Galerkin system on the support of the APPLY result
+      set<Index> Lambda;
+      for (InfiniteVector<double,Index>::const_iterator it(w.begin()); it != w.end(); ++it)
+	Lambda.insert(it.index());
+      SparseMatrix<double> A_Lambda;
+      setup_stiffness_matrix(ceq, Lambda, A_Lambda); // fill the entries cache
+      vector<double> setup;
+      for (int r = 0; r < options.repetitions; r++) {
+	const double tstart = wall_time();
+	setup_stiffness_matrix(ceq, Lambda, A_Lambda);
+	setup.push_back(wall_time()-tstart);
+      }
+      report.add("setup_stiffness_matrix", problem_name, jmax, threads, setup, A_Lambda.size());
+
+      Vector<double> b(Lambda.size()), x(Lambda.size());
+      unsigned int id = 0;
+      for (set<Index>::const_iterator it(Lambda.begin()); it != Lambda.end(); ++it, ++id)
+	b[id] = F.get_coefficient(*it);
+      const CSRMatrix<double> A_Lambda_csr(A_Lambda);
+      vector<double> cg_sparse, cg_csr;
+      unsigned int iterations = 0;
+      for (int r = 0; r < options.repetitions; r++) {
+	x = 0;
+	double tstart = wall_time();
+	CG(A_Lambda, b, x, 1e-10, 1000, iterations);
+	cg_sparse.push_back(wall_time()-tstart);
+	x = 0;
+	tstart = wall_time();
+	CG(A_Lambda_csr, b, x, 1e-10, 1000, iterations);
+	cg_csr.push_back(wall_time()-tstart);
+      }
+      report.add("cg_sparse_matrix", problem_name, jmax, threads, cg_sparse, iterations);
+      report.add("cg_csr_matrix", problem_name, jmax, threads, cg_csr, iterations);
+    }
+  }
+
+  return 0;
+}
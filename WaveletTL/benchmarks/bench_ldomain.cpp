@@ -0,0 +1,95 @@
+// Benchmarks for the Poisson equation on the L-shaped domain (LDomainBasis of PBasis):
+// - APPLY with a cold and a warm entries cache,
+// - COARSE with sorting and with binary binning.
+// With DYADIC, CachedProblem takes the diagonal preconditioner from the uncached problem;
+// otherwise, each diagonal entry would fill a complete column of the cache.
+
+#define DYADIC
+
+#include <iostream>
+
+#include <algebra/infinite_vector.h>
+#include <algebra/vector.h>
+#include <utils/function.h>
+#include <numerics/bvp.h>
+
+#include <interval/p_basis.h>
+#include <Ldomain/ldomain_basis.h>
+#include <galerkin/ldomain_equation.h>
+#include <galerkin/cached_problem.h>
+#include <adaptive/apply.h>
+#include <adaptive/compression.h>
+
+#include "benchmark.h"
+
+using namespace MathTL;
+using namespace WaveletTL;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  BenchmarkOptions options(argc, argv, BenchmarkOptions::parse_list("3"));
+  BenchmarkReport report(options.output);
+
+  typedef PBasis<3,3> Basis1D;
+  typedef LDomainBasis<Basis1D> Basis;
+  typedef Basis::Index Index;
+  typedef LDomainEquation<Basis1D> Problem;
+  const char* problem_name = "LDomainBasis<PBasis<3,3>>";
+
+  Vector<double> value(1, "1.0");
+  ConstantFunction<2> f(value);
+  PoissonBVP<2> poisson(&f);
+  Basis1D basis1D;
+
+  for (unsigned int jn = 0; jn < options.jmax.size(); jn++) {
+    const int jmax = options.jmax[jn];
+    Basis basis(basis1D);
+    basis.set_jmax(jmax);
+    Problem eq(&poisson, basis);
+    CachedProblem<Problem> ceq(&eq, 5.0, 10.0);
+
+    // the intersecting wavelets are determined by brute force on the L-shaped domain,
+    // so we only apply the operator to the largest coefficients of the right-hand side
+    InfiniteVector<double,Index> F_full, F, w;
+    ceq.RHS(1e-6, F_full);
+    F_full.COARSE(0.97 * l2_norm(F_full), F);
+    const double eta = 1e-3 * l2_norm(F);
+
+    for (unsigned int tn = 0; tn < options.threads.size(); tn++) {
+      const int threads = options.threads[tn];
+      set_benchmark_threads(threads);
+
+      // APPLY, cold cache (including the computation of all needed entries) and warm cache
+      vector<double> cold, warm;
+      for (int r = 0; r < options.repetitions; r++) {
+	ceq.clear_cache();
+	double tstart = wall_time();
+	APPLY(ceq, F, eta, w, jmax, St04a);
+	cold.push_back(wall_time()-tstart);
+	tstart = wall_time();
+	APPLY(ceq, F, eta, w, jmax, St04a);
+	warm.push_back(wall_time()-tstart);
+      }
+      report.add("apply_cold", problem_name, jmax, threads, cold, w.size());
+      report.add("apply_warm", problem_name, jmax, threads, warm, w.size());
+
+      // COARSE of the APPLY result
+      vector<double> sorted, binned;
+      InfiniteVector<double,Index> v;
+      const double epsilon = 1e-2 * l2_norm(w);
+      for (int r = 0; r < options.repetitions; r++) {
+	double tstart = wall_time();
+	w.COARSE(epsilon, v, coarse_sort);
+	sorted.push_back(wall_time()-tstart);
+	tstart = wall_time();
+	w.COARSE(epsilon, v, coarse_binning);
+	binned.push_back(wall_time()-tstart);
+      }
+      report.add("coarse_sort", problem_name, jmax, threads, sorted, v.size());
+      report.add("coarse_binning", problem_name, jmax, threads, binned, v.size());
+    }
+  }
+
+  return 0;
+}
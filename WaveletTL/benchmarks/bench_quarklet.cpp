@@ -0,0 +1,93 @@
+// Benchmarks for a Sturm boundary value problem on the interval (PQFrame):
+// - APPLY_QUARKLET with a cold and a warm entries cache,
+// - COARSE with sorting and with binary binning.
+// The maximal polynomial degree pmax of the quarklets is fixed to 2.
+// CachedQuarkletProblem has no method to clear its cache, so the cold runs use a new instance.
+
+#define _DIM 1
+#define FRAME
+#define DYADIC
+
+#include <iostream>
+
+#include <algebra/infinite_vector.h>
+#include <numerics/sturm_bvp.h>
+
+#include <interval/pq_frame.h>
+#include <galerkin/sturm_equation.h>
+#include <galerkin/cached_quarklet_problem.h>
+#include <adaptive/apply.h>
+#include <adaptive/compression.h>
+
+using namespace MathTL;
+
+#include <galerkin/TestProblem.h>
+#include "benchmark.h"
+
+using namespace WaveletTL;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  BenchmarkOptions options(argc, argv, BenchmarkOptions::parse_list("5,6,7"));
+  BenchmarkReport report(options.output);
+
+  typedef PQFrame<3,3> Frame;
+  typedef Frame::Index Index;
+  typedef SturmEquation<Frame> Problem;
+  const char* problem_name = "PQFrame<3,3>";
+  const int pmax = 2;
+
+  TestProblem<2> T;
+
+  for (unsigned int jn = 0; jn < options.jmax.size(); jn++) {
+    const int jmax = options.jmax[jn];
+    Frame frame(true, true, true);
+    frame.set_jpmax(jmax, pmax);
+    Problem eq(T, frame);
+    CachedQuarkletProblem<Problem> ceq(&eq, 22, 7);
+
+    InfiniteVector<double,Index> F, w;
+    ceq.RHS(1e-6, F);
+    const double eta = 1e-3 * l2_norm(F);
+
+    for (unsigned int tn = 0; tn < options.threads.size(); tn++) {
+      const int threads = options.threads[tn];
+      set_benchmark_threads(threads);
+
+      // APPLY_QUARKLET, cold cache (including the computation of all needed entries) and warm cache
+      vector<double> cold, warm;
+      for (int r = 0; r < options.repetitions; r++) {
+	CachedQuarkletProblem<Problem> cold_problem(&eq, 22, 7);
+	const double tstart = wall_time();
+	APPLY_QUARKLET(cold_problem, F, eta, w, jmax, DKR, pmax, 2, 2);
+	cold.push_back(wall_time()-tstart);
+      }
+      APPLY_QUARKLET(ceq, F, eta, w, jmax, DKR, pmax, 2, 2);
+      for (int r = 0; r < options.repetitions; r++) {
+	const double tstart = wall_time();
+	APPLY_QUARKLET(ceq, F, eta, w, jmax, DKR, pmax, 2, 2);
+	warm.push_back(wall_time()-tstart);
+      }
+      report.add("apply_quarklet_cold", problem_name, jmax, threads, cold, w.size());
+      report.add("apply_quarklet_warm", problem_name, jmax, threads, warm, w.size());
+
+      // COARSE of the APPLY_QUARKLET result
+      vector<double> sorted, binned;
+      InfiniteVector<double,Index> v;
+      const double epsilon = 1e-2 * l2_norm(w);
+      for (int r = 0; r < options.repetitions; r++) {
+	double tstart = wall_time();
+	w.COARSE(epsilon, v, coarse_sort);
+	sorted.push_back(wall_time()-tstart);
+	tstart = wall_time();
+	w.COARSE(epsilon, v, coarse_binning);
+	binned.push_back(wall_time()-tstart);
+      }
+      report.add("coarse_sort", problem_name, jmax, threads, sorted, v.size());
+      report.add("coarse_binning", problem_name, jmax, threads, binned, v.size());
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,97 @@
+// Benchmarks for the Poisson equation on the unit square (TensorBasis of PBasis):
+// - APPLY_TENSOR with a cold and a warm entries cache,
+// - setup_stiffness_matrix() on the support of the APPLY_TENSOR result (warm cache).
+// The levels jmax are the maximal sums of the levels in both directions (j0=3+3).
+// CachedTProblem has no method to clear its cache, so the cold runs use a new instance.
+
+#include <iostream>
+#include <set>
+
+#include <algebra/infinite_vector.h>
+#include <algebra/sparse_matrix.h>
+#include <algebra/vector.h>
+#include <utils/function.h>
+#include <utils/fixed_array1d.h>
+#include <numerics/bvp.h>
+
+#include <interval/p_basis.h>
+#include <cube/tbasis.h>
+#include <galerkin/tbasis_equation.h>
+#include <galerkin/cached_tproblem.h>
+#include <galerkin/galerkin_utils.h>
+#include <adaptive/apply_tensor.h>
+#include <adaptive/compression.h>
+
+#include "benchmark.h"
+
+using namespace MathTL;
+using namespace WaveletTL;
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  BenchmarkOptions options(argc, argv, BenchmarkOptions::parse_list("7,8"));
+  BenchmarkReport report(options.output);
+
+  const unsigned int dim = 2;
+  typedef PBasis<3,3> Basis1d;
+  typedef TensorBasis<Basis1d,dim> Basis;
+  typedef Basis::Index Index;
+  typedef TensorEquation<Basis1d,dim,Basis> Problem;
+  const char* problem_name = "TensorBasis<PBasis<3,3>,2>";
+
+  FixedArray1D<bool,2*dim> bc;
+  bc[0] = bc[1] = bc[2] = bc[3] = true;
+  Vector<double> value(1, "1.0");
+  ConstantFunction<dim> f(value);
+  PoissonBVP<dim> poisson(&f);
+
+  for (unsigned int jn = 0; jn < options.jmax.size(); jn++) {
+    const int jmax = options.jmax[jn];
+    Problem eq(&poisson, bc);
+    eq.set_jmax(jmax);
+    CachedTProblem<Problem> ceq(&eq, 1.0, 1.0);
+
+    InfiniteVector<double,Index> F, w;
+    ceq.RHS(1e-6, F);
+    const double eta = 1e-3 * l2_norm(F);
+
+    for (unsigned int tn = 0; tn < options.threads.size(); tn++) {
+      const int threads = options.threads[tn];
+      set_benchmark_threads(threads);
+
+      // APPLY_TENSOR, cold cache (including the computation of all needed entries) and warm cache
+      vector<double> cold, warm;
+      for (int r = 0; r < options.repetitions; r++) {
+	CachedTProblem<Problem> cold_problem(&eq, 1.0, 1.0);
+	const double tstart = wall_time();
+	APPLY_TENSOR(cold_problem, F, eta, w, jmax, tensor_simple);
+	cold.push_back(wall_time()-tstart);
+      }
+      APPLY_TENSOR(ceq, F, eta, w, jmax, tensor_simple);
+      for (int r = 0; r < options.repetitions; r++) {
+	const double tstart = wall_time();
+	APPLY_TENSOR(ceq, F, eta, w, jmax, tensor_simple);
+	warm.push_back(wall_time()-tstart);
+      }
+      report.add("apply_tensor_cold", problem_name, jmax, threads, cold, w.size());
+      report.add("apply_tensor_warm", problem_name, jmax, threads, warm, w.size());
+
+      // Galerkin system on the support of the APPLY_TENSOR result
+      set<Index> Lambda;
+      for (InfiniteVector<double,Index>::const_iterator it(w.begin()); it != w.end(); ++it)
+	Lambda.insert(it.index());
+      SparseMatrix<double> A_Lambda;
+      setup_stiffness_matrix(ceq, Lambda, A_Lambda); // fill the entries cache
+      vector<double> setup;
+      for (int r = 0; r < options.repetitions; r++) {
+	const double tstart = wall_time();
+	setup_stiffness_matrix(ceq, Lambda, A_Lambda);
+	setup.push_back(wall_time()-tstart);
+      }
+      report.add("setup_stiffness_matrix", problem_name, jmax, threads, setup, A_Lambda.size());
+    }
+  }
+
+  return 0;
+}
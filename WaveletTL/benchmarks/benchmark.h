@@ -0,0 +1,151 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of WaveletTL - the Wavelet Template Library      |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _WAVELETTL_BENCHMARK_H
+#define _WAVELETTL_BENCHMARK_H
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace WaveletTL
+{
+  /*!
+    wall clock time in seconds (clock() would sum up the CPU time of all threads)
+  */
+  inline double wall_time()
+  {
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + 1e-6*tv.tv_usec;
+#endif
+  }
+
+  /*!
+    set the number of OpenMP threads (ignored without OpenMP)
+  */
+  inline void set_benchmark_threads(const int threads)
+  {
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#endif
+  }
+
+  /*!
+    command line options of the benchmark programs:
+      --jmax 4,5,6       maximal levels of the discretizations
+      --threads 1,2,4    numbers of OpenMP threads
+      --reps 3           number of repetitions of each measurement
+      --output file.csv  write the results into a file (default: <program>.csv)
+    The results are not written to std::cout by default, since some of the
+    measured routines report their progress there.
+  */
+  class BenchmarkOptions
+  {
+  public:
+    /*!
+      constructor from the command line, with default levels
+    */
+    BenchmarkOptions(int argc, char** argv, const std::vector<int>& default_jmax)
+      : jmax(default_jmax), threads(1, 1), repetitions(3), output(argv[0])
+    {
+      output = output.substr(output.find_last_of('/')+1) + ".csv";
+      for (int i = 1; i+1 < argc; i += 2) {
+	if (strcmp(argv[i], "--jmax") == 0)
+	  jmax = parse_list(argv[i+1]);
+	else if (strcmp(argv[i], "--threads") == 0)
+	  threads = parse_list(argv[i+1]);
+	else if (strcmp(argv[i], "--reps") == 0)
+	  repetitions = std::max(1, atoi(argv[i+1]));
+	else if (strcmp(argv[i], "--output") == 0)
+	  output = argv[i+1];
+	else
+	  std::cerr << "ignoring unknown option " << argv[i] << std::endl;
+      }
+    }
+
+    //! parse a comma separated list of integers
+    static std::vector<int> parse_list(const char* s)
+    {
+      std::vector<int> result;
+      for (const char* p = s; *p;) {
+	result.push_back(atoi(p));
+	while (*p && *p != ',') p++;
+	if (*p == ',') p++;
+      }
+      return result;
+    }
+
+    std::vector<int> jmax;
+    std::vector<int> threads;
+    int repetitions;
+    std::string output;
+  };
+
+  /*!
+    Machine-readable output of benchmark results, one CSV line per measurement:
+      benchmark,problem,jmax,threads,repetitions,min_s,median_s,mean_s,size
+    where size is a problem-specific size of the result (number of entries etc.).
+    The filename "-" means std::cout; otherwise, all lines are also echoed
+    to std::cerr for interactive use.
+  */
+  class BenchmarkReport
+  {
+  public:
+    /*!
+      constructor, writes the header line
+    */
+    explicit BenchmarkReport(const std::string& filename)
+      : file_(), os_(&std::cout)
+    {
+      if (filename != "-") {
+	file_.open(filename.c_str());
+	os_ = &file_;
+      }
+      *os_ << "benchmark,problem,jmax,threads,repetitions,min_s,median_s,mean_s,size" << std::endl;
+    }
+
+    /*!
+      report the measured times of one benchmark
+    */
+    void add(const std::string& benchmark, const std::string& problem,
+	     const int jmax, const int threads,
+	     std::vector<double> times, const double size)
+    {
+      std::sort(times.begin(), times.end());
+      const double mean = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+      std::ostringstream line;
+      line << benchmark << "," << problem << "," << jmax << "," << threads << ","
+	   << times.size() << "," << times.front() << "," << times[times.size()/2] << ","
+	   << mean << "," << size;
+      *os_ << line.str() << std::endl;
+      if (os_ != &std::cout)
+	std::cerr << line.str() << std::endl;
+    }
+
+  protected:
+    std::ofstream file_;
+    std::ostream* os_;
+  };
+}
+
+#endif
@@ -19,7 +19,7 @@ namespace WaveletTL
   	
   	template <class IBASIS, unsigned int DIM>
 	TensorBasis<IBASIS,DIM>::TensorBasis(const TensorBasis<IBASIS, DIM>& other)
-    : full_collection(other.full_collection),
+    : level_offsets(other.level_offsets), levels(other.levels),
 #if _PRECOMPUTE_FIRSTLAST_WAVELETS
       first_wavelets(other.first_wavelets), last_wavelets(other.last_wavelets),
 #endif
@@ -423,11 +423,12 @@ namespace WaveletTL
                                         InfiniteVector<double,Index>& coeffs) const
   	{
             assert(primal == false); // only integrate against primal wavelets and generators
-            for (unsigned int i=0; (int)i<degrees_of_freedom(); i++)
+            for (int i=0; i<degrees_of_freedom(); i++)
             {
-                const double coeff = integrate(f, full_collection[i]);
+                const Index lambda(*get_wavelet(i));
+                const double coeff = integrate(f, lambda);
                 if (fabs(coeff)>1e-15)
-                    coeffs.set_coefficient(full_collection[i], coeff);
+                    coeffs.set_coefficient(lambda, coeff);
             }
             /*
             for (Index lambda = first_generator(), lambda_end(last_wavelet(jmax));;++lambda)
@@ -459,11 +460,12 @@ namespace WaveletTL
                     break;
             }
             */
-            for (unsigned int i=0; i<degrees_of_freedom(); i++)
+            for (int i=0; i<degrees_of_freedom(); i++)
             {
-                const double coeff = integrate(f, full_collection[i]);
+                const Index lambda(*get_wavelet(i));
+                const double coeff = integrate(f, lambda);
                 if (fabs(coeff)>1e-15)
-                    coeffs.set_coefficient(full_collection[i], coeff);
+                    coeffs.set_coefficient(lambda, coeff);
             }
             
   	}
@@ -549,29 +551,84 @@ namespace WaveletTL
 
         template <class IBASIS, unsigned int DIM>
         void
-        TensorBasis<IBASIS,DIM>::setup_full_collection()
+        TensorBasis<IBASIS,DIM>::setup_level_offsets()
         {
-            if (jmax_ < multi_degree(j0_) ) {
-                cout << "TensorBasis<IBASIS,DIM>::setup_full_collection(): the specified maximal level jmax is invalid. Specify a higher maximal level jmax_" << endl;
-                cout << "jmax_ = " << jmax_ << "; j0_ = " << j0_ << endl;
+            if (jmax_ < multi_degree(j0_)) {
+                cout << "TensorBasis<IBASIS,DIM>::setup_level_offsets(): the specified maximal level jmax is invalid. Specify a higher maximal level jmax_" << endl;
                 abort();
             }
-            int degrees_of_freedom = last_wavelet_num<IBASIS,DIM,TensorBasis<IBASIS,DIM> >(this, jmax_) +1; // +1 since numbering begins at 0
-            cout << "total degrees of freedom between j0_ = " << j0_ << " and jmax_= " << jmax_ << " is " << degrees_of_freedom << endl;
-            cout << "setting up collection of wavelet indices..." << endl;
-            full_collection.resize(degrees_of_freedom);
-            Index ind = first_generator();
-            for (int k = 0; k < degrees_of_freedom; k++) {
-                full_collection[k] = ind;
-                ++ind;
+            MultiIndex<int,DIM> level_it;
+            level_it[0] = jmax_ - multi_degree(j0_);
+            const int numoflevels = level_it.number() + 1;
+            level_it[0] = 0;
+            level_offsets.resize(numoflevels+1);
+            levels.resize(numoflevels);
+            level_offsets[0] = 0;
+            for (int l = 0; l < numoflevels; ++l, ++level_it)
+            {
+                // on level j: generators and wavelets in directions with j[i]==j0[i], wavelets otherwise
+                int oncurrentlevel = 1;
+                for (unsigned int i = 0; i < DIM; i++)
+                {
+                    levels[l][i] = j0_[i] + level_it[i];
+                    oncurrentlevel *= (level_it[i] == 0)
+                        ? bases_[i]->Deltasize(j0_[i]) + bases_[i]->Nablasize(j0_[i])
+                        : bases_[i]->Nablasize(levels[l][i]);
+                }
+                level_offsets[l+1] = level_offsets[l] + oncurrentlevel;
             }
-            /*
-            int k=0;
-            for (Index ind = first_generator(), itend = last_wavelet(jmax_); ind <= itend; ++ind) {
-                full_collection[k] = ind;
-                k++;
-            }*/
-            cout << "done setting up collection of wavelet indices..." << endl;
+            cout << "total degrees of freedom between j0_ = " << j0_ << " and jmax_= " << jmax_ << " is " << degrees_of_freedom() << endl;
+        }
+
+        template <class IBASIS, unsigned int DIM>
+        typename TensorBasis<IBASIS,DIM>::WaveletHandle
+        TensorBasis<IBASIS,DIM>::get_wavelet(const int number) const
+        {
+            assert(0 <= number && number < degrees_of_freedom());
+            // level_offsets is sorted, the level is the last one starting at or before number
+            const int l = std::upper_bound(level_offsets.begin(), level_offsets.end(), number) - level_offsets.begin() - 1;
+            const MultiIndex<int,DIM>& j(levels[l]);
+            int remains = number - level_offsets[l];
+
+            // types in the order of TensorIndex: binary counting over the directions with j[i]==j0[i]
+            typename Index::type_type e;
+            FixedArray1D<int,DIM> ksize;
+            for (unsigned int i = 0; i < DIM; i++)
+                e[i] = (j[i] == j0_[i]) ? 0 : 1;
+            while (true)
+            {
+                int oncurrenttype = 1;
+                for (unsigned int i = 0; i < DIM; i++)
+                {
+                    ksize[i] = (e[i] == 0) ? bases_[i]->Deltasize(j[i]) : bases_[i]->Nablasize(j[i]);
+                    oncurrenttype *= ksize[i];
+                }
+                if (remains < oncurrenttype)
+                    break;
+                remains -= oncurrenttype;
+                for (int i = DIM-1; i >= 0; i--)
+                {
+                    if (j[i] == j0_[i])
+                    {
+                        if (e[i] == 1)
+                            e[i] = 0;
+                        else
+                        {
+                            e[i] = 1;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            // translations: the last direction is the fastest one
+            typename Index::translation_type k;
+            for (int i = DIM-1; i >= 0; i--)
+            {
+                k[i] = ((e[i] == 0) ? bases_[i]->DeltaLmin() : bases_[i]->Nablamin()) + remains % ksize[i];
+                remains /= ksize[i];
+            }
+            return WaveletHandle(Index(j, e, k, number, this));
         }
 
 }
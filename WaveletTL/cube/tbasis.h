@@ -20,6 +20,7 @@
 #define _PRECOMPUTE_FIRSTLAST_WAVELETS 1 
 
 #include <list>
+#include <algorithm>
 
 #include <algebra/infinite_vector.h>
 #include <utils/fixed_array1d.h>
@@ -100,7 +101,7 @@ namespace WaveletTL
 
     	inline void set_jmax(const MultiIndex<int,DIM> jmax) {
       		jmax_ = multi_degree(jmax);
-      		setup_full_collection();
+      		setup_level_offsets();
 #if _PRECOMPUTE_FIRSTLAST_WAVELETS
                 precompute_firstlast_wavelets();
 #endif
@@ -112,7 +113,7 @@ namespace WaveletTL
 
         inline void set_jmax(const int jmax) {
       		jmax_ = jmax;
-      		setup_full_collection();
+      		setup_level_offsets();
 #if _PRECOMPUTE_FIRSTLAST_WAVELETS
                 precompute_firstlast_wavelets();
 #endif
@@ -240,26 +241,47 @@ namespace WaveletTL
                         const Point<DIM> x) const;
 
     	/*!
-         * Compute all wavelet indices between beginning at j0_ and the last_wavelet 
-         * with \|level\|\leq jmax_, i.e.,
-         * degrees_of_freedom = last_wavelet_num<IBASIS,DIM,TensorBasis<IBASIS,DIM> >(this, jmax_) +1
-         * many wavelet indices are computed. They are stored in full_collection
-         * This codes the mapping \N -> wavelet_indices
+         * The wavelet indices with \|level\|\leq jmax_ are numbered from 0 to
+         * degrees_of_freedom()-1, levels in the order of MultiIndex::number(),
+         * inside a level by the type e and then lexicographically by k.
+         * This computes the number of the first index on each level (up to jmax_),
+         * which is all that is needed to map numbers to indices and back.
          */
-    	void setup_full_collection();
-
+    	void setup_level_offsets();
 
     	//! Number of wavelets between coarsest and finest level
-    	const int degrees_of_freedom() const { return full_collection.size(); };
+    	const int degrees_of_freedom() const { return level_offsets.size() == 0 ? 0 : level_offsets[level_offsets.size()-1]; };
 
-    	//! Get the wavelet index corresponding to a specified number
-    	const inline Index* get_wavelet (const int number) const {
-      		return &full_collection[number];
-    	}
+        /*
+         * Return type of get_wavelet(). It holds the computed index and can be used
+         * like a pointer to it (*, ->), it also converts to const Index&.
+         */
+        class WaveletHandle
+        {
+        public:
+            WaveletHandle(const Index& lambda) : lambda_(lambda) {}
+            inline const Index& operator * () const { return lambda_; }
+            inline const Index* operator -> () const { return &lambda_; }
+            inline operator const Index& () const { return lambda_; }
+        private:
+            Index lambda_;
+        };
+
+    	/*
+         * Get the wavelet index corresponding to a specified number.
+         * The level is found by a binary search in level_offsets,
+         * e and k are computed from the offset within the level.
+         */
+    	WaveletHandle get_wavelet (const int number) const;
 
     protected:
-    	//! Collection of all wavelets between coarsest and finest level
-    	Array1D<Index> full_collection;
+        /*
+         * level_offsets[l] is the number of the first index on the l-th level
+         * (as in MultiIndex::number(), levels relative to j0), the last entry is
+         * degrees_of_freedom(). levels[l] is the corresponding level.
+         */
+        Array1D<int> level_offsets;
+        Array1D<MultiIndex<int,DIM> > levels;
         
 #if _PRECOMPUTE_FIRSTLAST_WAVELETS
         /*
@@ -275,7 +297,7 @@ namespace WaveletTL
 
     	//! Finest possible level j0
     	//MultiIndex<int,DIM> jmax_;
-        // wavelet indices with \|level\|\leq jmax_ are stored in full_collection
+        // wavelet indices with \|level\|\leq jmax_ are numbered, cf. setup_level_offsets()
     	unsigned int jmax_;
 
     	/*
@@ -51,6 +51,99 @@ namespace WaveletTL
   }
 
 
+  template <class IBASIS>
+  const SupportValues1D&
+  support_values(const IBASIS& basis,
+		 const typename IBASIS::Index& lambda,
+		 const bool primal,
+		 const int resolution,
+		 std::map<typename IBASIS::Index,SupportValues1D>& cache)
+  {
+    typedef typename std::map<typename IBASIS::Index,SupportValues1D>::iterator iterator;
+    iterator it(cache.lower_bound(lambda));
+    if (it != cache.end() && !cache.key_comp()(lambda, it->first))
+      return it->second;
+
+    const Array1D<double> values(evaluate(basis, lambda, primal, resolution).values());
+    int first = 0, last = values.size()-1;
+    while (first <= last && values[first] == 0) first++;
+    while (last >= first && values[last] == 0) last--;
+
+    SupportValues1D& result(cache.insert(it, std::make_pair(lambda, SupportValues1D()))->second);
+    result.first = first;
+    result.values.resize(last-first+1);
+    for (int n = first; n <= last; n++)
+      result.values[n-first] = values[n];
+    return result;
+  }
+
+  template <class IBASIS>
+  SampledMapping<1>
+  evaluate_expansion(const FixedArray1D<IBASIS*,1>& bases,
+		     const std::vector<typename IBASIS::Index>& factors,
+		     const std::vector<double>& coeffs,
+		     const bool primal,
+		     const int resolution)
+  {
+    std::map<typename IBASIS::Index,SupportValues1D> cache;
+    Array1D<double> values((1<<resolution)+1);
+    for (unsigned int n = 0; n < values.size(); n++)
+      values[n] = 0;
+    for (unsigned int l = 0; l < coeffs.size(); l++) {
+      const SupportValues1D& f(support_values(*bases[0], factors[l], primal, resolution, cache));
+      for (unsigned int n = 0; n < f.values.size(); n++)
+	values[f.first+n] += coeffs[l] * f.values[n];
+    }
+    return SampledMapping<1>(Grid<1>(0.0, 1.0, 1<<resolution), values);
+  }
+
+  template <class IBASIS>
+  SampledMapping<2>
+  evaluate_expansion(const FixedArray1D<IBASIS*,2>& bases,
+		     const std::vector<typename IBASIS::Index>& x_factors,
+		     const std::vector<typename IBASIS::Index>& y_factors,
+		     const std::vector<double>& coeffs,
+		     const bool primal,
+		     const int resolution)
+  {
+    typedef typename IBASIS::Index Index1D;
+
+    // evaluate each appearing 1D factor only once
+    std::map<Index1D,SupportValues1D> x_cache, y_cache;
+    const unsigned int terms = coeffs.size();
+    std::vector<const SupportValues1D*> x_values(terms), y_values(terms);
+    for (unsigned int l = 0; l < terms; l++) {
+      x_values[l] = &support_values(*bases[0], x_factors[l], primal, resolution, x_cache);
+      y_values[l] = &support_values(*bases[1], y_factors[l], primal, resolution, y_cache);
+    }
+
+    // accumulate the tensor products on their supports, tiles of grid rows are independent
+    const int N = (1<<resolution)+1;
+    const int tile_rows = 16;
+    const int tiles = (N+tile_rows-1)/tile_rows;
+    MathTL::Matrix<double> values(N, N); // rows correspond to the y grid
+#if PARALLEL==1
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int tile = 0; tile < tiles; tile++) {
+      const int row_begin = tile*tile_rows;
+      const int row_end = std::min(N, row_begin+tile_rows);
+      for (unsigned int l = 0; l < terms; l++) {
+	const SupportValues1D& x(*x_values[l]);
+	const SupportValues1D& y(*y_values[l]);
+	const int m1 = std::max(row_begin, y.first);
+	const int m2 = std::min(row_end, y.first+(int)y.values.size());
+	for (int m = m1; m < m2; m++) {
+	  const double c = coeffs[l] * y.values[m-y.first];
+	  for (unsigned int n = 0; n < x.values.size(); n++)
+	    values(m, x.first+n) += c * x.values[n];
+	}
+      }
+    }
+
+    return SampledMapping<2>(Grid<2>(Point<2>(0), Point<2>(1), 1<<resolution), values);
+  }
+
   template <class IBASIS>
   SampledMapping<1>
   evaluate(const TensorBasis<IBASIS,1>& basis,
@@ -58,18 +151,16 @@ namespace WaveletTL
 	   const bool primal,
 	   const int resolution)
   {
-    Grid<1> grid(0.0, 1.0, 1<<resolution);
-    SampledMapping<1> result(grid); // zero
-
     typedef typename TensorBasis<IBASIS,1>::Index Index;
+    typedef typename IBASIS::Index Index1D;
+    std::vector<Index1D> factors;
+    std::vector<double> values;
     for (typename InfiniteVector<double,Index>::const_iterator it(coeffs.begin()),
-	   itend(coeffs.end()); it != itend; ++it)
-           {
-               result.add(*it, evaluate(basis, it.index(), primal, resolution));
-           }
-
-
-    return result;
+	   itend(coeffs.end()); it != itend; ++it) {
+      factors.push_back(Index1D(it.index().j()[0], it.index().e()[0], it.index().k()[0], basis.bases()[0]));
+      values.push_back(*it);
+    }
+    return evaluate_expansion(basis.bases(), factors, values, primal, resolution);
   }
   
   template <class IBASIS>
@@ -79,20 +170,84 @@ namespace WaveletTL
 	   const bool primal,
 	   const int resolution)
   {
-    Grid<1> grid(0.0, 1.0, 1<<resolution);
-    SampledMapping<1> result(grid); // zero
+    typedef typename IBASIS::Index Index1D;
+    std::vector<Index1D> factors;
+    std::vector<double> values;
+    for (typename InfiniteVector<double,int>::const_iterator it(coeffs.begin()),
+	   itend(coeffs.end()); it != itend; ++it) {
+      const typename TensorBasis<IBASIS,1>::WaveletHandle lambda(basis.get_wavelet(it.index()));
+      factors.push_back(Index1D(lambda->j()[0], lambda->e()[0], lambda->k()[0], basis.bases()[0]));
+      values.push_back(*it);
+    }
+    return evaluate_expansion(basis.bases(), factors, values, primal, resolution);
+  }
 
-    typedef typename TensorBasis<IBASIS,1>::Index Index;
+  template <class IBASIS>
+  SampledMapping<2>
+  evaluate(const TensorBasis<IBASIS,2>& basis,
+	   const InfiniteVector<double, typename TensorBasis<IBASIS,2>::Index>& coeffs,
+	   const bool primal,
+	   const int resolution)
+  {
+    typedef typename TensorBasis<IBASIS,2>::Index Index;
+    typedef typename IBASIS::Index Index1D;
+    std::vector<Index1D> x_factors, y_factors;
+    std::vector<double> values;
     for (typename InfiniteVector<double,Index>::const_iterator it(coeffs.begin()),
-	   itend(coeffs.end()); it != itend; ++it)
-           {
-               result.add(*it, evaluate(basis, it.index(), primal, resolution));
-           }
+	   itend(coeffs.end()); it != itend; ++it) {
+      x_factors.push_back(Index1D(it.index().j()[0], it.index().e()[0], it.index().k()[0], basis.bases()[0]));
+      y_factors.push_back(Index1D(it.index().j()[1], it.index().e()[1], it.index().k()[1], basis.bases()[1]));
+      values.push_back(*it);
+    }
+    return evaluate_expansion(basis.bases(), x_factors, y_factors, values, primal, resolution);
+  }
 
+  template <class IBASIS>
+  SampledMapping<2>
+  evaluate(const TensorBasis<IBASIS,2>& basis,
+	   const InfiniteVector<double, int>& coeffs,
+	   const bool primal,
+	   const int resolution)
+  {
+    typedef typename IBASIS::Index Index1D;
+    std::vector<Index1D> x_factors, y_factors;
+    std::vector<double> values;
+    for (typename InfiniteVector<double,int>::const_iterator it(coeffs.begin()),
+	   itend(coeffs.end()); it != itend; ++it) {
+      const typename TensorBasis<IBASIS,2>::WaveletHandle lambda(basis.get_wavelet(it.index()));
+      x_factors.push_back(Index1D(lambda->j()[0], lambda->e()[0], lambda->k()[0], basis.bases()[0]));
+      y_factors.push_back(Index1D(lambda->j()[1], lambda->e()[1], lambda->k()[1], basis.bases()[1]));
+      values.push_back(*it);
+    }
+    return evaluate_expansion(basis.bases(), x_factors, y_factors, values, primal, resolution);
+  }
 
-    return result;
+  template <class IBASIS>
+  SampledMapping<2>
+  evaluate_single_scale(const TensorBasis<IBASIS,2>& basis,
+			const InfiniteVector<double, typename TensorBasis<IBASIS,2>::Index>& coeffs,
+			const int resolution)
+  {
+    typedef typename IBASIS::Index Index1D;
+
+    // single-scale coefficients w.r.t. the generators on the levels jmax[i]+1
+    FixedArray1D<int,2> jmax;
+    Vector<double> y;
+    tensor_reconstruct(basis.bases(), coeffs, jmax, y);
+
+    const int n0 = basis.bases()[0]->Deltasize(jmax[0]+1);
+    const int n1 = basis.bases()[1]->Deltasize(jmax[1]+1);
+    std::vector<Index1D> x_factors, y_factors;
+    std::vector<double> values;
+    for (int k0 = 0; k0 < n0; k0++)
+      for (int k1 = 0; k1 < n1; k1++)
+	if (y[k0*n1+k1] != 0) {
+	  x_factors.push_back(Index1D(jmax[0]+1, 0, basis.bases()[0]->DeltaLmin()+k0, basis.bases()[0]));
+	  y_factors.push_back(Index1D(jmax[1]+1, 0, basis.bases()[1]->DeltaLmin()+k1, basis.bases()[1]));
+	  values.push_back(y[k0*n1+k1]);
+	}
+    return evaluate_expansion(basis.bases(), x_factors, y_factors, values, true, resolution);
   }
-  
 
   template <class IBASIS, unsigned int DIM>
   SampledMapping<DIM>
@@ -11,8 +11,12 @@
 #define	_WAVELETTL_TBASIS_EVALUATE_H
 
 
+#include <map>
+#include <vector>
 #include <algebra/infinite_vector.h>
+#include <algebra/matrix.h>
 #include <cube/tbasis.h>
+#include <cube/tbasis_fwt.h>
 #include <geometry/sampled_mapping.h>
 #include <geometry/point.h>
 #include <geometry/grid.h>
@@ -47,6 +51,9 @@ namespace WaveletTL
   /*!
     Evaluate an arbitrary linear combination of primal/dual wavelets
     on a dyadic subgrid of [0,1]^d.
+    For d=1,2, every appearing 1D factor is evaluated only once, and each
+    tensor product is only accumulated on the grid points within its support.
+    For d=2 and PARALLEL==1, the rows of the grid are distributed over the threads.
   */
   template <class IBASIS, unsigned int DIM>
   SampledMapping<DIM> evaluate(const TensorBasis<IBASIS,DIM>& basis,
@@ -59,6 +66,28 @@ namespace WaveletTL
 			       const InfiniteVector<double, int>& coeffs,
 			       const bool primal,
 			       const int resolution);
+
+  /*!
+    Evaluate a linear combination of primal wavelets on a dyadic subgrid of [0,1]^2
+    via the fast wavelet transform: the coefficients are transformed into single-scale
+    coefficients w.r.t. the generators on the levels jmax[i]+1 (see tbasis_fwt.h),
+    which are then evaluated as above. This pays off for large coefficient sets
+    with many wavelets per level. IBASIS has to provide apply_Tj().
+  */
+  template <class IBASIS>
+  SampledMapping<2> evaluate_single_scale(const TensorBasis<IBASIS,2>& basis,
+					  const InfiniteVector<double, typename TensorBasis<IBASIS,2>::Index>& coeffs,
+					  const int resolution);
+
+  /*!
+    point values of a 1D generator or wavelet on the grid 2^{-resolution}{0,...,2^resolution},
+    restricted to the grid points first,...,first+values.size()-1 outside of which they vanish
+  */
+  struct SupportValues1D
+  {
+    int first;
+    MathTL::Array1D<double> values;
+  };
 }
 
 #include <cube/tbasis_evaluate.cpp>
@@ -0,0 +1,129 @@
+// implementation for tbasis_fwt.h
+
+#include <cassert>
+#include <algorithm>
+
+namespace WaveletTL
+{
+  template <class IBASIS, unsigned int DIM>
+  unsigned int
+  tensor_size(const FixedArray1D<IBASIS*,DIM>& bases,
+	      const FixedArray1D<int,DIM>& jmax)
+  {
+    unsigned int size = 1;
+    for (unsigned int i = 0; i < DIM; i++)
+      size *= bases[i]->Deltasize(jmax[i]+1);
+    return size;
+  }
+
+  /*
+    apply the 1D transform (Tj or Tj^{-1}) of bases[i] to all fibers of y in direction i,
+    the fibers are independent, so they can be handled in parallel
+  */
+  template <class IBASIS, unsigned int DIM>
+  void
+  apply_tensor_direction(const FixedArray1D<IBASIS*,DIM>& bases,
+			 const FixedArray1D<int,DIM>& jmax,
+			 const unsigned int i,
+			 const bool inverse,
+			 Vector<double>& y)
+  {
+    const unsigned int length = bases[i]->Deltasize(jmax[i]+1);
+    unsigned int stride = 1;
+    for (unsigned int l = i+1; l < DIM; l++)
+      stride *= bases[l]->Deltasize(jmax[l]+1);
+    const long fibers = y.size()/length;
+
+#if PARALLEL==1
+#pragma omp parallel
+#endif
+    {
+      Vector<double> x_fiber(length, false), y_fiber(length, false);
+#if PARALLEL==1
+#pragma omp for schedule(static)
+#endif
+      for (long f = 0; f < fibers; f++) {
+	const unsigned int start = (f/stride)*length*stride + f%stride;
+	bool zero = true;
+	for (unsigned int m = 0; m < length; m++) {
+	  x_fiber[m] = y[start+m*stride];
+	  zero = zero && x_fiber[m] == 0;
+	}
+	if (zero) continue;
+	if (inverse)
+	  bases[i]->apply_Tjinv(jmax[i], x_fiber, y_fiber);
+	else
+	  bases[i]->apply_Tj(jmax[i], x_fiber, y_fiber);
+	for (unsigned int m = 0; m < length; m++)
+	  y[start+m*stride] = y_fiber[m];
+      }
+    }
+  }
+
+  template <class IBASIS, unsigned int DIM>
+  void
+  apply_tensor_Tj(const FixedArray1D<IBASIS*,DIM>& bases,
+		  const FixedArray1D<int,DIM>& jmax,
+		  const Vector<double>& x,
+		  Vector<double>& y)
+  {
+    assert(x.size() == tensor_size(bases, jmax));
+    y = x;
+    for (unsigned int i = 0; i < DIM; i++)
+      apply_tensor_direction(bases, jmax, i, false, y);
+  }
+
+  template <class IBASIS, unsigned int DIM>
+  void
+  apply_tensor_Tjinv(const FixedArray1D<IBASIS*,DIM>& bases,
+		     const FixedArray1D<int,DIM>& jmax,
+		     const Vector<double>& x,
+		     Vector<double>& y)
+  {
+    assert(x.size() == tensor_size(bases, jmax));
+    y = x;
+    for (unsigned int i = 0; i < DIM; i++)
+      apply_tensor_direction(bases, jmax, i, true, y);
+  }
+
+  template <class IBASIS, unsigned int DIM, class INDEX>
+  unsigned int
+  tensor_position(const FixedArray1D<IBASIS*,DIM>& bases,
+		  const FixedArray1D<int,DIM>& jmax,
+		  const INDEX& lambda)
+  {
+    unsigned int position = 0;
+    for (unsigned int i = 0; i < DIM; i++) {
+      assert(lambda.j()[i] <= jmax[i]);
+      // generators only live on the coarsest level
+      assert(lambda.e()[i] == 1 || lambda.j()[i] == bases[i]->j0());
+      position = position * bases[i]->Deltasize(jmax[i]+1)
+	+ (lambda.e()[i] == 0
+	   ? lambda.k()[i] - bases[i]->DeltaLmin()
+	   : bases[i]->Deltasize(lambda.j()[i]) + lambda.k()[i] - bases[i]->Nablamin());
+    }
+    return position;
+  }
+
+  template <class IBASIS, unsigned int DIM, class INDEX>
+  void
+  tensor_reconstruct(const FixedArray1D<IBASIS*,DIM>& bases,
+		     const InfiniteVector<double,INDEX>& coeffs,
+		     FixedArray1D<int,DIM>& jmax,
+		     Vector<double>& y)
+  {
+    for (unsigned int i = 0; i < DIM; i++)
+      jmax[i] = bases[i]->j0();
+    for (typename InfiniteVector<double,INDEX>::const_iterator it(coeffs.begin()), itend(coeffs.end());
+	 it != itend; ++it)
+      for (unsigned int i = 0; i < DIM; i++)
+	jmax[i] = std::max(jmax[i], (int)it.index().j()[i]);
+
+    Vector<double> x(tensor_size(bases, jmax));
+    for (typename InfiniteVector<double,INDEX>::const_iterator it(coeffs.begin()), itend(coeffs.end());
+	 it != itend; ++it)
+      x[tensor_position(bases, jmax, it.index())] = *it;
+
+    apply_tensor_Tj(bases, jmax, x, y);
+  }
+}
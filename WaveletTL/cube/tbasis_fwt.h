@@ -0,0 +1,85 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of WaveletTL - the Wavelet Template Library      |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner, Ulrich Friedrich                   |
+// +--------------------------------------------------------------------+
+
+#ifndef _WAVELETTL_TBASIS_FWT_H
+#define _WAVELETTL_TBASIS_FWT_H
+
+#include <algebra/vector.h>
+#include <algebra/infinite_vector.h>
+#include <utils/fixed_array1d.h>
+
+using MathTL::Vector;
+using MathTL::InfiniteVector;
+using MathTL::FixedArray1D;
+
+namespace WaveletTL
+{
+  /*
+   * Dimension-by-dimension fast wavelet transform for tensor product bases,
+   * i.e., for TensorBasis (use basis.bases()) and for the single patches of a QTBasis
+   * (use basis.bases()[p]). The 1D bases have to provide apply_Tj() and apply_Tjinv()
+   * (PBasis, DSBasis, SplineBasis).
+   *
+   * A coefficient tensor on the full grid of levels j0[i] <= j_i <= jmax[i] is stored
+   * in a Vector<double>, the last direction running fastest. In direction i, there are
+   * bases[i]->Deltasize(jmax[i]+1) entries, ordered as in the full collection of the 1D basis:
+   * generators on level j0[i], then the wavelets on the levels j0[i],...,jmax[i].
+   * After the transform, the entries in direction i are the generator coefficients
+   * on level jmax[i]+1, i.e., the tensor has the same size.
+   *
+   * The 1D transform is applied to all fibers along each direction. Fibers which vanish
+   * identically are skipped, so that block-sparse tensors are cheap. With PARALLEL==1,
+   * the fibers of each direction are distributed over the OpenMP threads.
+   */
+
+  //! size of the coefficient tensor on the full grid of levels <= jmax
+  template <class IBASIS, unsigned int DIM>
+  unsigned int tensor_size(const FixedArray1D<IBASIS*,DIM>& bases,
+			   const FixedArray1D<int,DIM>& jmax);
+
+  //! apply the tensor product of the 1D transforms Tj ("reconstruct")
+  template <class IBASIS, unsigned int DIM>
+  void apply_tensor_Tj(const FixedArray1D<IBASIS*,DIM>& bases,
+		       const FixedArray1D<int,DIM>& jmax,
+		       const Vector<double>& x,
+		       Vector<double>& y);
+
+  //! apply the tensor product of the 1D transforms Tj^{-1} ("decompose")
+  template <class IBASIS, unsigned int DIM>
+  void apply_tensor_Tjinv(const FixedArray1D<IBASIS*,DIM>& bases,
+			  const FixedArray1D<int,DIM>& jmax,
+			  const Vector<double>& x,
+			  Vector<double>& y);
+
+  /*!
+    position of a tensor product generator or wavelet in the coefficient tensor,
+    INDEX may be a TensorIndex or a QTIndex
+  */
+  template <class IBASIS, unsigned int DIM, class INDEX>
+  unsigned int tensor_position(const FixedArray1D<IBASIS*,DIM>& bases,
+			       const FixedArray1D<int,DIM>& jmax,
+			       const INDEX& lambda);
+
+  /*!
+    RECONSTRUCT routine for a sparse coefficient set:
+    computes the single-scale coefficients of \sum_\lambda c_\lambda\psi_\lambda,
+    i.e., the coefficients w.r.t. the tensor product generators on the levels jmax[i]+1,
+    where jmax[i] is the maximal level of coeffs in direction i.
+    For a QTBasis, coeffs have to be supported on a single patch.
+  */
+  template <class IBASIS, unsigned int DIM, class INDEX>
+  void tensor_reconstruct(const FixedArray1D<IBASIS*,DIM>& bases,
+			  const InfiniteVector<double,INDEX>& coeffs,
+			  FixedArray1D<int,DIM>& jmax,
+			  Vector<double>& y);
+}
+
+#include <cube/tbasis_fwt.cpp>
+
+#endif
@@ -179,6 +179,9 @@ namespace WaveletTL
             j_[0]=j;
             e_[0]=e;
             k_[0]=k;
+            // indices of the same basis are compared by their numbers, so compute it
+            if (basis != 0)
+                num_ = TensorIndex(j_, e_, k_, basis).number();
         }
 
 	template <class IBASIS, unsigned int DIM, class TENSORBASIS>
@@ -198,7 +201,7 @@ namespace WaveletTL
 	: basis_(basis), num_(number)
 	{
 #if _TBASIS_DEBUGLEVEL_ >= 1
-            cout << "TensorIndex(number) is called. Use full_collection[number] instead!" << endl;
+            cout << "TensorIndex(number) is called. Use TensorBasis::get_wavelet(number) instead!" << endl;
 #endif
           /* 
             This implementation for DIM = 2,3 assumes that Nablasize(j) = Deltasize(j0) + sum_{l=0}^{j-j0} 2^l * Nablasize(j0)
@@ -783,6 +786,8 @@ namespace WaveletTL
 	bool
 	TensorIndex<IBASIS, DIM, TENSORBASIS>::operator == (const TensorIndex<IBASIS, DIM, TENSORBASIS>& lambda) const
 	{
+            if (basis_ != 0 && basis_ == lambda.basis())
+                return num_ == lambda.number();
             return (j_ == lambda.j() &&
                     e_ == lambda.e() &&
                     k_ == lambda.k());
@@ -884,10 +889,46 @@ namespace WaveletTL
          
   	}
 
+	template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+	TensorIndex<IBASIS,DIM,TENSORBASIS>::TensorIndex(const key_type& key, const TENSORBASIS* basis)
+	: basis_(0)
+	{
+            level_type j;
+            type_type e;
+            translation_type k;
+            unsigned int pos(key_degree_bits); // |j|_1 is redundant
+            for (unsigned int i = 0; i < DIM; i++)
+                j[i] = key.get(pos, key_level_bits);
+            for (unsigned int i = 0; i < DIM; i++)
+                e[i] = key.get(pos, 1);
+            for (unsigned int i = 0; i < DIM; i++)
+                k[i] = key.get_signed(pos, key_translation_bits);
+            *this = TensorIndex(j, e, k, basis);
+	}
+
+	template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+	typename TensorIndex<IBASIS,DIM,TENSORBASIS>::key_type
+	TensorIndex<IBASIS,DIM,TENSORBASIS>::key() const
+	{
+            // the fields in the order of "<": level norm, then lexicographically j, e, k
+            key_type key;
+            unsigned int pos(0);
+            key.put(pos, multi_degree(j_), key_degree_bits);
+            for (unsigned int i = 0; i < DIM; i++)
+                key.put(pos, j_[i], key_level_bits);
+            for (unsigned int i = 0; i < DIM; i++)
+                key.put(pos, e_[i], 1);
+            for (unsigned int i = 0; i < DIM; i++)
+                key.put_signed(pos, k_[i], key_translation_bits);
+            return key;
+	}
+
 	template <class IBASIS, unsigned int DIM, class TENSORBASIS>
 	bool
 	TensorIndex<IBASIS,DIM,TENSORBASIS>::operator < (const TensorIndex& lambda) const
 	{
+            if (basis_ != 0 && basis_ == lambda.basis())
+                return num_ < lambda.number();
             // Ordering primary by level j as in MultiIndex
             // (ordering of \N^dim, that is the distance from 0, that is the same as
             // ordering first by 1-norm of j and in the case of equal norms lexicographical in j.)
@@ -1086,4 +1127,50 @@ namespace WaveletTL
             TensorIndex<IBASIS,DIM,TENSORBASIS> temp (last_wavelet<IBASIS,DIM,TENSORBASIS>(basis,level));
             return temp.number();
 	}
+
+        template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+        void
+        index_to_number(const InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >& v,
+                        InfiniteVector<double,int>& w)
+        {
+            w.clear();
+            for (typename InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >::const_iterator it(v.begin()), itend(v.end());
+                 it != itend; ++it)
+                w.set_coefficient(it.index().number(), *it);
+        }
+
+        template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+        void
+        number_to_index(const TENSORBASIS* basis,
+                        const InfiniteVector<double,int>& w,
+                        InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >& v)
+        {
+            v.clear();
+            for (typename InfiniteVector<double,int>::const_iterator it(w.begin()), itend(w.end());
+                 it != itend; ++it)
+                v.set_coefficient(*basis->get_wavelet(it.index()), *it);
+        }
+
+        template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+        void
+        index_to_key(const InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >& v,
+                     InfiniteVector<double,typename TensorIndex<IBASIS,DIM,TENSORBASIS>::key_type>& w)
+        {
+            w.clear();
+            for (typename InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >::const_iterator it(v.begin()), itend(v.end());
+                 it != itend; ++it)
+                w.set_coefficient(it.index().key(), *it);
+        }
+
+        template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+        void
+        key_to_index(const TENSORBASIS* basis,
+                     const InfiniteVector<double,typename TensorIndex<IBASIS,DIM,TENSORBASIS>::key_type>& w,
+                     InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >& v)
+        {
+            v.clear();
+            for (typename InfiniteVector<double,typename TensorIndex<IBASIS,DIM,TENSORBASIS>::key_type>::const_iterator it(w.begin()), itend(w.end());
+                 it != itend; ++it)
+                v.set_coefficient(TensorIndex<IBASIS,DIM,TENSORBASIS>(it.index(), basis), *it);
+        }
 }
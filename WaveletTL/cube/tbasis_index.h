@@ -16,9 +16,11 @@ using std::endl;
 
 #include <utils/multiindex.h>
 #include <utils/fixed_array1d.h>
+#include <utils/packed_key.h>
 #include <algebra/infinite_vector.h>
 using MathTL::InfiniteVector;
 using MathTL::MultiIndex;
+using MathTL::PackedKey;
 
 namespace WaveletTL
 {
@@ -39,6 +41,14 @@ namespace WaveletTL
         // translation index type
         typedef MultiIndex<int,DIM> translation_type;
 
+        // packed key type (see key()), one 64-bit word for DIM<=2, two words otherwise
+        typedef PackedKey<(DIM <= 2 ? 1 : 2)> key_type;
+
+        // bit widths of the fields of the packed key: |j|_1, j_i, e_i and the (biased) k_i
+        static const unsigned int key_degree_bits = 8;
+        static const unsigned int key_level_bits = 6;
+        static const unsigned int key_translation_bits = (key_type::bits - 8 - 7*DIM)/DIM;
+
         /*
          * Constructor with a given tensor basis
          * (also serves as a default constructor, but yields an invalid index
@@ -57,7 +67,7 @@ namespace WaveletTL
 
         /*
          * 1D dummy constructor. does not yield a complete TensorIndex
-         * number is always set to 0
+         * number is computed if a basis is given (and set to 0 otherwise)
          */
         TensorIndex(const int& j, const int& e, const int& k, const TENSORBASIS* empty);
 
@@ -69,6 +79,12 @@ namespace WaveletTL
 
         // Constructor with all parameters given
         TensorIndex(const level_type& j, const type_type& e, const translation_type& k, const int number, const TENSORBASIS* basis);
+
+        /*
+         * Constructor from a packed key (see key()),
+         * the number is computed as in TensorIndex(j,e,k,basis)
+         */
+        TensorIndex(const key_type& key, const TENSORBASIS* basis);
         
         /*
          * Constructor for given number of wavelet index.
@@ -87,7 +103,7 @@ namespace WaveletTL
          * Code is speed up by using explicit formulas for DIM=2,3
          * DIM=1 is not optimized as it shouldn't be used anyways
          * 
-         * full_collection[i] is an alternative! less CPU, more memory usage
+         * TensorBasis::get_wavelet(i) is an alternative, it uses the level offsets of the basis
         */
         TensorIndex(const int number, const TENSORBASIS* basis);
 
@@ -96,7 +112,8 @@ namespace WaveletTL
 
         /*
          * Check equality.
-         * Only (j,e,k) are testet. NOT the basis or number
+         * For two valid indices of the same basis, only the numbers are compared,
+         * otherwise only (j,e,k) are tested.
          */
         bool operator == (const TensorIndex& lambda) const;
 
@@ -109,7 +126,9 @@ namespace WaveletTL
 
         /* Ordering <
          * First by level, i.e. the 1-norm of j,
-         * then lexicographically w.r.t. j,e,k
+         * then lexicographically w.r.t. j,e,k.
+         * The numbering of the indices of a basis follows this ordering, so for two
+         * valid indices of the same basis this is a single comparison of the numbers.
          */
         bool operator < (const TensorIndex& lambda) const;
 
@@ -131,6 +150,14 @@ namespace WaveletTL
 
         const unsigned long int number() const { return num_; }
 
+        /*
+         * Compact key of the index: (|j|_1,j,e,k) packed into key_type::bits bits.
+         * Keys are ordered like the indices ("<"), and in contrast to number(),
+         * they do not depend on the basis. Levels up to 63 and translations
+         * |k_i| < 2^(key_translation_bits-1) can be represented.
+         */
+        key_type key() const;
+
     protected:
 
         // Pointer to the underlying basis
@@ -249,6 +276,34 @@ namespace WaveletTL
     
 
 
+    /*
+     * The number of an index is a compact key (an int instead of the (j,e,k) multiindices
+     * and the basis pointer) which preserves the ordering "<". The following routines
+     * convert coefficient vectors w.r.t. TensorIndex to vectors w.r.t. the numbers and back,
+     * e.g., for the solvers working with InfiniteVector<double,int>.
+     */
+    template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+    void index_to_number(const InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >& v,
+                         InfiniteVector<double,int>& w);
+
+    template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+    void number_to_index(const TENSORBASIS* basis,
+                         const InfiniteVector<double,int>& w,
+                         InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >& v);
+
+    /*
+     * The same for the packed keys (see TensorIndex::key()), which are also available
+     * if the full collection of the basis is not set up.
+     */
+    template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+    void index_to_key(const InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >& v,
+                      InfiniteVector<double,typename TensorIndex<IBASIS,DIM,TENSORBASIS>::key_type>& w);
+
+    template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+    void key_to_index(const TENSORBASIS* basis,
+                      const InfiniteVector<double,typename TensorIndex<IBASIS,DIM,TENSORBASIS>::key_type>& w,
+                      InfiniteVector<double,TensorIndex<IBASIS,DIM,TENSORBASIS> >& v);
+
     /*
      *  write InfiniteVector<double,Index> to stream
      * The only differences to the IO routines from qtbasis.h are that
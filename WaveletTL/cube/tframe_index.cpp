@@ -900,6 +900,57 @@ namespace WaveletTL
          
   	}
 
+	template <class IFRAME, unsigned int DIM>
+	TensorFrameIndex<IFRAME, DIM>::TensorFrameIndex(const key_type& key, const TensorFrame<IFRAME,DIM>* frame)
+	: frame_(frame), num_(0)
+	{
+            unsigned int pos(key_pdegree_bits); // |p|_1 and |j|_1 are redundant
+            for (unsigned int i = 0; i < DIM; i++)
+                p_[i] = key.get(pos, key_polynomial_bits);
+            pos += key_degree_bits;
+            for (unsigned int i = 0; i < DIM; i++)
+                j_[i] = key.get(pos, key_level_bits);
+            for (unsigned int i = 0; i < DIM; i++)
+                e_[i] = key.get(pos, 1);
+            for (unsigned int i = 0; i < DIM; i++)
+                k_[i] = key.get_signed(pos, key_translation_bits);
+
+            if (frame_ != 0 && frame_->get_setup_full_collection())
+            {
+                // the full collection is sorted, so are the keys of its elements
+                int low(0), high(frame_->degrees_of_freedom());
+                while (low < high)
+                {
+                    const int mid((low+high)/2);
+                    if (frame_->get_quarklet(mid)->key() < key)
+                        low = mid+1;
+                    else
+                        high = mid;
+                }
+                num_ = (low < frame_->degrees_of_freedom() && frame_->get_quarklet(low)->key() == key) ? low : -1;
+            }
+	}
+
+	template <class IFRAME, unsigned int DIM>
+	typename TensorFrameIndex<IFRAME,DIM>::key_type
+	TensorFrameIndex<IFRAME,DIM>::key() const
+	{
+            // the fields in the order of "<": polynomial norm, p, level norm, j, then e and k
+            key_type key;
+            unsigned int pos(0);
+            key.put(pos, multi_degree(p_), key_pdegree_bits);
+            for (unsigned int i = 0; i < DIM; i++)
+                key.put(pos, p_[i], key_polynomial_bits);
+            key.put(pos, multi_degree(j_), key_degree_bits);
+            for (unsigned int i = 0; i < DIM; i++)
+                key.put(pos, j_[i], key_level_bits);
+            for (unsigned int i = 0; i < DIM; i++)
+                key.put(pos, e_[i], 1);
+            for (unsigned int i = 0; i < DIM; i++)
+                key.put_signed(pos, k_[i], key_translation_bits);
+            return key;
+	}
+
 	template <class IFRAME, unsigned int DIM>
 	bool
 	TensorFrameIndex<IFRAME,DIM>::operator < (const TensorFrameIndex& lambda) const
@@ -16,9 +16,11 @@ using std::endl;
 
 #include <utils/multiindex.h>
 #include <utils/fixed_array1d.h>
+#include <utils/packed_key.h>
 #include <algebra/infinite_vector.h>
 using MathTL::InfiniteVector;
 using MathTL::MultiIndex;
+using MathTL::PackedKey;
 
 namespace WaveletTL
 {
@@ -41,6 +43,16 @@ namespace WaveletTL
         // translation index type
         typedef MultiIndex<int,DIM> translation_type;
 
+        // packed key type (see key()), one 64-bit word for DIM=1, two words otherwise
+        typedef PackedKey<(DIM == 1 ? 1 : 2)> key_type;
+
+        // bit widths of the fields of the packed key: |p|_1, p_i, |j|_1, j_i, e_i and the (biased) k_i
+        static const unsigned int key_pdegree_bits = 6;
+        static const unsigned int key_polynomial_bits = 4;
+        static const unsigned int key_degree_bits = 8;
+        static const unsigned int key_level_bits = 6;
+        static const unsigned int key_translation_bits = (key_type::bits - 6 - 8 - 11*DIM)/DIM;
+
         /*
          * Constructor with a given tensor frame
          * (also serves as a default constructor, but yields an invalid index
@@ -68,6 +80,13 @@ namespace WaveletTL
          */
 //        TensorFrameIndex(const int& p, const int& j, const int& e, const int& k, const TENSORFRAME* empty);
 
+        /*
+         * Constructor from a packed key (see key()). If the full collection of the frame
+         * is set up, the number is looked up there (and is (unsigned int)-1 for indices
+         * outside of the collection), otherwise it is set to 0.
+         */
+        TensorFrameIndex(const key_type& key, const TensorFrame<IFRAME,DIM>* frame);
+
         // Copy constructor
         TensorFrameIndex(const TensorFrameIndex& lambda);
 
@@ -142,6 +161,14 @@ namespace WaveletTL
 
         const unsigned int& number() const { return num_; }
 
+        /*
+         * Compact key of the index: (|p|_1,p,|j|_1,j,e,k) packed into key_type::bits bits.
+         * Keys are ordered like the indices ("<"), and in contrast to number(), they are
+         * available without the full collection of the frame. Polynomial degrees up to 15,
+         * levels up to 63 and translations |k_i| < 2^(key_translation_bits-1) can be represented.
+         */
+        key_type key() const;
+
     protected:
 
         // Pointer to the underlying frame
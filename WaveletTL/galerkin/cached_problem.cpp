@@ -1,6 +1,9 @@
 // implementation for cached_problem.h
 
 #include <cmath>
+#include <sstream>
+#include <typeinfo>
+#include <vector>
 #include <algebra/vector.h>
 #include <numerics/eigenvalues.h>
 #include <galerkin/galerkin_utils.h>
@@ -11,225 +14,191 @@ namespace WaveletTL
   CachedProblem<PROBLEM>::CachedProblem(const PROBLEM* P,
 					const double estnormA,
 					const double estnormAinv)
-    : problem(P), normA(estnormA), normAinv(estnormAinv)
+    : problem(P), cache_filename(), cache_filekey(), norm_store_filename(), norm_store_key(),
+      normA(estnormA), normAinv(estnormAinv)
   {
   }
 
   template <class PROBLEM>
-  double
-  CachedProblem<PROBLEM>::a(const Index& lambda,
-			    const Index& nu) const
+  CachedProblem<PROBLEM>::~CachedProblem()
   {
-    double r = 0;
-    
-    
-#if 1
-//! DO use cache
-    
-    if (problem->local_operator()) {
-        
-        
-      const int lambda_num = lambda.number();
-      //cout << "number: " << lambda_num << endl;
-      const int nu_num = nu.number();
-      //cout << "number2: " << nu_num << endl;
-      
-      // BE CAREFUL: KEY OF GENERATOR LEVEL IS j0-1 NOT j0 !!!!
-      typedef typename Index::type_type generator_type;
-      int j = (lambda.e() == generator_type()) ? (lambda.j()-1) : lambda.j();
-      
-      // check wether entry has already been computed
-      typedef std::list<Index> IntersectingList;
-
-      // search for column 'mu'
-      typename ColumnCache::iterator col_lb(entries_cache.lower_bound(nu_num));
-      typename ColumnCache::iterator col_it(col_lb);
-      
-      if (col_lb == entries_cache.end() ||
-	  entries_cache.key_comp()(nu_num, col_lb->first))
-	
-	{
-	  // insert a new column
-	  typedef typename ColumnCache::value_type value_type;
-	  col_it = entries_cache.insert(col_lb, value_type(nu_num, Column()));
-	}
-	  
-      Column& col(col_it->second);
-      
-      // check wether the level 'lambda' belongs to has already been calculated
-      typename Column::iterator lb(col.lower_bound(j));
-      typename Column::iterator it(lb);
-
-      // no entries have ever been computed for this column and this level
-      if (lb == col.end() ||
-	  col.key_comp()(j, lb->first))
-	{
-	  // compute whole level block
-	  // #### ONLY CDD COMPRESSION STRATEGY IMPLEMENTED ####
-	  // #### MAYBE WE ADD TRUNK FOR STEVENSON APPROACH ####
-	  // #### LATER.                                    ####
-	  
-	  // insert a new level
-	  typedef typename Column::value_type value_type;
-	  it = col.insert(lb, value_type(j, Block()));
+    // the key was computed by set_cache_file(), *problem may already be destroyed
+    if (!cache_filename.empty())
+      entries_cache.save(cache_filename.c_str(), cache_filekey);
+  }
 
-	  Block& block(it->second);	  
+  template <class PROBLEM>
+  std::string
+  CachedProblem<PROBLEM>::cache_key(const std::string& description) const
+  {
+    // the entries of the first and last generators on the coarsest level enter the key,
+    // so that other coefficients or boundary conditions give another key
+    std::vector<Index> generators;
+    for (Index lambda = basis().first_generator(basis().j0());; ++lambda) {
+      generators.push_back(lambda);
+      if (lambda == basis().last_generator(basis().j0())) break;
+    }
+    if (generators.size() > 8)
+      generators.erase(generators.begin()+4, generators.end()-4);
+    std::vector<double> entries;
+    for (unsigned int i(0); i < generators.size(); i++)
+      for (unsigned int k(0); k < generators.size(); k++)
+	entries.push_back(problem->a(generators[i], generators[k]));
+
+    std::ostringstream key;
+    key << typeid(PROBLEM).name()
+	<< " dof=" << basis().degrees_of_freedom()
+	<< " a=" << std::hex << StiffnessCacheFile::fingerprint(entries) << std::dec
+	<< " " << description;
+    return key.str();
+  }
 
-	  IntersectingList nus;
-	   
-	  intersecting_wavelets(basis(), nu,
-				std::max(j, basis().j0()),
-				j == (basis().j0()-1),
-				nus);
+  template <class PROBLEM>
+  bool
+  CachedProblem<PROBLEM>::load_cache(const char* filename, const std::string& description)
+  {
+    return entries_cache.map_file(filename, cache_key(description));
+  }
 
-	  // compute entries
-	  //  cout << "intersecting wavelets/generators for " << nu << ": " << endl;  // Christoph
-	    for (typename IntersectingList::const_iterator it(nus.begin()), itend(nus.end());
-	         it != itend; ++it)
-        {
-	      double entry = problem->a(*it, nu);
-#ifdef P_POISSON
-          number_of_entries_computed++;  //! Christoph
-#endif
-	     // cout << "cp: size: " << nus.size() << " index=" << *it  << " entry=" << entry << " number: " << (*it).number() << endl; // Christoph
+  template <class PROBLEM>
+  bool
+  CachedProblem<PROBLEM>::save_cache(const char* filename, const std::string& description) const
+  {
+    return entries_cache.save(filename, cache_key(description));
+  }
 
-	      typedef typename Block::value_type value_type_block;
-	      if (entry != 0.)
-	      {
-	        block.insert(block.end(), value_type_block((*it).number(), entry));
-	        if ((*it).number() == lambda_num)
-	        {
-		      r = entry;
-	        }
-	      }
-	    }
+  template <class PROBLEM>
+  void
+  CachedProblem<PROBLEM>::set_cache_file(const char* filename, const std::string& description)
+  {
+    cache_filename = filename;
+    cache_filekey = cache_key(description);
+    entries_cache.map_file(filename, cache_filekey);
+  }
 
-//	    cout << "return r: " << r << endl;
-	  }
-      // level already exists --> extract row corresponding to 'lambda'
-      else
-      {
-	    Block& block(it->second);
+  template <class PROBLEM>
+  void
+  CachedProblem<PROBLEM>::compute_entries(const Index& nu, const int j,
+					  std::vector<int>& rows, std::vector<double>& entries) const
+  {
+    typedef std::list<Index> IndexList;
+    IndexList nus;
+    if (problem->local_operator()) {
+      // compute only the entries with intersecting supports
+      // #### ONLY CDD COMPRESSION STRATEGY IMPLEMENTED ####
+      // #### MAYBE WE ADD TRUNK FOR STEVENSON APPROACH ####
+      // #### LATER.                                    ####
+      intersecting_wavelets(basis(), nu,
+			    std::max(j, basis().j0()),
+			    j == (basis().j0()-1),
+			    nus);
+    } else {
+      // for nonlocal operators, we put full level blocks into the cache, regardless of support intersections
+      if (j == (basis().j0()-1)) {
+	// generators on level j0
+	for (Index lambda1 = basis().first_generator(basis().j0());; ++lambda1) {
+	  nus.push_back(lambda1);
+	  if (lambda1 == basis().last_generator(basis().j0())) break;
+	}
+      } else {
+	// wavelets on level j
+	for (Index lambda1 = basis().first_wavelet(j);; ++lambda1) {
+	  nus.push_back(lambda1);
+	  if (lambda1 == basis().last_wavelet(j)) break;
+	}
+      }
+    }
 
- 	    //typename Block::iterator block_lb(block.lower_bound(lambda));
-	    typename Block::iterator block_lb(block.lower_bound(lambda_num));
- 	    typename Block::iterator block_it(block_lb);
-	    // level exists, but in row 'lambda' no entry is available ==> entry must be zero
-	    if (block_lb == block.end() ||
-	        block.key_comp()(lambda_num, block_lb->first))
-	    {
-	      r = 0;
-	    }
-	    else
-	    {
-	      r = block_it->second;
-	    }
+    // compute entries
+    for (typename IndexList::const_iterator it(nus.begin()), itend(nus.end());
+	 it != itend; ++it) {
+      const double entry = problem->a(*it, nu);
 #ifdef P_POISSON
-        number_of_entries_from_cache++;  //! Christoph
+      number_of_entries_computed++;  //! Christoph
 #endif
+      if (problem->local_operator() ? entry != 0. : fabs(entry) > 1e-16) {
+	rows.push_back((*it).number());
+	entries.push_back(entry);
       }
     }
-    else  // nonlocal operator
-    {
-      // for nonlocal operators, we put full level blocks into the cache, regardless of support intersections
-
-      const int lambda_num = lambda.number();
-      const int nu_num = nu.number();
-      
-       // BE CAREFUL: KEY OF GENERATOR LEVEL IS j0-1 NOT j0 !!!!
-      typedef typename Index::type_type generator_type;
-      int j = (lambda.e() == generator_type()) ? (lambda.j()-1) : lambda.j();
-
-      // search for column 'mu'
-      typename ColumnCache::iterator col_lb(entries_cache.lower_bound(nu_num));
-      typename ColumnCache::iterator col_it(col_lb);
-
-      if (col_lb == entries_cache.end() ||
-	  entries_cache.key_comp()(nu_num, col_lb->first))
-	  {
-	    // insert a new column
-	    typedef typename ColumnCache::value_type value_type;
-	    col_it = entries_cache.insert(col_lb, value_type(nu_num, Column()));
-	  }
-
-      Column& col(col_it->second);
-
-      // check wether the level block which 'lambda' belongs to has already been calculated
-      typename Column::iterator lb(col.lower_bound(j));
-      typename Column::iterator it(lb);
-
-      if (lb == col.end() ||
-	     col.key_comp()(j, lb->first))
-	  {
-	    // no entries have ever been computed for this column and this level
+  }
 
-	    // compute whole level block
+  template <class PROBLEM>
+  inline
+  EntryCache::Block
+  CachedProblem<PROBLEM>::insert_block(const Index& nu, const int j,
+				       const std::vector<int>& rows, const std::vector<double>& entries) const
+  {
+    // BE CAREFUL: KEY OF GENERATOR LEVEL IS j0-1 NOT j0 !!!!
+    typedef typename Index::type_type generator_type;
+    const int nu_j = (nu.e() == generator_type()) ? (nu.j()-1) : nu.j();
 
-	    // insert a new level
-	    typedef typename Column::value_type value_type;
-	    it = col.insert(lb, value_type(j, Block()));
+    return entries_cache.insert(nu.number(), j, abs(j-nu_j), rows, entries);
+  }
 
-	    Block& block(it->second);
+  template <class PROBLEM>
+  EntryCache::Block
+  CachedProblem<PROBLEM>::compute_block(const Index& nu, const int j) const
+  {
+    std::vector<int> rows;
+    std::vector<double> entries;
+    compute_entries(nu, j, rows, entries);
+    return insert_block(nu, j, rows, entries);
+  }
 
-	    // collect all indices in the level block
-	    typedef std::list<Index> IndexList;
-	    IndexList nus;
-	    if (j == (basis().j0()-1))
-	    {
-	      // generators on level j0
-	      for (Index lambda1 = basis().first_generator(basis().j0());; ++lambda1)
-	      {
-            nus.push_back(lambda1);
-	        if (lambda1 == basis().last_generator(basis().j0()))
-	          break;
-	      }
-	    }
-	    else
-	    {
-	      // wavelets on level j
-	      for (Index lambda1 = basis().first_wavelet(j);; ++lambda1)
-	      {
-	        nus.push_back(lambda1);
-	        if (lambda1 == basis().last_wavelet(j))
-	          break;
-	      }
-	    }
+  template <class PROBLEM>
+  inline
+  EntryCache::Block
+  CachedProblem<PROBLEM>::column_block(const Index& nu, const int j) const
+  {
+    EntryCache::Block block;
+    if (entries_cache.find(nu.number(), j, block) && !block.partial()) {
+#ifdef P_POISSON
+      number_of_entries_from_cache++;  //! Christoph
+#endif
+      return block;
+    }
+    return compute_block(nu, j);
+  }
 
-	    // compute entries
-	    for (typename IndexList::const_iterator it(nus.begin()), itend(nus.end());
-	       it != itend; ++it)
-        {
-	      const double entry = problem->a(*it, nu);
-	      typedef typename Block::value_type value_type_block;
-	      if (fabs(entry) > 1e-16 )
-	      {
-	        block.insert(block.end(), value_type_block((*it).number(), entry));
-	        if ((*it).number() == lambda_num)
-	        {
-		      r = entry;
-	        }
-	      }
-	    }
-	  }
-      // level already exists --> extract row corresponding to 'lambda'
-      else
-      {
-	    Block& block(it->second);
+  template <class PROBLEM>
+  double
+  CachedProblem<PROBLEM>::a(const Index& lambda,
+			    const Index& nu) const
+  {
+    double r = 0;
+    
+#if 1
+//! DO use cache
 
-	    typename Block::iterator block_lb(block.lower_bound(lambda_num));
- 	    typename Block::iterator block_it(block_lb);
-	    // level exists, but in row 'lambda' no entry is available ==> entry must be zero
-	    if (block_lb == block.end() ||
-	        block.key_comp()(lambda_num, block_lb->first))
-        {
-	      r = 0;
-	    }
-	    else
-	    {
-	      r = block_it->second;
-	    }
+    // BE CAREFUL: KEY OF GENERATOR LEVEL IS j0-1 NOT j0 !!!!
+    typedef typename Index::type_type generator_type;
+    const int j = (lambda.e() == generator_type()) ? (lambda.j()-1) : lambda.j();
+
+    // extract the row corresponding to 'lambda' from the level block of column 'nu';
+    // if there is no entry in row 'lambda', it must be zero
+#if PARALLEL_GALERKIN_UTILS==1
+    // setup_stiffness_matrix() calls a() from several threads, so the entries cache
+    // is only accessed in a critical section; a missing block is computed outside of it
+    bool found = false;
+#pragma omp critical (cached_problem_entries)
+    {
+      EntryCache::Block block;
+      if (entries_cache.find(nu.number(), j, block) && !block.partial()) {
+	r = block.entry(lambda.number());
+	found = true;
       }
     }
+    if (!found) {
+      std::vector<int> rows;
+      std::vector<double> entries;
+      compute_entries(nu, j, rows, entries);
+#pragma omp critical (cached_problem_entries)
+      r = insert_block(nu, j, rows, entries).entry(lambda.number());
+    }
+#else
+    r = column_block(nu, j).entry(lambda.number());
+#endif
 
 #else
 //! DONT use cache
@@ -256,10 +225,11 @@ namespace WaveletTL
   }
   
   template <class PROBLEM>
+  template <class VECTOR>
   void
   CachedProblem<PROBLEM>::add_level(const Index& lambda,
 				     //InfiniteVector<double, Index>& w,
-				     Vector<double>& w,
+				     VECTOR& w,
 				     const int j,
 				     const double factor,
 				     const int J,
@@ -271,354 +241,159 @@ namespace WaveletTL
   {
     if (problem->local_operator()) {
 
-      int lambda_num = lambda.number();
+      // a partial block (see below) holds only the entries near the singular support
+      // of lambda, these are all we need if the level distance is too large
+      const bool full_level = abs(lambda.j()-j) <= J/((double) problem->space_dimension);
 
-      // search for column 'lambda'
-      typedef std::list<Index> IntersectingList;
-      typename ColumnCache::iterator col_lb(entries_cache.lower_bound(lambda_num));
-      typename ColumnCache::iterator col_it(col_lb);
-	 
-      if (col_lb == entries_cache.end() ||
-	  entries_cache.key_comp()(lambda_num,col_lb->first))
-	{
-	  // insert a new column
-	  typedef typename ColumnCache::value_type value_type;
-	  col_it = entries_cache.insert(col_lb, value_type(lambda_num, Column()));
-	}
-
-      Column& col(col_it->second);
-
-      // check wether the level has already been calculated
-      typename Column::iterator lb(col.lower_bound(j));
-      typename Column::iterator it(lb);
-
-      if (lb == col.end() ||
-	  col.key_comp()(j, lb->first))
-	{
-	  // no entries have ever been computed for this column and this level
-	  
-	  // insert a new level
-	  typedef typename Column::value_type value_type;
-	  it = col.insert(lb, value_type(j, Block()));
+      EntryCache::Block block;
+      if (!entries_cache.find(lambda.number(), j, block)
+	  || (block.partial() && (strategy != St04a || full_level))) {
+	// no (sufficient) entries have ever been computed for this column and this level
 
+	if (strategy == St04a && !full_level) {
+	  // compute and cache only the entries which are not discarded by the compression,
+	  // the block is flagged as partial, so that it is never used as the complete block
+	  typedef std::list<Index> IntersectingList;
 	  IntersectingList nus;
-
 	  intersecting_wavelets(basis(), lambda,
 				std::max(j, basis().j0()),
 				j == (basis().j0()-1),
 				nus);
 
-	  Block& block(it->second);
-
-	    // do the rest of the job
-	    const double d1 = D(lambda);
-	    if (strategy == St04a)
-	    {
-	      for (typename IntersectingList::iterator it2(nus.begin()), itend2(nus.end());
-		   it2 != itend2; ++it2)
-          {
-	        if (abs(lambda.j()-j) <= J/((double) problem->space_dimension) ||
-		      intersect_singular_support(problem->basis(), lambda, *it2))
-		    {
-		      const double entry = problem->a(*it2, lambda);
-		      typedef typename Block::value_type value_type_block;
-		      block.insert(block.end(), value_type_block((*it2).number(), entry));
-		      //w.add_coefficient(*it2, (entry / (d1*problem->D(*it2))) * factor);
-		      w[(*it2).number()] += (entry / (d1*D(*it2))) * factor;
-	        }
-	      }
-	    }
-
-	    else if (strategy == CDD1)
-	    {
-
-	      for (typename IntersectingList::const_iterator it2(nus.begin()), itend2(nus.end());
-		   it2 != itend2; ++it2)
-		  {
-	        const double entry = problem->a(*it2, lambda);
-	        typedef typename Block::value_type value_type_block;
-	        if (entry != 0.)
-	        {
-		      block.insert(block.end(), value_type_block((*it2).number(), entry));
-	          //w.add_coefficient(*it2, (entry / (d1 * problem->D(*it2))) * factor);
-		      w[(*it2).number()] += (entry / (d1*D(*it2))) * factor;
-	        }
-	      }
+	  typedef typename Index::type_type generator_type;
+	  const int lambda_j = (lambda.e() == generator_type()) ? (lambda.j()-1) : lambda.j();
+	  const double d1 = D(lambda);
+	  std::vector<int> rows;
+	  std::vector<double> entries;
+	  for (typename IntersectingList::iterator it2(nus.begin()), itend2(nus.end());
+	       it2 != itend2; ++it2) {
+	    if (intersect_singular_support(problem->basis(), lambda, *it2)) {
+	      const double entry = problem->a(*it2, lambda);
+	      rows.push_back((*it2).number());
+	      entries.push_back(entry);
+	      //w.add_coefficient(*it2, (entry / (d1*problem->D(*it2))) * factor);
+	      w[(*it2).number()] += (entry / (d1*D(*it2))) * factor;
 	    }
 	  }
-      else {
-	  // level already exists --> extract level from cache
+	  entries_cache.insert(lambda.number(), j, abs(j-lambda_j), rows, entries, true);
+	  return;
+	}
 
-	    Block& block(it->second);
+	if (strategy != CDD1 && strategy != St04a)
+	  return;
 
-	    const double d1 = D(lambda);
+	block = compute_block(lambda, j);
+      }
 
-	    // do the rest of the job
-	    if (strategy == St04a)
+      // extract level from cache: D() may insert into the cache (and thus evict
+      // the block when a memory limit is set), so we copy the block first
+      const std::vector<int> rows(block.rows(), block.rows()+block.size());
+      const std::vector<double> values(block.values(), block.values()+block.size());
+      const double d1 = D(lambda);
+
+      // do the rest of the job
+      if (strategy == St04a) {
+	for (unsigned int i(0); i < rows.size(); i++) {
+	  if (full_level ||
+	      intersect_singular_support(problem->basis(), lambda, *(problem->basis().get_wavelet(rows[i])))) {
+// 	    w.add_coefficient(*(problem->basis().get_wavelet(rows[i])),
+// 			      (values[i] / (d1*problem->D(*(problem->basis().get_wavelet(rows[i]))))) * factor);
+	    w[rows[i]] += (values[i] / (d1*D(*(problem->basis().get_wavelet(rows[i]))))) * factor;
+	  }
+	}
+      }
+      else if (strategy == CDD1) {
+	for (unsigned int i(0); i < rows.size(); i++) {
+// 	  w.add_coefficient(*(problem->basis().get_wavelet(rows[i])),
+// 			    (values[i] / (d1 * problem->D( *(problem->basis().get_wavelet(rows[i])) )))  * factor);
+	  w[rows[i]] += (values[i] / (d1*D(*(problem->basis().get_wavelet(rows[i]))))) * factor;
+	  // Check sanity of cache:
+#if 0
+	  double entry_new_computed = (problem->a((problem->basis().get_wavelet(rows[i])), lambda));
+	  double entry_from_cache = values[i];
+	  double diff = entry_new_computed - entry_from_cache;
+	  if (abs(diff) > 1e-15)
 	    {
-
-	      for (typename Block::const_iterator it2(block.begin()), itend2(block.end());
-	           it2 != itend2; ++it2)
-          {
- 	        if (abs(lambda.j()-j) <= J/((double) problem->space_dimension) ||
- 		      intersect_singular_support(problem->basis(), lambda, *(problem->basis().get_wavelet(it2->first))))
- 		    {
-// 	          w.add_coefficient(*(problem->basis().get_wavelet(it2->first)),
-// 				(it2->second / (d1*problem->D(*(problem->basis().get_wavelet(it2->first))))) * factor);
-
-	          w[it2->first] += (it2->second / (d1*D(*(problem->basis().get_wavelet(it2->first))))) * factor;
-
-	        }
-	      }
+	      cout << "add_level: from cache: "  << entry_from_cache << " newly computed: " << entry_new_computed << endl;
+	      cout << "add_level diff: " << diff << endl;
+	      exit(1);
 	    }
-	    else if (strategy == CDD1)
-	    {
-	      for (typename Block::const_iterator it2(block.begin()), itend2(block.end());
-	           it2 != itend2; ++it2)
-          {
-// 	        w.add_coefficient(*(problem->basis().get_wavelet(it2->first)),
-// 			      (it2->second / (d1 * problem->D( *(problem->basis().get_wavelet(it2->first)) )))  * factor);
-
-
-// Christoph: original:
-              w[it2->first] += (it2->second / (d1*D(*(problem->basis().get_wavelet(it2->first))))) * factor;
-// Christoph: von mir:
-              //w[it2->first] += ((problem->a((problem->basis().get_wavelet(it2->first)), lambda)) / (d1*problem->D(*(problem->basis().get_wavelet(it2->first))))) * factor;
-	          // Check sanity of cache:
-#if 0
-	          double entry_new_computed = (problem->a((problem->basis().get_wavelet(it2->first)), lambda));
-	          double entry_from_cache = it2->second;
-	          double diff = entry_new_computed - entry_from_cache;
-	          if (abs(diff) > 1e-15)
-	          {
-                cout << "add_level: from cache: "  << entry_from_cache << " newly computed: " << entry_new_computed << endl;
-	            cout << "add_level diff: " << diff << endl;
-                exit(1);
-              }
 #endif
-	      }
-	    }
-      }// end else
+	}
+      }
     }  // end if problem->local_operator()
     else {
       // for nonlocal operators, we put full level blocks into the cache, regardless of support intersections
+      const EntryCache::Block block(column_block(lambda, j));
 
-      const int lambda_num = lambda.number();
-
-      // search for column 'lambda'
-      typename ColumnCache::iterator col_lb(entries_cache.lower_bound(lambda_num));
-      typename ColumnCache::iterator col_it(col_lb);
-      
-      if (col_lb == entries_cache.end() ||
-	  entries_cache.key_comp()(lambda_num, col_lb->first))
-	{
-	  // insert a new column
-	  typedef typename ColumnCache::value_type value_type;
-	  col_it = entries_cache.insert(col_lb, value_type(lambda_num, Column()));
-	}
-      
-      Column& col(col_it->second);
-      
-      // check wether the level block which 'lambda' belongs to has already been calculated
-      typename Column::iterator lb(col.lower_bound(j));
-      typename Column::iterator it(lb);
-      
-      if (lb == col.end() ||
-	  col.key_comp()(j, lb->first))
-	{
-	  // no entries have ever been computed for this column and this level
-	  
-	  // compute whole level block
-	  
-	  // insert a new level
- 	  typedef typename Column::value_type value_type;
- 	  it = col.insert(lb, value_type(j, Block()));
-
- 	  Block& block(it->second);  
-
-	  // collect all indices in the level block
-	  typedef std::list<Index> IndexList;
-	  IndexList nus;
-	  if (j == (basis().j0()-1)) {
-	    // generators on level j0
-	    for (Index lambda1 = basis().first_generator(basis().j0());; ++lambda1) {
-	      nus.push_back(lambda1);
-	      if (lambda1 == basis().last_generator(basis().j0())) break;
-	    }
-	  } else {
-	    // wavelets on level j
-	    for (Index lambda1 = basis().first_wavelet(j);; ++lambda1) {
-	      nus.push_back(lambda1);
-	      if (lambda1 == basis().last_wavelet(j)) break;
-	    }
-	  }
-
-	  // compute entries
-	  const double d1 = problem->D(lambda);
-	  for (typename IndexList::const_iterator it2(nus.begin()), itend2(nus.end());
-	       it2 != itend2; ++it2) {
-	    const double entry = problem->a(*it2, lambda);
- 	    typedef typename Block::value_type value_type_block;
-	    if (fabs(entry) > 1e-16) {
-  	      block.insert(block.end(), value_type_block((*it2).number(), entry));
-	      w[(*it2).number()] += (entry / (d1*problem->D(*it2))) * factor;
-	    }
-	  } 
-	}
-      else {
- 	// level already exists --> extract level from cache
-
- 	Block& block(it->second);
-
- 	const double d1 = problem->D(lambda);
-
- 	for (typename Block::const_iterator it(block.begin()), itend(block.end());
- 	     it != itend; ++it) {
- 	  w[it->first] += (it->second / (d1*problem->D(*(problem->basis().get_wavelet(it->first))))) * factor;
- 	}
-      }
+      const double d1 = problem->D(lambda);
+      for (unsigned int i(0); i < block.size(); i++)
+	w[block.row(i)] += (block.value(i) / (d1*problem->D(*(problem->basis().get_wavelet(block.row(i)))))) * factor;
+    }
+  }
+  template <class PROBLEM>
+  void
+  CachedProblem<PROBLEM>::set_norm_store(const char* filename, const std::string& description)
+  {
+    norm_store_filename = filename;
+    norm_store_key = cache_key(description);
+    double nA, nAinv;
+    if (load_norm_estimates(filename, norm_store_key, nA, nAinv)) {
+      if (normA == 0.0) normA = nA;
+      if (normAinv == 0.0) normAinv = nAinv;
     }
   }
-
 
   template <class PROBLEM>
-  double
-  CachedProblem<PROBLEM>::norm_A() const
+  void
+  CachedProblem<PROBLEM>::compute_norms() const
   {
-    if (normA == 0.0) {
 #if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
-      cout << "CachedProblem()::norm_A() called..." << endl;
+    cout << "CachedProblem()::compute_norms() called..." << endl;
 #endif
 
-      std::set<Index> Lambda;
-      const int j0 = problem->basis().j0();
-      const int jmax = std::min(j0+2, problem->basis().jmax());
+    std::set<Index> Lambda;
+    const int j0 = problem->basis().j0();
+    const int jmax = std::min(j0+2, problem->basis().jmax());
 
-      for (Index lambda = problem->basis().first_generator(j0);; ++lambda) {
-	Lambda.insert(lambda);
-	if (lambda == problem->basis().last_wavelet(jmax)) break;
-        //if (i==7) break;
-      }
-      SparseMatrix<double> A_Lambda;
-#if 1
-      setup_stiffness_matrix(*this, Lambda, A_Lambda);
+    for (Index lambda = problem->basis().first_generator(j0);; ++lambda) {
+      Lambda.insert(lambda);
+      if (lambda == problem->basis().last_wavelet(jmax)) break;
+    }
+    SparseMatrix<double> A_Lambda;
+    setup_stiffness_matrix(*this, Lambda, A_Lambda);
 
-      Vector<double> xk(Lambda.size(), false), yk(Lambda.size(), false);
-      xk = 1, yk=1;
-      unsigned int iterations;
-      double lambdamax = MathTL::PowerIteration(A_Lambda, xk, 1e-3, 100, iterations);
-      double lambdamin = MathTL::InversePowerIteration(A_Lambda, yk, 1e-1,  1e-3, 100, iterations);
-      normA = lambdamax;
-      normAinv = 1./lambdamin;
-#else
-      MathTL::Matrix<double> evecs;
-      Vector<double> evals;
-      setup_stiffness_matrix(*this, Lambda, A_Lambda);
-      A_Lambda.compress(1e-10);
-      
-#if 0
-      double help;
-      unsigned int iterations;
-      LanczosIteration(A_Lambda, 1e-6, help, normA, 200, iterations);
-      normAinv = 1./help;
-      cout << "Norm:" << normA << endl;
-      cout << "inv Norm:" << normAinv << endl;
-      //cout << help << endl;
-      cout << "Iter: " << iterations << endl;
-#else
-      //LanczosIteration(A_Lambda, 1e-6, help, normA, 200, iterations);
-      SymmEigenvalues(A_Lambda, evals, evecs);
-      
-      //cout << "Eigenwerte: " << evals << endl;
-      //cout << "Eigenvektoren: " << endl << evecs << endl;
-      normA = evals(evals.size()-1);
-      //cout << "normA: " << normA << endl;
-      int i = 0;
-      while(abs(evals(i))<1e-10){
-          ++i;
-      }
-      //cout << "rezinvers: " <<evals(i) << endl;;
-      normAinv = 1./evals(i);
-      //cout << "inversnorm: " << normAinv << endl;
-#endif
-#endif
+    // both ends of the spectrum from the same Krylov space, no inner CG iterations
+    double lambdamin, lambdamax;
+    unsigned int iterations;
+    LanczosIteration(A_Lambda, 1e-6, lambdamin, lambdamax, 200, iterations);
+    normA = lambdamax;
+    normAinv = 1./lambdamin;
 
+    if (!norm_store_filename.empty())
+      save_norm_estimates(norm_store_filename.c_str(), norm_store_key, normA, normAinv);
 
 #if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
-      cout << "... done!" << endl;
+    cout << "... done (" << iterations << " Lanczos iterations)!" << endl;
 #endif
-    }
+  }
+
+  template <class PROBLEM>
+  double
+  CachedProblem<PROBLEM>::norm_A() const
+  {
+    if (normA == 0.0)
+      compute_norms();
 
     return normA;
   }
 
-
   template <class PROBLEM>
   double
   CachedProblem<PROBLEM>::norm_Ainv() const
   {
-    if (normAinv == 0.0) {
-#if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
-      cout << "CachedProblem()::norm_Ainv() called..." << endl;
-#endif
-
-      std::set<Index> Lambda;
-      const int j0 = problem->basis().j0();
-      const int jmax = std::min(j0+2, problem->basis().jmax());
-
-      for (Index lambda = problem->basis().first_generator(j0);; ++lambda) {
-	Lambda.insert(lambda);
-        //cout << lambda << endl;
-	if (lambda == problem->basis().last_wavelet(jmax)) break;
-      }
-      SparseMatrix<double> A_Lambda;
-#if 1
-      setup_stiffness_matrix(*this, Lambda, A_Lambda);
-
-      Vector<double> xk(Lambda.size(), false), yk(Lambda.size(), false);
-      xk = 1, yk=1;
-      unsigned int iterations;
-      double lambdamax = MathTL::PowerIteration(A_Lambda, xk, 1e-3, 100, iterations);
-      double lambdamin = MathTL::InversePowerIteration(A_Lambda, yk, 1e-1,  1e-3, 100, iterations);
-      normA = lambdamax;
-      normAinv = 1./lambdamin;
-#else
-      MathTL::Matrix<double> evecs;
-      setup_stiffness_matrix(*this, Lambda, A_Lambda);
-      //cout << "Matrix aufgestellt" << endl;
-      //cout << A_Lambda << endl;
-      Vector<double> evals;
-      
-#if 1
-      //cout << "Beginne Normberechnung" << endl;
-      SymmEigenvalues(A_Lambda, evals, evecs);
-      normA = evals(evals.size()-1);
-      int i = 0;
-      while(abs(evals(i))<1e-10){
-          ++i;
-      }
-      //cout << "rezinvers: " <<evals(i) << endl;;
-      normAinv = 1./evals(i);
-      //cout << "Norm " << normA << endl;
-      //cout << "Inv Norm " << normAinv << endl;
-      
-#else
-      Vector<double> xk(Lambda.size(), false);
-      xk = 1;
-      unsigned int iterations;
-      normAinv = 1./InversePowerIteration(A_Lambda, xk, 1e-6, 200, iterations);
-      cout << "Inv Norm " << normAinv << endl;
-      cout << iterations << endl;
-      //cout << A_Lambda << endl;
-      
-      //cout << "Eigenvektoren: " << evecs << endl;
-#endif
-#endif
-
-#if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
-      cout << "... done!" << endl;
-#endif
-    }
+    if (normAinv == 0.0)
+      compute_norms();
 
     return normAinv;
   }
@@ -665,172 +440,35 @@ namespace WaveletTL
   CachedProblem<PROBLEM>::apply(const std::set<int>& window, const Vector<double>& x,
 				Vector<double>& res) const
   {
-//     for (typename std::set<int>::const_iterator iter = window.begin(); iter != window.end(); iter++) {
-//       cout << *(problem->basis().get_wavelet(*iter)) << endl;
-//     }
-//     cout << "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
     res.resize(x.size());
     typedef typename Index::type_type generator_type;
-    // cout << " size = " << entries_cache.size() << endl;  
-    if (entries_cache.size() == 0) {
-      unsigned int l = 0;
-      for (typename std::set<int>::const_iterator win_it_col = window.begin(); win_it_col != window.end(); win_it_col++, l++) {
-	const double d1 = problem->D(*(problem->basis().get_wavelet(*win_it_col)));
-	unsigned int k = 0;
-	for (typename std::set<int>::const_iterator win_it_row = window.begin(); win_it_row != window.end(); win_it_row++, k++) {
-	  res[k] += x[l] * this->a(*(problem->basis().get_wavelet(*win_it_row)),*(problem->basis().get_wavelet(*win_it_col)))
-	    / (d1*problem->D(*(problem->basis().get_wavelet(*win_it_row))));
-	}
-      }
-      return;
-    }
 
-    typename std::set<int>::const_iterator win_it_col = window.begin();
     unsigned int l = 0;
-
-    for (typename ColumnCache::iterator col_it = entries_cache.begin();
-	 col_it != entries_cache.end(); col_it++) {
-      if (col_it->first < *win_it_col) {
-	continue;
-      }
-      else if (col_it->first > *win_it_col){
-	//	cout << "inserting column " << *win_it_col << endl;
-	const double d1 = problem->D(*(problem->basis().get_wavelet(*win_it_col)));
-	unsigned int k = 0;
-	for (typename std::set<int>::const_iterator win_it_row = window.begin();
-	     win_it_row != window.end(); win_it_row++, k++) {
-	  res[k] += x[l] * this->a(*(problem->basis().get_wavelet(*win_it_row)),
-			     *(problem->basis().get_wavelet(*win_it_col)))
-	    / (d1*problem->D(*(problem->basis().get_wavelet(*win_it_row))));
-	}
-	col_it--;
-// 	cout << "column should be " << (*win_it_col) << " and it is " << col_it->first << endl;
-// 	cout << "done inserting column " << (*win_it_col) << endl;
-	win_it_col++;
-	l++;
-	if(l == res.size())
-	  return;
-      }
-      else if (col_it->first == *win_it_col) {
-	typename std::set<int>::const_iterator win_it_row = window.begin();
-	unsigned int k = 0;
-	
-	for (typename Column::const_iterator block_it = (col_it->second).begin();
-	     block_it != (col_it->second).end(); block_it++) {
-
-	  const Index* rowind = problem->basis().get_wavelet(*win_it_row);
-
-	  int j = (rowind->e() == generator_type()) ? (rowind->j()-1) : rowind->j();
-
-	  if (block_it->first < j) {
-	    continue;
-	  }
-	  else if (block_it->first > j) { // insert this block!
-	    //	    cout << "inserting level " << j << endl;
-	    Column& col(col_it->second);
-	    typename Column::iterator lb(col.lower_bound(j));
-	    typename Column::iterator it(lb);
-	     
-	    typedef typename Column::value_type value_type;
-	    it = col.insert(lb, value_type(j, Block()));
-	    std::list<Index> nus;
-
-	    intersecting_wavelets(basis(), *(problem->basis().get_wavelet(col_it->first)),
-				  std::max(j, basis().j0()),
-				  j == (basis().j0()-1),
-				  nus);
-	    Block& block(it->second);
-	    const double d1 = problem->D(*(problem->basis().get_wavelet(col_it->first)));
-	     
-	    for (typename std::list<Index>::const_iterator it(nus.begin()), itend(nus.end());
-		 it != itend; ++it) {
-	      //	      cout << "nonzero entry at " << (*it).number() << endl;
-	      while (*win_it_row < (*it).number() && win_it_row != window.end()) {
-		win_it_row++;
-		k++;
-	      }
-	      //	      cout << "k=" << k << endl;
-	      const double entry = problem->a(*it, problem->basis().get_wavelet(col_it->first));
-	      typedef typename Block::value_type value_type_block;
-	      if (entry != 0.)
-		block.insert(block.end(), value_type_block((*it).number(), entry));
-	       
-	      // at this point holds either (*win_it_row).number() < (*it).number() or (*win_it_row).number() == (*it).number()
-	      if ( *win_it_row == (*it).number() ) {
-		if (entry != 0.)
-		  res[k] += x[l] * (entry / (d1*problem->D(*it)));
-	      }
-	    }
-	    if (win_it_row == window.end())
-	      break;
-	    block_it--;
-	    // leaving this level
-	    while ( (( problem->basis().get_wavelet(*win_it_row)->e() == generator_type()) ?
-		     ( problem->basis().get_wavelet(*win_it_row)->j()-1) :
-		     problem->basis().get_wavelet(*win_it_row)->j()) == j
-		    && win_it_row != window.end()) {
-	      win_it_row++;
-	      k++;
-	    }
-	    if (win_it_row == window.end())
-	      break;
-	  }
-	  else if (block_it->first == j) { // extract existing block!
-	    //	    cout << "extracting level " << j << " in column " << col_it->first << endl;
-	    const double d1 = problem->D(*(problem->basis().get_wavelet(col_it->first)));
-	    for (typename Block::const_iterator it = block_it->second.begin(); it != block_it->second.end(); ++it) {
-	      //	      cout << "nonzero entry in row " << it->first << endl;
-	      const Index* ind = problem->basis().get_wavelet(it->first);
-	      while (*win_it_row < ind->number() && k < res.size()) {
-		win_it_row++;
-		k++;
-	      }
-	      //	      cout << "k = " << k << endl;
-	      if (k == res.size())
-		break;
-	      // at this point holds either (*win_it_row).number() < (*it).number() or (*win_it_row).number() == (*it).number()
-	      if ( *win_it_row == ind->number() ) {
-		//		cout << "putting row " << *win_it_row << endl;
-		res[k] += x[l] * (it->second / (d1*problem->D(*ind)));
-	      }
-	    
-	    }// end loop over level block
-	    if (k == res.size())
-	      break;
-	    //cout << "leaving the level " << endl;
-	    // leaving this level
-	    while ( (( problem->basis().get_wavelet(*win_it_row)->e() == generator_type()) ?
-		     ( problem->basis().get_wavelet(*win_it_row)->j()-1) :
-		     problem->basis().get_wavelet(*win_it_row)->j()) == j
-		    && k < res.size()) {
-	      //	      cout << "kk = " << k << endl;
-	      win_it_row++;
-	      k++;
-	    }
-	    if (k == res.size())
-	      break;
-	  }// end else if (block_it->first == j)
-	}// end loop over level blocks
-	win_it_col++;
-	l++;
-	if (l == res.size())
-	  return;
-      }// end if existing column found
-    }// end loop over all columns in cache
-
-    // insert the remaining columns
-    while (l < res.size()) {
-      //      cout << "inserting column " << *win_it_col << endl;
-      const double d1 = problem->D(*(problem->basis().get_wavelet(*win_it_col)));
+    for (typename std::set<int>::const_iterator win_it_col = window.begin();
+	 win_it_col != window.end(); ++win_it_col, l++) {
+      const Index* colind = problem->basis().get_wavelet(*win_it_col);
+      const double d1 = problem->D(*colind);
+
+      // The window is sorted by the index numbers, so the rows of one level are consecutive.
+      // For each level, we merge them with the (cached or newly computed) level block of the column.
+      typename std::set<int>::const_iterator win_it_row = window.begin();
       unsigned int k = 0;
-      for (typename std::set<int>::const_iterator win_it_row = window.begin();
-	   win_it_row != window.end(); win_it_row++, k++) {
-	res[k] += x[l] * this->a(*(problem->basis().get_wavelet(*win_it_row)),
-				 *(problem->basis().get_wavelet(*win_it_col)))
-	  / (d1*problem->D(*(problem->basis().get_wavelet(*win_it_row))));
+      while (win_it_row != window.end()) {
+	const Index* rowind = problem->basis().get_wavelet(*win_it_row);
+	const int j = (rowind->e() == generator_type()) ? (rowind->j()-1) : rowind->j();
+	const EntryCache::Block block(column_block(*colind, j));
+
+	unsigned int i = 0;
+	for (; win_it_row != window.end(); ++win_it_row, k++) {
+	  rowind = problem->basis().get_wavelet(*win_it_row);
+	  if (((rowind->e() == generator_type()) ? (rowind->j()-1) : rowind->j()) != j)
+	    break; // leaving this level
+
+	  while (i < block.size() && block.row(i) < *win_it_row) i++;
+	  if (i < block.size() && block.row(i) == *win_it_row)
+	    res[k] += x[l] * (block.value(i) / (d1*problem->D(*rowind)));
+	}
       }
-      win_it_col++;
-      l++;
     }
   }
   
@@ -1147,68 +785,46 @@ namespace WaveletTL
   }
 
   template <class PROBLEM>
-  double
-  CachedProblemLocal<PROBLEM>::norm_A() const
+  void
+  CachedProblemLocal<PROBLEM>::compute_norms() const
   {
-    if (normA == 0.0)
+    cout << "Compute Norm(A) ..." << endl;
+    std::set<Index> Lambda;
+    const int j0 = problem->basis().j0();
+    const int jmax = std::min(j0+2, problem->basis().jmax());
+
+    for (Index lambda = problem->basis().first_generator(j0);; ++lambda)
     {
-      cout << "Compute Norm(A) ..." << endl;
-      std::set<Index> Lambda;
-      const int j0 = problem->basis().j0();
-      //const int jmax = j0+1;
-      const int jmax = std::min(j0+2, problem->basis().jmax());
+      Lambda.insert(lambda);
+      if (lambda ==  problem->basis().last_wavelet(jmax)) break;
+    }
 
-      for (Index lambda = problem->basis().first_generator(j0);; ++lambda)
-      {
-	    Lambda.insert(lambda);
-	    if (lambda ==  problem->basis().last_wavelet(jmax)) break;
-      }
+    SparseMatrix<double> A_Lambda;
+    setup_stiffness_matrix(*this, Lambda, A_Lambda);
 
-      SparseMatrix<double> A_Lambda;
-      setup_stiffness_matrix(*this, Lambda, A_Lambda);
+    double lambdamin, lambdamax;
+    unsigned int iterations;
+    LanczosIteration(A_Lambda, 1e-6, lambdamin, lambdamax, 200, iterations);
+    normA = lambdamax;
+    normAinv = 1./lambdamin;
+  }
 
-      Vector<double> xk(Lambda.size(), false), yk(Lambda.size(), false);
-      xk = 1, yk=1;
-      unsigned int iterations;
-      double lambdamax = MathTL::PowerIteration(A_Lambda, xk, 1e-3, 100, iterations);
-      double lambdamin = MathTL::InversePowerIteration(A_Lambda, yk, 1e-1,  1e-3, 100, iterations);
-      normA = lambdamax;
-      normAinv = 1./lambdamin;
-    }
+  template <class PROBLEM>
+  double
+  CachedProblemLocal<PROBLEM>::norm_A() const
+  {
+    if (normA == 0.0)
+      compute_norms();
 
     return normA;
   }
 
-   
   template <class PROBLEM>
   double
   CachedProblemLocal<PROBLEM>::norm_Ainv() const
   {
     if (normAinv == 0.0)
-    {
-      cout << "Compute Norm(A) ..." << endl;
-      std::set<Index> Lambda;
-      const int j0 = problem->basis().j0();
-      //const int jmax = j0+1;
-      const int jmax = std::min(j0+2, problem->basis().jmax());
-
-      for (Index lambda = problem->basis().first_generator(j0);; ++lambda)
-      {
-            Lambda.insert(lambda);
-            if (lambda ==  problem->basis().last_wavelet(jmax)) break;
-      }
-
-      SparseMatrix<double> A_Lambda;
-      setup_stiffness_matrix(*this, Lambda, A_Lambda);
-
-      Vector<double> xk(Lambda.size(), false), yk(Lambda.size(), false);
-      xk = 1, yk=1;
-      unsigned int iterations;
-      double lambdamax = MathTL::PowerIteration(A_Lambda, xk, 1e-3, 100, iterations);
-      double lambdamin = MathTL::InversePowerIteration(A_Lambda, yk, 1e-1,  1e-3, 100, iterations);
-      normA = lambdamax;
-      normAinv = 1./lambdamin;
-    }
+      compute_norms();
 
     return normAinv;
   }
@@ -11,10 +11,13 @@
 #define _WAVELETTL_CACHED_PROBLEM_H
 
 #include <map>
+#include <string>
 #include <algebra/infinite_vector.h>
 #include <algebra/sparse_matrix.h>
 #include <adaptive/compression.h>
 #include <galerkin/infinite_preconditioner.h>
+#include <galerkin/entry_cache.h>
+#include <galerkin/norm_store.h>
 
 using MathTL::InfiniteVector;
 
@@ -36,7 +39,7 @@ namespace WaveletTL
     i.e., the cache class should also work in the case of integral operators.
     All evaluations of the bilinear form a(.,.) are cached.
     Internally, the cache is managed as follows. The nonzero values of the bilinear
-    form a(.,.) are stored in a map.
+    form a(.,.) are stored columnwise in level blocks, see EntryCache.
 
     The template class CachedProblem implements the minimal signature to be
     used within the APPLY routine.
@@ -63,6 +66,11 @@ namespace WaveletTL
     CachedProblem(const PROBLEM* P,
 		  const double normA = 0.0,
 		  const double normAinv = 0.0);
+
+    /*!
+      destructor, saves the entries cache if a cache file was set (see set_cache_file())
+    */
+    ~CachedProblem();
     
     /*!
       make wavelet basis type accessible
@@ -184,11 +192,13 @@ namespace WaveletTL
     double F_norm() const { return problem->F_norm(); }
     
     /*!
-      w += factor * (stiffness matrix entries in column lambda on level j, p)
+      w += factor * (stiffness matrix entries in column lambda on level j, p),
+      w may be a Vector<double> of length degrees_of_freedom() or a SparseAccumulator<double>
     */
+    template <class VECTOR>
     void add_level (const Index& lambda,
 		    //InfiniteVector<double, Index>& w,
-		    Vector<double>& w,
+		    VECTOR& w,
 		    const int j,
 		    const double factor,
 		    const int J,
@@ -208,29 +218,112 @@ namespace WaveletTL
     void clear_cache() {
       entries_cache.clear();
     }
-    
+
+    /*!
+      (approximate) memory consumption of the entries cache in bytes
+    */
+    size_t cache_memory() const { return entries_cache.memory(); }
+
+    /*!
+      limit the memory consumption of the entries cache (in bytes, 0: no limit);
+      if the limit is reached, level blocks far from the level of their column
+      are evicted from the cache (and recomputed on demand)
+    */
+    void set_max_cache_memory(const size_t max_memory) {
+      entries_cache.set_max_memory(max_memory);
+    }
+
+    /*!
+      Map a persistent cache file (see StiffnessCacheFile), which was written
+      by save_cache() for the same problem. The level blocks of the file are
+      paged in on their first use only.
+      The file is identified by a key consisting of the problem class (and with it
+      the basis type and its parameters like d, dT), the number of degrees of freedom
+      (and with it jmax), a fingerprint of the entries of the first and last generators
+      on the coarsest level (see StiffnessCacheFile::fingerprint(), this catches other
+      boundary conditions or coefficients near the boundary) and a user-specified description,
+      which should contain everything else the operator depends on (coefficients, ...).
+      Returns false if there is no matching file.
+    */
+    bool load_cache(const char* filename, const std::string& description = "");
+
+    /*!
+      save the entries cache (including the blocks of a mapped file) into a cache file,
+      see load_cache()
+    */
+    bool save_cache(const char* filename, const std::string& description = "") const;
+
+    /*!
+      load the entries cache from a cache file (if it exists) and save it
+      into the same file on destruction, see load_cache()
+    */
+    void set_cache_file(const char* filename, const std::string& description = "");
+
+    /*!
+      use a persistent store of norm estimates (see norm_store.h):
+      the estimates for ||A|| and ||A^{-1}|| which are not known yet are read from the store,
+      estimates computed later on are written into it; the key is built as in load_cache()
+    */
+    void set_norm_store(const char* filename, const std::string& description = "");
+
   protected:
+    //! the key of a cache file, see load_cache()
+    std::string cache_key(const std::string& description) const;
+
+    /*!
+      estimate ||A|| and ||A^{-1}|| by a Lanczos iteration for the stiffness matrix
+      of all indices up to level j0+2 (the entries are computed via the cache)
+    */
+    void compute_norms() const;
+
     //! the underlying (uncached) problem
     const PROBLEM* problem;
-   
-    // type of one block in one column of stiffness matrix  A
-    typedef std::map<int, double> Block;
-    
-    // type of one column in the entry cache of A
-    // the key codes the level, that data are the entries
-    typedef std::map<int, Block> Column;
-    
-    // type of the entry cache of A
-    //typedef std::map<Index, Column> ColumnCache;
-    typedef std::map<int, Column> ColumnCache;
+
+    //! persistent cache file and its key (see set_cache_file())
+    std::string cache_filename, cache_filekey;
+
+    //! persistent store of the norm estimates and its key (see set_norm_store())
+    std::string norm_store_filename, norm_store_key;
+
+    /*!
+      compute the nontrivial entries of the level block j of the column nu,
+      the key of the generator level is j0-1
+    */
+    void compute_entries(const Index& nu, const int j,
+			 std::vector<int>& rows, std::vector<double>& entries) const;
+
+    /*!
+      store the entries of the level block j of the column nu in the cache
+    */
+    EntryCache::Block insert_block(const Index& nu, const int j,
+				   const std::vector<int>& rows, const std::vector<double>& entries) const;
+
+    /*!
+      compute the level block j of the column nu and store it in the cache
+    */
+    EntryCache::Block compute_block(const Index& nu, const int j) const;
+
+    /*!
+      cached level block j of the column nu (computed if necessary)
+    */
+    EntryCache::Block column_block(const Index& nu, const int j) const;
 
     // entries cache for A (mutable to overcome the constness of add_column())
-    mutable ColumnCache entries_cache;
+    mutable EntryCache entries_cache;
     
     // estimates for ||A|| and ||A^{-1}||
     mutable double normA, normAinv;
   };
 
+  /*!
+    CachedProblem::add_level() can also write into a SparseAccumulator<double>
+  */
+  template <class PROBLEM>
+  struct SparseAccumulationTraits<CachedProblem<PROBLEM> >
+  {
+    static const bool supported = true;
+  };
+
   /*!
     This class provides a cache layer for generic (preconditioned, cf. precond.h)
     infinite-dimensional matrix problems of the form
@@ -242,6 +335,10 @@ namespace WaveletTL
     All evaluations of the bilinear form a(.,.) are cached.
     Internally, the cache is managed as follows. The nonzero values of the bilinear
     form a(.,.) are stored in a map.
+    There is one map for each patch, holding the rows which belong to that patch.
+    So threads which work on the rows of different patches (e.g., the local solvers
+    in FrameTL's threaded.h) can use the cache concurrently, provided that PROBLEM::a()
+    is thread-safe and the estimates norm_A(), norm_Ainv() have been computed before.
 
     The template class CachedProblem implements the minimal signature to be
     used within the APPLY routine.
@@ -442,6 +539,12 @@ namespace WaveletTL
     double c2_patch1;
     
   protected:
+    /*!
+      estimate ||A|| and ||A^{-1}|| by a Lanczos iteration for the stiffness matrix
+      of all indices up to level j0+2, cf. CachedProblem
+    */
+    void compute_norms() const;
+
     //! the underlying (uncached) problem
     const PROBLEM* problem;
    
@@ -158,10 +158,11 @@ namespace WaveletTL
   
   
   template <class PROBLEM>
+  template <class VECTOR>
   void
   CachedQuarkletProblem<PROBLEM>::add_level (const Index& lambda,
 				     //InfiniteVector<double, Index>& w,
-				     Vector<double>& w,
+				     VECTOR& w,
                                      const int p, 
 				     const int j,
 				     const double factor,
@@ -176,11 +176,13 @@ namespace WaveletTL
     double F_norm() const { return problem->F_norm(); }
     
     /*!
-      w += factor * (stiffness matrix entries in column lambda on level j, p)
+      w += factor * (stiffness matrix entries in column lambda on level j, p),
+      w may be a Vector<double> of length degrees_of_freedom() or a SparseAccumulator<double>
     */
+    template <class VECTOR>
     void add_level (const Index& lambda,
 		    //InfiniteVector<double, Index>& w,
-		    Vector<double>& w,
+		    VECTOR& w,
                     const int p, 
 		    const int j,
 		    const double factor,
@@ -221,6 +223,15 @@ namespace WaveletTL
     // estimates for ||A|| and ||A^{-1}||
     mutable double normA, normAinv;
   };  
+
+  /*!
+    CachedQuarkletProblem::add_level() can also write into a SparseAccumulator<double>
+  */
+  template <class PROBLEM>
+  struct SparseAccumulationTraits<CachedQuarkletProblem<PROBLEM> >
+  {
+    static const bool supported = true;
+  };
 }
 
 #include <galerkin/cached_quarklet_problem.cpp>
@@ -68,174 +68,47 @@ namespace WaveletTL
 //            typedef std::list<Index*> IntersectingPointerList;
             typedef std::list<int> IntersectingList;
 
-            // search for column 'mu'
-            typename ColumnCache::iterator col_lb(entries_cache.lower_bound(nu_num));
-            typename ColumnCache::iterator col_it(col_lb);
+            // look up the subblock of column 'nu' belonging to the polynomial and the level of 'lambda'
+            const Subblock* subblock(entries_cache.find(nu_num, blocknumber, subblocknumber));
 
-            if (col_lb == entries_cache.end() ||
-                entries_cache.key_comp()(nu_num, col_lb->first))
+            if (subblock == 0)
             {
-//                cout << "Neue Spalte " << nu << endl;
-                // insert a new column
-                typedef typename ColumnCache::value_type value_type;
-#if PARALLEL==-1
-#pragma omp critical
-                {col_it = entries_cache.insert(col_lb, value_type(nu_num, Column()));}
-#else
-                col_it = entries_cache.insert(col_lb, value_type(nu_num, Column()));
-#endif
-            }
-            
-
-            Column& col(col_it->second);
-
-            // check wether the polynomial 'lambda' belongs to has already been calculated
-            typename Column::iterator block_lb(col.lower_bound(blocknumber));
-            typename Column::iterator block_it(block_lb);
-
-            if (block_lb == col.end() ||
-                col.key_comp()(blocknumber, block_lb->first))
-            {
-                
-                
-//                cout << "Neuer block" << endl;
-                typedef typename Column::value_type value_type;
-#if PARALLEL==-1
-#pragma omp critical
-                {block_it = col.insert(block_lb, value_type(blocknumber, Block()));}
-#else
-                block_it = col.insert(block_lb, value_type(blocknumber, Block()));
-#endif
-            }
-            
-            Block& block(block_it->second);
-            
-            
-            
-            
-            
-            // check wether the level 'lambda' belongs to has already been calculated
-            typename Block::iterator lb(block.lower_bound(subblocknumber));
-            typename Block::iterator it(lb);
-
-            if (lb == block.end() ||
-                block.key_comp()(subblocknumber, lb->first))
-            {
-//                cout << "subblocknumber: " << subblocknumber << ", " << lambda << endl;
-            
                 // no entries have ever been computed for this column, polynomial and level
-                // compute whole level block
-                // insert a new level
-//                cout << "Neuer subblock" << endl;
-//                cout << "Lambda: " << lambda  << endl;
-//                cout << "Nu: " << nu << ", " << endl << endl;
-
-                typedef typename Block::value_type value_type;
-#if PARALLEL==-1
-#pragma omp critical
-                {it = block.insert(lb, value_type(subblocknumber, Subblock()));}
-#else
-                it = block.insert(lb, value_type(subblocknumber, Subblock()));
-#endif
-                
-                Subblock& subblock(it->second);
-
-//                
-                // there are no Generators
-//                IntersectingList nus;
-//                IntersectingPointerList nus;
+                // compute whole level subblock outside of any lock and publish it afterwards,
+                // so that threads working on other columns are never blocked
                 IntersectingList nus;
-//                cout << 
-//                    cout << lambda->j() << endl;
                 intersecting_quarklets(frame(),
                                        *nu,
-                                       //std::max(j, frame().j0()),
                                        lambda->j(),
                                        nus,
                                        lambda->p());
-                
-//                intersecting_quarklets(frame(),
-//                                       nu_num,
-//                                       //std::max(j, frame().j0()),
-//                                       lambda->j(),
-//                                       nus,
-//                                       lambda->p());
-                
-//                frame();
-//                frame();
-//                frame();
-//                frame();
-//                                       nu_num;
-//                                       //std::max(j, frame().j0()),
-//                                       lambda->j();
-//                                       nus;
-//                                       lambda->p();
-                
-                // compute entries
-                //cout << "bin hier"<<endl;
-                //cout<<nus.size()<<endl;
-#if 0
-#pragma omp parallel for shared(subblock)
-                for(int i=0;i<nus.size();i++){
-                    typename IntersectingList::const_iterator it(nus.begin());
-                    advance(it,i);
-#else
-                
-//                for (typename IntersectingList::const_iterator it(nus.begin()), itend(nus.end());it != itend; ++it)
-//                 for (typename IntersectingPointerList::const_iterator it(nus.begin()), itend(nus.end());it != itend; ++it)   
-                for (typename IntersectingList::const_iterator it(nus.begin()), itend(nus.end());it != itend; ++it)    
-                {
-#endif
-                    //cout<<*it<<endl;
-//                    const double entry = 0;
-//                    const double entry = problem->a(*it, *nu);
-//                    const double entry = problem->a(*it, *nu);
-//                    const double entry = problem->a(*(frame().get_quarklet((*it).number())), *nu);
-                        const double entry = problem->a(*(frame().get_quarklet(*it)), *nu);
-//                    const double entry = problem->a(*(frame().get_quarklet(*it)), *nu);
-//                    *(frame().get_quarklet(*it));
-
-
-                    typedef typename Subblock::value_type value_type_subblock;
-                    if (fabs(entry) > 1e-16 ) 
-//                            if (entry != 0.)
-                    {
 
-//                        subblock.insert(subblock.end(), value_type_subblock((*it).number(), entry));
-                        subblock.insert(subblock.end(), value_type_subblock(*it, entry));
-
-//                                cout << *it << ", " << (*it).number() <<endl;
-//                        if ((int)(*it).number() == lambda_num)
-                        if (*it == lambda_num)    
-                        {
-                            r = entry;
-                        }
-                    }
+                // each entry is written to its own slot, so no critical section is needed
+                std::vector<int> rows(nus.begin(), nus.end());
+                std::vector<double> entries(rows.size());
+#if PARALLEL_A==1
+#pragma omp parallel for num_threads(NUM_THREADS) schedule(dynamic)
+#endif
+                for (int n = 0; n < (int)rows.size(); n++)
+                {
+                    entries[n] = problem->a(*(frame().get_quarklet(rows[n])), *nu);
                 }
-            }
-            // level already exists --> extract row corresponding to 'lambda'
-            else
-            {
-//                cout << "Ergebnis aus L2 Cache"  << endl;
-                
-                Subblock& subblock(it->second);
-
-                //typename Block::iterator block_lb(block.lower_bound(lambda));
-                typename Subblock::iterator subblock_lb(subblock.lower_bound(lambda_num));
-                typename Subblock::iterator subblock_it(subblock_lb);
-                // level exists, but in row 'lambda' no entry is available ==> entry must be zero
-                if (subblock_lb == subblock.end() ||
-                    subblock.key_comp()(lambda_num, subblock_lb->first))
-                  {
-                    r = 0;
-//                    cout << "Ergebnis ist 0" << endl;
-                  }
-                else {
-                    
-                  r = subblock_it->second;
-//                  cout << "Ergenis: " << r << endl;
+
+                Subblock computed;
+                for (unsigned int n = 0; n < rows.size(); n++)
+                {
+                    if (fabs(entries[n]) > 1e-16)
+                        computed.insert(computed.end(), typename Subblock::value_type(rows[n], entries[n]));
                 }
+
+                subblock = &entries_cache.publish(nu_num, blocknumber, subblocknumber, computed);
             }
+
+            // extract row corresponding to 'lambda'
+            // if no entry is available in row 'lambda', the entry must be zero
+            typename Subblock::const_iterator it(subblock->find(lambda_num));
+            if (it != subblock->end())
+                r = it->second;
         }
          
       return r;
@@ -336,12 +209,8 @@ namespace WaveletTL
 
 
 //                        printf("entering a \n");
-#if PARALLEL==1
-#pragma omp critical
-                        {a(*(frame().get_quarklet(frame().get_first_wavelet_numbers()[leveldiffj0.number()]+currentpolynomial.number() * frame().get_Nablasize())),lambda);}
-#else
+                        // the entry cache is thread-safe, so no critical section is needed here
                         a(*(frame().get_quarklet(frame().get_first_wavelet_numbers()[leveldiffj0.number()]+currentpolynomial.number() * frame().get_Nablasize())),lambda);
-#endif
 //                        printf("leaving a \n");
 
 //                            cout << mu << endl;
@@ -351,7 +220,7 @@ namespace WaveletTL
 
 
                         // add the level
-                        Subblock& subblock (entries_cache[lambda.number()][currentpolynomial.number()][subblocknumber]);
+                        const Subblock& subblock (*entries_cache.find(lambda.number(), currentpolynomial.number(), subblocknumber));
 //                        printf("writing to vector w \n");
                         for (typename Subblock::const_iterator it(subblock.begin()), itend(subblock.end()); it != itend; ++it)
                         {
@@ -12,11 +12,13 @@
 #define	_WAVELETTL_CACHED_QUARKLET_SLITDOMAIN_PROBLEM_H
 
 #include <map>
+#include <vector>
 #include <cmath>
 #include <adaptive/compression.h>
 #include <algebra/infinite_vector.h>
 #include <algebra/vector.h>
 #include <galerkin/galerkin_utils.h>
+#include <galerkin/concurrent_block_cache.h>
 #include <galerkin/infinite_preconditioner.h>
 #include <numerics/eigenvalues.h>
 
@@ -267,23 +269,13 @@ namespace WaveletTL
         // type of one subblock in one block of stiffness matrix  A
         // entries are indexed by the number of the quarklet.
         typedef std::map<int, double> Subblock;
-        
-        // type of one block in one column of stiffness matrix  A
-        // the key codes the sublevel, that data are the entries
-        // a sublevel is a MultiIndex. Entries are indexed by the number of the
-        // sublevel as given by the ordering in MultiIndex, beginning at jmin
-        typedef std::map<int, Subblock> Block;
-
-        // type of one column in the entry cache of A
-        // the key codes the subpolynomial, that data are the entries
-        // a subpolynomial is a MultiIndex. Entries are indexed by the number of the
-        // sublevel as given by the ordering in MultiIndex, beginning at (0,0)
-        typedef std::map<int, Block> Column;
 
         // type of the entry cache of A
-        //typedef std::map<Index, Column> ColumnCache;
-        // entries are indexed by the number of the (Quarklet-) Index
-        typedef std::map<int, Column> ColumnCache;
+        // the subblocks are indexed by the number of the column (Quarklet-) Index,
+        // the number of the subpolynomial (as given by the ordering in MultiIndex, beginning at (0,0,...))
+        // and the number of the sublevel (as given by the ordering in MultiIndex, beginning at jmin).
+        // The cache may be filled concurrently by several threads, cf. concurrent_block_cache.h
+        typedef ConcurrentBlockCache<Subblock> ColumnCache;
 
         // entries cache for A (mutable to overcome the constness of add_column())
         mutable ColumnCache entries_cache;
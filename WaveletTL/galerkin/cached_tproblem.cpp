@@ -1,270 +1,250 @@
 // implementation for cached_tproblem.h
 
+#include <sstream>
+#include <typeinfo>
+#include <vector>
+
 namespace WaveletTL
 {
     template <class PROBLEM>
     CachedTProblem<PROBLEM>::CachedTProblem(PROBLEM* P,
                                             const double estnormA,
                                             const double estnormAinv)
-    : problem(P), normA(estnormA), normAinv(estnormAinv)
+    : problem(P), cache_filename(), cache_filekey(), norm_store_filename(), norm_store_key(),
+      normA(estnormA), normAinv(estnormAinv)
     {
     }
 
     template <class PROBLEM>
-    double
-    CachedTProblem<PROBLEM>::a(const Index& lambda,
-			       const Index& nu) const
+    CachedTProblem<PROBLEM>::~CachedTProblem()
     {
-        double r = 0;
-
-        if (problem->local_operator())
-        {
-            const int lambda_num = lambda.number();
-            const int nu_num = nu.number();
-
-            // Be careful, there is no generator level in the cache! The situation from the MRA setting:
-            // KEY OF GENERATOR LEVEL IS j0-1 NOT j0 !!!!
-            // does not hold in the tensor setting. Generators and wavelets on
-            // the minimal level are thrown together in one index set (componentwise),
-            // this also applies to tensors of generators on the lowest level
+        // the key was computed by set_cache_file(), *problem may already be destroyed
+        if (!cache_filename.empty())
+            entries_cache.save(cache_filename.c_str(), cache_filekey);
+    }
 
-            index_lt lambda_key(lambda.j()),first_level(basis().j0());
-            for (int k=0;k<space_dimension;k++)
-            {
-                lambda_key[k] = lambda_key[k]-first_level[k];
-            }
-//TODO (PERFORMANCE): store the numbers of all levels up to jmax, do not compute anything here:
-            int blocknumber(lambda_key.number());
+    template <class PROBLEM>
+    std::string
+    CachedTProblem<PROBLEM>::cache_key(const std::string& description) const
+    {
+        // the entries of the first and last generators enter the key,
+        // so that other coefficients or boundary conditions give another key
+        std::vector<Index> generators;
+        for (Index lambda(basis().first_generator());; ++lambda) {
+            generators.push_back(lambda);
+            if (lambda == basis().last_generator()) break;
+        }
+        if (generators.size() > 8)
+            generators.erase(generators.begin()+4, generators.end()-4);
+        std::vector<double> entries;
+        for (unsigned int i(0); i < generators.size(); i++)
+            for (unsigned int k(0); k < generators.size(); k++)
+                entries.push_back(problem->a(generators[i], generators[k]));
+
+        std::ostringstream key;
+        key << typeid(PROBLEM).name()
+            << " dof=" << basis().degrees_of_freedom()
+            << " a=" << std::hex << StiffnessCacheFile::fingerprint(entries) << std::dec
+            << " " << description;
+        return key.str();
+    }
 
-            // check wether entry has already been computed
-            typedef std::list<Index> IntersectingList;
+    template <class PROBLEM>
+    bool
+    CachedTProblem<PROBLEM>::load_cache(const char* filename, const std::string& description)
+    {
+        return entries_cache.map_file(filename, cache_key(description));
+    }
 
-            // search for column 'mu'
-            typename ColumnCache::iterator col_lb(entries_cache.lower_bound(nu_num));
-            typename ColumnCache::iterator col_it(col_lb);
+    template <class PROBLEM>
+    bool
+    CachedTProblem<PROBLEM>::save_cache(const char* filename, const std::string& description) const
+    {
+        return entries_cache.save(filename, cache_key(description));
+    }
 
-            if (col_lb == entries_cache.end() ||
-                entries_cache.key_comp()(nu_num, col_lb->first))
-            {
-                // insert a new column
-                typedef typename ColumnCache::value_type value_type;
-                col_it = entries_cache.insert(col_lb, value_type(nu_num, Column()));
-            }
+    template <class PROBLEM>
+    void
+    CachedTProblem<PROBLEM>::set_cache_file(const char* filename, const std::string& description)
+    {
+        cache_filename = filename;
+        cache_filekey = cache_key(description);
+        entries_cache.map_file(filename, cache_filekey);
+    }
 
-            Column& col(col_it->second);
+    template <class PROBLEM>
+    inline
+    int
+    CachedTProblem<PROBLEM>::blocknumber(const index_lt& j) const
+    {
+        // Be careful, there is no generator level in the cache! The situation from the MRA setting:
+        // KEY OF GENERATOR LEVEL IS j0-1 NOT j0 !!!!
+        // does not hold in the tensor setting. Generators and wavelets on
+        // the minimal level are thrown together in one index set (componentwise),
+        // this also applies to tensors of generators on the lowest level
+        index_lt key(j), first_level(basis().j0());
+        for (int k=0;k<space_dimension;k++)
+        {
+            key[k] = key[k]-first_level[k];
+        }
+//TODO (PERFORMANCE): store the numbers of all levels up to jmax, do not compute anything here:
+        return key.number();
+    }
 
-            // check wether the level 'lambda' belongs to has already been calculated
-            typename Column::iterator lb(col.lower_bound(blocknumber));
-            typename Column::iterator it(lb);
+    template <class PROBLEM>
+    void
+    CachedTProblem<PROBLEM>::compute_entries(const Index& nu, const index_lt& j,
+                                             std::vector<int>& rows, std::vector<double>& entries) const
+    {
+        typedef std::list<Index> IndexList;
+        const index_lt first_level(basis().j0());
 
-            if (lb == col.end() ||
-                col.key_comp()(blocknumber, lb->first))
+        IndexList nus;
+        if (problem->local_operator())
+        {
+            // compute only the entries with intersecting supports
+            if (j == first_level)
             {
-                // no entries have ever been computed for this column and this level
-                // compute whole level block
-                // insert a new level
-
-                typedef typename Column::value_type value_type;
-                it = col.insert(lb, value_type(blocknumber, Block()));
-                Block& block(it->second);
-
-                if ((blocknumber == 0) && (lambda.j() == first_level))
-                {
-                    // Insert Generators and Wavelets
-
-                    // also add Generators to the Cache
-                    // this case has to be considered seperatly because
-                    // intersecting_wavelets divides the case of a basis
-                    // function made entirely of generators and the cache does not.
-
-                    // TODO : produce nicer looking code:
-                    IntersectingList nusG,nusW;
-                    intersecting_wavelets(basis(), nu,
-                                          lambda.j(),
-                                          true, // this argument isn't that helpful for the way the method is used in a() .  It doesn't play a role for DIM>1 and miserably fails for DIM=1. Need to work on the routine in tbasis_support!
-                                          nusG);
-                    intersecting_wavelets(basis(), nu,
-                                          lambda.j(),
-                                          false, // this argument isn't that helpful for the way the method is used in a() .  It doesn't play a role for DIM>1 and miserably fails for DIM=1. Need to work on the routine in tbasis_support!
-                                          nusW);
-                    // compute entries
-                    for (typename IntersectingList::const_iterator it(nusG.begin()), itend(nusG.end());it != itend; ++it)
-                    {
-                        const double entry = problem->a(*it, nu);
-                        typedef typename Block::value_type value_type_block;
-                        if (fabs(entry) > 1e-16 ) //(entry != 0.)
-                        {
-                            block.insert(block.end(), value_type_block((*it).number(), entry));
-                            if ((int)(*it).number() == lambda_num)
-                            {
-                                r = entry;
-                            }
-                        }
-                    }
-
-                    for (typename IntersectingList::const_iterator it(nusW.begin()), itend(nusW.end());it != itend; ++it)
-                    {
-                        const double entry = problem->a(*it, nu);
-                        typedef typename Block::value_type value_type_block;
-                        if (fabs(entry) > 1e-16 ) //(entry != 0.)
-                        {
-                            // Insertion should be efficient, since the wavelets coma after the generators
-                            block.insert(block.end(), value_type_block((*it).number(), entry));
-                            if ((int)(*it).number() == lambda_num)
-                            {
-                                r = entry;
-                            }
-                        }
-                    }
-                }
-                else
-                {
-                    // there are no Generators
-
-                    IntersectingList nus;
-                    intersecting_wavelets(basis(),
-                                          nu,
-                                          //std::max(j, basis().j0()),
-                                          lambda.j(),
-                                          false, // this argument isn't that helpful for the way the method is used in a() .  It doesn't play a role for DIM>1 and miserably fails for DIM=1. Need to work on the routine in tbasis_support!
-                    //                    == (basis().j0()-1),
-                                          nus);
-                    // compute entries
-                    for (typename IntersectingList::const_iterator it(nus.begin()), itend(nus.end());it != itend; ++it)
-                    {
-                        const double entry = problem->a(*it, nu);
-                        typedef typename Block::value_type value_type_block;
-                        if (fabs(entry) > 1e-16 ) //(entry != 0.)
-                        {
-                            block.insert(block.end(), value_type_block((*it).number(), entry));
-                            if ((int)(*it).number() == lambda_num)
-                            {
-                                r = entry;
-                            }
-                        }
-                    }
-                }
+                // Insert Generators and Wavelets
+
+                // also add Generators to the Cache
+                // this case has to be considered seperatly because
+                // intersecting_wavelets divides the case of a basis
+                // function made entirely of generators and the cache does not.
+                IndexList nusW;
+                intersecting_wavelets(basis(), nu,
+                                      j,
+                                      true, // this argument isn't that helpful for the way the method is used in a() .  It doesn't play a role for DIM>1 and miserably fails for DIM=1. Need to work on the routine in tbasis_support!
+                                      nus);
+                intersecting_wavelets(basis(), nu,
+                                      j,
+                                      false,
+                                      nusW);
+                nus.splice(nus.end(), nusW);
             }
-            // level already exists --> extract row corresponding to 'lambda'
             else
             {
-                Block& block(it->second);
-
-                //typename Block::iterator block_lb(block.lower_bound(lambda));
-                typename Block::iterator block_lb(block.lower_bound(lambda_num));
-                typename Block::iterator block_it(block_lb);
-                // level exists, but in row 'lambda' no entry is available ==> entry must be zero
-                if (block_lb == block.end() ||
-                    block.key_comp()(lambda_num, block_lb->first))
-                  {
-                    r = 0;
-                  }
-                else {
-                  r = block_it->second;
-                }
+                // there are no Generators
+                intersecting_wavelets(basis(), nu,
+                                      j,
+                                      false,
+                                      nus);
             }
-        } // end of local operator
+        }
         else
         {
             // for nonlocal operators, we put full level blocks into the cache, regardless of support intersections
-            const int lambda_num = lambda.number();
-            const int nu_num = nu.number();
-
-            // comment about the key applies here too.
-            //typedef typename Index::type_type generator_type;
-            //int j = (lambda.e() == generator_type()) ? (lambda.j()-1) : lambda.j();
-
-            index_lt lambda_key(lambda.j()), first_level(basis().j0());
-            for (int k=0;k<space_dimension;k++)
+            if (j == first_level)
             {
-                lambda_key[k] = lambda_key[k]-first_level[k];
-            }
-//TODO PERFORMANCE: store the numbrs of all levels up to jmax, do not compute anything here:
-            int blocknumber(lambda_key.number());
-
-            // search for column 'mu'
-            typename ColumnCache::iterator col_lb(entries_cache.lower_bound(nu_num));
-            typename ColumnCache::iterator col_it(col_lb);
-
-            if (col_lb == entries_cache.end() ||
-                entries_cache.key_comp()(nu_num, col_lb->first))
+                // generators & wavelets on level j0
+                for (Index lambda_it(basis().first_generator(first_level)), lambda_end(basis().last_wavelet(first_level));lambda_it != lambda_end; ++lambda_it)
+                {
+                    nus.push_back(lambda_it);
+                }
+            } else
             {
-                // insert a new column
-                typedef typename ColumnCache::value_type value_type;
-                col_it = entries_cache.insert(col_lb, value_type(nu_num, Column()));
+                // wavelets on level j > j0
+                for (Index lambda_it(basis().first_wavelet(j)), lambda_end(basis().last_wavelet(j));lambda_it != lambda_end; ++lambda_it)
+                {
+                    nus.push_back(lambda_it);
+                }
             }
+        }
 
-            Column& col(col_it->second);
-
-            // check wether the level block which 'lambda' belongs to has already been calculated
-            typename Column::iterator lb(col.lower_bound(blocknumber));
-            typename Column::iterator it(lb);
-
-            if (lb == col.end() ||
-                col.key_comp()(blocknumber, lb->first))
+        // compute entries
+        for (typename IndexList::const_iterator it(nus.begin()), itend(nus.end()); it != itend; ++it)
+        {
+            const double entry = problem->a(*it, nu);
+            if (fabs(entry) > 1e-16 ) //(entry != 0.)
             {
-                // no entries have ever been computed for this column and this level
-                // compute whole level block
-
-                // insert a new level
-                typedef typename Column::value_type value_type;
-                it = col.insert(lb, value_type(blocknumber, Block()));
+                rows.push_back((*it).number());
+                entries.push_back(entry);
+            }
+        }
+    }
 
-                Block& block(it->second);
+    template <class PROBLEM>
+    inline
+    EntryCache::Block
+    CachedTProblem<PROBLEM>::insert_block(const Index& nu, const index_lt& j,
+                                          const std::vector<int>& rows, const std::vector<double>& entries) const
+    {
+        // the 1-norm distance of the sublevels determines the eviction order
+        int distance(0);
+        for (int k=0;k<space_dimension;k++)
+        {
+            distance += abs(j[k]-nu.j()[k]);
+        }
+        return entries_cache.insert(nu.number(), blocknumber(j), distance, rows, entries);
+    }
 
-                // collect all indices in the level block
-                typedef std::list<Index> IndexList;
-                IndexList nus;
+    template <class PROBLEM>
+    inline
+    EntryCache::Block
+    CachedTProblem<PROBLEM>::column_block(const Index& nu, const index_lt& j) const
+    {
+        EntryCache::Block block;
+        if (entries_cache.find(nu.number(), blocknumber(j), block))
+            return block;
+
+        std::vector<int> rows;
+        std::vector<double> entries;
+        compute_entries(nu, j, rows, entries);
+        return insert_block(nu, j, rows, entries);
+    }
 
-                if (lambda.j() == first_level)
-                {
-                    // generators & wavelets on level j0
-                    for (Index lambda_it(basis().first_generator(first_level)), lambda_end(basis().last_wavelet(first_level));lambda_it != lambda_end; ++lambda_it)
-                    {
-                        nus.push_back(lambda_it);
-                    }
-                } else
-                {
-                    // wavelets on level j > j0
-                    for (Index lambda_it(basis().first_wavelet(lambda.j())), lambda_end(basis().last_wavelet(lambda.j()));lambda_it != lambda_end; ++lambda_it)
-                    {
-                        nus.push_back(lambda_it);
-                    }
-                }
-                // compute entries
-                for (typename IndexList::const_iterator it(nus.begin()), itend(nus.end()); it != itend; ++it)
-                {
-                    const double entry = problem->a(*it, nu);
-                    typedef typename Block::value_type value_type_block;
-                    if (fabs(entry) > 1e-16 )
-                    {
-                        block.insert(block.end(), value_type_block((*it).number(), entry));
-                        if ((int)(*it).number() == lambda_num)
-                        {
-                            r = entry;
-                        }
-                    }
-                }
+    template <class PROBLEM>
+    double
+    CachedTProblem<PROBLEM>::a(const Index& lambda,
+			       const Index& nu) const
+    {
+        // extract the row corresponding to 'lambda' from the level block of column 'nu';
+        // if there is no entry in row 'lambda', it must be zero
+#if PARALLEL_GALERKIN_UTILS==1
+        // setup_stiffness_matrix() calls a() from several threads, so the entries cache
+        // is only accessed in a critical section; a missing block is computed outside of it
+        double r = 0;
+        bool found = false;
+#pragma omp critical (cached_tproblem_entries)
+        {
+            EntryCache::Block block;
+            if (entries_cache.find(nu.number(), blocknumber(lambda.j()), block)) {
+                r = block.entry(lambda.number());
+                found = true;
             }
-            // level already exists --> extract row corresponding to 'lambda'
-            else
-            {
-                Block& block(it->second);
+        }
+        if (!found) {
+            std::vector<int> rows;
+            std::vector<double> entries;
+            compute_entries(nu, lambda.j(), rows, entries);
+#pragma omp critical (cached_tproblem_entries)
+            r = insert_block(nu, lambda.j(), rows, entries).entry(lambda.number());
+        }
+        return r;
+#else
+        return column_block(nu, lambda.j()).entry(lambda.number());
+#endif
+    }
 
-                typename Block::iterator block_lb(block.lower_bound(lambda_num));
-                typename Block::iterator block_it(block_lb);
-                if (block_lb == block.end() || block.key_comp()(lambda_num, block_lb->first))
-                {
-                    // level exists, but in row 'lambda' no entry is available ==> entry must be zero
-                    r = 0;
-                }
-                else
-                {
-                    r = block_it->second;
-                }
-            }
-      }
-      return r;
+    template <class PROBLEM>
+    void
+    CachedTProblem<PROBLEM>::add_block(const Index& lambda, const index_lt& j, Vector<double>& w,
+                                       const double factor, const double d1, const bool precond) const
+    {
+        // D() may insert into the cache (and thus evict the block when a memory limit is set),
+        // so we copy the block first
+        const EntryCache::Block block(column_block(lambda, j));
+        const std::vector<int> rows(block.rows(), block.rows()+block.size());
+        const std::vector<double> values(block.values(), block.values()+block.size());
+        for (unsigned int i(0); i < rows.size(); i++)
+        {
+            // high caching strategy:
+            // The call of D fills the diagonal block of each column in block
+            w[rows[i]]=w[rows[i]]+factor*values[i]/( precond? (d1*D(this->basis().get_wavelet(rows[i]))):1.0);
+            // low caching strategy:
+            // by calling the uncached Version of D no column but the one of lambda is altered. This Version is slower than the high caching strategy.
+            //w[rows[i]]=w[rows[i]]+factor*values[i]/d1/(problem->D(this->basis().get_wavelet(rows[i])));
+        }
     }
 
     template <class PROBLEM>
@@ -286,41 +266,13 @@ namespace WaveletTL
         if (space_dimension == 1)
         {
             int j0 = this->basis().j0()[0];
-            Index mu;
+            index_lt currentlevel;
             for (int level = max (j0, lambda.j()[0]-radius); level  < min(lambda.j()[0]+radius,maxlevel)+1;level++)
             {
-                mu = this->basis().first_wavelet(level);
-                // the result of the following call is that the cache holds the whole level block corresponing to all wavelets with level = |mu|
-                // ideally one should replace this mehtod call with a slightly modified version of the code from a(,)
-                // using the first generator on level j0 would mean no difference, since block 0 contains wavelets and generators
-                a(mu,lambda);
-                // add the level
-                Block& block (entries_cache[lambda.number()][level-j0]);
-#if 1
-                for (typename Block::const_iterator it(block.begin()), itend(block.end()); it != itend; ++it)
-                {
-                    // high caching strategy:
-                    // The call of D fills the diagonal block of each column in block
-                    w[it->first]=w[it->first]+factor*(it->second)/( precond? (d1*D(this->basis().get_wavelet(it->first))):1.0);
-                    // low caching strategy:
-                    // by calling the uncached Version of D no column but the one of lambda is altered. This Version is slower than the high caching strategy.
-                    //w[it->first]=w[it->first]+factor*(it->second)/d1/(problem->D(this->basis().get_wavelet(it->first)));
-                }
-#else
-                // mid caching strategy:
-                // maybe it is too much effort to compute the whole diagonal block (as in the high caching strategy).
-                // For the columns in block other than the one of lambda we use D_2 to only compute and cache a(mu,mu) (a single entry)
-                // Do do this a bool variable has to be introduced marking that only one entry in mus column is stored.
-                // this caching strategy is useful for sparse signals with active coefficients on high levels
-                // ... needs to be tested though ...
-                typename Block::const_iterator it(block.begin()), itend(block.end());
-                w[it->first]=w[it->first]+factor*(it->second)/d1/D(this->basis().get_wavelet(it->first));
-                ++it;
-                for (; it != itend; ++it)
-                {
-                    w[it->first]=w[it->first]+factor*(it->second)/d1/D_already(this->basis().get_wavelet(it->first));
-                }
-#endif
+                currentlevel[0] = level;
+                // add the level,
+                // block 0 contains wavelets and generators
+                add_block(lambda, currentlevel, w, factor, d1, precond);
             }
         }
         else if (space_dimension == 2)
@@ -331,14 +283,13 @@ namespace WaveletTL
             // The first level in a levelline is determined with minx = min(j0[0], lambda.j[0]-radius)
             // The last level in a levelline is determined with miny = min(j0[1], lambda.j[1]-radius)
 
-            Index mu;
             index_lt j0(this->basis().j0());
             int lambdaline = lambda.j()[0]+lambda.j()[1];
             int lowestline = j0[0]+j0[1];
             int dist2j0=lambdaline-lowestline;
             int dist2maxlevel=maxlevel-lambdaline;
             MultiIndex<int,space_dimension> currentlevel;
-            int xstart,xend,ystart,blocknumber;
+            int xstart,xend,ystart;
             // iterate the levellines. offset relative to lambdas levelline
             for (int offset = -std::min(dist2j0,radius); offset < std::min(dist2maxlevel,radius)+1; offset++)
             {
@@ -352,33 +303,8 @@ namespace WaveletTL
                 {
                     currentlevel[0]= xstart+steps;
                     currentlevel[1]= ystart-steps;
-                    mu = this->basis().first_wavelet(currentlevel);
-
-                    a(mu,lambda); // computes & stores the block in the cache
-//                    cout << mu << endl;
-                    blocknumber = currentlevel[0]-j0[0] + ((lambdaline-lowestline+offset)*(lambdaline-lowestline+offset+1))/2;
-
                     // add the level
-                    Block& block (entries_cache[lambda.number()][blocknumber]);
-#if 1
-                    for (typename Block::const_iterator it(block.begin()), itend(block.end()); it != itend; ++it)
-                    {
-                        // high caching strategy
-                        w[it->first]=w[it->first]+factor*(it->second)/( precond? (d1*D(this->basis().get_wavelet(it->first))):1.0);
-
-                        // low caching strategy
-                        //w[it->first]=w[it->first]+factor*(it->second)/d1/(problem->D(this->basis().get_wavelet(it->first)));
-                    }
-#else
-                    // mid caching strategy
-                    typename Block::const_iterator it(block.begin()), itend(block.end());
-                    w[it->first]=w[it->first]+factor*(it->second)/d1/D(this->basis().get_wavelet(it->first));
-                    ++it;
-                    for (; it != itend; ++it)
-                    {
-                        w[it->first]=w[it->first]+factor*(it->second)/d1/D_already(this->basis().get_wavelet(it->first));
-                    }
-#endif
+                    add_block(lambda, currentlevel, w, factor, d1, precond);
                 }
             }
         }
@@ -469,50 +395,8 @@ namespace WaveletTL
         else
         { // we have iterated over all dimensions and can now add the current level (if it is legal)!
             assert (legal == true);
-            Index mu;
-            if (current_level == this->basis().j0())
-            {
-                mu = this->basis().first_generator();
-            }
-            else
-            {
-                mu = this->basis().first_wavelet(current_level);
-            }
-            // the result of the following call is that the cache holds the whole level block corresponing to all wavelets with level = |mu|
-            // ideally one should replace this mehtod call with a slightly modified version of the code from a(,)
-            a(mu,lambda);
-
-            index_lt level_key(this->basis().j0());
-            for (int k=0;k<space_dimension;k++)
-            {
-                level_key[k] = current_level[k]-level_key[k];
-            }
-            //PERFORMANCE: store the numbers of all levels up to jmax, do not compute anything here:
-            int blocknumber(level_key.number());
-
-            // return the block corresponding to level = |mu|
-
-            // same as:
-            // w.add(factor,entries_cache[lambda.number()][blocknumber]);
-            Block& block (entries_cache[lambda.number()][blocknumber]);
-#if 1
-            for (typename Block::const_iterator it(block.begin()), itend(block.end()); it != itend; ++it)
-            {
-                // high caching strategy
-                w[it->first]=w[it->first]+factor*(it->second)/ (precond? (d1*D(this->basis().get_wavelet(it->first))):1.0);
-                // low caching strategy
-                //w[it->first]=w[it->first]+factor*(it->second)/precond/(problem->D(this->basis().get_wavelet(it->first)));
-            }
-#else
-            // mid caching strategy
-            typename Block::const_iterator it(block.begin()), itend(block.end());
-            w[it->first]=w[it->first]+factor*(it->second)/precond/D_diag(this->basis().get_wavelet(it->first));
-            it++;
-            for (; it != itend; ++it)
-            {
-                w[it->first]=w[it->first]+factor*(it->second)/precond/D_already(this->basis().get_wavelet(it->first));
-            }
-#endif
+            // add the block corresponding to level = current_level
+            add_block(lambda, current_level, w, factor, d1, precond);
         }
 
     }
@@ -753,54 +637,64 @@ namespace WaveletTL
 */ // comment for the levelwindow code
 
     template <class PROBLEM>
-    double
-    CachedTProblem<PROBLEM>::norm_A() const
+    void
+    CachedTProblem<PROBLEM>::set_norm_store(const char* filename, const std::string& description)
     {
-        if (normA == 0.0)
+        norm_store_filename = filename;
+        norm_store_key = cache_key(description);
+        double nA, nAinv;
+        if (load_norm_estimates(filename, norm_store_key, nA, nAinv))
         {
-            //const int offset = 2;
-            int offset;
-            switch (space_dimension)
-            {
-                case 1:
-                    offset = 2;
-                    break;
-                case 2:
-                    offset = 1;
-                    break;
-                default:
-                    offset = 0;
-            }
-        
-#if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
-            cout << "CachedTProblem()::norm_A() called..." << endl;
-#endif
-
-            set<Index> Lambda;
-            //cout << "cached_tproblem.norm_A :: last wavelet = " << (problem->basis().last_wavelet(multi_degree(problem->basis().j0())+offset)) << endl;
-            for (Index lambda ( problem->basis().first_generator() ), itend(problem->basis().last_wavelet(multi_degree(problem->basis().j0())+offset));; ++lambda)
-            {
-                Lambda.insert(lambda);
-                if (lambda == itend) break;
-            }
-            SparseMatrix<double> A_Lambda;
-            setup_stiffness_matrix(*this, Lambda, A_Lambda);
-//#if 1
-            double help;
-            unsigned int iterations;
-            LanczosIteration(A_Lambda, 1e-6, help, normA, 200, iterations);
-            normAinv = 1./help;
-//#else
-//          Vector<double> xk(Lambda.size(), false);
-//          xk = 1;
-//          unsigned int iterations;
-//          normA = PowerIteration(A_Lambda, xk, 1e-6, 100, iterations);
-//#endif
+            if (normA == 0.0) normA = nA;
+            if (normAinv == 0.0) normAinv = nAinv;
+        }
+    }
 
+    template <class PROBLEM>
+    void
+    CachedTProblem<PROBLEM>::compute_norms() const
+    {
+        int offset;
+        switch (space_dimension)
+        {
+            case 1:
+                offset = 2;
+                break;
+            case 2:
+                offset = 1;
+                break;
+            default:
+                offset = 0;
+        }
 #if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
-            cout << "... done!" << endl;
+        cout << "CachedTProblem()::compute_norms() called..." << endl;
 #endif
+        set<Index> Lambda;
+        for (Index lambda ( problem->basis().first_generator() ), itend(problem->basis().last_wavelet(multi_degree(problem->basis().j0())+offset));; ++lambda)
+        {
+            Lambda.insert(lambda);
+            if (lambda == itend) break;
         }
+        SparseMatrix<double> A_Lambda;
+        setup_stiffness_matrix(*this, Lambda, A_Lambda);
+        double help;
+        unsigned int iterations;
+        LanczosIteration(A_Lambda, 1e-6, help, normA, 200, iterations);
+        normAinv = 1./help;
+
+        if (!norm_store_filename.empty())
+            save_norm_estimates(norm_store_filename.c_str(), norm_store_key, normA, normAinv);
+#if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
+        cout << "... done!" << endl;
+#endif
+    }
+
+    template <class PROBLEM>
+    double
+    CachedTProblem<PROBLEM>::norm_A() const
+    {
+        if (normA == 0.0)
+            compute_norms();
         return normA;
     }
 
@@ -845,54 +739,8 @@ namespace WaveletTL
     double
     CachedTProblem<PROBLEM>::norm_Ainv() const
     {
-        //cout << " this is norm_Ainv(). Verbosity is " << _WAVELETTL_CACHEDPROBLEM_VERBOSITY << endl;
         if (normAinv == 0.0)
-        {
-            //const int offset = 2;
-            int offset;
-            switch (space_dimension)
-            {
-                case 1:
-                    offset = 2;
-                    break;
-                case 2:
-                    offset = 1;
-                    break;
-                default:
-                    offset = 0;
-            }
-#if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
-            cout << "CachedTProblem()::norm_Ainv() called..." << endl;
-            cout << "verbosity is "<< _WAVELETTL_CACHEDPROBLEM_VERBOSITY << endl;
-#endif
-#if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >=2
-            Index tempindex(problem->basis().last_wavelet(multi_degree(problem->basis().j0())+offset));
-            cout << "number of last wavelet is "<<tempindex.number()<<endl;
-#endif
-            set<Index> Lambda;
-            for (Index lambda ( problem->basis().first_generator() ), itend(problem->basis().last_wavelet(multi_degree(problem->basis().j0())+offset));; ++lambda)
-            {
-                Lambda.insert(lambda);
-                if (lambda == itend) break;
-            }
-            SparseMatrix<double> A_Lambda;
-            setup_stiffness_matrix(*this, Lambda, A_Lambda);
-#if 1
-            double help;
-            unsigned int iterations;
-            LanczosIteration(A_Lambda, 1e-6, help, normA, 200, iterations);
-            normAinv = 1./help;
-#else
-            Vector<double> xk(Lambda.size(), false);
-            xk = 1;
-            unsigned int iterations;
-            normAinv = InversePowerIteration(A_Lambda, xk, 1e-6, 200, iterations);
-#endif
-
-#if _WAVELETTL_CACHEDPROBLEM_VERBOSITY >= 1
-            cout << "... done!" << endl;
-#endif
-        }
+            compute_norms();
         return normAinv;
     }
 
@@ -908,295 +756,39 @@ namespace WaveletTL
     CachedTProblem<PROBLEM>::apply(const std::set<int>& window, const Vector<double>& x,
                                    Vector<double>& res) const
     {
-//TODO PERFORMANCE :: reduce get_wavelet calls
-
         res.resize(x.size());
-//        typedef typename Index::type_type generator_type;
-        // cout << " size = " << entries_cache.size() << endl;
-        if (entries_cache.size() == 0)
-        {
-            unsigned int l = 0;
-            for (typename std::set<int>::const_iterator win_it_col = window.begin(); win_it_col != window.end(); win_it_col++, l++)
-            {
-                const double d1 = this->D(*(problem->basis().get_wavelet(*win_it_col)));
-                unsigned int k = 0;
-                for (typename std::set<int>::const_iterator win_it_row = window.begin(); win_it_row != window.end(); win_it_row++, k++)
-                {
-                    res[k] += x[l] * this->a(*(problem->basis().get_wavelet(*win_it_row)),*(problem->basis().get_wavelet(*win_it_col)))
-                            / (d1*this->D(*(problem->basis().get_wavelet(*win_it_row))));
-                }
-            }
-            return;
-        }
 
-        typename std::set<int>::const_iterator win_it_col = window.begin();
         unsigned int l = 0;
-
-        for (typename ColumnCache::iterator col_it(entries_cache.begin()),col_end(entries_cache.end()); col_it != col_end; col_it++)
+        for (typename std::set<int>::const_iterator win_it_col = window.begin(); win_it_col != window.end(); ++win_it_col, l++)
         {
-            if (col_it->first < *win_it_col)
-            {
-                continue;
-            }
-            else if (col_it->first > *win_it_col)
+            const Index colind(*problem->basis().get_wavelet(*win_it_col));
+            const double d1 = this->D(colind);
+
+            // The window is sorted by the index numbers, so the rows of one sublevel are consecutive
+            // (generators and wavelets on the minimal level are thrown together, as in the cache).
+            // For each sublevel, we merge them with the (cached or newly computed) level block of the column.
+            typename std::set<int>::const_iterator win_it_row = window.begin();
+            unsigned int k = 0;
+            while (win_it_row != window.end())
             {
-                const double d1 = this->D(*(problem->basis().get_wavelet(*win_it_col)));
-                unsigned int k = 0;
-                for (typename std::set<int>::const_iterator win_it_row(window.begin()), win_it_row_end(window.end()); win_it_row != win_it_row_end; win_it_row++, k++)
+                const index_lt j(problem->basis().get_wavelet(*win_it_row)->j());
+                // D() may insert into the cache, so we copy the block first
+                const EntryCache::Block block(column_block(colind, j));
+                const std::vector<int> rows(block.rows(), block.rows()+block.size());
+                const std::vector<double> values(block.values(), block.values()+block.size());
+
+                unsigned int i = 0;
+                for (; win_it_row != window.end(); ++win_it_row, k++)
                 {
-                    res[k] += x[l] * this->a(*(problem->basis().get_wavelet(*win_it_row)), *(problem->basis().get_wavelet(*win_it_col)))
-                            / (d1*this->D(*(problem->basis().get_wavelet(*win_it_row))));
+                    const Index rowind(*problem->basis().get_wavelet(*win_it_row));
+                    if (rowind.j() != j)
+                        break; // leaving this level
+
+                    while (i < rows.size() && rows[i] < *win_it_row) i++;
+                    if (i < rows.size() && rows[i] == *win_it_row)
+                        res[k] += x[l] * (values[i] / (d1*this->D(rowind)));
                 }
-                col_it--;
-    // TODO PERFORMANCE: col_it zeigt jetzt auf die gerade eingefügte Column, durch das col_it++ am Ende der for Schleife also wieder auf die selbe Column ... ineffizient.
-                // 	cout << "column should be " << (*win_it_col) << " and it is " << col_it->first << endl;
-                // 	cout << "done inserting column " << (*win_it_col) << endl;
-                win_it_col++;
-                l++;
-                if (l == res.size())
-                    return;
-            }
-            else if (col_it->first == *win_it_col)
-            {
-                typename std::set<int>::const_iterator win_it_row = window.begin();
-                unsigned int k = 0;
-                index_lt row_key, first_level(basis().j0());
-                int rowind_blocknumber;
-                for (typename Column::const_iterator block_it = (col_it->second).begin(), block_it_end((col_it->second).end()); block_it != block_it_end; block_it++)
-                {
-    // TODO Performance: replace the following lines with a function call to a nice mapping: Wavelet_number -> Level_number
-                    const Index* rowind = problem->basis().get_wavelet(*win_it_row);
-                    row_key = rowind->j(); //,first_level(basis().j0());
-                    for (int kk=0;kk<space_dimension;kk++)
-                    {
-                        row_key[kk] = row_key[kk]-first_level[kk];
-                    }
-    // TODO PERFORMANCE: store the numbers of all levels up to jmax, do not compute anything here:
-                    rowind_blocknumber = row_key.number();
-                    if (block_it->first < rowind_blocknumber)
-                    {
-                        continue;
-                    }
-                    else if (block_it->first > rowind_blocknumber)
-                    { // insert this block!
-                        //	    cout << "Rowblock number " << rowind_blocknumber << endl;
-                        Column& col(col_it->second);
-                        typename Column::iterator lb(col.lower_bound(rowind_blocknumber));
-                        typename Column::iterator it(lb);
-                        typedef typename Column::value_type value_type;
-                        it = col.insert(lb, value_type(rowind_blocknumber, Block()));
-                        std::list<Index> nus;
-
-                        // WORKS ONLY FOR LOCAL OPERATORS
-                        // compute basis functions on the level of the current row that
-                        // have intersecting support with the wavelet given by the current column.
-                        // Again: Generators and Wavelets are thrown together in one index set.
-                        // The structure of "intersect_wavelets" makes things a bit messy (see a() )
-                        // so we use intersecting_elements instead
-                        // caution: ensure that jmax_ in setup_full_collection is high enough!
-                        // otherwise get_wavelet will fail!
-
-    // TODO produce nicer looking code (like in a() )
-                        intersecting_elements(basis(),
-                                              *(problem->basis().get_wavelet(col_it->first)),
-                                              rowind->j(),
-                                              nus);
-                        {
-                            Block& block(it->second);
-                            const double d1 = this->D(*(problem->basis().get_wavelet(col_it->first)));
-                            double entry;
-                            typedef typename Block::value_type value_type_block;
-
-                            for (typename std::list<Index>::const_iterator nus_it(nus.begin()), nus_itend(nus.end()); nus_it != nus_itend; ++nus_it)
-                            {
-                                //	      cout << "nonzero entry at " << (*it).number() << endl;
-                                while (*win_it_row < (*nus_it).number() && win_it_row != window.end())
-                                {
-                                    win_it_row++;
-                                    k++;
-                                }
-                                entry = problem->a(*nus_it, problem->basis().get_wavelet(col_it->first));
-
-                                if (fabs(entry) > 1e-16 ) //(entry != 0.)
-                                {
-                                    block.insert(block.end(), value_type_block((*nus_it).number(), entry));
-                                }
-                                // at this point holds either (*win_it_row).number() < (*nus_it).number() or (*win_it_row).number() == (*nus_it).number()
-
-                                if ( *win_it_row == (*nus_it).number() )
-                                {
-                                    if (fabs(entry) > 1e-16 ) //(entry != 0.)
-                                    {
-    #if 1
-                                        // high caching strategy
-                                        res[k] += x[l] * (entry / (d1*D(*nus_it)));
-                                        // low caching strategy
-                                        //res[k] += x[l] * (entry / (d1*problem->D(*nus_it)));
-    #else
-                                        // mid caching strategy
-                                        if (!flag)
-                                        {
-                                            res[k] += x[l] * (entry / (d1*D_diag(*nus_it)));
-                                            flag = true;
-                                        }
-                                        else
-                                        {
-                                            res[k] += x[l] * (entry / (d1*D_already(*nus_it)));
-                                        }
-    #endif
-                                    }
-                                }
-                            }
-                        }
-                        if (win_it_row == window.end())
-                        {
-                            break;
-                        }
-                        block_it--;
-
-                        // leaving this level
-                        // iterate win_it_row till the end of the current sublevel
-    // TODO PERFORMANCE: as before a mapping IndexNumber->BlockNumber could speed up things
-                        // this code is also executed in another branch of the if then else statement. apply any code changes also there
-                        {
-                            index_lt row_key_temp;
-                            int rowind_blocknumber_temp;
-                            while (true)
-                            {
-                                if (win_it_row == window.end())
-                                {
-                                    break;
-                                }
-                                //compute current blocknumber for win_it_row:
-                                row_key_temp = problem->basis().get_wavelet(*win_it_row)->j(); //,first_level(basis().j0());
-                                for (int kk=0;kk<space_dimension;kk++)
-                                {
-                                    row_key_temp[kk] = row_key_temp[kk]-first_level[kk];
-                                }
-                                rowind_blocknumber_temp = row_key_temp.number();
-                                if (rowind_blocknumber_temp == rowind_blocknumber)
-                                {
-                                    win_it_row++;
-                                    k++;
-                                }
-                                else
-                                {
-                                    break;
-                                }
-                            }
-                        }
-                        if (win_it_row == window.end())
-                        {
-                            break;
-                        }
-                    }
-                    else if (block_it->first == rowind_blocknumber)
-                    { // extract existing block!
-                        //	    cout << "extracting level " << j << " in column " << col_it->first << endl;
-                        const double d1 = this->D(*(problem->basis().get_wavelet(col_it->first)));
-
-                        for (typename Block::const_iterator it(block_it->second.begin()), itend(block_it->second.end()); it != itend; ++it)
-                        {
-                            //	      cout << "nonzero entry in row " << it->first << endl;
-                            while (*win_it_row < it->first && k < res.size()) {
-                                win_it_row++;
-                                k++;
-                            }
-                            //	      cout << "k = " << k << endl;
-                            if (k == res.size())
-                                break;
-                            // at this point holds either (*win_it_row).number() < (*it).number() or (*win_it_row).number() == (*it).number()
-                            if ( *win_it_row == it->first )
-                            {
-                                //		cout << "putting row " << *win_it_row << endl;
-    #if 1
-                                // high caching strategy
-                                res[k] += x[l] * (it->second / (d1*D(problem->basis().get_wavelet(it->first))));
-                                //low caching strategy
-                                //res[k] += x[l] * (it->second / (d1*problem->D(problem->basis().get_wavelet(it->first))));
-    #else
-                                // mid caching strategy
-                                if (!flag)
-                                {
-                                    res[k] += x[l] * (it->second / (d1*D_diag(problem->basis().get_wavelet(it->first))));
-                                    flag = true;
-                                }
-                                else
-                                {
-                                    res[k] += x[l] * (it->second / (d1*D_already(problem->basis().get_wavelet(it->first))));
-                                }
-    #endif
-                            }
-                        }// end loop over level block
-
-    // TODO PERFORMANCE: kick the following line!
-                        if (k == res.size())
-                            break;
-
-                        //cout << "leaving the level " << endl;
-
-                        // leaving this level
-                        // iterate win_it_row till the end of the current sublevel
-    // TODO PERFORMANCE: as before a mapping IndexNumber->BlockNumber could speed up things
-                        // this code is also executed in anther branch of the if then else statement. apply any code changes also there
-                        {
-                            index_lt row_key_temp;
-                            int rowind_blocknumber_temp;
-                            while (true)
-                            {
-                                if (win_it_row == window.end())
-                                {
-                                    break;
-                                }
-                                //compute current blocknumber for win_it_row:
-                                row_key_temp = problem->basis().get_wavelet(*win_it_row)->j(); //,first_level(basis().j0());
-                                for (int kk=0;kk<space_dimension;kk++)
-                                {
-                                    row_key_temp[kk] = row_key_temp[kk]-first_level[kk];
-                                }
-                                rowind_blocknumber_temp = row_key_temp.number();
-                                if (rowind_blocknumber_temp == rowind_blocknumber)
-                                {
-                                    win_it_row++;
-                                    k++;
-                                }
-                                else
-                                {
-                                    break;
-                                }
-                            }
-                        }
-
-                        if (win_it_row == window.end())
-                        {
-                            break;
-                        }
-                    }// end else if (block_it->first == j)
-                }// end loop over level blocks
-                win_it_col++;
-
-                l++;
-
-                if (l == res.size())
-                    return;
-            }// end if existing column found
-        }// end loop over all columns in cache
-
-        // insert the remaining columns
-        while (l < res.size())
-        {
-            //      cout << "inserting column " << *win_it_col << endl;
-            const double d1 = problem->D(*(problem->basis().get_wavelet(*win_it_col)));
-            unsigned int k = 0;
-            for (typename std::set<int>::const_iterator win_it_row = window.begin();
-                 win_it_row != window.end(); win_it_row++, k++)
-            {
-                res[k] += x[l] * this->a(*(problem->basis().get_wavelet(*win_it_row)),
-                                         *(problem->basis().get_wavelet(*win_it_col)))
-                        / (d1*problem->D(*(problem->basis().get_wavelet(*win_it_row))));
             }
-            win_it_col++;
-            l++;
         }
     }
 
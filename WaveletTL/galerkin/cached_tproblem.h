@@ -10,13 +10,16 @@
 #ifndef _WAVELETTL_CACHED_TPROBLEM_H
 #define	_WAVELETTL_CACHED_TPROBLEM_H
 
-#include <map>
 #include <cmath>
+#include <string>
+#include <vector>
 #include <adaptive/compression.h>
 #include <algebra/infinite_vector.h>
 #include <algebra/vector.h>
 #include <galerkin/galerkin_utils.h>
 #include <galerkin/infinite_preconditioner.h>
+#include <galerkin/entry_cache.h>
+#include <galerkin/norm_store.h>
 #include <numerics/eigenvalues.h>
 
 
@@ -38,7 +41,8 @@ namespace WaveletTL
      * All evaluations of the bilinear form a(.,.) are cached. The underlying
      * basis is assumed to be of tensor type as modeled by tbasis.h.
      * Internally, the cache is managed as follows. The nonzero values of the bilinear
-     * form a(.,.) are stored in a map.
+     * form a(.,.) are stored columnwise in level blocks, see EntryCache. The key of
+     * a level block is the number of the sublevel j-j0 (see blocknumber()).
      * For a given sublevel j\in\N^d the sublevels {k\in\N^d with ||j-k||_1 = dist}
      * are computed with add_levelsphere. The 1d integrals needed for the computation
      * of sphere(dist) are stored, since they are needed to compute sphere(dist+1).
@@ -76,6 +80,11 @@ namespace WaveletTL
                        const double normA = 0.0,
                        const double normAinv = 0.0);
 
+        /*
+         * destructor, saves the entries cache if a cache file was set (see set_cache_file())
+         */
+        ~CachedTProblem();
+
         /*
          * read access to the basis
          */
@@ -178,6 +187,28 @@ namespace WaveletTL
          */
         void set_f(const Function<PROBLEM::space_dimension>* fnew);
 
+        /*
+         * Kronecker structure of the underlying operator (if any),
+         * see TensorEquation::kronecker_coefficients(). Used by APPLY_TENSOR_KRONECKER.
+         */
+        inline bool kronecker_coefficients(double& a, double& q) const
+        {
+            return problem->kronecker_coefficients(a, q);
+        }
+
+        /*
+         * the entries of the 1D matrices in direction i, see TensorEquation::integrals_1D()
+         */
+        template <class INDEX1D>
+        inline void integrals_1D(const unsigned int i,
+                                 const INDEX1D& lambda,
+                                 const INDEX1D& mu,
+                                 double& mass,
+                                 double& stiffness) const
+        {
+            problem->integrals_1D(i, lambda, mu, mass, stiffness);
+        }
+
 
         /*
          * read access to the stored preconditioned coefficients of the righthand side
@@ -230,6 +261,33 @@ namespace WaveletTL
          */
         inline double F_norm() const { return problem->F_norm(); }
 
+        /*
+         * read the entries of a persistent cache file (see StiffnessCacheFile), which was
+         * written by save_cache() for the same problem, into the entries cache.
+         * The file is identified by the problem class, the number of degrees of freedom,
+         * a fingerprint of the entries of the first and last generators and a user-specified
+         * description of everything else the operator depends on (coefficients, ...),
+         * cf. CachedProblem::load_cache().
+         * Returns false if there is no matching file.
+         */
+        bool load_cache(const char* filename, const std::string& description = "");
+
+        /*
+         * save the entries cache into a cache file, see load_cache()
+         */
+        bool save_cache(const char* filename, const std::string& description = "") const;
+
+        /*
+         * load the entries cache from a cache file (if it exists) and save it
+         * into the same file on destruction, see load_cache()
+         */
+        void set_cache_file(const char* filename, const std::string& description = "");
+
+        /*
+         * use a persistent store of norm estimates (see norm_store.h), cf. CachedProblem::set_norm_store()
+         */
+        void set_norm_store(const char* filename, const std::string& description = "");
+
         /*
          * Called by APPLY // add_compressed_column
          * w += factor * (stiffness matrix entries in column lambda with ||nu-lambda|| <= range && ||nu|| <= maxlevel)
@@ -295,26 +353,58 @@ namespace WaveletTL
 
          */
     protected:
+        //! the key of a cache file, see load_cache()
+        std::string cache_key(const std::string& description) const;
+
+        /*
+         * estimate ||A|| and ||A^{-1}|| by a Lanczos iteration for the stiffness matrix
+         * of all indices up to level multi_degree(j0)+offset(DIM)
+         */
+        void compute_norms() const;
+
         //! the underlying (uncached) problem
         PROBLEM* problem;
 
-        // type of one block in one column of stiffness matrix  A
-        // entries are indexed by the number of the wavelet.
-        typedef std::map<int, double> Block;
+        //! persistent cache file and its key (see set_cache_file())
+        std::string cache_filename, cache_filekey;
 
-        // type of one column in the entry cache of A
-        // the key codes the sublevel, that data are the entries
-        // a sublevel is a MultiIndex. Entries are indexed by the number of the
-        // sublevel as given by the ordering in MultiIndex, beginning at j_min
-        typedef std::map<int, Block> Column;
+        //! persistent store of the norm estimates and its key (see set_norm_store())
+        std::string norm_store_filename, norm_store_key;
 
-        // type of the entry cache of A
-        //typedef std::map<Index, Column> ColumnCache;
-        // entries are indexed by the number of the (Wavelet-) Index
-        typedef std::map<int, Column> ColumnCache;
+        /*
+         * number of the level block of the sublevel j, i.e., the number of j-j0
+         * as given by the ordering in MultiIndex.
+         * Generators and wavelets on the minimal level are thrown together in block 0.
+         */
+        int blocknumber(const index_lt& j) const;
+
+        /*
+         * compute the nontrivial entries of the level block of the column nu
+         * belonging to the sublevel j
+         */
+        void compute_entries(const Index& nu, const index_lt& j,
+                             std::vector<int>& rows, std::vector<double>& entries) const;
+
+        /*
+         * store the entries of the level block of the column nu belonging to the sublevel j
+         */
+        EntryCache::Block insert_block(const Index& nu, const index_lt& j,
+                                       const std::vector<int>& rows, const std::vector<double>& entries) const;
+
+        /*
+         * cached level block of the column nu belonging to the sublevel j (computed if necessary)
+         */
+        EntryCache::Block column_block(const Index& nu, const index_lt& j) const;
+
+        /*
+         * w += factor * (level block of the column lambda belonging to the sublevel j),
+         * the entries are scaled with 1/(d1*D(mu)) if precond is set
+         */
+        void add_block(const Index& lambda, const index_lt& j, Vector<double>& w,
+                       const double factor, const double d1, const bool precond) const;
 
         // entries cache for A (mutable to overcome the constness of add_column())
-        mutable ColumnCache entries_cache;
+        mutable EntryCache entries_cache;
 
         // estimates for ||A|| and ||A^{-1}||
         mutable double normA, normAinv;
@@ -0,0 +1,167 @@
+// implementation for concurrent_block_cache.h
+
+namespace WaveletTL
+{
+  template <class SUBBLOCK>
+  ConcurrentBlockCache<SUBBLOCK>::ConcurrentBlockCache(const unsigned int n_shards)
+    : n_shards_(0), shards_(0)
+  {
+    allocate_shards(n_shards);
+  }
+
+  template <class SUBBLOCK>
+  ConcurrentBlockCache<SUBBLOCK>::ConcurrentBlockCache(const ConcurrentBlockCache<SUBBLOCK>& cache)
+    : n_shards_(0), shards_(0)
+  {
+    allocate_shards(cache.n_shards_);
+    *this = cache;
+  }
+
+  template <class SUBBLOCK>
+  ConcurrentBlockCache<SUBBLOCK>::~ConcurrentBlockCache()
+  {
+    clear();
+#ifdef _OPENMP
+    for (unsigned int i = 0; i < n_shards_; i++)
+      omp_destroy_lock(&shards_[i].lock);
+#endif
+    delete[] shards_;
+  }
+
+  template <class SUBBLOCK>
+  ConcurrentBlockCache<SUBBLOCK>&
+  ConcurrentBlockCache<SUBBLOCK>::operator = (const ConcurrentBlockCache<SUBBLOCK>& cache)
+  {
+    if (this != &cache) {
+      clear();
+      for (unsigned int i = 0; i < cache.n_shards_; i++)
+	for (typename std::map<int, ColumnEntry*>::const_iterator it(cache.shards_[i].columns.begin());
+	     it != cache.shards_[i].columns.end(); ++it)
+	  insert_column(it->first)->column = it->second->column;
+    }
+    return *this;
+  }
+
+  template <class SUBBLOCK>
+  void
+  ConcurrentBlockCache<SUBBLOCK>::allocate_shards(const unsigned int n_shards)
+  {
+    n_shards_ = 1;
+    while (n_shards_ < n_shards) n_shards_ *= 2;
+    shards_ = new Shard[n_shards_];
+#ifdef _OPENMP
+    for (unsigned int i = 0; i < n_shards_; i++)
+      omp_init_lock(&shards_[i].lock);
+#endif
+  }
+
+  template <class SUBBLOCK>
+  typename ConcurrentBlockCache<SUBBLOCK>::ColumnEntry*
+  ConcurrentBlockCache<SUBBLOCK>::find_column(const int column) const
+  {
+    Shard& s(shard(column));
+    ColumnEntry* result = 0;
+#ifdef _OPENMP
+    omp_set_lock(&s.lock);
+#endif
+    typename std::map<int, ColumnEntry*>::const_iterator it(s.columns.find(column));
+    if (it != s.columns.end())
+      result = it->second;
+#ifdef _OPENMP
+    omp_unset_lock(&s.lock);
+#endif
+    return result;
+  }
+
+  template <class SUBBLOCK>
+  typename ConcurrentBlockCache<SUBBLOCK>::ColumnEntry*
+  ConcurrentBlockCache<SUBBLOCK>::insert_column(const int column)
+  {
+    Shard& s(shard(column));
+#ifdef _OPENMP
+    omp_set_lock(&s.lock);
+#endif
+    typename std::map<int, ColumnEntry*>::iterator it(s.columns.lower_bound(column));
+    if (it == s.columns.end() || s.columns.key_comp()(column, it->first)) {
+      ColumnEntry* entry = new ColumnEntry();
+#ifdef _OPENMP
+      omp_init_lock(&entry->lock);
+#endif
+      it = s.columns.insert(it, std::make_pair(column, entry));
+    }
+    ColumnEntry* result = it->second;
+#ifdef _OPENMP
+    omp_unset_lock(&s.lock);
+#endif
+    return result;
+  }
+
+  template <class SUBBLOCK>
+  const SUBBLOCK*
+  ConcurrentBlockCache<SUBBLOCK>::find(const int column, const int block, const int subblock) const
+  {
+    ColumnEntry* entry = find_column(column);
+    if (entry == 0) return 0;
+
+    const SUBBLOCK* result = 0;
+#ifdef _OPENMP
+    omp_set_lock(&entry->lock);
+#endif
+    typename Column::const_iterator block_it(entry->column.find(block));
+    if (block_it != entry->column.end()) {
+      typename Block::const_iterator it(block_it->second.find(subblock));
+      if (it != block_it->second.end())
+	result = &it->second;
+    }
+#ifdef _OPENMP
+    omp_unset_lock(&entry->lock);
+#endif
+    return result;
+  }
+
+  template <class SUBBLOCK>
+  const SUBBLOCK&
+  ConcurrentBlockCache<SUBBLOCK>::publish(const int column, const int block, const int subblock,
+					  SUBBLOCK& entries)
+  {
+    ColumnEntry* entry = insert_column(column);
+#ifdef _OPENMP
+    omp_set_lock(&entry->lock);
+#endif
+    // the map nodes are stable, so the returned reference stays valid after unlocking
+    std::pair<typename Block::iterator, bool> result
+      (entry->column[block].insert(std::make_pair(subblock, SUBBLOCK())));
+    if (result.second)
+      result.first->second.swap(entries);
+#ifdef _OPENMP
+    omp_unset_lock(&entry->lock);
+#endif
+    return result.first->second;
+  }
+
+  template <class SUBBLOCK>
+  void
+  ConcurrentBlockCache<SUBBLOCK>::clear()
+  {
+    for (unsigned int i = 0; i < n_shards_; i++) {
+      for (typename std::map<int, ColumnEntry*>::iterator it(shards_[i].columns.begin());
+	   it != shards_[i].columns.end(); ++it) {
+#ifdef _OPENMP
+	omp_destroy_lock(&it->second->lock);
+#endif
+	delete it->second;
+      }
+      shards_[i].columns.clear();
+    }
+  }
+
+  template <class SUBBLOCK>
+  size_t
+  ConcurrentBlockCache<SUBBLOCK>::n_columns() const
+  {
+    size_t n = 0;
+    for (unsigned int i = 0; i < n_shards_; i++)
+      n += shards_[i].columns.size();
+    return n;
+  }
+}
@@ -0,0 +1,149 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of WaveletTL - the Wavelet Template Library      |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _WAVELETTL_CONCURRENT_BLOCK_CACHE_H
+#define _WAVELETTL_CONCURRENT_BLOCK_CACHE_H
+
+#include <map>
+#include <cstddef>
+#include <utility>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace WaveletTL
+{
+  /*!
+    Thread-safe cache for the entries of a stiffness matrix A,
+    as used by the cached quarklet problem classes (CachedQuarkletTProblem, ...).
+
+    Logically, the cache has the same layout as the nested std::map cache
+      map<int, map<int, map<int, SUBBLOCK> > >,
+    i.e., a subblock is identified by the number of the column index nu,
+    a block number (e.g. the number of the polynomial degree) and
+    a subblock number (e.g. the number of the level).
+
+    The cache is designed for several threads which fill different columns
+    at the same time (e.g. in the parallel APPLY routines):
+    - the columns are distributed over a fixed number of shards,
+      each shard has its own lock which is only held during the lookup of a column,
+    - each column has its own lock which is only held during the lookup
+      or the insertion of one of its subblocks,
+    - a subblock is computed by the calling thread outside of any lock and then
+      published as a whole by publish(). If another thread has published the
+      same subblock in the meantime, the first published copy is kept.
+    Hence, threads working on different columns never wait for each other
+    while computing entries.
+
+    Published subblocks are never modified or removed (except by clear()),
+    so references returned by find() and publish() can be used without locking.
+    Without OpenMP, all locks are no-ops.
+  */
+  template <class SUBBLOCK>
+  class ConcurrentBlockCache
+  {
+  public:
+    /*!
+      type of one block in a column, the subblocks are indexed by the subblock number
+    */
+    typedef std::map<int, SUBBLOCK> Block;
+
+    /*!
+      type of one column, the blocks are indexed by the block number
+    */
+    typedef std::map<int, Block> Column;
+
+    /*!
+      default constructor, the number of shards is rounded up to a power of 2
+    */
+    explicit ConcurrentBlockCache(const unsigned int n_shards = 64);
+
+    /*!
+      copy constructor
+    */
+    ConcurrentBlockCache(const ConcurrentBlockCache<SUBBLOCK>& cache);
+
+    /*!
+      destructor
+    */
+    ~ConcurrentBlockCache();
+
+    /*!
+      assignment (not thread-safe)
+    */
+    ConcurrentBlockCache<SUBBLOCK>& operator = (const ConcurrentBlockCache<SUBBLOCK>& cache);
+
+    /*!
+      look up a subblock, returns 0 if it has not been published yet
+    */
+    const SUBBLOCK* find(const int column, const int block, const int subblock) const;
+
+    /*!
+      publish a subblock computed by the calling thread and return the cached copy;
+      the contents of the argument are swapped into the cache (it is left in an
+      unspecified state), unless another thread has published the same subblock before
+    */
+    const SUBBLOCK& publish(const int column, const int block, const int subblock,
+			    SUBBLOCK& entries);
+
+    /*!
+      remove all entries (not thread-safe)
+    */
+    void clear();
+
+    /*!
+      number of columns (not thread-safe)
+    */
+    size_t n_columns() const;
+
+  protected:
+    //! one column together with its lock
+    struct ColumnEntry
+    {
+      Column column;
+#ifdef _OPENMP
+      omp_lock_t lock;
+#endif
+    };
+
+    //! one shard of the column directory together with its lock
+    struct Shard
+    {
+      std::map<int, ColumnEntry*> columns;
+#ifdef _OPENMP
+      omp_lock_t lock;
+#endif
+    };
+
+    //! the shard a column belongs to
+    Shard& shard(const int column) const
+    {
+      return shards_[((unsigned int)column * 2654435761u) & (n_shards_-1)];
+    }
+
+    //! find a column, returns 0 if it does not exist yet
+    ColumnEntry* find_column(const int column) const;
+
+    //! find a column, inserts a new column if necessary
+    ColumnEntry* insert_column(const int column);
+
+    //! allocate and initialize the shards
+    void allocate_shards(const unsigned int n_shards);
+
+    //! number of shards
+    unsigned int n_shards_;
+
+    //! the shards
+    Shard* shards_;
+  };
+}
+
+#include <galerkin/concurrent_block_cache.cpp>
+
+#endif
@@ -5,41 +5,62 @@ namespace WaveletTL
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
   CubeEquation<IBASIS,DIM,CUBEBASIS>::CubeEquation(const EllipticBVP<DIM>* bvp,
 						   const FixedArray1D<bool,2*DIM>& bc,
-                                                   const int& jmax)
-    : bvp_(bvp), basis_(bc), normA(0.0), normAinv(0.0)
+                                                   const int& jmax,
+						   const bool precompute_rhs)
+    : bvp_(bvp), basis_(bc), fnorm_sqr(0.0), precompute_rhs_(precompute_rhs),
+      fcache_threshold(-1.0), ftail_sqr(0.0), normA(0.0), normAinv(0.0)
   {
     
     basis_.set_jmax(jmax);
-    compute_rhs();
+    setup_gauss_tables();
+    if (precompute_rhs) compute_rhs();
   }
 
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
   CubeEquation<IBASIS,DIM,CUBEBASIS>::CubeEquation(const EllipticBVP<DIM>* bvp,
 						   const FixedArray1D<int,2*DIM>& bc,
-                                                   const int& jmax)
-    : bvp_(bvp), basis_(bc), normA(0.0), normAinv(0.0)
+                                                   const int& jmax,
+						   const bool precompute_rhs)
+    : bvp_(bvp), basis_(bc), fnorm_sqr(0.0), precompute_rhs_(precompute_rhs),
+      fcache_threshold(-1.0), ftail_sqr(0.0), normA(0.0), normAinv(0.0)
   {
     basis_.set_jmax(jmax);
-    compute_rhs();
+    setup_gauss_tables();
+    if (precompute_rhs) compute_rhs();
   }
   
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
   CubeEquation<IBASIS,DIM,CUBEBASIS>::CubeEquation(const EllipticBVP<DIM>* bvp,
-                                                   const CUBEBASIS& basis)
-    : bvp_(bvp), basis_(basis), normA(0.0), normAinv(0.0)
+                                                   const CUBEBASIS& basis,
+						   const bool precompute_rhs)
+    : bvp_(bvp), basis_(basis), fnorm_sqr(0.0), precompute_rhs_(precompute_rhs),
+      fcache_threshold(-1.0), ftail_sqr(0.0), normA(0.0), normAinv(0.0)
   {
 
     // basis_.set_jmax(basis.get_jmax_());
-    compute_rhs();
+    setup_gauss_tables();
+    if (precompute_rhs) compute_rhs();
   }
 
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
   CubeEquation<IBASIS,DIM,CUBEBASIS>::CubeEquation(const CubeEquation& eq)
     : bvp_(eq.bvp_), basis_(eq.basis_),
-      fcoeffs(eq.fcoeffs), fnorm_sqr(eq.fnorm_sqr),
+      fcoeffs(eq.fcoeffs), fnorm_sqr(eq.fnorm_sqr), precompute_rhs_(eq.precompute_rhs_),
+      fcache(eq.fcache), fcache_threshold(eq.fcache_threshold),
+      frontier(eq.frontier), ftail_sqr(eq.ftail_sqr),
       normA(eq.normA), normAinv(eq.normAinv)
   {
     basis_.set_jmax(eq.basis_.get_jmax_()); //not sure if it works, bc of protected basis_
+    setup_gauss_tables();
+  }
+
+  template <class IBASIS, unsigned int DIM, class CUBEBASIS>
+  void
+  CubeEquation<IBASIS,DIM,CUBEBASIS>::setup_gauss_tables()
+  {
+    const int p = IBASIS::primal_polynomial_degree()*IBASIS::primal_polynomial_degree();
+    for (unsigned int i = 0; i < DIM; i++)
+      gauss_tables[i] = GaussTable<IBASIS>(basis_.bases()[i], (p+1)/2);
   }
 
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
@@ -76,6 +97,88 @@ namespace WaveletTL
     sort(fcoeffs.begin(), fcoeffs.end(), typename InfiniteVector<double,Index>::decreasing_order());
     cout << "... done, all integrals for right-hand side computed!" << endl;
   }
+
+  template <class IBASIS, unsigned int DIM, class CUBEBASIS>
+  void
+  CubeEquation<IBASIS,DIM,CUBEBASIS>::refine_rhs(const double threshold) const
+  {
+    if (fcache_threshold >= 0 && threshold >= fcache_threshold)
+      return; // the tree has already been traversed at least that deep
+
+    typedef typename WaveletBasis::Index Index;
+
+    const int j0   = basis().j0();
+    const int jmax = basis_.get_jmax_();
+
+    // indices whose coefficients have to be computed next,
+    // in the first call the roots of the tree: all generators and wavelets on level j0
+    std::set<Index> todo;
+    if (fcache_threshold < 0)
+      for (Index lambda(basis_.first_generator(j0));; ++lambda)
+	{
+	  todo.insert(lambda);
+	  if (lambda == basis_.last_wavelet(j0))
+	    break;
+	}
+
+    // refine from the frontier of the previous calls on
+    std::vector<std::pair<Index,double> > fnew;
+    while (true)
+      {
+	const std::vector<Index> indices(todo.begin(), todo.end());
+	std::vector<double> fvalues(indices.size());
+#if PARALLEL_RHS==1
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int i = 0; i < (int)indices.size(); i++)
+	  fvalues[i] = f(indices[i]);
+
+	// the diagonal D uses the (not thread-safe) caches of a()
+	for (unsigned int i = 0; i < indices.size(); i++)
+	  {
+	    const double c = fvalues[i]/D(indices[i]);
+	    fcache[indices[i]] = c;
+	    if (fabs(c) > 1e-15)
+	      {
+		fnew.push_back(std::make_pair(indices[i], c));
+		fnorm_sqr += c*c;
+	      }
+	    if (indices[i].j() < jmax)
+	      {
+		frontier.insert(std::make_pair(fabs(c), indices[i]));
+		ftail_sqr += c*c;
+	      }
+	  }
+
+	// refine the leaves with a significant coefficient (they come first in the frontier)
+	todo.clear();
+	while (!frontier.empty() && frontier.begin()->first >= threshold)
+	  {
+	    const Index& lambda(frontier.begin()->second);
+	    std::list<Index> children;
+	    intersecting_wavelets(basis_, lambda, lambda.j()+1, false, children);
+	    for (typename std::list<Index>::const_iterator it(children.begin()), itend(children.end());
+		 it != itend; ++it)
+	      if (fcache.find(*it) == fcache.end())
+		todo.insert(*it);
+	    ftail_sqr -= frontier.begin()->first * frontier.begin()->first;
+	    frontier.erase(frontier.begin());
+	  }
+	if (todo.empty())
+	  break;
+      }
+    fcache_threshold = threshold;
+    ftail_sqr = std::max(0.0, ftail_sqr); // roundoff
+
+    // merge the new nontrivial coefficients into fcoeffs
+    sort(fnew.begin(), fnew.end(), typename InfiniteVector<double,Index>::decreasing_order());
+    std::vector<std::pair<Index,double> > fhelp(fcoeffs.size()+fnew.size());
+    std::merge(fcoeffs.begin(), fcoeffs.end(), fnew.begin(), fnew.end(), fhelp.begin(),
+	       typename InfiniteVector<double,Index>::decreasing_order());
+    fcoeffs.resize(fhelp.size());
+    for (unsigned int id = 0; id < fhelp.size(); id++)
+      fcoeffs[id] = fhelp[id];
+  }
   
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
   inline
@@ -111,8 +214,14 @@ namespace WaveletTL
     
     if (intersect_supports(basis_, lambda, mu, supp))
       {
-	// setup Gauss points and weights for a composite quadrature formula:
 	const int N_Gauss = (p+1)/2;
+
+	// for constant or separable coefficients, the integral factorizes
+	if (bvp_->constant_coefficients() || bvp_->separable_coefficients())
+	  return a_separable(lambda, mu, supp, N_Gauss,
+			     p == IBASIS::primal_polynomial_degree()*IBASIS::primal_polynomial_degree());
+
+	// setup Gauss points and weights for a composite quadrature formula:
 	const double h = ldexp(1.0, -supp.j); // granularity for the quadrature
 	FixedArray1D<Array1D<double>,DIM> gauss_points, gauss_weights;
 	for (unsigned int i = 0; i < DIM; i++) {
@@ -134,144 +243,205 @@ namespace WaveletTL
 	  psi_lambda_der_values, // values of the 1st deriv. of the components of psi_lambda at gauss_points[i]
 	  psi_mu_der_values;     // -"-, for psi_mu
 	for (unsigned int i = 0; i < DIM; i++) {
-	  evaluate(*basis_.bases()[i], 0,
-		   typename IBASIS::Index(lambda.j(),
-					  lambda.e()[i],
-					  lambda.k()[i],
-					  basis_.bases()[i]),
-		   gauss_points[i], psi_lambda_values[i]);
-	  evaluate(*basis_.bases()[i], 1,
-		   typename IBASIS::Index(lambda.j(),
-					  lambda.e()[i],
-					  lambda.k()[i],
-					  basis_.bases()[i]),
-		   gauss_points[i], psi_lambda_der_values[i]);
-	  evaluate(*basis_.bases()[i], 0,
-		   typename IBASIS::Index(mu.j(),
-					  mu.e()[i],
-					  mu.k()[i],
-					  basis_.bases()[i]),
-		   gauss_points[i], psi_mu_values[i]);
-	  evaluate(*basis_.bases()[i], 1,
-		   typename IBASIS::Index(mu.j(),
-					  mu.e()[i],
-					  mu.k()[i],
-					  basis_.bases()[i]),
-		   gauss_points[i], psi_mu_der_values[i]);
+	  const Index1D lambda_i(lambda.j(), lambda.e()[i], lambda.k()[i], basis_.bases()[i]);
+	  const Index1D mu_i(mu.j(), mu.e()[i], mu.k()[i], basis_.bases()[i]);
+	  if (N_Gauss == gauss_tables[i].N_Gauss()) {
+	    gauss_tables[i].evaluate(lambda_i, supp.j, supp.a[i], supp.b[i],
+				     psi_lambda_values[i], psi_lambda_der_values[i]);
+	    gauss_tables[i].evaluate(mu_i, supp.j, supp.a[i], supp.b[i],
+				     psi_mu_values[i], psi_mu_der_values[i]);
+	  } else {
+	    evaluate(*basis_.bases()[i], 0, lambda_i, gauss_points[i], psi_lambda_values[i]);
+	    evaluate(*basis_.bases()[i], 1, lambda_i, gauss_points[i], psi_lambda_der_values[i]);
+	    evaluate(*basis_.bases()[i], 0, mu_i, gauss_points[i], psi_mu_values[i]);
+	    evaluate(*basis_.bases()[i], 1, mu_i, gauss_points[i], psi_mu_der_values[i]);
+	  }
 	}
 	
-	// iterate over all points and sum up the integral shares
+	// iterate over all points, collect them and the integral shares without the coefficients
 	int index[DIM]; // current multiindex for the point values
-	for (unsigned int i = 0; i < DIM; i++)
+	unsigned int npoints = 1;
+	for (unsigned int i = 0; i < DIM; i++) {
 	  index[i] = 0;
+	  npoints *= gauss_points[i].size();
+	}
 	
-	Point<DIM> x;
-	const double ax = bvp_->constant_coefficients() ? bvp_->a(x) : 0.0;
-	const double qx = bvp_->constant_coefficients() ? bvp_->q(x) : 0.0;
+	Array1D<Point<DIM> > points(npoints);
+	Array1D<double> a_shares(npoints), q_shares(npoints);
 	double grad_psi_lambda[DIM], grad_psi_mu[DIM], weights;
-	if (bvp_->constant_coefficients()) {
-	  while (true) {
-	    for (unsigned int i = 0; i < DIM; i++)
-	      x[i] = gauss_points[i][index[i]];
+	for (unsigned int m = 0;; m++) {
+	  for (unsigned int i = 0; i < DIM; i++)
+	    points[m][i] = gauss_points[i][index[i]];
 	    
-	    // product of current Gauss weights
-	    weights = 1.0;
-	    for (unsigned int i = 0; i < DIM; i++)
-	      weights *= gauss_weights[i][index[i]];
+	  // product of current Gauss weights
+	  weights = 1.0;
+	  for (unsigned int i = 0; i < DIM; i++)
+	    weights *= gauss_weights[i][index[i]];
 	    
-	    // compute the share a(x)(grad psi_lambda)(x)(grad psi_mu)(x)
-	    for (unsigned int i = 0; i < DIM; i++) {
-	      grad_psi_lambda[i] = 1.0;
-	      grad_psi_mu[i] = 1.0;
-	      for (unsigned int s = 0; s < DIM; s++) {
-		if (i == s) {
-		  grad_psi_lambda[i] *= psi_lambda_der_values[i][index[i]];
-		  grad_psi_mu[i]     *= psi_mu_der_values[i][index[i]];
-		} else {
-		  grad_psi_lambda[i] *= psi_lambda_values[s][index[s]];
-		  grad_psi_mu[i] *= psi_mu_values[s][index[s]];
-		}
-	      }
-	    }
-	    double share = 0;
-	    for (unsigned int i = 0; i < DIM; i++)
-	      share += grad_psi_lambda[i]*grad_psi_mu[i];
- 	    r += ax * weights * share;
-	    
-	    // compute the share q(x)psi_lambda(x)psi_mu(x)
- 	    share = qx * weights;
-	    for (unsigned int i = 0; i < DIM; i++)
-	      share *= psi_lambda_values[i][index[i]] * psi_mu_values[i][index[i]];
-	    r += share;
-	    
-	    // "++index"
-	    bool exit = false;
-	    for (unsigned int i = 0; i < DIM; i++) {
-	      if (index[i] == N_Gauss*(supp.b[i]-supp.a[i])-1) {
-		index[i] = 0;
-		exit = (i == DIM-1);
+	  // compute the share a(x)(grad psi_lambda)(x)(grad psi_mu)(x)
+	  for (unsigned int i = 0; i < DIM; i++) {
+	    grad_psi_lambda[i] = 1.0;
+	    grad_psi_mu[i] = 1.0;
+	    for (unsigned int s = 0; s < DIM; s++) {
+	      if (i == s) {
+		grad_psi_lambda[i] *= psi_lambda_der_values[i][index[i]];
+		grad_psi_mu[i]     *= psi_mu_der_values[i][index[i]];
 	      } else {
-		index[i]++;
-		break;
+		grad_psi_lambda[i] *= psi_lambda_values[s][index[s]];
+		grad_psi_mu[i] *= psi_mu_values[s][index[s]];
 	      }
 	    }
-	    if (exit) break;
 	  }
-	} else {
-	  while (true) {
-	    for (unsigned int i = 0; i < DIM; i++)
-	      x[i] = gauss_points[i][index[i]];
+	  double share = 0;
+	  for (unsigned int i = 0; i < DIM; i++)
+	    share += grad_psi_lambda[i]*grad_psi_mu[i];
+	  a_shares[m] = weights * share;
 	    
-	    // product of current Gauss weights
-	    weights = 1.0;
-	    for (unsigned int i = 0; i < DIM; i++)
-	      weights *= gauss_weights[i][index[i]];
+	  // compute the share q(x)psi_lambda(x)psi_mu(x)
+	  share = weights;
+	  for (unsigned int i = 0; i < DIM; i++)
+	    share *= psi_lambda_values[i][index[i]] * psi_mu_values[i][index[i]];
+	  q_shares[m] = share;
 	    
-	    // compute the share a(x)(grad psi_lambda)(x)(grad psi_mu)(x)
-	    for (unsigned int i = 0; i < DIM; i++) {
-	      grad_psi_lambda[i] = 1.0;
-	      grad_psi_mu[i] = 1.0;
-	      for (unsigned int s = 0; s < DIM; s++) {
-		if (i == s) {
-		  grad_psi_lambda[i] *= psi_lambda_der_values[i][index[i]];
-		  grad_psi_mu[i]     *= psi_mu_der_values[i][index[i]];
-		} else {
-		  grad_psi_lambda[i] *= psi_lambda_values[s][index[s]];
-		  grad_psi_mu[i] *= psi_mu_values[s][index[s]];
-		}
-	      }
+	  // "++index"
+	  bool exit = false;
+	  for (unsigned int i = 0; i < DIM; i++) {
+	    if (index[i] == N_Gauss*(supp.b[i]-supp.a[i])-1) {
+	      index[i] = 0;
+	      exit = (i == DIM-1);
+	    } else {
+	      index[i]++;
+	      break;
 	    }
-	    double share = 0;
-	    for (unsigned int i = 0; i < DIM; i++)
-	      share += grad_psi_lambda[i]*grad_psi_mu[i];
-	    r += bvp_->a(x) * weights * share;
-	    
-	    // compute the share q(x)psi_lambda(x)psi_mu(x)
-	    share = bvp_->q(x) * weights;
-	    for (unsigned int i = 0; i < DIM; i++)
-	      share *= psi_lambda_values[i][index[i]] * psi_mu_values[i][index[i]];
-	    r += share;
-	    
-	    // "++index"
-	    bool exit = false;
-	    for (unsigned int i = 0; i < DIM; i++) {
-	      if (index[i] == N_Gauss*(supp.b[i]-supp.a[i])-1) {
-		index[i] = 0;
-		exit = (i == DIM-1);
-	      } else {
-		index[i]++;
-		break;
-	      }
-	    }
-	    if (exit) break;
 	  }
+	  if (exit) break;
 	}
-	
+
+	// evaluate the coefficients at all points at once
+	Array1D<double> a_values, q_values;
+	bvp_->a_values(points, a_values);
+	bvp_->q_values(points, q_values);
+	for (unsigned int m = 0; m < npoints; m++)
+	  r += a_values[m] * a_shares[m] + q_values[m] * q_shares[m];
       }
 
     return r;
   }
   
+  template <class IBASIS, unsigned int DIM, class CUBEBASIS>
+  void
+  CubeEquation<IBASIS,DIM,CUBEBASIS>::integrate(const unsigned int i,
+						const Index1D& lambda, const Index1D& mu,
+						const int j, const int k1, const int k2,
+						const int N_Gauss,
+						Integrals1D& integrals) const
+  {
+    // setup Gauss points and weights for a composite quadrature formula on 2^{-j}[k1,k2]
+    const double h = ldexp(1.0, -j);
+    Array1D<double> gauss_points(N_Gauss*(k2-k1)), gauss_weights(N_Gauss*(k2-k1));
+    for (int patch = k1; patch < k2; patch++)
+      for (int n = 0; n < N_Gauss; n++) {
+	gauss_points[(patch-k1)*N_Gauss+n] = h*(2*patch+1+GaussPoints[N_Gauss-1][n])/2.;
+	gauss_weights[(patch-k1)*N_Gauss+n] = h*GaussWeights[N_Gauss-1][n];
+      }
+
+    Array1D<double> psi_lambda_values, psi_mu_values, psi_lambda_der_values, psi_mu_der_values;
+    if (N_Gauss == gauss_tables[i].N_Gauss()) {
+      gauss_tables[i].evaluate(lambda, j, k1, k2, psi_lambda_values, psi_lambda_der_values);
+      gauss_tables[i].evaluate(mu, j, k1, k2, psi_mu_values, psi_mu_der_values);
+    } else {
+      evaluate(*basis_.bases()[i], 0, lambda, gauss_points, psi_lambda_values);
+      evaluate(*basis_.bases()[i], 1, lambda, gauss_points, psi_lambda_der_values);
+      evaluate(*basis_.bases()[i], 0, mu, gauss_points, psi_mu_values);
+      evaluate(*basis_.bases()[i], 1, mu, gauss_points, psi_mu_der_values);
+    }
+
+    const bool separable = !bvp_->constant_coefficients();
+    integrals[0] = integrals[1] = integrals[2] = 0;
+    for (unsigned int m = 0; m < gauss_points.size(); m++) {
+      const double ax = separable ? bvp_->a_factor(i, gauss_points[m]) : 1.0;
+      const double qx = separable ? bvp_->q_factor(i, gauss_points[m]) : 1.0;
+      const double mass = gauss_weights[m] * psi_lambda_values[m] * psi_mu_values[m];
+      integrals[0] += ax * gauss_weights[m] * psi_lambda_der_values[m] * psi_mu_der_values[m];
+      integrals[1] += ax * mass;
+      integrals[2] += qx * mass;
+    }
+  }
+
+  template <class IBASIS, unsigned int DIM, class CUBEBASIS>
+  double
+  CubeEquation<IBASIS,DIM,CUBEBASIS>::a_separable(const Index& lambda, const Index& mu,
+						  const typename CUBEBASIS::Support& supp,
+						  const int N_Gauss,
+						  const bool use_cache) const
+  {
+    // a(psi_lambda,psi_mu) = a0 * sum_i [ \int a_i psi_lambda_i' psi_mu_i' * prod_{s!=i} \int a_s psi_lambda_s psi_mu_s ]
+    //                        + q0 * prod_i \int q_i psi_lambda_i psi_mu_i,
+    // where a0, q0 are the constant coefficients (or 1 in the separable case)
+
+    FixedArray1D<Integrals1D,DIM> integrals;
+    for (unsigned int i = 0; i < DIM; i++) {
+      const Index1D lambda_i(lambda.j(), lambda.e()[i], lambda.k()[i], basis_.bases()[i]);
+      const Index1D mu_i(mu.j(), mu.e()[i], mu.k()[i], basis_.bases()[i]);
+
+      if (!use_cache) {
+	integrate(i, lambda_i, mu_i, supp.j, supp.a[i], supp.b[i], N_Gauss, integrals[i]);
+	continue;
+      }
+
+      // the 1D integrals are symmetric, store them only for lambda_i >= mu_i
+      const Index1D& first  = mu_i < lambda_i ? lambda_i : mu_i;
+      const Index1D& second = mu_i < lambda_i ? mu_i : lambda_i;
+
+      bool found = false;
+#if PARALLEL_GALERKIN_UTILS==1
+#pragma omp critical (cube_equation_integrals)
+#endif
+      {
+	typename One_D_IntegralCache::const_iterator col_it(one_d_integrals[i].find(first));
+	if (col_it != one_d_integrals[i].end()) {
+	  typename Column1D::const_iterator it(col_it->second.find(second));
+	  if (it != col_it->second.end()) {
+	    integrals[i] = it->second;
+	    found = true;
+	  }
+	}
+      }
+      if (!found) {
+	integrate(i, first, second, supp.j, supp.a[i], supp.b[i], N_Gauss, integrals[i]);
+#if PARALLEL_GALERKIN_UTILS==1
+#pragma omp critical (cube_equation_integrals)
+#endif
+	one_d_integrals[i][first][second] = integrals[i];
+      }
+    }
+
+    const bool separable = !bvp_->constant_coefficients();
+    Point<DIM> x;
+    const double a0 = separable ? 1.0 : bvp_->a(x);
+    const double q0 = separable ? 1.0 : bvp_->q(x);
+
+    double r = 0;
+    if (a0 != 0) {
+      for (unsigned int i = 0; i < DIM; i++) {
+	double share = integrals[i][0];
+	for (unsigned int s = 0; s < DIM; s++)
+	  if (s != i)
+	    share *= integrals[s][1];
+	r += share;
+      }
+      r *= a0;
+    }
+    if (q0 != 0) {
+      double share = q0;
+      for (unsigned int i = 0; i < DIM; i++)
+	share *= integrals[i][2];
+      r += share;
+    }
+
+    return r;
+  }
+
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
   double
   CubeEquation<IBASIS,DIM,CUBEBASIS>::f(const typename WaveletBasis::Index& lambda) const
@@ -323,19 +493,23 @@ namespace WaveletTL
 				      basis_.bases()[i]),
 	       gauss_points[i], v_values[i]);
 
-    // iterate over all points and sum up the integral shares
+    // iterate over all points, collect them and the integral shares without f
     int index[DIM]; // current multiindex for the point values
-    for (unsigned int i = 0; i < DIM; i++)
+    unsigned int npoints = 1;
+    for (unsigned int i = 0; i < DIM; i++) {
       index[i] = 0;
+      npoints *= gauss_points[i].size();
+    }
     
-    Point<DIM> x;
-    while (true) {
+    Array1D<Point<DIM> > points(npoints);
+    Array1D<double> shares(npoints);
+    for (unsigned int m = 0;; m++) {
       for (unsigned int i = 0; i < DIM; i++)
-	x[i] = gauss_points[i][index[i]];
-      double share = bvp_->f(x);
+	points[m][i] = gauss_points[i][index[i]];
+      double share = 1.0;
       for (unsigned int i = 0; i < DIM; i++)
 	share *= gauss_weights[i][index[i]] * v_values[i][index[i]];
-      r += share;
+      shares[m] = share;
 
       // "++index"
       bool exit = false;
@@ -351,6 +525,12 @@ namespace WaveletTL
       if (exit) break;
     }
 
+    // evaluate f at all points at once
+    Array1D<double> f_values;
+    bvp_->f_values(points, f_values);
+    for (unsigned int m = 0; m < npoints; m++)
+      r += f_values[m] * shares[m];
+
     return r;
 #endif
   }
@@ -362,8 +542,23 @@ namespace WaveletTL
    InfiniteVector<double, typename WaveletBasis::Index>& coeffs) const
   {
     coeffs.clear();
+    double tail_sqr(0);
+    if (!precompute_rhs_)
+      {
+	// refine until the unrefined leaves, our estimate for the neglected tail,
+	// take at most a quarter of eta^2
+	for (double threshold = eta;; threshold /= 2)
+	  {
+	    refine_rhs(threshold);
+	    tail_sqr = ftail_sqr;
+	    if (tail_sqr <= eta*eta/4 || threshold < 1e-15)
+	      break;
+	  }
+	if (fcoeffs.size() == 0)
+	  return;
+      }
     double coarsenorm(0);
-    double bound(fnorm_sqr - eta*eta);
+    double bound(fnorm_sqr - (eta*eta - tail_sqr));
     typedef typename WaveletBasis::Index Index;
     typename Array1D<std::pair<Index, double> >::const_iterator it(fcoeffs.begin());
     do {
@@ -373,12 +568,41 @@ namespace WaveletTL
     } while (it != fcoeffs.end() && coarsenorm < bound);
   }
 
+  template <class IBASIS, unsigned int DIM, class CUBEBASIS>
+  double
+  CubeEquation<IBASIS,DIM,CUBEBASIS>::F_norm() const
+  {
+    if (!precompute_rhs_)
+      {
+	if (fcache_threshold < 0)
+	  {
+	    refine_rhs(1e300); // level j0 only
+	    refine_rhs(1e-3*sqrt(fnorm_sqr));
+	  }
+	// the coefficients below the frontier are estimated by those on it, cf. RHS()
+	return sqrt(fnorm_sqr + ftail_sqr);
+      }
+    return sqrt(fnorm_sqr);
+  }
+
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
   void
   CubeEquation<IBASIS,DIM,CUBEBASIS>::set_bvp(const EllipticBVP<DIM>* bvp)
   {
     bvp_ = bvp;
-    compute_rhs();
+    for (unsigned int i = 0; i < DIM; i++)
+      one_d_integrals[i].clear();
+    if (precompute_rhs_)
+      compute_rhs();
+    else
+      {
+	fcache.clear();
+	fcache_threshold = -1.0;
+	frontier.clear();
+	ftail_sqr = 0;
+	fcoeffs.resize(0);
+	fnorm_sqr = 0;
+      }
   }
 
   template <class IBASIS, unsigned int DIM, class CUBEBASIS>
@@ -11,6 +11,9 @@
 #define _WAVELETTL_CUBE_EQUATION_H
 
 #include <set>
+#include <map>
+#include <functional>
+#include <vector>
 #include <utils/fixed_array1d.h>
 #include <utils/array1d.h>
 #include <numerics/bvp.h>
@@ -18,6 +21,7 @@
 #include <galerkin/galerkin_utils.h>
 #include <galerkin/infinite_preconditioner.h>
 
+#include <interval/gauss_table.h>
 #include <cube/cube_basis.h>
 
 using MathTL::FixedArray1D;
@@ -61,6 +65,16 @@ namespace WaveletTL
 
     where bc indicates the enforcement of homogeneous Dirichlet boundary conditions (true).
     A natural concrete value for CUBEBASIS is the CubeBasis<DSBasis<d,dT> >.
+
+    By default, the constructors precompute all right-hand side coefficients up to
+    the maximal level jmax. With precompute_rhs == false, the coefficients are computed
+    on demand in RHS(): starting from level j0, the children of an index
+    (the wavelets on the next level with intersecting support) are visited only if
+    its own coefficient is not below a threshold, which is decreased until the
+    coefficients of the unrefined leaves are small enough compared to eta.
+    Computed coefficients are cached and reused by later calls.
+    With PARALLEL_RHS==1, the values f(lambda) of each level are computed
+    concurrently, so that bvp->f() has to be thread-safe then.
   */
   template <class IBASIS, unsigned int DIM, class CUBEBASIS = CubeBasis<IBASIS,DIM> >
   class CubeEquation
@@ -74,7 +88,8 @@ namespace WaveletTL
     */
     CubeEquation(const EllipticBVP<DIM>* bvp,
 		 const FixedArray1D<bool,2*DIM>& bc,
-                 const int& jmax=5);
+                 const int& jmax=5,
+		 const bool precompute_rhs = true);
 
 //     /*!
 //     */
@@ -95,7 +110,8 @@ namespace WaveletTL
     */
     CubeEquation(const EllipticBVP<DIM>* bvp,
 		 const FixedArray1D<int,2*DIM>& bc,
-                 const int& jmax=5);
+                 const int& jmax=5,
+		 const bool precompute_rhs = true);
 
     /*!
       Constructor from a boundary value problem and a given cube basis.
@@ -103,7 +119,8 @@ namespace WaveletTL
       conditions and a maximal level 'jmax' should have been set to it
       beforehand (generally by a call of set_jmax(int)).
     */
-    CubeEquation(const EllipticBVP<DIM>* bvp, const CUBEBASIS& basis);
+    CubeEquation(const EllipticBVP<DIM>* bvp, const CUBEBASIS& basis,
+		 const bool precompute_rhs = true);
 
     /*!
       copy constructor
@@ -160,6 +177,9 @@ namespace WaveletTL
       Internally, we use an m-point composite tensor product Gauss rule adapted
       to the singular supports of the spline wavelets involved,
       so that m = (p+1)/2;
+      For constant or separable coefficients (see EllipticBVP::separable_coefficients()),
+      a(psi_lambda,psi_mu) is a sum of products of 1D integrals, which are computed
+      with the same m-point rule and, for the default order p, cached.
     */
     double a(const typename WaveletBasis::Index& lambda,
 	     const typename WaveletBasis::Index& nu,
@@ -202,9 +222,15 @@ namespace WaveletTL
 	     InfiniteVector<double,typename WaveletBasis::Index>& coeffs) const;
 
     /*!
-      compute (or estimate) ||F||_2
+      compute (or estimate) ||F||_2;
+      without precomputation, this is only an estimate: the norm of the coefficients
+      computed so far (at least down to 1e-3 times the norm on level j0), where the
+      uncomputed coefficients are estimated by the unrefined leaves as in RHS().
+      It is no guaranteed upper bound, so callers which derive tolerances from it
+      (like the initial tolerances of CDD1/CDD2) should use precompute_rhs = true
+      or a safety factor if they rely on ||F|| <= F_norm().
     */
-    double F_norm() const { return sqrt(fnorm_sqr); }
+    double F_norm() const;
 
     /*!
       set the boundary value problem
@@ -216,16 +242,74 @@ namespace WaveletTL
     CUBEBASIS basis_;
 
     // right-hand side coefficients on a fine level, sorted by modulus
-    Array1D<std::pair<typename WaveletBasis::Index,double> > fcoeffs;
+    mutable Array1D<std::pair<typename WaveletBasis::Index,double> > fcoeffs;
 
     // precompute the right-hand side
     void compute_rhs();
 
     // (squared) \ell_2 norm of the precomputed right-hand side
-    double fnorm_sqr;
+    mutable double fnorm_sqr;
+
+    // flag whether the right-hand side is precomputed, otherwise it is computed on demand
+    bool precompute_rhs_;
+
+    // right-hand side coefficients computed on demand (including the tiny ones)
+    mutable std::map<typename WaveletBasis::Index,double> fcache;
+
+    // threshold down to which the index tree has been traversed (-1: not yet)
+    mutable double fcache_threshold;
+
+    // the unrefined leaves of the index tree below jmax, sorted by decreasing modulus
+    // of their coefficients, and their squared \ell_2 norm (the tail estimate of RHS())
+    mutable std::multimap<double,typename WaveletBasis::Index,std::greater<double> > frontier;
+    mutable double ftail_sqr;
+
+    /*
+      traverse the index tree, refining all indices with a coefficient of
+      modulus >= threshold; the traversal starts at the frontier of the previous
+      calls (at level j0 in the first call), the new coefficients are added to
+      fcache, fcoeffs and fnorm_sqr
+    */
+    void refine_rhs(const double threshold) const;
 
     // estimates for ||A|| and ||A^{-1}||
     mutable double normA, normAinv;
+
+    // the 1D wavelet index class
+    typedef typename IBASIS::Index Index1D;
+
+    /*
+      For constant or separable coefficients, we cache the appearing 1D integrals
+      of the factors of psi_lambda and psi_mu in each direction i,
+        [0]: \int a_i(t) psi_lambda_i'(t) psi_mu_i'(t) dt,
+        [1]: \int a_i(t) psi_lambda_i(t) psi_mu_i(t) dt,
+        [2]: \int q_i(t) psi_lambda_i(t) psi_mu_i(t) dt,
+      where a_i=q_i=1 for constant coefficients. The integrals are symmetric,
+      so we only store them for lambda >= mu.
+    */
+    typedef FixedArray1D<double,3> Integrals1D;
+    typedef std::map<Index1D,Integrals1D> Column1D;
+    typedef std::map<Index1D,Column1D> One_D_IntegralCache;
+    mutable FixedArray1D<One_D_IntegralCache,DIM> one_d_integrals;
+
+    // values of the 1D generators and wavelets at the Gauss points of the default quadrature rule
+    mutable FixedArray1D<GaussTable<IBASIS>,DIM> gauss_tables;
+
+    // setup the (empty) tables for the bases in all directions
+    void setup_gauss_tables();
+
+    // compute the 1D integrals in direction i over 2^{-j}[k1,k2] with an N_Gauss-point rule
+    void integrate(const unsigned int i,
+		   const Index1D& lambda, const Index1D& mu,
+		   const int j, const int k1, const int k2,
+		   const int N_Gauss,
+		   Integrals1D& integrals) const;
+
+    // a(psi_lambda,psi_mu) as a sum of products of 1D integrals, supp is the intersection of the supports
+    double a_separable(const Index& lambda, const Index& mu,
+		       const typename CUBEBASIS::Support& supp,
+		       const int N_Gauss,
+		       const bool use_cache) const;
   };
 }
 
@@ -0,0 +1,344 @@
+// implementation for entry_cache.h
+
+#include <algorithm>
+#include <utility>
+
+namespace WaveletTL
+{
+  inline
+  double
+  EntryCache::Block::entry(const int row) const
+  {
+    const int* it(std::lower_bound(rows_, rows_+size_, row));
+    if (it != rows_+size_ && *it == row)
+      return values_[it-rows_];
+    return 0;
+  }
+
+  inline
+  EntryCache::EntryCache(const size_t max_memory)
+    : directory_keys_(), directory_positions_(), columns_(), file_(),
+      max_memory_(max_memory), slab_memory_(0),
+      n_entries_(0), n_blocks_(0), n_evicted_(0)
+  {
+  }
+
+  inline
+  EntryCache::EntryCache(const EntryCache& cache)
+    : directory_keys_(), directory_positions_(), columns_(), file_(),
+      max_memory_(0), slab_memory_(0),
+      n_entries_(0), n_blocks_(0), n_evicted_(0)
+  {
+    *this = cache;
+  }
+
+  inline
+  EntryCache::~EntryCache()
+  {
+    clear();
+  }
+
+  inline
+  EntryCache&
+  EntryCache::operator = (const EntryCache& cache)
+  {
+    if (this != &cache) {
+      clear();
+      directory_keys_ = cache.directory_keys_;
+      directory_positions_ = cache.directory_positions_;
+      columns_ = cache.columns_;
+      // deep copy of the slabs
+      for (std::vector<Column>::iterator it(columns_.begin()); it != columns_.end(); ++it)
+	for (std::vector<Slab>::iterator sit(it->slabs.begin()); sit != it->slabs.end(); ++sit) {
+	  Slab s(allocate_slab(sit->level, sit->distance, sit->partial, sit->size));
+	  std::copy(sit->values, sit->values+sit->size, s.values);
+	  std::copy(sit->rows, sit->rows+sit->size, s.rows);
+	  *sit = s;
+	}
+      file_ = cache.file_;
+      max_memory_ = cache.max_memory_;
+      slab_memory_ = cache.slab_memory_;
+      n_entries_ = cache.n_entries_;
+      n_blocks_ = cache.n_blocks_;
+      n_evicted_ = cache.n_evicted_;
+    }
+    return *this;
+  }
+
+  inline
+  EntryCache::Slab
+  EntryCache::allocate_slab(const int level, const int distance, const bool partial,
+			    const unsigned int n)
+  {
+    Slab s;
+    s.level = level;
+    s.distance = distance;
+    s.partial = partial;
+    s.size = n;
+    if (n == 0) {
+      s.values = 0;
+      s.rows = 0;
+    } else {
+      // one allocation per slab, the rows are stored behind the values
+      s.values = new double[n + (n*sizeof(int)+sizeof(double)-1)/sizeof(double)];
+      s.rows = reinterpret_cast<int*>(s.values+n);
+    }
+    return s;
+  }
+
+  inline
+  void
+  EntryCache::free_slab(Slab& s)
+  {
+    delete[] s.values;
+    s.values = 0;
+    s.rows = 0;
+    s.size = 0;
+  }
+
+  inline
+  int
+  EntryCache::column_position(const int column) const
+  {
+    if (directory_keys_.empty()) return -1;
+    const unsigned int mask(directory_keys_.size()-1);
+    for (unsigned int h(((unsigned int)column * 2654435761u) & mask);; h = (h+1) & mask) {
+      const int pos(directory_positions_[h]);
+      if (pos < 0) return -1;
+      if (directory_keys_[h] == column) return pos;
+    }
+  }
+
+  inline
+  unsigned int
+  EntryCache::insert_column(const int column)
+  {
+    const int pos(column_position(column));
+    if (pos >= 0) return pos;
+
+    // keep the load factor of the hash table below 1/2
+    if (2*(columns_.size()+1) > directory_keys_.size())
+      rehash(std::max((size_t)16, 2*directory_keys_.size()));
+
+    const unsigned int mask(directory_keys_.size()-1);
+    unsigned int h(((unsigned int)column * 2654435761u) & mask);
+    while (directory_positions_[h] >= 0) h = (h+1) & mask;
+    directory_keys_[h] = column;
+    directory_positions_[h] = columns_.size();
+
+    Column col;
+    col.key = column;
+    columns_.push_back(col);
+    return columns_.size()-1;
+  }
+
+  inline
+  void
+  EntryCache::rehash(const unsigned int capacity)
+  {
+    directory_keys_.assign(capacity, 0);
+    directory_positions_.assign(capacity, -1);
+    const unsigned int mask(capacity-1);
+    for (unsigned int pos(0); pos < columns_.size(); pos++) {
+      unsigned int h(((unsigned int)columns_[pos].key * 2654435761u) & mask);
+      while (directory_positions_[h] >= 0) h = (h+1) & mask;
+      directory_keys_[h] = columns_[pos].key;
+      directory_positions_[h] = pos;
+    }
+  }
+
+  inline
+  bool
+  EntryCache::find(const int column, const int level, Block& block) const
+  {
+    bool found(false);
+    const int pos(column_position(column));
+    if (pos >= 0) {
+      // the number of levels per column is small, so a linear search is fine
+      const std::vector<Slab>& slabs(columns_[pos].slabs);
+      for (std::vector<Slab>::const_iterator it(slabs.begin()), itend(slabs.end());
+	   it != itend && it->level <= level; ++it)
+	if (it->level == level) {
+	  block = Block(it->size, it->rows, it->values, it->partial);
+	  if (!it->partial) return true;
+	  found = true;
+	  break;
+	}
+    }
+
+    if (file_.is_open()) {
+      const long i(file_.find(column, level));
+      if (i >= 0) {
+	block = Block(file_.record(i).size, file_.rows(i), file_.values(i));
+	return true;
+      }
+    }
+    return found;
+  }
+
+  inline
+  bool
+  EntryCache::has_column(const int column) const
+  {
+    const int pos(column_position(column));
+    return (pos >= 0 && !columns_[pos].slabs.empty())
+      || (file_.is_open() && file_.has_column(column));
+  }
+
+  inline
+  EntryCache::Block
+  EntryCache::insert(const int column, const int level, const int distance,
+		     const std::vector<int>& rows, const std::vector<double>& values,
+		     const bool partial)
+  {
+    const unsigned int n(rows.size());
+
+    // make room for the new block first, so that it will never be evicted itself;
+    // we evict down to 3/4 of the admissible slab memory, to avoid an eviction sweep
+    // for every single insertion
+    if (max_memory_ > 0 && memory() + slab_memory(n) > max_memory_) {
+      const size_t overhead(memory() - slab_memory_ + slab_memory(n));
+      evict(max_memory_ > overhead ? (max_memory_ - overhead) / 4 * 3 : 0);
+    }
+
+    Slab s(allocate_slab(level, distance, partial, n));
+    bool sorted(true);
+    for (unsigned int i(1); i < n && sorted; i++)
+      sorted = rows[i-1] < rows[i];
+    if (sorted) {
+      std::copy(values.begin(), values.end(), s.values);
+      std::copy(rows.begin(), rows.end(), s.rows);
+    } else {
+      std::vector<std::pair<int,double> > entries(n);
+      for (unsigned int i(0); i < n; i++)
+	entries[i] = std::pair<int,double>(rows[i], values[i]);
+      std::sort(entries.begin(), entries.end());
+      for (unsigned int i(0); i < n; i++) {
+	s.rows[i] = entries[i].first;
+	s.values[i] = entries[i].second;
+      }
+    }
+
+    std::vector<Slab>& slabs(columns_[insert_column(column)].slabs);
+    std::vector<Slab>::iterator it(slabs.begin());
+    while (it != slabs.end() && it->level < level) ++it;
+    if (it != slabs.end() && it->level == level) {
+      // replace an existing block
+      slab_memory_ -= slab_memory(it->size);
+      n_entries_ -= it->size;
+      n_blocks_--;
+      free_slab(*it);
+      *it = s;
+    } else {
+      slabs.insert(it, s);
+    }
+    slab_memory_ += slab_memory(n);
+    n_entries_ += n;
+    n_blocks_++;
+
+    return Block(s.size, s.rows, s.values, s.partial);
+  }
+
+  inline
+  void
+  EntryCache::clear()
+  {
+    for (std::vector<Column>::iterator it(columns_.begin()); it != columns_.end(); ++it)
+      for (std::vector<Slab>::iterator sit(it->slabs.begin()); sit != it->slabs.end(); ++sit)
+	free_slab(*sit);
+    columns_.clear();
+    directory_keys_.clear();
+    directory_positions_.clear();
+    slab_memory_ = 0;
+    n_entries_ = 0;
+    n_blocks_ = 0;
+    file_.close();
+  }
+
+  inline
+  bool
+  EntryCache::map_file(const char* filename, const std::string& key)
+  {
+    return file_.open(filename, key);
+  }
+
+  inline
+  bool
+  EntryCache::save(const char* filename, const std::string& key) const
+  {
+    StiffnessCacheFile::Writer writer;
+    if (!writer.open(filename, key)) return false;
+    for (std::vector<Column>::const_iterator it(columns_.begin()); it != columns_.end(); ++it)
+      for (std::vector<Slab>::const_iterator sit(it->slabs.begin()); sit != it->slabs.end(); ++sit)
+	if (!sit->partial)
+	  writer.add_block(it->key, sit->level, sit->distance, sit->size, sit->rows, sit->values);
+    // blocks of the mapped file which are not shadowed by complete blocks in memory
+    for (size_t i(0); i < file_.n_blocks(); i++) {
+      const StiffnessCacheFile::Record& r(file_.record(i));
+      const int pos(column_position(r.column));
+      bool in_memory(false);
+      if (pos >= 0)
+	for (std::vector<Slab>::const_iterator sit(columns_[pos].slabs.begin());
+	     sit != columns_[pos].slabs.end() && !in_memory; ++sit)
+	  in_memory = sit->level == r.level && !sit->partial;
+      if (!in_memory)
+	writer.add_block(r.column, r.level, r.distance, r.size, file_.rows(i), file_.values(i));
+    }
+    return writer.close();
+  }
+
+  inline
+  size_t
+  EntryCache::memory() const
+  {
+    return slab_memory_
+      + columns_.capacity() * sizeof(Column)
+      + directory_keys_.capacity() * (sizeof(int)+sizeof(int));
+  }
+
+  inline
+  void
+  EntryCache::set_max_memory(const size_t max_memory)
+  {
+    max_memory_ = max_memory;
+    if (max_memory_ > 0 && memory() > max_memory_) {
+      const size_t overhead(memory()-slab_memory_);
+      evict(max_memory_ > overhead ? max_memory_ - overhead : 0);
+    }
+  }
+
+  inline
+  void
+  EntryCache::evict(const size_t bound)
+  {
+    if (slab_memory_ <= bound) return;
+
+    // collect all blocks, sorted by decreasing level distance and decreasing size
+    std::vector<Candidate> candidates;
+    candidates.reserve(n_blocks_);
+    for (unsigned int pos(0); pos < columns_.size(); pos++)
+      for (std::vector<Slab>::const_iterator it(columns_[pos].slabs.begin());
+	   it != columns_[pos].slabs.end(); ++it) {
+	Candidate c;
+	c.distance = it->distance;
+	c.size = it->size;
+	c.column = pos;
+	c.level = it->level;
+	candidates.push_back(c);
+      }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (std::vector<Candidate>::const_iterator cit(candidates.begin());
+	 cit != candidates.end() && slab_memory_ > bound; ++cit) {
+      std::vector<Slab>& slabs(columns_[cit->column].slabs);
+      std::vector<Slab>::iterator it(slabs.begin());
+      while (it->level != cit->level) ++it;
+      slab_memory_ -= slab_memory(it->size);
+      n_entries_ -= it->size;
+      n_blocks_--;
+      n_evicted_++;
+      free_slab(*it);
+      slabs.erase(it);
+    }
+  }
+}
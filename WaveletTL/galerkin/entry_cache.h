@@ -0,0 +1,296 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of WaveletTL - the Wavelet Template Library      |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _WAVELETTL_ENTRY_CACHE_H
+#define _WAVELETTL_ENTRY_CACHE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <galerkin/stiffness_cache_file.h>
+
+namespace WaveletTL
+{
+  /*!
+    Cache engine for the entries of a compressible stiffness matrix A,
+    as used by the cached problem classes (CachedProblem, ...).
+
+    The cache is organized by columns (keyed by the number of the column index nu)
+    and, within a column, by level blocks (keyed by an integer level or level number).
+    This is the same logical layout as the former nested std::map cache
+      map<int, map<int, map<int,double> > >,
+    but with a different storage format:
+    - each level block is one contiguous slab holding the sorted row numbers
+      and the corresponding entries (like one column of a CSR/CSC matrix),
+    - the level blocks of a column are kept in a small array sorted by the level key,
+    - the columns are found via an open-addressing hash table (linear probing).
+
+    The cache keeps track of its memory consumption. If a memory limit is set,
+    blocks are evicted before a new block would exceed the limit. Blocks whose level
+    is far from the level of their column are evicted first, since these are the
+    entries which the compression strategies of APPLY only need for the few largest
+    coefficients. Evicted blocks are simply recomputed by the problem class on demand.
+
+    Additionally, a persistent cache file (see StiffnessCacheFile) can be mapped.
+    Level blocks which are not in memory are then looked up in the file, whose pages
+    are only loaded by the operating system when a block is accessed for the first time.
+    The mapped blocks do not count for the memory limit and are never evicted.
+
+    A level block may be partial, i.e., hold only those entries which a compression
+    strategy of APPLY needs (see CachedProblem::add_level()). Partial blocks are
+    flagged, so that a request for the complete block can recompute it, and they
+    are never written into a cache file.
+
+    Views (Block) onto cached level blocks stay valid until the next call
+    of insert(), clear() or set_max_memory(); views onto blocks of a mapped file
+    stay valid until unmap_file() or clear().
+  */
+  class EntryCache
+  {
+  public:
+    /*!
+      read-only view onto one level block of a column
+    */
+    class Block
+    {
+    public:
+      /*!
+	default constructor, yields an empty block
+      */
+      Block() : size_(0), rows_(0), values_(0), partial_(false) {}
+
+      /*!
+	constructor from the slab data
+      */
+      Block(const unsigned int size, const int* rows, const double* values,
+	    const bool partial = false)
+	: size_(size), rows_(rows), values_(values), partial_(partial) {}
+
+      //! number of stored entries
+      unsigned int size() const { return size_; }
+
+      //! row number of the i-th entry
+      int row(const unsigned int i) const { return rows_[i]; }
+
+      //! value of the i-th entry
+      double value(const unsigned int i) const { return values_[i]; }
+
+      //! the sorted row numbers
+      const int* rows() const { return rows_; }
+
+      //! the entries
+      const double* values() const { return values_; }
+
+      //! true if the block holds only a part of the nontrivial entries
+      bool partial() const { return partial_; }
+
+      /*!
+	the entry in a given row (binary search),
+	rows without a stored entry are zero
+      */
+      double entry(const int row) const;
+
+    protected:
+      unsigned int size_;
+      const int* rows_;
+      const double* values_;
+      bool partial_;
+    };
+
+    /*!
+      default constructor, the memory limit is given in bytes (0: no limit)
+    */
+    explicit EntryCache(const size_t max_memory = 0);
+
+    /*!
+      copy constructor
+    */
+    EntryCache(const EntryCache& cache);
+
+    /*!
+      destructor
+    */
+    ~EntryCache();
+
+    /*!
+      assignment
+    */
+    EntryCache& operator = (const EntryCache& cache);
+
+    /*!
+      look up the level block of a column,
+      returns false if the block is not in the cache;
+      a complete block of a mapped file is preferred to a partial block in memory
+    */
+    bool find(const int column, const int level, Block& block) const;
+
+    /*!
+      store a level block of a column, given by the row numbers and the entries,
+      and return a view onto the cached block.
+      The rows need not be sorted. The parameter distance is the (nonnegative)
+      distance between the block level and the level of the column,
+      it determines the eviction order. A partial block replaces a cached block
+      of the same column and level, but it is not saved into a cache file.
+    */
+    Block insert(const int column, const int level, const int distance,
+		 const std::vector<int>& rows, const std::vector<double>& values,
+		 const bool partial = false);
+
+    /*!
+      test whether some level block of a column is in the cache
+    */
+    bool has_column(const int column) const;
+
+    /*!
+      remove all entries, also unmaps a cache file
+    */
+    void clear();
+
+    /*!
+      map a cache file written by save() for the same key,
+      returns false if there is no such file
+    */
+    bool map_file(const char* filename, const std::string& key);
+
+    /*!
+      unmap the cache file
+    */
+    void unmap_file() { file_.close(); }
+
+    /*!
+      the mapped cache file
+    */
+    const StiffnessCacheFile& file() const { return file_; }
+
+    /*!
+      write all complete level blocks (those in memory and those of a mapped file)
+      into a cache file
+    */
+    bool save(const char* filename, const std::string& key) const;
+
+    /*!
+      test emptyness (of the memory part)
+    */
+    bool empty() const { return n_blocks_ == 0; }
+
+    /*!
+      number of cached entries (in memory)
+    */
+    size_t size() const { return n_entries_; }
+
+    /*!
+      number of cached level blocks (in memory)
+    */
+    size_t n_blocks() const { return n_blocks_; }
+
+    /*!
+      number of columns with at least one cached level block (or evicted ones)
+    */
+    size_t n_columns() const { return columns_.size(); }
+
+    /*!
+      number of level blocks evicted so far
+    */
+    size_t n_evicted() const { return n_evicted_; }
+
+    /*!
+      (approximate) memory consumption in bytes
+    */
+    size_t memory() const;
+
+    /*!
+      memory limit in bytes (0: no limit)
+    */
+    size_t max_memory() const { return max_memory_; }
+
+    /*!
+      set the memory limit in bytes (0: no limit),
+      evicts blocks if the cache is already too large
+    */
+    void set_max_memory(const size_t max_memory);
+
+  protected:
+    //! one level block, values and rows are in one allocation
+    struct Slab
+    {
+      int level;
+      int distance;
+      bool partial;
+      unsigned int size;
+      double* values;
+      int* rows;
+    };
+
+    //! one column, the slabs are sorted by level
+    struct Column
+    {
+      int key;
+      std::vector<Slab> slabs;
+    };
+
+    //! helper struct for the eviction, the blocks to be evicted first come first
+    struct Candidate
+    {
+      int distance;
+      unsigned int size;
+      unsigned int column;
+      int level;
+      bool operator < (const Candidate& c) const
+      {
+	return distance > c.distance || (distance == c.distance && size > c.size);
+      }
+    };
+
+    //! bytes occupied by a slab with n entries
+    static size_t slab_memory(const unsigned int n)
+    {
+      return sizeof(Slab) + n*(sizeof(double)+sizeof(int));
+    }
+
+    //! allocate a slab with n entries
+    static Slab allocate_slab(const int level, const int distance, const bool partial,
+			      const unsigned int n);
+
+    //! release the memory of a slab
+    static void free_slab(Slab& s);
+
+    //! position of a column in columns_, or -1
+    int column_position(const int column) const;
+
+    //! position of a column in columns_, inserts a new column if necessary
+    unsigned int insert_column(const int column);
+
+    //! rebuild the hash table with a given capacity (power of 2)
+    void rehash(const unsigned int capacity);
+
+    //! evict blocks until the slab memory is below a given bound
+    void evict(const size_t bound);
+
+    //! hash table: column keys and positions in columns_ (empty slots: position -1)
+    std::vector<int> directory_keys_;
+    std::vector<int> directory_positions_;
+
+    //! the columns
+    std::vector<Column> columns_;
+
+    //! the mapped cache file
+    StiffnessCacheFile file_;
+
+    //! bookkeeping
+    size_t max_memory_;
+    size_t slab_memory_;
+    size_t n_entries_;
+    size_t n_blocks_;
+    size_t n_evicted_;
+  };
+}
+
+#include <galerkin/entry_cache.cpp>
+
+#endif
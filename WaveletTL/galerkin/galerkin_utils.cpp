@@ -1,5 +1,8 @@
 // implementation for galerkin_utils.h
 
+#include <cassert>
+#include <list>
+
 namespace WaveletTL
 {
   //  template <class PROBLEM>
@@ -79,69 +82,167 @@ namespace WaveletTL
 			      SparseMatrix<double>& A_Lambda,
 			      bool preconditioned)
   {
-      
     A_Lambda.resize(Lambda.size(), Lambda.size());
 
     typedef typename SparseMatrix<double>::size_type size_type;
-
-   
     typedef typename PROBLEM::Index Index;
+
+    // random access to the indices and their diagonal preconditioning factors
+    const std::vector<Index> indices(Lambda.begin(), Lambda.end());
+    const size_type n(indices.size());
+    std::vector<double> D(n, 1.0);
     
-    double entry;
 #if PARALLEL_GALERKIN_UTILS==1
     cout<<"parallel computing stiffness matrix"<<endl;
-#pragma omp parallel
+#pragma omp parallel for schedule(dynamic, 16)
+#else
+    cout<<"sequentiell computing stiffness matrix"<<endl;
 #endif
-    {
+    for (long i = 0; i < (long)n; i++)
+      if (preconditioned) D[i] = P.D(indices[i]);
+
+    // the rows are independent, so they can be computed in parallel
+    // (P.a() and P.D() have to be thread-safe then, as for CachedProblem)
 #if PARALLEL_GALERKIN_UTILS==1
-#pragma omp for private(entry)
-    for(size_type row=0;row<Lambda.size();row++){
-        typename std::set<Index>::const_iterator it1(Lambda.begin());
-        advance(it1, row);
-#else
-     cout<<"sequentiell computing stiffness matrix"<<endl;
-    size_type row=0;
-    for (typename std::set<Index>::const_iterator it1(Lambda.begin()), itend(Lambda.end());
-	 it1 != itend; ++it1, ++row)
-      {   
+#pragma omp parallel for schedule(dynamic, 16)
 #endif
+    for (long row = 0; row < (long)n; row++) {
+      const double d1 = D[row];
+      std::list<size_type> row_indices;
+      std::list<double> row_entries;
+      for (size_type column = 0; column < n; column++) {
+	const double entry = P.a(indices[column], indices[row]);
+#if _WAVELETTL_GALERKINUTILS_VERBOSITY >= 2
+	if (fabs(entry) > 1e-15) {
+	  cout << " column: " << indices[column] <<  ", value " << entry << endl;
+	}
+#endif
+	if (fabs(entry) > 1e-15) {
+	  row_indices.push_back(column);
+	  row_entries.push_back(entry / (preconditioned ? d1 * D[column] : 1.0));
+	}
+      }
+      A_Lambda.set_row(row, row_indices, row_entries);
+    }
+    
+    cout << "done setting up stiffness matrix..." << endl;
+  }
 
-//        cout << "Index nu: " << *it1 << endl;
-	const double d1 = preconditioned ? P.D(*it1) : 1.0;
-	std::list<size_type> indices;
-	std::list<double> entries;
-	size_type column = 0;
-	for (typename std::set<Index>::const_iterator it2(Lambda.begin()), itend(Lambda.end());
-	     it2 != itend; ++it2, ++column)
-	  {
-//            cout << "Index nu2: " << *it2 << endl;
-	    // 	    if (intersect_singular_support(P.basis(), *it1, *it2)) {
+  template <class PROBLEM, class INDEX>
+  void update_stiffness_matrix(PROBLEM& P,
+			       const std::set<INDEX>& Lambda_old,
+			       const SparseMatrix<double>& A_old,
+			       const std::set<INDEX>& Lambda,
+			       SparseMatrix<double>& A_Lambda,
+			       bool preconditioned)
+  {
+    assert(&A_old != &A_Lambda);
+    assert(A_old.row_dimension() == Lambda_old.size());
 
-                entry = P.a(*it2, *it1);
+    typedef typename SparseMatrix<double>::size_type size_type;
+    typedef INDEX Index;
 
-	    //const double entry = 0;
-#if _WAVELETTL_GALERKINUTILS_VERBOSITY >= 2
- 	    if (fabs(entry) > 1e-15) {
- 	      cout << " column: " << *it2 <<  ", value " << entry << endl;
- 	    }
+    const std::vector<Index> indices(Lambda.begin(), Lambda.end());
+    const size_type n(indices.size());
+
+    // match both (sorted) index sets:
+    // old_position[i] is the row of indices[i] in A_old (or -1 for a new index),
+    // new_position[k] is the row of the k-th old index in A_Lambda (or -1 for a dropped index)
+    std::vector<long> old_position(n, -1), new_position(Lambda_old.size(), -1);
+    std::vector<size_type> new_indices;
+    {
+      typename std::set<Index>::const_iterator it_old(Lambda_old.begin()), itend_old(Lambda_old.end());
+      size_type k = 0;
+      for (size_type i = 0; i < n; i++) {
+	while (it_old != itend_old && *it_old < indices[i]) {
+	  ++it_old;
+	  ++k;
+	}
+	if (it_old != itend_old && *it_old == indices[i]) {
+	  old_position[i] = k;
+	  new_position[k] = i;
+	  ++it_old;
+	  ++k;
+	} else {
+	  new_indices.push_back(i);
+	}
+      }
+    }
+
+#if _WAVELETTL_GALERKINUTILS_VERBOSITY >= 1
+    cout << "update_stiffness_matrix(): " << new_indices.size() << " new indices, "
+	 << Lambda_old.size()-(n-new_indices.size()) << " dropped indices" << endl;
 #endif
-                
-#pragma omp critical
-            {
-	    if (fabs(entry) > 1e-15) {
 
-                indices.push_back(column);
-		entries.push_back(entry / (preconditioned ? d1 * P.D(*it2) : 1.0));
-	    
-            }            
+    A_Lambda.resize(n, n);
+
+    std::vector<double> D(n, 1.0);
+#if PARALLEL_GALERKIN_UTILS==1
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for (long i = 0; i < (long)n; i++)
+      if (preconditioned) D[i] = P.D(indices[i]);
+
+#if PARALLEL_GALERKIN_UTILS==1
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for (long row = 0; row < (long)n; row++) {
+      const double d1 = D[row];
+      std::list<size_type> row_indices;
+      std::list<double> row_entries;
+      if (old_position[row] < 0) {
+	// new row, compute all entries
+	for (size_type column = 0; column < n; column++) {
+	  const double entry = P.a(indices[column], indices[row]);
+	  if (fabs(entry) > 1e-15) {
+	    row_indices.push_back(column);
+	    row_entries.push_back(entry / (preconditioned ? d1 * D[column] : 1.0));
+	  }
+	}
+      } else {
+	// old row, merge the old entries (with renumbered columns) and the entries of the new columns,
+	// both sequences are sorted by the column number
+	const size_type old_row(old_position[row]);
+	const size_type old_entries(A_old.entries_in_row(old_row));
+	size_type m = 0;
+	typename std::vector<size_type>::const_iterator it_new(new_indices.begin()), itend_new(new_indices.end());
+	while (m < old_entries || it_new != itend_new) {
+	  long old_column = -1;
+	  while (m < old_entries && (old_column = new_position[A_old.get_nth_index(old_row, m)]) < 0)
+	    m++;
+	  if (m < old_entries && (it_new == itend_new || old_column < (long)*it_new)) {
+	    row_indices.push_back(old_column);
+	    row_entries.push_back(A_old.get_nth_entry(old_row, m));
+	    m++;
+	  } else if (it_new != itend_new) {
+	    const double entry = P.a(indices[*it_new], indices[row]);
+	    if (fabs(entry) > 1e-15) {
+	      row_indices.push_back(*it_new);
+	      row_entries.push_back(entry / (preconditioned ? d1 * D[*it_new] : 1.0));
 	    }
+	    ++it_new;
 	  }
-	A_Lambda.set_row(row, indices, entries);
+	}
       }
+      A_Lambda.set_row(row, row_indices, row_entries);
     }
-   
-    
-    cout << "done setting up stiffness matrix..." << endl;
+  }
+
+  template <class PROBLEM, class INDEX>
+  void setup_stiffness_matrix(PROBLEM& P,
+			      const std::set<INDEX>& Lambda,
+			      StiffnessMatrixCache<INDEX>& cache,
+			      bool preconditioned)
+  {
+    if (cache.Lambda.empty() || cache.preconditioned != preconditioned) {
+      setup_stiffness_matrix(P, Lambda, cache.A, preconditioned);
+    } else {
+      SparseMatrix<double> A_Lambda;
+      update_stiffness_matrix(P, cache.Lambda, cache.A, Lambda, A_Lambda, preconditioned);
+      cache.A = A_Lambda;
+    }
+    cache.Lambda = Lambda;
+    cache.preconditioned = preconditioned;
   }
 
     template <class PROBLEM>
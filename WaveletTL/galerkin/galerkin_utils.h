@@ -11,6 +11,7 @@
 #define _WAVELETTL_GALERKIN_UTILS_H
 
 #include <set>
+#include <vector>
 
 #include <algebra/sparse_matrix.h>
 #include <algebra/vector.h>
@@ -55,8 +56,56 @@ namespace WaveletTL
 			      SparseMatrix<double>& A_Lambda,
 			      bool preconditioned = true); 
 
+  /*!
+    Update the stiffness matrix A_old w.r.t. the index set Lambda_old to the stiffness matrix
+    A_Lambda w.r.t. a new index set Lambda (A_Lambda and A_old have to be different objects).
+    The entries a(lambda,nu) with lambda,nu in Lambda_old are copied from A_old,
+    only the rows and columns of the indices in Lambda\Lambda_old are computed.
+    Indices of Lambda_old which are not in Lambda are dropped.
+    A_old must have been set up with the same problem and the same preconditioning flag.
+    INDEX may be the index class of the problem or int, cf. setup_stiffness_matrix().
+    This is much cheaper than setup_stiffness_matrix() if Lambda is a small extension of
+    Lambda_old, as it is the case for the growing index sets of CDD1 and AWGM.
+  */
+  template <class PROBLEM, class INDEX>
+  void update_stiffness_matrix(PROBLEM& P,
+			       const std::set<INDEX>& Lambda_old,
+			       const SparseMatrix<double>& A_old,
+			       const std::set<INDEX>& Lambda,
+			       SparseMatrix<double>& A_Lambda,
+			       bool preconditioned = true);
+
+  /*!
+    a stiffness matrix together with its index set,
+    to be reused by the following variant of setup_stiffness_matrix()
+  */
+  template <class INDEX>
+  struct StiffnessMatrixCache
+  {
+    //! default constructor, yields an empty cache
+    StiffnessMatrixCache() : Lambda(), A(), preconditioned(true) {}
+
+    //! the index set of A
+    std::set<INDEX> Lambda;
+
+    //! the stiffness matrix w.r.t. Lambda
+    SparseMatrix<double> A;
+
+    //! whether A is preconditioned
+    bool preconditioned;
+  };
+
+  /*!
+    Setup the stiffness matrix for a given index set Lambda in cache.A, reusing the
+    entries of the previous matrix in the cache (see update_stiffness_matrix()).
+    An empty cache or a change of the preconditioning flag leads to the full assembly.
+  */
+  template <class PROBLEM, class INDEX>
+  void setup_stiffness_matrix(PROBLEM& P,
+			      const std::set<INDEX>& Lambda,
+			      StiffnessMatrixCache<INDEX>& cache,
+			      bool preconditioned = true);
 
-  
   /*!
    * Setup the (preconditioned) right-hand side for a given problem and a given active
    * index set Lambda.
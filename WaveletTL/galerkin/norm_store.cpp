@@ -0,0 +1,70 @@
+// implementation for norm_store.h
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace WaveletTL
+{
+  inline
+  bool load_norm_estimates(const char* filename, const std::string& key,
+			   double& normA, double& normAinv)
+  {
+    std::ifstream ifs(filename);
+    std::string line;
+    while (std::getline(ifs, line)) {
+      std::istringstream is(line);
+      double nA, nAinv;
+      if (!(is >> nA >> nAinv)) continue;
+      is.get(); // the blank in front of the key
+      std::string line_key;
+      std::getline(is, line_key);
+      if (line_key == key && nA > 0 && nAinv > 0) {
+	normA = nA;
+	normAinv = nAinv;
+	return true;
+      }
+    }
+    return false;
+  }
+
+  inline
+  bool save_norm_estimates(const char* filename, const std::string& key,
+			   const double normA, const double normAinv)
+  {
+    // keep all other lines of the store
+    std::vector<std::string> lines;
+    {
+      std::ifstream ifs(filename);
+      std::string line;
+      while (std::getline(ifs, line)) {
+	std::istringstream is(line);
+	double nA, nAinv;
+	if (!(is >> nA >> nAinv)) continue;
+	is.get();
+	std::string line_key;
+	std::getline(is, line_key);
+	if (line_key != key)
+	  lines.push_back(line);
+      }
+    }
+
+    std::ostringstream entry;
+    entry.precision(17);
+    entry << normA << " " << normAinv << " " << key;
+    lines.push_back(entry.str());
+
+    const std::string tmpname = std::string(filename) + ".tmp";
+    {
+      std::ofstream ofs(tmpname.c_str());
+      for (unsigned int i = 0; i < lines.size(); i++)
+	ofs << lines[i] << "\n";
+      if (!ofs.good()) {
+	remove(tmpname.c_str());
+	return false;
+      }
+    }
+    return rename(tmpname.c_str(), filename) == 0;
+  }
+}
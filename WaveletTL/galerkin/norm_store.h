@@ -0,0 +1,43 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of WaveletTL - the Wavelet Template Library      |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _WAVELETTL_NORM_STORE_H
+#define _WAVELETTL_NORM_STORE_H
+
+#include <string>
+
+namespace WaveletTL
+{
+  /*!
+    A small persistent store of the estimates for ||A|| and ||A^{-1}|| computed by
+    the cached problem classes, so that they are computed only once per operator.
+
+    The store is a text file with one line
+      normA normAinv key
+    per operator. The key identifies the operator and the discretization,
+    as the keys of the stiffness cache files (cf. CachedProblem::load_cache()).
+  */
+
+  /*!
+    read the estimates for a given key, returns false if the file or the key does not exist
+  */
+  bool load_norm_estimates(const char* filename, const std::string& key,
+			   double& normA, double& normAinv);
+
+  /*!
+    store the estimates for a given key (replacing an existing line with the same key),
+    the file is written via a temporary file which is renamed at the end
+  */
+  bool save_norm_estimates(const char* filename, const std::string& key,
+			   const double normA, const double normAinv);
+}
+
+#include <galerkin/norm_store.cpp>
+
+#endif
@@ -0,0 +1,309 @@
+// implementation for stiffness_cache_file.h
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace WaveletTL
+{
+  inline
+  bool operator < (const StiffnessCacheFile::Record& r1, const StiffnessCacheFile::Record& r2)
+  {
+    return r1.column < r2.column || (r1.column == r2.column && r1.level < r2.level);
+  }
+
+  inline
+  StiffnessCacheFile::StiffnessCacheFile()
+    : filename_(), key_(), map_(0), map_size_(0), records_(0), n_blocks_(0), n_entries_(0)
+  {
+  }
+
+  inline
+  StiffnessCacheFile::StiffnessCacheFile(const StiffnessCacheFile& file)
+    : filename_(), key_(), map_(0), map_size_(0), records_(0), n_blocks_(0), n_entries_(0)
+  {
+    *this = file;
+  }
+
+  inline
+  StiffnessCacheFile::~StiffnessCacheFile()
+  {
+    close();
+  }
+
+  inline
+  StiffnessCacheFile&
+  StiffnessCacheFile::operator = (const StiffnessCacheFile& file)
+  {
+    if (this != &file) {
+      close();
+      if (file.is_open()) {
+	// copy the strings first, open() overwrites them
+	const std::string filename(file.filename_), key(file.key_);
+	open(filename.c_str(), key);
+      }
+    }
+    return *this;
+  }
+
+  inline
+  bool
+  StiffnessCacheFile::open(const char* filename, const std::string& key)
+  {
+    close();
+
+    const int fd(::open(filename, O_RDONLY));
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Header)) {
+      ::close(fd);
+      return false;
+    }
+    void* map(mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0));
+    ::close(fd); // the mapping stays valid
+    if (map == MAP_FAILED) return false;
+
+    // validate header, key and directory
+    const char* data(static_cast<const char*>(map));
+    const Header* header(reinterpret_cast<const Header*>(data));
+    const unsigned long long size(st.st_size);
+    const unsigned long long blocks_begin(padded(sizeof(Header)) + padded(key.size()));
+    bool valid(std::memcmp(header->magic, "WTLSTIFF", 8) == 0
+	       && header->version == version
+	       && header->byte_order == byte_order_mark
+	       && header->key_length == key.size()
+	       && blocks_begin <= size
+	       && key.compare(0, key.size(), data+sizeof(Header), header->key_length) == 0
+	       && header->directory_offset % 8 == 0
+	       && header->directory_offset >= blocks_begin
+	       && header->directory_offset <= size
+	       && header->n_blocks <= (size - header->directory_offset) / sizeof(Record));
+
+    // validate the block directory: each block has to lie between the key and the directory,
+    // the records have to be sorted (see find()), and the sizes have to add up
+    if (valid) {
+      const Record* records(reinterpret_cast<const Record*>(data + header->directory_offset));
+      const unsigned long long entry_bytes(sizeof(double) + sizeof(int));
+      unsigned long long n_entries(0);
+      for (unsigned long long i(0); valid && i < header->n_blocks; i++) {
+	const Record& r(records[i]);
+	valid = r.offset % 8 == 0
+	  && r.offset >= blocks_begin
+	  && r.offset <= header->directory_offset
+	  && r.size <= (header->directory_offset - r.offset) / entry_bytes
+	  && (i == 0 || records[i-1] < r);
+	n_entries += r.size;
+      }
+      valid = valid && n_entries == header->n_entries;
+    }
+
+    if (!valid) {
+      munmap(map, st.st_size);
+      return false;
+    }
+
+    filename_ = filename;
+    key_ = key;
+    map_ = map;
+    map_size_ = st.st_size;
+    records_ = reinterpret_cast<const Record*>(data + header->directory_offset);
+    n_blocks_ = header->n_blocks;
+    n_entries_ = header->n_entries;
+    return true;
+  }
+
+  inline
+  void
+  StiffnessCacheFile::close()
+  {
+    if (map_ != 0)
+      munmap(map_, map_size_);
+    filename_.clear();
+    key_.clear();
+    map_ = 0;
+    map_size_ = 0;
+    records_ = 0;
+    n_blocks_ = 0;
+    n_entries_ = 0;
+  }
+
+  inline
+  const double*
+  StiffnessCacheFile::values(const size_t i) const
+  {
+    return reinterpret_cast<const double*>(static_cast<const char*>(map_) + records_[i].offset);
+  }
+
+  inline
+  const int*
+  StiffnessCacheFile::rows(const size_t i) const
+  {
+    return reinterpret_cast<const int*>(values(i) + records_[i].size);
+  }
+
+  inline
+  long
+  StiffnessCacheFile::find(const int column, const int level) const
+  {
+    Record r;
+    r.column = column;
+    r.level = level;
+    const Record* it(std::lower_bound(records_, records_+n_blocks_, r));
+    if (it != records_+n_blocks_ && it->column == column && it->level == level)
+      return it-records_;
+    return -1;
+  }
+
+  inline
+  bool
+  StiffnessCacheFile::has_column(const int column) const
+  {
+    Record r;
+    r.column = column;
+    r.level = -2147483647-1;
+    const Record* it(std::lower_bound(records_, records_+n_blocks_, r));
+    return it != records_+n_blocks_ && it->column == column;
+  }
+
+  inline
+  unsigned long long
+  StiffnessCacheFile::fingerprint(const std::vector<double>& entries)
+  {
+    double maxentry(0);
+    for (unsigned int i(0); i < entries.size(); i++)
+      maxentry = std::max(maxentry, fabs(entries[i]));
+
+    // round relative to the largest entry, so that roundoff does not change the fingerprint
+    std::ostringstream s;
+    s.precision(10);
+    for (unsigned int i(0); i < entries.size(); i++) {
+      const double r(maxentry > 0 ? entries[i]/maxentry : 0.0);
+      s << (fabs(r) < 1e-10 ? 0.0 : r) << " ";
+    }
+
+    // 64 bit FNV-1a hash
+    const std::string text(s.str());
+    unsigned long long hash(14695981039346656037ULL);
+    for (unsigned int i(0); i < text.size(); i++) {
+      hash ^= (unsigned char)text[i];
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+
+  inline
+  StiffnessCacheFile::Writer::Writer()
+    : stream_(0), filename_(), tmpname_(),
+      offset_(0), key_length_(0), n_entries_(0), records_(), ok_(false)
+  {
+  }
+
+  inline
+  StiffnessCacheFile::Writer::~Writer()
+  {
+    if (stream_ != 0) {
+      fclose(stream_);
+      remove(tmpname_.c_str());
+    }
+  }
+
+  inline
+  bool
+  StiffnessCacheFile::Writer::write(const void* data, const size_t bytes)
+  {
+    static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    const size_t padding(padded(bytes) - bytes);
+    ok_ = ok_
+      && fwrite(data, 1, bytes, stream_) == bytes
+      && fwrite(zeros, 1, padding, stream_) == padding;
+    offset_ += bytes + padding;
+    return ok_;
+  }
+
+  inline
+  bool
+  StiffnessCacheFile::Writer::open(const char* filename, const std::string& key)
+  {
+    if (stream_ != 0) {
+      fclose(stream_);
+      remove(tmpname_.c_str());
+    }
+    filename_ = filename;
+    tmpname_ = filename_ + ".tmp";
+    records_.clear();
+    offset_ = 0;
+    key_length_ = key.size();
+    n_entries_ = 0;
+
+    stream_ = fopen(tmpname_.c_str(), "wb");
+    ok_ = stream_ != 0;
+    if (!ok_) return false;
+
+    // the header is written again by close(), when the directory offset is known
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.magic, "WTLSTIFF", 8);
+    header.version = version;
+    header.byte_order = byte_order_mark;
+    header.key_length = key.size();
+    write(&header, sizeof(Header));
+    return write(key.data(), key.size());
+  }
+
+  inline
+  bool
+  StiffnessCacheFile::Writer::add_block(const int column, const int level, const int distance,
+					const unsigned int size, const int* rows, const double* values)
+  {
+    if (stream_ == 0) return false;
+    Record r;
+    std::memset(&r, 0, sizeof(Record));
+    r.column = column;
+    r.level = level;
+    r.distance = distance;
+    r.size = size;
+    r.offset = offset_;
+    records_.push_back(r);
+    n_entries_ += size;
+    write(values, size*sizeof(double));
+    return write(rows, size*sizeof(int));
+  }
+
+  inline
+  bool
+  StiffnessCacheFile::Writer::close()
+  {
+    if (stream_ == 0) return false;
+
+    std::sort(records_.begin(), records_.end());
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.magic, "WTLSTIFF", 8);
+    header.version = version;
+    header.byte_order = byte_order_mark;
+    header.key_length = key_length_;
+    header.n_blocks = records_.size();
+    header.n_entries = n_entries_;
+    header.directory_offset = offset_;
+    if (!records_.empty())
+      write(&records_[0], records_.size()*sizeof(Record));
+
+    // patch the header
+    ok_ = ok_ && fseek(stream_, 0, SEEK_SET) == 0
+      && fwrite(&header, sizeof(Header), 1, stream_) == 1;
+
+    ok_ = (fclose(stream_) == 0) && ok_;
+    stream_ = 0;
+    if (ok_)
+      ok_ = rename(tmpname_.c_str(), filename_.c_str()) == 0;
+    if (!ok_)
+      remove(tmpname_.c_str());
+    records_.clear();
+    return ok_;
+  }
+}
@@ -0,0 +1,222 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of WaveletTL - the Wavelet Template Library      |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _WAVELETTL_STIFFNESS_CACHE_FILE_H
+#define _WAVELETTL_STIFFNESS_CACHE_FILE_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace WaveletTL
+{
+  /*!
+    Persistent (on-disk) storage of the cached entries of a stiffness matrix A,
+    in the same column/level block layout as the EntryCache of the cached problem classes
+    (column number -> level key -> row number -> entry).
+
+    File format (version 2, native byte order, all sections aligned to 8 bytes):
+    - header: magic "WTLSTIFF", format version, byte order mark, length of the key,
+      number of blocks and entries, offset of the block directory,
+    - the key: a string identifying the operator and the discretization
+      (problem class, basis parameters, boundary conditions, ...); a file is only
+      accepted if its key coincides with the expected one,
+    - the level blocks: the entries (double) followed by the sorted row numbers (int),
+    - the block directory: column, level, level distance, size and offset of each block,
+      sorted by column and level.
+
+    The file is mapped into memory by open(), so that the blocks are paged in by
+    the operating system on their first access only. Views (EntryCache::Block style
+    pointers) onto the blocks stay valid until close().
+    Files are written by the nested class Writer via a temporary file, which is renamed
+    at the end, so that a mapped file with the same name is never modified.
+  */
+  class StiffnessCacheFile
+  {
+  public:
+    //! version of the file format
+    static const unsigned int version = 2;
+
+    //! one entry of the block directory
+    struct Record
+    {
+      int column;
+      int level;
+      int distance;
+      unsigned int size;
+      unsigned long long offset;
+    };
+
+    /*!
+      default constructor, no file is mapped
+    */
+    StiffnessCacheFile();
+
+    /*!
+      copy constructor, maps the same file again
+    */
+    StiffnessCacheFile(const StiffnessCacheFile& file);
+
+    /*!
+      destructor
+    */
+    ~StiffnessCacheFile();
+
+    /*!
+      assignment, maps the same file again
+    */
+    StiffnessCacheFile& operator = (const StiffnessCacheFile& file);
+
+    /*!
+      map a cache file, returns false (and maps nothing) if the file does not exist,
+      has another format version or byte order, was written for another key,
+      or is truncated or corrupt (blocks outside of the file, unsorted directory)
+    */
+    bool open(const char* filename, const std::string& key);
+
+    /*!
+      unmap the file
+    */
+    void close();
+
+    /*!
+      test whether a file is mapped
+    */
+    bool is_open() const { return map_ != 0; }
+
+    /*!
+      name of the mapped file
+    */
+    const std::string& filename() const { return filename_; }
+
+    /*!
+      number of stored level blocks
+    */
+    size_t n_blocks() const { return n_blocks_; }
+
+    /*!
+      number of stored entries
+    */
+    size_t n_entries() const { return n_entries_; }
+
+    /*!
+      directory entry of the i-th block (sorted by column and level)
+    */
+    const Record& record(const size_t i) const { return records_[i]; }
+
+    /*!
+      the sorted row numbers of the i-th block
+    */
+    const int* rows(const size_t i) const;
+
+    /*!
+      the entries of the i-th block
+    */
+    const double* values(const size_t i) const;
+
+    /*!
+      look up the level block of a column (binary search in the directory),
+      returns the number of the block or -1
+    */
+    long find(const int column, const int level) const;
+
+    /*!
+      test whether some level block of a column is stored
+    */
+    bool has_column(const int column) const;
+
+    /*!
+      fingerprint of an operator for the key of a cache file: a 64 bit hash of some
+      of its entries (e.g. those of the first and last generators on the coarsest level),
+      rounded to 10 significant digits relative to the largest one
+    */
+    static unsigned long long fingerprint(const std::vector<double>& entries);
+
+    /*!
+      Writer for cache files. The blocks are written immediately, in any order,
+      the directory is sorted and written by close().
+    */
+    class Writer
+    {
+    public:
+      /*!
+	default constructor
+      */
+      Writer();
+
+      /*!
+	destructor, discards an unfinished file
+      */
+      ~Writer();
+
+      /*!
+	start writing a cache file for a given key
+      */
+      bool open(const char* filename, const std::string& key);
+
+      /*!
+	write one level block, the rows have to be sorted
+      */
+      bool add_block(const int column, const int level, const int distance,
+		     const unsigned int size, const int* rows, const double* values);
+
+      /*!
+	write the directory and move the file to its final name
+      */
+      bool close();
+
+    protected:
+      //! write raw data and pad to a multiple of 8 bytes
+      bool write(const void* data, const size_t bytes);
+
+      FILE* stream_;
+      std::string filename_, tmpname_;
+      unsigned long long offset_, key_length_, n_entries_;
+      std::vector<Record> records_;
+      bool ok_;
+
+    private:
+      Writer(const Writer&);
+      Writer& operator = (const Writer&);
+    };
+
+  protected:
+    //! file header
+    struct Header
+    {
+      char magic[8];
+      unsigned int version;
+      unsigned int byte_order;
+      unsigned long long key_length;
+      unsigned long long n_blocks;
+      unsigned long long n_entries;
+      unsigned long long directory_offset;
+    };
+
+    //! byte order mark
+    static const unsigned int byte_order_mark = 0x01020304;
+
+    //! bytes of a section of a given length, padded to a multiple of 8
+    static unsigned long long padded(const unsigned long long bytes)
+    {
+      return (bytes + 7) / 8 * 8;
+    }
+
+    std::string filename_, key_;
+    void* map_;
+    size_t map_size_;
+    const Record* records_;
+    size_t n_blocks_, n_entries_;
+  };
+}
+
+#include <galerkin/stiffness_cache_file.cpp>
+
+#endif
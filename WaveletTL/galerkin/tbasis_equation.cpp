@@ -110,7 +110,8 @@ namespace WaveletTL
         // a(u,v) = \int_Omega [a(x)grad u(x)grad v(x)+q(x)u(x)v(x)] dx
         double r = 0;
         double integral[space_dimension], der_integral[space_dimension];
-        integral[0]=0, integral[1]=0, der_integral[0]=0, der_integral[1]=0;
+        for (int i = 0; i < space_dimension; i++)
+            integral[i] = der_integral[i] = 0;
         // first decide whether the supports of psi_lambda and psi_mu intersect
         typedef typename WaveletBasis::Support Support;
         Support supp;
@@ -185,7 +186,17 @@ namespace WaveletTL
 //                cout << "integral[0]: " << integral[0] << endl;
 //                cout << "integral[1]: " << integral[1] << endl;
                 
-                r = ax * (der_integral[0] * integral[1] + integral[0] * der_integral[1]) + qx * (integral[0] * integral[1]); 
+                // a * \sum_i \prod_{k\neq i} integral[k] * der_integral[i] + q * \prod_k integral[k]
+                double mass = 1.0;
+                for (int i = 0; i < space_dimension; i++)
+                {
+                    double share = der_integral[i];
+                    for (int k = 0; k < space_dimension; k++)
+                        if (k != i) share *= integral[k];
+                    r += ax * share;
+                    mass *= integral[i];
+                }
+                r += qx * mass;
                 
             } 
             else // coefficients are not constant:
@@ -238,6 +249,63 @@ namespace WaveletTL
         return r;
     }
 
+    template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+    bool
+    TensorEquation<IBASIS,DIM,TENSORBASIS>::kronecker_coefficients(double& a, double& q) const
+    {
+        if (!bvp_->constant_coefficients())
+            return false;
+        Point<DIM> x;
+        a = bvp_->a(x);
+        q = bvp_->q(x);
+        return true;
+    }
+
+    template <class IBASIS, unsigned int DIM, class TENSORBASIS>
+    void
+    TensorEquation<IBASIS,DIM,TENSORBASIS>::integrals_1D(const unsigned int i,
+                                                         const Index1D& lambda,
+                                                         const Index1D& mu,
+                                                         double& mass,
+                                                         double& stiffness) const
+    {
+        // the integrals are symmetric in lambda and mu
+        const std::pair<int,int> key(std::min(lambda.number(), mu.number()),
+                                     std::max(lambda.number(), mu.number()));
+        typename One_D_KroneckerCache::const_iterator it(one_d_kronecker_integrals[i].find(key));
+        if (it != one_d_kronecker_integrals[i].end())
+        {
+            mass = it->second.first;
+            stiffness = it->second.second;
+            return;
+        }
+
+        // same quadrature as in a()
+        mass = stiffness = 0;
+        typename IBASIS::Support supp;
+        if (intersect_supports(*basis_.bases()[i], lambda, mu, supp))
+        {
+            const unsigned int p = IBASIS::primal_polynomial_degree()*IBASIS::primal_polynomial_degree();
+            const int N_Gauss = (p+1)/2;
+            const double h = ldexp(1.0, -supp.j);
+            Array1D<double> gauss_points(N_Gauss*(supp.k2-supp.k1)), gauss_weights(N_Gauss*(supp.k2-supp.k1));
+            for (int patch = supp.k1; patch < supp.k2; patch++)
+                for (int n = 0; n < N_Gauss; n++) {
+                    gauss_points[(patch-supp.k1)*N_Gauss+n] = h*(2*patch+1+GaussPoints[N_Gauss-1][n])/2.;
+                    gauss_weights[(patch-supp.k1)*N_Gauss+n] = h*GaussWeights[N_Gauss-1][n];
+                }
+            Array1D<double> lambda_values, lambda_der_values, mu_values, mu_der_values;
+            evaluate(*basis_.bases()[i], lambda, gauss_points, lambda_values, lambda_der_values);
+            evaluate(*basis_.bases()[i], mu, gauss_points, mu_values, mu_der_values);
+            for (unsigned int n = 0; n < gauss_points.size(); n++)
+            {
+                mass += lambda_values[n] * mu_values[n] * gauss_weights[n];
+                stiffness += lambda_der_values[n] * mu_der_values[n] * gauss_weights[n];
+            }
+        }
+        one_d_kronecker_integrals[i][key] = std::make_pair(mass, stiffness);
+    }
+
     template <class IBASIS, unsigned int DIM, class TENSORBASIS>
     double
     TensorEquation<IBASIS,DIM,TENSORBASIS>::f(const typename WaveletBasis::Index& lambda) const
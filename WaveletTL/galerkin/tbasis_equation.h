@@ -171,6 +171,26 @@ namespace WaveletTL
         double a(const typename WaveletBasis::Index& lambda,
                  const typename WaveletBasis::Index& nu,
                  const unsigned int p) const;
+
+        /*
+         * For constant coefficients a(x)=a, q(x)=q, the stiffness matrix is a short sum
+         * of Kronecker products of 1D matrices,
+         *   L = a * \sum_i M_1 x ... x S_i x ... x M_DIM + q * M_1 x ... x M_DIM,
+         * with the 1D Gramians M_i and the 1D Laplacians S_i of the bases in direction i.
+         * Returns false for nonconstant coefficients, otherwise a and q are set.
+         * Used by APPLY_TENSOR_KRONECKER.
+         */
+        bool kronecker_coefficients(double& a, double& q) const;
+
+        /*
+         * the entries (M_i)_{lambda,mu} and (S_i)_{lambda,mu} of the 1D matrices in
+         * direction i, see kronecker_coefficients(). The integrals are cached.
+         */
+        void integrals_1D(const unsigned int i,
+                          const Index1D& lambda,
+                          const Index1D& mu,
+                          double& mass,
+                          double& stiffness) const;
                     
         /*
          * estimate the spectral norm ||A||
@@ -246,6 +266,10 @@ namespace WaveletTL
     typedef std::map<Index1D,Column1D> One_D_IntegralCache;
     
     mutable One_D_IntegralCache one_d_integrals;
+
+    // the 1D mass and stiffness integrals of integrals_1D(), one cache per direction
+    typedef std::map<std::pair<int,int>,std::pair<double,double> > One_D_KroneckerCache;
+    mutable FixedArray1D<One_D_KroneckerCache,DIM> one_d_kronecker_integrals;
     // #####################################################################################
         EllipticBVP<DIM>* bvp_;
         TENSORBASIS basis_;
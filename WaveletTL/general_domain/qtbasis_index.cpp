@@ -527,6 +527,7 @@ namespace WaveletTL
     p_ = lambda.p();
     basis_ = lambda.basis();
     num_ = lambda.number();
+    return *this;
     }
 
     template <class IBASIS, unsigned int DIM, class QTBASIS>
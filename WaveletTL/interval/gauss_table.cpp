@@ -0,0 +1,225 @@
+// implementation for gauss_table.h
+
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+namespace WaveletTL
+{
+  template <class IBASIS>
+  GaussTable<IBASIS>::GaussTable(const IBASIS* basis, const int N_Gauss)
+    : basis_(basis), N_Gauss_(N_Gauss)
+  {
+#if PARALLEL_GALERKIN_UTILS==1
+    caches.resize(omp_get_max_threads()+1);
+#else
+    caches.resize(1);
+#endif
+  }
+
+  template <class IBASIS>
+  unsigned int
+  GaussTable<IBASIS>::size() const
+  {
+    unsigned int result = 0;
+    for (unsigned int i = 0; i < caches.size(); i++)
+      result += caches[i].tables.size();
+    return result;
+  }
+
+  template <class IBASIS>
+  void
+  GaussTable<IBASIS>::clear()
+  {
+    for (unsigned int i = 0; i < caches.size(); i++)
+      caches[i] = Cache();
+  }
+
+  // point evaluation with the routines of the basis (hidden by GaussTable::evaluate())
+  template <class IBASIS>
+  inline
+  void
+  evaluate_basis(const IBASIS& basis, const unsigned int derivative,
+		 const typename IBASIS::Index& lambda,
+		 const Array1D<double>& points, Array1D<double>& values)
+  {
+    evaluate(basis, derivative, lambda, points, values);
+  }
+
+  template <class IBASIS>
+  void
+  GaussTable<IBASIS>::compute(const Index& lambda, const int J, const int k1, const int k2,
+			      Table& table) const
+  {
+    const double h = ldexp(1.0, -J);
+    Array1D<double> gauss_points(N_Gauss_*(k2-k1));
+    for (int patch = k1; patch < k2; patch++)
+      for (int n = 0; n < N_Gauss_; n++)
+	gauss_points[(patch-k1)*N_Gauss_+n] = h*(2*patch+1+GaussPoints[N_Gauss_-1][n])/2.;
+
+    Array1D<double> values, der_values;
+    evaluate_basis(*basis_, 0, lambda, gauss_points, values);
+    evaluate_basis(*basis_, 1, lambda, gauss_points, der_values);
+
+    table.k1 = k1;
+    table.k2 = k2;
+    table.values.assign(values.begin(), values.end());
+    table.der_values.assign(der_values.begin(), der_values.end());
+  }
+
+  // check whether two tables coincide (relative to their maximal entries)
+  template <class TABLE>
+  bool
+  translated_tables_coincide(const TABLE& t1, const TABLE& t2, const int shift)
+  {
+    if (t1.k1-shift != t2.k1 || t1.k2-shift != t2.k2)
+      return false;
+    double vmax = 0, dmax = 0, verr = 0, derr = 0;
+    for (unsigned int m = 0; m < t1.values.size(); m++) {
+      vmax = std::max(vmax, fabs(t2.values[m]));
+      dmax = std::max(dmax, fabs(t2.der_values[m]));
+      verr = std::max(verr, fabs(t1.values[m]-t2.values[m]));
+      derr = std::max(derr, fabs(t1.der_values[m]-t2.der_values[m]));
+    }
+    return verr <= 1e-12*vmax && derr <= 1e-12*dmax;
+  }
+
+  template <class IBASIS>
+  typename GaussTable<IBASIS>::Reference
+  GaussTable<IBASIS>::lookup(Cache& cache, const Index& lambda, const int J) const
+  {
+    assert(J >= lambda.j()+lambda.e());
+
+    const Key key(std::make_pair(lambda.j(), lambda.e()), std::make_pair(lambda.k(), J));
+    typename std::map<Key,Reference>::const_iterator it(cache.references.find(key));
+    if (it != cache.references.end())
+      return it->second;
+
+    // support 2^{-J}[k1,k2] of psi_lambda
+    int k1, k2;
+    basis_->support(lambda, k1, k2);
+    const int scale = 1<<(J-lambda.j()-lambda.e());
+    k1 *= scale;
+    k2 *= scale;
+    const int length = k2-k1;
+    const int step = 1<<(J-lambda.j()); // subintervals per translation by 2^{-j}
+
+    // Some bases use reflected wavelets in the right half of [0,1], so the translates are
+    // grouped by the half of the interval, and the vicinity of 1/2 is treated like a boundary.
+    const int mid = 1<<(J-1);
+    const bool left = k2 <= mid;
+    const bool interior = (left
+			   ? k1 >= length && mid-k2 >= length
+			   : k1-mid >= length && (1<<J)-k2 >= length);
+    const LevelKey level_key(std::make_pair(lambda.j(), lambda.e()), std::make_pair(J, left ? 0 : 1));
+
+    Reference ref;
+    typename std::map<LevelKey,Representative>::iterator rit(cache.representatives.end());
+    if (interior) {
+      rit = cache.representatives.find(level_key);
+      if (rit != cache.representatives.end() && rit->second.verified >= 2) {
+	ref.table = rit->second.table;
+	ref.shift = (lambda.k()-rit->second.k)*step;
+	cache.references[key] = ref;
+	return ref;
+      }
+    }
+
+    Table table;
+    compute(lambda, J, k1, k2, table);
+
+    ref.shift = 0;
+    if (rit != cache.representatives.end()
+	&& translated_tables_coincide(table, cache.tables[rit->second.table], (lambda.k()-rit->second.k)*step)) {
+      rit->second.verified++;
+      ref.table = rit->second.table;
+      ref.shift = (lambda.k()-rit->second.k)*step;
+    } else {
+      ref.table = cache.tables.size();
+      cache.tables.push_back(table);
+      if (interior && rit == cache.representatives.end()) {
+	Representative r;
+	r.k = lambda.k();
+	r.table = ref.table;
+	r.verified = 0;
+	cache.representatives[level_key] = r;
+      }
+    }
+    cache.references[key] = ref;
+
+    return ref;
+  }
+
+  template <class IBASIS>
+  void
+  GaussTable<IBASIS>::copy(const Table& table, const int shift, const unsigned int derivative,
+			   const int a, const int b, Array1D<double>& values) const
+  {
+    const std::vector<double>& source(derivative == 0 ? table.values : table.der_values);
+    values.resize(N_Gauss_*(b-a));
+    for (int m = a; m < b; m++) {
+      const int mm = m-shift;
+      for (int n = 0; n < N_Gauss_; n++)
+	values[(m-a)*N_Gauss_+n] = (mm >= table.k1 && mm < table.k2)
+	  ? source[(mm-table.k1)*N_Gauss_+n] : 0.0;
+    }
+  }
+
+  template <class IBASIS>
+  void
+  GaussTable<IBASIS>::evaluate(const unsigned int derivative,
+			       const Index& lambda,
+			       const int J, const int a, const int b,
+			       Array1D<double>& values) const
+  {
+    assert(derivative <= 1);
+
+#if PARALLEL_GALERKIN_UTILS==1
+    const unsigned int thread = omp_get_thread_num();
+    if (thread+1 >= caches.size()) {
+      // no cache of its own, use the shared one
+#pragma omp critical (gauss_table)
+      {
+	Cache& cache(caches.back());
+	const Reference ref(lookup(cache, lambda, J));
+	copy(cache.tables[ref.table], ref.shift, derivative, a, b, values);
+      }
+      return;
+    }
+#else
+    const unsigned int thread = 0;
+#endif
+    Cache& cache(caches[thread]);
+    const Reference ref(lookup(cache, lambda, J));
+    copy(cache.tables[ref.table], ref.shift, derivative, a, b, values);
+  }
+
+  template <class IBASIS>
+  void
+  GaussTable<IBASIS>::evaluate(const Index& lambda,
+			       const int J, const int a, const int b,
+			       Array1D<double>& values,
+			       Array1D<double>& der_values) const
+  {
+#if PARALLEL_GALERKIN_UTILS==1
+    const unsigned int thread = omp_get_thread_num();
+    if (thread+1 >= caches.size()) {
+      // no cache of its own, use the shared one
+#pragma omp critical (gauss_table)
+      {
+	Cache& cache(caches.back());
+	const Reference ref(lookup(cache, lambda, J));
+	copy(cache.tables[ref.table], ref.shift, 0, a, b, values);
+	copy(cache.tables[ref.table], ref.shift, 1, a, b, der_values);
+      }
+      return;
+    }
+#else
+    const unsigned int thread = 0;
+#endif
+    Cache& cache(caches[thread]);
+    const Reference ref(lookup(cache, lambda, J));
+    copy(cache.tables[ref.table], ref.shift, 0, a, b, values);
+    copy(cache.tables[ref.table], ref.shift, 1, a, b, der_values);
+  }
+}
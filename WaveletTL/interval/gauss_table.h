@@ -0,0 +1,145 @@
+// -*- c++ -*-
+
+// +--------------------------------------------------------------------+
+// | This file is part of WaveletTL - the Wavelet Template Library      |
+// |                                                                    |
+// | Copyright (c) 2002-2009                                            |
+// | Thorsten Raasch, Manuel Werner                                     |
+// +--------------------------------------------------------------------+
+
+#ifndef _WAVELETTL_GAUSS_TABLE_H
+#define _WAVELETTL_GAUSS_TABLE_H
+
+#include <map>
+#include <vector>
+#include <utils/array1d.h>
+#include <numerics/gauss_data.h>
+#if PARALLEL_GALERKIN_UTILS==1
+#include <omp.h>
+#endif
+
+using MathTL::Array1D;
+
+namespace WaveletTL
+{
+  /*!
+    Tables of the values and first derivatives of the generators and wavelets
+    of an interval basis at the nodes of a composite N_Gauss-point Gauss rule,
+    as they appear in the quadrature of Galerkin matrix entries.
+
+    For psi_lambda and a granularity J >= lambda.j()+lambda.e(), the table holds
+    the values at the Gauss nodes of all subintervals 2^{-J}[m,m+1] in the support
+    of psi_lambda. Tables are computed on demand with the routine evaluate() of the
+    basis and then kept, so that repeated evaluations reduce to copying.
+
+    Interior generators and wavelets of one level are dyadic translates of each other,
+      psi_{j,e,k}(x) = psi_{j,e,k'}(x-2^{-j}(k-k')),
+    so their tables coincide up to an offset of the subinterval index. For each (j,e,J)
+    and each half of [0,1] (wavelets may be reflected in the right half), we keep one
+    reference function, and functions whose supports keep a distance of at least their
+    own length to the boundary and to 1/2 share its table. Since the number of
+    boundary functions is basis dependent, this is verified numerically: the first two
+    interior candidates are compared with the reference, and only afterwards further
+    candidates are assumed to be translates.
+
+    IBASIS has to provide Index and a member support(lambda,k1,k2) which returns
+    2^{-(j+e)}[k1,k2] (PBasis, DSBasis, SplineBasis).
+    With PARALLEL_GALERKIN_UTILS==1, the table can be used from several threads:
+    each thread keeps its own tables (they are small compared to the Galerkin matrices),
+    so that lookups and evaluations need no synchronization. Threads with a number
+    beyond omp_get_max_threads() at construction share one more set of tables,
+    which is accessed in a critical section.
+  */
+  template <class IBASIS>
+  class GaussTable
+  {
+  public:
+    //! the wavelet index class
+    typedef typename IBASIS::Index Index;
+
+    //! constructor from a basis and the number of Gauss nodes per subinterval
+    GaussTable(const IBASIS* basis = 0, const int N_Gauss = 1);
+
+    //! number of Gauss nodes per subinterval
+    int N_Gauss() const { return N_Gauss_; }
+
+    /*!
+      values (derivative = 0 or 1) of psi_lambda at the nodes of the composite Gauss rule
+      on 2^{-J}[a,b], ordered subinterval by subinterval (as the Gauss points in the
+      Galerkin classes), zero outside the support of psi_lambda
+    */
+    void evaluate(const unsigned int derivative,
+		  const Index& lambda,
+		  const int J, const int a, const int b,
+		  Array1D<double>& values) const;
+
+    //! values and first derivatives of psi_lambda at the same nodes
+    void evaluate(const Index& lambda,
+		  const int J, const int a, const int b,
+		  Array1D<double>& values,
+		  Array1D<double>& der_values) const;
+
+    //! number of stored tables (of all threads)
+    unsigned int size() const;
+
+    //! release all tables
+    void clear();
+
+  protected:
+    //! the underlying basis
+    const IBASIS* basis_;
+
+    //! number of Gauss nodes per subinterval
+    int N_Gauss_;
+
+    // values and first derivatives on the subintervals 2^{-J}[k1,k2]
+    struct Table
+    {
+      int k1, k2;
+      std::vector<double> values, der_values;
+    };
+
+    // a table and the shift (in subintervals of length 2^{-J}) to be applied to the lookup
+    struct Reference
+    {
+      unsigned int table;
+      int shift;
+    };
+
+    // representative interior function of (j,e,J) and the number of verified translates
+    struct Representative
+    {
+      int k;
+      unsigned int table;
+      int verified;
+    };
+
+    typedef std::pair<std::pair<int,int>,std::pair<int,int> > Key; // ((j,e),(k,J))
+    typedef std::pair<std::pair<int,int>,std::pair<int,int> > LevelKey; // ((j,e),(J,half))
+
+    // the tables of one thread
+    struct Cache
+    {
+      std::vector<Table> tables;
+      std::map<Key,Reference> references;
+      std::map<LevelKey,Representative> representatives;
+    };
+
+    // one cache per thread, the last one is shared by the remaining threads
+    mutable std::vector<Cache> caches;
+
+    // return the table of psi_lambda at granularity J in a cache, compute it if necessary
+    Reference lookup(Cache& cache, const Index& lambda, const int J) const;
+
+    // copy the values (derivative = 0 or 1) of a table on 2^{-J}[a,b]
+    void copy(const Table& table, const int shift, const unsigned int derivative,
+	      const int a, const int b, Array1D<double>& values) const;
+
+    // compute the table of psi_lambda at granularity J on the support 2^{-J}[k1,k2]
+    void compute(const Index& lambda, const int J, const int k1, const int k2, Table& table) const;
+  };
+}
+
+#include <interval/gauss_table.cpp>
+
+#endif
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <cassert>
 #include <cmath>
+#include <map>
+#include <vector>
 #include <numerics/schoenberg_splines.h>
 #include <algebra/triangular_matrix.h>
 #include <utils/tiny_tools.h>
@@ -2390,13 +2392,7 @@ namespace WaveletTL
   PBasis<d, dT>::decompose(const InfiniteVector<double, Index>& c,
 			    const int jmin,
 			    InfiniteVector<double, Index>& v) const {
-    v.clear();
-    InfiniteVector<double, Index> help;
-    for (typename InfiniteVector<double, Index>::const_iterator it(c.begin()), itend(c.end());
-	 it != itend; ++it) {
-      decompose_1(it.index(), jmin, help); // calls help.clear() first
-      v.add(*it, help);
-    }
+    decompose_levelwise(c, jmin, true, v);
   }
   
   template <int d, int dT>
@@ -2404,13 +2400,7 @@ namespace WaveletTL
   PBasis<d, dT>::decompose_t(const InfiniteVector<double, Index>& c,
 			      const int jmin,
 			      InfiniteVector<double, Index>& v) const {
-    v.clear();
-    InfiniteVector<double, Index> help;
-    for (typename InfiniteVector<double, Index>::const_iterator it(c.begin()), itend(c.end());
-	 it != itend; ++it) {
-      decompose_t_1(it.index(), jmin, help); // calls help.clear() first
-      v.add(*it, help);
-    }
+    decompose_levelwise(c, jmin, false, v);
   }
   
   template <int d, int dT>
@@ -2418,13 +2408,7 @@ namespace WaveletTL
   PBasis<d, dT>::reconstruct(const InfiniteVector<double, Index>& c,
 			      const int j,
 			      InfiniteVector<double, Index>& v) const {
-    v.clear();
-    for (typename InfiniteVector<double, Index>::const_iterator it(c.begin()), itend(c.end());
-	 it != itend; ++it) {
-      InfiniteVector<double, Index> help;
-      reconstruct_1(it.index(), j, help);
-      v.add(*it, help);
-    }
+    reconstruct_levelwise(c, j, Mj0_t, Mj1_t, v);
   }
 
   template <int d, int dT>
@@ -2432,12 +2416,226 @@ namespace WaveletTL
   PBasis<d, dT>::reconstruct_t(const InfiniteVector<double, Index>& c,
 				const int j,
 				InfiniteVector<double, Index>& v) const {
+    reconstruct_levelwise(c, j, Mj0T_t, Mj1T_t, v);
+  }
+
+  template <int d, int dT>
+  void
+  PBasis<d, dT>::locate_column(const int j, const int e, const size_type col,
+				size_type& row_j0, size_type& offset) const {
+    // cf. the structure of the refinement matrices in assemble_Mj0() and assemble_Mj1()
+    row_j0 = col;
+    offset = 0;
+    if (j > j0()) {
+      if (e == 0) {
+	const size_type rows_top = (int)ceil(Deltasize(j0())/2.0);
+	if (col >= rows_top) {
+	  const size_type bottom = Deltasize(j)-Deltasize(j0())/2;
+	  if (col >= bottom) {
+	    row_j0 = col+rows_top-bottom;
+	    offset = Deltasize(j+1)-Deltasize(j0()+1);
+	  } else {
+	    row_j0 = rows_top-1;
+	    offset = 2*(col-rows_top)+2;
+	  }
+	}
+      } else {
+	const size_type rows_top = 1<<(j0()-1);
+	if (col >= rows_top) {
+	  const size_type bottom = (1<<j)-(1<<(j0()-1));
+	  if (col >= bottom) {
+	    row_j0 = col+rows_top-bottom;
+	    offset = Deltasize(j+1)-Deltasize(j0()+1);
+	  } else {
+	    // [DS] symmetrization: the interior wavelets of the right half use the right filter
+	    if ((int)col < (1<<(j-1))) {
+	      row_j0 = rows_top-1;
+	      offset = 2*(col-rows_top)+2;
+	    } else {
+	      row_j0 = 1<<(j0()-1);
+	      offset = Deltasize(j+1)-Deltasize(j0()+1)+2*((int)col-bottom);
+	    }
+	  }
+	}
+      }
+    }
+  }
+
+  template <int d, int dT>
+  void
+  PBasis<d, dT>::reconstruct_levelwise(const InfiniteVector<double, Index>& c,
+					const int j,
+					const SparseMatrix<double>& M0_t,
+					const SparseMatrix<double>& M1_t,
+					InfiniteVector<double, Index>& v) const {
     v.clear();
+
+    // The entries of c are sorted by level, type and translation index, so we can
+    // sweep through c and the levels simultaneously. On each level, the generator part
+    // is accumulated first, then Mj=(Mj0 Mj1) is applied column by column.
+    typename InfiniteVector<double, Index>::const_iterator it(c.begin()), itend(c.end());
+    if (it == itend) return;
+
+    std::map<size_type, double> gen, gen_next; // generator coefficients on the current and the next level
+    size_type row_j0, offset;
+    for (int level = it.index().j(); level < j; level++) {
+      for (; it != itend && it.index().j() == level && it.index().e() == 0; ++it)
+	gen[it.index().k()-DeltaLmin()] += *it;
+      for (typename std::map<size_type, double>::const_iterator git(gen.begin()), gitend(gen.end());
+	   git != gitend; ++git) {
+	locate_column(level, 0, git->first, row_j0, offset);
+	for (size_type k(0); k < M0_t.entries_in_row(row_j0); k++)
+	  gen_next[M0_t.get_nth_index(row_j0,k)+offset] += M0_t.get_nth_entry(row_j0,k) * git->second;
+      }
+      for (; it != itend && it.index().j() == level; ++it) {
+	locate_column(level, 1, it.index().k(), row_j0, offset);
+	for (size_type k(0); k < M1_t.entries_in_row(row_j0); k++)
+	  gen_next[M1_t.get_nth_index(row_j0,k)+offset] += M1_t.get_nth_entry(row_j0,k) * *it;
+      }
+      gen.swap(gen_next);
+      gen_next.clear();
+    }
+
+    for (typename std::map<size_type, double>::const_iterator git(gen.begin()), gitend(gen.end());
+	 git != gitend; ++git)
+      v.add_coefficient(Index(j, 0, DeltaLmin()+git->first, this), git->second);
+
+    // the remaining entries live on the levels >= j and don't have to be modified
+    for (; it != itend; ++it)
+      v.add_coefficient(it.index(), *it);
+  }
+
+  template <int d, int dT>
+  void
+  PBasis<d, dT>::decompose_levelwise(const InfiniteVector<double, Index>& c,
+				      const int jmin,
+				      const bool primal,
+				      InfiniteVector<double, Index>& v) const {
+    assert(jmin >= j0());
+
+    v.clear();
+
+    // collect the generator coefficients on the levels > jmin,
+    // wavelets and generators on level jmin don't have to be modified
+    int jmax = jmin;
+    for (typename InfiniteVector<double, Index>::const_iterator it(c.begin()), itend(c.end());
+	 it != itend; ++it)
+      if (it.index().e() == 0)
+	jmax = std::max(jmax, it.index().j());
+    std::vector<std::map<size_type, double> > gen(jmax-jmin+1);
     for (typename InfiniteVector<double, Index>::const_iterator it(c.begin()), itend(c.end());
 	 it != itend; ++it) {
-      InfiniteVector<double, Index> help;
-      reconstruct_t_1(it.index(), j, help);
-      v.add(*it, help);
+      assert(it.index().j() >= jmin);
+      if (it.index().e() == 0)
+	gen[it.index().j()-jmin][it.index().k()-DeltaLmin()] += *it;
+      else
+	v.add_coefficient(it.index(), *it);
+    }
+
+    // apply G_{level-1} to the generator part on each level, from the finest one downwards,
+    // i.e., use the rows of (Mj0T, Mj1T) (primal case) or (Mj0, Mj1) (dual case)
+    InfiniteVector<double, size_type> row;
+    for (int level = jmax; level > jmin; level--) {
+      std::map<size_type, double>& gen_coarse(gen[level-1-jmin]);
+      for (typename std::map<size_type, double>::const_iterator git(gen[level-jmin].begin()), gitend(gen[level-jmin].end());
+	   git != gitend; ++git) {
+	if (primal)
+	  Mj0T_get_row(level-1, git->first, row);
+	else
+	  Mj0_get_row(level-1, git->first, row);
+	for (typename InfiniteVector<double, size_type>::const_iterator rit(row.begin()), ritend(row.end());
+	     rit != ritend; ++rit)
+	  gen_coarse[rit.index()] += *rit * git->second;
+	
+	if (primal)
+	  Mj1T_get_row(level-1, git->first, row);
+	else
+	  Mj1_get_row(level-1, git->first, row);
+	for (typename InfiniteVector<double, size_type>::const_iterator rit(row.begin()), ritend(row.end());
+	     rit != ritend; ++rit)
+	  v.add_coefficient(Index(level-1, 1, rit.index(), this), *rit * git->second);
+      }
+    }
+    
+    for (typename std::map<size_type, double>::const_iterator git(gen[0].begin()), gitend(gen[0].end());
+	 git != gitend; ++git)
+      v.add_coefficient(Index(jmin, 0, DeltaLmin()+git->first, this), git->second);
+  }
+
+  template <int d, int dT>
+  void
+  PBasis<d, dT>::apply_Mj(const int j, const Vector<double>& x, Vector<double>& y) const {
+    const size_type gens = Deltasize(j);
+    for (size_type row(0); row < (size_type)Deltasize(j+1); row++)
+      y[row] = 0;
+
+    size_type row_j0, offset;
+    for (size_type col(0); col < gens; col++) {
+      const double xcol = x[col];
+      if (xcol != 0) {
+	locate_column(j, 0, col, row_j0, offset);
+	for (size_type k(0); k < Mj0_t.entries_in_row(row_j0); k++)
+	  y[Mj0_t.get_nth_index(row_j0,k)+offset] += Mj0_t.get_nth_entry(row_j0,k) * xcol;
+      }
+    }
+    for (size_type col(0); col < (size_type)Nablasize(j); col++) {
+      const double xcol = x[gens+col];
+      if (xcol != 0) {
+	locate_column(j, 1, col, row_j0, offset);
+	for (size_type k(0); k < Mj1_t.entries_in_row(row_j0); k++)
+	  y[Mj1_t.get_nth_index(row_j0,k)+offset] += Mj1_t.get_nth_entry(row_j0,k) * xcol;
+      }
+    }
+  }
+
+  template <int d, int dT>
+  void
+  PBasis<d, dT>::apply_Gj(const int j, const Vector<double>& x, Vector<double>& y) const {
+    // the rows of Gj are the columns of Mj0T and Mj1T
+    const size_type gens = Deltasize(j);
+    size_type row_j0, offset;
+    for (size_type col(0); col < gens; col++) {
+      locate_column(j, 0, col, row_j0, offset);
+      double help = 0;
+      for (size_type k(0); k < Mj0T_t.entries_in_row(row_j0); k++)
+	help += Mj0T_t.get_nth_entry(row_j0,k) * x[Mj0T_t.get_nth_index(row_j0,k)+offset];
+      y[col] = help;
+    }
+    for (size_type col(0); col < (size_type)Nablasize(j); col++) {
+      locate_column(j, 1, col, row_j0, offset);
+      double help = 0;
+      for (size_type k(0); k < Mj1T_t.entries_in_row(row_j0); k++)
+	help += Mj1T_t.get_nth_entry(row_j0,k) * x[Mj1T_t.get_nth_index(row_j0,k)+offset];
+      y[gens+col] = help;
+    }
+  }
+
+  template <int d, int dT>
+  void
+  PBasis<d, dT>::apply_Tj(const int j, const Vector<double>& x, Vector<double>& y) const {
+    assert(x.size() >= (size_type)Deltasize(j+1));
+    y = x;
+    Vector<double> z(x);
+    apply_Mj(j0(), z, y);
+    for (int k = j0()+1; k <= j; k++) {
+      apply_Mj(k, y, z);
+      y.swap(z);
+    }
+  }
+
+  template <int d, int dT>
+  void
+  PBasis<d, dT>::apply_Tjinv(const int j, const Vector<double>& x, Vector<double>& y) const {
+    assert(x.size() >= (size_type)Deltasize(j+1));
+    // T_j^{-1}=diag(G_{j0},I)*...*diag(G_{j-1},I)*G_j
+    y = x;
+    Vector<double> z(x.size(), false);
+    apply_Gj(j, x, y);
+    for (int k = j-1; k >= j0(); k--) {
+      z.swap(y);
+      apply_Gj(k, z, y);
+      for (int i = Deltasize(k+1); i < Deltasize(j+1); i++)
+	y[i] = z[i];
     }
   }
 
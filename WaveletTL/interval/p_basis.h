@@ -340,6 +340,27 @@ namespace WaveletTL
     void reconstruct_t(const InfiniteVector<double, Index>& c, const int j,
 		       InfiniteVector<double, Index>& v) const;
 
+    /*!
+      apply Mj=(Mj0 Mj1) to some vector x of generator and wavelet coefficients on level j
+      (one step of the fast inverse wavelet transform);
+      the routine reads and writes only the first Deltasize(j+1) entries of x and y, i.e,
+      y might be larger than necessary, which is helpful for apply_Tj
+    */
+    void apply_Mj(const int j, const Vector<double>& x, Vector<double>& y) const;
+
+    //! apply Gj=(Mj0T Mj1T)^T to some vector x ("decompose"), analogous to apply_Mj
+    void apply_Gj(const int j, const Vector<double>& x, Vector<double>& y) const;
+
+    /*!
+      apply Tj=Mj*diag(M_{j-1},I)*...*diag(M_{j_0},I), i.e., the fast inverse wavelet transform
+      from the coefficients on the levels j0,...,j (ordered as in the full collection)
+      to the generator coefficients on level j+1
+    */
+    void apply_Tj(const int j, const Vector<double>& x, Vector<double>& y) const;
+
+    //! apply Tj^{-1}, i.e., the fast wavelet transform, several "decompositions" at once
+    void apply_Tjinv(const int j, const Vector<double>& x, Vector<double>& y) const;
+
     /*!
       point evaluation of (derivatives) of a single primal or dual
       generator or wavelet \psi_\lambda or \tilde\psi_\lambda
@@ -525,6 +546,26 @@ namespace WaveletTL
     SparseMatrix<double> Mj0, Mj0T, Mj1, Mj1T;
     SparseMatrix<double> Mj0_t, Mj0T_t, Mj1_t, Mj1T_t;
 
+    /*!
+      locate the column col of M_{j,0} (e=0) or M_{j,1} (e=1) in the refinement matrices on level j0:
+      it is the row row_j0 of Mj0_t resp. Mj1_t, shifted by offset
+      (the same holds for \tilde M_{j,0}, \tilde M_{j,1} and Mj0T_t, Mj1T_t)
+    */
+    void locate_column(const int j, const int e, const size_type col,
+		       size_type& row_j0, size_type& offset) const;
+
+    /*!
+      level-wise RECONSTRUCT for a sparse coefficient set c, where
+      M0_t, M1_t are the transposed (primal or dual) refinement matrices on level j0
+    */
+    void reconstruct_levelwise(const InfiniteVector<double, Index>& c, const int j,
+			       const SparseMatrix<double>& M0_t, const SparseMatrix<double>& M1_t,
+			       InfiniteVector<double, Index>& v) const;
+
+    //! level-wise (primal or dual) DECOMPOSE for a sparse coefficient set c
+    void decompose_levelwise(const InfiniteVector<double, Index>& c, const int jmin, const bool primal,
+			     InfiniteVector<double, Index>& v) const;
+
     //! setup initial refinement matrices Mj0, Mj0Tp [DKU, (3.5.1), (3.5.5)]
     void setup_Mj0  (const Matrix<double>& ML,   const Matrix<double>& MR,   SparseMatrix<double>& Mj0  );
     void setup_Mj0Tp(const Matrix<double>& MLTp, const Matrix<double>& MRTp, SparseMatrix<double>& Mj0Tp);
@@ -0,0 +1,30 @@
+figure
+
+hold on
+
+x = [        -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0];
+;
+y = [         0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625;    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125;   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875;     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625;   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125;    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375;   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375;      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125;   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625;    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625;   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875;     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875;   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125;    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875;   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375;       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25;   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625;    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125;   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875;     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125;   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125;    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375;   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375;      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375;   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625;    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625;   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875;     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375;   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125;    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875;   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375;        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5;   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625;    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125;   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875;     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625;   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125;    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375;   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375;      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625;   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625;    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625;   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875;     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875;   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125;    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875;   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375;       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75;   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625;    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125;   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875;     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125;   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125;    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375;   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375;      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875;   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625;    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625;   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875;     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375;   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125;    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875;   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375;          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1];
+;
+z = [         0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;
+surf(x,y,z)
+
+x = [        -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0;         -1  -0.984375   -0.96875  -0.953125    -0.9375  -0.921875   -0.90625  -0.890625     -0.875  -0.859375   -0.84375  -0.828125    -0.8125  -0.796875   -0.78125  -0.765625      -0.75  -0.734375   -0.71875  -0.703125    -0.6875  -0.671875   -0.65625  -0.640625     -0.625  -0.609375   -0.59375  -0.578125    -0.5625  -0.546875   -0.53125  -0.515625       -0.5  -0.484375   -0.46875  -0.453125    -0.4375  -0.421875   -0.40625  -0.390625     -0.375  -0.359375   -0.34375  -0.328125    -0.3125  -0.296875   -0.28125  -0.265625      -0.25  -0.234375   -0.21875  -0.203125    -0.1875  -0.171875   -0.15625  -0.140625     -0.125  -0.109375   -0.09375  -0.078125    -0.0625  -0.046875   -0.03125  -0.015625          0];
+;
+y = [        -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1;  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375;   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875;  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125;    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375;  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875;   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625;  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625;     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875;  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375;   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375;  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125;    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125;  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875;   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125;  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625;      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75;  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375;   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875;  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125;    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875;  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875;   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625;  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625;     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625;  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375;   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375;  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125;    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625;  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875;   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125;  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625;       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5;  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375;   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875;  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125;    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375;  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875;   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625;  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625;     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375;  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375;   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375;  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125;    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125;  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875;   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125;  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625;      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25;  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375;   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875;  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125;    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875;  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875;   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625;  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625;     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125;  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375;   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375;  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125;    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625;  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875;   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125;  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;
+z = [         0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 1.23079073152054e-19 2.46158146304108e-19 3.69237219456162e-19 4.92316292608216e-19 6.15395365760271e-19 7.38474438912325e-19 8.61553512064379e-19 9.84632585216433e-19 1.23079073152055e-19 -7.38474438912322e-19 -1.6000279509767e-18 -2.46158146304108e-18 -3.32313497510546e-18 -4.18468848716983e-18 -5.04624199923421e-18 -5.90779551129859e-18;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 2.46158146304108e-19 4.92316292608216e-19 7.38474438912325e-19 9.84632585216433e-19 1.23079073152054e-18 1.47694887782465e-18 1.72310702412876e-18 1.96926517043287e-18 2.46158146304111e-19 -1.47694887782464e-18 -3.2000559019534e-18 -4.92316292608216e-18 -6.64626995021091e-18 -8.36937697433967e-18 -1.00924839984684e-17 -1.18155910225972e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 3.69237219456162e-19 7.38474438912325e-19 1.10771165836849e-18 1.47694887782465e-18 1.84618609728081e-18 2.21542331673697e-18 2.58466053619314e-18 2.9538977556493e-18 3.69237219456166e-19 -2.21542331673697e-18 -4.8000838529301e-18 -7.38474438912323e-18 -9.96940492531637e-18 -1.25540654615095e-17 -1.51387259977026e-17 -1.77233865338958e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 4.92316292608216e-19 9.84632585216433e-19 1.47694887782465e-18 1.96926517043287e-18 2.46158146304108e-18 2.9538977556493e-18 3.44621404825752e-18 3.93853034086573e-18 4.92316292608221e-19 -2.95389775564929e-18 -6.4001118039068e-18 -9.84632585216431e-18 -1.32925399004218e-17 -1.67387539486793e-17 -2.01849679969368e-17 -2.36311820451944e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 6.15395365760271e-19 1.23079073152054e-18 1.84618609728081e-18 2.46158146304108e-18 3.07697682880135e-18 3.69237219456162e-18 4.30776756032189e-18 4.92316292608216e-18 6.15395365760276e-19 -3.69237219456161e-18 -8.0001397548835e-18 -1.23079073152054e-17 -1.66156748755273e-17 -2.09234424358492e-17 -2.52312099961711e-17 -2.95389775564929e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 7.38474438912325e-19 1.47694887782465e-18 2.21542331673697e-18 2.9538977556493e-18 3.69237219456162e-18 4.43084663347395e-18 5.16932107238627e-18 5.9077955112986e-18 7.38474438912332e-19 -4.43084663347393e-18 -9.6001677058602e-18 -1.47694887782465e-17 -1.99388098506327e-17 -2.5108130923019e-17 -3.02774519954053e-17 -3.54467730677915e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 8.61553512064379e-19 1.72310702412876e-18 2.58466053619314e-18 3.44621404825752e-18 4.30776756032189e-18 5.16932107238627e-18 6.03087458445065e-18 6.89242809651503e-18 8.61553512064387e-19 -5.16932107238626e-18 -1.12001956568369e-17 -1.72310702412875e-17 -2.32619448257382e-17 -2.92928194101888e-17 -3.53236939946395e-17 -4.13545685790901e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 9.84632585216433e-19 1.96926517043287e-18 2.9538977556493e-18 3.93853034086573e-18 4.92316292608216e-18 5.9077955112986e-18 6.89242809651503e-18 7.87706068173146e-18 9.84632585216443e-19 -5.90779551129858e-18 -1.28002236078136e-17 -1.96926517043286e-17 -2.65850798008436e-17 -3.34775078973587e-17 -4.03699359938737e-17 -4.72623640903887e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 9.53517089194846e-19 1.90703417838969e-18 2.86055126758454e-18 3.81406835677938e-18 4.76758544597423e-18 5.72110253516908e-18 6.67461962436392e-18 7.62813671355877e-18 9.53517089194856e-19 -5.72110253516906e-18 -1.2395722159533e-17 -1.90703417838969e-17 -2.57449614082608e-17 -3.24195810326247e-17 -3.90942006569886e-17 -4.57688202813525e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 9.22401593173259e-19 1.84480318634652e-18 2.76720477951978e-18 3.68960637269304e-18 4.6120079658663e-18 5.53440955903955e-18 6.45681115221281e-18 7.37921274538607e-18 9.22401593173268e-19 -5.53440955903954e-18 -1.19912207112523e-17 -1.84480318634651e-17 -2.4904843015678e-17 -3.13616541678908e-17 -3.78184653201036e-17 -4.42752764723164e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 8.91286097151672e-19 1.78257219430334e-18 2.67385829145502e-18 3.56514438860669e-18 4.45643048575836e-18 5.34771658291003e-18 6.23900268006171e-18 7.13028877721338e-18 8.91286097151681e-19 -5.34771658291002e-18 -1.15867192629717e-17 -1.78257219430334e-17 -2.40647246230951e-17 -3.03037273031568e-17 -3.65427299832185e-17 -4.27817326632802e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 8.60170601130085e-19 1.72034120226017e-18 2.58051180339026e-18 3.44068240452034e-18 4.30085300565043e-18 5.16102360678051e-18 6.0211942079106e-18 6.88136480904068e-18 8.60170601130094e-19 -5.1610236067805e-18 -1.11822178146911e-17 -1.72034120226017e-17 -2.32246062305123e-17 -2.92458004384229e-17 -3.52669946463334e-17 -4.1288188854244e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 8.29055105108499e-19 1.658110210217e-18 2.4871653153255e-18 3.31622042043399e-18 4.14527552554249e-18 4.97433063065099e-18 5.80338573575949e-18 6.63244084086799e-18 8.29055105108507e-19 -4.97433063065098e-18 -1.07777163664105e-17 -1.65811021021699e-17 -2.23844878379294e-17 -2.81878735736889e-17 -3.39912593094484e-17 -3.97946450452079e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 7.97939609086912e-19 1.59587921817382e-18 2.39381882726073e-18 3.19175843634765e-18 3.98969804543456e-18 4.78763765452147e-18 5.58557726360838e-18 6.38351687269529e-18 7.9793960908692e-19 -4.78763765452145e-18 -1.03732149181298e-17 -1.59587921817382e-17 -2.15443694453466e-17 -2.7129946708955e-17 -3.27155239725633e-17 -3.83011012361717e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 7.66824113065325e-19 1.53364822613065e-18 2.30047233919597e-18 3.0672964522613e-18 3.83412056532662e-18 4.60094467839195e-18 5.36776879145727e-18 6.1345929045226e-18 7.66824113065332e-19 -4.60094467839193e-18 -9.9687134698492e-18 -1.53364822613065e-17 -2.07042510527637e-17 -2.6072019844221e-17 -3.14397886356783e-17 -3.68075574271355e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 7.35708617043738e-19 1.47141723408748e-18 2.20712585113121e-18 2.94283446817495e-18 3.67854308521869e-18 4.41425170226243e-18 5.14996031930616e-18 5.8856689363499e-18 7.35708617043745e-19 -4.41425170226241e-18 -9.56421202156857e-18 -1.47141723408747e-17 -1.98641326601809e-17 -2.5014092979487e-17 -3.01640532987932e-17 -3.53140136180994e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 6.4374503991327e-19 1.28749007982654e-18 1.93123511973981e-18 2.57498015965308e-18 3.21872519956635e-18 3.86247023947962e-18 4.50621527939289e-18 5.14996031930616e-18 6.43745039913277e-19 -3.86247023947961e-18 -8.3686855188725e-18 -1.28749007982654e-17 -1.73811160776583e-17 -2.18873313570512e-17 -2.6393546636444e-17 -3.08997619158369e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 5.51781462782803e-19 1.10356292556561e-18 1.65534438834841e-18 2.20712585113121e-18 2.75890731391402e-18 3.31068877669682e-18 3.86247023947962e-18 4.41425170226243e-18 5.51781462782809e-19 -3.31068877669681e-18 -7.17315901617642e-18 -1.1035629255656e-17 -1.48980994951357e-17 -1.87605697346153e-17 -2.26230399740949e-17 -2.64855102135745e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 4.59817885652336e-19 9.19635771304672e-19 1.37945365695701e-18 1.83927154260934e-18 2.29908942826168e-18 2.75890731391402e-18 3.21872519956635e-18 3.67854308521869e-18 4.59817885652341e-19 -2.75890731391401e-18 -5.97763251348035e-18 -9.1963577130467e-18 -1.24150829126131e-17 -1.56338081121794e-17 -1.88525333117457e-17 -2.20712585113121e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 3.67854308521869e-19 7.35708617043738e-19 1.10356292556561e-18 1.47141723408748e-18 1.83927154260934e-18 2.20712585113121e-18 2.57498015965308e-18 2.94283446817495e-18 3.67854308521873e-19 -2.20712585113121e-18 -4.78210601078428e-18 -7.35708617043736e-18 -9.93206633009044e-18 -1.25070464897435e-17 -1.50820266493966e-17 -1.76570068090497e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 2.75890731391402e-19 5.51781462782803e-19 8.27672194174205e-19 1.10356292556561e-18 1.37945365695701e-18 1.65534438834841e-18 1.93123511973981e-18 2.20712585113121e-18 2.75890731391404e-19 -1.6553443883484e-18 -3.58657950808821e-18 -5.51781462782802e-18 -7.44904974756783e-18 -9.38028486730764e-18 -1.13115199870474e-17 -1.32427551067873e-17;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 1.83927154260934e-19 3.67854308521869e-19 5.51781462782803e-19 7.35708617043738e-19 9.19635771304672e-19 1.10356292556561e-18 1.28749007982654e-18 1.47141723408748e-18 1.83927154260936e-19 -1.1035629255656e-18 -2.39105300539214e-18 -3.67854308521868e-18 -4.96603316504522e-18 -6.25352324487176e-18 -7.5410133246983e-18 -8.82850340452484e-18;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0 9.19635771304672e-20 1.83927154260934e-19 2.75890731391402e-19 3.67854308521869e-19 4.59817885652336e-19 5.51781462782803e-19 6.4374503991327e-19 7.35708617043738e-19 9.19635771304681e-20 -5.51781462782801e-19 -1.19552650269607e-18 -1.83927154260934e-18 -2.48301658252261e-18 -3.12676162243588e-18 -3.77050666234915e-18 -4.41425170226242e-18;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;
+surf(x,y,z)
+
+x = [         0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1];
+;
+y = [        -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1         -1;  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375  -0.984375;   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875   -0.96875;  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125  -0.953125;    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375    -0.9375;  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875  -0.921875;   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625   -0.90625;  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625  -0.890625;     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875     -0.875;  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375  -0.859375;   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375   -0.84375;  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125  -0.828125;    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125    -0.8125;  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875  -0.796875;   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125   -0.78125;  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625  -0.765625;      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75      -0.75;  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375  -0.734375;   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875   -0.71875;  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125  -0.703125;    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875    -0.6875;  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875  -0.671875;   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625   -0.65625;  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625  -0.640625;     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625     -0.625;  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375  -0.609375;   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375   -0.59375;  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125  -0.578125;    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625    -0.5625;  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875  -0.546875;   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125   -0.53125;  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625  -0.515625;       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5       -0.5;  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375  -0.484375;   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875   -0.46875;  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125  -0.453125;    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375    -0.4375;  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875  -0.421875;   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625   -0.40625;  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625  -0.390625;     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375     -0.375;  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375  -0.359375;   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375   -0.34375;  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125  -0.328125;    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125    -0.3125;  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875  -0.296875;   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125   -0.28125;  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625  -0.265625;      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25      -0.25;  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375  -0.234375;   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875   -0.21875;  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125  -0.203125;    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875    -0.1875;  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875  -0.171875;   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625   -0.15625;  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625  -0.140625;     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125     -0.125;  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375  -0.109375;   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375   -0.09375;  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125  -0.078125;    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625    -0.0625;  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875  -0.046875;   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125   -0.03125;  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625  -0.015625;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;
+z = [         0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -5.90779551129859e-18   0.140625    0.28125   0.421875     0.5625   0.328125 0.0937499999999999  -0.140625     -0.375 -0.1640625 0.0468749999999999  0.2578125    0.46875  0.3046875   0.140625 -0.0234375    -0.1875 -0.1640625  -0.140625 -0.1171875   -0.09375 -0.0703125  -0.046875 -0.0234375          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -1.18155910225972e-17    0.28125     0.5625    0.84375      1.125    0.65625     0.1875   -0.28125      -0.75  -0.328125 0.0937499999999998   0.515625     0.9375   0.609375    0.28125  -0.046875     -0.375  -0.328125   -0.28125  -0.234375    -0.1875  -0.140625   -0.09375  -0.046875          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -1.77233865338958e-17   0.421875    0.84375   1.265625     1.6875   0.984375    0.28125  -0.421875     -1.125 -0.4921875   0.140625  0.7734375    1.40625  0.9140625   0.421875 -0.0703125    -0.5625 -0.4921875  -0.421875 -0.3515625   -0.28125 -0.2109375  -0.140625 -0.0703125          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -2.36311820451944e-17     0.5625      1.125     1.6875       2.25     1.3125 0.374999999999999    -0.5625       -1.5   -0.65625     0.1875    1.03125      1.875    1.21875     0.5625   -0.09375      -0.75   -0.65625    -0.5625   -0.46875     -0.375   -0.28125    -0.1875   -0.09375          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -2.95389775564929e-17   0.328125    0.65625   0.984375     1.3125   0.765625    0.21875  -0.328125     -0.875 -0.3828125   0.109375  0.6015625    1.09375  0.7109375   0.328125 -0.0546875    -0.4375 -0.3828125  -0.328125 -0.2734375   -0.21875 -0.1640625  -0.109375 -0.0546875          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -3.54467730677915e-17 0.0937499999999998     0.1875    0.28125 0.374999999999999    0.21875 0.0624999999999999 -0.0937499999999999      -0.25  -0.109375 0.0312499999999999   0.171875     0.3125   0.203125 0.0937499999999999  -0.015625     -0.125  -0.109375 -0.0937499999999999 -0.0781249999999999 -0.0624999999999999 -0.0468749999999999   -0.03125  -0.015625          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -4.13545685790901e-17  -0.140625   -0.28125  -0.421875    -0.5625  -0.328125 -0.0937499999999999   0.140625 0.375000000000001  0.1640625 -0.0468749999999999 -0.2578125   -0.46875 -0.3046875  -0.140625  0.0234375     0.1875  0.1640625   0.140625  0.1171875 0.0937500000000001 0.0703125000000001   0.046875  0.0234375          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -4.72623640903887e-17     -0.375      -0.75     -1.125       -1.5     -0.875      -0.25 0.375000000000001          1 0.437500000000001     -0.125    -0.6875      -1.25    -0.8125     -0.375 0.0625000000000001        0.5     0.4375      0.375     0.3125       0.25     0.1875      0.125     0.0625          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -4.57688202813525e-17 -0.1640625  -0.328125 -0.4921875   -0.65625 -0.3828125  -0.109375  0.1640625 0.437500000000001 0.19140625 -0.0546874999999999 -0.30078125  -0.546875 -0.35546875 -0.1640625 0.02734375    0.21875 0.19140625  0.1640625 0.13671875   0.109375 0.0820312500000001  0.0546875 0.02734375          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -4.42752764723164e-17 0.0468749999999999 0.0937499999999998   0.140625     0.1875   0.109375 0.0312499999999999 -0.0468749999999999     -0.125 -0.0546874999999999   0.015625 0.0859374999999999    0.15625  0.1015625 0.0468749999999999 -0.00781249999999997 -0.0624999999999999 -0.0546874999999999 -0.0468749999999999 -0.0390624999999999 -0.0312499999999999 -0.0234375  -0.015625 -0.00781249999999999          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -4.27817326632802e-17  0.2578125   0.515625  0.7734375    1.03125  0.6015625   0.171875 -0.2578125    -0.6875 -0.30078125 0.0859374999999999 0.47265625   0.859375 0.55859375  0.2578125 -0.04296875   -0.34375 -0.30078125 -0.2578125 -0.21484375  -0.171875 -0.12890625 -0.0859375 -0.04296875          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -4.1288188854244e-17    0.46875     0.9375    1.40625      1.875    1.09375     0.3125   -0.46875      -1.25  -0.546875    0.15625   0.859375     1.5625   1.015625    0.46875  -0.078125     -0.625  -0.546875   -0.46875  -0.390625    -0.3125  -0.234375   -0.15625  -0.078125          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -3.97946450452079e-17  0.3046875   0.609375  0.9140625    1.21875  0.7109375   0.203125 -0.3046875    -0.8125 -0.35546875  0.1015625 0.55859375   1.015625 0.66015625  0.3046875 -0.05078125   -0.40625 -0.35546875 -0.3046875 -0.25390625  -0.203125 -0.15234375 -0.1015625 -0.05078125          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -3.83011012361717e-17   0.140625    0.28125   0.421875     0.5625   0.328125 0.0937499999999998  -0.140625     -0.375 -0.1640625 0.0468749999999999  0.2578125    0.46875  0.3046875   0.140625 -0.0234375    -0.1875 -0.1640625  -0.140625 -0.1171875   -0.09375 -0.0703125  -0.046875 -0.0234375          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -3.68075574271355e-17 -0.0234375  -0.046875 -0.0703125   -0.09375 -0.0546875  -0.015625  0.0234375 0.0625000000000001 0.02734375 -0.00781249999999997 -0.04296875  -0.078125 -0.05078125 -0.0234375 0.00390625    0.03125 0.02734375  0.0234375 0.01953125   0.015625 0.01171875  0.0078125 0.00390625          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -3.53140136180994e-17    -0.1875     -0.375    -0.5625      -0.75    -0.4375     -0.125     0.1875        0.5    0.21875 -0.0624999999999999   -0.34375     -0.625   -0.40625    -0.1875    0.03125       0.25    0.21875     0.1875    0.15625      0.125    0.09375     0.0625    0.03125          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -3.08997619158369e-17 -0.1640625  -0.328125 -0.4921875   -0.65625 -0.3828125  -0.109375  0.1640625     0.4375 0.19140625 -0.0546874999999999 -0.30078125  -0.546875 -0.35546875 -0.1640625 0.02734375    0.21875 0.19140625  0.1640625 0.13671875   0.109375 0.08203125  0.0546875 0.02734375          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -2.64855102135745e-17  -0.140625   -0.28125  -0.421875    -0.5625  -0.328125 -0.0937499999999999   0.140625      0.375  0.1640625 -0.0468749999999999 -0.2578125   -0.46875 -0.3046875  -0.140625  0.0234375     0.1875  0.1640625   0.140625  0.1171875    0.09375  0.0703125   0.046875  0.0234375          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -2.20712585113121e-17 -0.1171875  -0.234375 -0.3515625   -0.46875 -0.2734375 -0.0781249999999999  0.1171875     0.3125 0.13671875 -0.0390624999999999 -0.21484375  -0.390625 -0.25390625 -0.1171875 0.01953125    0.15625 0.13671875  0.1171875 0.09765625   0.078125 0.05859375  0.0390625 0.01953125          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -1.76570068090497e-17   -0.09375    -0.1875   -0.28125     -0.375   -0.21875 -0.0624999999999999 0.0937500000000001       0.25   0.109375 -0.0312499999999999  -0.171875    -0.3125  -0.203125   -0.09375   0.015625      0.125   0.109375    0.09375   0.078125     0.0625   0.046875    0.03125   0.015625          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -1.32427551067873e-17 -0.0703125  -0.140625 -0.2109375   -0.28125 -0.1640625 -0.0468749999999999 0.0703125000000001     0.1875 0.0820312500000001 -0.0234375 -0.12890625  -0.234375 -0.15234375 -0.0703125 0.01171875    0.09375 0.08203125  0.0703125 0.05859375   0.046875 0.03515625  0.0234375 0.01171875          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -8.82850340452484e-18  -0.046875   -0.09375  -0.140625    -0.1875  -0.109375   -0.03125   0.046875      0.125  0.0546875  -0.015625 -0.0859375   -0.15625 -0.1015625  -0.046875  0.0078125     0.0625  0.0546875   0.046875  0.0390625    0.03125  0.0234375   0.015625  0.0078125          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0; -4.41425170226242e-18 -0.0234375  -0.046875 -0.0703125   -0.09375 -0.0546875  -0.015625  0.0234375     0.0625 0.02734375 -0.00781249999999999 -0.04296875  -0.078125 -0.05078125 -0.0234375 0.00390625    0.03125 0.02734375  0.0234375 0.01953125   0.015625 0.01171875  0.0078125 0.00390625          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;
+surf(x,y,z)
+
+hold off
+
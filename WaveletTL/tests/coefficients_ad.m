@@ -0,0 +1,7487 @@
+figure;
+colormap((flipud(gray)));
+X=(flipud(gray));
+subplot(7,5,1);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,3), (0,0):               ','rotation',0)
+title 'level 6'
+axis([0,1,0,1]);
+Y=ceil(0.471224 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.559162 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.607803 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.647009 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.681523 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.712609 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.733361 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.735622 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.559163 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.642961 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.691606 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.730811 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.765325 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.796412 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.817163 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.823538 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.607803 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.691606 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.74025 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.779456 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.81397 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.845056 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.865808 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.872182 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.647009 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.730811 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.779456 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.818661 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.853175 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.884261 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.905013 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.911387 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.681523 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.765325 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.81397 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.853175 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.887689 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.918775 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.939527 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.945901 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.712609 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.796412 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.845056 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.884261 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.918775 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.949861 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.970613 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.976987 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.733361 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.817163 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.865808 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.905013 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.939527 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.970613 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.991365 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.997739 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.735622 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.823538 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.872182 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.911387 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.945901 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.976987 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.997739 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(1 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,6);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,3), (0,1):               ','rotation',0)
+title 'level 6'
+axis([0,1,0,1]);
+Y=ceil(0.283393 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.321799 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.348334 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.36331 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.311618 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.444535 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.545543 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.613697 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.37895 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415964 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.441823 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.456513 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.405013 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.537484 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.638972 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.707742 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.427287 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.464482 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.490386 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.505118 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.45359 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.586127 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.687616 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.756386 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.466533 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.503704 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.529603 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.54433 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.492801 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.625333 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.726821 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.795591 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.501045 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.538215 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.564114 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.57884 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.527313 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.659846 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.761335 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.830105 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.53213 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.569303 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.595202 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.609929 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.558403 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.690933 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.792421 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.861191 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.552888 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.590055 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.615953 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.63068 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.579152 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.711684 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.813174 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.881944 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.549016 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.586807 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.613187 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.627914 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.576386 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.708919 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.809924 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.878075 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,11);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,3), (1,0):               ','rotation',0)
+title 'level 6'
+axis([0,1,0,1]);
+Y=ceil(0.28335 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.378956 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.427286 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.466532 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.501046 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.532129 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.552888 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.549016 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.321684 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415976 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.464479 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.503704 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.538215 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.569303 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.590055 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.586807 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.34825 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.441832 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.490384 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.529604 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.564114 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.595202 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.615953 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.613187 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.363298 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.456514 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.505118 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.54433 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.57884 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.609929 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.63068 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.627914 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.311618 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.405014 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.45359 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.492801 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.527313 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.558403 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.579152 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.576386 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.444538 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.537483 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.586128 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.625333 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.659846 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.690933 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.711684 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.708919 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.545545 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.638972 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.687616 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.726821 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.761335 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.792421 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.813174 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.809924 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.613697 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.707742 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.756386 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.795591 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.830105 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.861191 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.881944 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.878075 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,16);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,3), (1,1):               ','rotation',0)
+title 'level 6'
+axis([0,1,0,1]);
+Y=ceil(1.31407e-05 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.125369 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.245921 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.344463 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.410413 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.134951 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.175611 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.197329 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.139317 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.28523 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.384595 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.450762 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.175538 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.21502 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.230653 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.179109 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.312491 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.412404 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.478876 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.124852 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.19727 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.230651 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.24576 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.196038 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.327156 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.427124 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.493599 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.139229 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.179128 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.196129 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.153703 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.275755 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.375646 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.442066 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.245796 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.285258 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.312587 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.327152 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.275758 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.408255 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.508151 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.574611 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.344598 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.384619 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.412407 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.427124 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.375646 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.508151 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.607709 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.673868 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.410469 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.450769 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.478869 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.493599 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.442066 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.574611 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.673868 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.739584 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,2);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,4), (0,1):               ','rotation',0)
+title 'level 7'
+axis([0,1,0,1]);
+Y=ceil(0.173517 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.199496 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.215559 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.230269 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.243086 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.253957 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.261693 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.263013 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.246359 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.170859 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.311936 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.372855 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.42042 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.462494 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.503626 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.533218 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.27563 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.297798 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.312153 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.326367 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.33943 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.350543 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.35829 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.359398 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.342585 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.265975 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.40806 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.468515 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.515971 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.558025 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.599324 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.629094 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.323433 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.346103 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.36065 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.374931 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38796 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.399046 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.406789 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.407922 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.391152 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.31442 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.456604 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.517138 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.564611 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.606669 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.647965 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.677737 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.362947 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38537 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.399847 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.414102 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.427143 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.438236 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.445982 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.447108 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.430304 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.353849 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.495846 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.55635 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.603818 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.645874 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.687171 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.716943 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.397264 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.419826 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.434346 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.448607 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.461648 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.47274 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.480485 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.481614 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.464836 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388142 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.530341 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.590859 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.63833 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.680387 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.721684 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.751457 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.428334 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.450934 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.465457 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.479721 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.492746 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.503832 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.511576 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.512704 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.49592 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.419264 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.561424 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.621945 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.669415 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.711472 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.752768 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.782539 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.449261 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.471712 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.4862 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.500459 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.513506 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.524601 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.532346 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.533474 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.516681 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.440139 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.582191 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.642704 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.690174 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.732231 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.773531 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.803306 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.443394 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.466176 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.480855 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.495117 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.508148 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.519236 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.526981 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.528109 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.511326 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.434668 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.576833 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.63735 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.68482 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.726877 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.768013 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.797588 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,7);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,4), (1,1):               ','rotation',0)
+title 'level 7'
+axis([0,1,0,1]);
+Y=ceil(0 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.00495305 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.147231 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.203786 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.246956 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.289444 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.319858 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.125874 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.201687 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.251351 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.293266 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.334009 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.362919 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.165563 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.23227 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.281422 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.323162 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.363558 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.392384 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.172771 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.245943 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.295642 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.337701 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.378234 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.407099 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.187891 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.242745 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.285797 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.32656 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.355394 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.147156 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.175995 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.190816 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.199986 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.209279 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.217038 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.218215 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.206901 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.268764 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.32934 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.376578 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.418655 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.459305 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.488209 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.22163 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.253447 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.270429 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.285057 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.298372 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.309567 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.317342 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.318488 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.301755 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.218472 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.366635 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.42734 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.474808 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.516868 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.557143 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.585695 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.293695 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.318536 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.334272 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.348607 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.362134 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.373428 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.381196 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.382336 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.365607 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.287873 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.430985 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.491536 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.539008 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.581068 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.621124 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.64939 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,12);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(4,3), (1,0):               ','rotation',0)
+title 'level 7'
+axis([0,1,0,1]);
+Y=ceil(0.173381 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.275634 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.323443 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.362935 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.397278 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.42832 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.449271 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.443387 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.199561 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.29779 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.346106 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.385368 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.419829 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.45093 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.471715 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.466174 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.215603 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.31215 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.360661 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.399844 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.434347 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.465455 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.486202 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.480853 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.229348 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.326463 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.37491 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.414111 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.44861 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.479708 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.50047 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.495111 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.24314 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.339426 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38796 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.427145 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.461649 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.492741 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.513511 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.508146 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.254191 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.35052 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.39905 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.438234 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.472741 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.503832 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.524601 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.519237 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.261694 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.358288 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.40679 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.445981 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.480485 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.511576 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.532346 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.526981 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.26302 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.359395 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.407925 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.447107 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.481613 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.512705 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.533474 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.528109 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.246281 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.342593 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.391153 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.430304 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.464836 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.49592 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.516681 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.511326 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.170861 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.265974 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.31442 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.353849 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388142 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.419264 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.440139 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.434668 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.311935 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.40806 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.456604 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.495846 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.530341 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.561424 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.582191 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.576833 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.372856 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.468514 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.517138 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.55635 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.590859 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.621945 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.642704 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.63735 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.420417 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.515972 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.56461 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.603818 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.63833 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.669415 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.690174 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.68482 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.462478 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.558031 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.606667 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.645875 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.680387 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.711472 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.732231 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.726877 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.503638 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.599323 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.647965 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.687171 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.721684 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.752768 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.773531 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.768013 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.533222 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.629094 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.677737 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.716943 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.751457 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.782539 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.803306 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.797588 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,17);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(4,3), (1,1):               ','rotation',0)
+title 'level 7'
+axis([0,1,0,1]);
+Y=ceil(0.217796 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.292771 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.146838 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.252563 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.318288 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.174925 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.270539 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.334317 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.186107 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.285249 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.349107 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.197942 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.29846 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.362338 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.209527 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.309627 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.373452 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.216998 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.317351 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.381199 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.217928 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.318482 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.382336 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.2069 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.301754 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.365607 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.218472 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.287873 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.125964 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.165545 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.17278 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.268766 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.366635 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.430985 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.147287 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.201685 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.232278 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.245946 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.187901 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.329339 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.42734 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.491536 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.204611 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.251237 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.281255 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.295614 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.242738 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.376578 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.474808 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.539008 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.248353 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.293319 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.322664 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.337677 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.285794 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.418655 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.516868 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.581068 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.291328 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.334239 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.363448 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.37823 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.32656 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.459305 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.557143 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.621124 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.32034 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.362984 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.392377 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.407098 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.355394 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.488209 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.585695 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.64939 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,3);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,5), (0,1):               ','rotation',0)
+title 'level 8'
+axis([0,1,0,1]);
+Y=ceil(0.0745735 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.119724 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.14287 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.149912 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.155535 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.160386 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.163913 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.166914 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.16756 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.164518 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.143745 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.137195 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.195965 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.233384 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.263218 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.289189 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.3126 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.335074 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.356277 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.376868 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.396544 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415655 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.43415 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.442765 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.177228 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0;0;0.03125;0.03125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.195294 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.03125;0.03125;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.203339 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.0625;0.0625;0.09375;0.09375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.211036 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.09375;0.09375;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.218728 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.224203 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.233268 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.236631 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.241833 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.247852 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.253412 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.258272 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.262227 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.264797 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.265499 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.263257 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.256689 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.240754 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.163098 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.5625;0.5625;0.59375;0.59375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.235334 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.293405 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.330713 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.360553 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.386531 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.410257 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.432304 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.453198 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.473308 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.49287 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.511977 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.530513 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.539179 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.220083 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0;0;0.03125;0.03125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.238176 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.03125;0.03125;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.246214 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.0625;0.0625;0.09375;0.09375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.2539 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.09375;0.09375;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.261231 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.268891 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.275656 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.283184 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.289953 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.296075 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.301641 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.306503 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.310421 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.313027 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.313723 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.3114 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.303549 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.283184 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.205908 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.5625;0.5625;0.59375;0.59375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.283499 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.341864 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.379227 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.409065 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.435042 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.458643 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.480705 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.501725 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.521929 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.541509 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.560616 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.579152 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.587818 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.260058 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0;0;0.03125;0.03125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.278141 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.03125;0.03125;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.286185 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.0625;0.0625;0.09375;0.09375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.293872 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.09375;0.09375;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.301652 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.309012 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.316228 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.322959 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.329438 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.335541 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.341106 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.345967 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.349882 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.352492 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.353189 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.35088 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.343265 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.323708 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.245899 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.5625;0.5625;0.59375;0.59375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.323017 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.381099 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.418407 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.448247 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.474224 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.49786 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.519958 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.54095 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.561137 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.580715 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.599822 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.618358 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.627024 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.294848 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0;0;0.03125;0.03125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.312932 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.03125;0.03125;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.320974 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.0625;0.0625;0.09375;0.09375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.328662 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.09375;0.09375;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.335898 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.343175 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.350289 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.357186 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.363727 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.369834 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.3754 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38026 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.384178 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.386786 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.387482 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38517 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.377506 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.357825 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.280684 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.5625;0.5625;0.59375;0.59375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.357249 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415564 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.452914 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.482753 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.50873 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.532382 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.554471 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.575463 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.595651 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.615228 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.634335 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.652872 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.661537 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.325188 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0;0;0.03125;0.03125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.343274 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.03125;0.03125;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.351315 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.0625;0.0625;0.09375;0.09375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.359003 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.09375;0.09375;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.366832 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.374278 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.381425 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388283 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.394809 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.400914 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.40648 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.411341 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415258 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.417866 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.418562 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.416252 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.408597 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.3889 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.311025 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.5625;0.5625;0.59375;0.59375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388395 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.44664 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.483986 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.513825 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.539802 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.563437 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.585525 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.606518 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.626706 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.646284 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.66539 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.683927 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.692593 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.346829 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0;0;0.03125;0.03125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.364913 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.03125;0.03125;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.372956 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.0625;0.0625;0.09375;0.09375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.380643 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.09375;0.09375;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38798 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.395274 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.402405 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.409273 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415803 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.421909 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.427475 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.432336 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.436253 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.438861 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.439557 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.437246 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.429591 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.40993 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.332664 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5625;0.5625;0.59375;0.59375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.409336 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.467524 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.504847 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.534687 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.560664 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.584303 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.606391 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.627383 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.647571 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.667149 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.686256 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.704792 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.713458 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.339847 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0;0;0.03125;0.03125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.357984 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.03125;0.03125;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.366067 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.0625;0.0625;0.09375;0.09375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.373756 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.09375;0.09375;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.381424 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388823 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.395963 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.402828 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.409357 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415463 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.421028 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.425889 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.429806 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.432414 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.43311 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.4308 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.423144 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.403454 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.325776 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5625;0.5625;0.59375;0.59375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.402927 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.461185 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.498531 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.52837 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.554346 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.577987 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.600074 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.621067 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.641254 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.660832 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.679939 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.698433 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.707048 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,8);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,5), (1,1):               ','rotation',0)
+title 'level 8'
+axis([0,1,0,1]);
+Y=ceil(0 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.14424 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.176204 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.195919 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.214126 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.222389 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.125;0.125;0],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.156896 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.200748 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.223423 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.242694 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.260982 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.269326 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.25;0.25;0.125],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.160283 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.208768 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.233892 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.253992 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.273121 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.291445 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.299846 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.375;0.375;0.25],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.134467 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.199093 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.227825 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.248943 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.268606 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.28772 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.306038 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.314444 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.5;0.5;0.375],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.140361 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.173931 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.19503 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.214641 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.233767 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.252065 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.260522 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.625;0.625;0.5],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.140887 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.189467 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.218841 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.244862 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.269786 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.290663 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.311292 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.33145 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.35103 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.370132 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388459 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.396844 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.75;0.75;0.625],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.141617 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.163891 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.171973 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.178793 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.185201 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.19135 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.196882 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.201755 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.205663 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.208294 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.20898 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.206634 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.19885 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.17514 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.183077 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.242385 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.280791 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.310577 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.336556 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.360247 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38229 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.403274 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.423458 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.44304 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.462142 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.480424 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.488761 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.875;0.875;0.75],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.174741 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0;0;0.03125;0.03125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.193237 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.03125;0.03125;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.201607 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.0625;0.0625;0.09375;0.09375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.209384 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.09375;0.09375;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.224025 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.125;0.125;0.15625;0.15625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.233501 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.15625;0.15625;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.240797 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.1875;0.1875;0.21875;0.21875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.247678 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.21875;0.21875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.254174 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.25;0.25;0.28125;0.28125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.260304 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.28125;0.28125;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.265857 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.3125;0.3125;0.34375;0.34375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.270722 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.34375;0.34375;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.274638 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.375;0.375;0.40625;0.40625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.277249 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.40625;0.40625;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.277944 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.4375;0.4375;0.46875;0.46875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.275627 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.46875;0.46875;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.267943 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5;0.5;0.53125;0.53125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.247624 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.53125;0.53125;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.161434 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.5625;0.5625;0.59375;0.59375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.248458 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.59375;0.59375;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.306272 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.625;0.625;0.65625;0.65625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.343652 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.65625;0.65625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.373494 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.6875;0.6875;0.71875;0.71875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.399466 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.71875;0.71875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.423113 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.75;0.75;0.78125;0.78125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.445193 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.78125;0.78125;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.46619 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.8125;0.8125;0.84375;0.84375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.486374 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.84375;0.84375;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.505956 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.875;0.875;0.90625;0.90625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.525058 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.90625;0.90625;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.54326 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.9375;0.9375;0.96875;0.96875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.551502 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;1;1;0.875],[0.96875;0.96875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,13);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(4,4), (1,1):               ','rotation',0)
+title 'level 8'
+axis([0,1,0,1]);
+Y=ceil(0.170431 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.0625;0.0625;0],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.160631 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.210491 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.125;0.125;0.0625],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.0400152 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.193862 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.231683 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.1875;0.1875;0.125],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.154073 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.217746 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.246787 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.25;0.25;0.1875],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.18349 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.23394 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.260089 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.3125;0.3125;0.25],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.195958 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.245374 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.271219 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.375;0.375;0.3125],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.203849 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.253171 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.278972 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.4375;0.4375;0.375],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.20581 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.254489 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.280121 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.5;0.5;0.4375],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.1235 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.201097 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.239437 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.26347 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.5625;0.5625;0.5],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.145336 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.185687 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.625;0.625;0.5625],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.125131 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.172921 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.22226 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.265025 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.303333 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.328829 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.6875;0.6875;0.625],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.172917 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.237036 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.285193 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.327338 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.364311 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.389387 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.75;0.75;0.6875],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.123372 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.222258 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.285193 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.332792 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.374893 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.411812 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.436867 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.8125;0.8125;0.75],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.164969 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.194454 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.203695 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.205777 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.201077 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.265025 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.327338 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.374893 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.416988 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.453902 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.478957 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.875;0.875;0.8125],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.143662 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.175464 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.193856 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.20873 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.230528 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.244995 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.253129 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.254483 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.239435 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.145336 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.303333 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.364311 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.411812 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.453902 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.49062 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.515379 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.9375;0.9375;0.875],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.184216 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0;0;0.0625;0.0625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.213875 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.0625;0.0625;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.23191 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.125;0.125;0.1875;0.1875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.246269 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.1875;0.1875;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.259833 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.25;0.25;0.3125;0.3125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.271179 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.3125;0.3125;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.278966 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.375;0.375;0.4375;0.4375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.28012 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.4375;0.4375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.26347 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.5;0.5;0.5625;0.5625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.185687 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.5625;0.5625;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.328829 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.625;0.625;0.6875;0.6875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.389387 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.6875;0.6875;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.436867 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.75;0.75;0.8125;0.8125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.478957 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.8125;0.8125;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.515379 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.875;0.875;0.9375;0.9375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.5397 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;1;1;0.9375],[0.9375;0.9375;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,18);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(5,3), (1,0):               ','rotation',0)
+title 'level 8'
+axis([0,1,0,1]);
+Y=ceil(0.177227 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.03125;0.03125;0],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.220083 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.03125;0.03125;0],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.260058 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.03125;0.03125;0],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.294848 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.03125;0.03125;0],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.325188 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.03125;0.03125;0],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.346829 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.03125;0.03125;0],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.339848 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.03125;0.03125;0],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.195294 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.03125;0.0625;0.0625;0.03125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.238175 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.03125;0.0625;0.0625;0.03125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.278141 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.03125;0.0625;0.0625;0.03125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.312932 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.03125;0.0625;0.0625;0.03125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.343274 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.03125;0.0625;0.0625;0.03125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.364914 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.03125;0.0625;0.0625;0.03125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.357982 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.03125;0.0625;0.0625;0.03125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.203338 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.09375;0.09375;0.0625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.246214 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.09375;0.09375;0.0625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.286185 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.09375;0.09375;0.0625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.320974 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.09375;0.09375;0.0625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.351315 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.09375;0.09375;0.0625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.372955 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.09375;0.09375;0.0625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.366068 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.09375;0.09375;0.0625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.211037 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.09375;0.125;0.125;0.09375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.2539 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.09375;0.125;0.125;0.09375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.293873 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.09375;0.125;0.125;0.09375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.328662 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.09375;0.125;0.125;0.09375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.359003 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.09375;0.125;0.125;0.09375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.380643 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.09375;0.125;0.125;0.09375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.373756 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.09375;0.125;0.125;0.09375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.218726 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.261232 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.301652 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.335898 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.366832 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38798 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.381424 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.107936 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.222474 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.269213 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.308945 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.343192 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.374273 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.395275 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388822 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.127968 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.228578 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.276533 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.316048 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.350331 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.381414 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.402408 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.395961 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.113153 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.237047 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.283107 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.322975 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.357182 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388284 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.409273 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.402828 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.246661 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.289052 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.329624 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.363683 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.394821 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415799 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.409358 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.132103 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.249239 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.295872 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.335529 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.36985 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.400942 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.421873 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415486 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.154522 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.253508 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.301624 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.34111 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.375399 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.40648 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.427475 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.421028 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.16032 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.258278 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.306501 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.345967 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38026 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.411341 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.432336 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.425889 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.164297 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.262189 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.31042 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.349884 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.384178 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415258 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.436253 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.429806 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.166914 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.264797 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.313027 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.352492 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.386786 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.417866 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.438861 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.432414 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.16756 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.265499 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.313723 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.353189 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.387482 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.418562 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.439557 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.43311 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.164517 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.263257 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.3114 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.35088 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38517 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.416252 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.437246 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.4308 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.143747 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.256689 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.303549 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.343265 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.377506 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.408597 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.429591 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.423144 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.240754 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.283184 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.323708 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.357825 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.3889 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.40993 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.403454 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.163098 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.59375;0.59375;0.5625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.205908 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.59375;0.59375;0.5625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.245899 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.59375;0.59375;0.5625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.280684 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.59375;0.59375;0.5625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.311025 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.59375;0.59375;0.5625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.332664 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.59375;0.59375;0.5625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.325776 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.59375;0.59375;0.5625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.137195 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.235334 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.283499 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.323017 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.357249 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388395 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.409336 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.402927 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.195964 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.293406 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.341864 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.381099 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415564 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.44664 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.467524 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.461185 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.233383 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.330713 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.379227 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.418407 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.452914 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.483986 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.504847 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.498531 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.263218 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.360553 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.409065 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.448247 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.482753 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.513825 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.534687 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.52837 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.289189 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.386531 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.435042 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.474224 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.50873 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.539802 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.560664 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.554346 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.312601 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.410257 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.458643 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.49786 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.532382 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.563437 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.584303 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.577987 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.335072 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.432304 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.480705 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.519958 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.554471 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.585525 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.606391 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.600074 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.356278 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.453197 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.501725 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.54095 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.575463 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.606518 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.627383 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.621067 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.376869 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.473308 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.521929 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.561137 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.595651 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.626706 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.647571 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.641254 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.396543 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.49287 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.541509 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.580715 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.615228 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.646284 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.667149 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.660832 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.415655 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.511976 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.560616 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.599822 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.634335 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.66539 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.686256 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.679939 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.43415 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.530513 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.579152 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.618358 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.652872 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.683927 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.704792 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.698433 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.442765 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.539179 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.587818 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.627024 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.661537 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.692593 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.713458 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.707048 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,23);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(5,3), (1,1):               ','rotation',0)
+title 'level 8'
+axis([0,1,0,1]);
+Y=ceil(0.174757 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0;0.03125;0.03125;0],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.1932 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.03125;0.0625;0.0625;0.03125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.201647 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.0625;0.09375;0.09375;0.0625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.209358 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.09375;0.125;0.125;0.09375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.141587 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.224022 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.125;0.15625;0.15625;0.125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.163842 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.233519 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.15625;0.1875;0.1875;0.15625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.171746 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.24077 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.1875;0.21875;0.21875;0.1875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.178793 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.247672 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.21875;0.25;0.25;0.21875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.185472 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.254205 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.25;0.28125;0.28125;0.25],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.062586 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.194319 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.260445 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.28125;0.3125;0.3125;0.28125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.19692 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.265865 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.3125;0.34375;0.34375;0.3125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.201747 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.27072 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.34375;0.375;0.375;0.34375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.205668 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.274639 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.375;0.40625;0.40625;0.375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.208293 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.277249 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.40625;0.4375;0.4375;0.40625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.20898 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.277944 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.4375;0.46875;0.46875;0.4375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.206634 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.275627 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.46875;0.5;0.5;0.46875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.19885 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.267943 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5;0.53125;0.53125;0.5],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.175141 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.247624 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.53125;0.5625;0.5625;0.53125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.161434 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.5625;0.59375;0.59375;0.5625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.183077 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.248458 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.59375;0.625;0.625;0.59375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.140888 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.242385 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.306272 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.625;0.65625;0.65625;0.625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.189466 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.280791 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.343652 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.65625;0.6875;0.6875;0.65625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.218841 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.310577 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.373494 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.6875;0.71875;0.71875;0.6875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.244862 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.336556 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.399466 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.71875;0.75;0.75;0.71875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.134467 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.269786 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.360247 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.423113 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.75;0.78125;0.78125;0.75],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.160191 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.199077 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.140352 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.290664 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.38229 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.445193 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.78125;0.8125;0.8125;0.78125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.156928 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.208801 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.227831 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.173934 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.311292 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.403274 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.46619 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.8125;0.84375;0.84375;0.8125],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.144261 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.200749 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.2339 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.248945 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.195031 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.33145 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.423458 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.486374 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.84375;0.875;0.875;0.84375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.176247 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.223431 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.253979 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.268602 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.214639 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.35103 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.44304 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.505956 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.875;0.90625;0.90625;0.875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.195896 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.242693 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.273127 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.287721 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.233767 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.370132 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.462142 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.525058 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.90625;0.9375;0.9375;0.90625],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.214135 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.26098 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.291443 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.306038 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.252065 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.388459 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.480424 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.54326 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.9375;0.96875;0.96875;0.9375],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+Y=ceil(0.222387 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0;0;0.125;0.125],X(Y,:),'EdgeColor','none')
+Y=ceil(0.269327 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.125;0.125;0.25;0.25],X(Y,:),'EdgeColor','none')
+Y=ceil(0.299847 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.25;0.25;0.375;0.375],X(Y,:),'EdgeColor','none')
+Y=ceil(0.314445 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.375;0.375;0.5;0.5],X(Y,:),'EdgeColor','none')
+Y=ceil(0.260522 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.5;0.5;0.625;0.625],X(Y,:),'EdgeColor','none')
+Y=ceil(0.396844 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.625;0.625;0.75;0.75],X(Y,:),'EdgeColor','none')
+Y=ceil(0.488761 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.75;0.75;0.875;0.875],X(Y,:),'EdgeColor','none')
+Y=ceil(0.551502 * length(colormap));
+if Y==0
+Y=Y+1;
+end;
+patch([0.96875;1;1;0.96875],[0.875;0.875;1;1],X(Y,:),'EdgeColor','none')
+subplot(7,5,4);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,6), (0,1):               ','rotation',0)
+title 'level 9'
+axis([0,1,0,1]);
+subplot(7,5,9);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,6), (1,1):               ','rotation',0)
+title 'level 9'
+axis([0,1,0,1]);
+subplot(7,5,14);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(4,5), (1,1):               ','rotation',0)
+title 'level 9'
+axis([0,1,0,1]);
+subplot(7,5,19);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(5,4), (1,1):               ','rotation',0)
+title 'level 9'
+axis([0,1,0,1]);
+subplot(7,5,24);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(6,3), (1,0):               ','rotation',0)
+title 'level 9'
+axis([0,1,0,1]);
+subplot(7,5,29);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(6,3), (1,1):               ','rotation',0)
+title 'level 9'
+axis([0,1,0,1]);
+subplot(7,5,5);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,7), (0,1):               ','rotation',0)
+title 'level 10'
+axis([0,1,0,1]);
+subplot(7,5,10);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(3,7), (1,1):               ','rotation',0)
+title 'level 10'
+axis([0,1,0,1]);
+subplot(7,5,15);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(4,6), (1,1):               ','rotation',0)
+title 'level 10'
+axis([0,1,0,1]);
+subplot(7,5,20);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(5,5), (1,1):               ','rotation',0)
+title 'level 10'
+axis([0,1,0,1]);
+subplot(7,5,25);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(6,4), (1,1):               ','rotation',0)
+title 'level 10'
+axis([0,1,0,1]);
+subplot(7,5,30);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(7,3), (1,0):               ','rotation',0)
+title 'level 10'
+axis([0,1,0,1]);
+subplot(7,5,35);
+box on
+set(gca,'Layer','top')
+set(gca,'XTick',[])
+set(gca,'YTick',[])
+ylabel('(7,3), (1,1):               ','rotation',0)
+title 'level 10'
+axis([0,1,0,1]);
+title('solution coefficients') 
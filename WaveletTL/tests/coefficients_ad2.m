@@ -0,0 +1,1611 @@
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',2,2));
+axis([-0.5 7.5 -0.5 7.5]);
+patch([-0.5,0.5,0.5,-0.5],[-0.5,-0.5,0.5,0.5],-4.23021,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[0.5,0.5,1.5,1.5],-3.5267,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[1.5,1.5,2.5,2.5],-3.13758,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[2.5,2.5,3.5,3.5],-2.82393,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[3.5,3.5,4.5,4.5],-2.54782,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[4.5,4.5,5.5,5.5],-2.29913,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[5.5,5.5,6.5,6.5],-2.13311,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-2.11503,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[-0.5,-0.5,0.5,0.5],-3.5267,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[0.5,0.5,1.5,1.5],-2.85631,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[1.5,1.5,2.5,2.5],-2.46715,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[2.5,2.5,3.5,3.5],-2.15351,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[3.5,3.5,4.5,4.5],-1.8774,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-1.62871,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-1.46269,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-1.4117,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[-0.5,-0.5,0.5,0.5],-3.13758,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[0.5,0.5,1.5,1.5],-2.46715,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[1.5,1.5,2.5,2.5],-2.078,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[2.5,2.5,3.5,3.5],-1.76435,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[3.5,3.5,4.5,4.5],-1.48824,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-1.23955,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-1.07354,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-1.02254,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[-0.5,-0.5,0.5,0.5],-2.82393,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[0.5,0.5,1.5,1.5],-2.15351,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[1.5,1.5,2.5,2.5],-1.76435,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[2.5,2.5,3.5,3.5],-1.45071,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[3.5,3.5,4.5,4.5],-1.1746,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-0.925912,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-0.759897,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-0.708901,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[-0.5,-0.5,0.5,0.5],-2.54782,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[0.5,0.5,1.5,1.5],-1.8774,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[1.5,1.5,2.5,2.5],-1.48824,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[2.5,2.5,3.5,3.5],-1.1746,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[3.5,3.5,4.5,4.5],-0.89849,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-0.649801,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-0.483786,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-0.43279,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[-0.5,-0.5,0.5,0.5],-2.29913,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-1.62871,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-1.23955,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-0.925912,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-0.649801,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-0.401111,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-0.235096,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-0.184101,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-2.13311,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-1.46269,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-1.07354,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-0.759897,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-0.483786,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-0.235096,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-0.0690814,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-0.0180856,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-2.11503,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-1.4117,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-1.02254,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-0.708901,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-0.43279,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-0.184101,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-0.0180856,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],0,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',2,2))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',2,3));
+axis([-0.5 7.5 -0.5 7.5]);
+patch([-0.5,0.5,0.5,-0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[4.5,4.5,5.5,5.5],-4.44372,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[5.5,5.5,6.5,6.5],-3.63566,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-3.09043,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[-0.5,-0.5,0.5,0.5],-4.9684,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[0.5,0.5,1.5,1.5],-4.67229,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[1.5,1.5,2.5,2.5],-4.46542,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[2.5,2.5,3.5,3.5],-4.3479,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[3.5,3.5,4.5,4.5],-4.75989,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-3.70013,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-2.88822,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-2.33806,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[-0.5,-0.5,0.5,0.5],-4.5817,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[0.5,0.5,1.5,1.5],-4.28415,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[1.5,1.5,2.5,2.5],-4.07691,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[2.5,2.5,3.5,3.5],-3.95905,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[3.5,3.5,4.5,4.5],-4.37128,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-3.31098,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-2.49907,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-1.94891,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[-0.5,-0.5,0.5,0.5],-4.26774,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[0.5,0.5,1.5,1.5],-3.97037,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[1.5,1.5,2.5,2.5],-3.76318,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[2.5,2.5,3.5,3.5],-3.64536,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[3.5,3.5,4.5,4.5],-4.05759,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-2.99734,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-2.18543,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-1.63527,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[-0.5,-0.5,0.5,0.5],-3.99164,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[0.5,0.5,1.5,1.5],-3.69428,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[1.5,1.5,2.5,2.5],-3.48709,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[2.5,2.5,3.5,3.5],-3.36928,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[3.5,3.5,4.5,4.5],-3.7815,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-2.72123,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-1.90932,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-1.35916,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[-0.5,-0.5,0.5,0.5],-3.74296,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-3.44558,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-3.23838,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-3.12057,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-3.53277,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-2.47254,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-1.66063,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-1.11047,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-3.57689,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-3.27956,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-3.07237,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-2.95456,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-3.36678,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-2.30652,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-1.49461,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-0.944448,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-3.60787,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-3.30555,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-3.0945,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-2.97669,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-3.38891,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-2.32865,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-1.5206,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-0.975401,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',2,3))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',3,2));
+axis([-0.5 7.5 -0.5 7.5]);
+patch([-0.5,0.5,0.5,-0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[0.5,0.5,1.5,1.5],-4.96835,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[1.5,1.5,2.5,2.5],-4.58171,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[2.5,2.5,3.5,3.5],-4.26774,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[3.5,3.5,4.5,4.5],-3.99163,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[4.5,4.5,5.5,5.5],-3.74297,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[5.5,5.5,6.5,6.5],-3.57689,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-3.60788,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[0.5,0.5,1.5,1.5],-4.67219,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[1.5,1.5,2.5,2.5],-4.28417,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[2.5,2.5,3.5,3.5],-3.97037,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[3.5,3.5,4.5,4.5],-3.69428,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-3.44558,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-3.27956,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-3.30555,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[0.5,0.5,1.5,1.5],-4.46535,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[1.5,1.5,2.5,2.5],-4.07693,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[2.5,2.5,3.5,3.5],-3.76317,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[3.5,3.5,4.5,4.5],-3.48709,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-3.23839,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-3.07237,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-3.0945,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[0.5,0.5,1.5,1.5],-4.34789,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[1.5,1.5,2.5,2.5],-3.95906,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[2.5,2.5,3.5,3.5],-3.64536,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[3.5,3.5,4.5,4.5],-3.36928,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-3.12057,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-2.95456,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-2.97669,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[0.5,0.5,1.5,1.5],-4.75989,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[1.5,1.5,2.5,2.5],-4.37128,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[2.5,2.5,3.5,3.5],-4.05759,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[3.5,3.5,4.5,4.5],-3.7815,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-3.53277,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-3.36678,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-3.38891,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[-0.5,-0.5,0.5,0.5],-4.4437,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-3.70014,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-3.31098,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-2.99734,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-2.72123,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-2.47254,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-2.30652,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-2.32865,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-3.63564,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-2.88822,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-2.49907,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-2.18543,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-1.90932,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-1.66063,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-1.49461,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-1.5206,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-3.09042,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-2.33806,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-1.94891,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-1.63527,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-1.35916,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-1.11047,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-0.944448,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-0.975401,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',3,2))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',3,3));
+axis([-0.5 7.5 -0.5 7.5]);
+patch([-0.5,0.5,0.5,-0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-4.7167,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-4.92324,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-4.3939,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-4.70077,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-4.16899,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-4.58301,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-4.05121,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-4.99483,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-4.46347,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-4.73396,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-3.93479,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-3.40312,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-4.92304,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-4.70075,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-4.58301,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-4.99483,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-3.93479,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-3.13833,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-2.60906,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-4.71624,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-4.39385,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-4.16905,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-4.05121,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-4.46347,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-3.40312,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-2.60906,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-2.08333,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',3,3))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',2,4));
+axis([-0.5 7.5 -0.5 15.5]);
+patch([-0.5,0.5,0.5,-0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[11.5,11.5,12.5,12.5],-4.63664,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[12.5,12.5,13.5,13.5],-4.30005,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[13.5,13.5,14.5,14.5],-3.97099,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[14.5,14.5,15.5,15.5],-3.73426,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[9.5,9.5,10.5,10.5],-4.73552,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[10.5,10.5,11.5,11.5],-4.25188,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[11.5,11.5,12.5,12.5],-3.87224,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[12.5,12.5,13.5,13.5],-3.5358,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[13.5,13.5,14.5,14.5],-3.20541,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[14.5,14.5,15.5,15.5],-2.96725,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[3.5,3.5,4.5,4.5],-4.89632,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-4.80764,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-4.74569,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-4.73662,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[7.5,7.5,8.5,8.5],-4.87078,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[9.5,9.5,10.5,10.5],-4.34716,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[10.5,10.5,11.5,11.5],-3.8629,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[11.5,11.5,12.5,12.5],-3.48311,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[12.5,12.5,13.5,13.5],-3.14665,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[13.5,13.5,14.5,14.5],-2.81628,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[14.5,14.5,15.5,15.5],-2.5781,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[0.5,0.5,1.5,1.5],-4.91704,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[1.5,1.5,2.5,2.5],-4.80123,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[2.5,2.5,3.5,3.5],-4.68719,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[3.5,3.5,4.5,4.5],-4.58286,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-4.49411,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-4.43215,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-4.42314,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[7.5,7.5,8.5,8.5],-4.55757,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[9.5,9.5,10.5,10.5],-4.03323,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[10.5,10.5,11.5,11.5],-3.5492,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[11.5,11.5,12.5,12.5],-3.16945,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[12.5,12.5,13.5,13.5],-2.83301,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[13.5,13.5,14.5,14.5],-2.50263,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[14.5,14.5,15.5,15.5],-2.26446,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[-0.5,-0.5,0.5,0.5],-4.82189,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[0.5,0.5,1.5,1.5],-4.6414,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[1.5,1.5,2.5,2.5],-4.52523,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[2.5,2.5,3.5,3.5],-4.41114,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[3.5,3.5,4.5,4.5],-4.30682,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-4.21808,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-4.15612,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-4.14709,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[7.5,7.5,8.5,8.5],-4.28131,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[8.5,8.5,9.5,9.5],-4.89487,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[9.5,9.5,10.5,10.5],-3.75727,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[10.5,10.5,11.5,11.5],-3.27313,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[11.5,11.5,12.5,12.5],-2.89336,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[12.5,12.5,13.5,13.5],-2.5569,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[13.5,13.5,14.5,14.5],-2.22652,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[14.5,14.5,15.5,15.5],-1.98835,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[-0.5,-0.5,0.5,0.5],-4.57333,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-4.39253,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-4.27634,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-4.16223,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-4.05803,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-3.96935,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-3.9074,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-3.89837,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[7.5,7.5,8.5,8.5],-4.03264,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[8.5,8.5,9.5,9.5],-4.64588,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[9.5,9.5,10.5,10.5],-3.50861,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[10.5,10.5,11.5,11.5],-3.02444,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[11.5,11.5,12.5,12.5],-2.64468,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[12.5,12.5,13.5,13.5],-2.30822,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[13.5,13.5,14.5,14.5],-1.97786,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[14.5,14.5,15.5,15.5],-1.73969,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-4.40591,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-4.22631,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-4.1104,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-3.99633,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-3.89195,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-3.80319,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-3.74123,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-3.73221,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[7.5,7.5,8.5,8.5],-3.86655,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[8.5,8.5,9.5,9.5],-4.47889,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[9.5,9.5,10.5,10.5],-3.34247,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[10.5,10.5,11.5,11.5],-2.85837,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[11.5,11.5,12.5,12.5],-2.47861,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[12.5,12.5,13.5,13.5],-2.14215,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[13.5,13.5,14.5,14.5],-1.81175,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[14.5,14.5,15.5,15.5],-1.57356,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-4.45284,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-4.27059,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-4.15316,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-4.03906,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-3.93481,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-3.84611,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-3.78415,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-3.77513,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[7.5,7.5,8.5,8.5],-3.90939,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[8.5,8.5,9.5,9.5],-4.52266,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[9.5,9.5,10.5,10.5],-3.38534,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[10.5,10.5,11.5,11.5],-2.9012,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[11.5,11.5,12.5,12.5],-2.52144,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[12.5,12.5,13.5,13.5],-2.18498,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[13.5,13.5,14.5,14.5],-1.8559,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[14.5,14.5,15.5,15.5],-1.6193,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',2,4))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',3,4));
+axis([-0.5 7.5 -0.5 15.5]);
+patch([-0.5,0.5,0.5,-0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[14.5,14.5,15.5,15.5],-4.86093,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[13.5,13.5,14.5,14.5],-4.97413,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[14.5,14.5,15.5,15.5],-4.74321,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[11.5,11.5,12.5,12.5],-4.98738,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[12.5,12.5,13.5,13.5],-4.65076,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[13.5,13.5,14.5,14.5],-4.32556,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[14.5,14.5,15.5,15.5],-4.09433,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[10.5,10.5,11.5,11.5],-4.58128,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[11.5,11.5,12.5,12.5],-4.20153,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[12.5,12.5,13.5,13.5],-3.86505,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[13.5,13.5,14.5,14.5],-3.54286,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[14.5,14.5,15.5,15.5],-3.31444,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-4.95043,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-4.94131,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[9.5,9.5,10.5,10.5],-4.55212,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[10.5,10.5,11.5,11.5],-4.06771,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[11.5,11.5,12.5,12.5],-3.68794,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[12.5,12.5,13.5,13.5],-3.35146,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[13.5,13.5,14.5,14.5],-3.031,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[14.5,14.5,15.5,15.5],-2.80488,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',3,4))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',4,2));
+axis([-0.5 15.5 -0.5 7.5]);
+patch([-0.5,0.5,0.5,-0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[3.5,3.5,4.5,4.5],-4.82178,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[4.5,4.5,5.5,5.5],-4.57344,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[5.5,5.5,6.5,6.5],-4.40583,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-4.4529,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[2.5,2.5,3.5,3.5],-4.91706,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[3.5,3.5,4.5,4.5],-4.64137,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-4.39256,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-4.22628,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-4.27061,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[2.5,2.5,3.5,3.5],-4.80125,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[3.5,3.5,4.5,4.5],-4.52522,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-4.27636,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-4.11038,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-4.15317,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[2.5,2.5,3.5,3.5],-4.68712,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[3.5,3.5,4.5,4.5],-4.41112,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-4.16234,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-3.99624,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-4.03912,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[1.5,1.5,2.5,2.5],-4.89632,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[2.5,2.5,3.5,3.5],-4.58284,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[3.5,3.5,4.5,4.5],-4.3068,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-4.05807,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-3.89192,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-3.93483,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-4.8076,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-4.49413,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-4.21808,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-3.96935,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-3.8032,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-3.84611,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-4.74568,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-4.43215,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-4.15612,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-3.90739,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-3.74124,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-3.78415,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-4.7366,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-4.42315,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-4.1471,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-3.89836,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-3.73221,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-3.77513,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[1.5,1.5,2.5,2.5],-4.87078,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[2.5,2.5,3.5,3.5],-4.55757,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[3.5,3.5,4.5,4.5],-4.28131,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[4.5,4.5,5.5,5.5],-4.03264,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[5.5,5.5,6.5,6.5],-3.86655,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[6.5,6.5,7.5,7.5],-3.90939,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[3.5,3.5,4.5,4.5],-4.89487,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[4.5,4.5,5.5,5.5],-4.64588,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[5.5,5.5,6.5,6.5],-4.47889,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[6.5,6.5,7.5,7.5],-4.52266,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[0.5,0.5,1.5,1.5],-4.73552,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[1.5,1.5,2.5,2.5],-4.34716,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[2.5,2.5,3.5,3.5],-4.03323,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[3.5,3.5,4.5,4.5],-3.75727,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[4.5,4.5,5.5,5.5],-3.50861,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[5.5,5.5,6.5,6.5],-3.34247,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[6.5,6.5,7.5,7.5],-3.38534,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[0.5,0.5,1.5,1.5],-4.25188,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[1.5,1.5,2.5,2.5],-3.8629,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[2.5,2.5,3.5,3.5],-3.5492,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[3.5,3.5,4.5,4.5],-3.27313,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[4.5,4.5,5.5,5.5],-3.02444,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[5.5,5.5,6.5,6.5],-2.85837,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[6.5,6.5,7.5,7.5],-2.9012,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[-0.5,-0.5,0.5,0.5],-4.63666,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[0.5,0.5,1.5,1.5],-3.87223,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[1.5,1.5,2.5,2.5],-3.48312,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[2.5,2.5,3.5,3.5],-3.16945,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[3.5,3.5,4.5,4.5],-2.89336,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[4.5,4.5,5.5,5.5],-2.64468,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[5.5,5.5,6.5,6.5],-2.47861,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[6.5,6.5,7.5,7.5],-2.52144,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[-0.5,-0.5,0.5,0.5],-4.30017,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[0.5,0.5,1.5,1.5],-3.53575,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[1.5,1.5,2.5,2.5],-3.14667,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[2.5,2.5,3.5,3.5],-2.833,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[3.5,3.5,4.5,4.5],-2.5569,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[4.5,4.5,5.5,5.5],-2.30822,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[5.5,5.5,6.5,6.5],-2.14215,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[6.5,6.5,7.5,7.5],-2.18498,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[-0.5,-0.5,0.5,0.5],-3.9709,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[0.5,0.5,1.5,1.5],-3.20542,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[1.5,1.5,2.5,2.5],-2.81628,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[2.5,2.5,3.5,3.5],-2.50263,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[3.5,3.5,4.5,4.5],-2.22652,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[4.5,4.5,5.5,5.5],-1.97786,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[5.5,5.5,6.5,6.5],-1.81175,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[6.5,6.5,7.5,7.5],-1.8559,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[-0.5,-0.5,0.5,0.5],-3.73422,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[0.5,0.5,1.5,1.5],-2.96725,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[1.5,1.5,2.5,2.5],-2.5781,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[2.5,2.5,3.5,3.5],-2.26446,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[3.5,3.5,4.5,4.5],-1.98835,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[4.5,4.5,5.5,5.5],-1.73969,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[5.5,5.5,6.5,6.5],-1.57356,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[6.5,6.5,7.5,7.5],-1.6193,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',4,2))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',4,3));
+axis([-0.5 15.5 -0.5 7.5]);
+patch([-0.5,0.5,0.5,-0.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-4.95041,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-4.94131,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[6.5,6.5,7.5,7.5],-4.55212,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[5.5,5.5,6.5,6.5],-4.58128,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[6.5,6.5,7.5,7.5],-4.06771,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[4.5,4.5,5.5,5.5],-4.98738,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[5.5,5.5,6.5,6.5],-4.20153,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[6.5,6.5,7.5,7.5],-3.68794,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[4.5,4.5,5.5,5.5],-4.65076,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[5.5,5.5,6.5,6.5],-3.86505,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[6.5,6.5,7.5,7.5],-3.35146,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[2.5,2.5,3.5,3.5],-4.97416,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[4.5,4.5,5.5,5.5],-4.32556,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[5.5,5.5,6.5,6.5],-3.54286,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[6.5,6.5,7.5,7.5],-3.031,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[1.5,1.5,2.5,2.5],-4.86098,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[2.5,2.5,3.5,3.5],-4.74321,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[4.5,4.5,5.5,5.5],-4.09433,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[5.5,5.5,6.5,6.5],-3.31444,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[6.5,6.5,7.5,7.5],-2.80488,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',4,3))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',2,5));
+axis([-0.5 7.5 -0.5 31.5]);
+patch([-0.5,0.5,0.5,-0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[15.5,15.5,16.5,16.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[18.5,18.5,19.5,19.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[19.5,19.5,20.5,20.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[20.5,20.5,21.5,21.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[21.5,21.5,22.5,22.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[22.5,22.5,23.5,23.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[23.5,23.5,24.5,24.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[24.5,24.5,25.5,25.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[25.5,25.5,26.5,26.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[26.5,26.5,27.5,27.5],-4.98506,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[27.5,27.5,28.5,28.5],-4.82765,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[28.5,28.5,29.5,29.5],-4.67476,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[29.5,29.5,30.5,30.5],-4.5268,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[30.5,30.5,31.5,31.5],-4.45788,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[15.5,15.5,16.5,16.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[16.5,16.5,17.5,17.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[17.5,17.5,18.5,18.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[18.5,18.5,19.5,19.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[19.5,19.5,20.5,20.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[20.5,20.5,21.5,21.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[21.5,21.5,22.5,22.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[22.5,22.5,23.5,23.5],-4.90775,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[23.5,23.5,24.5,24.5],-4.71794,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[24.5,24.5,25.5,25.5],-4.54157,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[25.5,25.5,26.5,26.5],-4.37442,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[26.5,26.5,27.5,27.5],-4.21353,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[27.5,27.5,28.5,28.5],-4.05704,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[28.5,28.5,29.5,29.5],-3.90419,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[29.5,29.5,30.5,30.5],-3.7559,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[30.5,30.5,31.5,31.5],-3.68657,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[15.5,15.5,16.5,16.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[16.5,16.5,17.5,17.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[17.5,17.5,18.5,18.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[18.5,18.5,19.5,19.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[19.5,19.5,20.5,20.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[20.5,20.5,21.5,21.5],-4.96618,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[21.5,21.5,22.5,22.5],-4.72748,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[22.5,22.5,23.5,23.5],-4.51967,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[23.5,23.5,24.5,24.5],-4.33086,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[24.5,24.5,25.5,25.5],-4.15436,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[25.5,25.5,26.5,26.5],-3.9862,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[26.5,26.5,27.5,27.5],-3.82457,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[27.5,27.5,28.5,28.5],-3.66793,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[28.5,28.5,29.5,29.5],-3.51507,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[29.5,29.5,30.5,30.5],-3.36678,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[30.5,30.5,31.5,31.5],-3.29746,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[15.5,15.5,16.5,16.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[16.5,16.5,17.5,17.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[17.5,17.5,18.5,18.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[18.5,18.5,19.5,19.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[19.5,19.5,20.5,20.5],-4.95121,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[20.5,20.5,21.5,21.5],-4.65274,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[21.5,21.5,22.5,22.5],-4.41402,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[22.5,22.5,23.5,23.5],-4.20621,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[23.5,23.5,24.5,24.5],-4.01712,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[24.5,24.5,25.5,25.5],-3.84034,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[25.5,25.5,26.5,26.5],-3.6724,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[26.5,26.5,27.5,27.5],-3.5109,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[27.5,27.5,28.5,28.5],-3.35428,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[28.5,28.5,29.5,29.5],-3.20143,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[29.5,29.5,30.5,30.5],-3.05314,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[30.5,30.5,31.5,31.5],-2.98381,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[9.5,9.5,10.5,10.5],-4.9968,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[10.5,10.5,11.5,11.5],-4.95792,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[11.5,11.5,12.5,12.5],-4.92657,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[12.5,12.5,13.5,13.5],-4.90572,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[13.5,13.5,14.5,14.5],-4.90014,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[14.5,14.5,15.5,15.5],-4.91864,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[15.5,15.5,16.5,16.5],-4.97995,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[16.5,16.5,17.5,17.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[17.5,17.5,18.5,18.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[18.5,18.5,19.5,19.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[19.5,19.5,20.5,20.5],-4.67548,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[20.5,20.5,21.5,21.5],-4.37669,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[21.5,21.5,22.5,22.5],-4.13798,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[22.5,22.5,23.5,23.5],-3.93016,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[23.5,23.5,24.5,24.5],-3.74094,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[24.5,24.5,25.5,25.5],-3.56423,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[25.5,25.5,26.5,26.5],-3.3963,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[26.5,26.5,27.5,27.5],-3.2348,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[27.5,27.5,28.5,28.5],-3.07817,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[28.5,28.5,29.5,29.5],-2.92532,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[29.5,29.5,30.5,30.5],-2.77703,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[30.5,30.5,31.5,31.5],-2.7077,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-4.9486,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-4.89374,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[7.5,7.5,8.5,8.5],-4.84153,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[8.5,8.5,9.5,9.5],-4.79268,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[9.5,9.5,10.5,10.5],-4.74816,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[10.5,10.5,11.5,11.5],-4.70927,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[11.5,11.5,12.5,12.5],-4.67794,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[12.5,12.5,13.5,13.5],-4.65707,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[13.5,13.5,14.5,14.5],-4.6515,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[14.5,14.5,15.5,15.5],-4.66999,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[15.5,15.5,16.5,16.5],-4.73122,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[16.5,16.5,17.5,17.5],-4.8888,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[17.5,17.5,18.5,18.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[18.5,18.5,19.5,19.5],-4.89284,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[19.5,19.5,20.5,20.5],-4.42688,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[20.5,20.5,21.5,21.5],-4.12811,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[21.5,21.5,22.5,22.5],-3.8894,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[22.5,22.5,23.5,23.5],-3.68159,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[23.5,23.5,24.5,24.5],-3.4925,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[24.5,24.5,25.5,25.5],-3.3158,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[25.5,25.5,26.5,26.5],-3.14786,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[26.5,26.5,27.5,27.5],-2.98635,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[27.5,27.5,28.5,28.5],-2.82973,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[28.5,28.5,29.5,29.5],-2.67688,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[29.5,29.5,30.5,30.5],-2.52858,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[30.5,30.5,31.5,31.5],-2.45926,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-4.95486,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-4.89616,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-4.83781,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-4.78076,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-4.72582,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[7.5,7.5,8.5,8.5],-4.67358,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[8.5,8.5,9.5,9.5],-4.62473,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[9.5,9.5,10.5,10.5],-4.5802,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[10.5,10.5,11.5,11.5],-4.54131,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[11.5,11.5,12.5,12.5],-4.50998,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[12.5,12.5,13.5,13.5],-4.48911,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[13.5,13.5,14.5,14.5],-4.48354,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[14.5,14.5,15.5,15.5],-4.50203,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[15.5,15.5,16.5,16.5],-4.56327,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[16.5,16.5,17.5,17.5],-4.72056,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[17.5,17.5,18.5,18.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[18.5,18.5,19.5,19.5],-4.72531,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[19.5,19.5,20.5,20.5],-4.25981,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[20.5,20.5,21.5,21.5],-3.96122,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[21.5,21.5,22.5,22.5],-3.72251,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[22.5,22.5,23.5,23.5],-3.51469,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[23.5,23.5,24.5,24.5],-3.32557,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[24.5,24.5,25.5,25.5],-3.14887,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[25.5,25.5,26.5,26.5],-2.98093,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[26.5,26.5,27.5,27.5],-2.81943,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[27.5,27.5,28.5,28.5],-2.66281,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[28.5,28.5,29.5,29.5],-2.50995,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[29.5,29.5,30.5,30.5],-2.36166,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[30.5,30.5,31.5,31.5],-2.29233,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-4.94861,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-4.88942,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-4.8323,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-4.77738,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[7.5,7.5,8.5,8.5],-4.72515,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[8.5,8.5,9.5,9.5],-4.6763,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[9.5,9.5,10.5,10.5],-4.63177,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[10.5,10.5,11.5,11.5],-4.59289,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[11.5,11.5,12.5,12.5],-4.56155,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[12.5,12.5,13.5,13.5],-4.54069,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[13.5,13.5,14.5,14.5],-4.53512,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[14.5,14.5,15.5,15.5],-4.5536,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[15.5,15.5,16.5,16.5],-4.61485,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[16.5,16.5,17.5,17.5],-4.77237,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[17.5,17.5,18.5,18.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[18.5,18.5,19.5,19.5],-4.77659,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[19.5,19.5,20.5,20.5],-4.31052,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[20.5,20.5,21.5,21.5],-4.01175,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[21.5,21.5,22.5,22.5],-3.77304,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[22.5,22.5,23.5,23.5],-3.56523,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[23.5,23.5,24.5,24.5],-3.37611,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[24.5,24.5,25.5,25.5],-3.19941,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[25.5,25.5,26.5,26.5],-3.03147,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[26.5,26.5,27.5,27.5],-2.86997,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[27.5,27.5,28.5,28.5],-2.71334,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[28.5,28.5,29.5,29.5],-2.56049,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[29.5,29.5,30.5,30.5],-2.41253,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[30.5,30.5,31.5,31.5],-2.34362,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',2,5))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',3,5));
+axis([-0.5 7.5 -0.5 31.5]);
+patch([-0.5,0.5,0.5,-0.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[26.5,26.5,27.5,27.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[27.5,27.5,28.5,28.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[28.5,28.5,29.5,29.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[29.5,29.5,30.5,30.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[30.5,30.5,31.5,31.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[25.5,25.5,26.5,26.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[26.5,26.5,27.5,27.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[27.5,27.5,28.5,28.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[28.5,28.5,29.5,29.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[29.5,29.5,30.5,30.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[30.5,30.5,31.5,31.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[24.5,24.5,25.5,25.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[25.5,25.5,26.5,26.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[26.5,26.5,27.5,27.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[27.5,27.5,28.5,28.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[28.5,28.5,29.5,29.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[29.5,29.5,30.5,30.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[30.5,30.5,31.5,31.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[23.5,23.5,24.5,24.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[24.5,24.5,25.5,25.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[25.5,25.5,26.5,26.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[26.5,26.5,27.5,27.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[27.5,27.5,28.5,28.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[28.5,28.5,29.5,29.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[29.5,29.5,30.5,30.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[30.5,30.5,31.5,31.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[24.5,24.5,25.5,25.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[25.5,25.5,26.5,26.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[26.5,26.5,27.5,27.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[27.5,27.5,28.5,28.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[28.5,28.5,29.5,29.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[29.5,29.5,30.5,30.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[30.5,30.5,31.5,31.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[19.5,19.5,20.5,20.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[20.5,20.5,21.5,21.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[21.5,21.5,22.5,22.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[22.5,22.5,23.5,23.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[23.5,23.5,24.5,24.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[24.5,24.5,25.5,25.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[25.5,25.5,26.5,26.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[26.5,26.5,27.5,27.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[27.5,27.5,28.5,28.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[28.5,28.5,29.5,29.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[29.5,29.5,30.5,30.5],-4.89232,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[30.5,30.5,31.5,31.5],-4.82525,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[15.5,15.5,16.5,16.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[16.5,16.5,17.5,17.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[18.5,18.5,19.5,19.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[19.5,19.5,20.5,20.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[20.5,20.5,21.5,21.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[21.5,21.5,22.5,22.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[22.5,22.5,23.5,23.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[23.5,23.5,24.5,24.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[24.5,24.5,25.5,25.5],-4.94168,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[25.5,25.5,26.5,26.5],-4.7738,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[26.5,26.5,27.5,27.5],-4.61234,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[27.5,27.5,28.5,28.5],-4.45568,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[28.5,28.5,29.5,29.5],-4.30287,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[29.5,29.5,30.5,30.5],-4.15661,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[30.5,30.5,31.5,31.5],-4.08991,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[15.5,15.5,16.5,16.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[16.5,16.5,17.5,17.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[17.5,17.5,18.5,18.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[18.5,18.5,19.5,19.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[19.5,19.5,20.5,20.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[20.5,20.5,21.5,21.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[21.5,21.5,22.5,22.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[22.5,22.5,23.5,23.5],-4.80427,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[23.5,23.5,24.5,24.5],-4.61509,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[24.5,24.5,25.5,25.5],-4.43845,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[25.5,25.5,26.5,26.5],-4.27048,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[26.5,26.5,27.5,27.5],-4.109,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[27.5,27.5,28.5,28.5],-3.95235,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[28.5,28.5,29.5,29.5],-3.79954,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[29.5,29.5,30.5,30.5],-3.65392,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[30.5,30.5,31.5,31.5],-3.58799,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',3,5))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',4,4));
+axis([-0.5 15.5 -0.5 15.5]);
+patch([-0.5,0.5,0.5,-0.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[14.5,14.5,15.5,15.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[13.5,13.5,14.5,14.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[14.5,14.5,15.5,15.5],-4.88491,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[12.5,12.5,13.5,13.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[13.5,13.5,14.5,14.5],-4.70551,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[14.5,14.5,15.5,15.5],-4.50506,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[11.5,11.5,12.5,12.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[12.5,12.5,13.5,13.5],-4.6641,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[13.5,13.5,14.5,14.5],-4.36878,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[14.5,14.5,15.5,15.5],-4.16834,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[10.5,10.5,11.5,11.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[11.5,11.5,12.5,12.5],-4.70551,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[12.5,12.5,13.5,13.5],-4.36878,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[13.5,13.5,14.5,14.5],-4.07504,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[14.5,14.5,15.5,15.5],-3.87697,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[7.5,7.5,8.5,8.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[8.5,8.5,9.5,9.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[9.5,9.5,10.5,10.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[10.5,10.5,11.5,11.5],-4.88491,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[11.5,11.5,12.5,12.5],-4.50506,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[12.5,12.5,13.5,13.5],-4.16834,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[13.5,13.5,14.5,14.5],-3.87697,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[14.5,14.5,15.5,15.5],-3.6824,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',4,4))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',5,2));
+axis([-0.5 31.5 -0.5 7.5]);
+patch([-0.5,0.5,0.5,-0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[5.5,5.5,6.5,6.5],-4.95485,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-4.89616,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-4.94861,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-4.8378,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-4.88942,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[4.5,4.5,5.5,5.5],-4.94869,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-4.78073,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-4.83231,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[4.5,4.5,5.5,5.5],-4.89373,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-4.72582,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-4.77738,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[4.5,4.5,5.5,5.5],-4.84143,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[5.5,5.5,6.5,6.5],-4.67361,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[6.5,6.5,7.5,7.5],-4.72513,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[4.5,4.5,5.5,5.5],-4.79246,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[5.5,5.5,6.5,6.5],-4.62501,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[6.5,6.5,7.5,7.5],-4.67611,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[3.5,3.5,4.5,4.5],-4.99681,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[4.5,4.5,5.5,5.5],-4.74816,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[5.5,5.5,6.5,6.5],-4.5802,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[6.5,6.5,7.5,7.5],-4.63177,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[3.5,3.5,4.5,4.5],-4.95792,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[4.5,4.5,5.5,5.5],-4.70927,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[5.5,5.5,6.5,6.5],-4.54131,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[6.5,6.5,7.5,7.5],-4.59289,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[3.5,3.5,4.5,4.5],-4.92658,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[4.5,4.5,5.5,5.5],-4.67793,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[5.5,5.5,6.5,6.5],-4.50998,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[6.5,6.5,7.5,7.5],-4.56155,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[3.5,3.5,4.5,4.5],-4.90572,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[4.5,4.5,5.5,5.5],-4.65707,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[5.5,5.5,6.5,6.5],-4.48911,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[6.5,6.5,7.5,7.5],-4.54069,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[3.5,3.5,4.5,4.5],-4.90014,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[4.5,4.5,5.5,5.5],-4.6515,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[5.5,5.5,6.5,6.5],-4.48354,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[6.5,6.5,7.5,7.5],-4.53512,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[3.5,3.5,4.5,4.5],-4.91864,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[4.5,4.5,5.5,5.5],-4.66999,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[5.5,5.5,6.5,6.5],-4.50203,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[6.5,6.5,7.5,7.5],-4.5536,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[3.5,3.5,4.5,4.5],-4.97995,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[4.5,4.5,5.5,5.5],-4.73122,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[5.5,5.5,6.5,6.5],-4.56327,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[6.5,6.5,7.5,7.5],-4.61485,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[4.5,4.5,5.5,5.5],-4.8888,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[5.5,5.5,6.5,6.5],-4.72056,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[6.5,6.5,7.5,7.5],-4.77237,'edgecolor','none');
+patch([17.5,18.5,18.5,17.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([17.5,18.5,18.5,17.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([17.5,18.5,18.5,17.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([17.5,18.5,18.5,17.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([17.5,18.5,18.5,17.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([17.5,18.5,18.5,17.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([17.5,18.5,18.5,17.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[4.5,4.5,5.5,5.5],-4.89284,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[5.5,5.5,6.5,6.5],-4.72531,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[6.5,6.5,7.5,7.5],-4.77659,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[2.5,2.5,3.5,3.5],-4.95121,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[3.5,3.5,4.5,4.5],-4.67548,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[4.5,4.5,5.5,5.5],-4.42688,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[5.5,5.5,6.5,6.5],-4.25981,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[6.5,6.5,7.5,7.5],-4.31052,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[1.5,1.5,2.5,2.5],-4.96619,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[2.5,2.5,3.5,3.5],-4.65274,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[3.5,3.5,4.5,4.5],-4.37669,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[4.5,4.5,5.5,5.5],-4.12811,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[5.5,5.5,6.5,6.5],-3.96122,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[6.5,6.5,7.5,7.5],-4.01175,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[1.5,1.5,2.5,2.5],-4.72748,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[2.5,2.5,3.5,3.5],-4.41402,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[3.5,3.5,4.5,4.5],-4.13798,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[4.5,4.5,5.5,5.5],-3.8894,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[5.5,5.5,6.5,6.5],-3.72251,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[6.5,6.5,7.5,7.5],-3.77304,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[0.5,0.5,1.5,1.5],-4.90775,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[1.5,1.5,2.5,2.5],-4.51967,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[2.5,2.5,3.5,3.5],-4.20621,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[3.5,3.5,4.5,4.5],-3.93016,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[4.5,4.5,5.5,5.5],-3.68159,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[5.5,5.5,6.5,6.5],-3.51469,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[6.5,6.5,7.5,7.5],-3.56523,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[0.5,0.5,1.5,1.5],-4.71794,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[1.5,1.5,2.5,2.5],-4.33086,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[2.5,2.5,3.5,3.5],-4.01712,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[3.5,3.5,4.5,4.5],-3.74094,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[4.5,4.5,5.5,5.5],-3.4925,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[5.5,5.5,6.5,6.5],-3.32557,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[6.5,6.5,7.5,7.5],-3.37611,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[0.5,0.5,1.5,1.5],-4.54157,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[1.5,1.5,2.5,2.5],-4.15436,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[2.5,2.5,3.5,3.5],-3.84034,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[3.5,3.5,4.5,4.5],-3.56423,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[4.5,4.5,5.5,5.5],-3.3158,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[5.5,5.5,6.5,6.5],-3.14887,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[6.5,6.5,7.5,7.5],-3.19941,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[0.5,0.5,1.5,1.5],-4.37442,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[1.5,1.5,2.5,2.5],-3.9862,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[2.5,2.5,3.5,3.5],-3.6724,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[3.5,3.5,4.5,4.5],-3.3963,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[4.5,4.5,5.5,5.5],-3.14786,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[5.5,5.5,6.5,6.5],-2.98093,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[6.5,6.5,7.5,7.5],-3.03147,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[-0.5,-0.5,0.5,0.5],-4.98505,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[0.5,0.5,1.5,1.5],-4.21354,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[1.5,1.5,2.5,2.5],-3.82457,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[2.5,2.5,3.5,3.5],-3.5109,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[3.5,3.5,4.5,4.5],-3.2348,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[4.5,4.5,5.5,5.5],-2.98635,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[5.5,5.5,6.5,6.5],-2.81943,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[6.5,6.5,7.5,7.5],-2.86997,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[-0.5,-0.5,0.5,0.5],-4.82765,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[0.5,0.5,1.5,1.5],-4.05704,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[1.5,1.5,2.5,2.5],-3.66793,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[2.5,2.5,3.5,3.5],-3.35428,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[3.5,3.5,4.5,4.5],-3.07817,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[4.5,4.5,5.5,5.5],-2.82973,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[5.5,5.5,6.5,6.5],-2.66281,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[6.5,6.5,7.5,7.5],-2.71334,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[-0.5,-0.5,0.5,0.5],-4.67476,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[0.5,0.5,1.5,1.5],-3.90419,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[1.5,1.5,2.5,2.5],-3.51507,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[2.5,2.5,3.5,3.5],-3.20143,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[3.5,3.5,4.5,4.5],-2.92532,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[4.5,4.5,5.5,5.5],-2.67688,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[5.5,5.5,6.5,6.5],-2.50995,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[6.5,6.5,7.5,7.5],-2.56049,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[-0.5,-0.5,0.5,0.5],-4.5268,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[0.5,0.5,1.5,1.5],-3.7559,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[1.5,1.5,2.5,2.5],-3.36678,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[2.5,2.5,3.5,3.5],-3.05314,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[3.5,3.5,4.5,4.5],-2.77703,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[4.5,4.5,5.5,5.5],-2.52858,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[5.5,5.5,6.5,6.5],-2.36166,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[6.5,6.5,7.5,7.5],-2.41253,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[-0.5,-0.5,0.5,0.5],-4.45788,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[0.5,0.5,1.5,1.5],-3.68657,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[1.5,1.5,2.5,2.5],-3.29746,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[2.5,2.5,3.5,3.5],-2.98381,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[3.5,3.5,4.5,4.5],-2.7077,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[4.5,4.5,5.5,5.5],-2.45926,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[5.5,5.5,6.5,6.5],-2.29233,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[6.5,6.5,7.5,7.5],-2.34362,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',5,2))
+clf;
+box on;
+colormap( (flipud(gray)));
+set(gca,'CLim',[-5 0])
+title(sprintf('wavelet coefficients on level (%i,%i)',5,3));
+axis([-0.5 31.5 -0.5 7.5]);
+patch([-0.5,0.5,0.5,-0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([0.5,1.5,1.5,0.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([1.5,2.5,2.5,1.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([2.5,3.5,3.5,2.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([3.5,4.5,4.5,3.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([4.5,5.5,5.5,4.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([5.5,6.5,6.5,5.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([6.5,7.5,7.5,6.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([7.5,8.5,8.5,7.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([8.5,9.5,9.5,8.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([9.5,10.5,10.5,9.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([10.5,11.5,11.5,10.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([11.5,12.5,12.5,11.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([12.5,13.5,13.5,12.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([13.5,14.5,14.5,13.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([14.5,15.5,15.5,14.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([15.5,16.5,16.5,15.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([16.5,17.5,17.5,16.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([17.5,18.5,18.5,17.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([18.5,19.5,19.5,18.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([19.5,20.5,20.5,19.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([20.5,21.5,21.5,20.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([21.5,22.5,22.5,21.5],[6.5,6.5,7.5,7.5],-5,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([22.5,23.5,23.5,22.5],[6.5,6.5,7.5,7.5],-4.80427,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[5.5,5.5,6.5,6.5],-5,'edgecolor','none');
+patch([23.5,24.5,24.5,23.5],[6.5,6.5,7.5,7.5],-4.61509,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[5.5,5.5,6.5,6.5],-4.94168,'edgecolor','none');
+patch([24.5,25.5,25.5,24.5],[6.5,6.5,7.5,7.5],-4.43845,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[5.5,5.5,6.5,6.5],-4.7738,'edgecolor','none');
+patch([25.5,26.5,26.5,25.5],[6.5,6.5,7.5,7.5],-4.27048,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[5.5,5.5,6.5,6.5],-4.61234,'edgecolor','none');
+patch([26.5,27.5,27.5,26.5],[6.5,6.5,7.5,7.5],-4.109,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[5.5,5.5,6.5,6.5],-4.45568,'edgecolor','none');
+patch([27.5,28.5,28.5,27.5],[6.5,6.5,7.5,7.5],-3.95235,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[4.5,4.5,5.5,5.5],-5,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[5.5,5.5,6.5,6.5],-4.30287,'edgecolor','none');
+patch([28.5,29.5,29.5,28.5],[6.5,6.5,7.5,7.5],-3.79954,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[4.5,4.5,5.5,5.5],-4.89232,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[5.5,5.5,6.5,6.5],-4.15661,'edgecolor','none');
+patch([29.5,30.5,30.5,29.5],[6.5,6.5,7.5,7.5],-3.65392,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[-0.5,-0.5,0.5,0.5],-5,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[0.5,0.5,1.5,1.5],-5,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[1.5,1.5,2.5,2.5],-5,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[2.5,2.5,3.5,3.5],-5,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[3.5,3.5,4.5,4.5],-5,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[4.5,4.5,5.5,5.5],-4.82525,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[5.5,5.5,6.5,6.5],-4.08991,'edgecolor','none');
+patch([30.5,31.5,31.5,30.5],[6.5,6.5,7.5,7.5],-3.58799,'edgecolor','none');
+h=colorbar;
+ytick=get(h,'ytick');
+labels = {};
+for v=ytick(1:end), labels{end+1} = sprintf('10^%i',v); end
+set(h, 'yticklabel',labels);
+print('-djpg',sprintf('coeffs%i%i.jpg',5,3))
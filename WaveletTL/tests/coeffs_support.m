@@ -0,0 +1,1457 @@
+A=[
+2,2,0,0,0,0.25,0,0.25,6.5584e-05;
+2,2,0,1,0,0.25,0,0.375,0.000331366;
+2,2,0,2,0,0.25,0.125,0.5,0.000811768;
+2,2,0,3,0,0.25,0.25,0.625,0.00167139;
+2,2,0,4,0,0.25,0.375,0.75,0.00315638;
+2,2,0,5,0,0.25,0.5,0.875,0.00559602;
+2,2,0,6,0,0.25,0.625,1,0.00820153;
+2,2,0,7,0,0.25,0.75,1,0.0085503;
+2,2,1,0,0,0.375,0,0.25,0.000331369;
+2,2,1,1,0,0.375,0,0.375,0.00155131;
+2,2,1,2,0,0.375,0.125,0.5,0.00380066;
+2,2,1,3,0,0.375,0.25,0.625,0.00782529;
+2,2,1,4,0,0.375,0.375,0.75,0.0147779;
+2,2,1,5,0,0.375,0.5,0.875,0.0262;
+2,2,1,6,0,0.375,0.625,1,0.0383987;
+2,2,1,7,0,0.375,0.75,1,0.0431829;
+2,2,2,0,0.125,0.5,0,0.25,0.000811766;
+2,2,2,1,0.125,0.5,0,0.375,0.00380066;
+2,2,2,2,0.125,0.5,0.125,0.5,0.00931133;
+2,2,2,3,0.125,0.5,0.25,0.625,0.0191714;
+2,2,2,4,0.125,0.5,0.375,0.75,0.0362047;
+2,2,2,5,0.125,0.5,0.5,0.875,0.0641882;
+2,2,2,6,0.125,0.5,0.625,1,0.0940742;
+2,2,2,7,0.125,0.5,0.75,1,0.105795;
+2,2,3,0,0.25,0.625,0,0.25,0.00167139;
+2,2,3,1,0.25,0.625,0,0.375,0.00782529;
+2,2,3,2,0.25,0.625,0.125,0.5,0.0191714;
+2,2,3,3,0.25,0.625,0.25,0.625,0.0394727;
+2,2,3,4,0.25,0.625,0.375,0.75,0.0745431;
+2,2,3,5,0.25,0.625,0.5,0.875,0.132159;
+2,2,3,6,0.25,0.625,0.625,1,0.193692;
+2,2,3,7,0.25,0.625,0.75,1,0.217825;
+2,2,4,0,0.375,0.75,0,0.25,0.00315638;
+2,2,4,1,0.375,0.75,0,0.375,0.0147779;
+2,2,4,2,0.375,0.75,0.125,0.5,0.0362047;
+2,2,4,3,0.375,0.75,0.25,0.625,0.0745431;
+2,2,4,4,0.375,0.75,0.375,0.75,0.140773;
+2,2,4,5,0.375,0.75,0.5,0.875,0.249579;
+2,2,4,6,0.375,0.75,0.625,1,0.365783;
+2,2,4,7,0.375,0.75,0.75,1,0.411357;
+2,2,5,0,0.5,0.875,0,0.25,0.00559602;
+2,2,5,1,0.5,0.875,0,0.375,0.0262;
+2,2,5,2,0.5,0.875,0.125,0.5,0.0641882;
+2,2,5,3,0.5,0.875,0.25,0.625,0.132159;
+2,2,5,4,0.5,0.875,0.375,0.75,0.249579;
+2,2,5,5,0.5,0.875,0.5,0.875,0.442485;
+2,2,5,6,0.5,0.875,0.625,1,0.648505;
+2,2,5,7,0.5,0.875,0.75,1,0.729304;
+2,2,6,0,0.625,1,0,0.25,0.00820153;
+2,2,6,1,0.625,1,0,0.375,0.0383987;
+2,2,6,2,0.625,1,0.125,0.5,0.0940742;
+2,2,6,3,0.625,1,0.25,0.625,0.193692;
+2,2,6,4,0.625,1,0.375,0.75,0.365783;
+2,2,6,5,0.625,1,0.5,0.875,0.648505;
+2,2,6,6,0.625,1,0.625,1,0.950447;
+2,2,6,7,0.625,1,0.75,1,1.06887;
+2,2,7,0,0.75,1,0,0.25,0.0085503;
+2,2,7,1,0.75,1,0,0.375,0.0431829;
+2,2,7,2,0.75,1,0.125,0.5,0.105795;
+2,2,7,3,0.75,1,0.25,0.625,0.217825;
+2,2,7,4,0.75,1,0.375,0.75,0.411357;
+2,2,7,5,0.75,1,0.5,0.875,0.729304;
+2,2,7,6,0.75,1,0.625,1,1.06887;
+2,2,7,7,0.75,1,0.75,1,1.11432;
+2,3,0,0,0,0.25,0,0.5,-2.06137e-06;
+2,3,0,1,0,0.25,0,0.5,4.18215e-06;
+2,3,0,2,0,0.25,0,0.625,6.81837e-06;
+2,3,0,3,0,0.25,0.125,0.75,8.9844e-06;
+2,3,0,4,0,0.25,0.25,0.875,-3.46699e-06;
+2,3,0,5,0,0.25,0.375,1,4.0113e-05;
+2,3,0,6,0,0.25,0.5,1,0.000257842;
+2,3,0,7,0,0.25,0.5,1,-0.000904866;
+2,3,1,0,0,0.375,0,0.5,-1.19842e-05;
+2,3,1,1,0,0.375,0,0.5,2.36984e-05;
+2,3,1,2,0,0.375,0,0.625,3.81586e-05;
+2,3,1,3,0,0.375,0.125,0.75,5.00164e-05;
+2,3,1,4,0,0.375,0.25,0.875,-1.93693e-05;
+2,3,1,5,0,0.375,0.375,1,0.000222269;
+2,3,1,6,0,0.375,0.5,1,0.00144141;
+2,3,1,7,0,0.375,0.5,1,-0.00511616;
+2,3,2,0,0.125,0.5,0,0.5,-2.91949e-05;
+2,3,2,1,0.125,0.5,0,0.5,5.79245e-05;
+2,3,2,2,0.125,0.5,0,0.625,9.33465e-05;
+2,3,2,3,0.125,0.5,0.125,0.75,0.000122449;
+2,3,2,4,0.125,0.5,0.25,0.875,-4.73946e-05;
+2,3,2,5,0.125,0.5,0.375,1,0.000544536;
+2,3,2,6,0.125,0.5,0.5,1,0.00353132;
+2,3,2,7,0.125,0.5,0.5,1,-0.0125342;
+2,3,3,0,0.25,0.625,0,0.5,-6.0155e-05;
+2,3,3,1,0.25,0.625,0,0.5,0.000119299;
+2,3,3,2,0.25,0.625,0,0.625,0.000192236;
+2,3,3,3,0.25,0.625,0.125,0.75,0.000252142;
+2,3,3,4,0.25,0.625,0.25,0.875,-9.75923e-05;
+2,3,3,5,0.25,0.625,0.375,1,0.00112117;
+2,3,3,6,0.25,0.625,0.5,1,0.00727075;
+2,3,3,7,0.25,0.625,0.5,1,-0.0258071;
+2,3,4,0,0.375,0.75,0,0.5,-0.000113598;
+2,3,4,1,0.375,0.75,0,0.5,0.000225284;
+2,3,4,2,0.375,0.75,0,0.625,0.00036301;
+2,3,4,3,0.375,0.75,0.125,0.75,0.000476134;
+2,3,4,4,0.375,0.75,0.25,0.875,-0.000184295;
+2,3,4,5,0.375,0.75,0.375,1,0.00211727;
+2,3,4,6,0.375,0.75,0.5,1,0.0137306;
+2,3,4,7,0.375,0.75,0.5,1,-0.0487361;
+2,3,5,0,0.5,0.875,0,0.5,-0.000201394;
+2,3,5,1,0.5,0.875,0,0.5,0.000399423;
+2,3,5,2,0.5,0.875,0,0.625,0.000643613;
+2,3,5,3,0.5,0.875,0.125,0.75,0.000844185;
+2,3,5,4,0.5,0.875,0.25,0.875,-0.000326765;
+2,3,5,5,0.5,0.875,0.375,1,0.00375379;
+2,3,5,6,0.5,0.875,0.5,1,0.0243432;
+2,3,5,7,0.5,0.875,0.5,1,-0.0864048;
+2,3,6,0,0.625,1,0,0.5,-0.000295199;
+2,3,6,1,0.625,1,0,0.5,0.000585393;
+2,3,6,2,0.625,1,0,0.625,0.000943267;
+2,3,6,3,0.625,1,0.125,0.75,0.00123723;
+2,3,6,4,0.625,1,0.25,0.875,-0.000478881;
+2,3,6,5,0.625,1,0.375,1,0.00550154;
+2,3,6,6,0.625,1,0.5,1,0.0356779;
+2,3,6,7,0.625,1,0.5,1,-0.126637;
+2,3,7,0,0.75,1,0,0.5,-0.000274874;
+2,3,7,1,0.75,1,0,0.5,0.000551396;
+2,3,7,2,0.75,1,0,0.625,0.000896409;
+2,3,7,3,0.75,1,0.125,0.75,0.00117576;
+2,3,7,4,0.75,1,0.25,0.875,-0.000455093;
+2,3,7,5,0.75,1,0.375,1,0.00522827;
+2,3,7,6,0.75,1,0.5,1,0.0336051;
+2,3,7,7,0.75,1,0.5,1,-0.117926;
+3,2,0,0,0,0.5,0,0.25,-2.05971e-06;
+3,2,0,1,0,0.5,0,0.375,-1.19856e-05;
+3,2,0,2,0,0.5,0.125,0.5,-2.91943e-05;
+3,2,0,3,0,0.5,0.25,0.625,-6.01544e-05;
+3,2,0,4,0,0.5,0.375,0.75,-0.000113599;
+3,2,0,5,0,0.5,0.5,0.875,-0.000201393;
+3,2,0,6,0,0.5,0.625,1,-0.0002952;
+3,2,0,7,0,0.5,0.75,1,-0.000274874;
+3,2,1,0,0,0.5,0,0.25,4.17328e-06;
+3,2,1,1,0,0.5,0,0.375,2.37038e-05;
+3,2,1,2,0,0.5,0.125,0.5,5.79219e-05;
+3,2,1,3,0,0.5,0.25,0.625,0.000119301;
+3,2,1,4,0,0.5,0.375,0.75,0.000225283;
+3,2,1,5,0,0.5,0.5,0.875,0.000399422;
+3,2,1,6,0,0.5,0.625,1,0.000585394;
+3,2,1,7,0,0.5,0.75,1,0.000551395;
+3,2,2,0,0,0.625,0,0.25,6.80787e-06;
+3,2,2,1,0,0.625,0,0.375,3.81647e-05;
+3,2,2,2,0,0.625,0.125,0.5,9.33435e-05;
+3,2,2,3,0,0.625,0.25,0.625,0.000192237;
+3,2,2,4,0,0.625,0.375,0.75,0.00036301;
+3,2,2,5,0,0.625,0.5,0.875,0.00064361;
+3,2,2,6,0,0.625,0.625,1,0.000943271;
+3,2,2,7,0,0.625,0.75,1,0.000896407;
+3,2,3,0,0.125,0.75,0,0.25,8.98234e-06;
+3,2,3,1,0.125,0.75,0,0.375,5.00176e-05;
+3,2,3,2,0.125,0.75,0.125,0.5,0.000122448;
+3,2,3,3,0.125,0.75,0.25,0.625,0.000252142;
+3,2,3,4,0.125,0.75,0.375,0.75,0.000476135;
+3,2,3,5,0.125,0.75,0.5,0.875,0.000844185;
+3,2,3,6,0.125,0.75,0.625,1,0.00123723;
+3,2,3,7,0.125,0.75,0.75,1,0.00117576;
+3,2,4,0,0.25,0.875,0,0.25,-3.46697e-06;
+3,2,4,1,0.25,0.875,0,0.375,-1.93695e-05;
+3,2,4,2,0.25,0.875,0.125,0.5,-4.73943e-05;
+3,2,4,3,0.25,0.875,0.25,0.625,-9.75927e-05;
+3,2,4,4,0.25,0.875,0.375,0.75,-0.000184295;
+3,2,4,5,0.25,0.875,0.5,0.875,-0.000326766;
+3,2,4,6,0.25,0.875,0.625,1,-0.000478881;
+3,2,4,7,0.25,0.875,0.75,1,-0.000455093;
+3,2,5,0,0.375,1,0,0.25,4.01155e-05;
+3,2,5,1,0.375,1,0,0.375,0.000222264;
+3,2,5,2,0.375,1,0.125,0.5,0.00054454;
+3,2,5,3,0.375,1,0.25,0.625,0.00112117;
+3,2,5,4,0.375,1,0.375,0.75,0.00211727;
+3,2,5,5,0.375,1,0.5,0.875,0.00375379;
+3,2,5,6,0.375,1,0.625,1,0.00550154;
+3,2,5,7,0.375,1,0.75,1,0.00522827;
+3,2,6,0,0.5,1,0,0.25,0.000257849;
+3,2,6,1,0.5,1,0,0.375,0.0014414;
+3,2,6,2,0.5,1,0.125,0.5,0.00353132;
+3,2,6,3,0.5,1,0.25,0.625,0.00727075;
+3,2,6,4,0.5,1,0.375,0.75,0.0137306;
+3,2,6,5,0.5,1,0.5,0.875,0.0243432;
+3,2,6,6,0.5,1,0.625,1,0.0356779;
+3,2,6,7,0.5,1,0.75,1,0.0336051;
+3,2,7,0,0.5,1,0,0.25,-0.000904868;
+3,2,7,1,0.5,1,0,0.375,-0.00511617;
+3,2,7,2,0.5,1,0.125,0.5,-0.0125342;
+3,2,7,3,0.5,1,0.25,0.625,-0.0258071;
+3,2,7,4,0.5,1,0.375,0.75,-0.0487361;
+3,2,7,5,0.5,1,0.5,0.875,-0.0864048;
+3,2,7,6,0.5,1,0.625,1,-0.126637;
+3,2,7,7,0.5,1,0.75,1,-0.117926;
+3,3,0,0,0,0.5,0,0.5,1.11459e-08;
+3,3,0,3,0,0.5,0.125,0.75,-1.12192e-07;
+3,3,0,5,0,0.5,0.375,1,-1.03367e-06;
+3,3,0,6,0,0.5,0.5,1,-6.34909e-06;
+3,3,0,7,0,0.5,0.5,1,2.13949e-05;
+3,3,1,1,0,0.5,0,0.5,1.3385e-07;
+3,3,1,2,0,0.5,0,0.625,2.83073e-07;
+3,3,1,3,0,0.5,0.125,0.75,4.22323e-07;
+3,3,1,4,0,0.5,0.25,0.875,-1.45058e-07;
+3,3,1,5,0,0.5,0.375,1,2.1323e-06;
+3,3,1,6,0,0.5,0.5,1,1.32974e-05;
+3,3,1,7,0,0.5,0.5,1,-4.49889e-05;
+3,3,2,1,0,0.625,0,0.5,2.82694e-07;
+3,3,2,2,0,0.625,0,0.625,5.85018e-07;
+3,3,2,3,0,0.625,0.125,0.75,7.8025e-07;
+3,3,2,4,0,0.625,0.25,0.875,-3.01914e-07;
+3,3,2,5,0,0.625,0.375,1,3.52321e-06;
+3,3,2,6,0,0.625,0.5,1,2.21942e-05;
+3,3,2,7,0,0.625,0.5,1,-7.55124e-05;
+3,3,3,0,0.125,0.75,0,0.5,-1.11128e-07;
+3,3,3,1,0.125,0.75,0,0.5,4.21862e-07;
+3,3,3,2,0.125,0.75,0,0.625,7.80217e-07;
+3,3,3,3,0.125,0.75,0.125,0.75,1.0306e-06;
+3,3,3,4,0.125,0.75,0.25,0.875,-4.12393e-07;
+3,3,3,5,0.125,0.75,0.375,1,4.6159e-06;
+3,3,3,6,0.125,0.75,0.5,1,2.91071e-05;
+3,3,3,7,0.125,0.75,0.5,1,-9.90384e-05;
+3,3,4,1,0.25,0.875,0,0.5,-1.44823e-07;
+3,3,4,2,0.25,0.875,0,0.625,-3.0202e-07;
+3,3,4,3,0.25,0.875,0.125,0.75,-4.13088e-07;
+3,3,4,4,0.25,0.875,0.25,0.875,1.89075e-07;
+3,3,4,5,0.25,0.875,0.375,1,-1.79079e-06;
+3,3,4,6,0.25,0.875,0.5,1,-1.12766e-05;
+3,3,4,7,0.25,0.875,0.5,1,3.83301e-05;
+3,3,5,0,0.375,1,0,0.5,-1.03129e-06;
+3,3,5,1,0.375,1,0,0.5,2.13341e-06;
+3,3,5,2,0.375,1,0,0.625,3.52944e-06;
+3,3,5,3,0.375,1,0.125,0.75,4.61555e-06;
+3,3,5,4,0.375,1,0.25,0.875,-1.79092e-06;
+3,3,5,5,0.375,1,0.375,1,2.05614e-05;
+3,3,5,6,0.375,1,0.5,1,0.000129484;
+3,3,5,7,0.375,1,0.5,1,-0.000440447;
+3,3,6,0,0.5,1,0,0.5,-6.36492e-06;
+3,3,6,1,0.5,1,0,0.5,1.33035e-05;
+3,3,6,2,0.5,1,0,0.625,2.21954e-05;
+3,3,6,3,0.5,1,0.125,0.75,2.91072e-05;
+3,3,6,4,0.5,1,0.25,0.875,-1.12767e-05;
+3,3,6,5,0.5,1,0.375,1,0.000129484;
+3,3,6,6,0.5,1,0.5,1,0.000810365;
+3,3,6,7,0.5,1,0.5,1,-0.00274126;
+3,3,7,0,0.5,1,0,0.5,2.14173e-05;
+3,3,7,1,0.5,1,0,0.5,-4.49948e-05;
+3,3,7,2,0.5,1,0,0.625,-7.55026e-05;
+3,3,7,3,0.5,1,0.125,0.75,-9.9038e-05;
+3,3,7,4,0.5,1,0.25,0.875,3.83301e-05;
+3,3,7,5,0.5,1,0.375,1,-0.000440447;
+3,3,7,6,0.5,1,0.5,1,-0.00274126;
+3,3,7,7,0.5,1,0.5,1,0.0091978;
+2,4,0,0,0,0.25,0,0.25,-2.7236e-07;
+2,4,0,1,0,0.25,0,0.25,4.39522e-07;
+2,4,0,2,0,0.25,0,0.3125,5.90859e-07;
+2,4,0,3,0,0.25,0.0625,0.375,7.74744e-07;
+2,4,0,4,0,0.25,0.125,0.4375,9.81062e-07;
+2,4,0,5,0,0.25,0.1875,0.5,1.19858e-06;
+2,4,0,6,0,0.25,0.25,0.5625,1.38214e-06;
+2,4,0,7,0,0.25,0.3125,0.625,1.41616e-06;
+2,4,0,8,0,0.25,0.375,0.6875,-1.04204e-06;
+2,4,0,9,0,0.25,0.4375,0.75,2.59347e-07;
+2,4,0,10,0,0.25,0.5,0.8125,3.48738e-06;
+2,4,0,11,0,0.25,0.5625,0.875,1.07114e-05;
+2,4,0,12,0,0.25,0.625,0.9375,2.57259e-05;
+2,4,0,13,0,0.25,0.6875,1,5.58421e-05;
+2,4,0,14,0,0.25,0.75,1,0.000119128;
+2,4,0,15,0,0.25,0.75,1,-0.000205472;
+2,4,1,0,0,0.375,0,0.25,-1.78669e-06;
+2,4,1,1,0,0.375,0,0.25,2.68778e-06;
+2,4,1,2,0,0.375,0,0.3125,3.50135e-06;
+2,4,1,3,0,0.375,0.0625,0.375,4.54928e-06;
+2,4,1,4,0,0.375,0.125,0.4375,5.78695e-06;
+2,4,1,5,0,0.375,0.1875,0.5,7.10158e-06;
+2,4,1,6,0,0.375,0.25,0.5625,8.1908e-06;
+2,4,1,7,0,0.375,0.3125,0.625,8.35969e-06;
+2,4,1,8,0,0.375,0.375,0.6875,-6.13326e-06;
+2,4,1,9,0,0.375,0.4375,0.75,1.49557e-06;
+2,4,1,10,0,0.375,0.5,0.8125,2.04875e-05;
+2,4,1,11,0,0.375,0.5625,0.875,6.23915e-05;
+2,4,1,12,0,0.375,0.625,0.9375,0.000149545;
+2,4,1,13,0,0.375,0.6875,1,0.000324497;
+2,4,1,14,0,0.375,0.75,1,0.000694382;
+2,4,1,15,0,0.375,0.75,1,-0.00120161;
+2,4,2,0,0.125,0.5,0,0.25,-4.30993e-06;
+2,4,2,1,0.125,0.5,0,0.25,6.54382e-06;
+2,4,2,2,0.125,0.5,0,0.3125,8.55484e-06;
+2,4,2,3,0.125,0.5,0.0625,0.375,1.1129e-05;
+2,4,2,4,0.125,0.5,0.125,0.4375,1.41479e-05;
+2,4,2,5,0.125,0.5,0.1875,0.5,1.7353e-05;
+2,4,2,6,0.125,0.5,0.25,0.5625,2.00133e-05;
+2,4,2,7,0.125,0.5,0.3125,0.625,2.04357e-05;
+2,4,2,8,0.125,0.5,0.375,0.6875,-1.50047e-05;
+2,4,2,9,0.125,0.5,0.4375,0.75,3.65065e-06;
+2,4,2,10,0.125,0.5,0.5,0.8125,5.01008e-05;
+2,4,2,11,0.125,0.5,0.5625,0.875,0.000152797;
+2,4,2,12,0.125,0.5,0.625,0.9375,0.000366349;
+2,4,2,13,0.125,0.5,0.6875,1,0.000794983;
+2,4,2,14,0.125,0.5,0.75,1,0.0017011;
+2,4,2,15,0.125,0.5,0.75,1,-0.0029438;
+2,4,3,0,0.25,0.625,0,0.25,-8.92452e-06;
+2,4,3,1,0.25,0.625,0,0.25,1.34888e-05;
+2,4,3,2,0.25,0.625,0,0.3125,1.7611e-05;
+2,4,3,3,0.25,0.625,0.0625,0.375,2.28993e-05;
+2,4,3,4,0.25,0.625,0.125,0.4375,2.91174e-05;
+2,4,3,5,0.25,0.625,0.1875,0.5,3.57189e-05;
+2,4,3,6,0.25,0.625,0.25,0.5625,4.11966e-05;
+2,4,3,7,0.25,0.625,0.3125,0.625,4.20601e-05;
+2,4,3,8,0.25,0.625,0.375,0.6875,-3.08632e-05;
+2,4,3,9,0.25,0.625,0.4375,0.75,7.54749e-06;
+2,4,3,10,0.25,0.625,0.5,0.8125,0.000103224;
+2,4,3,11,0.25,0.625,0.5625,0.875,0.000314636;
+2,4,3,12,0.25,0.625,0.625,0.9375,0.000754319;
+2,4,3,13,0.25,0.625,0.6875,1,0.00163683;
+2,4,3,14,0.25,0.625,0.75,1,0.00350247;
+2,4,3,15,0.25,0.625,0.75,1,-0.0060611;
+2,4,4,0,0.375,0.75,0,0.25,-1.67927e-05;
+2,4,4,1,0.375,0.75,0,0.25,2.54456e-05;
+2,4,4,2,0.375,0.75,0,0.3125,3.32492e-05;
+2,4,4,3,0.375,0.75,0.0625,0.375,4.32381e-05;
+2,4,4,4,0.375,0.75,0.125,0.4375,5.49785e-05;
+2,4,4,5,0.375,0.75,0.1875,0.5,6.74416e-05;
+2,4,4,6,0.375,0.75,0.25,0.5625,7.77838e-05;
+2,4,4,7,0.375,0.75,0.3125,0.625,7.94179e-05;
+2,4,4,8,0.375,0.75,0.375,0.6875,-5.83041e-05;
+2,4,4,9,0.375,0.75,0.4375,0.75,1.41952e-05;
+2,4,4,10,0.375,0.75,0.5,0.8125,0.000194867;
+2,4,4,11,0.375,0.75,0.5625,0.875,0.000594128;
+2,4,4,12,0.375,0.75,0.625,0.9375,0.00142444;
+2,4,4,13,0.375,0.75,0.6875,1,0.00309106;
+2,4,4,14,0.375,0.75,0.75,1,0.00661432;
+2,4,4,15,0.375,0.75,0.75,1,-0.0114462;
+2,4,5,0,0.5,0.875,0,0.25,-2.97633e-05;
+2,4,5,1,0.5,0.875,0,0.25,4.51314e-05;
+2,4,5,2,0.5,0.875,0,0.3125,5.89748e-05;
+2,4,5,3,0.5,0.875,0.0625,0.375,7.66963e-05;
+2,4,5,4,0.5,0.875,0.125,0.4375,9.74939e-05;
+2,4,5,5,0.5,0.875,0.1875,0.5,0.000119581;
+2,4,5,6,0.5,0.875,0.25,0.5625,0.000137916;
+2,4,5,7,0.5,0.875,0.3125,0.625,0.000140812;
+2,4,5,8,0.5,0.875,0.375,0.6875,-0.000103364;
+2,4,5,9,0.5,0.875,0.4375,0.75,2.5184e-05;
+2,4,5,10,0.5,0.875,0.5,0.8125,0.000345462;
+2,4,5,11,0.5,0.875,0.5625,0.875,0.00105334;
+2,4,5,12,0.5,0.875,0.625,0.9375,0.00252541;
+2,4,5,13,0.5,0.875,0.6875,1,0.00548008;
+2,4,5,14,0.5,0.875,0.75,1,0.011726;
+2,4,5,15,0.5,0.875,0.75,1,-0.0202917;
+2,4,6,0,0.625,1,0,0.25,-4.37619e-05;
+2,4,6,1,0.625,1,0,0.25,6.61765e-05;
+2,4,6,2,0.625,1,0,0.3125,8.64189e-05;
+2,4,6,3,0.625,1,0.0625,0.375,0.000112377;
+2,4,6,4,0.625,1,0.125,0.4375,0.000142908;
+2,4,6,5,0.625,1,0.1875,0.5,0.000175313;
+2,4,6,6,0.625,1,0.25,0.5625,0.000202197;
+2,4,6,7,0.625,1,0.3125,0.625,0.000206443;
+2,4,6,8,0.625,1,0.375,0.6875,-0.000151516;
+2,4,6,9,0.625,1,0.4375,0.75,3.69929e-05;
+2,4,6,10,0.625,1,0.5,0.8125,0.000506451;
+2,4,6,11,0.625,1,0.5625,0.875,0.00154397;
+2,4,6,12,0.625,1,0.625,0.9375,0.00370167;
+2,4,6,13,0.625,1,0.6875,1,0.00803257;
+2,4,6,14,0.625,1,0.75,1,0.0171892;
+2,4,6,15,0.625,1,0.75,1,-0.0297477;
+2,4,7,0,0.75,1,0,0.25,-3.92794e-05;
+2,4,7,1,0.75,1,0,0.25,5.97607e-05;
+2,4,7,2,0.75,1,0,0.3125,7.83154e-05;
+2,4,7,3,0.75,1,0.0625,0.375,0.000101847;
+2,4,7,4,0.75,1,0.125,0.4375,0.000129478;
+2,4,7,5,0.75,1,0.1875,0.5,0.000158818;
+2,4,7,6,0.75,1,0.25,0.5625,0.000183171;
+2,4,7,7,0.75,1,0.3125,0.625,0.000187017;
+2,4,7,8,0.75,1,0.375,0.6875,-0.000137284;
+2,4,7,9,0.75,1,0.4375,0.75,3.34464e-05;
+2,4,7,10,0.75,1,0.5,0.8125,0.000458849;
+2,4,7,11,0.75,1,0.5625,0.875,0.00139897;
+2,4,7,12,0.75,1,0.625,0.9375,0.00335405;
+2,4,7,13,0.75,1,0.6875,1,0.00727823;
+2,4,7,14,0.75,1,0.75,1,0.0155278;
+2,4,7,15,0.75,1,0.75,1,-0.026774;
+3,4,0,0,0,0.5,0,0.25,1.65067e-09;
+3,4,0,2,0,0.5,0,0.3125,-1.22077e-08;
+3,4,0,11,0,0.5,0.5625,0.875,-1.67826e-07;
+3,4,0,12,0,0.5,0.625,0.9375,-4.75661e-07;
+3,4,0,13,0,0.5,0.6875,1,-1.05355e-06;
+3,4,0,14,0,0.5,0.75,1,-2.30444e-06;
+3,4,0,15,0,0.5,0.75,1,4.0353e-06;
+3,4,1,10,0,0.5,0.5,0.8125,1.1324e-07;
+3,4,1,11,0,0.5,0.5625,0.875,4.57618e-07;
+3,4,1,12,0,0.5,0.625,0.9375,1.14239e-06;
+3,4,1,13,0,0.5,0.6875,1,2.4725e-06;
+3,4,1,14,0,0.5,0.75,1,5.23699e-06;
+3,4,1,15,0,0.5,0.75,1,-8.91985e-06;
+3,4,2,10,0,0.625,0.5,0.8125,2.35239e-07;
+3,4,2,11,0,0.625,0.5625,0.875,8.03841e-07;
+3,4,2,12,0,0.625,0.625,0.9375,1.98787e-06;
+3,4,2,13,0,0.625,0.6875,1,4.2885e-06;
+3,4,2,14,0,0.625,0.75,1,9.02558e-06;
+3,4,2,15,0,0.625,0.75,1,-1.5349e-05;
+3,4,3,10,0.125,0.75,0.5,0.8125,2.68644e-07;
+3,4,3,11,0.125,0.75,0.5625,0.875,1.03407e-06;
+3,4,3,12,0.125,0.75,0.625,0.9375,2.58312e-06;
+3,4,3,13,0.125,0.75,0.6875,1,5.60556e-06;
+3,4,3,14,0.125,0.75,0.75,1,1.18272e-05;
+3,4,3,15,0.125,0.75,0.75,1,-2.01278e-05;
+3,4,4,6,0.25,0.875,0.25,0.5625,3.2497e-09;
+3,4,4,11,0.25,0.875,0.5625,0.875,-3.54927e-07;
+3,4,4,12,0.25,0.875,0.625,0.9375,-9.74928e-07;
+3,4,4,13,0.25,0.875,0.6875,1,-2.15469e-06;
+3,4,4,14,0.25,0.875,0.75,1,-4.5655e-06;
+3,4,4,15,0.25,0.875,0.75,1,7.76538e-06;
+3,4,5,1,0.375,1,0,0.25,1.67595e-07;
+3,4,5,2,0.375,1,0,0.3125,2.85083e-07;
+3,4,5,3,0.375,1,0.0625,0.375,3.74577e-07;
+3,4,5,4,0.375,1,0.125,0.4375,4.435e-07;
+3,4,5,5,0.375,1,0.1875,0.5,5.26308e-07;
+3,4,5,6,0.375,1,0.25,0.5625,6.07173e-07;
+3,4,5,7,0.375,1,0.3125,0.625,6.20483e-07;
+3,4,5,8,0.375,1,0.375,0.6875,-5.0375e-07;
+3,4,5,10,0.375,1,0.5,0.8125,1.57443e-06;
+3,4,5,11,0.375,1,0.5625,0.875,4.80537e-06;
+3,4,5,12,0.375,1,0.625,0.9375,1.14718e-05;
+3,4,5,13,0.375,1,0.6875,1,2.49026e-05;
+3,4,5,14,0.375,1,0.75,1,5.26557e-05;
+3,4,5,15,0.375,1,0.75,1,-8.96766e-05;
+3,4,6,0,0.5,1,0,0.25,-6.60773e-07;
+3,4,6,1,0.5,1,0,0.25,1.18738e-06;
+3,4,6,2,0.5,1,0,0.3125,1.62344e-06;
+3,4,6,3,0.5,1,0.0625,0.375,2.12552e-06;
+3,4,6,4,0.5,1,0.125,0.4375,2.71634e-06;
+3,4,6,5,0.5,1,0.1875,0.5,3.33848e-06;
+3,4,6,6,0.5,1,0.25,0.5625,3.85254e-06;
+3,4,6,7,0.5,1,0.3125,0.625,3.93473e-06;
+3,4,6,8,0.5,1,0.375,0.6875,-2.89103e-06;
+3,4,6,9,0.5,1,0.4375,0.75,6.23428e-07;
+3,4,6,10,0.5,1,0.5,0.8125,9.55195e-06;
+3,4,6,11,0.5,1,0.5625,0.875,2.92233e-05;
+3,4,6,12,0.5,1,0.625,0.9375,7.00607e-05;
+3,4,6,13,0.5,1,0.6875,1,0.000152039;
+3,4,6,14,0.5,1,0.75,1,0.000319264;
+3,4,6,15,0.5,1,0.75,1,-0.000540222;
+3,4,7,0,0.5,1,0,0.25,2.49211e-06;
+3,4,7,1,0.5,1,0,0.25,-3.93819e-06;
+3,4,7,2,0.5,1,0,0.3125,-5.26246e-06;
+3,4,7,3,0.5,1,0.0625,0.375,-6.85273e-06;
+3,4,7,4,0.5,1,0.125,0.4375,-8.79184e-06;
+3,4,7,5,0.5,1,0.1875,0.5,-1.0825e-05;
+3,4,7,6,0.5,1,0.25,0.5625,-1.24904e-05;
+3,4,7,7,0.5,1,0.3125,0.625,-1.27554e-05;
+3,4,7,8,0.5,1,0.375,0.6875,9.37267e-06;
+3,4,7,9,0.5,1,0.4375,0.75,-2.23871e-06;
+3,4,7,10,0.5,1,0.5,0.8125,-3.12527e-05;
+3,4,7,11,0.5,1,0.5625,0.875,-9.5345e-05;
+3,4,7,12,0.5,1,0.625,0.9375,-0.000228597;
+3,4,7,13,0.5,1,0.6875,1,-0.000496078;
+3,4,7,14,0.5,1,0.75,1,-0.00103754;
+3,4,7,15,0.5,1,0.75,1,0.00174634;
+4,2,0,0,0,0.25,0,0.25,-2.71681e-07;
+4,2,0,1,0,0.25,0,0.375,-1.78682e-06;
+4,2,0,2,0,0.25,0.125,0.5,-4.31075e-06;
+4,2,0,3,0,0.25,0.25,0.625,-8.92255e-06;
+4,2,0,4,0,0.25,0.375,0.75,-1.67971e-05;
+4,2,0,5,0,0.25,0.5,0.875,-2.97557e-05;
+4,2,0,6,0,0.25,0.625,1,-4.37702e-05;
+4,2,0,7,0,0.25,0.75,1,-3.92742e-05;
+4,2,1,0,0,0.25,0,0.25,4.40049e-07;
+4,2,1,1,0,0.25,0,0.375,2.6874e-06;
+4,2,1,2,0,0.25,0.125,0.5,6.5442e-06;
+4,2,1,3,0,0.25,0.25,0.625,1.34881e-05;
+4,2,1,4,0,0.25,0.375,0.75,2.54473e-05;
+4,2,1,5,0,0.25,0.5,0.875,4.51281e-05;
+4,2,1,6,0,0.25,0.625,1,6.61804e-05;
+4,2,1,7,0,0.25,0.75,1,5.97582e-05;
+4,2,2,0,0,0.3125,0,0.25,5.91332e-07;
+4,2,2,1,0,0.3125,0,0.375,3.50114e-06;
+4,2,2,2,0,0.3125,0.125,0.5,8.55645e-06;
+4,2,2,3,0,0.3125,0.25,0.625,1.761e-05;
+4,2,2,4,0,0.3125,0.375,0.75,3.32497e-05;
+4,2,2,5,0,0.3125,0.5,0.875,5.89725e-05;
+4,2,2,6,0,0.3125,0.625,1,8.64224e-05;
+4,2,2,7,0,0.3125,0.75,1,7.83134e-05;
+4,2,3,0,0.0625,0.375,0,0.25,7.61713e-07;
+4,2,3,1,0.0625,0.375,0,0.375,4.55734e-06;
+4,2,3,2,0.0625,0.375,0.125,0.5,1.11247e-05;
+4,2,3,3,0.0625,0.375,0.25,0.625,2.2903e-05;
+4,2,3,4,0.0625,0.375,0.375,0.75,4.32404e-05;
+4,2,3,5,0.0625,0.375,0.5,0.875,7.66783e-05;
+4,2,3,6,0.0625,0.375,0.625,1,0.000112402;
+4,2,3,7,0.0625,0.375,0.75,1,0.000101834;
+4,2,4,0,0.125,0.4375,0,0.25,9.82042e-07;
+4,2,4,1,0.125,0.4375,0,0.375,5.78647e-06;
+4,2,4,2,0.125,0.4375,0.125,0.5,1.41477e-05;
+4,2,4,3,0.125,0.4375,0.25,0.625,2.91186e-05;
+4,2,4,4,0.125,0.4375,0.375,0.75,5.49799e-05;
+4,2,4,5,0.125,0.4375,0.5,0.875,9.74845e-05;
+4,2,4,6,0.125,0.4375,0.625,1,0.00014292;
+4,2,4,7,0.125,0.4375,0.75,1,0.000129472;
+4,2,5,0,0.1875,0.5,0,0.25,1.20376e-06;
+4,2,5,1,0.1875,0.5,0,0.375,7.09848e-06;
+4,2,5,2,0.1875,0.5,0.125,0.5,1.73545e-05;
+4,2,5,3,0.1875,0.5,0.25,0.625,3.57178e-05;
+4,2,5,4,0.1875,0.5,0.375,0.75,6.74426e-05;
+4,2,5,5,0.1875,0.5,0.5,0.875,0.000119581;
+4,2,5,6,0.1875,0.5,0.625,1,0.000175313;
+4,2,5,7,0.1875,0.5,0.75,1,0.000158819;
+4,2,6,0,0.25,0.5625,0,0.25,1.38218e-06;
+4,2,6,1,0.25,0.5625,0,0.375,8.19061e-06;
+4,2,6,2,0.25,0.5625,0.125,0.5,2.00138e-05;
+4,2,6,3,0.25,0.5625,0.25,0.625,4.11961e-05;
+4,2,6,4,0.25,0.5625,0.375,0.75,7.77836e-05;
+4,2,6,5,0.25,0.5625,0.5,0.875,0.000137916;
+4,2,6,6,0.25,0.5625,0.625,1,0.000202197;
+4,2,6,7,0.25,0.5625,0.75,1,0.000183171;
+4,2,7,0,0.3125,0.625,0,0.25,1.41633e-06;
+4,2,7,1,0.3125,0.625,0,0.375,8.35925e-06;
+4,2,7,2,0.3125,0.625,0.125,0.5,2.04367e-05;
+4,2,7,3,0.3125,0.625,0.25,0.625,4.20593e-05;
+4,2,7,4,0.3125,0.625,0.375,0.75,7.94171e-05;
+4,2,7,5,0.3125,0.625,0.5,0.875,0.000140814;
+4,2,7,6,0.3125,0.625,0.625,1,0.000206443;
+4,2,7,7,0.3125,0.625,0.75,1,0.000187017;
+4,2,8,0,0.375,0.6875,0,0.25,-1.04053e-06;
+4,2,8,1,0.375,0.6875,0,0.375,-6.13414e-06;
+4,2,8,2,0.375,0.6875,0.125,0.5,-1.50048e-05;
+4,2,8,3,0.375,0.6875,0.25,0.625,-3.0863e-05;
+4,2,8,4,0.375,0.6875,0.375,0.75,-5.83042e-05;
+4,2,8,5,0.375,0.6875,0.5,0.875,-0.000103364;
+4,2,8,6,0.375,0.6875,0.625,1,-0.000151516;
+4,2,8,7,0.375,0.6875,0.75,1,-0.000137284;
+4,2,9,0,0.4375,0.75,0,0.25,2.59357e-07;
+4,2,9,1,0.4375,0.75,0,0.375,1.49556e-06;
+4,2,9,2,0.4375,0.75,0.125,0.5,3.65066e-06;
+4,2,9,3,0.4375,0.75,0.25,0.625,7.54748e-06;
+4,2,9,4,0.4375,0.75,0.375,0.75,1.41952e-05;
+4,2,9,5,0.4375,0.75,0.5,0.875,2.5184e-05;
+4,2,9,6,0.4375,0.75,0.625,1,3.69929e-05;
+4,2,9,7,0.4375,0.75,0.75,1,3.34464e-05;
+4,2,10,0,0.5,0.8125,0,0.25,3.48732e-06;
+4,2,10,1,0.5,0.8125,0,0.375,2.04876e-05;
+4,2,10,2,0.5,0.8125,0.125,0.5,5.01008e-05;
+4,2,10,3,0.5,0.8125,0.25,0.625,0.000103224;
+4,2,10,4,0.5,0.8125,0.375,0.75,0.000194867;
+4,2,10,5,0.5,0.8125,0.5,0.875,0.000345462;
+4,2,10,6,0.5,0.8125,0.625,1,0.000506451;
+4,2,10,7,0.5,0.8125,0.75,1,0.000458849;
+4,2,11,0,0.5625,0.875,0,0.25,1.07116e-05;
+4,2,11,1,0.5625,0.875,0,0.375,6.23913e-05;
+4,2,11,2,0.5625,0.875,0.125,0.5,0.000152797;
+4,2,11,3,0.5625,0.875,0.25,0.625,0.000314636;
+4,2,11,4,0.5625,0.875,0.375,0.75,0.000594128;
+4,2,11,5,0.5625,0.875,0.5,0.875,0.00105334;
+4,2,11,6,0.5625,0.875,0.625,1,0.00154397;
+4,2,11,7,0.5625,0.875,0.75,1,0.00139897;
+4,2,12,0,0.625,0.9375,0,0.25,2.57246e-05;
+4,2,12,1,0.625,0.9375,0,0.375,0.000149549;
+4,2,12,2,0.625,0.9375,0.125,0.5,0.000366347;
+4,2,12,3,0.625,0.9375,0.25,0.625,0.000754319;
+4,2,12,4,0.625,0.9375,0.375,0.75,0.00142444;
+4,2,12,5,0.625,0.9375,0.5,0.875,0.00252541;
+4,2,12,6,0.625,0.9375,0.625,1,0.00370167;
+4,2,12,7,0.625,0.9375,0.75,1,0.00335405;
+4,2,13,0,0.6875,1,0,0.25,5.58259e-05;
+4,2,13,1,0.6875,1,0,0.375,0.000324532;
+4,2,13,2,0.6875,1,0.125,0.5,0.000794954;
+4,2,13,3,0.6875,1,0.25,0.625,0.00163684;
+4,2,13,4,0.6875,1,0.375,0.75,0.00309106;
+4,2,13,5,0.6875,1,0.5,0.875,0.00548008;
+4,2,13,6,0.6875,1,0.625,1,0.00803257;
+4,2,13,7,0.6875,1,0.75,1,0.00727823;
+4,2,14,0,0.75,1,0,0.25,0.000119155;
+4,2,14,1,0.75,1,0,0.375,0.000694373;
+4,2,14,2,0.75,1,0.125,0.5,0.0017011;
+4,2,14,3,0.75,1,0.25,0.625,0.00350248;
+4,2,14,4,0.75,1,0.375,0.75,0.00661432;
+4,2,14,5,0.75,1,0.5,0.875,0.011726;
+4,2,14,6,0.75,1,0.625,1,0.0171892;
+4,2,14,7,0.75,1,0.75,1,0.0155278;
+4,2,15,0,0.75,1,0,0.25,-0.000205489;
+4,2,15,1,0.75,1,0,0.375,-0.0012016;
+4,2,15,2,0.75,1,0.125,0.5,-0.0029438;
+4,2,15,3,0.75,1,0.25,0.625,-0.0060611;
+4,2,15,4,0.75,1,0.375,0.75,-0.0114462;
+4,2,15,5,0.75,1,0.5,0.875,-0.0202917;
+4,2,15,6,0.75,1,0.625,1,-0.0297477;
+4,2,15,7,0.75,1,0.75,1,-0.026774;
+4,3,0,6,0,0.25,0.5,1,-6.15714e-07;
+4,3,0,7,0,0.25,0.5,1,2.45008e-06;
+4,3,1,5,0,0.25,0.375,1,1.66616e-07;
+4,3,1,6,0,0.25,0.5,1,1.16818e-06;
+4,3,1,7,0,0.25,0.5,1,-3.92024e-06;
+4,3,2,5,0,0.3125,0.375,1,2.79519e-07;
+4,3,2,6,0,0.3125,0.5,1,1.62674e-06;
+4,3,2,7,0,0.3125,0.5,1,-5.26676e-06;
+4,3,3,5,0.0625,0.375,0.375,1,3.43454e-07;
+4,3,3,6,0.0625,0.375,0.5,1,2.13304e-06;
+4,3,3,7,0.0625,0.375,0.5,1,-6.91613e-06;
+4,3,4,5,0.125,0.4375,0.375,1,4.27118e-07;
+4,3,4,6,0.125,0.4375,0.5,1,2.72075e-06;
+4,3,4,7,0.125,0.4375,0.5,1,-8.825e-06;
+4,3,5,5,0.1875,0.5,0.375,1,5.28723e-07;
+4,3,5,6,0.1875,0.5,0.5,1,3.34216e-06;
+4,3,5,7,0.1875,0.5,0.5,1,-1.083e-05;
+4,3,6,4,0.25,0.5625,0.25,0.875,9.25073e-10;
+4,3,6,5,0.25,0.5625,0.375,1,6.06723e-07;
+4,3,6,6,0.25,0.5625,0.5,1,3.85318e-06;
+4,3,6,7,0.25,0.5625,0.5,1,-1.2491e-05;
+4,3,7,4,0.3125,0.625,0.25,0.875,-5.53044e-09;
+4,3,7,5,0.3125,0.625,0.375,1,6.17205e-07;
+4,3,7,6,0.3125,0.625,0.5,1,3.93426e-06;
+4,3,7,7,0.3125,0.625,0.5,1,-1.27555e-05;
+4,3,8,0,0.375,0.6875,0,0.5,-3.28058e-09;
+4,3,8,5,0.375,0.6875,0.375,1,-5.03745e-07;
+4,3,8,6,0.375,0.6875,0.5,1,-2.89095e-06;
+4,3,8,7,0.375,0.6875,0.5,1,9.37266e-06;
+4,3,9,6,0.4375,0.75,0.5,1,6.23432e-07;
+4,3,9,7,0.4375,0.75,0.5,1,-2.23871e-06;
+4,3,10,1,0.5,0.8125,0,0.5,1.13429e-07;
+4,3,10,2,0.5,0.8125,0,0.625,2.35165e-07;
+4,3,10,3,0.5,0.8125,0.125,0.75,2.6869e-07;
+4,3,10,5,0.5,0.8125,0.375,1,1.57447e-06;
+4,3,10,6,0.5,0.8125,0.5,1,9.55196e-06;
+4,3,10,7,0.5,0.8125,0.5,1,-3.12527e-05;
+4,3,11,0,0.5625,0.875,0,0.5,-1.68e-07;
+4,3,11,1,0.5625,0.875,0,0.5,4.57601e-07;
+4,3,11,2,0.5625,0.875,0,0.625,8.03953e-07;
+4,3,11,3,0.5625,0.875,0.125,0.75,1.03413e-06;
+4,3,11,4,0.5625,0.875,0.25,0.875,-3.54992e-07;
+4,3,11,5,0.5625,0.875,0.375,1,4.80534e-06;
+4,3,11,6,0.5625,0.875,0.5,1,2.92233e-05;
+4,3,11,7,0.5625,0.875,0.5,1,-9.5345e-05;
+4,3,12,0,0.625,0.9375,0,0.5,-4.82948e-07;
+4,3,12,1,0.625,0.9375,0,0.5,1.14e-06;
+4,3,12,2,0.625,0.9375,0,0.625,1.98174e-06;
+4,3,12,3,0.625,0.9375,0.125,0.75,2.58177e-06;
+4,3,12,4,0.625,0.9375,0.25,0.875,-9.74787e-07;
+4,3,12,5,0.625,0.9375,0.375,1,1.14718e-05;
+4,3,12,6,0.625,0.9375,0.5,1,7.00607e-05;
+4,3,12,7,0.625,0.9375,0.5,1,-0.000228597;
+4,3,13,0,0.6875,1,0,0.5,-1.08101e-06;
+4,3,13,1,0.6875,1,0,0.5,2.47492e-06;
+4,3,13,2,0.6875,1,0,0.625,4.24937e-06;
+4,3,13,3,0.6875,1,0.125,0.75,5.60309e-06;
+4,3,13,4,0.6875,1,0.25,0.875,-2.15455e-06;
+4,3,13,5,0.6875,1,0.375,1,2.49026e-05;
+4,3,13,6,0.6875,1,0.5,1,0.000152039;
+4,3,13,7,0.6875,1,0.5,1,-0.000496078;
+4,3,14,0,0.75,1,0,0.5,-2.38579e-06;
+4,3,14,1,0.75,1,0,0.5,5.25925e-06;
+4,3,14,2,0.75,1,0,0.625,9.00727e-06;
+4,3,14,3,0.75,1,0.125,0.75,1.18263e-05;
+4,3,14,4,0.75,1,0.25,0.875,-4.56547e-06;
+4,3,14,5,0.75,1,0.375,1,5.26557e-05;
+4,3,14,6,0.75,1,0.5,1,0.000319264;
+4,3,14,7,0.75,1,0.5,1,-0.00103754;
+4,3,15,0,0.75,1,0,0.5,4.07124e-06;
+4,3,15,1,0.75,1,0,0.5,-8.93063e-06;
+4,3,15,2,0.75,1,0,0.625,-1.53472e-05;
+4,3,15,3,0.75,1,0.125,0.75,-2.01278e-05;
+4,3,15,4,0.75,1,0.25,0.875,7.76538e-06;
+4,3,15,5,0.75,1,0.375,1,-8.96766e-05;
+4,3,15,6,0.75,1,0.5,1,-0.000540222;
+4,3,15,7,0.75,1,0.5,1,0.00174634;
+2,5,0,5,0,0.25,0.09375,0.25,4.40147e-08;
+2,5,0,7,0,0.25,0.15625,0.3125,1.01111e-07;
+2,5,0,8,0,0.25,0.1875,0.34375,1.54869e-07;
+2,5,0,9,0,0.25,0.21875,0.375,1.76322e-07;
+2,5,0,10,0,0.25,0.25,0.40625,1.95566e-07;
+2,5,0,11,0,0.25,0.28125,0.4375,2.13843e-07;
+2,5,0,12,0,0.25,0.3125,0.46875,2.282e-07;
+2,5,0,13,0,0.25,0.34375,0.5,2.41167e-07;
+2,5,0,14,0,0.25,0.375,0.53125,2.44058e-07;
+2,5,0,15,0,0.25,0.40625,0.5625,2.30755e-07;
+2,5,0,16,0,0.25,0.4375,0.59375,-1.57388e-07;
+2,5,0,19,0,0.25,0.53125,0.6875,1.39499e-07;
+2,5,0,20,0,0.25,0.5625,0.71875,4.11838e-07;
+2,5,0,21,0,0.25,0.59375,0.75,8.20503e-07;
+2,5,0,22,0,0.25,0.625,0.78125,1.42152e-06;
+2,5,0,23,0,0.25,0.65625,0.8125,2.2936e-06;
+2,5,0,24,0,0.25,0.6875,0.84375,3.53031e-06;
+2,5,0,25,0,0.25,0.71875,0.875,5.34077e-06;
+2,5,0,26,0,0.25,0.75,0.90625,7.89275e-06;
+2,5,0,27,0,0.25,0.78125,0.9375,1.15333e-05;
+2,5,0,28,0,0.25,0.8125,0.96875,1.65714e-05;
+2,5,0,29,0,0.25,0.84375,1,2.35642e-05;
+2,5,0,30,0,0.25,0.875,1,3.31289e-05;
+2,5,0,31,0,0.25,0.875,1,-3.88265e-05;
+2,5,1,0,0,0.375,0,0.125,-2.91628e-07;
+2,5,1,1,0,0.375,0,0.125,4.06781e-07;
+2,5,1,2,0,0.375,0,0.15625,4.7176e-07;
+2,5,1,3,0,0.375,0.03125,0.1875,5.43622e-07;
+2,5,1,4,0,0.375,0.0625,0.21875,6.26372e-07;
+2,5,1,5,0,0.375,0.09375,0.25,6.92844e-07;
+2,5,1,6,0,0.375,0.125,0.28125,8.18746e-07;
+2,5,1,7,0,0.375,0.15625,0.3125,8.7108e-07;
+2,5,1,8,0,0.375,0.1875,0.34375,9.58683e-07;
+2,5,1,9,0,0.375,0.21875,0.375,1.07108e-06;
+2,5,1,10,0,0.375,0.25,0.40625,1.18659e-06;
+2,5,1,11,0,0.375,0.28125,0.4375,1.29772e-06;
+2,5,1,12,0,0.375,0.3125,0.46875,1.3958e-06;
+2,5,1,13,0,0.375,0.34375,0.5,1.46348e-06;
+2,5,1,14,0,0.375,0.375,0.53125,1.48251e-06;
+2,5,1,15,0,0.375,0.40625,0.5625,1.42254e-06;
+2,5,1,16,0,0.375,0.4375,0.59375,-1.26043e-06;
+2,5,1,17,0,0.375,0.46875,0.625,-9.39804e-07;
+2,5,1,18,0,0.375,0.5,0.65625,-2.24797e-07;
+2,5,1,19,0,0.375,0.53125,0.6875,8.50508e-07;
+2,5,1,20,0,0.375,0.5625,0.71875,2.47887e-06;
+2,5,1,21,0,0.375,0.59375,0.75,4.92845e-06;
+2,5,1,22,0,0.375,0.625,0.78125,8.5395e-06;
+2,5,1,23,0,0.375,0.65625,0.8125,1.37802e-05;
+2,5,1,24,0,0.375,0.6875,0.84375,2.13337e-05;
+2,5,1,25,0,0.375,0.71875,0.875,3.20213e-05;
+2,5,1,26,0,0.375,0.75,0.90625,4.70532e-05;
+2,5,1,27,0,0.375,0.78125,0.9375,6.81514e-05;
+2,5,1,28,0,0.375,0.8125,0.96875,9.77174e-05;
+2,5,1,29,0,0.375,0.84375,1,0.000138938;
+2,5,1,30,0,0.375,0.875,1,0.000195484;
+2,5,1,31,0,0.375,0.875,1,-0.000229318;
+2,5,2,0,0.125,0.5,0,0.125,-6.42202e-07;
+2,5,2,1,0.125,0.5,0,0.125,8.96218e-07;
+2,5,2,2,0.125,0.5,0,0.15625,1.03925e-06;
+2,5,2,3,0.125,0.5,0.03125,0.1875,1.19732e-06;
+2,5,2,4,0.125,0.5,0.0625,0.21875,1.37043e-06;
+2,5,2,5,0.125,0.5,0.09375,0.25,1.5781e-06;
+2,5,2,6,0.125,0.5,0.125,0.28125,1.78754e-06;
+2,5,2,7,0.125,0.5,0.15625,0.3125,2.05343e-06;
+2,5,2,8,0.125,0.5,0.1875,0.34375,2.32613e-06;
+2,5,2,9,0.125,0.5,0.21875,0.375,2.60379e-06;
+2,5,2,10,0.125,0.5,0.25,0.40625,2.88495e-06;
+2,5,2,11,0.125,0.5,0.28125,0.4375,3.15522e-06;
+2,5,2,12,0.125,0.5,0.3125,0.46875,3.39141e-06;
+2,5,2,13,0.125,0.5,0.34375,0.5,3.55819e-06;
+2,5,2,14,0.125,0.5,0.375,0.53125,3.60406e-06;
+2,5,2,15,0.125,0.5,0.40625,0.5625,3.4531e-06;
+2,5,2,16,0.125,0.5,0.4375,0.59375,-2.98812e-06;
+2,5,2,17,0.125,0.5,0.46875,0.625,-2.05342e-06;
+2,5,2,18,0.125,0.5,0.5,0.65625,-4.94624e-07;
+2,5,2,19,0.125,0.5,0.53125,0.6875,2.06538e-06;
+2,5,2,20,0.125,0.5,0.5625,0.71875,6.0523e-06;
+2,5,2,21,0.125,0.5,0.59375,0.75,1.20455e-05;
+2,5,2,22,0.125,0.5,0.625,0.78125,2.08702e-05;
+2,5,2,23,0.125,0.5,0.65625,0.8125,3.36777e-05;
+2,5,2,24,0.125,0.5,0.6875,0.84375,5.20175e-05;
+2,5,2,25,0.125,0.5,0.71875,0.875,7.80995e-05;
+2,5,2,26,0.125,0.5,0.75,0.90625,0.000115029;
+2,5,2,27,0.125,0.5,0.78125,0.9375,0.000166893;
+2,5,2,28,0.125,0.5,0.8125,0.96875,0.000239376;
+2,5,2,29,0.125,0.5,0.84375,1,0.000340358;
+2,5,2,30,0.125,0.5,0.875,1,0.00047888;
+2,5,2,31,0.125,0.5,0.875,1,-0.000561764;
+2,5,3,0,0.25,0.625,0,0.125,-1.34113e-06;
+2,5,3,1,0.25,0.625,0,0.125,1.87127e-06;
+2,5,3,2,0.25,0.625,0,0.15625,2.17015e-06;
+2,5,3,3,0.25,0.625,0.03125,0.1875,2.50028e-06;
+2,5,3,4,0.25,0.625,0.0625,0.21875,2.88554e-06;
+2,5,3,5,0.25,0.625,0.09375,0.25,3.30451e-06;
+2,5,3,6,0.25,0.625,0.125,0.28125,3.7743e-06;
+2,5,3,7,0.25,0.625,0.15625,0.3125,4.2725e-06;
+2,5,3,8,0.25,0.625,0.1875,0.34375,4.8141e-06;
+2,5,3,9,0.25,0.625,0.21875,0.375,5.38685e-06;
+2,5,3,10,0.25,0.625,0.25,0.40625,5.96841e-06;
+2,5,3,11,0.25,0.625,0.28125,0.4375,6.52749e-06;
+2,5,3,12,0.25,0.625,0.3125,0.46875,7.01563e-06;
+2,5,3,13,0.25,0.625,0.34375,0.5,7.36114e-06;
+2,5,3,14,0.25,0.625,0.375,0.53125,7.4562e-06;
+2,5,3,15,0.25,0.625,0.40625,0.5625,7.14583e-06;
+2,5,3,16,0.25,0.625,0.4375,0.59375,-6.21056e-06;
+2,5,3,17,0.25,0.625,0.46875,0.625,-4.33181e-06;
+2,5,3,18,0.25,0.625,0.5,0.65625,-1.03324e-06;
+2,5,3,19,0.25,0.625,0.53125,0.6875,4.27703e-06;
+2,5,3,20,0.25,0.625,0.5625,0.71875,1.24681e-05;
+2,5,3,21,0.25,0.625,0.59375,0.75,2.47894e-05;
+2,5,3,22,0.25,0.625,0.625,0.78125,4.29524e-05;
+2,5,3,23,0.25,0.625,0.65625,0.8125,6.93111e-05;
+2,5,3,24,0.25,0.625,0.6875,0.84375,0.000107124;
+2,5,3,25,0.25,0.625,0.71875,0.875,0.000160942;
+2,5,3,26,0.25,0.625,0.75,0.90625,0.000236925;
+2,5,3,27,0.25,0.625,0.78125,0.9375,0.000343642;
+2,5,3,28,0.25,0.625,0.8125,0.96875,0.000492864;
+2,5,3,29,0.25,0.625,0.84375,1,0.000700781;
+2,5,3,30,0.25,0.625,0.875,1,0.000985992;
+2,5,3,31,0.25,0.625,0.875,1,-0.00115665;
+2,5,4,0,0.375,0.75,0,0.125,-2.54561e-06;
+2,5,4,1,0.375,0.75,0,0.125,3.55195e-06;
+2,5,4,2,0.375,0.75,0,0.15625,4.11907e-06;
+2,5,4,3,0.375,0.75,0.03125,0.1875,4.74577e-06;
+2,5,4,4,0.375,0.75,0.0625,0.21875,5.42241e-06;
+2,5,4,5,0.375,0.75,0.09375,0.25,6.2003e-06;
+2,5,4,6,0.375,0.75,0.125,0.28125,7.06837e-06;
+2,5,4,7,0.375,0.75,0.15625,0.3125,8.02594e-06;
+2,5,4,8,0.375,0.75,0.1875,0.34375,9.05364e-06;
+2,5,4,9,0.375,0.75,0.21875,0.375,1.01317e-05;
+2,5,4,10,0.375,0.75,0.25,0.40625,1.12255e-05;
+2,5,4,11,0.375,0.75,0.28125,0.4375,1.2277e-05;
+2,5,4,12,0.375,0.75,0.3125,0.46875,1.31958e-05;
+2,5,4,13,0.375,0.75,0.34375,0.5,1.3845e-05;
+2,5,4,14,0.375,0.75,0.375,0.53125,1.40238e-05;
+2,5,4,15,0.375,0.75,0.40625,0.5625,1.34392e-05;
+2,5,4,16,0.375,0.75,0.4375,0.59375,-1.16697e-05;
+2,5,4,17,0.375,0.75,0.46875,0.625,-8.12104e-06;
+2,5,4,18,0.375,0.75,0.5,0.65625,-1.96101e-06;
+2,5,4,19,0.375,0.75,0.53125,0.6875,8.03532e-06;
+2,5,4,20,0.375,0.75,0.5625,0.71875,2.35247e-05;
+2,5,4,21,0.375,0.75,0.59375,0.75,4.68082e-05;
+2,5,4,22,0.375,0.75,0.625,0.78125,8.11017e-05;
+2,5,4,23,0.375,0.75,0.65625,0.8125,0.000130872;
+2,5,4,24,0.375,0.75,0.6875,0.84375,0.000202334;
+2,5,4,25,0.375,0.75,0.71875,0.875,0.000303931;
+2,5,4,26,0.375,0.75,0.75,0.90625,0.000447417;
+2,5,4,27,0.375,0.75,0.78125,0.9375,0.000648954;
+2,5,4,28,0.375,0.75,0.8125,0.96875,0.000930756;
+2,5,4,29,0.375,0.75,0.84375,1,0.0013234;
+2,5,4,30,0.375,0.75,0.875,1,0.00186201;
+2,5,4,31,0.375,0.75,0.875,1,-0.00218428;
+2,5,5,0,0.5,0.875,0,0.125,-4.45158e-06;
+2,5,5,1,0.5,0.875,0,0.125,6.21159e-06;
+2,5,5,2,0.5,0.875,0,0.15625,7.20328e-06;
+2,5,5,3,0.5,0.875,0.03125,0.1875,8.2992e-06;
+2,5,5,4,0.5,0.875,0.0625,0.21875,9.58665e-06;
+2,5,5,5,0.5,0.875,0.09375,0.25,1.09959e-05;
+2,5,5,6,0.5,0.875,0.125,0.28125,1.25432e-05;
+2,5,5,7,0.5,0.875,0.15625,0.3125,1.42321e-05;
+2,5,5,8,0.5,0.875,0.1875,0.34375,1.60502e-05;
+2,5,5,9,0.5,0.875,0.21875,0.375,1.79607e-05;
+2,5,5,10,0.5,0.875,0.25,0.40625,1.98998e-05;
+2,5,5,11,0.5,0.875,0.28125,0.4375,2.17639e-05;
+2,5,5,12,0.5,0.875,0.3125,0.46875,2.33923e-05;
+2,5,5,13,0.5,0.875,0.34375,0.5,2.45435e-05;
+2,5,5,14,0.5,0.875,0.375,0.53125,2.48604e-05;
+2,5,5,15,0.5,0.875,0.40625,0.5625,2.38244e-05;
+2,5,5,16,0.5,0.875,0.4375,0.59375,-2.06913e-05;
+2,5,5,17,0.5,0.875,0.46875,0.625,-1.43949e-05;
+2,5,5,18,0.5,0.875,0.5,0.65625,-3.42932e-06;
+2,5,5,19,0.5,0.875,0.53125,0.6875,1.42617e-05;
+2,5,5,20,0.5,0.875,0.5625,0.71875,4.16991e-05;
+2,5,5,21,0.5,0.875,0.59375,0.75,8.2966e-05;
+2,5,5,22,0.5,0.875,0.625,0.78125,0.00014375;
+2,5,5,23,0.5,0.875,0.65625,0.8125,0.000231966;
+2,5,5,24,0.5,0.875,0.6875,0.84375,0.000358513;
+2,5,5,25,0.5,0.875,0.71875,0.875,0.000538528;
+2,5,5,26,0.5,0.875,0.75,0.90625,0.000792782;
+2,5,5,27,0.5,0.875,0.78125,0.9375,0.00114989;
+2,5,5,28,0.5,0.875,0.8125,0.96875,0.00164922;
+2,5,5,29,0.5,0.875,0.84375,1,0.00234495;
+2,5,5,30,0.5,0.875,0.875,1,0.00329932;
+2,5,5,31,0.5,0.875,0.875,1,-0.00387036;
+2,5,6,0,0.625,1,0,0.125,-6.63199e-06;
+2,5,6,1,0.625,1,0,0.125,9.2537e-06;
+2,5,6,2,0.625,1,0,0.15625,1.07314e-05;
+2,5,6,3,0.625,1,0.03125,0.1875,1.23638e-05;
+2,5,6,4,0.625,1,0.0625,0.21875,1.4153e-05;
+2,5,6,5,0.625,1,0.09375,0.25,1.61882e-05;
+2,5,6,6,0.625,1,0.125,0.28125,1.84606e-05;
+2,5,6,7,0.625,1,0.15625,0.3125,2.09504e-05;
+2,5,6,8,0.625,1,0.1875,0.34375,2.36284e-05;
+2,5,6,9,0.625,1,0.21875,0.375,2.64413e-05;
+2,5,6,10,0.625,1,0.25,0.40625,2.9296e-05;
+2,5,6,11,0.625,1,0.28125,0.4375,3.20402e-05;
+2,5,6,12,0.625,1,0.3125,0.46875,3.44376e-05;
+2,5,6,13,0.625,1,0.34375,0.5,3.61322e-05;
+2,5,6,14,0.625,1,0.375,0.53125,3.65987e-05;
+2,5,6,15,0.625,1,0.40625,0.5625,3.50735e-05;
+2,5,6,16,0.625,1,0.4375,0.59375,-3.04605e-05;
+2,5,6,17,0.625,1,0.46875,0.625,-2.12055e-05;
+2,5,6,18,0.625,1,0.5,0.65625,-5.10885e-06;
+2,5,6,19,0.625,1,0.53125,0.6875,2.09748e-05;
+2,5,6,20,0.625,1,0.5625,0.71875,6.12637e-05;
+2,5,6,21,0.625,1,0.59375,0.75,0.000121839;
+2,5,6,22,0.625,1,0.625,0.78125,0.000211107;
+2,5,6,23,0.625,1,0.65625,0.8125,0.000340657;
+2,5,6,24,0.625,1,0.6875,0.84375,0.000526544;
+2,5,6,25,0.625,1,0.71875,0.875,0.000790924;
+2,5,6,26,0.625,1,0.75,0.90625,0.00116433;
+2,5,6,27,0.625,1,0.78125,0.9375,0.00168881;
+2,5,6,28,0.625,1,0.8125,0.96875,0.00242215;
+2,5,6,29,0.625,1,0.84375,1,0.00344396;
+2,5,6,30,0.625,1,0.875,1,0.0048456;
+2,5,6,31,0.625,1,0.875,1,-0.0056843;
+2,5,7,0,0.75,1,0,0.125,-5.83162e-06;
+2,5,7,1,0.75,1,0,0.125,8.14475e-06;
+2,5,7,2,0.75,1,0,0.15625,9.45239e-06;
+2,5,7,3,0.75,1,0.03125,0.1875,1.08908e-05;
+2,5,7,4,0.75,1,0.0625,0.21875,1.25429e-05;
+2,5,7,5,0.75,1,0.09375,0.25,1.43744e-05;
+2,5,7,6,0.75,1,0.125,0.28125,1.63951e-05;
+2,5,7,7,0.75,1,0.15625,0.3125,1.86051e-05;
+2,5,7,8,0.75,1,0.1875,0.34375,2.09827e-05;
+2,5,7,9,0.75,1,0.21875,0.375,2.34807e-05;
+2,5,7,10,0.75,1,0.25,0.40625,2.60156e-05;
+2,5,7,11,0.75,1,0.28125,0.4375,2.84525e-05;
+2,5,7,12,0.75,1,0.3125,0.46875,3.05816e-05;
+2,5,7,13,0.75,1,0.34375,0.5,3.20865e-05;
+2,5,7,14,0.75,1,0.375,0.53125,3.25007e-05;
+2,5,7,15,0.75,1,0.40625,0.5625,3.11462e-05;
+2,5,7,16,0.75,1,0.4375,0.59375,-2.70494e-05;
+2,5,7,17,0.75,1,0.46875,0.625,-1.88209e-05;
+2,5,7,18,0.75,1,0.5,0.65625,-4.50005e-06;
+2,5,7,19,0.75,1,0.53125,0.6875,1.86389e-05;
+2,5,7,20,0.75,1,0.5625,0.71875,5.45115e-05;
+2,5,7,21,0.75,1,0.59375,0.75,0.000108456;
+2,5,7,22,0.75,1,0.625,0.78125,0.000187917;
+2,5,7,23,0.75,1,0.65625,0.8125,0.000303235;
+2,5,7,24,0.75,1,0.6875,0.84375,0.000468708;
+2,5,7,25,0.75,1,0.71875,0.875,0.00070404;
+2,5,7,26,0.75,1,0.75,0.90625,0.00103643;
+2,5,7,27,0.75,1,0.78125,0.9375,0.00150329;
+2,5,7,28,0.75,1,0.8125,0.96875,0.00215608;
+2,5,7,29,0.75,1,0.84375,1,0.00306562;
+2,5,7,30,0.75,1,0.875,1,0.00430998;
+2,5,7,31,0.75,1,0.875,1,-0.00505116;
+3,5,0,12,0,0.5,0.3125,0.46875,3.19299e-09;
+3,5,0,27,0,0.5,0.78125,0.9375,-1.58829e-07;
+3,5,0,28,0,0.5,0.8125,0.96875,-2.8618e-07;
+3,5,0,29,0,0.5,0.84375,1,-4.11494e-07;
+3,5,0,30,0,0.5,0.875,1,-5.75464e-07;
+3,5,0,31,0,0.5,0.875,1,6.70068e-07;
+3,5,1,26,0,0.5,0.75,0.90625,2.00529e-07;
+3,5,1,27,0,0.5,0.78125,0.9375,4.49775e-07;
+3,5,1,28,0,0.5,0.8125,0.96875,6.82959e-07;
+3,5,1,29,0,0.5,0.84375,1,9.74001e-07;
+3,5,1,30,0,0.5,0.875,1,1.36417e-06;
+3,5,1,31,0,0.5,0.875,1,-1.59081e-06;
+3,5,2,25,0,0.625,0.71875,0.875,2.13439e-07;
+3,5,2,26,0,0.625,0.75,0.90625,5.21378e-07;
+3,5,2,27,0,0.625,0.78125,0.9375,8.28214e-07;
+3,5,2,28,0,0.625,0.8125,0.96875,1.19934e-06;
+3,5,2,29,0,0.625,0.84375,1,1.70598e-06;
+3,5,2,30,0,0.625,0.875,1,2.39093e-06;
+3,5,2,31,0,0.625,0.875,1,-2.79113e-06;
+3,5,3,24,0.125,0.75,0.6875,0.84375,1.32661e-07;
+3,5,3,25,0.125,0.75,0.71875,0.875,4.36271e-07;
+3,5,3,26,0.125,0.75,0.75,0.90625,7.4064e-07;
+3,5,3,27,0.125,0.75,0.78125,0.9375,1.09283e-06;
+3,5,3,28,0.125,0.75,0.8125,0.96875,1.56984e-06;
+3,5,3,29,0.125,0.75,0.84375,1,2.23238e-06;
+3,5,3,30,0.125,0.75,0.875,1,3.12834e-06;
+3,5,3,31,0.125,0.75,0.875,1,-3.65229e-06;
+3,5,4,25,0.25,0.875,0.71875,0.875,-1.47877e-07;
+3,5,4,26,0.25,0.875,0.75,0.90625,-2.74447e-07;
+3,5,4,27,0.25,0.875,0.78125,0.9375,-4.04805e-07;
+3,5,4,28,0.25,0.875,0.8125,0.96875,-5.80949e-07;
+3,5,4,29,0.25,0.875,0.84375,1,-8.26311e-07;
+3,5,4,30,0.25,0.875,0.875,1,-1.15753e-06;
+3,5,4,31,0.25,0.875,0.875,1,1.35265e-06;
+3,5,5,20,0.375,1,0.5625,0.71875,1.49315e-07;
+3,5,5,21,0.375,1,0.59375,0.75,3.65379e-07;
+3,5,5,22,0.375,1,0.625,0.78125,6.27682e-07;
+3,5,5,23,0.375,1,0.65625,0.8125,1.01368e-06;
+3,5,5,24,0.375,1,0.6875,0.84375,1.60434e-06;
+3,5,5,25,0.375,1,0.71875,0.875,2.35676e-06;
+3,5,5,26,0.375,1,0.75,0.90625,3.44627e-06;
+3,5,5,27,0.375,1,0.78125,0.9375,4.99583e-06;
+3,5,5,28,0.375,1,0.8125,0.96875,7.16552e-06;
+3,5,5,29,0.375,1,0.84375,1,1.01874e-05;
+3,5,5,30,0.375,1,0.875,1,1.42786e-05;
+3,5,5,31,0.375,1,0.875,1,-1.66633e-05;
+3,5,6,4,0.5,1,0.0625,0.21875,1.51338e-07;
+3,5,6,5,0.5,1,0.09375,0.25,2.28104e-07;
+3,5,6,6,0.5,1,0.125,0.28125,2.64722e-07;
+3,5,6,7,0.5,1,0.15625,0.3125,3.00158e-07;
+3,5,6,8,0.5,1,0.1875,0.34375,3.37768e-07;
+3,5,6,9,0.5,1,0.21875,0.375,3.78278e-07;
+3,5,6,10,0.5,1,0.25,0.40625,4.18854e-07;
+3,5,6,11,0.5,1,0.28125,0.4375,4.58191e-07;
+3,5,6,12,0.5,1,0.3125,0.46875,4.92398e-07;
+3,5,6,13,0.5,1,0.34375,0.5,5.16841e-07;
+3,5,6,14,0.5,1,0.375,0.53125,5.2342e-07;
+3,5,6,15,0.5,1,0.40625,0.5625,5.01283e-07;
+3,5,6,16,0.5,1,0.4375,0.59375,-4.34319e-07;
+3,5,6,17,0.5,1,0.46875,0.625,-2.80628e-07;
+3,5,6,19,0.5,1,0.53125,0.6875,3.24805e-07;
+3,5,6,20,0.5,1,0.5625,0.71875,9.6847e-07;
+3,5,6,21,0.5,1,0.59375,0.75,1.9649e-06;
+3,5,6,22,0.5,1,0.625,0.78125,3.40115e-06;
+3,5,6,23,0.5,1,0.65625,0.8125,5.48852e-06;
+3,5,6,24,0.5,1,0.6875,0.84375,8.49151e-06;
+3,5,6,25,0.5,1,0.71875,0.875,1.27446e-05;
+3,5,6,26,0.5,1,0.75,0.90625,1.87588e-05;
+3,5,6,27,0.5,1,0.78125,0.9375,2.72064e-05;
+3,5,6,28,0.5,1,0.8125,0.96875,3.90236e-05;
+3,5,6,29,0.5,1,0.84375,1,5.54807e-05;
+3,5,6,30,0.5,1,0.875,1,7.76963e-05;
+3,5,6,31,0.5,1,0.875,1,-9.05941e-05;
+3,5,7,0,0.5,1,0,0.125,2.78571e-07;
+3,5,7,1,0.5,1,0,0.125,-3.91659e-07;
+3,5,7,2,0.5,1,0,0.15625,-4.56949e-07;
+3,5,7,3,0.5,1,0.03125,0.1875,-5.27327e-07;
+3,5,7,4,0.5,1,0.0625,0.21875,-6.90578e-07;
+3,5,7,5,0.5,1,0.09375,0.25,-8.22268e-07;
+3,5,7,6,0.5,1,0.125,0.28125,-9.40555e-07;
+3,5,7,7,0.5,1,0.15625,0.3125,-1.06766e-06;
+3,5,7,8,0.5,1,0.1875,0.34375,-1.20339e-06;
+3,5,7,9,0.5,1,0.21875,0.375,-1.34722e-06;
+3,5,7,10,0.5,1,0.25,0.40625,-1.49234e-06;
+3,5,7,11,0.5,1,0.28125,0.4375,-1.63225e-06;
+3,5,7,12,0.5,1,0.3125,0.46875,-1.75435e-06;
+3,5,7,13,0.5,1,0.34375,0.5,-1.84078e-06;
+3,5,7,14,0.5,1,0.375,0.53125,-1.86448e-06;
+3,5,7,15,0.5,1,0.40625,0.5625,-1.78661e-06;
+3,5,7,16,0.5,1,0.4375,0.59375,1.55079e-06;
+3,5,7,17,0.5,1,0.46875,0.625,1.0666e-06;
+3,5,7,18,0.5,1,0.5,0.65625,2.18013e-07;
+3,5,7,19,0.5,1,0.53125,0.6875,-1.0831e-06;
+3,5,7,20,0.5,1,0.5625,0.71875,-3.14184e-06;
+3,5,7,21,0.5,1,0.59375,0.75,-6.255e-06;
+3,5,7,22,0.5,1,0.625,0.78125,-1.08383e-05;
+3,5,7,23,0.5,1,0.65625,0.8125,-1.7488e-05;
+3,5,7,24,0.5,1,0.6875,0.84375,-2.70343e-05;
+3,5,7,25,0.5,1,0.71875,0.875,-4.06027e-05;
+3,5,7,26,0.5,1,0.75,0.90625,-5.97769e-05;
+3,5,7,27,0.5,1,0.78125,0.9375,-8.66971e-05;
+3,5,7,28,0.5,1,0.8125,0.96875,-0.000124354;
+3,5,7,29,0.5,1,0.84375,1,-0.000176796;
+3,5,7,30,0.5,1,0.875,1,-0.000247224;
+3,5,7,31,0.5,1,0.875,1,0.000287755;
+4,4,0,15,0,0.25,0.75,1,2.57312e-07;
+4,4,1,14,0,0.25,0.75,1,2.14811e-07;
+4,4,1,15,0,0.25,0.75,1,-5.38194e-07;
+4,4,2,12,0,0.3125,0.625,0.9375,-2.32879e-08;
+4,4,2,14,0,0.3125,0.75,1,3.96194e-07;
+4,4,2,15,0,0.3125,0.75,1,-7.95189e-07;
+4,4,3,13,0.0625,0.375,0.6875,1,1.90368e-07;
+4,4,3,14,0.0625,0.375,0.75,1,6.15141e-07;
+4,4,3,15,0.0625,0.375,0.75,1,-1.05028e-06;
+4,4,4,13,0.125,0.4375,0.6875,1,3.2729e-07;
+4,4,4,14,0.125,0.4375,0.75,1,8.28948e-07;
+4,4,4,15,0.125,0.4375,0.75,1,-1.34191e-06;
+4,4,5,13,0.1875,0.5,0.6875,1,4.11784e-07;
+4,4,5,14,0.1875,0.5,0.75,1,1.02329e-06;
+4,4,5,15,0.1875,0.5,0.75,1,-1.64725e-06;
+4,4,6,13,0.25,0.5625,0.6875,1,4.76214e-07;
+4,4,6,14,0.25,0.5625,0.75,1,1.18134e-06;
+4,4,6,15,0.25,0.5625,0.75,1,-1.90012e-06;
+4,4,7,13,0.3125,0.625,0.6875,1,4.93732e-07;
+4,4,7,14,0.3125,0.625,0.75,1,1.21037e-06;
+4,4,7,15,0.3125,0.625,0.75,1,-1.94078e-06;
+4,4,8,12,0.375,0.6875,0.625,0.9375,-1.08396e-07;
+4,4,8,13,0.375,0.6875,0.6875,1,-4.52677e-07;
+4,4,8,14,0.375,0.6875,0.75,1,-9.17283e-07;
+4,4,8,15,0.375,0.6875,0.75,1,1.42814e-06;
+4,4,9,14,0.4375,0.75,0.75,1,1.62067e-07;
+4,4,9,15,0.4375,0.75,0.75,1,-3.40804e-07;
+4,4,10,10,0.5,0.8125,0.5,0.8125,1.11702e-07;
+4,4,10,11,0.5,0.8125,0.5625,0.875,2.69386e-07;
+4,4,10,12,0.5,0.8125,0.625,0.9375,6.68487e-07;
+4,4,10,13,0.5,0.8125,0.6875,1,1.46964e-06;
+4,4,10,14,0.5,0.8125,0.75,1,2.9763e-06;
+4,4,10,15,0.5,0.8125,0.75,1,-4.76039e-06;
+4,4,11,10,0.5625,0.875,0.5,0.8125,2.69365e-07;
+4,4,11,11,0.5625,0.875,0.5625,0.875,8.77597e-07;
+4,4,11,12,0.5625,0.875,0.625,0.9375,2.13085e-06;
+4,4,11,13,0.5625,0.875,0.6875,1,4.63145e-06;
+4,4,11,14,0.5625,0.875,0.75,1,9.15159e-06;
+4,4,11,15,0.5625,0.875,0.75,1,-1.45245e-05;
+4,4,12,8,0.625,0.9375,0.375,0.6875,-1.08139e-07;
+4,4,12,10,0.625,0.9375,0.5,0.8125,6.68455e-07;
+4,4,12,11,0.625,0.9375,0.5625,0.875,2.13085e-06;
+4,4,12,12,0.625,0.9375,0.625,0.9375,5.1209e-06;
+4,4,12,13,0.625,0.9375,0.6875,1,1.11212e-05;
+4,4,12,14,0.625,0.9375,0.75,1,2.19534e-05;
+4,4,12,15,0.625,0.9375,0.75,1,-3.48295e-05;
+4,4,13,4,0.6875,1,0.125,0.4375,2.32683e-07;
+4,4,13,5,0.6875,1,0.1875,0.5,4.00534e-07;
+4,4,13,6,0.6875,1,0.25,0.5625,4.74862e-07;
+4,4,13,7,0.6875,1,0.3125,0.625,4.93426e-07;
+4,4,13,8,0.6875,1,0.375,0.6875,-4.52508e-07;
+4,4,13,10,0.6875,1,0.5,0.8125,1.46963e-06;
+4,4,13,11,0.6875,1,0.5625,0.875,4.63145e-06;
+4,4,13,12,0.6875,1,0.625,0.9375,1.11212e-05;
+4,4,13,13,0.6875,1,0.6875,1,2.41496e-05;
+4,4,13,14,0.6875,1,0.75,1,4.7668e-05;
+4,4,13,15,0.6875,1,0.75,1,-7.56254e-05;
+4,4,14,0,0.75,1,0,0.25,-1.57147e-07;
+4,4,14,1,0.75,1,0,0.25,2.82307e-07;
+4,4,14,2,0.75,1,0,0.3125,3.96148e-07;
+4,4,14,3,0.75,1,0.0625,0.375,5.21011e-07;
+4,4,14,4,0.75,1,0.125,0.4375,7.78459e-07;
+4,4,14,5,0.75,1,0.1875,0.5,1.01617e-06;
+4,4,14,6,0.75,1,0.25,0.5625,1.18044e-06;
+4,4,14,7,0.75,1,0.3125,0.625,1.21024e-06;
+4,4,14,8,0.75,1,0.375,0.6875,-9.17251e-07;
+4,4,14,9,0.75,1,0.4375,0.75,1.62067e-07;
+4,4,14,10,0.75,1,0.5,0.8125,2.97629e-06;
+4,4,14,11,0.75,1,0.5625,0.875,9.15159e-06;
+4,4,14,12,0.75,1,0.625,0.9375,2.19534e-05;
+4,4,14,13,0.75,1,0.6875,1,4.7668e-05;
+4,4,14,14,0.75,1,0.75,1,9.37491e-05;
+4,4,14,15,0.75,1,0.75,1,-0.000147924;
+4,4,15,0,0.75,1,0,0.25,3.31692e-07;
+4,4,15,1,0.75,1,0,0.25,-5.72808e-07;
+4,4,15,2,0.75,1,0,0.3125,-7.98525e-07;
+4,4,15,3,0.75,1,0.0625,0.375,-1.04031e-06;
+4,4,15,4,0.75,1,0.125,0.4375,-1.33559e-06;
+4,4,15,5,0.75,1,0.1875,0.5,-1.64604e-06;
+4,4,15,6,0.75,1,0.25,0.5625,-1.89994e-06;
+4,4,15,7,0.75,1,0.3125,0.625,-1.94075e-06;
+4,4,15,8,0.75,1,0.375,0.6875,1.42813e-06;
+4,4,15,9,0.75,1,0.4375,0.75,-3.40805e-07;
+4,4,15,10,0.75,1,0.5,0.8125,-4.76039e-06;
+4,4,15,11,0.75,1,0.5625,0.875,-1.45245e-05;
+4,4,15,12,0.75,1,0.625,0.9375,-3.48295e-05;
+4,4,15,13,0.75,1,0.6875,1,-7.56254e-05;
+4,4,15,14,0.75,1,0.75,1,-0.000147924;
+4,4,15,15,0.75,1,0.75,1,0.00023153;
+5,2,0,1,0,0.125,0,0.375,-2.91626e-07;
+5,2,0,2,0,0.125,0.125,0.5,-6.42207e-07;
+5,2,0,3,0,0.125,0.25,0.625,-1.34113e-06;
+5,2,0,4,0,0.125,0.375,0.75,-2.54562e-06;
+5,2,0,5,0,0.125,0.5,0.875,-4.45159e-06;
+5,2,0,6,0,0.125,0.625,1,-6.63195e-06;
+5,2,0,7,0,0.125,0.75,1,-5.83168e-06;
+5,2,1,1,0,0.125,0,0.375,4.06782e-07;
+5,2,1,2,0,0.125,0.125,0.5,8.96211e-07;
+5,2,1,3,0,0.125,0.25,0.625,1.87129e-06;
+5,2,1,4,0,0.125,0.375,0.75,3.55193e-06;
+5,2,1,5,0,0.125,0.5,0.875,6.21157e-06;
+5,2,1,6,0,0.125,0.625,1,9.25384e-06;
+5,2,1,7,0,0.125,0.75,1,8.14456e-06;
+5,2,2,1,0,0.15625,0,0.375,4.71754e-07;
+5,2,2,2,0,0.15625,0.125,0.5,1.03926e-06;
+5,2,2,3,0,0.15625,0.25,0.625,2.17013e-06;
+5,2,2,4,0,0.15625,0.375,0.75,4.1191e-06;
+5,2,2,5,0,0.15625,0.5,0.875,7.20329e-06;
+5,2,2,6,0,0.15625,0.625,1,1.07313e-05;
+5,2,2,7,0,0.15625,0.75,1,9.45259e-06;
+5,2,3,1,0.03125,0.1875,0,0.375,5.43628e-07;
+5,2,3,2,0.03125,0.1875,0.125,0.5,1.19731e-06;
+5,2,3,3,0.03125,0.1875,0.25,0.625,2.50029e-06;
+5,2,3,4,0.03125,0.1875,0.375,0.75,4.74575e-06;
+5,2,3,5,0.03125,0.1875,0.5,0.875,8.29922e-06;
+5,2,3,6,0.03125,0.1875,0.625,1,1.23639e-05;
+5,2,3,7,0.03125,0.1875,0.75,1,1.08907e-05;
+5,2,4,1,0.0625,0.21875,0,0.375,6.26352e-07;
+5,2,4,2,0.0625,0.21875,0.125,0.5,1.37045e-06;
+5,2,4,3,0.0625,0.21875,0.25,0.625,2.88553e-06;
+5,2,4,4,0.0625,0.21875,0.375,0.75,5.42242e-06;
+5,2,4,5,0.0625,0.21875,0.5,0.875,9.58665e-06;
+5,2,4,6,0.0625,0.21875,0.625,1,1.4153e-05;
+5,2,4,7,0.0625,0.21875,0.75,1,1.25429e-05;
+5,2,5,0,0.09375,0.25,0,0.25,8.13767e-08;
+5,2,5,1,0.09375,0.25,0,0.375,6.71119e-07;
+5,2,5,2,0.09375,0.25,0.125,0.5,1.58751e-06;
+5,2,5,3,0.09375,0.25,0.25,0.625,3.30042e-06;
+5,2,5,4,0.09375,0.25,0.375,0.75,6.20217e-06;
+5,2,5,5,0.09375,0.25,0.5,0.875,1.0995e-05;
+5,2,5,6,0.09375,0.25,0.625,1,1.61886e-05;
+5,2,5,7,0.09375,0.25,0.75,1,1.43743e-05;
+5,2,6,0,0.125,0.28125,0,0.25,1.17694e-07;
+5,2,6,1,0.125,0.28125,0,0.375,7.5099e-07;
+5,2,6,2,0.125,0.28125,0.125,0.5,1.81666e-06;
+5,2,6,3,0.125,0.28125,0.25,0.625,3.76178e-06;
+5,2,6,4,0.125,0.28125,0.375,0.75,7.07389e-06;
+5,2,6,5,0.125,0.28125,0.5,0.875,1.25406e-05;
+5,2,6,6,0.125,0.28125,0.625,1,1.84619e-05;
+5,2,6,7,0.125,0.28125,0.75,1,1.63946e-05;
+5,2,7,0,0.15625,0.3125,0,0.25,8.95852e-08;
+5,2,7,1,0.15625,0.3125,0,0.375,8.77783e-07;
+5,2,7,2,0.15625,0.3125,0.125,0.5,2.05052e-06;
+5,2,7,3,0.15625,0.3125,0.25,0.625,4.27376e-06;
+5,2,7,4,0.15625,0.3125,0.375,0.75,8.02537e-06;
+5,2,7,5,0.15625,0.3125,0.5,0.875,1.42324e-05;
+5,2,7,6,0.15625,0.3125,0.625,1,2.09503e-05;
+5,2,7,7,0.15625,0.3125,0.75,1,1.86051e-05;
+5,2,8,1,0.1875,0.34375,0,0.375,1.04785e-06;
+5,2,8,2,0.1875,0.34375,0.125,0.5,2.28782e-06;
+5,2,8,3,0.1875,0.34375,0.25,0.625,4.83058e-06;
+5,2,8,4,0.1875,0.34375,0.375,0.75,9.04632e-06;
+5,2,8,5,0.1875,0.34375,0.5,0.875,1.60537e-05;
+5,2,8,6,0.1875,0.34375,0.625,1,2.36266e-05;
+5,2,8,7,0.1875,0.34375,0.75,1,2.09834e-05;
+5,2,9,0,0.21875,0.375,0,0.25,1.27007e-07;
+5,2,9,1,0.21875,0.375,0,0.375,1.0988e-06;
+5,2,9,2,0.21875,0.375,0.125,0.5,2.59408e-06;
+5,2,9,3,0.21875,0.375,0.25,0.625,5.38568e-06;
+5,2,9,4,0.21875,0.375,0.375,0.75,1.01346e-05;
+5,2,9,5,0.21875,0.375,0.5,0.875,1.79699e-05;
+5,2,9,6,0.21875,0.375,0.625,1,2.64238e-05;
+5,2,9,7,0.21875,0.375,0.75,1,2.34907e-05;
+5,2,10,0,0.25,0.40625,0,0.25,1.91947e-07;
+5,2,10,1,0.25,0.40625,0,0.375,1.1887e-06;
+5,2,10,2,0.25,0.40625,0.125,0.5,2.88404e-06;
+5,2,10,3,0.25,0.40625,0.25,0.625,5.9688e-06;
+5,2,10,4,0.25,0.40625,0.375,0.75,1.12253e-05;
+5,2,10,5,0.25,0.40625,0.5,0.875,1.99e-05;
+5,2,10,6,0.25,0.40625,0.625,1,2.92958e-05;
+5,2,10,7,0.25,0.40625,0.75,1,2.60157e-05;
+5,2,11,0,0.28125,0.4375,0,0.25,2.13583e-07;
+5,2,11,1,0.28125,0.4375,0,0.375,1.29788e-06;
+5,2,11,2,0.28125,0.4375,0.125,0.5,3.15515e-06;
+5,2,11,3,0.28125,0.4375,0.25,0.625,6.52753e-06;
+5,2,11,4,0.28125,0.4375,0.375,0.75,1.2277e-05;
+5,2,11,5,0.28125,0.4375,0.5,0.875,2.17639e-05;
+5,2,11,6,0.28125,0.4375,0.625,1,3.20402e-05;
+5,2,11,7,0.28125,0.4375,0.75,1,2.84525e-05;
+5,2,12,0,0.3125,0.46875,0,0.25,2.2982e-07;
+5,2,12,1,0.3125,0.46875,0,0.375,1.39484e-06;
+5,2,12,2,0.3125,0.46875,0.125,0.5,3.39131e-06;
+5,2,12,3,0.3125,0.46875,0.25,0.625,7.01592e-06;
+5,2,12,4,0.3125,0.46875,0.375,0.75,1.31956e-05;
+5,2,12,5,0.3125,0.46875,0.5,0.875,2.33924e-05;
+5,2,12,6,0.3125,0.46875,0.625,1,3.44376e-05;
+5,2,12,7,0.3125,0.46875,0.75,1,3.05816e-05;
+5,2,13,0,0.34375,0.5,0,0.25,2.41171e-07;
+5,2,13,1,0.34375,0.5,0,0.375,1.46348e-06;
+5,2,13,2,0.34375,0.5,0.125,0.5,3.55819e-06;
+5,2,13,3,0.34375,0.5,0.25,0.625,7.36114e-06;
+5,2,13,4,0.34375,0.5,0.375,0.75,1.3845e-05;
+5,2,13,5,0.34375,0.5,0.5,0.875,2.45435e-05;
+5,2,13,6,0.34375,0.5,0.625,1,3.61322e-05;
+5,2,13,7,0.34375,0.5,0.75,1,3.20865e-05;
+5,2,14,0,0.375,0.53125,0,0.25,2.44056e-07;
+5,2,14,1,0.375,0.53125,0,0.375,1.48251e-06;
+5,2,14,2,0.375,0.53125,0.125,0.5,3.60406e-06;
+5,2,14,3,0.375,0.53125,0.25,0.625,7.4562e-06;
+5,2,14,4,0.375,0.53125,0.375,0.75,1.40238e-05;
+5,2,14,5,0.375,0.53125,0.5,0.875,2.48604e-05;
+5,2,14,6,0.375,0.53125,0.625,1,3.65987e-05;
+5,2,14,7,0.375,0.53125,0.75,1,3.25007e-05;
+5,2,15,0,0.40625,0.5625,0,0.25,2.30751e-07;
+5,2,15,1,0.40625,0.5625,0,0.375,1.42254e-06;
+5,2,15,2,0.40625,0.5625,0.125,0.5,3.4531e-06;
+5,2,15,3,0.40625,0.5625,0.25,0.625,7.14583e-06;
+5,2,15,4,0.40625,0.5625,0.375,0.75,1.34392e-05;
+5,2,15,5,0.40625,0.5625,0.5,0.875,2.38244e-05;
+5,2,15,6,0.40625,0.5625,0.625,1,3.50735e-05;
+5,2,15,7,0.40625,0.5625,0.75,1,3.11462e-05;
+5,2,16,0,0.4375,0.59375,0,0.25,-1.57392e-07;
+5,2,16,1,0.4375,0.59375,0,0.375,-1.26043e-06;
+5,2,16,2,0.4375,0.59375,0.125,0.5,-2.98813e-06;
+5,2,16,3,0.4375,0.59375,0.25,0.625,-6.21056e-06;
+5,2,16,4,0.4375,0.59375,0.375,0.75,-1.16697e-05;
+5,2,16,5,0.4375,0.59375,0.5,0.875,-2.06913e-05;
+5,2,16,6,0.4375,0.59375,0.625,1,-3.04605e-05;
+5,2,16,7,0.4375,0.59375,0.75,1,-2.70494e-05;
+5,2,17,1,0.46875,0.625,0,0.375,-9.39805e-07;
+5,2,17,2,0.46875,0.625,0.125,0.5,-2.05342e-06;
+5,2,17,3,0.46875,0.625,0.25,0.625,-4.33181e-06;
+5,2,17,4,0.46875,0.625,0.375,0.75,-8.12104e-06;
+5,2,17,5,0.46875,0.625,0.5,0.875,-1.43949e-05;
+5,2,17,6,0.46875,0.625,0.625,1,-2.12055e-05;
+5,2,17,7,0.46875,0.625,0.75,1,-1.88209e-05;
+5,2,18,1,0.5,0.65625,0,0.375,-2.24797e-07;
+5,2,18,2,0.5,0.65625,0.125,0.5,-4.94624e-07;
+5,2,18,3,0.5,0.65625,0.25,0.625,-1.03324e-06;
+5,2,18,4,0.5,0.65625,0.375,0.75,-1.96101e-06;
+5,2,18,5,0.5,0.65625,0.5,0.875,-3.42931e-06;
+5,2,18,6,0.5,0.65625,0.625,1,-5.10885e-06;
+5,2,18,7,0.5,0.65625,0.75,1,-4.50005e-06;
+5,2,19,0,0.53125,0.6875,0,0.25,1.39497e-07;
+5,2,19,1,0.53125,0.6875,0,0.375,8.50507e-07;
+5,2,19,2,0.53125,0.6875,0.125,0.5,2.06538e-06;
+5,2,19,3,0.53125,0.6875,0.25,0.625,4.27703e-06;
+5,2,19,4,0.53125,0.6875,0.375,0.75,8.03532e-06;
+5,2,19,5,0.53125,0.6875,0.5,0.875,1.42617e-05;
+5,2,19,6,0.53125,0.6875,0.625,1,2.09748e-05;
+5,2,19,7,0.53125,0.6875,0.75,1,1.86389e-05;
+5,2,20,0,0.5625,0.71875,0,0.25,4.11836e-07;
+5,2,20,1,0.5625,0.71875,0,0.375,2.47887e-06;
+5,2,20,2,0.5625,0.71875,0.125,0.5,6.0523e-06;
+5,2,20,3,0.5625,0.71875,0.25,0.625,1.24681e-05;
+5,2,20,4,0.5625,0.71875,0.375,0.75,2.35247e-05;
+5,2,20,5,0.5625,0.71875,0.5,0.875,4.16991e-05;
+5,2,20,6,0.5625,0.71875,0.625,1,6.12637e-05;
+5,2,20,7,0.5625,0.71875,0.75,1,5.45115e-05;
+5,2,21,0,0.59375,0.75,0,0.25,8.20497e-07;
+5,2,21,1,0.59375,0.75,0,0.375,4.92846e-06;
+5,2,21,2,0.59375,0.75,0.125,0.5,1.20455e-05;
+5,2,21,3,0.59375,0.75,0.25,0.625,2.47894e-05;
+5,2,21,4,0.59375,0.75,0.375,0.75,4.68082e-05;
+5,2,21,5,0.59375,0.75,0.5,0.875,8.2966e-05;
+5,2,21,6,0.59375,0.75,0.625,1,0.000121839;
+5,2,21,7,0.59375,0.75,0.75,1,0.000108456;
+5,2,22,0,0.625,0.78125,0,0.25,1.42152e-06;
+5,2,22,1,0.625,0.78125,0,0.375,8.5395e-06;
+5,2,22,2,0.625,0.78125,0.125,0.5,2.08702e-05;
+5,2,22,3,0.625,0.78125,0.25,0.625,4.29524e-05;
+5,2,22,4,0.625,0.78125,0.375,0.75,8.11017e-05;
+5,2,22,5,0.625,0.78125,0.5,0.875,0.00014375;
+5,2,22,6,0.625,0.78125,0.625,1,0.000211107;
+5,2,22,7,0.625,0.78125,0.75,1,0.000187917;
+5,2,23,0,0.65625,0.8125,0,0.25,2.29363e-06;
+5,2,23,1,0.65625,0.8125,0,0.375,1.37802e-05;
+5,2,23,2,0.65625,0.8125,0.125,0.5,3.36777e-05;
+5,2,23,3,0.65625,0.8125,0.25,0.625,6.93111e-05;
+5,2,23,4,0.65625,0.8125,0.375,0.75,0.000130872;
+5,2,23,5,0.65625,0.8125,0.5,0.875,0.000231966;
+5,2,23,6,0.65625,0.8125,0.625,1,0.000340657;
+5,2,23,7,0.65625,0.8125,0.75,1,0.000303235;
+5,2,24,0,0.6875,0.84375,0,0.25,3.53033e-06;
+5,2,24,1,0.6875,0.84375,0,0.375,2.13337e-05;
+5,2,24,2,0.6875,0.84375,0.125,0.5,5.20175e-05;
+5,2,24,3,0.6875,0.84375,0.25,0.625,0.000107124;
+5,2,24,4,0.6875,0.84375,0.375,0.75,0.000202334;
+5,2,24,5,0.6875,0.84375,0.5,0.875,0.000358513;
+5,2,24,6,0.6875,0.84375,0.625,1,0.000526544;
+5,2,24,7,0.6875,0.84375,0.75,1,0.000468708;
+5,2,25,0,0.71875,0.875,0,0.25,5.34055e-06;
+5,2,25,1,0.71875,0.875,0,0.375,3.20215e-05;
+5,2,25,2,0.71875,0.875,0.125,0.5,7.80994e-05;
+5,2,25,3,0.71875,0.875,0.25,0.625,0.000160942;
+5,2,25,4,0.71875,0.875,0.375,0.75,0.000303931;
+5,2,25,5,0.71875,0.875,0.5,0.875,0.000538528;
+5,2,25,6,0.71875,0.875,0.625,1,0.000790924;
+5,2,25,7,0.71875,0.875,0.75,1,0.00070404;
+5,2,26,0,0.75,0.90625,0,0.25,7.89289e-06;
+5,2,26,1,0.75,0.90625,0,0.375,4.7053e-05;
+5,2,26,2,0.75,0.90625,0.125,0.5,0.000115029;
+5,2,26,3,0.75,0.90625,0.25,0.625,0.000236925;
+5,2,26,4,0.75,0.90625,0.375,0.75,0.000447417;
+5,2,26,5,0.75,0.90625,0.5,0.875,0.000792782;
+5,2,26,6,0.75,0.90625,0.625,1,0.00116433;
+5,2,26,7,0.75,0.90625,0.75,1,0.00103643;
+5,2,27,0,0.78125,0.9375,0,0.25,1.15335e-05;
+5,2,27,1,0.78125,0.9375,0,0.375,6.81513e-05;
+5,2,27,2,0.78125,0.9375,0.125,0.5,0.000166893;
+5,2,27,3,0.78125,0.9375,0.25,0.625,0.000343642;
+5,2,27,4,0.78125,0.9375,0.375,0.75,0.000648954;
+5,2,27,5,0.78125,0.9375,0.5,0.875,0.00114989;
+5,2,27,6,0.78125,0.9375,0.625,1,0.00168881;
+5,2,27,7,0.78125,0.9375,0.75,1,0.00150329;
+5,2,28,0,0.8125,0.96875,0,0.25,1.65713e-05;
+5,2,28,1,0.8125,0.96875,0,0.375,9.77176e-05;
+5,2,28,2,0.8125,0.96875,0.125,0.5,0.000239375;
+5,2,28,3,0.8125,0.96875,0.25,0.625,0.000492864;
+5,2,28,4,0.8125,0.96875,0.375,0.75,0.000930756;
+5,2,28,5,0.8125,0.96875,0.5,0.875,0.00164922;
+5,2,28,6,0.8125,0.96875,0.625,1,0.00242215;
+5,2,28,7,0.8125,0.96875,0.75,1,0.00215608;
+5,2,29,0,0.84375,1,0,0.25,2.35642e-05;
+5,2,29,1,0.84375,1,0,0.375,0.000138938;
+5,2,29,2,0.84375,1,0.125,0.5,0.000340358;
+5,2,29,3,0.84375,1,0.25,0.625,0.000700781;
+5,2,29,4,0.84375,1,0.375,0.75,0.0013234;
+5,2,29,5,0.84375,1,0.5,0.875,0.00234495;
+5,2,29,6,0.84375,1,0.625,1,0.00344396;
+5,2,29,7,0.84375,1,0.75,1,0.00306562;
+5,2,30,0,0.875,1,0,0.25,3.3129e-05;
+5,2,30,1,0.875,1,0,0.375,0.000195484;
+5,2,30,2,0.875,1,0.125,0.5,0.00047888;
+5,2,30,3,0.875,1,0.25,0.625,0.000985992;
+5,2,30,4,0.875,1,0.375,0.75,0.00186201;
+5,2,30,5,0.875,1,0.5,0.875,0.00329932;
+5,2,30,6,0.875,1,0.625,1,0.0048456;
+5,2,30,7,0.875,1,0.75,1,0.00430998;
+5,2,31,0,0.875,1,0,0.25,-3.88265e-05;
+5,2,31,1,0.875,1,0,0.375,-0.000229318;
+5,2,31,2,0.875,1,0.125,0.5,-0.000561764;
+5,2,31,3,0.875,1,0.25,0.625,-0.00115665;
+5,2,31,4,0.875,1,0.375,0.75,-0.00218428;
+5,2,31,5,0.875,1,0.5,0.875,-0.00387036;
+5,2,31,6,0.875,1,0.625,1,-0.0056843;
+5,2,31,7,0.875,1,0.75,1,-0.00505116;
+5,3,0,7,0,0.125,0.5,1,2.78654e-07;
+5,3,1,7,0,0.125,0.5,1,-3.91392e-07;
+5,3,2,7,0,0.15625,0.5,1,-4.57279e-07;
+5,3,3,7,0.03125,0.1875,0.5,1,-5.27076e-07;
+5,3,4,6,0.0625,0.21875,0.5,1,1.51253e-07;
+5,3,4,7,0.0625,0.21875,0.5,1,-6.90538e-07;
+5,3,5,6,0.09375,0.25,0.5,1,2.27902e-07;
+5,3,5,7,0.09375,0.25,0.5,1,-8.22544e-07;
+5,3,6,6,0.125,0.28125,0.5,1,2.6362e-07;
+5,3,6,7,0.125,0.28125,0.5,1,-9.4009e-07;
+5,3,7,6,0.15625,0.3125,0.5,1,3.00158e-07;
+5,3,7,7,0.15625,0.3125,0.5,1,-1.06754e-06;
+5,3,8,6,0.1875,0.34375,0.5,1,3.39455e-07;
+5,3,8,7,0.1875,0.34375,0.5,1,-1.20406e-06;
+5,3,9,5,0.21875,0.375,0.375,1,3.52937e-08;
+5,3,9,6,0.21875,0.375,0.5,1,3.99538e-07;
+5,3,9,7,0.21875,0.375,0.5,1,-1.35073e-06;
+5,3,10,6,0.25,0.40625,0.5,1,4.19147e-07;
+5,3,10,7,0.25,0.40625,0.5,1,-1.49254e-06;
+5,3,11,6,0.28125,0.4375,0.5,1,4.58128e-07;
+5,3,11,7,0.28125,0.4375,0.5,1,-1.6322e-06;
+5,3,12,6,0.3125,0.46875,0.5,1,4.92436e-07;
+5,3,12,7,0.3125,0.46875,0.5,1,-1.75436e-06;
+5,3,13,6,0.34375,0.5,0.5,1,5.16838e-07;
+5,3,13,7,0.34375,0.5,0.5,1,-1.84077e-06;
+5,3,14,6,0.375,0.53125,0.5,1,5.23423e-07;
+5,3,14,7,0.375,0.53125,0.5,1,-1.86448e-06;
+5,3,15,6,0.40625,0.5625,0.5,1,5.0128e-07;
+5,3,15,7,0.40625,0.5625,0.5,1,-1.78661e-06;
+5,3,16,6,0.4375,0.59375,0.5,1,-4.34321e-07;
+5,3,16,7,0.4375,0.59375,0.5,1,1.55079e-06;
+5,3,17,6,0.46875,0.625,0.5,1,-2.80629e-07;
+5,3,17,7,0.46875,0.625,0.5,1,1.0666e-06;
+5,3,18,7,0.5,0.65625,0.5,1,2.18013e-07;
+5,3,19,6,0.53125,0.6875,0.5,1,3.24804e-07;
+5,3,19,7,0.53125,0.6875,0.5,1,-1.0831e-06;
+5,3,20,5,0.5625,0.71875,0.375,1,1.49317e-07;
+5,3,20,6,0.5625,0.71875,0.5,1,9.68472e-07;
+5,3,20,7,0.5625,0.71875,0.5,1,-3.14184e-06;
+5,3,21,5,0.59375,0.75,0.375,1,3.65375e-07;
+5,3,21,6,0.59375,0.75,0.5,1,1.9649e-06;
+5,3,21,7,0.59375,0.75,0.5,1,-6.255e-06;
+5,3,22,5,0.625,0.78125,0.375,1,6.27681e-07;
+5,3,22,6,0.625,0.78125,0.5,1,3.40115e-06;
+5,3,22,7,0.625,0.78125,0.5,1,-1.08383e-05;
+5,3,23,5,0.65625,0.8125,0.375,1,1.01369e-06;
+5,3,23,6,0.65625,0.8125,0.5,1,5.48852e-06;
+5,3,23,7,0.65625,0.8125,0.5,1,-1.7488e-05;
+5,3,24,3,0.6875,0.84375,0.125,0.75,1.32662e-07;
+5,3,24,5,0.6875,0.84375,0.375,1,1.60434e-06;
+5,3,24,6,0.6875,0.84375,0.5,1,8.49151e-06;
+5,3,24,7,0.6875,0.84375,0.5,1,-2.70343e-05;
+5,3,25,2,0.71875,0.875,0,0.625,2.13079e-07;
+5,3,25,3,0.71875,0.875,0.125,0.75,4.36138e-07;
+5,3,25,4,0.71875,0.875,0.25,0.875,-1.47851e-07;
+5,3,25,5,0.71875,0.875,0.375,1,2.35677e-06;
+5,3,25,6,0.71875,0.875,0.5,1,1.27446e-05;
+5,3,25,7,0.71875,0.875,0.5,1,-4.06027e-05;
+5,3,26,1,0.75,0.90625,0,0.5,2.00646e-07;
+5,3,26,2,0.75,0.90625,0,0.625,5.21695e-07;
+5,3,26,3,0.75,0.90625,0.125,0.75,7.40729e-07;
+5,3,26,4,0.75,0.90625,0.25,0.875,-2.74459e-07;
+5,3,26,5,0.75,0.90625,0.375,1,3.44627e-06;
+5,3,26,6,0.75,0.90625,0.5,1,1.87588e-05;
+5,3,26,7,0.75,0.90625,0.5,1,-5.97769e-05;
+5,3,27,0,0.78125,0.9375,0,0.5,-1.58889e-07;
+5,3,27,1,0.78125,0.9375,0,0.5,4.49777e-07;
+5,3,27,2,0.78125,0.9375,0,0.625,8.28344e-07;
+5,3,27,3,0.78125,0.9375,0.125,0.75,1.09288e-06;
+5,3,27,4,0.78125,0.9375,0.25,0.875,-4.04815e-07;
+5,3,27,5,0.78125,0.9375,0.375,1,4.99583e-06;
+5,3,27,6,0.78125,0.9375,0.5,1,2.72064e-05;
+5,3,27,7,0.78125,0.9375,0.5,1,-8.66971e-05;
+5,3,28,0,0.8125,0.96875,0,0.5,-2.86408e-07;
+5,3,28,1,0.8125,0.96875,0,0.5,6.83058e-07;
+5,3,28,2,0.8125,0.96875,0,0.625,1.19905e-06;
+5,3,28,3,0.8125,0.96875,0.125,0.75,1.56974e-06;
+5,3,28,4,0.8125,0.96875,0.25,0.875,-5.80931e-07;
+5,3,28,5,0.8125,0.96875,0.375,1,7.16553e-06;
+5,3,28,6,0.8125,0.96875,0.5,1,3.90236e-05;
+5,3,28,7,0.8125,0.96875,0.5,1,-0.000124354;
+5,3,29,0,0.84375,1,0,0.5,-4.1132e-07;
+5,3,29,1,0.84375,1,0,0.5,9.73994e-07;
+5,3,29,2,0.84375,1,0,0.625,1.70617e-06;
+5,3,29,3,0.84375,1,0.125,0.75,2.23244e-06;
+5,3,29,4,0.84375,1,0.25,0.875,-8.26322e-07;
+5,3,29,5,0.84375,1,0.375,1,1.01874e-05;
+5,3,29,6,0.84375,1,0.5,1,5.54807e-05;
+5,3,29,7,0.84375,1,0.5,1,-0.000176796;
+5,3,30,0,0.875,1,0,0.5,-5.75554e-07;
+5,3,30,1,0.875,1,0,0.5,1.36412e-06;
+5,3,30,2,0.875,1,0,0.625,2.39086e-06;
+5,3,30,3,0.875,1,0.125,0.75,3.12832e-06;
+5,3,30,4,0.875,1,0.25,0.875,-1.15753e-06;
+5,3,30,5,0.875,1,0.375,1,1.42786e-05;
+5,3,30,6,0.875,1,0.5,1,7.76963e-05;
+5,3,30,7,0.875,1,0.5,1,-0.000247224;
+5,3,31,0,0.875,1,0,0.5,6.70045e-07;
+5,3,31,1,0.875,1,0,0.5,-1.59083e-06;
+5,3,31,2,0.875,1,0,0.625,-2.79114e-06;
+5,3,31,3,0.875,1,0.125,0.75,-3.65229e-06;
+5,3,31,4,0.875,1,0.25,0.875,1.35265e-06;
+5,3,31,5,0.875,1,0.375,1,-1.66633e-05;
+5,3,31,6,0.875,1,0.5,1,-9.05941e-05;
+5,3,31,7,0.875,1,0.5,1,0.000287755;
+];
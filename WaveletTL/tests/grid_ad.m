@@ -0,0 +1,1457 @@
+figure;
+box on;
+patch([0,0.25,0.25,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0,0,0.15625,0.15625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.03125,0.03125,0.1875,0.1875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.5,0.5,0.65625,0.65625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.375,0.375,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0,0,0.15625,0.15625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.03125,0.03125,0.1875,0.1875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.5,0.5,0.65625,0.65625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.125,0.5,0.5,0.125],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0,0,0.15625,0.15625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.03125,0.03125,0.1875,0.1875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.5,0.5,0.65625,0.65625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.25,0.625,0.625,0.25],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0,0,0.15625,0.15625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.03125,0.03125,0.1875,0.1875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.5,0.5,0.65625,0.65625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.375,0.75,0.75,0.375],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0,0,0.15625,0.15625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.03125,0.03125,0.1875,0.1875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.5,0.5,0.65625,0.65625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.5,0.875,0.875,0.5],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0,0,0.15625,0.15625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.03125,0.03125,0.1875,0.1875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.5,0.5,0.65625,0.65625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.625,1,1,0.625],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.15625,0.15625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.03125,0.03125,0.1875,0.1875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,0.65625,0.65625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.5,0.5,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.625,0.625,0],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.125,0.75,0.75,0.125],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.25,0.875,0.875,0.25],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.375,1,1,0.375],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.125,0.125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0,0,0.15625,0.15625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.03125,0.03125,0.1875,0.1875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.0625,0.0625,0.21875,0.21875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.09375,0.09375,0.25,0.25],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.125,0.125,0.28125,0.28125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.15625,0.15625,0.3125,0.3125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.1875,0.1875,0.34375,0.34375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.21875,0.21875,0.375,0.375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.25,0.25,0.40625,0.40625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.28125,0.28125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.3125,0.3125,0.46875,0.46875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.34375,0.34375,0.5,0.5],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.375,0.375,0.53125,0.53125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.40625,0.40625,0.5625,0.5625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.4375,0.4375,0.59375,0.59375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.46875,0.46875,0.625,0.625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5,0.5,0.65625,0.65625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.53125,0.53125,0.6875,0.6875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.5625,0.5625,0.71875,0.71875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.59375,0.59375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.625,0.625,0.78125,0.78125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.65625,0.65625,0.8125,0.8125],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.6875,0.6875,0.84375,0.84375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.71875,0.71875,0.875,0.875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.75,0.75,0.90625,0.90625],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.78125,0.78125,0.9375,0.9375],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.8125,0.8125,0.96875,0.96875],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.84375,0.84375,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0.5,1,1,0.5],[0.875,0.875,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.25,0.25,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.3125,0.3125,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.0625,0.375,0.375,0.0625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.4375,0.4375,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.1875,0.5,0.5,0.1875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.5625,0.5625,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.3125,0.625,0.625,0.3125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,0.6875,0.6875,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.4375,0.75,0.75,0.4375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,0.8125,0.8125,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5625,0.875,0.875,0.5625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.625,0.9375,0.9375,0.625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.6875,1,1,0.6875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0,0,0.3125,0.3125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.0625,0.0625,0.375,0.375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.125,0.125,0.4375,0.4375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.1875,0.1875,0.5,0.5],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.25,0.25,0.5625,0.5625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.3125,0.3125,0.625,0.625],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.375,0.375,0.6875,0.6875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.4375,0.4375,0.75,0.75],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5,0.5,0.8125,0.8125],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.5625,0.5625,0.875,0.875],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.625,0.625,0.9375,0.9375],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.6875,0.6875,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,1,1,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.15625,0.15625,0],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0,0.15625,0.15625,0],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0,0.15625,0.15625,0],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0,0.15625,0.15625,0],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0,0.15625,0.15625,0],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0,0.15625,0.15625,0],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0,0.15625,0.15625,0],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.03125,0.1875,0.1875,0.03125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.03125,0.1875,0.1875,0.03125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.03125,0.1875,0.1875,0.03125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.03125,0.1875,0.1875,0.03125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.03125,0.1875,0.1875,0.03125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.03125,0.1875,0.1875,0.03125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.03125,0.1875,0.1875,0.03125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5,0.65625,0.65625,0.5],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.5,0.65625,0.65625,0.5],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.5,0.65625,0.65625,0.5],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.5,0.65625,0.65625,0.5],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.5,0.65625,0.65625,0.5],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.5,0.65625,0.65625,0.5],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.5,0.65625,0.65625,0.5],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.25,0.25],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.375,0.375],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.125,0.125,0.5,0.5],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.25,0.25,0.625,0.625],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.375,0.375,0.75,0.75],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.5,0.5,0.875,0.875],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.625,0.625,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.75,0.75,1,1],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.125,0.125,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0,0.15625,0.15625,0],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.03125,0.1875,0.1875,0.03125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.0625,0.21875,0.21875,0.0625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.09375,0.25,0.25,0.09375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.125,0.28125,0.28125,0.125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.15625,0.3125,0.3125,0.15625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.1875,0.34375,0.34375,0.1875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.21875,0.375,0.375,0.21875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.25,0.40625,0.40625,0.25],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.28125,0.4375,0.4375,0.28125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.3125,0.46875,0.46875,0.3125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.34375,0.5,0.5,0.34375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.375,0.53125,0.53125,0.375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.40625,0.5625,0.5625,0.40625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.4375,0.59375,0.59375,0.4375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.46875,0.625,0.625,0.46875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5,0.65625,0.65625,0.5],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.53125,0.6875,0.6875,0.53125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.5625,0.71875,0.71875,0.5625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.59375,0.75,0.75,0.59375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.625,0.78125,0.78125,0.625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.65625,0.8125,0.8125,0.65625],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.6875,0.84375,0.84375,0.6875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.71875,0.875,0.875,0.71875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.75,0.90625,0.90625,0.75],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.78125,0.9375,0.9375,0.78125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.8125,0.96875,0.96875,0.8125],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.84375,1,1,0.84375],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.5,0.5],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0,0,0.625,0.625],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.125,0.125,0.75,0.75],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.25,0.25,0.875,0.875],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.375,0.375,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.5,0.5,1,1],'w','edgecolor','k')
+patch([0.875,1,1,0.875],[0.5,0.5,1,1],'w','edgecolor','k')
@@ -0,0 +1,6 @@
+x = [         0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1];
+;
+y = [         1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1;       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99;       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98;       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97;       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96;       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95;       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94;       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93;       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92;       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91;        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9;       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89;       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88;       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87;       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86;       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85;       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84;       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83;       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82;       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81;        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8;       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79;       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78;       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77;       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76;       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75;       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74;       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73;       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72;       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71;        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7;       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69;       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68;       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67;       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66;       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65;       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64;       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63;       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62;       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61;        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6;       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59;       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58;       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57;       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56;       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55;       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54;       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53;       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52;       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51;        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5;       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49;       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48;       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47;       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46;       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45;       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44;       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43;       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42;       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41;        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4;       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39;       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38;       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37;       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36;       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35;       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34;       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33;       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32;       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31;        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3;       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29;       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28;       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27;       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26;       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25;       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24;       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23;       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22;       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21;        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2;       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19;       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18;       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17;       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16;       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15;       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14;       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13;       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12;       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11;        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1;       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09;       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08;       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07; 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001;       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05;       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04;       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03;       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02;       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;
+z = [         0 0.421951289560595 0.865219901397733 1.33086550267615 1.81999858915852 2.33378272296647 2.87343684634199 3.44023767123248 4.03552214408501 4.66068998473051 5.31720629765798 6.00660425331322 6.73048783629642 7.49053465646608 8.28849881797161 9.12621384011898 10.0055956227078 10.928645447047 11.8974530022412 12.9141994245185 13.9811603353223 15.100708861584 16.2753186190076 17.5075666362942 18.800136194978 20.1558195559075 21.577520539322 23.0682569209193 24.631162601216 26.2694894998124 27.9866091198286 29.7860137206989 31.6713170296177 33.646254413141 35.7146824206513 37.8805776004933 40.1480344774593 42.5212625668056 45.0045822849801 47.6024196005606 50.3192992503712 53.1598363251529 56.1287260062982 59.2307312097713 62.4706678651512 65.853387526458 69.3837569767209 73.0666344497479 76.9068420498638 80.9091339030349 85.0781595203105 89.4184217963225 93.9342290010922 98.6296400519285 103.508402273012 108.57388076253 113.828978390043 119.276045339133 124.916776991156 130.75209881394 136.782036773077 143.005571621646 149.420475245052 156.023127039343 162.808308081872 169.768970610224 176.89598005646 184.177826586203 191.600302762845 199.146143592875 206.794624805258 214.52111477188 222.296574982731 230.087003443792 237.852814761863 245.548150012872 253.120108751537 260.507894703391 267.64186577664 274.442478032064 280.819112144123 286.668769664284 291.874625046171 296.304417897677 299.808668272613 302.218695987213 303.344422926273 302.971935069716 300.860778500203 296.740960921367 290.30962719671 281.227374080784 269.114165623437 253.544806647412 234.043927188482 210.080425800162 181.061314111721 146.324898933317 105.133231464357 56.6637457128666          0; -0.124973930959899 0.244017320435641 0.6316651290747 1.03889847929559 1.46669108720238 1.91606338929686 2.38808460101212 2.88387484536028 3.40460735156302 3.95151072313503 4.52587127443012 5.12903543413055 5.76241221355308 6.42747573695151 7.12576783020511 7.85890066338275 8.62855944165255 9.43650513785091 10.2845772587182 11.1746966353334 12.108868226617 13.0891839229008 14.1178253344562 15.1970665475128 16.3292768276423 17.5169232474149 18.7625732119022 20.0688968518774 21.4386692503968 22.8747724637915 24.3801972929011 25.9580447545776 27.6115271970199 29.343968995283 31.1588067552703 33.0595889455643 35.0499748664864 37.1337328546841 39.3147376092114 41.5969665113463 43.9844947951428 46.4814894087689 49.0922013878546 51.8209565411683 54.672144225723 57.6502039626426 60.7596096165222 64.0048508292781 67.390411364285 70.9207439775502 74.6002413893839 78.4332028820163 82.4237959954057 86.576012734501 90.8936196358639 95.380100969139 100.038594268623 104.871817301312 109.881985479358 115.070718615842 120.438935802054 125.986737050756 131.713270201942 137.616581423717 143.693447459569 149.939187572534 156.347452914555 162.909990803416 169.616381117541 176.453741717749 183.406399471944 190.455523089989 197.578713568212 204.749547591725 211.937068743611 219.10522081786 226.212216922155 233.209837381055 240.042648702907 246.647135047402 252.950732716717 258.87075718236 264.313211042063 269.171460064867 273.324763115639 276.636640238679 278.95306150869 280.100437409254 279.883389455516 278.08227751837 274.450457809344 268.711242723449 260.554530683612 249.6330707543 235.558323059538 217.895871914205 196.160344015745 169.809779000383 138.239394092922 100.774678416148 56.6637457128666; -0.231875126596761 0.0898246839086917 0.427804525739385 0.782876600976389 1.15589238858522 1.54774440939175 1.95936805538452 2.39174348388983 2.84589757690415 3.32290596556364 3.82389511937562 4.35004449942711 4.90258877431364 5.48282009698959 6.09209044012225 6.73181398682444 7.40346957283677 8.10860317531671 8.84883044235726 9.6258392561867 10.4413923216789 11.2973297703123 12.1955717680372 13.1381211136204 14.1270658119164 15.1645816041315 16.2529344344764 17.3944828296126 18.5916801639493 19.8470767801016 21.1633219296376 22.5431654945644 23.9894594447871 25.5051589809547 27.0933233056117 28.7571159583486 30.4998046425803 32.3247604626178 34.2354564797092 36.2354654846247 38.3284568720048 40.5181924879611 42.8085213071568 45.2033727786402 47.7067486608694 50.3227131454559 53.0553810459375 55.9089038021259 58.8874530219807 61.9952012512435 65.2362996258849 68.6148520233967 72.1348852857085 75.8003150385439 79.6149065788829 83.5822302432828 87.7056106045356 91.9880687718198 96.4322569893866 101.040384640076 105.814134661682 110.754569275326 115.862023804515 121.135987230067 126.57496797842 132.176343277258 137.936190231409 143.849096571588 149.907948806862 156.103695266296 162.425081243737 168.858353159223 175.386928318077 181.991026480941 188.647259051122 195.328171235467 202.001732037052 208.630766387155 215.17232311475 221.576971777882 227.788020635993 233.740647217965 239.360932029059 244.564784931777 249.25675262081 253.328694379392 256.658311941106 259.107517773724 260.520624434834 260.722335805928 259.515518973843 256.678733275302 251.96349052919 245.091217726983 235.749890406739 223.590301569593 208.221927275907 189.208345943678 166.062163823132 138.239394092922 105.133231464357; -0.322724832023488 -0.0432179696094739 0.250448074859758 0.558981227540896 0.883123814442818 1.22365412570931 1.58138803912951 1.95718070370669 2.35192828392691 2.76656976514503 3.20208882024429 3.65951573741984 4.1399294085833 4.64445937747698 5.17428794611679 5.73065233764515 6.31484691306031 6.92822543858798 7.57220339966482 8.2482603565996 8.95794233595471 9.70286425053377 10.4847123395559 11.3052466191253 12.1663033314489 13.0697973793932 14.0177247308787 15.0121647752669 16.0552826112643 17.1493312429226 18.2966536570214 19.4996847514357 20.7609530799727 22.0830823745696 23.468792800613 24.9209018954197 26.4423251335455 28.0360760554794 29.7052658883716 31.4531025786335 33.2828891464463 35.198021261314 37.2019839256711 39.2983471400815 41.4907604085879 43.7829459261385 46.1786902715396 48.6818344088715 51.2962617775327 54.0258842258094 56.8746255148269 59.84640208864 62.9451007717193 66.1745530168437 69.5385052839967 73.0405850838541 76.6842621673474 80.4728042850456 84.4092268761231 88.496235975799 92.7361635516234 97.130894392018 101.681783574171 106.389563431733 111.254238824685 116.274969382971 121.449937250813 126.776198698336 132.249517789849 137.864180101835 143.61278426646 149.486008876088 155.472352018251 161.557840416235 167.725704824819 173.956017970427 180.225290926408 186.506023373266 192.766202705929 198.968746410713 205.070881537872 211.023454435705 216.770163182187 222.246704342882 227.379824791028 232.086268338444 236.271605834034 239.828936179327 242.637444375451 244.560801239645 245.445387797139 245.118325549331 243.385291823662 240.028097204175 234.801999602307 227.432726830439 217.613176558915 204.999759240745 189.208345943678 169.809779000383 146.324898933317; -0.399337246146236 -0.157439195282876 0.0967270944416319 0.363776521518578 0.644354027253421 0.939135980051126 1.24883161426418 1.57418452467476 1.91597421755612 2.27501771910566 2.65217124186182 3.04833190950232 3.46443954017181 3.90147848819461 4.36047954369039 4.84252188922031 5.34873511214246 5.88030127084102 6.4384570124065 7.02449573867422 7.63976981676747 8.28569282942809 8.96374185943883 9.67545980133688 10.4224576923697 11.2064170532385 12.0290922275908 12.8923127074457 13.7979854297351 14.748097026903 15.7447160119928 16.7899948758377 17.8861720708207 19.0355738521508 20.2406159436675 21.5038049907946 22.8277397583617 24.215112025545 25.6687071240863 27.1914040591566 28.7861751446716 30.456085076447 32.2042893572131 34.0340319770928 35.9486422415561 37.9515306259893 40.0461835217061 42.2361567223252 44.5250674817898 46.9165849556932 49.4144188158187 52.0223058036492 54.7439939618089 57.583224252673 60.543709240418 63.6291084762278 66.8430001858397 70.1888488136932 73.6699679281445 77.2894779370323 81.050258001741 84.9548914701673 89.0056040739676 93.2041940523509 97.5519532726461 102.049578315949 106.6970703833 111.493622752906 116.437494380586 121.525868082521 126.754691569915 132.118499417576 137.610213840882 143.220921925843 148.939626702792 154.752969172993 160.644918086217 166.596423923109 172.585033155248 178.584458434468 184.564099896924 190.488512251833 196.316811754576 202.002016533123 207.490313039181 212.720240623974 217.621785385377 222.115373489581 226.110753127062 229.50575310883 232.184904833054 234.01791294138 234.857958424337 234.539816210385 232.877767366099 229.663283926436 224.662462042766 217.613176558915 208.221927275907 196.160344015745 181.061314111721; -0.463339941609507 -0.254930551881339 -0.0359372083721486 0.194172072964025 0.435955429734097 0.689998376042274 0.956915075719059 1.23734966711643 1.53197764067081 1.84150727034524 2.16668109995173 2.50827748522055 2.86711219232315 3.24404005336514 3.6399566791423 4.05580022919121 4.49255323886207 4.95124450279001 5.43295101373591 5.9387999553028 6.46997074650141 7.02769713553137 7.61326933945238 8.22803622563449 8.87340752998593 9.55085610594904 10.2619201971166 11.0082057250368 11.7913885823283 12.6132169195995 13.4755134128393 14.3801774958898 15.3291875403146 16.3246029623945 17.368566234095 18.4633047716221 19.6111326715726 20.8144522606524 22.0757554204354 23.3976246436136 24.7827337725883 26.2338483650128 27.7538256239426 29.3456138225084 31.0122511444112 32.756863851951 34.5826636826405 36.4929443635994 38.4910771197521 40.5805050372115 42.7647361269738 45.0473349159922 47.4319123726504 49.9221139514107 52.5216055167199 55.2340568788657 58.0631226440939 61.0124200476029 64.0855034006706 67.2858347417514 70.6167502354723 74.0814218125757 77.6828134874789 81.4236317276506 85.3062691798049 89.33274098126 93.5046127999104 97.8229196522448 102.288074444732 106.899765068631 111.656838750667 116.557172220735 121.597526101444 126.773381751197 132.078758600984 137.506009813063 143.045593855113 148.685819323895 154.412560065231 160.20893731938 166.05496526933 171.927155980617 177.798079291112 183.635872733283 189.403696045105 195.059124243564 200.553472590753 205.831046070406 210.828305205043 215.472939172899 219.682836220528 223.364940301756 226.413981695804 228.711068054871 230.122120891286 230.496140921874 229.663283926436 227.432726830439 223.590301569593 217.895871914205 210.080425800162; -0.516192306563229 -0.337569906283521 -0.149862148023293 0.047389127164319 0.254664763210559 0.472469367418075 0.701332435230375 0.941809522824947 1.19448346894668 1.45996566736195 1.73889739126411 2.03195117089652 2.33983222557695 2.66327995120565 3.00306946421517 3.36001320277099 3.73496258585377 4.12880973064462 4.54248922838801 4.97697997862035 5.43330708131909 5.91254378614302 6.41581349749235 6.94429183361027 7.49920873736886 8.08185063572144 8.69356264405335 9.33575081081064 10.0098843968217 10.7174981826353 11.4601947959681 12.2396470499653 13.0576002814152 13.9158746763049 14.8163675681241 15.7610556921186 16.7519973762048 17.7913346464843 18.8812952221822 20.0241943713588 21.2224365948544 22.4785171015922 23.795023033515 25.1746343930369 26.6201246198618 28.1343607573168 29.7203031408717 31.3810045331971 33.1196086208579 34.9393477774368 36.8435399864347 38.8355848045626 40.918958231894 43.0972063396333 45.3739374887984 47.7528129537391 50.2375357428994 52.831837385356 55.5394624251766 58.3641503362548 61.3096145376855 64.3795181536027 67.5774461213312 70.9068732072829 74.3711274407972 77.9733484215637 81.7164398958146 85.6030159294964 89.6353399324396 93.8152557053697 98.144109590591 102.622662706394 107.250992133648 112.028379799484 116.953187666205 122.022717682148 127.233054783639 132.578891051687 138.053328921816 143.647661118231 149.351124732175 155.150626586189 161.03043671824 166.971846479232 172.952787360753 178.947406253215 184.925592373661 190.852450592635 196.687715325592 202.385098530587 207.891564664137 213.146524684172 218.080940345255 222.61632909814 226.663658873831 230.122120891286 232.877767366099 234.801999602307 235.749890406739 235.558323059538 234.043927188482; -0.559202198205536 -0.407042483621251 -0.247129227429079 -0.0790699298762924 0.0975475033755286 0.283155710218678 0.47820886386754 0.683183709005478 0.898580643905263 1.12492485012809 1.36276747140942 1.61268684333496 1.87528977539568 2.15121288698536 2.44112399886659 2.74572358157866 3.06574626219237 3.40196239072958 3.7551796674568 4.12624483212953 4.5160454161043 4.92551155804491 5.35561788372372 5.80738545015447 6.28188375398467 6.78023280371688 7.30360525491507 7.85322860707542 8.43038746029509 9.03642582924771 9.67274951126251 10.3408285044935 11.0421994712455 11.7784682404831 12.5513123423676 13.362483566341 14.2138105327713 15.1072012664893 16.0446457586437 17.0282185011722 18.0600809757881 19.1424840767021 20.2777704432906 21.4683766755593 22.7168354014862 24.0257771611284 25.3979320676764 26.8361312004031 28.3433076786079 29.9224973591379 31.5768390928085 33.3095744669537 35.1240469523339 37.023700362606 39.01207652341 41.0928120357323 43.2696340044191 45.5463545873996 47.9268642041624 50.4151232231248 53.0151519265547 55.7310185284031 58.5668249945539 61.5266903863057 64.6147314160763 67.8350398690206 71.1916565051064 74.6885410127911 78.3295375373315 82.1183352534289 86.0584233928143 90.1530400718949 94.4051141920334 98.8171996046603 103.391400644403 108.12928803482 113.031804062161 118.099155791664 123.330694967079 128.72478308591 134.27863997884 139.988174040253 145.84779205581 151.850186350621 157.986096735476 164.244044456218 170.610035050033 177.067226678976 183.595560142216 190.171346360332 196.766806673589 203.349560796677 209.882056720012 216.32093623666 222.61632909814 228.711068054871 234.539816210385 240.028097204175 245.091217726983 249.6330707543 253.544806647412; -0.593540979895322 -0.464859879382799 -0.329607324113058 -0.18744914033485 -0.038034310266265 0.119005861078206 0.284058618577005 0.457530670896592 0.639849147332878 0.831462599389653 1.03284204893328 1.24448208480936 1.46690200985106 1.70064704024909 1.94628955929018 2.20443042750213 2.47570035126945 2.76076131200214 3.06030805795092 3.37506966076287 3.7058111388616 4.05333514971259 4.41848375299674 4.80214024666007 5.20523107773297 5.62872782971567 6.07364928820471 6.54106358628386 7.03209043102002 7.54790341218354 8.08973239405083 8.65886599083749 9.25665412594822 9.88451067480787 10.5439161905491 11.2364207112683 11.9636466469129 12.7272917431201 13.5291321184793 14.3710253707225 15.2549137462487 16.1828273661407 17.1568875004221 18.1793098807044 19.2524080395761 20.3785966630542 21.5603949401339 22.8004298909074 24.1014396518353 25.4662766935235 26.89791094273 28.3994327762696 29.9740558499402 31.6251197205181 33.3560922131949 35.1705714804943 37.0722876916376 39.0651042834419 41.1530186950474 43.3401624989772 45.63080083013 48.0293310021647 50.5402801872311 53.1683020199744 55.9181719700377 58.7947813087135 61.8031294747652 64.9483146215119 68.2355221018184 71.6700106193602 75.2570957431667 79.0021304476205 82.9104823014645 86.9875068865137 91.2385169792396 95.6687469756965 100.283311981828 105.087160926422 110.085022982206 115.281346501008 120.680229580794 126.285341284719 132.099832424174 138.126234698016 144.366346847457 150.821106339197 157.490444926679 164.373126259251 171.466563509607 178.76661476918 186.267353716867 193.960812796051 201.836695835678 209.882056720012 218.080940345255 226.413981695804 234.857958424337 243.385291823662 251.96349052919 260.554530683612 269.114165623437; -0.620257097201128 -0.512377229120242 -0.3989736335156 -0.279763880201244 -0.154451140243733 -0.0227234563211082 0.115747023423308 0.261304849808853 0.414312117184828 0.575149350078998 0.744216433956443 0.921933592208481 1.1087424115851 1.30510691838138 1.51151470778856 1.72847812892391 1.95653552816027 2.19625255348559 2.44822352273612 2.71307285866218 2.99145659390403 3.28406394907683 3.59161898728643 3.91488234852399 4.25465306751403 4.61177047871934 4.98711621233567 5.38161628523829 5.79624329097233 6.23201869300643 6.69001522559565 7.17135940672231 7.6772341677027 8.20888160416055 8.7676058531748 9.35477610150662 9.97182972989799 10.6202755985078 11.3016974786108 12.017757635725 12.770200569353 13.5608569145169 14.3916475102333 15.2645876400056 16.1817914493076 17.1454765448805 18.1579687804667 19.2217072333475 20.339249375727 21.5132764446107 22.7465990133465 24.042162767421 25.4030544864211 26.8325082332709 28.3339117509135 29.9108130655172 31.5669272940228 33.3061436523936 35.1325326592589 37.0503535277273 39.0640617359662 41.1783167646534 43.397989986585 45.7281726905226 48.174184217735 50.7415801856009 53.4361607680175 56.263978997157 59.2313490452635 62.3448544386003 65.6113561482773 69.038000494405 72.6322267907449 76.4017746466368 80.3546908313663 84.4993355931447 88.8443883103671 93.3988523366143 98.172058882794 103.173669759664 108.413678781517 113.902411606799 119.650523763541 125.668996576522 131.969130678524 138.562536749709 145.461123086468 152.677079553661 160.222857421507 168.111144529828 176.354835157385 184.96699390187 193.960812796051 203.349560796677 213.146524684172 223.364940301756 234.01791294138 245.118325549331 256.678733275302 268.711242723449 281.227374080784; -0.640288333392637 -0.550808712705037 -0.456732584690535 -0.35782335702432 -0.253832209818466 -0.14449745847715 -0.0295438828094695 0.0913179794432437 0.218392576615096 0.35200012672089 0.492477442841821 0.640178802602458 0.795476864186074 0.958763631480449 1.13045147110086 1.31097418420175 1.50078813616428 1.70037344743455 1.91023524898754 2.13090500610554 2.36294191438873 2.60693437215985 2.86350153368659 3.13329494792556 3.41700028779145 3.71533917527715 4.02907110809503 4.35899549388027 4.70595379839461 5.07083181459584 5.45456205989824 5.85812630944285 6.28255827372863 6.72894642952888 7.19843701363448 7.69223718963221 8.21161839864495 8.7579199057373 9.33255255452891 9.93700274346483 10.5728366381737 11.2417046354071 11.9453460952033 12.685594359167 13.4643820741087 14.2837468417546 15.1458372168324 16.0529190775683 17.0073823945144 18.0117484256692 19.0686773680835 20.1809764985669 21.3516088387519 22.5837023826502 23.880559927975 25.2456695559266 26.6827158078751 28.1955916114548 29.7884110130434 31.4655227784688 33.2315249291157 35.091280286429 37.0499331041877 39.1129268749027 41.2860234043363 43.5753232565142 45.9872876807786 48.5287621424922 51.2070015900344 54.0296976028379 57.0050075784926 60.1415861315237 63.4486188924614 66.9358589133968 70.6136659055377 74.4930485554991 78.5857101903959 82.9040980874507 87.461456752036 92.2718855190913 97.3504008669866 102.713003870456 108.376753260556 114.359844605104 120.68169617314 127.363042102113 134.426033547247 141.894348559452 149.793311511878 158.150022976424 166.993501041051 176.354835157385 186.267353716867 196.766806673589 207.891564664137 219.682836220528 232.184904833054 245.445387797139 259.515518973843 274.450457809344 290.30962719671; -0.654472871438503 -0.581241553158672 -0.504232923028093 -0.423250930756783 -0.338089223680235 -0.248530592183103 -0.154346383916625 -0.0552958849181754 0.0488743343862382 0.158431110453198 0.27365541747148 0.394843140254275 0.522305891810338 0.656371878416135 0.797386815211587 0.945714895558783 1.10173981763732 1.26586587200349 1.43851909411504 1.62014848612033 1.81122731253328 2.01225447476462 2.22375596985938 2.4462864392022 2.68043081339937 2.92680606003278 3.18606304150949 3.45888849080646 3.74600711353609 4.04818382544082 4.36622613516876 4.7009866829934 5.05336594702499 5.42431512942712 5.81483923620628 6.22600036529422 6.65892121890193 7.1147888575007 7.59485871429135 8.10045889067077 8.63299475500849 9.19395386902162 9.78491126820065 10.4075351251104 11.0635928269908 11.7549575019328 12.4836150310353 13.2516715873782 14.061361746418 14.9150572165482 15.8152762431117 16.7646937441425 17.7661522416042 18.8226736579172 19.9374720542001 21.1139673939399 22.3558004238212 23.6668487722712 25.051244375979 26.5133923553353 28.0579914714945 29.6900563107131 31.4149413558717 33.2383671207941 35.1664485402713 37.2057258277556 39.3631980336872 41.6463595605523 44.0632399162782 46.6224470156765 49.3332143706426 52.205452543981 55.2498052794105 58.4777107618455 61.9014685078818 65.5343124369554 69.3904907294044 73.4853531391725 77.8354464967625 82.4586192129274 87.374135676219 92.6028015287026 98.1671009047799 104.091346829141 110.401846092459 117.127080058778 124.297903007931 131.947759781251 140.112924680907 148.832763774242 158.150022976424 168.111144529828 178.76661476918 190.171346360332 202.385098530587 215.472939172899 229.50575310883 244.560801239645 260.722335805928 278.08227751837 296.740960921367; -0.663559277414448 -0.604648654781591 -0.542683136039495 -0.477502466612043 -0.408937794071589 -0.336811187203 -0.260935126190685 -0.18111196200436 -0.0971333429139438 -0.00877960590632854 0.0841808693944239 0.181992346887907 0.284912463025738 0.393213001713826 0.507180718334065 0.627118216391328 0.753344880575282 0.886197870335554 1.02603317840584 1.17322675908009 1.32817573144511 1.491299663212 1.66304194126745 1.84387123558861 2.03428306373742 2.23480146377536 2.44598078412402 2.66840759964604 2.90270276404127 3.1495236095515 3.40956630595223 3.68356839188913 3.97231149280109 4.27662424097023 4.59738541466436 4.93552731490154 5.29203940008398 5.66797220063441 6.06444153784039 6.48263307338897 6.92380721857626 7.38930443492851 7.88055096099579 8.39906500340799 8.94646343394255 9.52446903838221 10.1349183673737 10.7797702443778 11.4611149911748 12.1811844373027 12.9423627863242 13.7471984189911 14.5984167212855 15.498934034023 16.4518728303085 17.4605782377115 18.5286360336912 19.6598922556585 20.8584745812365 22.128815649911 23.4756785144989 24.9041844298707 26.419843207334 28.0285863862093 29.7368034996502 31.5513817399064 33.4797493592948 35.5299231774125 37.7105606029568 40.0310166202518 42.501406236662 45.1326729379157 47.9366637545011 50.9262116042554 54.1152256446745 57.5187904439912 61.1532748634466 65.0364516352393 69.1876287222902 73.6277936581999 78.3797721897262 83.4684026809803 88.9207278897036 94.7662058929184 101.036942123618 107.767944683794 114.997405323995 122.767008728045 131.122273015923 140.112924680907 149.793311511878 160.222857421507 171.466563509607 183.595560142216 196.687715325592 210.828305205043 226.110753127062 242.637444375451 260.520624434834 279.883389455516 300.860778500203; -0.668215509226246 -0.621900011460062 -0.573165381408406 -0.521882908880012 -0.467916792515529 -0.41112372446563 -0.351352448332531 -0.288443288431695 -0.222227648270674 -0.152527475967697 -0.0791546941422843 -0.00191059160242868 0.0794148260741332 0.165043530215084 0.255210210406872 0.350163067244664 0.450164660521944 0.555492817258157 0.666441604351946 0.783322371073863 0.906464867079594 1.03621844213694 1.17295333432143 1.31706205405153 1.46896087201066 1.62909141974511 1.79792241254199 1.97595150508602 2.16370729137747 2.36175146147325 2.57068112880122 2.7911313431027 3.02377780549381 3.2693398037153 3.52858338737725 3.80232480491637 4.09143422608725 4.39683977612402 4.71953191025833 5.06056816008665 5.42107828637118 5.80226987626422 6.20543442669755 6.63195395981173 7.08330822085586 7.56108251400868 8.06697623710598 8.60281218236011 9.17054667688383 9.77228064424733 10.410271676477 11.0869472149247 11.8049189483871 12.566998547829 13.3762148691744 14.2358327689874 15.1493736926052 16.1206382105505 17.1537306970014 18.2530863639024 19.4235008861694 20.6701628775674 21.9986895034817 23.415165546207 24.9261862708406 26.5389044757051 28.2610821507948 30.1011472114259 32.0682558225139 34.1723608821647 36.4242872920885 38.835814707301 41.419768529314 44.1901199862336 47.1620962306894 50.3523014831445 53.7788503548795 57.4615146028269 61.4218846986559 65.6835477383432 70.2722833773494 75.216279652036 80.5463707418374 86.2962989408881 92.5030033444091 99.2069380165578 106.452422695215 114.288029408223 122.767008728045 131.947759781251 141.894348559452 152.677079553661 164.373126259251 177.067226678976 190.852450592635 205.831046070406 222.115373489581 239.828936179327 259.107517773724 280.100437409254 302.971935069716; -0.669037044602756 -0.633773003507908 -0.596648061289552 -0.557561246586768 -0.516405826279194 -0.473068948566392 -0.427431261278568 -0.379366503468357 -0.328741068161895 -0.275413533959478 -0.219234162970351 -0.160044362340564 -0.0976761063855747 -0.0319513160681069 0.0373188077357576 0.11033450106571 0.18730820804338 0.268465411010834 0.354045524708844 0.444302860037146 0.539507663460622 0.639947238698787 0.745927157966437 0.857772570726611 0.9758296186796 1.10046696655072 1.23207745916262 1.37107991629412 1.51792107794564 1.67307771386314 1.83705891252786 2.01040856631315 2.19370807115409 2.38757926088845 2.592687598424 2.80974564808815 3.03951685594098 3.28281966750651 3.54053201532419 3.81359621197231 4.10302428779832 4.40990381654257 4.73540427640017 5.08078399887306 5.4473977630669 5.83670509893776 6.25027936944804 6.6898177087125 7.15715190107451 7.65426029472439 8.18328085304363 8.74652545742184 9.3464955869537 9.98589951329366 10.6676711631543 11.394990816619 12.1713078267575 13.0003655651489 13.8862288190312 14.8333138890997 15.8464216627204 16.9307739657411 18.0920535274758 19.3364479280938 20.6706979359309 22.1021506845161 23.6388181858017 25.2894417276629 27.063562760694 28.9716009422567 31.0249400752368 33.2360227557401 35.6184546287735 38.1871192446395 40.9583046122707 43.9498426600668 47.1812629411035 50.6739620591283 54.4513904459201 58.5392582909122 62.9657626121508 67.7618376655618 72.9614311192009 78.6018086729487 84.7238900845168 91.3726198724555 98.5973763091728 106.452422695215 114.997405323995 124.297903007931 134.426033547247 145.461123086468 157.490444926679 170.610035050033 184.925592373661 200.553472590753 217.621785385377 236.271605834034 256.658311941106 278.95306150869 303.344422926273; -0.666554213314569 -0.640961690072303 -0.613997173062482 -0.585584025543792 -0.555641019672314 -0.524082031502991 -0.490815713032776 -0.455745139338451 -0.418767428681285 -0.379773333252128 -0.33864679801235 -0.295264484846275 -0.249495258977195 -0.201199634309291 -0.150229174039097 -0.0964258425296336 -0.0396213040546896 0.0203638364036602 0.0837208555882654 0.150653803428991 0.221380469897968 0.296133434245679 0.375161204292209 0.458729454204357 0.547122370022594 0.640644113120123 0.739620412788161 0.844400300256933 0.955357997691249 1.07289497705499 1.19744220523322 1.32946259344862 1.46945367082617 1.61795050396453 1.77552888658346 1.9428088257554 2.12045835392028 2.30919769885107 2.50980384701345 2.72311553937741 2.95003874272798 3.19155264392433 3.44871621941598 3.72267543768799 4.01467115822743 4.32604779713929 4.65826283675472 5.01289726454073 5.39166703541496 5.79643566128027 6.22922804231603 6.69224566640376 7.18788331613887 7.71874743731992 8.28767633875208 8.89776241081223 9.55237656967287 10.2551951555638 11.0102295371774 11.8218587005307 12.6948651295441 13.6344743175741 14.6463982844573 15.7368835126393 16.9127637590677 18.1815182471383 19.5513357955898 21.031185499348 22.6308946415251 24.3612345867005 26.234015483974 28.2621906948518 30.4599719566781 32.8429563980047 35.4282666390495 38.2347053394087 41.2829256977246 44.5956195655086 48.1977250113417 52.1166553639538 56.3825519751494 61.028563178307 66.0911521775832 71.6104368895957 77.6305650760819 84.2001284560223 91.3726198724555 99.2069380165578 107.767944683794 117.127080058778 127.363042102113 138.562536749709 150.821106339197 164.244044456219 178.947406253215 195.059124243564 212.720240623974 232.086268338444 253.328694379392 276.636640238679 302.218695987213; -0.661238810433474 -0.644085193886252 -0.625986554290142 -0.606887546551867 -0.586729263060269 -0.565448974792222 -0.542979851126524 -0.519250656430849 -0.494185421298896 -0.467703086108044 -0.439717114340037 -0.410135072856389 -0.378858176043897 -0.345780790441279 -0.310789896122607 -0.273764500743634 -0.234575001749851 -0.193082491796191 -0.149138001933406 -0.102581676570558 -0.0532418736214402 -0.000934182579351628 0.0545396474670135 0.113392878670799 0.175855063801722 0.24217344482474 0.312614482432451 0.387465529476448 0.46703666256187 0.551662687525016 0.641705336120252 0.737555673015363 0.839636734151431 0.948406419683277 1.06436066710093 1.18803693276478 1.32001801299318 1.46093623904941 1.61147808391743 1.77238922266724 1.94448009252943 2.12863200356789 2.32580385610597 2.53703952687803 2.76347599230088 3.00635226435397 3.26701922239203 3.54695043286715 3.84775405849558 4.17118596896174 4.5191641769134 4.89378473588336 5.29733925100208 5.73233416908446 6.20151203203773 6.70787489671991 7.25471014556949 7.84561893573809 8.48454756032223 9.17582202386421 9.92418616586259 10.7348437009103 11.6135045826152 12.5664361410347 13.600519490397 14.7233117558584 15.9431147254765 17.2690505970303 18.7111455594338 20.2804220259565 21.9890004220702 23.8502115253205 25.8787204591426 28.090663558025 30.5037994490367 33.1376758357473 36.0138136263883 39.1559102202851 42.5900639568578 46.3450219417403 50.4524536968983 54.9472533383714 59.8678732689742 65.2566926868082 71.1604245568928 77.6305650760819 84.7238900845168 92.5030033444091 101.036942123618 110.401846092459 120.68169617314 131.969130678524 144.366346847457 157.986096735476 172.952787360753 189.403696045105 207.490313039181 227.379824791028 249.25675262081 273.324763115639 299.808668272613; -0.653510060085011 -0.643695265881866 -0.633307128362484 -0.622308876154332 -0.610661076895324 -0.598321419222896 -0.585244475005658 -0.571381439902341 -0.556679850139561 -0.54108327318705 -0.524530969773966 -0.506957524430816 -0.488292441455525 -0.468459702886767 -0.447377284719518 -0.424956627213686 -0.401102054722704 -0.375710140001125 -0.348669007433807 -0.319857569059251 -0.289144686630438 -0.256388252261846 -0.22143417944447 -0.184115295363987 -0.144250124522428 -0.101641552631509 -0.0560753586060829 -0.00731860122761674 0.0448821543421922 0.100802786552356 0.160743762007757 0.225032494490218 0.294025940444622 0.368113455202777 0.447719936739921 0.533309286544627 0.625388220260128 0.724510464154188 0.831281377229483 0.94636304293424 1.07047987901481 1.20442481911377 1.34906612530889 1.50535489696604 1.67433334810413 1.85714393301006 2.05503940817227 2.26939392780503 2.5017152804043 2.75365838501069 3.02704017826851 3.32385603708483 3.64629789684652 3.99677424189694 4.37793216347501 4.7926817007612 5.24422270326301 5.73607447773069 6.27210851037299 6.85658458561555 7.49419065631889 8.19008685758077 8.94995409736463 9.78004770262938 10.6872566498417 11.6791689642303 12.7641439334493 13.9513918490609 15.2510620641142 16.6743402378214 18.2335557297526 19.9423002069962 21.8155586393684 23.8698539811273 26.123406973979 28.596312656825 31.3107353341926 34.2911239392805 37.5644499308813 41.1604700881375 45.1120168154057 49.4553188439145 54.2303555201626 59.4812482061394 65.2566926868082 71.6104368895957 78.6018086729487 86.2962989408881 94.7662058929184 104.091346829141 114.359844605104 125.668996576522 138.126234698016 151.850186350622 166.971846479232 183.635872733283 202.002016533123 222.246704342882 244.564784931777 269.171460064867 296.304417897677; -0.643739992486655 -0.640283108794888 -0.636575247111442 -0.632595784239706 -0.628322223979273 -0.623730015314432 -0.618792352259374 -0.613479953470808 -0.607760819542041 -0.601599965675357 -0.594959127189534 -0.587796435054274 -0.580066058350476 -0.571717810231732 -0.562696713605067 -0.552942522354047 -0.542389193491171 -0.530964305144495 -0.518588414750965 -0.505174351240625 -0.490626434345859 -0.474839613451679 -0.457698517609551 -0.43907640746052 -0.418834018844674 -0.396818286803608 -0.372860937499844 -0.346776934270358 -0.318362762587314 -0.287394537103607 -0.253625912197649 -0.216785775483685 -0.176575701601137 -0.132667141217681 -0.0846983175520837 -0.0322707998181717 0.0250542802185616 0.0877604059270767 0.156380289014589 0.231500963854285 0.313769413329487 0.403898781875988 0.50267523724921 0.61096554900184 0.729725458795345 0.86000892555662 1.00297833720764 1.15991579032874 1.33223554976123 1.52149781191903 1.72942390857887 1.95791310228596 2.20906114038789 2.48518075225572 2.78882429364074 3.12280876354341 3.4902434426515 3.89456042857437 4.33954837202127 4.82938975003272 5.36870204769567 5.96258325880761 6.61666215909356 7.33715385325372 8.13092114980589 9.00554237591211 9.96938630872666 11.031694970915 12.2026751165842 13.4935993207166 14.9169176811869 16.4863812485177 18.2171784157627 20.1260856304646 22.2316339338152 24.554292990386 27.1166744466709 29.9437566499487 33.0631329725616 36.5052862227541 40.303891884083 44.4961532137145 49.1231715485394 54.2303555201627 59.8678732689743 66.0911521775833 72.961431119201 80.5463707418375 88.9207278897037 98.16710090478 108.376753260556 119.650523763541 132.099832424174 145.84779205581 161.03043671824 177.798079291112 196.316811754576 216.770163182188 239.360932029059 264.313211042063 291.874625046171; -0.632258291040726 -0.634285531307829 -0.636340217462781 -0.638415711853271 -0.640504190424803 -0.642596492909271 -0.644681955974113 -0.646748227474122 -0.648781059749329 -0.650764079692433 -0.652678533066181 -0.654503000282128 -0.656213080554859 -0.657781041016838 -0.659175427015375 -0.660360629411014 -0.661296404251916 -0.661937339707088 -0.662232264597528 -0.662123592263184 -0.661546592838849 -0.660428586277177 -0.658688047644381 -0.656233615315791 -0.652962991705163 -0.648761725063563 -0.643501859669605 -0.637040440390758 -0.629217856111705 -0.619856004885556 -0.608756261850473 -0.595697228949872 -0.580432243278551 -0.562686618427748 -0.542154590494472 -0.518495937427539 -0.491332237074197 -0.46024272563427 -0.424759714186157 -0.384363516480775 -0.338476836260332 -0.286458556899393 -0.227596870131217 -0.161101673952169 -0.0860961624244769 -0.00160752194848168 0.0934433604316425 0.200253281080269 0.320149311576453 0.45460272583174 0.605244403520649 0.773881865682976 0.962518114779321 1.17337246963225 1.40890360574726 1.6718350336807 1.965183272629 2.29228900350002 2.65685151566405 3.06296679466999 3.51516963478193 4.01848020060946 4.57845550677635 5.20124633394469 5.89366015407866 6.66323069814129 7.51829486607244 8.46807775256432 9.52278664357021 10.6937149284675 11.9933569722491 13.435535102035 15.0355399836738 16.8102857984683 18.778481778443 20.9608218225685 23.3801940976062 26.061912727555 29.0339738970679 32.3273389388892 35.9762472457758 40.0185621462356 44.4961532137144 49.4553188439145 54.9472533383714 61.028563178307 67.7618376655618 75.216279652036 83.4684026809803 92.6028015287026 102.713003870456 113.902411606799 126.285341284719 139.988174040253 155.150626586189 171.927155980617 190.488512251833 211.023454435705 233.740647217965 258.87075718236 286.668769664284; -0.619356660803147 -0.626090497420131 -0.633091090849755 -0.64036386268094 -0.647913644253274 -0.655744555082765 -0.66385986545105 -0.67226184133608 -0.680951569662726 -0.689928761630671 -0.699191531632244 -0.708736149001934 -0.718556759539455 -0.728645073416286 -0.738990015708272 -0.749577335390294 -0.760389168179161 -0.771403548113015 -0.782593862204753 -0.793928241897517 -0.805368884376075 -0.81687129604202 -0.828383449635584 -0.839844845574112 -0.85118546706767 -0.862324617455525 -0.873169626972153 -0.88361441478543 -0.893537890638878 -0.902802178759156 -0.911250644842286 -0.918705704888976 -0.92496639240001 -0.929805657944317 -0.932967372349808 -0.934163001712475 -0.933067919041815 -0.929317313626349 -0.922501655074199 -0.912161664418836 -0.897782739633205 -0.878788777315721 -0.854535326142949 -0.824302000864071 -0.787284078072984 -0.742583186659098 -0.689196996624106 -0.626007799766282 -0.551769864474067 -0.465095434423703 -0.364439227216394 -0.248081273780667 -0.114107922552856 0.0396091861362686 0.215436390583998 0.416003760970463 0.644233598269361 0.90337196948321 1.19702360053917 1.52919048207941 1.90431458084837 2.32732509079333 2.80369070377092 3.3394774303478 3.94141255710811 4.61695538869201 5.37437549111008 6.22283922839088 7.17250546808181 8.23463142337161 9.42168970156224 10.747497741309 12.2273609456007 13.8782309551143 15.7188806587278 17.770097706142 20.0548984734197 22.5987646376748 25.4299047441815 28.5795434001023 32.0822410063701 35.9762472457758 40.3038918840829 45.1120168154057 50.4524536968983 56.3825519751494 62.9657626121508 70.2722833773494 78.3797721897262 87.374135676219 97.3504008669866 108.413678781517 120.680229580794 134.27863997884 149.351124732175 166.05496526933 184.564099896924 205.070881537872 227.788020635993 252.950732716717 280.819112144123; -0.605292764721953 -0.61604212953005 -0.627262786569414 -0.638970502717225 -0.651180970137396 -0.663909709573675 -0.677171958916604 -0.690982545261996 -0.705355738479194 -0.72030508408636 -0.735843212985122 -0.751981625335592 -0.768730445552184 -0.786098145067694 -0.804091229144378 -0.822713883602365 -0.841967576883602 -0.861850612368843 -0.882357625310921 -0.903479018133987 -0.925200327169207 -0.947501513145691 -0.970356166923479 -0.993730621034716 -1.01758295658033 -1.04186189390217 -1.06650555420329 -1.09144007790893 -1.1165780840341 -1.14181695313465 -1.16703691455017 -1.19209891658069 -1.21684225595274 -1.24108194040209 -1.26460575540381 -1.28717100298754 -1.30850087715499 -1.32828043663422 -1.34615213152177 -1.36171083573766 -1.37449833210332 -1.38399719119534 -1.38962397887438 -1.39072172047186 -1.38655154197164 -1.37628340006836 -1.35898580363764 -1.33361441881782 -1.29899943847764 -1.25383158421176 -1.19664659504078 -1.12580804155318 -1.03948828715841 -0.935647399251637 -0.812009792231224 -0.666038361251542 -0.494905840102624 -0.295463088430307 -0.0642039823614944 0.202773451832967 0.509810059466942 0.861733175060688 1.26390932286349 1.72230253869135 2.24353890831631 2.83497798045269 3.50479178181024 4.26205223842176 5.11682789227248 6.08029089601126 7.16483537214917 8.38420833768885 9.75365452172632 11.2900765434941 13.0122120729747 14.9408297671548 17.0989459639303 19.5120643244955 22.2084408458627 25.219376920259 28.5795434001023 32.3273389388892 36.505286222754 41.1604700881375 46.3450219417403 52.1166553639538 58.5392582909122 65.6835477383432 73.6277936581999 82.4586192129274 92.2718855190913 103.173669759664 115.281346501008 128.724783085911 143.647661118231 160.20893731938 178.584458434468 198.968746410713 221.576971777882 246.647135047402 274.442478032064; -0.590293769583136 -0.604445218101875 -0.619241613438704 -0.6347075445322 -0.650867969363557 -0.667748140101183 -0.685373514544811 -0.703769652129419 -0.722962092550986 -0.742976214856175 -0.763837074594161 -0.785569216358416 -0.808196458746532 -0.831741648433909 -0.856226379688978 -0.88167067524964 -0.908092624028638 -0.935507970614883 -0.963929650983163 -0.993367268210476 -1.02382650131705 -1.05530843959703 -1.08780883396989 -1.12131725596064 -1.15581615389489 -1.19127979476396 -1.22767307896305 -1.26495021372033 -1.30305322950147 -1.34191032197743 -1.38143400026628 -1.42151902008259 -1.46204007813006 -1.50284924153062 -1.54377308327108 -1.58460949153711 -1.62512411736323 -1.66504642122095 -1.70406527495734 -1.74182407083973 -1.77791528431267 -1.81187443137792 -1.8431733552099 -1.87121276965403 -1.89531397955345 -1.91470968933244 -1.92853380184763 -1.93581009910465 -1.93543968492384 -1.92618705690812 -1.90666466099019 -1.87531576627389 -1.8303954806786 -1.76994970887282 -1.69179183295263 -1.59347687307012 -1.47227285951332 -1.32512911932324 -1.14864114912017 -0.939011711084941 -0.692007750651399 -0.402912692029775 -0.0664736207689263 0.323157189290927 0.772487004646277 1.28875427967486 1.88000795647438 2.55519522779563 3.32425865945109 4.19824366317599 5.18941741548165 6.31140043361669 7.57931214750216 9.00993194771134 10.6218773456404 12.4358010545285 14.4746089906626 16.7637014048568 19.331239587241 22.2084408458627 25.4299047441815 29.0339738970679 33.0631329725616 37.5644499308813 42.5900639568578 48.1977250113417 54.4513904459201 61.4218846986559 69.1876287222902 77.8354464967625 87.461456752036 98.172058882794 110.085022982206 123.33069496708 138.053328921816 154.412560065231 172.585033155248 192.766202705929 215.17232311475 240.042648702907 267.64186577664; -0.574559539571306 -0.591569285717252 -0.60937024793567 -0.627994485228658 -0.647474805555504 -0.667844710131603 -0.689138324974827 -0.711390318004689 -0.734635799803243 -0.758910205928771 -0.784249158431448 -0.810688303951883 -0.838263125485874 -0.867008724568664 -0.896959570266061 -0.928149210954166 -0.960609944419737 -0.994372441314981 -1.0294653164483 -1.0659146417808 -1.10374339432054 -1.14297083135589 -1.18361178463781 -1.22567586420017 -1.26916656148763 -1.31408024033171 -1.36040500306598 -1.40811941768769 -1.457191090442 -1.50757506650956 -1.55921203960287 -1.6120263492003 -1.66592374184981 -1.72078887043226 -1.77648250246178 -1.83283840538887 -1.8896598734294 -1.94671585663426 -2.00373664870148 -2.06040908537262 -2.11637120010043 -2.17120627797366 -2.22443624257897 -2.27551430350584 -2.32381678448761 -2.36863404364194 -2.40916038784156 -2.44448287281502 -2.47356886904292 -2.49525226076052 -2.50821813127474 -2.51098577220952 -2.50188983705202 -2.47905944030804 -2.44039498249834 -2.38354245792375 -2.30586497636327 -2.20441120138579 -2.07588037646547 -1.91658357527805 -1.72240077406828 -1.48873330143225 -1.21045117382358 -0.881834773097557 -0.496510264929111 -0.0473780934023669 0.473466183167302 1.07481952775812 1.76646842991712 2.55929627405736 3.46540216891479 4.49823245221708 5.67272621274485 7.00547631359093 8.51490755696826 10.2214738039506 12.1478760537886 14.3193036988454 16.7637014048568 19.5120643244955 22.5987646376748 26.061912727555 29.9437566499486 34.2911239392805 39.1559102202851 44.5956195655086 50.6739620591283 57.4615146028269 65.0364516352393 73.4853531391725 82.9040980874507 93.3988523366143 105.087160926422 118.099155791664 132.578891051687 148.685819323895 166.596423923109 186.506023373266 208.630766387155 233.209837381055 260.507894703391; -0.558265511707844 -0.577652248719533 -0.597952221428815 -0.619203760556387 -0.641446268982752 -0.664720182791068 -0.689066920434125 -0.714528818377637 -0.74114905137828 -0.768971535339736 -0.798040810451075 -0.828401902046642 -0.860100156332296 -0.893181047796313 -0.927689954761054 -0.963671899129752 -1.00117124593731 -1.04023135782014 -1.08089419897248 -1.12319988255009 -1.16718615480954 -1.21288780852643 -1.26033601741047 -1.30955758232088 -1.36057407907315 -1.41340089650631 -1.4680461522381 -1.52450947216041 -1.58278061820444 -1.6428379472202 -1.70464668194854 -1.76815697299954 -1.83330172846485 -1.89999418526276 -1.96812519351499 -2.03756018215759 -2.10813577056042 -2.17965598713849 -2.25188805174304 -2.32455767397911 -2.3973438144628 -2.4698728503516 -2.54171208019991 -2.61236249624297 -2.68125074452773 -2.74772018480913 -2.81102095273023 -2.87029891640842 -2.9245834080535 -2.97277359852956 -3.01362336871422 -3.04572451596242 -3.06748811679244 -3.07712384790422 -3.07261704662423 -3.05170326863388 -3.01184007514686 -2.95017575329522 -2.86351464207941 -2.74827870151641 -2.60046492423491 -2.4155981463294 -2.18867876737028 -1.91412483760305 -1.5857079130335 -1.19648201571391 -0.738704966477699 -0.203751279915579 0.417984274235054 1.13719343376226 1.96577262581136 2.91695377862393 4.00544910176873 5.24761131475695 6.66161096012978 8.26763260975864 10.0880919639375 12.1478760537886 14.4746089906626 17.0989459639303 20.0548984734197 23.3801940976062 27.1166744466709 31.3107353341926 36.0138136263883 41.2829256977246 47.1812629411035 53.7788503548795 61.1532748634466 69.3904907294044 78.5857101903959 88.8443883103671 100.283311981828 113.031804062161 127.233054783639 143.045593855113 160.644918086217 180.225290926408 202.001732037052 226.212216922155 253.120108751537; -0.541565284133192 -0.562903715509065 -0.585255964048907 -0.608665571659089 -0.633177425295954 -0.658837732600236 -0.685693986466878 -0.713794916950639 -0.743190428717339 -0.773931522038799 -0.8060701950943 -0.83965932508013 -0.874752525338724 -0.911403975396932 -0.949668220445674 -0.989599936396785 -1.03125365621313 -1.07468345272041 -1.11994257256814 -1.16708301540801 -1.21615505169294 -1.26720667176372 -1.32028295807392 -1.37542537149934 -1.43267094167612 -1.49205135020224 -1.5535918943074 -1.61731031723512 -1.68321549007356 -1.751305928102 -1.82156812287232 -1.89397466919883 -1.96848216396523 -2.04502885115122 -2.12353198470668 -2.20388487783167 -2.28595360382296 -2.36957330988818 -2.45454410116958 -2.54062644761653 -2.62753606125487 -2.71493818576788 -2.80244123407277 -2.88958970268362 -2.97585628402744 -3.06063308944694 -3.14322188629622 -3.2228232422195 -3.29852445829458 -3.36928616010469 -3.43392740184992 -3.49110912317893 -3.53931578135941 -3.5768349625379 -3.60173475497746 -3.61183864409294 -3.60469766359781 -3.57755950887466 -3.52733428750085 -3.45055654738705 -3.3433431848717 -3.20134679297646 -3.0197039634414 -2.79297800465588 -2.51509548066381 -2.17927591347788 -1.77795392135289 -1.30269298874594 -0.744089978655578 -0.0916694040312782 0.666233628967206 1.54260300794649 2.55188506055108 3.71014732944301 5.03525430054857 6.54706188062459 8.26763260975864 10.2214738039506 12.4358010545285 14.9408297671548 17.770097706142 20.9608218225685 24.5542929903859 28.596312656825 33.1376758357473 38.2347053394087 43.9498426600668 50.3523014831445 57.5187904439912 65.5343124369554 74.4930485554991 84.4993355931447 95.6687469756965 108.129288034821 122.022717682148 137.506009813063 154.752969172993 173.956017970427 195.328171235467 219.10522081786 245.548150012872; -0.524592945219238 -0.547507956793206 -0.571518448191229 -0.596672235510407 -0.623018708217108 -0.650608817452715 -0.67949505402594 -0.70973141454129 -0.741373353926374 -0.774477722412893 -0.80910268479519 -0.845307619533648 -0.883152994985211 -0.922700219726775 -0.964011463585912 -1.00714944560339 -1.05217718471931 -1.09915770849453 -1.14815371464685 -1.19922717959069 -1.25243890751452 -1.30784801280451 -1.36551132781836 -1.42548272712194 -1.48781235831334 -1.55254576846449 -1.6197229139984 -1.68937704047646 -1.76153341728364 -1.83620791055172 -1.91340537583711 -1.99311785005046 -2.07532251989962 -2.15997944163282 -2.24702898412952 -2.33638896435458 -2.42795144083599 -2.52157912711274 -2.61710138299072 -2.71430973689746 -2.81295288759594 -2.91273112795193 -3.01329012729155 -3.11421400207396 -3.21501759706874 -3.31513789089224 -3.41392443053743 -3.51062868933444 -3.60439223150033 -3.69423355396261 -3.77903346234637 -3.85751882275808 -3.9282445141288 -3.98957338722258 -4.03965401578582 -4.07639600250147 -4.09744257718739 -4.10014019678829 -4.08150482587245 -4.03818454224844 -3.96641807461964 -3.86198883751519 -3.72017398265681 -3.53568793497676 -3.30261982518139 -3.0143641684901 -2.66354407034584 -2.2419261637976 -1.7403263991331 -1.14850571334666 -0.455054504226835 0.352735279789828 1.28901174847146 2.36951983068236 3.61177479414149 5.03525430054857 6.66161096012978 8.51490755696826 10.6218773456404 13.0122120729747 15.7188806587278 18.778481778443 22.2316339338151 26.123406973979 30.5037994490367 35.4282666390495 40.9583046122707 47.1620962306894 54.1152256446745 61.9014685078818 70.6136659055377 80.3546908313663 91.2385169792396 103.391400644403 116.953187666205 132.078758600984 148.939626702792 167.725704824819 188.647259051122 211.937068743611 237.852814761863; -0.50746516880237 -0.531626579699823 -0.556948470506605 -0.58348210519442 -0.611280510001389 -0.640398472697527 -0.670892532232755 -0.702820957266854 -0.736243711897834 -0.771222406701787 -0.807820232971137 -0.846101877786793 -0.886133417280436 -0.92798218513292 -0.971716613010206 -1.01740603925579 -1.065120481734 -1.11493037024741 -1.16690623342902 -1.22111833442988 -1.27763624908006 -1.33652837948788 -1.39786139525168 -1.46169959358275 -1.52810416866658 -1.59713237951406 -1.66883660436177 -1.74326326836019 -1.82045162982551 -1.90043240871061 -1.9832262391565 -2.06884192599863 -2.15727448290246 -2.24850292736738 -2.34248780514171 -2.43916841360721 -2.53845969038811 -2.64024872978397 -2.74439088557963 -2.85070541430841 -2.95897060809086 -3.06891836068945 -3.18022810435555 -3.2925200483349 -3.40534764247584 -3.51818918117313 -3.63043845379776 -3.74139433771647 -3.85024921889277 -3.95607611277056 -4.05781434454878 -4.15425363292257 -4.24401640474109 -4.32553814964715 -4.39704560343302 -4.45653252636453 -4.50173281786575 -4.53009068146806 -4.53872752353277 -4.52440523564951 -4.48348547345515 -4.41188450353486 -4.30502314464495 -4.1577712792793 -3.96438635608121 -3.71844524222277 -3.4127687170163 -3.03933782300495 -2.5892012078477 -2.05237249863455 -1.41771664891896 -0.67282408671821 0.196128632116669 1.20453309766578 2.36951983068236 3.71014732944301 5.24761131475695 7.00547631359093 9.00993194771134 11.2900765434941 13.8782309551143 16.8102857984683 20.1260856304645 23.8698539811273 28.090663558025 32.8429563980047 38.1871192446395 44.1901199862336 50.9262116042554 58.4777107618455 66.9358589133968 76.4017746466368 86.9875068865137 98.8171996046606 112.028379799484 126.773381751197 143.220921925843 161.557840416235 181.991026480941 204.749547591725 230.087003443792; -0.490283098390468 -0.515400934592829 -0.541729607504644 -0.569323101753296 -0.59823731832208 -0.628530083251349 -0.66026114736746 -0.693492175588959 -0.728286724180921 -0.764710204129704 -0.80282982858938 -0.842714542105525 -0.884434929048913 -0.92806309838835 -0.973672541594823 -1.0213379600949 -1.07113505827584 -1.12314029758364 -1.17743060674345 -1.23408304256418 -1.29317439515884 -1.35478073071425 -1.41897686416876 -1.4858357532981 -1.55542780475799 -1.62782008157672 -1.70307540042266 -1.78125130567592 -1.8623989058992 -1.94656155671308 -2.03377337232115 -2.12405754598062 -2.21742445755601 -2.31386954390278 -2.4133709051823 -2.51588661728002 -2.62135171725636 -2.72967482517087 -2.84073436164844 -2.95437431616036 -3.07039951612907 -3.18857034158273 -3.3085968241304 -3.43013206243949 -3.55276487910751 -3.67601163575535 -3.7993071142485 -3.92199436208441 -4.04331338906829 -4.16238859032689 -4.27821475735585 -4.38964152402802 -4.49535607815616 -4.59386395114089 -4.68346767825861 -4.76224310005472 -4.82801305088058 -4.87831815360178 -4.91038440963906 -4.92108724047855 -4.90691160027419 -4.86390773879232 -4.78764214931117 -4.67314318673627 -4.51484078662969 -4.30649965552771 -4.0411452362309 -3.71098167802187 -3.30730096025736 -2.82038222767425 -2.23938029613638 -1.55220217743148 -0.745370349996342 0.196128632116669 1.28901174847146 2.55188506055108 4.00544910176873 5.67272621274485 7.57931214750216 9.75365452172632 12.2273609456007 15.0355399836738 18.2171784157627 21.8155586393684 25.8787204591426 30.4599719566781 35.6184546287735 41.419768529314 47.9366637545011 55.2498052794105 63.4486188924614 72.6322267907449 82.9104823014645 94.4051141920336 107.250992133648 121.597526101444 137.610213840882 155.472352018251 175.386928318077 197.578713568212 222.296574982731; -0.47313404099323 -0.498954280651859 -0.526022876515087 -0.55439589531592 -0.58413144355839 -0.615289684298828 -0.647932845553506 -0.682125218932203 -0.717933146923259 -0.755424997062109 -0.794671120999894 -0.83574379624916 -0.878717148117327 -0.923667049042604 -0.970670992218062 -1.01980793602429 -1.07115811538529 -1.12480281571188 -1.18082410459697 -1.23930451587217 -1.30032668001997 -1.36397289425269 -1.43032462481261 -1.499461933208 -1.57146281716914 -1.64640245607676 -1.72435234947224 -1.80537933599171 -1.88954447866281 -1.97690180094771 -2.06749685619344 -2.16136511124328 -2.25853012284965 -2.35900148319027 -2.46277250819851 -2.56981763955178 -2.68008952798688 -2.79351576209768 -2.90999520288103 -3.02939387999244 -3.1515404009095 -3.27622081892964 -3.40317290009611 -3.53207972269209 -3.66256253580271 -3.79417279554497 -3.92638328882666 -4.05857824482775 -4.19004232370442 -4.31994836018724 -4.44734372666204 -4.57113516585191 -4.69007192721505 -4.80272702347392 -4.90747640411777 -5.00247582107452 -5.08563513781189 -5.15458980665786 -5.20666920986256 -5.23886152755949 -5.24777475999967 -5.22959349186516 -5.18003094272149 -5.09427579929965 -4.9669332718215 -4.79195975745871 -4.56259042865021 -4.27125899173817 -3.90950878149179 -3.46789426876744 -2.93587196091541 -2.30167956660669 -1.55220217743148 -0.67282408671821 0.352735279789828 1.54260300794649 2.91695377862393 4.49823245221708 6.31140043361669 8.38420833768885 10.747497741309 13.435535102035 16.4863812485176 19.9423002069962 23.8502115253205 28.2621906948518 33.2360227557401 38.835814707301 45.1326729379157 52.205452543981 60.1415861315237 69.038000494405 79.0021304476205 90.1530400718951 102.622662706394 116.557172220735 132.118499417576 149.486008876088 168.858353159223 190.455523089989 214.52111477188; -0.45609298923248 -0.482393733767582 -0.509969130698635 -0.53887676959581 -0.569176376240954 -0.600929836284739 -0.634201211085844 -0.669056744381542 -0.705564858269932 -0.743796136795747 -0.783823295222062 -0.825721132837107 -0.86956646688606 -0.915438044929464 -0.963416432609524 -1.01358387344965 -1.06602411691722 -1.12082221054067 -1.17806425138449 -1.23783709164512 -1.30022799253025 -1.3653242199185 -1.43321257455782 -1.50397884874193 -1.57770720049633 -1.65447943529838 -1.73437418424069 -1.81746596631017 -1.9038241210851 -1.99351159663463 -2.08658357572341 -2.18308592156132 -2.28305342227551 -2.38650781099721 -2.49345553592639 -2.60388525193631 -2.71776500217947 -2.83503905472397 -2.95562435545012 -3.07940655423155 -3.20623555677171 -3.33592054931584 -3.46822443775963 -3.60285763636941 -3.73947113435147 -3.87764876078829 -4.01689855991942 -4.15664317929653 -4.29620916289131 -4.43481502967401 -4.57155800539323 -4.70539926114414 -4.83514749666921 -4.9594406890353 -5.07672580819725 -5.1852362797991 -5.2829669521645 -5.36764629855221 -5.43670555714 -5.48724447956052 -5.51599332382849 -5.51927068881615 -5.49293674466283 -5.4323413662158 -5.33226662431445 -5.18686303192382 -4.98957887821363 -4.73308191302258 -4.40917256603342 -4.00868779862724 -3.5213945909164 -2.93587196091541 -2.23938029613638 -1.41771664891896 -0.455054504226835 0.666233628967206 1.96577262581136 3.46540216891479 5.18941741548165 7.16483537214917 9.42168970156224 11.9933569722491 14.9169176811868 18.2335557297526 21.9890004220702 26.234015483974 31.0249400752368 36.4242872920885 42.501406236662 49.3332143706426 57.0050075784926 65.6113561482773 75.2570957431667 86.0584233928145 98.144109590591 111.656838750667 126.754691569915 143.61278426646 162.425081243737 183.406399471944 206.794624805258; -0.439223988587374 -0.465812018033896 -0.493691214036481 -0.52292020056795 -0.553559810588717 -0.585673115511408 -0.619325447363629 -0.654584412347671 -0.691519894331773 -0.730204046624698 -0.770711270181803 -0.813118176164295 -0.857503530521349 -0.903948177984608 -0.95253494255312 -1.00334850120068 -1.05647522715299 -1.11200299865522 -1.17002096867604 -1.23061929046848 -1.29388879332316 -1.35992060220215 -1.42880569422209 -1.50063438415835 -1.57549573025767 -1.65347685066639 -1.73466213969485 -1.81913237193406 -1.90696368090611 -1.99822639745101 -2.09298373141405 -2.1912902783831 -2.29319033121494 -2.39871597386334 -2.50788493255651 -2.62069815664158 -2.73713709839166 -2.85716065772521 -2.98070175408383 -3.10766348361513 -3.23791481527023 -3.3712857744041 -3.50756205691024 -3.64647901077252 -3.78771491511345 -3.93088347929059 -4.07552547626491 -4.22109941525128 -4.36697114846936 -4.51240229553851 -4.65653735658942 -4.79838937137097 -4.93682396637386 -5.07054161511847 -5.19805791809248 -5.31768168818456 -5.42749060463693 -5.52530417329899 -5.60865370305406 -5.67474897742765 -5.72044126625882 -5.74218228458106 -5.73597866413543 -5.69734145680619 -5.62123013826296 -5.50199052369953 -5.33328594521064 -5.10802097141638 -4.81825687373549 -4.45511795945821 -4.00868779862724 -3.46789426876744 -2.82038222767425 -2.05237249863455 -1.14850571334666 -0.0916694040312782 1.13719343376226 2.55929627405736 4.19824366317599 6.08029089601126 8.23463142337161 10.6937149284675 13.4935993207165 16.6743402378214 20.2804220259565 24.3612345867005 28.9716009422567 34.1723608821647 40.0310166202518 46.6224470156765 54.0296976028379 62.3448544386003 71.6700106193602 82.1183352534291 93.8152557053697 106.899765068631 121.525868082521 137.864180101835 156.103695266296 176.453741717749 199.146143592875; -0.422581365000413 -0.449289040065492 -0.477295899730002 -0.506661177169134 -0.537446366615394 -0.569715257684165 -0.603533962877085 -0.638970937010884 -0.676096987160179 -0.714985271525434 -0.755711285439916 -0.79835283250974 -0.842989978636653 -0.889704986401316 -0.938582226982558 -0.989708066452106 -1.043170722911 -1.09906009051919 -1.15746752600949 -1.2184855927655 -1.28220775697621 -1.34872802974977 -1.4181405483707 -1.49053908910982 -1.56601650313686 -1.64466406613265 -1.72657073114181 -1.81182227303556 -1.90050031165669 -1.99268119928093 -2.08843475643528 -2.1878228383492 -2.29089771235915 -2.39770022442187 -2.50825773049322 -2.62258176587462 -2.74066542268838 -2.86248040238869 -2.98797370661121 -3.11706392567595 -3.24963707964307 -3.38554196193543 -3.52458493013431 -3.66652408257122 -3.81106275271778 -3.95784224604977 -4.10643373595612 -4.25632922629673 -4.40693147829285 -4.55754278846004 -4.70735249215512 -4.85542305388131 -5.00067459064521 -5.14186765823307 -5.27758411210762 -5.40620583453568 -5.52589109733759 -5.63454830507869 -5.72980683635141 -5.80898467075003 -5.86905245591584 -5.90659363229307 -5.9177601926144 -5.89822360822083 -5.84312040466087 -5.74699181410767 -5.60371687142873 -5.40643825362761 -5.14748008817766 -4.81825687373549 -4.40917256603342 -3.9095087814918 -3.30730096025737 -2.5892012078477 -1.74032639913311 -0.744089978655588 0.417984274235041 1.76646842991711 3.32425865945107 5.11682789227247 7.17250546808179 9.52278664357019 12.2026751165842 15.2510620641142 18.7111455594337 22.630894641525 27.0635627606939 32.0682558225139 37.7105606029568 44.0632399162781 51.2070015900343 59.2313490452635 68.2355221018183 78.3295375373316 89.6353399324395 102.288074444732 116.437494380585 132.249517789849 149.907948806862 169.616381117541 191.600302762845; -0.406210826597399 -0.43289330351317 -0.460875633183478 -0.490217289185218 -0.520980040158683 -0.553227988156802 -0.587027600618304 -0.622447734760535 -0.659559653033638 -0.69843702810618 -0.739155935661182 -0.781794833068691 -0.826434521764249 -0.873158090899173 -0.922050839535628 -0.97320017433387 -1.02669547931711 -1.08262795389751 -1.14109041490021 -1.20217705782663 -1.26598317204788 -1.33260480400824 -1.40213836184123 -1.4746801540486 -1.5503258540591 -1.62916988155895 -1.71130469046086 -1.79681995224195 -1.88580162212137 -1.97833087415224 -2.07448288975638 -2.17432548251583 -2.27791754013787 -2.38530726240684 -2.49653017160797 -2.61160686932967 -2.73054051069535 -2.85331396391487 -2.97988661954576 -3.11019080998049 -3.24412779538803 -3.3815632675918 -3.52232231811372 -3.66618381080166 -3.81287409302537 -3.96205997230949 -4.11334087739772 -4.26624011403042 -4.42019511608034 -4.57454658202888 -4.72852637497163 -4.88124405129563 -5.03167186874102 -5.17862810859942 -5.32075852914897 -5.45651574790363 -5.58413632866344 -5.70161532547591 -5.80667800921433 -5.89674847328081 -5.9689147826547 -6.01989029480561 -6.04597074151412 -6.04298661699448 -6.00625036945237 -5.93049783985076 -5.8098233326606 -5.63760763814694 -5.40643825362761 -5.10802097141638 -4.73308191302258 -4.27125899173817 -3.71098167802187 -3.03933782300496 -2.24192616379761 -1.30269298874595 -0.203751279915588 1.07481952775811 2.55519522779562 4.26205223842174 6.22283922839087 8.4680777525643 11.031694970915 13.9513918490608 17.2690505970303 21.031185499348 25.2894417276629 30.1011472114258 35.5299231774125 41.6463595605523 48.5287621424921 56.263978997157 64.9483146215119 74.6885410127912 85.6030159294963 97.8229196522447 111.493622752906 126.776198698336 143.849096571588 162.909990803416 184.177826586203; -0.390150451943027 -0.416683179471138 -0.444510098700442 -0.473690605064128 -0.504286407359515 -0.536361569381663 -0.569982545596043 -0.605218209693224 -0.642139874719669 -0.680821303312831 -0.721338706383871 -0.76377072838555 -0.80819841707375 -0.854705175416213 -0.903376693018628 -0.954300854123038 -1.00756761888325 -1.06326887423278 -1.12149825022844 -1.18235089727273 -1.2459232190852 -1.31231255570113 -1.38161681011983 -1.45393401149615 -1.52936180696121 -1.60799687326227 -1.68993423841823 -1.77526650248624 -1.86408294531366 -1.95646850779711 -2.05250263167094 -2.15225794118656 -2.25579874820363 -2.36317936017627 -2.47444216825945 -2.58961549026097 -2.70871114039586 -2.83172169473506 -2.95861741784637 -3.08934281236958 -3.22381274910869 -3.36190813062235 -3.50347103619914 -3.64829929046758 -3.79614039165251 -3.94668472858686 -4.09955800795055 -4.25431280475827 -4.41041913976947 -4.56725397715201 -4.72408952429061 -4.88008020297604 -5.03424814721347 -5.18546706740555 -5.33244430354171 -5.47370087108614 -5.60754928231163 -5.73206890266251 -5.84507857611417 -5.94410622516961 -6.02635509980944 -6.08866631507468 -6.12747727866174 -6.13877556756108 -6.11804776594629 -6.06022272474945 -5.95960864611772 -5.8098233326606 -5.60371687142873 -5.33328594521065 -4.98957887821363 -4.56259042865021 -4.0411452362309 -3.41276871701631 -2.66354407034585 -1.77795392135289 -0.738704966477705 0.473466183167295 1.88000795647437 3.50479178181024 5.37437549111007 7.51829486607243 9.96938630872661 12.7641439334493 15.9431147254765 19.5513357955898 23.6388181858017 28.2610821507948 33.4797493592947 39.3631980336872 45.9872876807786 53.4361607680175 61.8031294747652 71.1916565051066 81.7164398958146 93.5046127999104 106.6970703833 121.449937250813 137.936190231409 156.347452914555 176.89598005646; -0.374431576050178 -0.400708046953264 -0.428267627177708 -0.457169360201092 -0.487474607563206 -0.51924709313246 -0.552552941797906 -0.587460711476091 -0.624041417178292 -0.662368545723421 -0.702518059503445 -0.744568387509316 -0.788600401604126 -0.834697375783927 -0.882944925892698 -0.93343092695336 -0.986245404938104 -1.04148039942505 -1.0992297931702 -1.15958910415952 -1.22265523519034 -1.28852617545922 -1.35730064799848 -1.4290776960988 -1.50395620107396 -1.58203432285682 -1.66340885395442 -1.74817447622433 -1.83642290875317 -1.92824193380851 -2.02371428638473 -2.12291639125542 -2.22591692966373 -2.33277521580907 -2.44353936110294 -2.55824420174658 -2.67690896250255 -2.7995346265651 -2.92610097814818 -3.05656328077264 -3.19084855020771 -3.32885137656518 -3.47042924511186 -3.61539729990704 -3.76352248833068 -3.91451701788323 -4.06803104924156 -4.2236445413717 -4.38085815544533 -4.53908311429016 -4.69762990302421 -4.85569568426654 -5.01235028775878 -5.16652061923579 -5.31697331679644 -5.46229546468105 -5.600873154073 -5.73086765810424 -5.85018896343132 -5.95646637330784 -6.04701586673665 -6.11880386473085 -6.1684070176116 -6.19196758624636 -6.18514394477059 -6.14305568218267 -6.06022272474945 -5.93049783985075 -5.74699181410767 -5.50199052369953 -5.18686303192382 -4.79195975745871 -4.30649965552771 -3.71844524222277 -3.0143641684901 -2.17927591347788 -1.19648201571391 -0.0473780934023669 1.28875427967486 2.83497798045269 4.61695538869201 6.66323069814129 9.00554237591207 11.6791689642303 14.7233117558584 18.1815182471383 22.1021506845161 26.5389044757051 31.5513817399064 37.2057258277556 43.5753232565142 50.7415801856009 58.7947813087135 67.8350398690208 77.9733484215637 89.33274098126 102.049578315949 116.274969382971 132.176343277258 149.939187572534 169.768970610224; -0.359079584272906 -0.385009316243526 -0.412206460411524 -0.440729474260261 -0.470639126303667 -0.501998542412421 -0.534873246925895 -0.569331197484319 -0.605442812377073 -0.643280989048493 -0.68292111223037 -0.72444104997855 -0.767921135677473 -0.813444133838805 -0.861095187255941 -0.91096174278204 -0.963133452672405 -1.01770204806864 -1.07476118079838 -1.13440622921603 -1.19673406331208 -1.26184276376576 -1.32983128900253 -1.4007990836371 -1.47484562092739 -1.55206987102747 -1.63256968589849 -1.71644109070667 -1.80377747039567 -1.89466863885525 -1.9891997767055 -2.08745022216179 -2.18949209772382 -2.29538875352481 -2.40519300606382 -2.51894514870439 -2.63667070773141 -2.75837791488856 -2.88405486414189 -3.01366631689788 -3.14715011601088 -3.2844131646051 -3.42532692096645 -3.56972235548024 -3.71738430974869 -3.86804519155746 -4.02137793220698 -4.17698812480955 -4.33440525339667 -4.49307291299305 -4.65233791009694 -4.81143812115065 -4.96948897347169 -5.12546839860917 -5.27820009204668 -5.42633489542788 -5.56833009785607 -5.70242643111468 -5.82662250965325 -5.93864643963982 -6.03592429202815 -6.1155451021306 -6.17422202229636 -6.20824921460964 -6.21345402664142 -6.18514394477059 -6.11804776594628 -6.00625036945237 -5.84312040466087 -5.62123013826296 -5.33226662431445 -4.9669332718215 -4.51484078662969 -3.96438635608121 -3.30261982518139 -2.51509548066381 -1.5857079130335 -0.496510264929111 0.772487004646277 2.24353890831631 3.94141255710811 5.89366015407866 8.13092114980586 10.6872566498417 13.600519490397 16.9127637590677 20.6706979359309 24.9261862708406 29.7368034996502 35.1664485402713 41.2860234043363 48.174184217735 55.9181719700377 64.6147314160764 74.3711274407972 85.3062691798049 97.5519532726461 111.254238824685 126.57496797842 143.693447459569 162.808308081872; -0.344114623229625 -0.36962134668585 -0.396375886120831 -0.424435914304486 -0.453861397942433 -0.48471464555917 -0.517060350502776 -0.550965628049724 -0.586500045454942 -0.623735643643364 -0.662746949073338 -0.70361097411736 -0.746407204099818 -0.791217568902276 -0.838126396791909 -0.887220347845154 -0.938588324023382 -0.992321352606979 -1.04851243930486 -1.10725638692396 -1.16864957500281 -1.23278969528027 -1.29977543727831 -1.36970611762103 -1.44268124598338 -1.51880001975451 -1.59816073860423 -1.68086012914707 -1.76699256879606 -1.85664919667694 -1.9499168981194 -2.04687714774171 -2.14760469448256 -2.2521660700925 -2.3606179005571 -2.47300499766475 -2.58935820542962 -2.70969197330951 -2.83400162509047 -2.96226028891342 -3.09441545015791 -3.2303850847361 -3.37005332574301 -3.51326561131067 -3.65982325587099 -3.80947738078804 -3.96192213341138 -4.11678711595688 -4.27362893716329 -4.43192179031503 -4.59104695086939 -4.75028107547432 -4.90878317149515 -5.06558009215624 -5.21955039690526 -5.36940639946556 -5.51367420708367 -5.65067153351123 -5.77848304507313 -5.89493297353002 -5.99755470108688 -6.08355699154162 -6.14978650689381 -6.19268621039266 -6.20824921460964 -6.19196758624636 -6.13877556756108 -6.04298661699448 -5.89822360822083 -5.69734145680619 -5.4323413662158 -5.09427579929965 -4.67314318673627 -4.1577712792793 -3.53568793497676 -2.79297800465588 -1.91412483760305 -0.881834773097557 0.323157189290927 1.72230253869135 3.3394774303478 5.20124633394469 7.33715385325368 9.78004770262938 12.5664361410347 15.7368835126393 19.3364479280938 23.415165546207 28.0285863862093 33.2383671207941 39.1129268749027 45.7281726905226 53.1683020199744 61.5266903863058 70.9068732072829 81.4236317276506 93.2041940523509 106.389563431733 121.135987230067 137.616581423717 156.023127039343; -0.329552237014048 -0.354572269357503 -0.38081725642791 -0.408343918884481 -0.437211245645101 -0.467480542886538 -0.499215478479386 -0.532482120879297 -0.567348971367659 -0.603886988391553 -0.642169602593164 -0.68227272094081 -0.724274718175617 -0.768256413567156 -0.81430103072591 -0.862494137947253 -0.912923566257978 -0.965679301998771 -1.02085335040092 -1.07853956619871 -1.13883344685625 -1.2018318834732 -1.26763286386387 -1.3363351216705 -1.40803772466943 -1.48283959464938 -1.56083895037679 -1.64213266420473 -1.72681552181925 -1.81497937343918 -1.90671216347965 -2.00209682424295 -2.10121001759711 -2.20412070682668 -2.3108885388725 -2.42156201499832 -2.53617642550878 -2.65475152147038 -2.77728889342846 -2.90376902383637 -3.03414797628647 -3.16835368061744 -3.30628176852824 -3.44779090941088 -3.59269759067037 -3.74077028077657 -3.89172290662708 -4.04520756942464 -4.20080641511239 -4.35802256638181 -4.51627001328056 -4.67486234839797 -4.83300022038387 -4.98975736603659 -5.14406506624223 -5.29469485450741 -5.44023928853485 -5.57909057505981 -5.70941681579132 -5.82913561755871 -5.9358847824018 -6.02698976308532 -6.09942753605972 -6.14978650689381 -6.17422202229636 -6.1684070176116 -6.12747727866174 -6.04597074151412 -5.9177601926144 -5.73597866413543 -5.49293674466283 -5.18003094272149 -4.78764214931117 -4.30502314464495 -3.72017398265681 -3.0197039634414 -2.18867876737028 -1.21045117382358 -0.0664736207689263 1.26390932286349 2.80369070377092 4.57845550677635 6.61666215909352 8.94995409736463 11.6135045826152 14.6463982844573 18.0920535274758 21.9986895034817 26.419843207334 31.4149413558717 37.0499331041877 43.397989986585 50.5402801872311 58.5668249945541 67.5774461213312 77.6828134874789 89.0056040739676 101.681783574171 115.862023804515 131.713270201942 149.420475245052; -0.315403936147946 -0.339884724056868 -0.365564901302962 -0.392500096773453 -0.420748174669642 -0.450369284240293 -0.481425905242072 -0.513982888190422 -0.54810748834073 -0.583869392201903 -0.62134073523088 -0.66059610918543 -0.701712557421948 -0.744769556212705 -0.789848979920736 -0.83703504760779 -0.886414248358466 -0.938075242278755 -0.992108733766108 -1.04860731324698 -1.10766526313221 -1.1693783232457 -1.23384341043283 -1.30115828644504 -1.3714211675209 -1.44473026833333 -1.52118327214023 -1.60087671805298 -1.68390529531335 -1.77036103333532 -1.86033237501022 -1.95390311938029 -2.05115121824132 -2.15214740952407 -2.25695366840882 -2.36562145502796 -2.47818973528639 -2.59468274875465 -2.71510749473839 -2.83945090447138 -2.967676663884 -3.09972164753098 -3.23549191997949 -3.37485825621943 -3.51765112741224 -3.66365509248942 -3.81260252968912 -3.96416663501067 -4.1179536067036 -4.27349392620648 -4.4302326363254 -4.58751850679344 -4.74459196557312 -4.90057166123377 -5.05443950732376 -5.20502404371654 -5.35098193227844 -5.4907773847075 -5.62265929882727 -5.74463585577167 -5.85444630412382 -5.94952962790809 -6.02698976308532 -6.08355699154162 -6.1155451021306 -6.11880386473085 -6.08866631507468 -6.01989029480561 -5.90659363229307 -5.74218228458106 -5.51927068881615 -5.22959349186516 -4.86390773879232 -4.41188450353486 -3.86198883751519 -3.20134679297646 -2.4155981463294 -1.48873330143225 -0.402912692029775 0.861733175060688 2.32732509079333 4.01848020060946 5.96258325880758 8.19008685758077 10.7348437009103 13.6344743175741 16.9307739657411 20.6701628775674 24.9041844298707 29.6900563107131 35.091280286429 41.1783167646534 48.0293310021647 55.7310185284033 64.3795181536027 74.0814218125757 84.9548914701673 97.130894392018 110.754569275326 125.986737050756 143.005571621646; -0.301677706003669 -0.325576519120447 -0.350646947363893 -0.376943412708717 -0.404522533396772 -0.433443174069791 -0.463766491902233 -0.495555977838127 -0.528877491917246 -0.563799291543549 -0.6003920514013 -0.63872887355976 -0.678885286124156 -0.720939228586592 -0.764971021803483 -0.811063320273451 -0.859301044108621 -0.909771287779838 -0.962563202369093 -1.01776784767665 -1.07547801010177 -1.13578798174017 -1.19879329561265 -1.26459041135355 -1.33327634503606 -1.40494823609033 -1.47970284346886 -1.55763596232582 -1.63884175149215 -1.72341196093648 -1.811435047192 -1.90299516338799 -1.9981710090388 -2.09703452309651 -2.19964940194914 -2.30606942202613 -2.41633654443454 -2.53047877657144 -2.64850776291355 -2.77041607414672 -2.89617416043402 -3.0257269308971 -3.15898991726376 -3.29584497507178 -3.43613547077019 -3.57966089747059 -3.7261708559177 -3.87535833040588 -4.02685218179761 -4.18020877142329 -4.33490262037543 -4.49031599845794 -4.64572732571088 -4.80029825688648 -4.95305930537614 -5.10289384774074 -5.24852033302153 -5.38847250223523 -5.52107740269394 -5.64443095882867 -5.75637083580315 -5.85444630412382 -5.9358847824018 -5.99755470108688 -6.03592429202815 -6.04701586673665 -6.02635509980944 -5.9689147826547 -5.86905245591584 -5.72044126625882 -5.51599332382849 -5.24777475999967 -4.90691160027419 -4.48348547345515 -3.96641807461964 -3.3433431848717 -2.60046492423491 -1.72240077406828 -0.692007750651399 0.509810059466942 1.90431458084837 3.51516963478193 5.36870204769564 7.49419065631889 9.92418616586259 12.6948651295441 15.8464216627204 19.4235008861694 23.4756785144989 28.0579914714945 33.2315249291157 39.0640617359662 45.63080083013 53.0151519265548 61.3096145376855 70.6167502354723 81.050258001741 92.7361635516234 105.814134661682 120.438935802054 136.782036773077; -0.288378460768166 -0.3116612217561 -0.336086051414407 -0.361706071304365 -0.388576555136332 -0.416754979012696 -0.446301067926062 -0.477276837655894 -0.509746631093044 -0.543777147894493 -0.57943746622905 -0.616799055216744 -0.655935776488803 -0.696923873099113 -0.739841943799998 -0.784770900452483 -0.831793906071255 -0.880996290704462 -0.932465442014827 -0.98629066705792 -1.04256302134162 -1.10137510079347 -1.16282079175498 -1.22699497355817 -1.29399316761445 -1.36391112625178 -1.43684435376647 -1.51288755130221 -1.59213397622226 -1.67467470559137 -1.7605977922205 -1.84998730043813 -1.94292220732315 -2.0394751535513 -2.13971102625298 -2.24368535433795 -2.3514424945902 -2.46301358445353 -2.57841423478943 -2.69764193296709 -2.82067312341038 -2.94745992914585 -3.07792647393127 -3.21196476015729 -3.34943005285805 -3.49013571479285 -3.63384743161387 -3.7802767595541 -3.92907392078841 -4.07981976356457 -4.23201679528821 -4.38507918688564 -4.53832163586066 -4.69094696339608 -4.84203230750418 -4.9905137594685 -5.13516927449199 -5.27459966940862 -5.40720750034464 -5.53117359112911 -5.64443095882867 -5.74463585577167 -5.82913561755871 -5.89493297353002 -5.93864643963982 -5.95646637330784 -5.9441062251696 -5.89674847328081 -5.80898467075003 -5.67474897742765 -5.48724447956052 -5.23886152755949 -4.92108724047855 -4.52440523564951 -4.03818454224844 -3.45055654738705 -2.7482787015164 -1.91658357527804 -0.939011711084937 0.202773451832973 1.52919048207942 3.06296679466999 4.82938975003269 6.85658458561555 9.17582202386422 11.8218587005307 14.8333138890998 18.2530863639024 22.1288156499111 26.5133923553353 31.4655227784688 37.0503535277273 43.3401624989772 50.415123223125 58.3641503362548 67.2858347417515 77.2894779370324 88.496235975799 101.040384640076 115.070718615842 130.75209881394; -0.27550844842721 -0.298148685831198 -0.321900057192238 -0.346814309216578 -0.37294529248149 -0.400349011539038 -0.429083671513631 -0.459209720374662 -0.490789885956376 -0.523889206675274 -0.558575054759451 -0.594917150652798 -0.632987567088175 -0.672860721135688 -0.714613352322901 -0.758324484690932 -0.804075370391305 -0.851949412140357 -0.902032061527786 -0.954410689820037 -1.00917442750393 -1.0664139683768 -1.12622133350206 -1.18868958980766 -1.25391251750473 -1.32198421983685 -1.39299866793164 -1.46704917270607 -1.54422777486804 -1.62462454304851 -1.70832676898133 -1.79541804740922 -1.88597722702212 -1.98007721721313 -2.07778363375287 -2.17915326461637 -2.28423233512975 -2.39305454931437 -2.50563888177125 -2.62198709164106 -2.74208092706745 -2.86587898515067 -2.99331318856991 -3.12428483583698 -3.25866017747838 -3.39626546527875 -3.53688141600492 -3.68023702470592 -3.82600265568863 -3.97378233152679 -4.12310513189766 -4.27341560456491 -4.42406308034572 -4.57428977230505 -4.72321752659552 -4.86983307817528 -5.01297164894658 -5.15129870850453 -5.28328969849356 -5.40720750034464 -5.52107740269394 -5.62265929882727 -5.70941681579133 -5.77848304507313 -5.82662250965325 -5.85018896343132 -5.84507857611417 -5.80667800921433 -5.72980683635141 -5.60865370305406 -5.43670555714 -5.20666920986256 -4.91038440963906 -4.53872752353277 -4.08150482587245 -3.52733428750085 -2.86351464207941 -2.07588037646547 -1.14864114912017 -0.0642039823614917 1.19702360053917 2.65685151566405 4.33954837202125 6.27210851037299 8.48454756032223 11.0102295371775 13.8862288190312 17.1537306970014 20.8584745812365 25.0512443759791 29.7884110130434 35.1325326592589 41.1530186950474 47.9268642041625 55.5394624251766 64.0855034006707 73.6699679281445 84.4092268761231 96.4322569893866 109.881985479358 124.916776991156; -0.263067611712753 -0.285045523378222 -0.308102582975672 -0.33228910466473 -0.357657454841516 -0.384262101889224 -0.412159662645646 -0.441408944805785 -0.472070984373058 -0.504209077155832 -0.537888803175806 -0.573178042709494 -0.610146982522275 -0.648868110674211 -0.689416198076164 -0.731868264751403 -0.776303528509466 -0.822803333462716 -0.871451055508933 -0.922331981561889 -0.975533158932671 -1.03114321084327 -1.08925211358629 -1.14995093032539 -1.21333149595488 -1.27948604679745 -1.34850678820971 -1.42048539237852 -1.49551241771847 -1.57367664031375 -1.65506428677517 -1.73975815669448 -1.82783662156105 -1.9193724855463 -2.0144316919443 -2.1130718572656 -2.21534061299714 -2.32127373284366 -2.43089302083252 -2.54420393296925 -2.6611929021478 -2.78182433271656 -2.90603722744535 -3.03374140559107 -3.16481326628122 -3.29909104647664 -3.43636951728943 -3.57639405636122 -3.71885402729019 -3.86337538966313 -4.00951245502658 -4.15673869503436 -4.30443649794583 -4.45188575851713 -4.59825117401464 -4.74256810545945 -4.88372684814763 -5.02045513882952 -5.15129870850453 -5.27459966940862 -5.38847250223524 -5.49077738470751 -5.57909057505982 -5.65067153351123 -5.70242643111468 -5.73086765810425 -5.73206890266251 -5.70161532547591 -5.63454830507869 -5.52530417329899 -5.36764629855221 -5.15458980665786 -4.87831815360178 -4.53009068146806 -4.10014019678829 -3.57755950887466 -2.95017575329522 -2.20441120138579 -1.32512911932324 -0.295463088430302 0.903371969483214 2.29228900350003 3.89456042857435 5.7360744777307 7.8456189357381 10.2551951555638 13.0003655651489 16.1206382105506 19.6598922556585 23.6668487722712 28.1955916114548 33.3061436523937 39.065104283442 45.5463545873997 52.831837385356 61.012420047603 70.1888488136932 80.4728042850457 91.9880687718199 104.871817301312 119.276045339133; -0.251053909472188 -0.272355525469175 -0.294703546952089 -0.318146812526964 -0.342736158752496 -0.368524469354869 -0.395566721368432 -0.423920027455919 -0.453643673561739 -0.484799150940024 -0.517450181474377 -0.551662735067162 -0.587505037721145 -0.625047568763613 -0.664363045470819 -0.705526393136605 -0.748614698390968 -0.793707143309557 -0.8408849175607 -0.890231105509429 -0.941830544834411 -0.995769652810015 -1.05213621595731 -1.1110191382701 -1.17250814266966 -1.23669341972877 -1.30366521702558 -1.37351336173348 -1.44632670821661 -1.52219250147297 -1.60119564623896 -1.68341787042917 -1.76893677032223 -1.85782472350388 -1.95014765402716 -2.04596363253242 -2.14532129216597 -2.24825803902943 -2.35479803355717 -2.46494991663522 -2.57870425141328 -2.6960306485936 -2.81687453947358 -2.94115355713693 -3.06875348189209 -3.19952370230107 -3.33327213787999 -3.4697595637293 -3.60869327090818 -3.74971998923866 -3.89241799133715 -4.0362882879447 -4.18074481497391 -4.32510350201134 -4.4685701002018 -4.61022663437477 -4.74901632982157 -4.88372684814763 -5.01297164894658 -5.13516927449199 -5.24852033302153 -5.35098193227844 -5.44023928853485 -5.51367420708367 -5.56833009785607 -5.600873154073 -5.60754928231163 -5.58413632866344 -5.52589109733759 -5.42749060463693 -5.2829669521645 -5.08563513781189 -4.82801305088058 -4.50173281786575 -4.09744257718739 -3.60469766359781 -3.01184007514686 -2.30586497636327 -1.47227285951332 -0.494905840102624 0.644233598269361 1.965183272629 3.49024344265148 5.24422270326301 7.25471014556949 9.55237656967287 12.1713078267575 15.1493736926052 18.5286360336912 22.3558004238212 26.6827158078751 31.5669272940228 37.0722876916376 43.2696340044192 50.2375357428994 58.0631226440939 66.8430001858397 76.6842621673474 87.7056106045356 100.038594268623 113.828978390043; -0.2394636024809 -0.260080037558003 -0.28170963657948 -0.304399732429571 -0.328199599633009 -0.353160502879451 -0.379335742669401 -0.406780697369653 -0.435552860870412 -0.465711874929241 -0.497319555167581 -0.530439909552419 -0.565139148047303 -0.60148568195155 -0.639550111262407 -0.679405198190028 -0.721125824727108 -0.764788931921493 -0.810473438218114 -0.858260133923278 -0.908231548496159 -0.960471786985608 -1.01506633150089 -1.07210180312815 -1.13166567917524 -1.19384596004007 -1.25873077934627 -1.32640795026702 -1.3969644401566 -1.47048576471999 -1.54705529196623 -1.62675344509821 -1.70965679228204 -1.79583700989697 -1.88535970438143 -1.97828307614385 -2.07465640718349 -2.17451835204668 -2.27789500950688 -2.38479774988012 -2.49522077014497 -2.60913834599959 -2.72650174662782 -2.84723577422495 -2.97123488621645 -3.09835885354479 -3.22842790335576 -3.36121728883442 -3.4964512227643 -3.63379610455032 -3.772852962885 -3.9131490278731 -4.05412833717623 -4.19514127050268 -4.33543289544433 -4.47412999513799 -4.61022663437477 -4.74256810545945 -4.86983307817528 -4.9905137594685 -5.10289384774074 -5.20502404371654 -5.29469485450741 -5.36940639946556 -5.42633489542788 -5.46229546468105 -5.47370087108614 -5.45651574790363 -5.40620583453568 -5.31768168818456 -5.1852362797991 -5.00247582107452 -4.76224310005472 -4.45653252636453 -4.07639600250147 -3.61183864409294 -3.05170326863388 -2.38354245792375 -1.59347687307012 -0.666038361251542 0.416003760970463 1.6718350336807 3.12280876354338 4.7926817007612 6.70787489671991 8.89776241081223 11.394990816619 14.2358327689874 17.4605782377115 21.1139673939399 25.2456695559266 29.9108130655172 35.1705714804943 41.0928120357325 47.7528129537391 55.2340568788657 63.6291084762278 73.0405850838541 83.5822302432828 95.380100969139 108.57388076253; -0.2282915073244 -0.248218293891252 -0.269124727563891 -0.291056616527012 -0.314061652809175 -0.338189459986947 -0.363491638193861 -0.390021805755313 -0.417835636678863 -0.44699089312705 -0.477547451885596 -0.509567323712559 -0.543114664311961 -0.578255775517296 -0.615059095094145 -0.653595173375072 -0.693936634721808 -0.736158121567047 -0.780336218518403 -0.826549353707126 -0.874877674230967 -0.925402892170375 -0.978208097246097 -1.0333775317298 -1.09099632271275 -1.15115016627515 -1.21392495747528 -1.27940635938516 -1.34767930363238 -1.41882741405665 -1.4929323441461 -1.57007301787267 -1.65032476238683 -1.73375831974756 -1.82043872344016 -1.91042402385818 -2.0037638451791 -2.10049775412908 -2.20065341899018 -2.30424453483094 -2.41126848831506 -2.5217037325347 -2.63550683909616 -2.75260919112196 -2.87291327688956 -2.9962885394614 -3.12256673283042 -3.25153672975886 -3.38293872057306 -3.51645773563138 -3.65171641694072 -3.78826695638543 -3.92558210916856 -4.06304518126108 -4.19993887880807 -4.33543289544433 -4.4685701002018 -4.59825117401464 -4.72321752659552 -4.84203230750418 -4.95305930537614 -5.05443950732376 -5.14406506624223 -5.21955039690526 -5.27820009204668 -5.31697331679644 -5.33244430354171 -5.32075852914897 -5.27758411210762 -5.19805791809248 -5.07672580819725 -4.90747640411777 -4.68346767825861 -4.39704560343302 -4.03965401578582 -3.60173475497746 -3.07261704662423 -2.44039498249834 -1.69179183295263 -0.812009792231224 0.215436390583998 1.40890360574726 2.78882429364071 4.37793216347501 6.20151203203773 8.28767633875208 10.6676711631543 13.3762148691744 16.4518728303085 19.9374720542001 23.880559927975 28.3339117509135 33.3560922131949 39.0120765234101 45.3739374887984 52.5216055167199 60.543709240418 69.5385052839967 79.6149065788829 90.8936196358639 103.508402273012; -0.217531221619373 -0.236767715136379 -0.256950257526373 -0.27812312301653 -0.300332410871827 -0.323626092170897 -0.348054054058566 -0.3736681408281 -0.400522191098578 -0.428672070254977 -0.458175697209384 -0.48909306442001 -0.521486249968922 -0.555419420348215 -0.590958822435893 -0.628172762955256 -0.667131573502965 -0.707907558998856 -0.750574927152576 -0.795209696255217 -0.841889578285415 -0.890693833965263 -0.94170309600813 -0.994999156363826 -1.0506647127819 -1.10878306947591 -1.1694377860747 -1.23271226838482 -1.29868929375357 -1.36745046300848 -1.43907557004585 -1.51364187914041 -1.59122329893944 -1.67188944087494 -1.7557045483664 -1.84272628167731 -1.93300434161785 -2.02657891343462 -2.12347891017863 -2.2237199925723 -2.32730233988265 -2.43420814352512 -2.54439879204111 -2.65781171268247 -2.77435683106085 -2.89391260614228 -3.01632159324339 -3.14138548256917 -3.26885955517025 -3.39844649193302 -3.52978946428438 -3.66246442762457 -3.79597153001767 -3.92972553928449 -4.06304518126108 -4.19514127050268 -4.32510350201134 -4.45188575851712 -4.57428977230505 -4.69094696339608 -4.80029825688648 -4.90057166123377 -4.98975736603659 -5.06558009215624 -5.12546839860917 -5.16652061923579 -5.18546706740555 -5.17862810859942 -5.14186765823307 -5.07054161511847 -4.9594406890353 -4.80272702347392 -4.59386395114089 -4.32553814964715 -3.98957338722258 -3.5768349625379 -3.07712384790422 -2.47905944030804 -1.76994970887282 -0.935647399251637 0.0396091861362686 1.17337246963225 2.48518075225569 3.99677424189694 5.73233416908446 7.71874743731992 9.98589951329366 12.566998547829 15.498934034023 18.8226736579172 22.5837023826502 26.8325082332709 31.6251197205181 37.0237003626061 43.0972063396333 49.9221139514107 57.583224252673 66.1745530168437 75.8003150385439 86.576012734501 98.6296400519285; -0.207175323520629 -0.225724172969888 -0.245185558936581 -0.265602220841256 -0.287018663740299 -0.30948120408484 -0.333038013117583 -0.357739157291251 -0.383636635008724 -0.410784408891474 -0.439238432678617 -0.469056671742596 -0.500299116077816 -0.533027784474063 -0.567306718425597 -0.603201964147639 -0.640781540872603 -0.680115393376613 -0.721275326440206 -0.764334918672975 -0.809369412827187 -0.856455579386962 -0.905671549843619 -0.957096615650411 -1.01081098838647 -1.06689551614555 -1.12543135059448 -1.18649955851339 -1.25018067092756 -1.31655416216226 -1.38569785028879 -1.45768720947309 -1.53259458367764 -1.61048828999218 -1.69143159856653 -1.77548157467573 -1.86268776684984 -1.95309072323031 -2.04672031635395 -2.14359385439509 -2.24371395449182 -2.34706615112108 -2.45361620954052 -2.56330711105343 -2.67605567324253 -2.79174876432271 -2.91023906634009 -3.03134033705142 -3.1548221149018 -3.28040380552723 -3.40774808157823 -3.5364535203262 -3.66604639539927 -3.79597153001767 -3.92558210916856 -4.05412833717623 -4.18074481497391 -4.30443649794582 -4.42406308034572 -4.53832163586066 -4.64572732571088 -4.74459196557312 -4.83300022038387 -4.90878317149515 -4.96948897347169 -5.01235028775878 -5.03424814721346 -5.03167186874102 -5.00067459064521 -4.93682396637386 -4.83514749666921 -4.69007192721505 -4.49535607815616 -4.24401640474109 -3.9282445141288 -3.53931578135941 -3.06748811679244 -2.50188983705202 -1.8303954806786 -1.03948828715841 -0.114107922552856 0.962518114779321 2.20906114038787 3.64629789684652 5.29733925100208 7.18788331613887 9.3464955869537 11.8049189483871 14.5984167212855 17.7661522416042 21.3516088387519 25.4030544864211 29.9740558499402 35.124046952334 40.918958231894 47.4319123726504 54.7439939618089 62.9451007717193 72.1348852857085 82.4237959954057 93.9342290010922; -0.197215548169792 -0.215082224999511 -0.233828155441669 -0.2534945505026 -0.274124327185296 -0.295762153159804 -0.318454489222834 -0.342249628959828 -0.367197734942906 -0.393350870708864 -0.42076302766188 -0.449490145934495 -0.479590128116629 -0.511122844624399 -0.544150129326834 -0.578735763877452 -0.61494544900725 -0.652846760823819 -0.692509089925691 -0.734003560879168 -0.777402929313776 -0.822781453569188 -0.870214737467266 -0.919779540384079 -0.971553550354073 -1.02561511544718 -1.08204292811447 -1.14091565659316 -1.20231151679092 -1.26630777732536 -1.33298018957012 -1.40240233364409 -1.47464487026725 -1.54977468728324 -1.62785392840426 -1.70893889035503 -1.79307877306525 -1.88031426586788 -1.970675950787 -2.06418250192386 -2.16083865765219 -2.26063293978992 -2.36353509109812 -2.46949319934049 -2.57843047268587 -2.69024162741695 -2.80478884468131 -2.92189724834314 -3.0413498508179 -3.1628819080445 -3.28617461841252 -3.41084809345064 -3.5364535203262 -3.66246442762457 -3.78826695638543 -3.9131490278731 -4.0362882879447 -4.15673869503436 -4.27341560456491 -4.38507918688564 -4.49031599845794 -4.58751850679344 -4.67486234839797 -4.75028107547432 -4.81143812115065 -4.85569568426654 -4.88008020297603 -4.88124405129563 -4.85542305388131 -4.79838937137097 -4.70539926114414 -4.57113516585191 -4.38964152402802 -4.15425363292257 -3.85751882275808 -3.49110912317893 -3.04572451596242 -2.51098577220952 -1.87531576627389 -1.12580804155318 -0.248081273780667 0.773881865682976 1.95791310228595 3.32385603708483 4.89378473588336 6.69224566640376 8.74652545742184 11.0869472149247 13.7471984189911 16.7646937441425 20.1809764985669 24.042162767421 28.3994327762696 33.3095744669537 38.8355848045626 45.0473349159922 52.0223058036492 59.84640208864 68.6148520233967 78.4332028820163 89.4184217963225; -0.187642943478624 -0.204835323062378 -0.222874025313923 -0.241798745420951 -0.26165082500126 -0.282473295628082 -0.304310920286677 -0.327210232203851 -0.351219570415878 -0.376389111355181 -0.402770895641181 -0.430418849154676 -0.459388797357039 -0.489738471683765 -0.521527506695272 -0.554817426504519 -0.58967161881925 -0.626155294734451 -0.664335432185739 -0.704280700724354 -0.746061364996598 -0.789749164001827 -0.835417162860195 -0.883139573440605 -0.932991539776585 -0.985048883728665 -1.03938780583121 -1.09608453568415 -1.15521492560936 -1.21685398058113 -1.28107531665237 -1.34795053922501 -1.4175485315451 -1.48993464273069 -1.56516976345143 -1.64330927606263 -1.72440186453703 -1.80848816792209 -1.89559925926053 -1.98575492993027 -2.07896175716514 -2.17521093008792 -2.27447580689729 -2.37670917287242 -2.48184016556268 -2.58977082988169 -2.70037226178732 -2.81348029476088 -2.92889067835434 -3.04635369260293 -3.16556813604742 -3.28617461841252 -3.40774808157823 -3.52978946428438 -3.65171641694072 -3.772852962885 -3.89241799133715 -4.00951245502657 -4.12310513189766 -4.23201679528821 -4.33490262037543 -4.4302326363254 -4.51627001328056 -4.59104695086939 -4.65233791009694 -4.69762990302421 -4.72408952429061 -4.72852637497163 -4.70735249215512 -4.65653735658942 -4.57155800539323 -4.44734372666204 -4.27821475735585 -4.05781434454878 -3.77903346234637 -3.43392740184992 -3.01362336871422 -2.50821813127474 -1.90666466099019 -1.19664659504078 -0.364439227216394 0.605244403520649 1.72942390857885 3.02704017826851 4.5191641769134 6.22922804231603 8.18328085304363 10.410271676477 12.9423627863242 15.8152762431117 19.0686773680835 22.7465990133465 26.89791094273 31.5768390928086 36.8435399864347 42.7647361269738 49.4144188158187 56.8746255148269 65.2362996258849 74.6002413893839 85.0781595203105; -0.178448007402501 -0.194975997640945 -0.212317835374531 -0.230511717848537 -0.249597429510761 -0.269616384348418 -0.29061166628974 -0.312628067139247 -0.335712121442968 -0.359912137598807 -0.385278224436607 -0.411862312391436 -0.439718168280933 -0.468901402571933 -0.499469467881712 -0.531481647303375 -0.564999030971559 -0.600084479091678 -0.636802569441408 -0.675219527114578 -0.715403134012507 -0.757422615293277 -0.80134849966225 -0.84725245002377 -0.89520706061066 -0.945285616260387 -0.997561809009963 -1.0521094066305 -1.1090018671109 -1.16831189242227 -1.2301109141427 -1.29446850268882 -1.36145169097656 -1.43112420230988 -1.50354557116159 -1.57877014425359 -1.6568459479512 -1.73781340644391 -1.82170389347654 -1.90853809850301 -1.99832418603994 -2.09105572467796 -2.18670935964074 -2.28524219993897 -2.38658888802013 -2.49065831633213 -2.59732995136428 -2.70644972146383 -2.81782542000565 -2.93122157026984 -3.04635369260293 -3.1628819080445 -3.28040380552723 -3.39844649193302 -3.51645773563138 -3.63379610455032 -3.74971998923866 -3.86337538966313 -3.97378233152679 -4.07981976356457 -4.18020877142329 -4.27349392620648 -4.35802256638181 -4.43192179031503 -4.49307291299305 -4.53908311429016 -4.56725397715201 -4.57454658202888 -4.55754278846004 -4.51240229553851 -4.43481502967401 -4.31994836018724 -4.16238859032689 -3.95607611277056 -3.69423355396261 -3.36928616010469 -2.97277359852956 -2.49525226076052 -1.92618705690812 -1.25383158421176 -0.465095434423703 0.45460272583174 1.52149781191901 2.75365838501069 4.17118596896174 5.79643566128027 7.65426029472439 9.77228064424733 12.1811844373027 14.9150572165482 18.0117484256692 21.5132764446107 25.4662766935235 29.922497359138 34.9393477774368 40.5805050372115 46.9165849556932 54.0258842258094 61.9952012512435 70.9207439775502 80.9091339030349; -0.169620808645219 -0.185496020867381 -0.202153148420255 -0.21962891294507 -0.237961564624621 -0.257190923299928 -0.277358417777007 -0.298507122818927 -0.320681793249066 -0.343928894514172 -0.368296628969511 -0.393834957052034 -0.420595612400113 -0.448632109858668 -0.477999745175115 -0.508755585043083 -0.540958445985512 -0.574668860384838 -0.60994902776339 -0.646862749189688 -0.685475342433537 -0.725853535211899 -0.768065333555545 -0.81217986197996 -0.858267171759302 -0.906398013175229 -0.95664356713858 -1.0090751310562 -1.06376375323209 -1.12077980944536 -1.18019251463043 -1.24206936178983 -1.30647547938904 -1.37347289750584 -1.44311971192474 -1.5154691341679 -1.59056841412552 -1.6684576204775 -1.7491682624682 -1.83272173479165 -1.9191275653459 -2.00838144340243 -2.10046300328697 -2.19533333595587 -2.29293219785041 -2.3931748830887 -2.49594872137763 -2.60110915995744 -2.70847538338842 -2.81782542000565 -2.92889067835434 -3.0413498508179 -3.1548221149018 -3.26885955517025 -3.38293872057306 -3.4964512227643 -3.60869327090818 -3.71885402729019 -3.82600265568863 -3.92907392078841 -4.02685218179761 -4.1179536067036 -4.20080641511239 -4.27362893716329 -4.33440525339667 -4.38085815544533 -4.41041913976947 -4.42019511608034 -4.40693147829285 -4.36697114846936 -4.29620916289131 -4.19004232370442 -4.04331338906829 -3.85024921889277 -3.60439223150033 -3.29852445829458 -2.9245834080535 -2.47356886904292 -1.93543968492384 -1.29899943847764 -0.551769864474067 0.320149311576453 1.33223554976122 2.5017152804043 3.84775405849558 5.39166703541496 7.15715190107451 9.17054667688383 11.4611149911748 14.061361746418 17.0073823945144 20.339249375727 24.1014396518353 28.3433076786079 33.1196086208579 38.4910771197521 44.5250674817898 51.2962617775327 58.8874530219807 67.390411364285 76.9068420498638; -0.161151092542784 -0.176386550342347 -0.192372606881151 -0.209144534271655 -0.226739075266898 -0.24519448313519 -0.26455055984286 -0.284848692065328 -0.306131884480908 -0.328444789728034 -0.351833734324421 -0.376346739754888 -0.402033537832272 -0.42894557932178 -0.457136034692069 -0.48665978571485 -0.51757340647728 -0.54993513219616 -0.583804814028005 -0.619243857852331 -0.656315144764553 -0.695082930747211 -0.735612722690859 -0.777971127605715 -0.822225671498482 -0.868444583981811 -0.916696544232189 -0.967050383410961 -1.01957473810736 -1.07433764874589 -1.13140609621702 -1.19084546923196 -1.25271895406276 -1.31708683739736 -1.38400571200807 -1.45352757378836 -1.5256987974467 -1.60055897674338 -1.67813961360227 -1.75846263870902 -1.84153874430176 -1.92736550775041 -2.01592528218534 -2.10718282785 -2.20108265499022 -2.29754604592459 -2.39646772043419 -2.49771210472934 -2.60110915995744 -2.70644972146383 -2.81348029476088 -2.92189724834314 -3.03134033705142 -3.14138548256917 -3.25153672975886 -3.36121728883442 -3.4697595637293 -3.57639405636122 -3.68023702470592 -3.7802767595541 -3.87535833040588 -3.96416663501067 -4.04520756942464 -4.11678711595688 -4.17698812480955 -4.2236445413717 -4.25431280475827 -4.26624011403042 -4.25632922629673 -4.22109941525128 -4.15664317929653 -4.05857824482775 -3.92199436208441 -3.74139433771647 -3.51062868933444 -3.2228232422195 -2.87029891640842 -2.44448287281502 -1.93581009910465 -1.33361441881782 -0.626007799766282 0.200253281080269 1.15991579032872 2.26939392780503 3.54695043286715 5.01289726454073 6.6898177087125 8.60281218236011 10.7797702443778 13.2516715873782 16.0529190775683 19.2217072333475 22.8004298909074 26.8361312004032 31.3810045331971 36.4929443635994 42.2361567223252 48.6818344088715 55.9089038021259 64.0048508292781 73.0666344497479; -0.153028373699237 -0.167638255773098 -0.182968095167777 -0.199051743637624 -0.215924466599412 -0.23362298175214 -0.252185496115822 -0.271651741033643 -0.292063004619176 -0.313462161060207 -0.335893696112447 -0.359403728029052 -0.384040023074466 -0.40985200466248 -0.436890755037405 -0.465209008282538 -0.494861133290056 -0.525903105159594 -0.558392463307098 -0.592388254359106 -0.627950957678143 -0.665142391109936 -0.704025594259893 -0.744664686291713 -0.787124694891718 -0.831471352654792 -0.877770856717573 -0.926089586987137 -0.976493777783906 -1.02904913713017 -1.08382040726435 -1.14087085923922 -1.20026171366166 -1.26205147874486 -1.32629519586051 -1.39304358168942 -1.46234205486263 -1.5342296336478 -1.60873768975594 -1.6858885417032 -1.76569386934748 -1.84815292920867 -1.93325054795628 -2.02095486898348 -2.11121482425991 -2.20395730063586 -2.29908396643001 -2.39646772043419 -2.49594872137763 -2.59732995136428 -2.70037226178731 -2.80478884468131 -2.91023906634009 -3.01632159324339 -3.12256673283042 -3.22842790335576 -3.33327213787999 -3.43636951728943 -3.53688141600491 -3.63384743161386 -3.7261708559177 -3.81260252968912 -3.89172290662708 -3.96192213341138 -4.02137793220698 -4.06803104924156 -4.09955800795055 -4.11334087739772 -4.10643373595611 -4.07552547626491 -4.01689855991942 -3.92638328882666 -3.7993071142485 -3.63043845379776 -3.41392443053743 -3.14322188629622 -2.81102095273023 -2.40916038784156 -1.92853380184763 -1.35898580363764 -0.689196996624105 0.0934433604316416 1.00297833720763 2.05503940817226 3.26701922239203 4.65826283675472 6.25027936944804 8.06697623710597 10.1349183673737 12.4836150310353 15.1458372168324 18.1579687804667 21.5603949401339 25.3979320676765 29.7203031408717 34.5826636826405 40.046183521706 46.1786902715396 53.0553810459375 60.7596096165222 69.3837569767209; -0.145242016789904 -0.159241430236278 -0.173930882922798 -0.189342837945203 -0.205511116142219 -0.22247093345519 -0.240258936811055 -0.258913238096224 -0.278473445729192 -0.298980693273044 -0.320477664454509 -0.343008613873125 -0.366619382591345 -0.391357407693088 -0.417271724783081 -0.444412962271088 -0.472833326142366 -0.502586573756805 -0.533727975042518 -0.566314259253099 -0.600403545239377 -0.636055252943714 -0.673329993555283 -0.71228943546522 -0.75299614282806 -0.795513383166732 -0.839904900048716 -0.886234646406488 -0.934566473571138 -0.984963770528831 -1.03748904728968 -1.09220345557109 -1.14916623923544 -1.20843410607742 -1.27006051162001 -1.33409484454123 -1.40058150220429 -1.46955884349125 -1.54105800473011 -1.61510156294411 -1.69170202892261 -1.77086015069876 -1.85256300589916 -1.93678185908438 -2.02346975760144 -2.11255883659425 -2.20395730063587 -2.29754604592459 -2.3931748830887 -2.49065831633213 -2.58977082988169 -2.69024162741695 -2.79174876432271 -2.89391260614228 -2.9962885394614 -3.09835885354479 -3.19952370230107 -3.29909104647664 -3.39626546527875 -3.49013571479285 -3.57966089747059 -3.66365509248942 -3.74077028077657 -3.80947738078804 -3.86804519155746 -3.91451701788323 -3.94668472858686 -3.96205997230949 -3.95784224604977 -3.93088347929059 -3.87764876078829 -3.79417279554497 -3.67601163575535 -3.51818918117313 -3.31513789089224 -3.06063308944694 -2.74772018480913 -2.36863404364194 -1.91470968933244 -1.37628340006836 -0.742583186659098 -0.00160752194848168 0.860008925556607 1.85714393301006 3.00635226435397 4.32604779713929 5.83670509893776 7.56108251400868 9.52446903838221 11.7549575019328 14.2837468417546 17.1454765448805 20.3785966630542 24.0257771611285 28.1343607573168 32.756863851951 37.9515306259893 43.7829459261385 50.3227131454559 57.6502039626426 65.853387526458; -0.137781306805233 -0.151186087690688 -0.165251751172011 -0.180009405415282 -0.19549146158093 -0.211731669924456 -0.228765154518793 -0.246628446187986 -0.265359513185152 -0.28499778908424 -0.305584197284281 -0.327161171445797 -0.349772671090836 -0.373464191499847 -0.398282766929031 -0.424276966049878 -0.451496878376733 -0.479994090297157 -0.50982164915169 -0.541034013622703 -0.573686988484184 -0.607837641533377 -0.643544200268605 -0.68086592559265 -0.71986295950467 -0.760596143392372 -0.803126803146378 -0.847516496886183 -0.893826720607314 -0.942118566527088 -0.992452328316299 -1.0448870467498 -1.09947998858372 -1.15628605066304 -1.21535708037251 -1.27674110255664 -1.34048144194084 -1.40661572887443 -1.47517477487413 -1.54618130296075 -1.61964851613586 -1.69557848552304 -1.77396033768093 -1.85476821836141 -1.93795900751409 -2.02346975760144 -2.11121482425991 -2.20108265499022 -2.29293219785041 -2.38658888802013 -2.48184016556268 -2.57843047268586 -2.67605567324253 -2.77435683106085 -2.87291327688955 -2.97123488621645 -3.06875348189209 -3.16481326628122 -3.25866017747837 -3.34943005285805 -3.43613547077019 -3.51765112741223 -3.59269759067036 -3.65982325587099 -3.71738430974869 -3.76352248833067 -3.79614039165251 -3.81287409302536 -3.81106275271777 -3.78771491511345 -3.73947113435147 -3.66256253580271 -3.55276487910751 -3.40534764247584 -3.21501759706874 -2.97585628402743 -2.68125074452773 -2.32381678448761 -1.89531397955345 -1.38655154197164 -0.787284078072984 -0.0860961624244778 0.72972545879533 1.67433334810413 2.76347599230087 4.01467115822743 5.4473977630669 7.08330822085586 8.94646343394255 11.0635928269908 13.4643820741087 16.1817914493076 19.2524080395761 22.7168354014863 26.6201246198618 31.0122511444112 35.948642241556 41.4907604085879 47.7067486608694 54.672144225723 62.4706678651512; -0.130635509880058 -0.143462048202735 -0.156921103171267 -0.17104246334127 -0.185857166775866 -0.201397535894462 -0.217697211035712 -0.234791182345594 -0.252715819547605 -0.271508899091789 -0.291209628112021 -0.311858664545829 -0.333498132687218 -0.356171633349556 -0.379924247711425 -0.404802533802403 -0.430854514456597 -0.458129655418092 -0.486678832122617 -0.516554283501952 -0.547809550960041 -0.580499400450113 -0.614679725338168 -0.650407427467176 -0.687740273535465 -0.726736723568703 -0.7674557278942 -0.809956488614882 -0.854298181123956 -0.900539630695129 -0.948738938621986 -0.998953051757771 -1.05123726861698 -1.10564467443549 -1.1622254967386 -1.22102637202727 -1.28208951315284 -1.34545176579761 -1.41114354120288 -1.47918761087163 -1.54959774740813 -1.62237719392297 -1.69751694251285 -1.77499380019964 -1.85476821836141 -1.93678185908438 -2.02095486898349 -2.10718282785 -2.19533333595588 -2.28524219993897 -2.37670917287243 -2.46949319934049 -2.56330711105343 -2.65781171268247 -2.75260919112196 -2.84723577422495 -2.94115355713694 -3.03374140559107 -3.12428483583698 -3.2119647601573 -3.29584497507178 -3.37485825621944 -3.44779090941088 -3.51326561131067 -3.56972235548024 -3.61539729990704 -3.64829929046758 -3.66618381080166 -3.66652408257122 -3.64647901077252 -3.60285763636942 -3.5320797226921 -3.43013206243949 -3.2925200483349 -3.11421400207396 -2.88958970268362 -2.61236249624297 -2.27551430350585 -1.87121276965403 -1.39072172047186 -0.824302000864072 -0.161101673952168 0.610965549001827 1.50535489696604 2.53703952687803 3.72267543768799 5.08078399887306 6.63195395981173 8.399065003408 10.4075351251104 12.685594359167 15.2645876400056 18.1793098807044 21.4683766755593 25.1746343930369 29.3456138225084 34.0340319770929 39.2983471400815 45.2033727786402 51.8209565411683 59.2307312097713; -0.123793925737341 -0.136059012200527 -0.148929061566588 -0.162432579304676 -0.176599268238888 -0.191460062156892 -0.207047158219937 -0.223394047805515 -0.240535545362717 -0.258507814803066 -0.27734839288568 -0.297096208984248 -0.317791600543691 -0.339476323445582 -0.362193556402534 -0.385987898391499 -0.410905358013313 -0.436993333529228 -0.464300582173312 -0.492877177170645 -0.522774450703471 -0.554044920858732 -0.586742200358543 -0.62092088461761 -0.656636416385601 -0.693944923914999 -0.732903029242577 -0.77356762278166 -0.815995599988543 -0.860243555385328 -0.906367428687889 -0.954422097196078 -1.00446090794751 -1.05653514240932 -1.11069340567676 -1.16698093125481 -1.22543879151004 -1.28610300278434 -1.34900351294866 -1.41416305783085 -1.48159587146339 -1.55130623344855 -1.62328683491419 -1.69751694251285 -1.77396033768093 -1.85256300589916 -1.93325054795628 -2.01592528218534 -2.10046300328697 -2.18670935964074 -2.27447580689729 -2.36353509109812 -2.45361620954052 -2.54439879204111 -2.63550683909616 -2.72650174662782 -2.81687453947358 -2.90603722744535 -2.99331318856991 -3.07792647393127 -3.15898991726376 -3.23549191997949 -3.30628176852824 -3.37005332574301 -3.42532692096645 -3.47042924511186 -3.50347103619914 -3.52232231811372 -3.52458493013432 -3.50756205691024 -3.46822443775963 -3.40317290009611 -3.3085968241304 -3.18022810435555 -3.01329012729155 -2.80244123407277 -2.54171208019991 -2.22443624257897 -1.8431733552099 -1.38962397887438 -0.854535326142949 -0.227596870131217 0.502675237249199 1.34906612530889 2.32580385610597 3.44871621941598 4.73540427640017 6.20543442669755 7.88055096099579 9.78491126820065 11.9453460952033 14.3916475102333 17.1568875004221 20.2777704432907 23.795023033515 27.7538256239426 32.2042893572131 37.2019839256711 42.8085213071568 49.0922013878546 56.1287260062982; -0.117245932671031 -0.128966624940227 -0.141265553323 -0.154169977593512 -0.167708304118784 -0.181910118243072 -0.196806215555822 -0.212428631693938 -0.228810670280452 -0.245986928547366 -0.263993320129703 -0.282867094450079 -0.302646852037484 -0.323372555039694 -0.345085532094794 -0.367828476622655 -0.391645437480688 -0.416581800798563 -0.442684261662278 -0.470000784157554 -0.49858054810414 -0.528473880614403 -0.559732170389271 -0.592407762420016 -0.626553830492633 -0.66222422459001 -0.699473289952347 -0.738355654184801 -0.77892597838929 -0.821238667840278 -0.865347537217471 -0.911305424846325 -0.959163749774182 -1.00897200481923 -1.0607771779641 -1.11462309361776 -1.17054966432975 -1.22859204249981 -1.28877966047287 -1.35113514613238 -1.41567309969072 -1.48239871580951 -1.55130623344855 -1.62237719392297 -1.69557848552304 -1.77086015069876 -1.84815292920868 -1.92736550775041 -2.00838144340243 -2.09105572467796 -2.17521093008792 -2.26063293978992 -2.34706615112108 -2.43420814352512 -2.5217037325347 -2.60913834599959 -2.69603064859361 -2.78182433271656 -2.86587898515067 -2.94745992914585 -3.0257269308971 -3.09972164753098 -3.16835368061744 -3.2303850847361 -3.2844131646051 -3.32885137656518 -3.36190813062236 -3.3815632675918 -3.38554196193544 -3.3712857744041 -3.33592054931584 -3.27622081892964 -3.18857034158274 -3.06891836068946 -2.91273112795193 -2.71493818576788 -2.4698728503516 -2.17120627797366 -1.81187443137792 -1.38399719119534 -0.878788777315721 -0.286458556899394 0.403898781875976 1.20442481911378 2.12863200356789 3.19155264392433 4.40990381654257 5.80226987626422 7.38930443492851 9.19395386902162 11.2417046354071 13.5608569145169 16.1828273661407 19.1424840767021 22.4785171015922 26.2338483650128 30.456085076447 35.198021261314 40.5181924879611 46.4814894087689 53.1598363251529; -0.110981025898512 -0.122174532248816 -0.133920383731638 -0.146244632390724 -0.159174427532986 -0.172738046907986 -0.186964926848526 -0.201885691041659 -0.217532177553353 -0.233937463678466 -0.251135888130087 -0.269163070018025 -0.288055923994467 -0.307852670864872 -0.32859284287298 -0.350317282769558 -0.373068135663876 -0.396888832533856 -0.421824064133904 -0.447919743887138 -0.475222958179392 -0.503781902284208 -0.53364579993892 -0.564864804359688 -0.597489878225406 -0.631572649874098 -0.667165242637568 -0.704320073887443 -0.743089619974454 -0.783526142808809 -0.825681373348225 -0.869606146726501 -0.915349983163883 -0.9629606081447 -1.01248340462092 -1.06396078919498 -1.11743150334283 -1.17292980974975 -1.23048458273643 -1.29011828054017 -1.35184578587288 -1.41567309969072 -1.48159587146339 -1.54959774740813 -1.61964851613586 -1.69170202892261 -1.76569386934748 -1.84153874430176 -1.9191275653459 -1.99832418603994 -2.07896175716514 -2.16083865765219 -2.24371395449182 -2.32730233988265 -2.41126848831506 -2.49522077014497 -2.57870425141328 -2.66119290214779 -2.74208092706745 -2.82067312341038 -2.89617416043402 -2.967676663884 -3.03414797628647 -3.09441545015791 -3.14715011601088 -3.19084855020771 -3.22381274910869 -3.24412779538803 -3.24963707964307 -3.23791481527023 -3.20623555677171 -3.1515404009095 -3.07039951612907 -2.95897060809086 -2.81295288759594 -2.62753606125487 -2.3973438144628 -2.11637120010043 -1.77791528431267 -1.37449833210332 -0.897782739633205 -0.338476836260332 0.313769413329475 1.07047987901481 1.94448009252943 2.95003874272798 4.10302428779832 5.42107828637118 6.92380721857626 8.63299475500849 10.5728366381737 12.770200569353 15.2549137462487 18.0600809757882 21.2224365948544 24.7827337725883 28.7861751446716 33.2828891464463 38.3284568720048 43.9844947951428 50.3192992503712; -0.104988850028207 -0.115672428499689 -0.126883300672957 -0.138646349142996 -0.150987505900069 -0.163933782326589 -0.177513298228199 -0.191755309586187 -0.206690234674687 -0.222349678137182 -0.238766452562235 -0.2559745970374 -0.27400939209223 -0.292907370365426 -0.312706322246653 -0.333445295649305 -0.355164588965639 -0.37790573613895 -0.40171148265753 -0.426625751130705 -0.452693594946594 -0.47996113833268 -0.508475500941928 -0.538284704866784 -0.569437561738709 -0.601983537299158 -0.635972590526412 -0.671454984067968 -0.708481062356953 -0.747100993379153 -0.787364469600573 -0.82932036305892 -0.873016329061037 -0.918498352305886 -0.965810228562997 -1.01499297427194 -1.06608415558156 -1.11911712740955 -1.1741201720637 -1.23111552581526 -1.29011828054017 -1.35113514613237 -1.41416305783085 -1.47918761087163 -1.54618130296075 -1.61510156294411 -1.6858885417032 -1.75846263870902 -1.83272173479165 -1.90853809850301 -1.98575492993027 -2.06418250192386 -2.14359385439509 -2.2237199925723 -2.30424453483094 -2.38479774988012 -2.46494991663522 -2.54420393296925 -2.62198709164106 -2.69764193296708 -2.77041607414672 -2.83945090447138 -2.90376902383637 -2.96226028891342 -3.01366631689788 -3.05656328077264 -3.08934281236958 -3.11019080998049 -3.11706392567595 -3.10766348361513 -3.07940655423155 -3.02939387999244 -2.95437431616036 -2.85070541430841 -2.71430973689746 -2.54062644761653 -2.32455767397911 -2.06040908537262 -1.74182407083973 -1.36171083573766 -0.912161664418836 -0.384363516480775 0.231500963854275 0.94636304293424 1.77238922266724 2.72311553937741 3.81359621197231 5.06056816008665 6.48263307338897 8.10045889067077 9.93700274346483 12.017757635725 14.3710253707225 17.0282185011723 20.0241943713588 23.3976246436136 27.1914040591566 31.4531025786335 36.2354654846247 41.5969665113463 47.6024196005606; -0.0992592263113494 -0.109450097680316 -0.120144050195043 -0.131364835378647 -0.143137207761988 -0.155486953722586 -0.168440919426709 -0.182027037578828 -0.196274352641184 -0.211213044139895 -0.226874447622263 -0.243291072772166 -0.26049661812592 -0.278525981759119 -0.297415267234769 -0.317201784013783 -0.33792404142942 -0.359621735216608 -0.382335725463888 -0.406108004718783 -0.430981654825027 -0.457000790900869 -0.484210490679472 -0.512656707223547 -0.542386162794244 -0.5734462213967 -0.605884737238662 -0.639749876021243 -0.675089905628765 -0.71195295239404 -0.750386718682328 -0.790438157056816 -0.832153095756036 -0.875575809623308 -0.920748529974142 -0.967710886162567 -1.01649927080414 -1.06714611972355 -1.11967909670897 -1.1741201720637 -1.23048458273643 -1.28877966047287 -1.34900351294866 -1.41114354120288 -1.47517477487413 -1.54105800473011 -1.60873768975594 -1.67813961360227 -1.7491682624682 -1.82170389347654 -1.89559925926053 -1.970675950787 -2.04672031635395 -2.12347891017863 -2.20065341899018 -2.27789500950688 -2.35479803355717 -2.43089302083252 -2.50563888177125 -2.57841423478943 -2.64850776291355 -2.71510749473839 -2.77728889342846 -2.83400162509047 -2.88405486414189 -2.92610097814818 -2.95861741784637 -2.97988661954576 -2.98797370661121 -2.98070175408383 -2.95562435545012 -2.90999520288103 -2.84073436164844 -2.74439088557963 -2.61710138299072 -2.45454410116958 -2.25188805174304 -2.00373664870148 -1.70406527495734 -1.34615213152177 -0.922501655074199 -0.424759714186157 0.15638028901458 0.831281377229483 1.61147808391743 2.50980384701345 3.54053201532419 4.71953191025833 6.06444153784039 7.59485871429135 9.33255255452891 11.3016974786108 13.5291321184793 16.0446457586438 18.8812952221822 22.0757554204354 25.6687071240863 29.7052658883716 34.2354564797092 39.3147376092114 45.0045822849801; -0.0937821752779933 -0.103497448323601 -0.11369242435881 -0.124389762115621 -0.135613078435689 -0.147386975977871 -0.159737070094055 -0.172690014593745 -0.186273526078638 -0.20051640648455 -0.215448563419026 -0.231101027828245 -0.247505968465727 -0.264696702567261 -0.282707702060528 -0.301574594553274 -0.321334158249738 -0.342024309840079 -0.363684084290944 -0.386353605335438 -0.410074045316494 -0.434887572877182 -0.46083728681323 -0.487967134205039 -0.516321810726492 -0.545946640783744 -0.576887434866085 -0.609190321190223 -0.64290154838558 -0.678067255598031 -0.714733205978909 -0.752944479070852 -0.792745117097324 -0.834177719603129 -0.877282980273135 -0.922099159069233 -0.968661482064175 -1.0170014605074 -1.06714611972355 -1.11911712740955 -1.17292980974975 -1.22859204249981 -1.28610300278434 -1.34545176579761 -1.40661572887443 -1.46955884349125 -1.5342296336478 -1.60055897674338 -1.6684576204775 -1.73781340644391 -1.80848816792209 -1.88031426586788 -1.95309072323031 -2.02657891343462 -2.10049775412908 -2.17451835204668 -2.24825803902943 -2.32127373284366 -2.39305454931437 -2.46301358445353 -2.53047877657144 -2.59468274875465 -2.65475152147038 -2.70969197330951 -2.75837791488856 -2.7995346265651 -2.83172169473506 -2.85331396391487 -2.86248040238869 -2.85716065772521 -2.83503905472397 -2.79351576209768 -2.72967482517087 -2.64024872978397 -2.52157912711274 -2.36957330988818 -2.17965598713849 -1.94671585663426 -1.66504642122095 -1.32828043663422 -0.929317313626349 -0.46024272563427 0.0877604059270682 0.724510464154188 1.46093623904941 2.30919769885107 3.28281966750651 4.39683977612402 5.66797220063441 7.1147888575007 8.7579199057373 10.6202755985078 12.7272917431201 15.1072012664893 17.7913346464843 20.8144522606524 24.215112025545 28.0360760554794 32.3247604626178 37.1337328546841 42.5212625668056; -0.0885479352951127 -0.0978045429955446 -0.107518302205192 -0.117710816885279 -0.128404605698948 -0.139623128615581 -0.151390812744872 -0.163733077136696 -0.176676356245676 -0.190248121717826 -0.204476902110254 -0.219392300103069 -0.235025006704861 -0.251406811888589 -0.268570611022853 -0.286550406383433 -0.305381302940731 -0.325099497519514 -0.345742260316792 -0.367347907640792 -0.389955764597296 -0.413606116297681 -0.438340145994181 -0.464199858360335 -0.491227985926291 -0.519467876447378 -0.548963358727609 -0.579758584134917 -0.611897840728789 -0.645425336570309 -0.680384948395726 -0.71681993140337 -0.754772585425627 -0.794283872227666 -0.835392978087156 -0.878136815158234 -0.922549454401686 -0.968661482064175 -1.01649927080414 -1.06608415558156 -1.11743150334283 -1.17054966432975 -1.22543879151004 -1.28208951315284 -1.34048144194084 -1.40058150220429 -1.46234205486263 -1.5256987974467 -1.59056841412552 -1.6568459479512 -1.72440186453703 -1.79307877306525 -1.86268776684984 -1.93300434161785 -2.0037638451791 -2.07465640718349 -2.14532129216597 -2.21534061299714 -2.28423233512975 -2.3514424945902 -2.41633654443454 -2.47818973528639 -2.53617642550878 -2.58935820542962 -2.63667070773141 -2.67690896250255 -2.70871114039586 -2.73054051069535 -2.74066542268838 -2.73713709839166 -2.71776500217947 -2.68008952798688 -2.62135171725636 -2.53845969038811 -2.42795144083599 -2.28595360382296 -2.10813577056042 -1.8896598734294 -1.62512411736323 -1.30850087715499 -0.933067919041815 -0.491332237074197 0.0250542802185536 0.625388220260128 1.32001801299318 2.12045835392028 3.03951685594098 4.09143422608725 5.29203940008398 6.65892121890193 8.21161839864495 9.97182972989799 11.9636466469129 14.2138105327714 16.7519973762048 19.6111326715726 22.8277397583617 26.4423251335455 30.4998046425803 35.0499748664864 40.1480344774593; -0.0835469775287053 -0.0923616229606251 -0.101611684612246 -0.111317749293757 -0.121501276593751 -0.13218462440966 -0.143391073765994 -0.155144852671319 -0.167471158729747 -0.18039618018347 -0.193947115018934 -0.208152187720294 -0.223040663199024 -0.238642857367608 -0.254990143757165 -0.272114955503124 -0.290050781938612 -0.30883215894128 -0.32849465207471 -0.349074831449215 -0.370610237097522 -0.393139333517001 -0.41670145187035 -0.441336718159116 -0.467085965487281 -0.493990628313223 -0.5220926163454 -0.551434165467366 -0.582057662778548 -0.614005442505233 -0.647319549168077 -0.682041463984154 -0.718211790028959 -0.755869891181981 -0.795053479323327 -0.835798143632589 -0.878136815158234 -0.922099159069233 -0.967710886162567 -1.01499297427194 -1.06396078919498 -1.11462309361776 -1.16698093125481 -1.22102637202727 -1.27674110255664 -1.33409484454123 -1.39304358168943 -1.45352757378836 -1.5154691341679 -1.57877014425359 -1.64330927606263 -1.70893889035503 -1.77548157467573 -1.84272628167731 -1.91042402385818 -1.97828307614385 -2.04596363253242 -2.1130718572656 -2.17915326461637 -2.24368535433795 -2.30606942202613 -2.36562145502796 -2.42156201499832 -2.47300499766475 -2.51894514870439 -2.55824420174658 -2.58961549026097 -2.61160686932967 -2.62258176587462 -2.62069815664158 -2.60388525193631 -2.56981763955178 -2.51588661728002 -2.43916841360721 -2.33638896435458 -2.20388487783167 -2.03756018215759 -1.83283840538887 -1.58460949153711 -1.28717100298754 -0.934163001712475 -0.518495937427539 -0.0322707998181802 0.533309286544627 1.18803693276478 1.9428088257554 2.80974564808815 3.80232480491637 4.93552731490154 6.22600036529422 7.69223718963221 9.35477610150662 11.2364207112683 13.362483566341 15.7610556921186 18.4633047716221 21.5038049907946 24.9209018954197 28.7571159583486 33.0595889455643 37.8805776004933; -0.0787700177413383 -0.0871591285821233 -0.095962723731477 -0.105200409948899 -0.114892626320834 -0.125060668747451 -0.135726713772088 -0.146913841518491 -0.158646057467769 -0.170948312769864 -0.183846522742859 -0.197367583167086 -0.211539383929302 -0.22639081951452 -0.241951795778739 -0.258253232364209 -0.275327060038982 -0.29320621215371 -0.311924609309686 -0.331517136222189 -0.352019609640784 -0.373468736052298 -0.395902057741025 -0.419357885612798 -0.443875217003135 -0.469493636482527 -0.496253197442124 -0.524194281987944 -0.553357436388662 -0.583783179008012 -0.615511777304546 -0.648582990095252 -0.683035770851319 -0.718907927319598 -0.756235732237171 -0.795053479323327 -0.835392978087156 -0.877282980273135 -0.920748529974141 -0.965810228562996 -1.01248340462092 -1.0607771779641 -1.11069340567676 -1.1622254967386 -1.21535708037251 -1.27006051162001 -1.32629519586051 -1.38400571200807 -1.44311971192474 -1.50354557116159 -1.56516976345143 -1.62785392840426 -1.69143159856653 -1.7557045483664 -1.82043872344016 -1.88535970438143 -1.95014765402716 -2.0144316919443 -2.07778363375287 -2.13971102625298 -2.19964940194914 -2.25695366840882 -2.3108885388725 -2.3606179005571 -2.40519300606382 -2.44353936110294 -2.47444216825945 -2.49653017160797 -2.50825773049322 -2.50788493255651 -2.49345553592639 -2.46277250819851 -2.4133709051823 -2.34248780514171 -2.24702898412951 -2.12353198470668 -1.96812519351499 -1.77648250246178 -1.54377308327108 -1.26460575540381 -0.932967372349808 -0.542154590494473 -0.0846983175520926 0.44771993673992 1.06436066710092 1.77552888658346 2.592687598424 3.52858338737724 4.59738541466435 5.81483923620628 7.19843701363448 8.76760585317479 10.5439161905491 12.5513123423677 14.8163675681241 17.368566234095 20.2406159436675 23.468792800613 27.0933233056117 31.1588067552703 35.7146824206513; -0.0742080253111871 -0.0821877159568015 -0.090561747621836 -0.0993487834962118 -0.108568280100082 -0.11824051075783 -0.128386588466572 -0.139028487937858 -0.150189066559909 -0.161892083992682 -0.174162220068811 -0.187025090629776 -0.200507260877709 -0.214636255768834 -0.229440566913686 -0.24494965538162 -0.261193949731626 -0.278204838507551 -0.296014656342326 -0.314656662711854 -0.334165012263584 -0.35457471551627 -0.375921588584538 -0.398242190423225 -0.421573745910129 -0.445954052890109 -0.471421371086168 -0.498014290541989 -0.525771576992815 -0.554731991264656 -0.584934079472593 -0.616415930423742 -0.649214896225624 -0.683367271651852 -0.718907927319598 -0.755869891181981 -0.794283872227666 -0.834177719603129 -0.875575809623308 -0.918498352305886 -0.9629606081447 -1.00897200481923 -1.05653514240932 -1.10564467443549 -1.15628605066304 -1.20843410607741 -1.26205147874486 -1.31708683739736 -1.37347289750584 -1.43112420230988 -1.48993464273069 -1.54977468728324 -1.61048828999218 -1.67188944087494 -1.73375831974756 -1.79583700989697 -1.85782472350388 -1.9193724855463 -1.98007721721313 -2.0394751535513 -2.09703452309651 -2.15214740952407 -2.20412070682668 -2.2521660700925 -2.29538875352481 -2.33277521580906 -2.36317936017627 -2.38530726240684 -2.39770022442187 -2.39871597386334 -2.38650781099721 -2.35900148319027 -2.31386954390278 -2.24850292736738 -2.15997944163282 -2.04502885115122 -1.89999418526276 -1.72078887043226 -1.50284924153062 -1.24108194040209 -0.929805657944317 -0.562686618427747 -0.132667141217687 0.368113455202777 0.948406419683278 1.61795050396453 2.38757926088845 3.2693398037153 4.27662424097023 5.42431512942712 6.72894642952888 8.20888160416055 9.88451067480787 11.7784682404831 13.9158746763049 16.3246029623945 19.0355738521508 22.0830823745696 25.5051589809547 29.343968995283 33.646254413141; -0.0698522298177288 -0.0774382702312566 -0.0853992806359896 -0.0937530164310854 -0.102517988782324 -0.111713487114595 -0.121359601047889 -0.131477241568448 -0.142088161197141 -0.153214972884024 -0.164881167321057 -0.177111128323627 -0.189930145885405 -0.203364426459597 -0.21744109996231 -0.232188222929762 -0.247634777189902 -0.263810663329667 -0.280746688150851 -0.298474545209394 -0.317026787423684 -0.336436790616055 -0.356738706716773 -0.377967405209873 -0.400158401233708 -0.423347768564201 -0.447572035503487 -0.472868061468888 -0.499272891824283 -0.526823588215581 -0.555557031360848 -0.58550969290074 -0.616717372532356 -0.649214896225624 -0.683035770851319 -0.718211790028959 -0.754772585425627 -0.792745117097323 -0.832153095756036 -0.873016329061036 -0.915349983163883 -0.959163749774181 -1.00446090794751 -1.05123726861698 -1.09947998858372 -1.14916623923544 -1.20026171366166 -1.25271895406276 -1.30647547938904 -1.36145169097656 -1.4175485315451 -1.47464487026725 -1.53259458367764 -1.59122329893944 -1.65032476238683 -1.70965679228204 -1.76893677032223 -1.82783662156105 -1.88597722702212 -1.94292220732315 -1.9981710090388 -2.05115121824132 -2.10121001759711 -2.14760469448256 -2.18949209772382 -2.22591692966373 -2.25579874820363 -2.27791754013787 -2.29089771235915 -2.29319033121494 -2.28305342227551 -2.25853012284965 -2.21742445755601 -2.15727448290246 -2.07532251989962 -1.96848216396523 -1.83330172846485 -1.66592374184981 -1.46204007813006 -1.21684225595274 -0.92496639240001 -0.580432243278552 -0.176575701601144 0.294025940444621 0.83963673415143 1.46945367082617 2.19370807115409 3.0237778054938 3.97231149280108 5.05336594702498 6.28255827372862 7.67723416770269 9.25665412594822 11.0421994712456 13.0576002814152 15.3291875403146 17.8861720708207 20.7609530799726 23.9894594447871 27.6115271970199 31.6713170296177; -0.065694125502472 -0.0729019160003599 -0.0804660600559191 -0.0884034402858339 -0.0967316589176222 -0.10546905933208 -0.114634747095565 -0.124248610286145 -0.134331338889728 -0.144904443011089 -0.155990269609784 -0.167612017432007 -0.1797937497659 -0.192560404599299 -0.205937801704776 -0.219952646116496 -0.234632527396214 -0.250005914010915 -0.266102142061303 -0.282951397507696 -0.300584690936821 -0.319033823798446 -0.338331344913421 -0.358510495913244 -0.379605144114074 -0.401649701153644 -0.424679025525718 -0.448728306931745 -0.4738329301307 -0.500028315703374 -0.527349734853712 -0.555832095044144 -0.58550969290074 -0.616415930423742 -0.648582990095252 -0.682041463984154 -0.716819931403371 -0.752944479070852 -0.790438157056816 -0.82932036305892 -0.869606146726501 -0.911305424846324 -0.954422097196078 -0.99895305175777 -1.04488704674981 -1.09220345557109 -1.14087085923922 -1.19084546923196 -1.24206936178983 -1.29446850268882 -1.34795053922501 -1.40240233364409 -1.45768720947309 -1.51364187914041 -1.57007301787267 -1.62675344509821 -1.68341787042917 -1.73975815669448 -1.79541804740922 -1.84998730043813 -1.90299516338799 -1.95390311938029 -2.00209682424295 -2.04687714774171 -2.08745022216179 -2.12291639125542 -2.15225794118656 -2.17432548251583 -2.1878228383492 -2.19129027838311 -2.18308592156132 -2.16136511124328 -2.12405754598062 -2.06884192599863 -1.99311785005046 -1.89397466919883 -1.76815697299954 -1.6120263492003 -1.42151902008259 -1.19209891658069 -0.918705704888976 -0.595697228949872 -0.216785775483691 0.225032494490218 0.737555673015363 1.32946259344862 2.01040856631315 2.7911313431027 3.68356839188913 4.7009866829934 5.85812630944285 7.17135940672231 8.65886599083749 10.3408285044935 12.2396470499653 14.3801774958898 16.7899948758377 19.4996847514357 22.5431654945644 25.9580447545776 29.7860137206989; -0.0617254738800111 -0.068570025145966 -0.0757530494230796 -0.0832905907281781 -0.0911993779126583 -0.099496845286386 -0.108201152775255 -0.11733120542824 -0.126906672063489 -0.136948002813571 -0.147476445297117 -0.15851405910737 -0.17008372826711 -0.182209171253719 -0.194914948147056 -0.208226464396006 -0.222169970636153 -0.236772557920511 -0.252062147646701 -0.268067475376588 -0.284818067647233 -0.302344210763928 -0.320676910446048 -0.339847841062963 -0.359889283049077 -0.380834046922427 -0.40271538214857 -0.42556686888861 -0.449422290445168 -0.474315483970354 -0.500280166722817 -0.527349734853712 -0.555557031360848 -0.584934079472593 -0.615511777304546 -0.647319549168077 -0.680384948395726 -0.714733205978909 -0.750386718682328 -0.787364469600573 -0.825681373348225 -0.86534753721747 -0.906367428687889 -0.948738938621986 -0.9924523283163 -1.03748904728968 -1.08382040726435 -1.13140609621702 -1.18019251463043 -1.2301109141427 -1.28107531665237 -1.33298018957012 -1.38569785028879 -1.43907557004585 -1.4929323441461 -1.54705529196623 -1.60119564623896 -1.65506428677517 -1.70832676898133 -1.7605977922205 -1.811435047192 -1.86033237501022 -1.90671216347966 -1.9499168981194 -1.9891997767055 -2.02371428638473 -2.05250263167094 -2.07448288975638 -2.08843475643528 -2.09298373141405 -2.08658357572341 -2.06749685619344 -2.03377337232115 -1.9832262391565 -1.91340537583711 -1.82156812287232 -1.70464668194854 -1.55921203960287 -1.38143400026628 -1.16703691455017 -0.911250644842286 -0.608756261850473 -0.253625912197655 0.160743762007757 0.641705336120252 1.19744220523322 1.83705891252786 2.57068112880122 3.40956630595223 4.36622613516876 5.45456205989824 6.69001522559565 8.08973239405083 9.67274951126254 11.4601947959681 13.4755134128394 15.7447160119928 18.2966536570214 21.1633219296376 24.3801972929011 27.9866091198286; -0.0579383047449309 -0.0644342224360599 -0.0712514489616745 -0.0784052230520462 -0.085911434844525 -0.0937866456202624 -0.102048107116053 -0.110713780238395 -0.119802352982128 -0.129333257328287 -0.139326684864868 -0.149803600839595 -0.160785756315151 -0.172295698054258 -0.18435677571389 -0.196993145874385 -0.210229772369473 -0.224092422316832 -0.238607657174755 -0.253802818068218 -0.269706004536056 -0.286346045749169 -0.303752463136507 -0.32195542322984 -0.34098567939866 -0.360874500991431 -0.38165358822719 -0.403354970990342 -0.426010889469357 -0.449653654344713 -0.474315483970354 -0.500028315703374 -0.526823588215581 -0.554731991264656 -0.583783179008013 -0.614005442505233 -0.645425336570309 -0.678067255598031 -0.71195295239404 -0.747100993379154 -0.783526142808809 -0.821238667840278 -0.860243555385328 -0.900539630695129 -0.942118566527089 -0.984963770528831 -1.02904913713017 -1.07433764874589 -1.12077980944536 -1.16831189242227 -1.21685398058113 -1.26630777732536 -1.31655416216226 -1.36745046300849 -1.41882741405665 -1.47048576471999 -1.52219250147297 -1.57367664031375 -1.62462454304851 -1.67467470559137 -1.72341196093648 -1.77036103333532 -1.81497937343918 -1.85664919667694 -1.89466863885525 -1.92824193380851 -1.95646850779711 -1.97833087415225 -1.99268119928093 -1.99822639745101 -1.99351159663463 -1.97690180094771 -1.94656155671309 -1.90043240871061 -1.83620791055172 -1.751305928102 -1.6428379472202 -1.50757506650956 -1.34191032197743 -1.14181695313465 -0.902802178759156 -0.619856004885556 -0.287394537103612 0.100802786552356 0.551662687525017 1.07289497705499 1.67307771386314 2.36175146147325 3.1495236095515 4.04818382544082 5.07083181459584 6.23201869300643 7.54790341218354 9.03642582924774 10.7174981826353 12.6132169195996 14.748097026903 17.1493312429226 19.8470767801016 22.8747724637915 26.2694894998124; -0.0543249157933348 -0.0604863891703095 -0.0669527034515737 -0.0737383244913129 -0.0808583374393382 -0.088328465621753 -0.0961650890359676 -0.104385262297916 -0.113006731856054 -0.122047952260647 -0.131528101247745 -0.141467093364675 -0.151885591827551 -0.16280501826074 -0.174247559923002 -0.186236173974586 -0.198794588283407 -0.211947298205856 -0.225719558708163 -0.240137371116737 -0.255227463699715 -0.271017265186101 -0.28753487022235 -0.304808995647871 -0.322868926339397 -0.341744449228136 -0.361465773931442 -0.382063438260757 -0.403568196667799 -0.426010889469356 -0.449422290445167 -0.4738329301307 -0.499272891824283 -0.525771576992815 -0.553357436388662 -0.582057662778548 -0.611897840728789 -0.64290154838558 -0.675089905628765 -0.708481062356953 -0.743089619974454 -0.77892597838929 -0.815995599988543 -0.854298181123956 -0.893826720607314 -0.934566473571138 -0.976493777783907 -1.01957473810736 -1.06376375323209 -1.1090018671109 -1.15521492560936 -1.20231151679092 -1.25018067092756 -1.29868929375357 -1.34767930363238 -1.3969644401566 -1.44632670821661 -1.49551241771847 -1.54422777486804 -1.59213397622226 -1.63884175149215 -1.68390529531335 -1.72681552181925 -1.76699256879606 -1.80377747039567 -1.83642290875317 -1.86408294531366 -1.88580162212137 -1.90050031165669 -1.90696368090611 -1.9038241210851 -1.88954447866281 -1.8623989058992 -1.82045162982551 -1.76153341728364 -1.68321549007356 -1.58278061820444 -1.457191090442 -1.30305322950147 -1.1165780840341 -0.893537890638878 -0.629217856111705 -0.318362762587319 0.0448821543421922 0.46703666256187 0.955357997691249 1.51792107794564 2.16370729137747 2.90270276404127 3.74600711353609 4.70595379839461 5.79624329097233 7.03209043102002 8.43038746029512 10.0098843968217 11.7913885823283 13.7979854297351 16.0552826112643 18.5916801639493 21.4386692503968 24.631162601216; -0.050877871053723 -0.0567186651272234 -0.0628485078695823 -0.0692811237418697 -0.0760308256710869 -0.0831125331055352 -0.0905417897216609 -0.0983347806304917 -0.106508348909904 -0.115080011264468 -0.124067972587245 -0.133491139167311 -0.143369130252621 -0.15372228763971 -0.164571682919182 -0.175939121958554 -0.187847146151187 -0.20031902990122 -0.213378773748911 -0.227051092467934 -0.241361397385101 -0.256335772082838 -0.272000940544533 -0.288384226691522 -0.305513504136767 -0.323417134842905 -0.34212389521977 -0.361662888027168 -0.382063438260757 -0.403354970990341 -0.42556686888861 -0.448728306931745 -0.472868061468888 -0.49801429054199 -0.524194281987944 -0.551434165467366 -0.579758584134917 -0.609190321190223 -0.639749876021243 -0.671454984067968 -0.704320073887443 -0.7383556541848 -0.77356762278166 -0.809956488614882 -0.847516496886184 -0.886234646406488 -0.926089586987137 -0.967050383410961 -1.0090751310562 -1.0521094066305 -1.09608453568415 -1.14091565659316 -1.18649955851339 -1.23271226838482 -1.27940635938516 -1.32640795026702 -1.37351336173348 -1.42048539237852 -1.46704917270607 -1.51288755130221 -1.55763596232582 -1.60087671805298 -1.64213266420473 -1.68086012914707 -1.71644109070667 -1.74817447622433 -1.77526650248624 -1.79681995224195 -1.81182227303556 -1.81913237193406 -1.81746596631017 -1.80537933599171 -1.78125130567592 -1.74326326836019 -1.68937704047646 -1.61731031723512 -1.52450947216041 -1.40811941768769 -1.26495021372033 -1.09144007790893 -0.88361441478543 -0.637040440390758 -0.346776934270363 -0.00731860122761674 0.387465529476448 0.844400300256933 1.37107991629412 1.97595150508602 2.66840759964604 3.45888849080646 4.35899549388027 5.38161628523829 6.54106358628386 7.85322860707545 9.33575081081064 11.0082057250368 12.8923127074457 15.0121647752669 17.3944828296126 20.0688968518774 23.0682569209193; -0.0475899983003542 -0.0531234490404506 -0.0589308110837278 -0.0650250980366883 -0.0714198823883771 -0.0781293127707553 -0.0851681309056991 -0.0925516880965277 -0.100295961101423 -0.108417567203115 -0.116933778263508 -0.125862533523181 -0.135222450873629 -0.145032836294302 -0.15531369110655 -0.166085716652057 -0.177370315953749 -0.189189591861855 -0.201566341126318 -0.214524043768248 -0.228086847046963 -0.242279543234442 -0.257127540314871 -0.272656824622312 -0.28889391431327 -0.305865802441824 -0.323599888261607 -0.34212389521977 -0.361465773931442 -0.38165358822719 -0.40271538214857 -0.424679025525718 -0.447572035503488 -0.471421371086168 -0.496253197442124 -0.5220926163454 -0.548963358727609 -0.576887434866085 -0.605884737238662 -0.635972590526412 -0.667165242637568 -0.699473289952347 -0.732903029242577 -0.7674557278942 -0.803126803146378 -0.839904900048716 -0.877770856717573 -0.916696544232189 -0.95664356713858 -0.997561809009963 -1.03938780583121 -1.08204292811447 -1.12543135059448 -1.1694377860747 -1.21392495747528 -1.25873077934627 -1.30366521702558 -1.34850678820971 -1.39299866793164 -1.43684435376647 -1.47970284346886 -1.52118327214023 -1.56083895037679 -1.59816073860423 -1.63256968589849 -1.66340885395442 -1.68993423841823 -1.71130469046086 -1.72657073114182 -1.73466213969485 -1.73437418424069 -1.72435234947224 -1.70307540042266 -1.66883660436177 -1.6197229139984 -1.5535918943074 -1.4680461522381 -1.36040500306598 -1.22767307896305 -1.06650555420329 -0.873169626972153 -0.643501859669605 -0.372860937499849 -0.0560753586060829 0.312614482432451 0.739620412788161 1.23207745916262 1.79792241254199 2.44598078412402 3.18606304150949 4.02907110809503 4.98711621233567 6.07364928820471 7.30360525491509 8.69356264405335 10.2619201971166 12.0290922275908 14.0177247308787 16.2529344344764 18.7625732119022 21.577520539322; -0.0444543856028245 -0.04969339780689 -0.0551918178546191 -0.0609619780818907 -0.067016741333742 -0.0733695174595191 -0.0800342795279367 -0.0870255796292816 -0.0943585641127379 -0.102048988085253 -0.110113228974256 -0.118568298929595 -0.127431855809963 -0.136722212465495 -0.146458343990742 -0.156659892580457 -0.167347169574051 -0.178541154222733 -0.190263488655596 -0.202536468456664 -0.21538302819339 -0.228826721157636 -0.242891692491741 -0.257602644774077 -0.272984795029346 -0.289063822007656 -0.305865802441824 -0.323417134842905 -0.341744449228136 -0.360874500991431 -0.380834046922427 -0.401649701153644 -0.423347768564201 -0.445954052890109 -0.469493636482527 -0.493990628313223 -0.519467876447378 -0.545946640783744 -0.5734462213967 -0.601983537299158 -0.631572649874098 -0.66222422459001 -0.693944923914999 -0.726736723568703 -0.760596143392373 -0.795513383166732 -0.831471352654793 -0.868444583981811 -0.906398013175229 -0.945285616260387 -0.985048883728665 -1.02561511544718 -1.06689551614555 -1.10878306947591 -1.15115016627515 -1.19384596004007 -1.23669341972877 -1.27948604679744 -1.32198421983685 -1.36391112625178 -1.40494823609033 -1.44473026833333 -1.48283959464938 -1.51880001975451 -1.55206987102747 -1.58203432285682 -1.60799687326227 -1.62916988155895 -1.64466406613265 -1.65347685066639 -1.65447943529838 -1.64640245607676 -1.62782008157672 -1.59713237951406 -1.55254576846449 -1.49205135020224 -1.41340089650631 -1.31408024033171 -1.19127979476396 -1.04186189390217 -0.862324617455525 -0.648761725063563 -0.396818286803612 -0.101641552631509 0.24217344482474 0.640644113120123 1.10046696655072 1.62909141974511 2.23480146377536 2.92680606003278 3.71533917527715 4.61177047871934 5.62872782971567 6.7802328037169 8.08185063572144 9.55085610594904 11.2064170532385 13.0697973793932 15.1645816041315 17.5169232474149 20.1558195559075; -0.0414643771481977 -0.0464214246069331 -0.0516239893704012 -0.0570837511288617 -0.0628128928814937 -0.0688241166955008 -0.0751306592166459 -0.081746306807352 -0.0886854101704683 -0.0959628982966101 -0.103594291550396 -0.111595713685662 -0.119983902551541 -0.1287762192198 -0.137990655228748 -0.147645837599827 -0.157761031239389 -0.168356138289549 -0.179451693937857 -0.191068858135308 -0.203229402605172 -0.2159556924506 -0.229270661586062 -0.243197781125597 -0.257761019758491 -0.272984795029346 -0.28889391431327 -0.305513504136767 -0.322868926339397 -0.34098567939866 -0.359889283049077 -0.379605144114074 -0.400158401233708 -0.421573745910129 -0.443875217003136 -0.467085965487281 -0.491227985926291 -0.516321810726492 -0.542386162794244 -0.569437561738709 -0.597489878225406 -0.626553830492632 -0.656636416385601 -0.687740273535465 -0.71986295950467 -0.75299614282806 -0.787124694891718 -0.822225671498482 -0.858267171759302 -0.89520706061066 -0.932991539776585 -0.971553550354073 -1.01081098838647 -1.0506647127819 -1.09099632271275 -1.13166567917524 -1.17250814266966 -1.21333149595487 -1.25391251750473 -1.29399316761445 -1.33327634503606 -1.3714211675209 -1.40803772466943 -1.44268124598338 -1.47484562092739 -1.50395620107396 -1.52936180696121 -1.5503258540591 -1.56601650313686 -1.57549573025767 -1.57770720049633 -1.57146281716914 -1.55542780475799 -1.52810416866658 -1.48781235831334 -1.43267094167612 -1.36057407907315 -1.26916656148763 -1.15581615389489 -1.01758295658033 -0.85118546706767 -0.652962991705163 -0.418834018844678 -0.144250124522428 0.175855063801722 0.547122370022594 0.9758296186796 1.46896087201066 2.03428306373742 2.68043081339937 3.41700028779145 4.25465306751403 5.20523107773297 6.28188375398469 7.49920873736886 8.87340752998593 10.4224576923697 12.1663033314489 14.1270658119164 16.3292768276423 18.800136194978; -0.0386135684564042 -0.0433006960970966 -0.0482200425170796 -0.0533826624277785 -0.0588000877852756 -0.0644843428418971 -0.0704479589790905 -0.0767039892062123 -0.0832660221929788 -0.0901481956844468 -0.097365209126256 -0.104932335304251 -0.112865430776213 -0.121180944843968 -0.129895926781281 -0.139028030996282 -0.148595519766333 -0.158617263137716 -0.169112735531854 -0.180102008543382 -0.191605739352604 -0.203645154105067 -0.216242025533407 -0.229418644010305 -0.243197781125597 -0.257602644774077 -0.272656824622312 -0.288384226691522 -0.304808995647871 -0.32195542322984 -0.339847841062963 -0.358510495913244 -0.377967405209873 -0.398242190423225 -0.419357885612798 -0.441336718159116 -0.464199858360335 -0.487967134205039 -0.512656707223547 -0.538284704866784 -0.564864804359687 -0.592407762420016 -0.62092088461761 -0.650407427467176 -0.68086592559265 -0.712289435465219 -0.744664686291713 -0.777971127605715 -0.812179861979959 -0.84725245002377 -0.883139573440605 -0.919779540384078 -0.957096615650411 -0.994999156363826 -1.0333775317298 -1.07210180312815 -1.1110191382701 -1.14995093032538 -1.18868958980766 -1.22699497355817 -1.26459041135355 -1.30115828644504 -1.3363351216705 -1.36970611762103 -1.4007990836371 -1.4290776960988 -1.45393401149615 -1.4746801540486 -1.49053908910982 -1.50063438415835 -1.50397884874193 -1.499461933208 -1.4858357532981 -1.46169959358275 -1.42548272712194 -1.37542537149934 -1.30955758232088 -1.22567586420017 -1.12131725596064 -0.993730621034717 -0.839844845574112 -0.656233615315791 -0.439076407460524 -0.184115295363987 0.113392878670798 0.458729454204357 0.85777257072661 1.31706205405152 1.84387123558861 2.4462864392022 3.13329494792555 3.91488234852399 4.80214024666007 5.80738545015449 6.94429183361027 8.22803622563449 9.67545980133687 11.3052466191253 13.1381211136204 15.1970665475128 17.5075666362942; -0.0358958010956264 -0.0403246288172822 -0.0449729480637551 -0.0498512152812697 -0.0549703391951551 -0.0603416951817548 -0.0659771394499134 -0.0718890229247566 -0.0780902047107173 -0.0845940649931232 -0.0914145172179148 -0.0985660193669961 -0.106063584122061 -0.113922787682208 -0.12215977696993 -0.130791274925811 -0.139834583554064 -0.149307584338502 -0.159228735601133 -0.169617066322849 -0.180492165886963 -0.19187416914109 -0.203783736100246 -0.216242025533407 -0.229270661586062 -0.242891692491741 -0.257127540314871 -0.272000940544533 -0.28753487022235 -0.303752463136507 -0.320676910446048 -0.338331344913421 -0.356738706716773 -0.375921588584538 -0.395902057741025 -0.416701451870349 -0.438340145994181 -0.46083728681323 -0.484210490679471 -0.508475500941927 -0.53364579993892 -0.559732170389271 -0.586742200358543 -0.614679725338167 -0.643544200268605 -0.673329993555283 -0.704025594259894 -0.735612722690859 -0.768065333555544 -0.80134849966225 -0.835417162860195 -0.870214737467265 -0.905671549843618 -0.941703096008129 -0.978208097246096 -1.01506633150089 -1.05213621595731 -1.08925211358629 -1.12622133350206 -1.16282079175498 -1.19879329561265 -1.23384341043282 -1.26763286386387 -1.29977543727831 -1.32983128900253 -1.35730064799848 -1.38161681011983 -1.40213836184123 -1.4181405483707 -1.42880569422209 -1.43321257455782 -1.43032462481261 -1.41897686416876 -1.39786139525168 -1.36551132781836 -1.32028295807392 -1.26033601741047 -1.18361178463781 -1.08780883396989 -0.970356166923479 -0.828383449635583 -0.658688047644382 -0.457698517609555 -0.22143417944447 0.0545396474670132 0.375161204292209 0.745927157966437 1.17295333432143 1.66304194126745 2.22375596985938 2.86350153368659 3.59161898728643 4.41848375299674 5.35561788372373 6.41581349749234 7.61326933945238 8.96374185943883 10.4847123395559 12.1955717680372 14.1178253344562 16.2753186190076; -0.0333051569918471 -0.0374868849387338 -0.0418759279223358 -0.0464821698929428 -0.0513159231759351 -0.0563879421911301 -0.0617094370085137 -0.067292086640784 -0.0731480519584373 -0.0792899880966708 -0.0857310562049578 -0.0924849343695624 -0.0995658275162508 -0.10698847607476 -0.114768163157916 -0.122920719976306 -0.131462529173767 -0.140410525729206 -0.149782195026062 -0.159595567641428 -0.169869210352057 -0.18062221279354 -0.19187416914109 -0.203645154105067 -0.2159556924506 -0.228826721157636 -0.242279543234442 -0.256335772082838 -0.271017265186101 -0.286346045749169 -0.302344210763928 -0.319033823798446 -0.336436790616055 -0.35457471551627 -0.373468736052299 -0.393139333517001 -0.413606116297681 -0.434887572877182 -0.457000790900869 -0.47996113833268 -0.503781902284208 -0.528473880614402 -0.554044920858732 -0.580499400450113 -0.607837641533377 -0.636055252943714 -0.665142391109937 -0.695082930747211 -0.725853535211899 -0.757422615293277 -0.789749164001827 -0.822781453569188 -0.856455579386962 -0.890693833965263 -0.925402892170375 -0.960471786985608 -0.995769652810015 -1.03114321084327 -1.0664139683768 -1.10137510079347 -1.13578798174017 -1.1693783232457 -1.2018318834732 -1.23278969528027 -1.26184276376576 -1.28852617545922 -1.31231255570113 -1.33260480400824 -1.34872802974977 -1.35992060220215 -1.3653242199185 -1.36397289425269 -1.35478073071425 -1.33652837948788 -1.30784801280451 -1.26720667176372 -1.21288780852643 -1.14297083135589 -1.05530843959703 -0.947501513145691 -0.81687129604202 -0.660428586277177 -0.474839613451682 -0.256388252261847 -0.000934182579352516 0.296133434245678 0.639947238698787 1.03621844213694 1.491299663212 2.01225447476462 2.60693437215985 3.28406394907683 4.05333514971259 4.92551155804493 5.91254378614302 7.02769713553137 8.28569282942809 9.70286425053377 11.2973297703123 13.0891839229008 15.100708861584; -0.0308359524154982 -0.0347813674642625 -0.0389224516233611 -0.0432685411839918 -0.0478293779330452 -0.0526151222462546 -0.0576363660431386 -0.0629041455115153 -0.0684299534956819 -0.0742257514270301 -0.0803039806587156 -0.0866775730468161 -0.0933599605989814 -0.100365083987632 -0.107707399698049 -0.115401885551891 -0.123464044313433 -0.131909905048823 -0.140756021867352 -0.150019469627886 -0.159717836142438 -0.169869210352057 -0.180492165886963 -0.191605739352604 -0.203229402605172 -0.21538302819339 -0.228086847046963 -0.241361397385101 -0.255227463699715 -0.269706004536055 -0.284818067647233 -0.300584690936821 -0.317026787423684 -0.334165012263584 -0.352019609640784 -0.370610237097522 -0.389955764597296 -0.410074045316494 -0.430981654825027 -0.452693594946594 -0.475222958179392 -0.49858054810414 -0.522774450703471 -0.547809550960041 -0.573686988484184 -0.600403545239376 -0.627950957678144 -0.656315144764553 -0.685475342433537 -0.715403134012507 -0.746061364996598 -0.777402929313776 -0.809369412827187 -0.841889578285415 -0.874877674230967 -0.908231548496159 -0.941830544834411 -0.97553315893267 -1.00917442750393 -1.04256302134162 -1.07547801010177 -1.10766526313221 -1.13883344685625 -1.16864957500281 -1.19673406331208 -1.22265523519034 -1.2459232190852 -1.26598317204788 -1.28220775697621 -1.29388879332316 -1.30022799253025 -1.30032668001997 -1.29317439515884 -1.27763624908006 -1.25243890751452 -1.21615505169294 -1.16718615480954 -1.10374339432054 -1.02382650131705 -0.925200327169207 -0.805368884376075 -0.661546592838849 -0.490626434345862 -0.289144686630438 -0.0532418736214408 0.221380469897967 0.539507663460621 0.906464867079594 1.32817573144511 1.81122731253328 2.36294191438873 2.99145659390403 3.7058111388616 4.51604541610431 5.43330708131909 6.46997074650141 7.63976981676747 8.95794233595471 10.4413923216789 12.108868226617 13.9811603353223; -0.0284827317180986 -0.0322022149793107 -0.0361062321334848 -0.0402035957317549 -0.0445035019296316 -0.0490155429795551 -0.0537497196093284 -0.0587164532012098 -0.0639265976737366 -0.0693914509541001 -0.0751227659129468 -0.0811327606156467 -0.0874341277241321 -0.0940400428611414 -0.10096417172385 -0.108220675706139 -0.115824215757824 -0.123789954174726 -0.132133553975061 -0.140871175474903 -0.150019469627886 -0.159595567641428 -0.169617066322849 -0.180102008543382 -0.191068858135308 -0.202536468456664 -0.214524043768248 -0.227051092467934 -0.240137371116737 -0.253802818068218 -0.268067475376588 -0.282951397507696 -0.298474545209394 -0.314656662711854 -0.331517136222189 -0.349074831449215 -0.367347907640792 -0.386353605335437 -0.406108004718783 -0.426625751130705 -0.447919743887138 -0.470000784157553 -0.492877177170644 -0.516554283501952 -0.541034013622704 -0.566314259253099 -0.592388254359106 -0.619243857852331 -0.646862749189688 -0.675219527114578 -0.704280700724353 -0.734003560879168 -0.764334918672975 -0.795209696255216 -0.826549353707125 -0.858260133923278 -0.890231105509429 -0.922331981561889 -0.954410689820037 -0.98629066705792 -1.01776784767665 -1.04860731324698 -1.07853956619871 -1.10725638692396 -1.13440622921603 -1.15958910415952 -1.18235089727273 -1.20217705782663 -1.2184855927655 -1.23061929046847 -1.23783709164512 -1.23930451587217 -1.23408304256418 -1.22111833442988 -1.19922717959069 -1.16708301540801 -1.12319988255009 -1.0659146417808 -0.993367268210475 -0.903479018133987 -0.793928241897517 -0.662123592263184 -0.505174351240627 -0.319857569059251 -0.102581676570558 0.150653803428991 0.444302860037146 0.783322371073862 1.17322675908009 1.62014848612033 2.13090500610554 2.71307285866218 3.37506966076287 4.12624483212954 4.97697997862035 5.93879995530279 7.02449573867422 8.2482603565996 9.6258392561867 11.1746966353334 12.9141994245185; -0.026240260882773 -0.0297437960407805 -0.0334212211257298 -0.0372808479667373 -0.0413313510580292 -0.0455817794757217 -0.0500415687033136 -0.054720552287351 -0.059628973232932 -0.0647774950354994 -0.0701772122305753 -0.0758396603265382 -0.0817768249670367 -0.0880011501489631 -0.0945255452988321 -0.101363390984656 -0.108528543011696 -0.116035334618457 -0.123898576453639 -0.132133553975061 -0.140756021867352 -0.149782195026063 -0.159228735601133 -0.169112735531854 -0.179451693937857 -0.190263488655596 -0.201566341126318 -0.213378773748912 -0.225719558708163 -0.238607657174755 -0.252062147646701 -0.266102142061303 -0.280746688150851 -0.296014656342326 -0.311924609309687 -0.32849465207471 -0.345742260316792 -0.363684084290944 -0.382335725463889 -0.40171148265753 -0.421824064133904 -0.442684261662278 -0.464300582173312 -0.486678832122617 -0.509821649151691 -0.533727975042518 -0.558392463307098 -0.583804814028005 -0.60994902776339 -0.636802569441408 -0.664335432185739 -0.692509089925692 -0.721275326440206 -0.750574927152576 -0.780336218518403 -0.810473438218114 -0.840884917560701 -0.871451055508933 -0.902032061527786 -0.932465442014827 -0.962563202369094 -0.992108733766108 -1.02085335040092 -1.04851243930486 -1.07476118079838 -1.0992297931702 -1.12149825022844 -1.14109041490021 -1.15746752600949 -1.17002096867604 -1.17806425138449 -1.18082410459697 -1.17743060674345 -1.16690623342902 -1.14815371464685 -1.11994257256814 -1.08089419897248 -1.0294653164483 -0.963929650983163 -0.882357625310921 -0.782593862204753 -0.662232264597528 -0.518588414750967 -0.348669007433807 -0.149138001933405 0.0837208555882656 0.354045524708844 0.666441604351947 1.02603317840584 1.43851909411504 1.91023524898754 2.44822352273613 3.06030805795092 3.75517966745681 4.54248922838801 5.43295101373592 6.43845701240651 7.57220339966482 8.84883044235727 10.2845772587182 11.8974530022412; -0.0241035209445099 -0.0274007032801249 -0.03086160380069 -0.0344940557490378 -0.0383062350104631 -0.0423066714777664 -0.0465042603466616 -0.0509082732693696 -0.0555283692833078 -0.0603746054195449 -0.0654574468819947 -0.0707877766729909 -0.0763769045237451 -0.0822365749690395 -0.0883789743841205 -0.0948167367778985 -0.101562948109943 -0.108631148869095 -0.116035334618457 -0.123789954174726 -0.131909905048823 -0.140410525729206 -0.149307584338502 -0.158617263137716 -0.168356138289549 -0.178541154222733 -0.189189591861855 -0.20031902990122 -0.211947298205856 -0.224092422316831 -0.236772557920511 -0.250005914010915 -0.263810663329667 -0.278204838507551 -0.29320621215371 -0.30883215894128 -0.325099497519514 -0.342024309840079 -0.359621735216608 -0.37790573613895 -0.396888832533856 -0.416581800798563 -0.436993333529228 -0.458129655418092 -0.479994090297157 -0.502586573756805 -0.525903105159594 -0.54993513219616 -0.574668860384838 -0.600084479091678 -0.626155294734451 -0.652846760823819 -0.680115393376613 -0.707907558998856 -0.736158121567047 -0.764788931921493 -0.793707143309557 -0.822803333462716 -0.851949412140357 -0.880996290704462 -0.909771287779838 -0.938075242278755 -0.965679301998771 -0.992321352606979 -1.01770204806864 -1.04148039942505 -1.06326887423278 -1.08262795389751 -1.09906009051919 -1.11200299865522 -1.12082221054067 -1.12480281571188 -1.12314029758364 -1.11493037024741 -1.09915770849453 -1.07468345272041 -1.04023135782014 -0.994372441314981 -0.935507970614883 -0.861850612368843 -0.771403548113015 -0.661937339707088 -0.530964305144497 -0.375710140001125 -0.193082491796191 0.0203638364036602 0.268465411010834 0.555492817258157 0.886197870335554 1.26586587200349 1.70037344743455 2.19625255348559 2.76076131200214 3.40196239072959 4.12880973064462 4.95124450279001 5.88030127084102 6.92822543858798 8.10860317531671 9.43650513785091 10.928645447047; -0.0220677013288412 -0.0251677472878717 -0.028421793345265 -0.0318372154311556 -0.0354217129773619 -0.0391833197539417 -0.0431304146566466 -0.0472717323791584 -0.0516163738939153 -0.0561738166540362 -0.0609539244161963 -0.0659669565701421 -0.0712235768446992 -0.0767348612424205 -0.0825123050352584 -0.0885678286315805 -0.0949137821002358 -0.101562948109943 -0.108528543011696 -0.115824215757824 -0.123464044313433 -0.131462529173767 -0.139834583554064 -0.148595519766334 -0.157761031239389 -0.167347169574051 -0.177370315953749 -0.187847146151187 -0.198794588283407 -0.210229772369473 -0.222169970636153 -0.234632527396214 -0.247634777189902 -0.261193949731626 -0.275327060038983 -0.290050781938612 -0.305381302940731 -0.321334158249738 -0.33792404142942 -0.355164588965639 -0.373068135663876 -0.391645437480688 -0.410905358013313 -0.430854514456597 -0.451496878376733 -0.472833326142366 -0.494861133290057 -0.51757340647728 -0.540958445985512 -0.564999030971559 -0.58967161881925 -0.61494544900725 -0.640781540872603 -0.667131573502965 -0.693936634721808 -0.721125824727108 -0.748614698390968 -0.776303528509465 -0.804075370391305 -0.831793906071255 -0.859301044108621 -0.886414248358466 -0.912923566257978 -0.938588324023382 -0.963133452672405 -0.986245404938104 -1.00756761888325 -1.02669547931711 -1.043170722911 -1.05647522715299 -1.06602411691722 -1.07115811538529 -1.07113505827584 -1.065120481734 -1.05217718471931 -1.03125365621313 -1.00117124593731 -0.960609944419737 -0.908092624028638 -0.841967576883602 -0.760389168179161 -0.661296404251916 -0.542389193491173 -0.401102054722704 -0.234575001749851 -0.0396213040546896 0.18730820804338 0.450164660521944 0.753344880575282 1.10173981763732 1.50078813616428 1.95653552816027 2.47570035126945 3.06574626219238 3.73496258585377 4.49255323886207 5.34873511214246 6.31484691306031 7.40346957283677 8.62855944165255 10.0055956227078; -0.0201281931512219 -0.023039950338407 -0.0260964251051339 -0.0293045565016333 -0.0326715887869078 -0.0362050817592643 -0.03991292105722 -0.0438033283704432 -0.047884871491109 -0.0521664741256459 -0.0566574253751866 -0.0613673887799898 -0.0663064108084974 -0.0714849286553762 -0.0769137771946639 -0.0826041949137953 -0.0885678286315805 -0.0948167367778985 -0.101363390984656 -0.108220675706139 -0.115401885551891 -0.122920719976306 -0.130791274925811 -0.139028030996282 -0.147645837599827 -0.156659892580457 -0.166085716652057 -0.175939121958554 -0.186236173974586 -0.196993145874385 -0.208226464396006 -0.219952646116496 -0.232188222929762 -0.24494965538162 -0.258253232364209 -0.272114955503124 -0.286550406383433 -0.301574594553274 -0.317201784013783 -0.333445295649305 -0.350317282769558 -0.367828476622655 -0.385987898391499 -0.404802533802403 -0.424276966049878 -0.444412962271088 -0.465209008282539 -0.48665978571485 -0.508755585043083 -0.531481647303375 -0.554817426504519 -0.578735763877452 -0.603201964147639 -0.628172762955256 -0.653595173375072 -0.679405198190028 -0.705526393136605 -0.731868264751403 -0.758324484690932 -0.784770900452483 -0.811063320273451 -0.83703504760779 -0.862494137947253 -0.887220347845154 -0.91096174278204 -0.93343092695336 -0.954300854123038 -0.97320017433387 -0.989708066452106 -1.00334850120068 -1.01358387344965 -1.01980793602429 -1.0213379600949 -1.01740603925579 -1.00714944560339 -0.989599936396785 -0.963671899129752 -0.928149210954166 -0.88167067524964 -0.822713883602365 -0.749577335390294 -0.660360629411014 -0.552942522354049 -0.424956627213686 -0.273764500743634 -0.0964258425296336 0.11033450106571 0.350163067244664 0.627118216391328 0.945714895558783 1.31097418420175 1.72847812892391 2.20443042750213 2.74572358157867 3.36001320277099 4.05580022919121 4.84252188922031 5.73065233764515 6.73181398682444 7.85890066338275 9.12621384011898; -0.0182805825136826 -0.0210125400063934 -0.0238803505378883 -0.0268905358927813 -0.0300499055862121 -0.0333655667100378 -0.0368449337678736 -0.0404957384441462 -0.0443260392438027 -0.0483442309297638 -0.0525590536745002 -0.0569796018301207 -0.0616153322079427 -0.0664760717435188 -0.071572024406332 -0.0769137771946639 -0.0825123050352584 -0.0883789743841205 -0.094525545298832 -0.10096417172385 -0.107707399698049 -0.114768163157916 -0.12215977696993 -0.129895926781281 -0.137990655228748 -0.146458343990742 -0.15531369110655 -0.164571682919182 -0.174247559923002 -0.18435677571389 -0.194914948147056 -0.205937801704776 -0.21744109996231 -0.229440566913686 -0.24195179577874 -0.254990143757165 -0.268570611022853 -0.282707702060528 -0.297415267234769 -0.312706322246653 -0.32859284287298 -0.345085532094794 -0.362193556402534 -0.379924247711425 -0.398282766929031 -0.417271724783081 -0.436890755037405 -0.457136034692069 -0.477999745175115 -0.499469467881712 -0.521527506695272 -0.544150129326834 -0.567306718425597 -0.590958822435893 -0.615059095094145 -0.639550111262407 -0.664363045470819 -0.689416198076163 -0.714613352322901 -0.739841943799998 -0.764971021803483 -0.789848979920736 -0.81430103072591 -0.838126396791909 -0.861095187255941 -0.882944925892698 -0.903376693018628 -0.922050839535628 -0.938582226982558 -0.95253494255312 -0.963416432609524 -0.970670992218062 -0.973672541594823 -0.971716613010206 -0.964011463585912 -0.949668220445674 -0.927689954761054 -0.896959570266061 -0.856226379688978 -0.804091229144378 -0.738990015708272 -0.659175427015375 -0.562696713605068 -0.447377284719518 -0.310789896122607 -0.150229174039097 0.0373188077357576 0.255210210406872 0.507180718334065 0.797386815211587 1.13045147110086 1.51151470778856 1.94628955929018 2.4411239988666 3.00306946421517 3.6399566791423 4.36047954369039 5.17428794611679 6.09209044012225 7.12576783020511 8.28849881797161; -0.0165206438302464 -0.0190809427195439 -0.0217686310054412 -0.0245898320256949 -0.0275509401526487 -0.0306586301759954 -0.0339198666919166 -0.0373419134490038 -0.0409323425935717 -0.0446990437482284 -0.0486502328477651 -0.0527944606454453 -0.0571406207904849 -0.0616979573637724 -0.0664760717435188 -0.0714849286553762 -0.0767348612424205 -0.0822365749690395 -0.0880011501489631 -0.0940400428611414 -0.100365083987632 -0.10698847607476 -0.113922787682208 -0.121180944843968 -0.1287762192198 -0.136722212465495 -0.145032836294302 -0.15372228763971 -0.16280501826074 -0.172295698054258 -0.182209171253719 -0.192560404599299 -0.203364426459597 -0.214636255768834 -0.22639081951452 -0.238642857367608 -0.251406811888589 -0.264696702567261 -0.278525981759119 -0.292907370365426 -0.307852670864872 -0.323372555039693 -0.339476323445582 -0.356171633349555 -0.373464191499847 -0.391357407693088 -0.40985200466248 -0.42894557932178 -0.448632109858668 -0.468901402571933 -0.489738471683765 -0.511122844624399 -0.533027784474063 -0.555419420348215 -0.578255775517296 -0.60148568195155 -0.625047568763613 -0.64886811067421 -0.672860721135688 -0.696923873099113 -0.720939228586592 -0.744769556212705 -0.768256413567156 -0.791217568902276 -0.813444133838805 -0.834697375783927 -0.854705175416213 -0.873158090899173 -0.889704986401317 -0.903948177984608 -0.915438044929464 -0.923667049042604 -0.92806309838835 -0.92798218513292 -0.922700219726775 -0.911403975396932 -0.893181047796313 -0.867008724568664 -0.831741648433909 -0.786098145067694 -0.728645073416286 -0.657781041016838 -0.571717810231733 -0.468459702886767 -0.345780790441279 -0.201199634309291 -0.0319513160681069 0.165043530215084 0.393213001713826 0.656371878416135 0.958763631480449 1.30510691838138 1.70064704024909 2.15121288698537 2.66327995120565 3.24404005336514 3.90147848819461 4.64445937747698 5.48282009698959 6.42747573695151 7.49053465646608; -0.0148443332080807 -0.0172407772865392 -0.0197565314569101 -0.0223973386567934 -0.0251691969132647 -0.0280783682823565 -0.0311313878115484 -0.0343350724806638 -0.0376965300694654 -0.041223167892273 -0.0449227013309808 -0.0488031620878409 -0.0528729060681556 -0.0571406207904849 -0.0616153322079427 -0.0663064108084974 -0.0712235768446992 -0.0763769045237451 -0.0817768249670366 -0.0874341277241322 -0.0933599605989815 -0.0995658275162508 -0.106063584122061 -0.112865430776214 -0.119983902551541 -0.127431855809963 -0.135222450873629 -0.143369130252621 -0.151885591827551 -0.160785756315151 -0.17008372826711 -0.1797937497659 -0.189930145885405 -0.200507260877709 -0.211539383929302 -0.223040663199024 -0.235025006704861 -0.247505968465727 -0.26049661812592 -0.27400939209223 -0.288055923994467 -0.302646852037484 -0.317791600543691 -0.333498132687218 -0.349772671090836 -0.366619382591345 -0.384040023074466 -0.402033537832272 -0.420595612400113 -0.439718168280933 -0.459388797357039 -0.479590128116629 -0.500299116077816 -0.521486249968922 -0.543114664311961 -0.565139148047303 -0.587505037721145 -0.610146982522275 -0.632987567088175 -0.655935776488803 -0.678885286124156 -0.701712557421948 -0.724274718175617 -0.746407204099818 -0.767921135677473 -0.788600401604126 -0.80819841707375 -0.826434521764249 -0.842989978636654 -0.857503530521349 -0.86956646688606 -0.878717148117327 -0.884434929048913 -0.886133417280436 -0.883152994985211 -0.874752525338724 -0.860100156332296 -0.838263125485874 -0.808196458746532 -0.768730445552184 -0.718556759539455 -0.656213080554859 -0.580066058350477 -0.488292441455525 -0.378858176043897 -0.249495258977195 -0.0976761063855747 0.0794148260741332 0.284912463025738 0.522305891810338 0.795476864186074 1.1087424115851 1.46690200985106 1.87528977539568 2.33983222557695 2.86711219232315 3.46443954017181 4.1399294085833 4.90258877431364 5.76241221355308 6.73048783629642; -0.0132477819073395 -0.0154878484335897 -0.0178395140465484 -0.0203081585820869 -0.0228994017406867 -0.0256191116030391 -0.0284734131844377 -0.0314686969881146 -0.0346116275112278 -0.0379091516499703 -0.0413685069421544 -0.0449972295765219 -0.0488031620878409 -0.0527944606454453 -0.0569796018301207 -0.0613673887799898 -0.0659669565701421 -0.0707877766729908 -0.0758396603265382 -0.0811327606156468 -0.0866775730468161 -0.0924849343695624 -0.0985660193669961 -0.104932335304251 -0.111595713685662 -0.118568298929595 -0.125862533523181 -0.133491139167311 -0.141467093364675 -0.149803600839594 -0.15851405910737 -0.167612017432007 -0.177111128323627 -0.187025090629776 -0.197367583167086 -0.208152187720293 -0.219392300103069 -0.231101027828245 -0.243291072772166 -0.2559745970374 -0.269163070018025 -0.282867094450079 -0.297096208984248 -0.311858664545829 -0.327161171445797 -0.343008613873125 -0.359403728029052 -0.376346739754888 -0.393834957052034 -0.411862312391436 -0.430418849154676 -0.449490145934495 -0.469056671742596 -0.48909306442001 -0.509567323712559 -0.530439909552419 -0.551662735067161 -0.573178042709494 -0.594917150652798 -0.616799055216743 -0.63872887355976 -0.66059610918543 -0.68227272094081 -0.70361097411736 -0.72444104997855 -0.744568387509316 -0.76377072838555 -0.781794833068691 -0.79835283250974 -0.813118176164295 -0.825721132837107 -0.83574379624916 -0.842714542105525 -0.846101877786793 -0.845307619533648 -0.83965932508013 -0.828401902046642 -0.810688303951882 -0.785569216358416 -0.751981625335592 -0.708736149001934 -0.654503000282128 -0.587796435054275 -0.506957524430816 -0.410135072856389 -0.295264484846275 -0.160044362340564 -0.00191059160242868 0.181992346887907 0.394843140254274 0.640178802602458 0.921933592208481 1.24448208480936 1.61268684333497 2.03195117089652 2.50827748522055 3.04833190950232 3.65951573741984 4.35004449942711 5.12903543413055 6.00660425331321; -0.011727289899089 -0.0138181403784329 -0.0160132317253924 -0.0183175972482086 -0.0207364955854492 -0.0232754188163919 -0.0259401006251794 -0.0287365244834264 -0.0316709318101406 -0.0347498300612883 -0.0379800006939958 -0.0413685069421544 -0.0449227013309808 -0.0486502328477651 -0.0525590536745002 -0.0566574253751866 -0.0609539244161963 -0.0654574468819947 -0.0701772122305752 -0.0751227659129468 -0.0803039806587155 -0.0857310562049578 -0.0914145172179148 -0.097365209126256 -0.103594291550396 -0.110113228974256 -0.116933778263508 -0.124067972587245 -0.131528101247745 -0.139326684864868 -0.147476445297117 -0.155990269609783 -0.164881167321057 -0.174162220068811 -0.183846522742859 -0.193947115018934 -0.204476902110254 -0.215448563419026 -0.226874447622263 -0.238766452562235 -0.251135888130087 -0.263993320129703 -0.27734839288568 -0.291209628112021 -0.305584197284281 -0.320477664454509 -0.335893696112447 -0.351833734324421 -0.368296628969511 -0.385278224436607 -0.40277089564118 -0.42076302766188 -0.439238432678617 -0.458175697209384 -0.477547451885596 -0.497319555167581 -0.517450181474376 -0.537888803175806 -0.558575054759451 -0.57943746622905 -0.6003920514013 -0.62134073523088 -0.642169602593164 -0.662746949073338 -0.68292111223037 -0.702518059503445 -0.721338706383871 -0.739155935661182 -0.755711285439917 -0.770711270181802 -0.783823295222062 -0.794671120999894 -0.80282982858938 -0.807820232971137 -0.80910268479519 -0.806070195094299 -0.798040810451075 -0.784249158431448 -0.763837074594161 -0.735843212985122 -0.699191531632244 -0.652678533066181 -0.594959127189534 -0.524530969773966 -0.439717114340037 -0.33864679801235 -0.219234162970352 -0.0791546941422845 0.0841808693944242 0.27365541747148 0.492477442841821 0.744216433956443 1.03284204893328 1.36276747140942 1.73889739126411 2.16668109995173 2.65217124186182 3.20208882024429 3.82389511937561 4.52587127443011 5.31720629765797; -0.010279319537553 -0.0122278104663793 -0.0142735218400279 -0.0164211563128496 -0.0186756279970834 -0.0210420701859687 -0.0235258431448481 -0.0261325419392505 -0.0288680042637318 -0.0317383182293776 -0.0347498300612883 -0.0379091516499703 -0.041223167892273 -0.0446990437482284 -0.0483442309297638 -0.0521664741256459 -0.0561738166540362 -0.0603746054195449 -0.0647774950354993 -0.0693914509541001 -0.0742257514270301 -0.0792899880966708 -0.0845940649931232 -0.0901481956844468 -0.09596289829661 -0.102048988085253 -0.108417567203115 -0.115080011264468 -0.122047952260647 -0.129333257328287 -0.136948002813571 -0.144904443011089 -0.153214972884024 -0.161892083992682 -0.170948312769864 -0.18039618018347 -0.190248121717826 -0.20051640648455 -0.211213044139895 -0.222349678137182 -0.233937463678466 -0.245986928547365 -0.258507814803066 -0.271508899091789 -0.28499778908424 -0.298980693273044 -0.313462161060207 -0.328444789728034 -0.343928894514172 -0.359912137598807 -0.376389111355181 -0.393350870708864 -0.410784408891474 -0.428672070254977 -0.44699089312705 -0.465711874929241 -0.484799150940024 -0.504209077155831 -0.523889206675273 -0.543777147894493 -0.563799291543549 -0.583869392201903 -0.603886988391553 -0.623735643643364 -0.643280989048493 -0.662368545723421 -0.680821303312831 -0.69843702810618 -0.714985271525435 -0.730204046624697 -0.743796136795747 -0.755424997062109 -0.764710204129703 -0.771222406701787 -0.774477722412893 -0.773931522038798 -0.768971535339736 -0.758910205928771 -0.742976214856175 -0.72030508408636 -0.689928761630671 -0.650764079692433 -0.601599965675358 -0.54108327318705 -0.467703086108043 -0.379773333252128 -0.275413533959478 -0.152527475967697 -0.00877960590632876 0.158431110453197 0.35200012672089 0.575149350078997 0.831462599389652 1.12492485012809 1.45996566736195 1.84150727034524 2.27501771910566 2.76656976514503 3.32290596556364 3.95151072313503 4.66068998473051; -0.00890048936012191 -0.010713182889297 -0.0126163997671926 -0.0146145271915329 -0.0167121505795307 -0.0189140609209727 -0.0212252622127902 -0.0236509789482157 -0.0261966636289743 -0.0288680042637318 -0.0316709318101406 -0.0346116275112278 -0.0376965300694654 -0.0409323425935717 -0.0443260392438027 -0.047884871491109 -0.0516163738939153 -0.0555283692833078 -0.059628973232932 -0.0639265976737366 -0.0684299534956819 -0.0731480519584373 -0.0780902047107173 -0.0832660221929788 -0.0886854101704683 -0.0943585641127379 -0.100295961101423 -0.106508348909904 -0.113006731856054 -0.119802352982128 -0.126906672063489 -0.134331338889728 -0.142088161197141 -0.150189066559909 -0.158646057467769 -0.167471158729747 -0.176676356245676 -0.186273526078638 -0.196274352641184 -0.206690234674687 -0.217532177553353 -0.228810670280452 -0.240535545362717 -0.252715819547605 -0.265359513185152 -0.278473445729192 -0.292063004619176 -0.306131884480908 -0.320681793249066 -0.335712121442968 -0.351219570415877 -0.367197734942906 -0.383636635008724 -0.400522191098578 -0.417835636678863 -0.435552860870412 -0.453643673561739 -0.472070984373057 -0.490789885956376 -0.509746631093043 -0.528877491917246 -0.54810748834073 -0.567348971367659 -0.586500045454941 -0.605442812377073 -0.624041417178292 -0.642139874719669 -0.659559653033638 -0.67609698716018 -0.691519894331773 -0.705564858269932 -0.717933146923259 -0.728286724180921 -0.736243711897834 -0.741373353926374 -0.743190428717339 -0.74114905137828 -0.734635799803242 -0.722962092550986 -0.705355738479194 -0.680951569662726 -0.648781059749329 -0.607760819542042 -0.556679850139561 -0.494185421298896 -0.418767428681285 -0.328741068161895 -0.222227648270675 -0.0971333429139439 0.048874334386238 0.218392576615096 0.414312117184828 0.639849147332877 0.898580643905267 1.19448346894668 1.53197764067081 1.91597421755611 2.35192828392691 2.84589757690415 3.40460735156302 4.03552214408501; -0.00758756802610429 -0.00927074250513467 -0.0110380526087662 -0.0128935846225783 -0.0148416104204041 -0.0168865944639459 -0.0190332008966907 -0.0212863007091338 -0.0236509789482157 -0.0261325419392505 -0.0287365244834263 -0.0314686969881146 -0.0343350724806637 -0.0373419134490038 -0.0404957384441462 -0.0438033283704431 -0.0472717323791584 -0.0509082732693695 -0.054720552287351 -0.0587164532012097 -0.0629041455115153 -0.067292086640784 -0.0718890229247566 -0.0767039892062123 -0.081746306807352 -0.0870255796292815 -0.0925516880965276 -0.0983347806304917 -0.104385262297916 -0.110713780238395 -0.11733120542824 -0.124248610286145 -0.131477241568448 -0.139028487937857 -0.146913841518491 -0.155144852671319 -0.163733077136696 -0.172690014593745 -0.182027037578828 -0.191755309586187 -0.201885691041659 -0.212428631693938 -0.223394047805515 -0.234791182345594 -0.246628446187986 -0.258913238096223 -0.271651741033643 -0.284848692065328 -0.298507122818927 -0.312628067139246 -0.327210232203851 -0.342249628959828 -0.357739157291251 -0.3736681408281 -0.390021805755313 -0.406780697369653 -0.423920027455919 -0.441408944805785 -0.459209720374662 -0.477276837655894 -0.495555977838127 -0.513982888190422 -0.532482120879297 -0.550965628049724 -0.569331197484319 -0.587460711476091 -0.605218209693223 -0.622447734760535 -0.638970937010884 -0.654584412347671 -0.669056744381541 -0.682125218932203 -0.693492175588958 -0.702820957266854 -0.709731414541289 -0.713794916950639 -0.714528818377636 -0.711390318004689 -0.703769652129419 -0.690982545261996 -0.67226184133608 -0.646748227474122 -0.613479953470808 -0.571381439902341 -0.519250656430849 -0.455745139338451 -0.379366503468358 -0.288443288431695 -0.181111962004361 -0.0552958849181758 0.0913179794432429 0.261304849808852 0.457530670896591 0.683183709005481 0.941809522824946 1.23734966711643 1.57418452467476 1.95718070370669 2.39174348388983 2.88387484536027 3.44023767123248; -0.00633746840302567 -0.00789712877266334 -0.00953483296799824 -0.0112543802775909 -0.013059743528234 -0.0149550757469918 -0.0169447169297045 -0.0190332008966907 -0.0212252622127903 -0.0235258431448481 -0.0259401006251795 -0.0284734131844377 -0.0311313878115484 -0.0339198666919166 -0.0368449337678736 -0.0399129210572201 -0.0431304146566466 -0.0465042603466616 -0.0500415687033136 -0.0537497196093284 -0.0576363660431386 -0.0617094370085138 -0.0659771394499135 -0.0704479589790906 -0.0751306592166459 -0.0800342795279367 -0.0851681309056991 -0.090541789721661 -0.0961650890359677 -0.102048107116053 -0.108201152775255 -0.114634747095565 -0.121359601047889 -0.128386588466572 -0.135726713772088 -0.143391073765994 -0.151390812744872 -0.159737070094055 -0.168440919426709 -0.177513298228199 -0.186964926848526 -0.196806215555822 -0.207047158219937 -0.217697211035712 -0.228765154518793 -0.240258936811055 -0.252185496115823 -0.26455055984286 -0.277358417777007 -0.290611666289741 -0.304310920286677 -0.318454489222834 -0.333038013117583 -0.348054054058566 -0.363491638193861 -0.379335742669401 -0.395566721368432 -0.412159662645646 -0.429083671513631 -0.446301067926062 -0.463766491902233 -0.481425905242072 -0.499215478479386 -0.517060350502776 -0.534873246925895 -0.552552941797906 -0.569982545596044 -0.587027600618305 -0.603533962877085 -0.619325447363629 -0.634201211085844 -0.647932845553506 -0.660261147367461 -0.670892532232755 -0.67949505402594 -0.685693986466878 -0.689066920434125 -0.689138324974827 -0.685373514544811 -0.677171958916605 -0.66385986545105 -0.644681955974113 -0.618792352259375 -0.585244475005658 -0.542979851126524 -0.490815713032775 -0.427431261278568 -0.351352448332531 -0.260935126190685 -0.154346383916624 -0.029543882809469 0.115747023423309 0.284058618577005 0.478208863867544 0.701332435230376 0.95691507571906 1.24883161426418 1.58138803912951 1.95936805538452 2.38808460101212 2.87343684634199; -0.00514724180736942 -0.00658912981353633 -0.00810325282454439 -0.00969313644078633 -0.0113624683070468 -0.0131151044522113 -0.0149550757469918 -0.016886594463946 -0.0189140609209727 -0.0210420701859688 -0.0232754188163919 -0.0256191116030391 -0.0280783682823565 -0.0306586301759954 -0.0333655667100378 -0.0362050817592644 -0.0391833197539417 -0.0423066714777665 -0.0455817794757217 -0.0490155429795552 -0.0526151222462546 -0.0563879421911302 -0.0603416951817548 -0.0644843428418971 -0.0688241166955008 -0.0733695174595191 -0.0781293127707553 -0.0831125331055353 -0.0883284656217531 -0.0937866456202624 -0.099496845286386 -0.10546905933208 -0.111713487114595 -0.11824051075783 -0.125060668747451 -0.13218462440966 -0.139623128615581 -0.147386975977871 -0.155486953722586 -0.163933782326589 -0.172738046907986 -0.181910118243072 -0.191460062156892 -0.201397535894462 -0.211731669924456 -0.22247093345519 -0.233622981752141 -0.24519448313519 -0.257190923299928 -0.269616384348418 -0.282473295628082 -0.295762153159804 -0.30948120408484 -0.323626092170897 -0.338189459986947 -0.353160502879451 -0.368524469354869 -0.384262101889224 -0.400349011539038 -0.416754979012696 -0.433443174069791 -0.450369284240293 -0.467480542886538 -0.484714645559171 -0.501998542412421 -0.519247093132461 -0.536361569381664 -0.553227988156803 -0.569715257684166 -0.585673115511408 -0.600929836284739 -0.615289684298828 -0.62853008325135 -0.640398472697527 -0.650608817452715 -0.658837732600236 -0.664720182791068 -0.667844710131603 -0.667748140101184 -0.663909709573675 -0.655744555082765 -0.642596492909272 -0.623730015314432 -0.598321419222895 -0.565448974792222 -0.524082031502991 -0.473068948566392 -0.41112372446563 -0.336811187202999 -0.248530592183103 -0.144497458477149 -0.0227234563211073 0.119005861078207 0.283155710218682 0.472469367418076 0.689998376042276 0.939135980051128 1.22365412570931 1.54774440939175 1.91606338929687 2.33378272296647; -0.00401407240497628 -0.00534367661149329 -0.00673997752297361 -0.00820623977689993 -0.00974587909336069 -0.0113624683070468 -0.013059743528234 -0.0148416104204041 -0.0167121505795307 -0.0186756279970834 -0.0207364955854493 -0.0228994017406868 -0.0251691969132647 -0.0275509401526487 -0.0300499055862121 -0.0326715887869078 -0.0354217129773619 -0.0383062350104631 -0.0413313510580292 -0.0445035019296316 -0.0478293779330453 -0.0513159231759351 -0.0549703391951552 -0.0588000877852756 -0.0628128928814937 -0.067016741333742 -0.0714198823883771 -0.0760308256710869 -0.0808583374393382 -0.0859114348445249 -0.0911993779126583 -0.0967316589176222 -0.102517988782324 -0.108568280100082 -0.114892626320834 -0.121501276593751 -0.128404605698948 -0.135613078435689 -0.143137207761989 -0.150987505900069 -0.159174427532986 -0.167708304118784 -0.176599268238888 -0.185857166775866 -0.19549146158093 -0.205511116142219 -0.215924466599412 -0.226739075266898 -0.237961564624621 -0.249597429510761 -0.26165082500126 -0.274124327185296 -0.287018663740299 -0.300332410871827 -0.314061652809175 -0.328199599633009 -0.342736158752496 -0.357657454841516 -0.372945292481489 -0.388576555136332 -0.404522533396772 -0.420748174669642 -0.437211245645101 -0.453861397942433 -0.470639126303667 -0.487474607563206 -0.504286407359515 -0.520980040158684 -0.537446366615395 -0.553559810588717 -0.569176376240954 -0.584131443558391 -0.59823731832208 -0.611280510001389 -0.623018708217108 -0.633177425295954 -0.641446268982752 -0.647474805555505 -0.650867969363557 -0.651180970137395 -0.647913644253274 -0.640504190424803 -0.628322223979273 -0.610661076895324 -0.586729263060269 -0.555641019672314 -0.516405826279194 -0.467916792515528 -0.408937794071589 -0.338089223680234 -0.253832209818465 -0.154451140243732 -0.0380343102662644 0.0975475033755316 0.254664763210559 0.435955429734098 0.644354027253422 0.883123814442819 1.15589238858522 1.46669108720239 1.81999858915853; -0.00293527177485186 -0.00415783735652636 -0.00544181988684136 -0.00679023520426413 -0.00820623977689993 -0.00969313644078633 -0.0112543802775909 -0.0128935846225783 -0.0146145271915329 -0.0164211563128496 -0.0183175972482086 -0.0203081585820869 -0.0223973386567934 -0.0245898320256949 -0.0268905358927813 -0.0293045565016333 -0.0318372154311557 -0.0344940557490378 -0.0372808479667373 -0.040203595731755 -0.0432685411839918 -0.0464821698929428 -0.0498512152812697 -0.0533826624277786 -0.0570837511288617 -0.0609619780818908 -0.0650250980366883 -0.0692811237418697 -0.073738324491313 -0.0784052230520462 -0.0832905907281781 -0.0884034402858339 -0.0937530164310855 -0.0993487834962118 -0.105200409948899 -0.111317749293757 -0.117710816885279 -0.124389762115621 -0.131364835378647 -0.138646349142996 -0.146244632390724 -0.154169977593512 -0.162432579304676 -0.17104246334127 -0.180009405415282 -0.189342837945203 -0.199051743637624 -0.209144534271655 -0.21962891294507 -0.230511717848537 -0.241798745420951 -0.2534945505026 -0.265602220841257 -0.27812312301653 -0.291056616527012 -0.304399732429571 -0.318146812526964 -0.332289104664729 -0.346814309216578 -0.361706071304365 -0.376943412708717 -0.392500096773453 -0.408343918884481 -0.424435914304487 -0.440729474260261 -0.457169360201092 -0.473690605064128 -0.490217289185218 -0.506661177169134 -0.522920200567951 -0.53887676959581 -0.55439589531592 -0.569323101753296 -0.58348210519442 -0.596672235510407 -0.608665571659089 -0.619203760556387 -0.627994485228658 -0.6347075445322 -0.638970502717225 -0.64036386268094 -0.638415711853272 -0.632595784239706 -0.622308876154332 -0.606887546551867 -0.585584025543792 -0.557561246586768 -0.521882908880012 -0.477502466612043 -0.423250930756783 -0.35782335702432 -0.279763880201244 -0.18744914033485 -0.0790699298762898 0.0473891271643196 0.194172072964026 0.363776521518578 0.558981227540897 0.782876600976391 1.03889847929559 1.33086550267615; -0.00190827363885084 -0.00302881194006643 -0.00420573446815574 -0.00544181988684135 -0.00673997752297361 -0.00810325282454438 -0.00953483296799823 -0.0110380526087662 -0.0126163997671927 -0.0142735218400279 -0.0160132317253924 -0.0178395140465484 -0.0197565314569101 -0.0217686310054412 -0.0238803505378883 -0.0260964251051339 -0.028421793345265 -0.03086160380069 -0.0334212211257298 -0.0361062321334848 -0.0389224516233611 -0.0418759279223358 -0.0449729480637552 -0.0482200425170796 -0.0516239893704012 -0.0551918178546191 -0.0589308110837278 -0.0628485078695823 -0.0669527034515737 -0.0712514489616745 -0.0757530494230796 -0.0804660600559191 -0.0853992806359896 -0.090561747621836 -0.0959627237314771 -0.101611684612246 -0.107518302205192 -0.11369242435881 -0.120144050195043 -0.126883300672957 -0.133920383731638 -0.141265553323 -0.148929061566588 -0.156921103171267 -0.165251751172011 -0.173930882922798 -0.182968095167777 -0.192372606881151 -0.202153148420255 -0.212317835374531 -0.222874025313923 -0.233828155441669 -0.245185558936581 -0.256950257526373 -0.269124727563891 -0.28170963657948 -0.294703546952089 -0.308102582975672 -0.321900057192238 -0.336086051414407 -0.350646947363893 -0.365564901302962 -0.38081725642791 -0.396375886120831 -0.412206460411524 -0.428267627177708 -0.444510098700442 -0.460875633183478 -0.477295899730002 -0.493691214036481 -0.509969130698635 -0.526022876515087 -0.541729607504644 -0.556948470506605 -0.571518448191229 -0.585255964048907 -0.597952221428815 -0.60937024793567 -0.619241613438704 -0.627262786569414 -0.633091090849755 -0.636340217462781 -0.636575247111442 -0.633307128362484 -0.625986554290142 -0.613997173062482 -0.596648061289552 -0.573165381408406 -0.542683136039495 -0.504232923028093 -0.456732584690535 -0.3989736335156 -0.329607324113058 -0.247129227429078 -0.149862148023293 -0.0359372083721486 0.0967270944416319 0.250448074859758 0.427804525739385 0.6316651290747 0.865219901397733; -0.000930628758592852 -0.00195392660570198 -0.00302881194006643 -0.00415783735652635 -0.00534367661149328 -0.00658912981353632 -0.00789712877266333 -0.00927074250513468 -0.010713182889297 -0.0122278104663793 -0.0138181403784329 -0.0154878484335897 -0.0172407772865392 -0.0190809427195439 -0.0210125400063934 -0.023039950338407 -0.0251677472878717 -0.0274007032801249 -0.0297437960407805 -0.0322022149793107 -0.0347813674642625 -0.0374868849387338 -0.0403246288172823 -0.0433006960970966 -0.0464214246069331 -0.04969339780689 -0.0531234490404506 -0.0567186651272234 -0.0604863891703095 -0.0644342224360599 -0.068570025145966 -0.0729019160003599 -0.0774382702312566 -0.0821877159568015 -0.0871591285821233 -0.0923616229606251 -0.0978045429955446 -0.103497448323601 -0.109450097680316 -0.115672428499689 -0.122174532248816 -0.128966624940227 -0.136059012200527 -0.143462048202735 -0.151186087690688 -0.159241430236278 -0.167638255773099 -0.176386550342347 -0.185496020867381 -0.194975997640945 -0.204835323062378 -0.215082224999511 -0.225724172969888 -0.236767715136379 -0.248218293891252 -0.260080037558003 -0.272355525469175 -0.285045523378222 -0.298148685831198 -0.3116612217561 -0.325576519120447 -0.339884724056868 -0.354572269357503 -0.36962134668585 -0.385009316243526 -0.400708046953264 -0.416683179471138 -0.43289330351317 -0.449289040065492 -0.465812018033896 -0.482393733767582 -0.498954280651859 -0.515400934592829 -0.531626579699823 -0.547507956793206 -0.562903715509065 -0.577652248719533 -0.591569285717252 -0.604445218101875 -0.61604212953005 -0.626090497420131 -0.634285531307829 -0.640283108794888 -0.643695265881866 -0.644085193886252 -0.640961690072303 -0.633773003507908 -0.621900011460062 -0.604648654781591 -0.581241553158672 -0.550808712705037 -0.512377229120242 -0.464859879382799 -0.40704248362125 -0.337569906283521 -0.254930551881339 -0.157439195282876 -0.0432179696094739 0.0898246839086917 0.244017320435641 0.421951289560595;         -0 -0.000930628758592852 -0.00190827363885084 -0.00293527177485186 -0.00401407240497628 -0.00514724180736941 -0.00633746840302567 -0.0075875680261043 -0.00890048936012191 -0.010279319537553 -0.011727289899089 -0.0132477819073395 -0.0148443332080807 -0.0165206438302464 -0.0182805825136826 -0.0201281931512219 -0.0220677013288412 -0.0241035209445099 -0.026240260882773 -0.0284827317180986 -0.0308359524154982 -0.0333051569918471 -0.0358958010956265 -0.0386135684564042 -0.0414643771481977 -0.0444543856028245 -0.0475899983003542 -0.050877871053723 -0.0543249157933348 -0.0579383047449309 -0.0617254738800111 -0.065694125502472 -0.0698522298177288 -0.0742080253111872 -0.0787700177413383 -0.0835469775287053 -0.0885479352951127 -0.0937821752779933 -0.0992592263113494 -0.104988850028207 -0.110981025898512 -0.117245932671031 -0.123793925737341 -0.130635509880058 -0.137781306805233 -0.145242016789904 -0.153028373699237 -0.161151092542784 -0.169620808645219 -0.178448007402501 -0.187642943478624 -0.197215548169792 -0.207175323520629 -0.217531221619373 -0.2282915073244 -0.2394636024809 -0.251053909472188 -0.263067611712753 -0.27550844842721 -0.288378460768166 -0.301677706003669 -0.315403936147946 -0.329552237014048 -0.344114623229625 -0.359079584272906 -0.374431576050178 -0.390150451943027 -0.406210826597399 -0.422581365000414 -0.439223988587374 -0.45609298923248 -0.47313404099323 -0.490283098390468 -0.50746516880237 -0.524592945219238 -0.541565284133192 -0.558265511707844 -0.574559539571306 -0.590293769583136 -0.605292764721953 -0.619356660803147 -0.632258291040726 -0.643739992486655 -0.653510060085011 -0.661238810433474 -0.666554213314569 -0.669037044602756 -0.668215509226246 -0.663559277414448 -0.654472871438503 -0.640288333392637 -0.620257097201128 -0.593540979895322 -0.559202198205536 -0.516192306563229 -0.463339941609507 -0.399337246146236 -0.322724832023488 -0.231875126596761 -0.124973930959899          0];
+;
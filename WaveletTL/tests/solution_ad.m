@@ -0,0 +1,6 @@
+x = [         0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1;          0   0.015625    0.03125   0.046875     0.0625   0.078125    0.09375   0.109375      0.125   0.140625    0.15625   0.171875     0.1875   0.203125    0.21875   0.234375       0.25   0.265625    0.28125   0.296875     0.3125   0.328125    0.34375   0.359375      0.375   0.390625    0.40625   0.421875     0.4375   0.453125    0.46875   0.484375        0.5   0.515625    0.53125   0.546875     0.5625   0.578125    0.59375   0.609375      0.625   0.640625    0.65625   0.671875     0.6875   0.703125    0.71875   0.734375       0.75   0.765625    0.78125   0.796875     0.8125   0.828125    0.84375   0.859375      0.875   0.890625    0.90625   0.921875     0.9375   0.953125    0.96875   0.984375          1];
+;
+y = [         0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625   0.015625;    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125    0.03125;   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875   0.046875;     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625     0.0625;   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125   0.078125;    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375    0.09375;   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375   0.109375;      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125      0.125;   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625   0.140625;    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625    0.15625;   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875   0.171875;     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875     0.1875;   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125   0.203125;    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875    0.21875;   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375   0.234375;       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25;   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625   0.265625;    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125    0.28125;   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875   0.296875;     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125     0.3125;   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125   0.328125;    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375    0.34375;   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375   0.359375;      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375      0.375;   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625   0.390625;    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625    0.40625;   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875   0.421875;     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375     0.4375;   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125   0.453125;    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875    0.46875;   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375   0.484375;        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5;   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625   0.515625;    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125    0.53125;   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875   0.546875;     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625     0.5625;   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125   0.578125;    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375    0.59375;   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375   0.609375;      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625      0.625;   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625   0.640625;    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625    0.65625;   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875   0.671875;     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875     0.6875;   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125   0.703125;    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875    0.71875;   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375   0.734375;       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75;   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625   0.765625;    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125    0.78125;   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875   0.796875;     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125     0.8125;   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125   0.828125;    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375    0.84375;   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375   0.859375;      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875      0.875;   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625   0.890625;    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625    0.90625;   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875   0.921875;     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375     0.9375;   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125   0.953125;    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875    0.96875;   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375   0.984375;          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1];
+;
+z = [         0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0 4.85493035649246e-06 1.00997510656538e-05 1.57650350926951e-05 2.18817045016019e-05 2.84860524389351e-05 3.56147665981981e-05 4.33085128662582e-05 5.16084051624628e-05 6.05674565514645e-05 7.0239195764649e-05 8.06695338380185e-05 9.19234632043977e-05 0.000104056074296709 0.000117131346751199 0.000131220069599238 0.000146387327527452 0.000162735434615876 0.000180347066119097 0.000199300996991833 0.00021970566525802 0.000241648741547566 0.000265233461402858 0.000290567541501043 0.000317764378160763 0.000346951968302736 0.000378262664870086 0.000411822520302783 0.000447760637590209 0.000486209287701163 0.000527301526940429 0.000571168815415432 0.000617939165026493 0.000667747276377291 0.000720709889707926 0.000776943498506232 0.000836526231806499 0.000899511957441759 0.000965950086181351 0.00103583113750009 0.00110910669661523 0.00118565979486941 0.00126530038842231 0.00134776100467669 0.0014326644789131 0.00151947928384163 0.00160751251426966 0.00169588312935537 0.00178347591511517 0.00186886143228686 0.00195027741405427 0.00202556803263893 0.00209209297124515 0.00214659246246547 0.00218515051174243 0.00220305490256659 0.00219459449504383 0.00215291647770956 0.00206980333905448 0.00193546349724919 0.00173822518393243 0.00146417901503224 0.00109680115219526 0.00061650052614143          0;          0 1.00994214737934e-05 2.10084735362619e-05 3.27911873070791e-05 4.55129903010165e-05 5.92492070012365e-05 7.4076740078672e-05 9.00807965557779e-05 0.00010734837558493 0.000125985900776291 0.000146101858406957 0.00016779507089118 0.000191199191413232 0.000216431955855405 0.000243628138140293 0.00027293579710892 0.000304494507395743 0.000338505682528849 0.000375137861152377 0.000414559650486024 0.000456993547620723 0.000502627595168301 0.000551678982059474 0.000604374210824192 0.000660951470091252 0.000721670004197072 0.000786798202178817 0.000856600899507935 0.00093134934586698 0.00101132004042729 0.00109679115238974 0.00118803882196703 0.00128533218135806 0.00138894350278726 0.00149911062350216 0.00161607379805601 0.00174000007878952 0.00187100600707631 0.0020091902960352 0.00215453542134407 0.00230693925270356 0.00246616692413138 0.00263183013712925 0.00280336534424145 0.00297997860991853 0.00316056694014765 0.00334368829704087 0.00352750238909213 0.0037096769324092 0.00388726231335516 0.00405660821131792 0.0042132166215923 0.00435157463592131 0.00446493568649165 0.00454516544791831 0.00458242343137559 0.00456481072878248 0.00447809919449152 0.00430522493835765 0.00402580802059122 0.00361554660506268 0.0030455229817859 0.00228136488917859 0.0012823335926789          0;          0 1.57643603717322e-05 3.27906420937956e-05 5.11792196295772e-05 7.10336093314349e-05 9.24710576790536e-05 0.000115612362074602 0.000140591145924842 0.000167545064928859 0.000196635578165977 0.000228028785716122 0.00026188342171404 0.000298405468414074 0.000337782862164335 0.000380227985823863 0.00042597264882162 0.000475240321001101 0.000528330448215154 0.000585502768141138 0.000647026777573986 0.000713244653714692 0.000784457512509012 0.000861007214121932 0.000943250116111862 0.00103156059540926 0.00112633516121797 0.00122798468877683 0.00133692552718027 0.0014535841165078 0.00157839314136707 0.0017117879404463 0.00185420255406136 0.00200606034310797 0.00216777791438924 0.00233972245086831 0.00252226523574141 0.00271567303892781 0.00292013388104927 0.00313579566915426 0.00336263427185191 0.00360048854259244 0.00384899893232601 0.00410756482000376 0.00437529798105012 0.0046509481029752 0.00493280078561015 0.00521860863086904 0.00550549388675914 0.00578980534355456 0.00606695691290775 0.00633125886820775 0.00657568467867432 0.00679161656992365 0.00696854947871923 0.00709378375055938 0.00715193456849533 0.00712443862796647 0.00698909392115707 0.00671928530689265 0.0062831972727328 0.00564288917681302 0.00475323592513727 0.00356059213176535 0.00200137778431468          0;          0 2.18809831392794e-05 4.55121276967894e-05 7.10330366688818e-05 9.85888986323015e-05 0.000128341925193056 0.000160460640708236 0.000195130960217632 0.00023254596728072 0.000272924733029242 0.000316494579262681 0.000363481152178525 0.000414166431419811 0.000468816108816915 0.000527726990815422 0.000591221118210522 0.000659615261315946 0.000733308320532572 0.000812659057561192 0.000898048916082239 0.000989945374449826 0.00108877532329565 0.00119501601186491 0.00130916472192013 0.00143174341468494 0.00156329484153199 0.00170438177385909 0.00185558480497517 0.00201749860906049 0.00219072401339273 0.00237586558273878 0.00257352847751553 0.00278430339571378 0.00300876210679589 0.00324741345327145 0.00350076701455728 0.00376920007242334 0.00405298093244705 0.00435230658718668 0.00466714773491088 0.00499727891208558 0.00534220318587442 0.00570108762980886 0.00607269073993227 0.00645526622070377 0.0068464483263655 0.0072431280711308 0.00764131203269786 0.00803592821958211 0.00842060854659894 0.00878744330714503 0.0091266910952168 0.00942639699563797 0.0096719810927125 0.00984578674251405 0.0099264687441639 0.00988832276832916 0.00970048797386927 0.00932600665301576 0.00872073006742726 0.00783201959297787 0.00659723101267528 0.0049419084342016 0.00277779993827759          0;          0 2.84855469892167e-05 5.92483608621507e-05 9.247015833737e-05 0.000128341383602807 0.000167072547657419 0.00020888402517373 0.000254017898073281 0.000302727449089618 0.000355293361607767 0.000412009210681097 0.000473174554912087 0.000539151039651089 0.00061028966722719 0.000686978482322627 0.000769636237877094 0.000858682409935767 0.000954619258085135 0.00105791487545395 0.00116907370991841 0.00128869416202881 0.00141734159845479 0.00155563937536771 0.00170423676790986 0.00186381471758957 0.00203507389183027 0.00221874106472671 0.00241557380439378 0.00262634806281633 0.00285184685731878 0.00309285812548098 0.0033501713678187 0.00362455772781606 0.00391675629924871 0.00422743123157693 0.00455723742927719 0.00490667324150378 0.00527609634765531 0.00566575300053796 0.00607561016480808 0.00650537275921351 0.00695439457066315 0.00742159118865062 0.00790533922757685 0.00840335680273956 0.008912576883044 0.00942896266718543 0.00994731462684343 0.0104610259069627 0.010961805150575 0.0114393463442711 0.0118809721424952 0.0122711234994326 0.0125908277017138 0.0128170778675021 0.0129220898613612 0.0128724424669796 0.0126279317900774 0.0121404375066179 0.0113524926798988 0.0101955853249476 0.00858815977987357 0.00643329232030072 0.00361609202384926          0;          0 3.56147037290456e-05 7.40763504856662e-05 0.000115611655899897 0.000160459903157658 0.00020888352805431 0.000261159170075153 0.000317588953272193 0.000378491130866728 0.000444213107093787 0.000515120850190806 0.000591594831507501 0.000674080030420165 0.000763020314773042 0.000858901782135119 0.000962246378368881 0.00107358569051215 0.00119353211741453 0.00132267626647717 0.0014616566470823 0.00161120820301943 0.00177204747834819 0.00194495465401203 0.00213074206770867 0.00233026103722264 0.00254438472664844 0.00277401892605397 0.00302011090895164 0.0032836309488346 0.00356556039059379 0.00386688678149929 0.00418859718216359 0.0045316562899624 0.00489698421589702 0.00528541559504102 0.00569775744703116 0.0061346395052011 0.00659651819479415 0.00708368948676045 0.00759611804887229 0.00813343388142556 0.00869483033880502 0.00927895309204699 0.00988376827164868 0.0105064187976359 0.0111430764135144 0.0117887002743293 0.0124367820841451 0.0130790538166364 0.0137051596819853 0.0143022211470425 0.0148543691471912 0.0153421388009517 0.0157418450638894 0.0160247359795943 0.0161560474326232 0.0160939662235674 0.0157882501745381 0.0151787557994507 0.014193625671573 0.0127471828644408 0.0107374732130291 0.00804331373814287 0.00452107095097041          0;          0 4.33091773983464e-05 9.00814063379506e-05 0.000140591286549566 0.000195130523603901 0.000254017103496175 0.000317588345021797 0.000386210289611965 0.000460270932289409 0.000540191273465334 0.00062641758122089 0.000719418239995276 0.000819725231509349 0.000927882844138955 0.00104448204298994 0.00117015444762585 0.00130555316133838 0.00145141020175857 0.00160845457284531 0.00177746990279707 0.00195933329968571 0.00215492518631281 0.00236519328623985 0.00259112406889566 0.00283375062433244 0.00309413728704026 0.00337338796944051 0.0036726523810346 0.00399310816052781 0.0043359511178973 0.00470238464698066 0.00509360658848499 0.0055107883020758 0.00595504880108531 0.00642741257705591 0.00692884555488514 0.00746011916888128 0.00802179796215572 0.00861422808169863 0.00923737333512649 0.00989078350354939 0.0105734768322147 0.011283807114938 0.0120193013960515 0.0127764877941986 0.0135507081278808 0.0143358325208182 0.0151239412478636 0.0159049788037229 0.0166663595018288 0.0173924317735262 0.0180638790556279 0.0186570289259627 0.0191430968117591 0.0194871231814897 0.0196468228942561 0.0195713156714327 0.0191995310223149 0.0184583469542527 0.0172603722823627 0.015501402581593 0.0130574645869396 0.00978119110301996 0.00549791866031507          0;          0 5.16101399910356e-05 0.000107350630006964 0.000167546839068508 0.000232546478517963 0.000302726709953862 0.000378489945979064 0.000460270020652676 0.000548529442112543 0.000643771090453022 0.000746530848439424 0.000857372013942677 0.000976917239346824 0.00110581878857576 0.00124477930892229 0.00139454657442932 0.0015559046099036 0.00172971767656989 0.00191687220252402 0.00211830799209102 0.00233504993866809 0.0025681550451508 0.00281874929556462 0.0030880043602451 0.00337714649750368 0.00368745421985874 0.0040202530023739 0.00437690772113108 0.00475881642375148 0.00516740552281819 0.0056041104956136 0.00607035318293726 0.00656752471514278 0.00709696530585559 0.00765991308679951 0.00825749967823349 0.00889064853223551 0.00956004168180848 0.0102660759078787 0.0110087155946351 0.0117874250032681 0.0126010290054031 0.0134475639710008 0.014324089255967 0.0152264785714523 0.0161491663518063 0.0170848399422073 0.0180240655266998 0.0189548738133218 0.0198622547482 0.02072755420475 0.0215277523417045 0.0222346674911745 0.0228139606908993 0.0232239346698099 0.0234142422161038 0.0233242608758192 0.0228811937711707 0.0219978770133667 0.0205701714148004 0.0184739115182834 0.015561334550297 0.0116568143262112 0.00655218613057973          0;          0 6.05693299236312e-05 0.000125988486671913 0.000196637796710793 0.000272925587554032 0.000355292736770722 0.000444211765258951 0.000540189931683551 0.000643770426457409 0.000755544367036951 0.000876144172142023 0.00100623589977848 0.00114654049699024 0.00129782638202745 0.00146091641501236 0.00163668421474487 0.00182605553315076 0.00203003664861187 0.00224968303352127 0.00248610356256335 0.00274048337635867 0.00301406918429479 0.0033081785695263 0.0036241838163942 0.00396352042923878 0.00432769735015157 0.00471827847735703 0.0051368617617887 0.00558508399976104 0.00606461965560116 0.00657715386047351 0.00712435110117401 0.00770784056949555 0.008329199907035 0.00898989639445004 0.00969124121622766 0.0104343223911463 0.0112199484884267 0.0120485707094209 0.0129201539911337 0.0138340700189285 0.0147889362236196 0.0157824471214791 0.0168111577093833 0.017870235043024 0.0189531354860709 0.020051269995648 0.0211535708380226 0.0222460018364024 0.0233109348073487 0.0243264720173283 0.0252655979913766 0.026095260417769 0.0267751354208968 0.0272562716550499 0.027479615342352 0.0273740245150186 0.0268540473108231 0.0258173639153843 0.0241417597145579 0.0216815242145169 0.0182632341893722 0.0136807766555245 0.00768983431018915          0;          0 7.02390014464785e-05 0.000146101504847317 0.000228028285234938 0.00031649392370753 0.000412008469135787 0.000515120165191238 0.000626417083851352 0.000746530664810242 0.000876144226378267 0.00101599078257117 0.00116684784459384 0.00132954623382488 0.00150497932538059 0.00169410043884762 0.00189792193755976 0.00211752350650865 0.00235406107517143 0.00260876408460374 0.00288292521100471 0.00317790914497117 0.00349516585382671 0.00383622047933929 0.00420266567687717 0.00459616695635728 0.0050184729197047 0.00547139590385671 0.00595679002054929 0.00647655445064104 0.00703263047095942 0.00762697177054833 0.00826150955400996 0.00893813454768064 0.00965867351895531 0.0104248316716507 0.0112381207021143 0.0120998079768918 0.0130108373220503 0.0139717214744508 0.0149824244396735 0.0160422165161729 0.0171494945077752 0.0183015844477473 0.0194944922349917 0.0207226133799199 0.0219783622616125 0.0232517799773318 0.0245300278832257 0.0257968230290475 0.0270317340921337 0.028209375200694 0.0292984063143399 0.0302604833863022 0.0310488655712184 0.0316068190731195 0.0318658356031662 0.0317433740988965 0.031140380207342 0.0299382251333657 0.0279951782332315 0.0251422495010162 0.0211783460315812 0.0158644494482691 0.00891725844335445          0;          0 8.06688096394062e-05 0.000167794446068224 0.000261883624006606 0.000363482815550125 0.000473177584595268 0.000591598400458369 0.000719421537136444 0.000857374250611013 0.00100623683016367 0.00116684775107282 0.00134010467080654 0.00152695986475288 0.0017284404674342 0.00194564050453651 0.00217972398370443 0.00243193672894221 0.00270359609082675 0.00299611453950774 0.00331098328385445 0.00364976586719289 0.00401412906622666 0.00440582154082144 0.00482667607439452 0.00527860894198724 0.00576362313756204 0.00628379495426454 0.0068412577505839 0.00743819672777371 0.00807683873591825 0.00875942492593816 0.00948817729205177 0.0102652715682431 0.0110928000335505 0.0119727192771939 0.0129067624550136 0.0138963910623892 0.0149426929028631 0.0160462493638884 0.0172070220353797 0.0184241710178014 0.0196958576657163 0.0210190112639728 0.0223890438745541 0.0237995145727704 0.0252417172253899 0.0267042149841909 0.0281722613028603 0.029627146569072 0.0310454161001113 0.0323979161434547 0.0336486531615627 0.0347535702814132 0.0356589980869164 0.0362998124116594 0.0365973025109496 0.0364566486467946 0.0357641103767594 0.0343834607773628 0.0321519176392783 0.0288753820360847 0.0243229150945549 0.018220007388926 0.010241299203742          0;          0 9.19189936609586e-05 0.000191191964658059 0.000298397058520442 0.00041415827575402 0.000539143927398411 0.000674074099679269 0.000819720657320065 0.000976914239595906 0.00114653913763415 0.00132954641469987 0.00152696256758846 0.00173987290537219 0.00196944712451942 0.00221693020345044 0.00248365069389762 0.00277103276482462 0.0030805707146275 0.0034138728596964 0.00377264367272609 0.00415866485252472 0.00457383353661987 0.00502013786245931 0.00549967049853105 0.00601461924454867 0.00656726220371056 0.00715996112786076 0.00779515170819246 0.00847532880220511 0.00920302359399615 0.00998078360036031 0.010811145676942 0.0116965940384771 0.0126395082942197 0.0136421153137633 0.014706390660074 0.0158340047384317 0.017026198050483 0.0182836277493561 0.0196062515250592 0.0209931104689856 0.0224421123810085 0.0239497582489934 0.0255108215590595 0.0271179600615946 0.0287612539695161 0.0304276657896822 0.0321004040809768 0.0337581526803695 0.0353741789079577 0.0369152469716965 0.0383403809051691 0.039599389917892 0.0406310717551067 0.0413612112928046 0.04170014738555 0.0415399020389654 0.0407508258145811 0.039177665205137 0.0366349559667737 0.0329015659112258 0.0277143363963635 0.0207604837792949 0.0116692725488568          0;          0 0.000104055442302665 0.000216431165685236 0.000337782237607091 0.000468815824397444 0.000610289690254726 0.000763020403476762 0.000927882808220389 0.00110581849406049 0.00129782595692849 0.00150497914688395 0.00172844209311371 0.00196944471804903 0.00222931018588745 0.00250944677766167 0.00281136048896878 0.00313666603967863 0.00348705045158891 0.00386433095333981 0.00427044001260695 0.00470739678643354 0.00517734655866074 0.00568253713784822 0.00622534083457657 0.00680823773277933 0.00743380271140081 0.00810470543278512 0.0088237070067802 0.00959363558298223 0.0104173517586971 0.01129773463903 0.0122376600128612 0.0132399440487825 0.0143072763930422 0.0154421739787839 0.016646875723732 0.0179232757241336 0.0192727777551046 0.0206961237052688 0.0221932658804871 0.0237631175519998 0.0254033131316677 0.0271098920339111 0.0288769381903973 0.0306961368971268 0.0325562607688782 0.0344425481654027 0.036336000586198 0.0382124902566647 0.0400417502645364 0.0417861470214229 0.0433993280413364 0.0448244823661557 0.0459922980779296 0.0468187616528461 0.0472023947201636 0.0470210199819563 0.0461278439937609 0.0443471062285794 0.0414688798175211 0.0372428751148741 0.0313711989840673 0.0234998006975002 0.0132090152742806          0;          0 0.000117134659458067 0.000243634058152699 0.000380235676594767 0.000527735484349742 0.000686986878688892 0.000858909249043408 0.00104448780771041 0.00124478266157071 0.00146091743482409 0.00169409998363826 0.00194564056265565 0.00221692528734132 0.00250944379864834 0.00282478213334326 0.00316463663066481 0.00353082476733582 0.00392524402978487 0.00434993559055844 0.00480707464346847 0.00529893710654608 0.00582793842948116 0.00639661051952075 0.00700762508635978 0.00766377525769954 0.00836795506180101 0.00912316523037075 0.00993251537786228 0.0107991905818194 0.0117264122503906 0.0127174226178666 0.0137754604781736 0.0149036974268635 0.0161051575552674 0.0173826693445665 0.0187387560148758 0.0201755501344762 0.0216946311820557 0.0232968366062902 0.0249821118446524 0.0267492335371486 0.0285955401890648 0.0305165736796754 0.0325056711679647 0.0345534681264385 0.0366473348246975 0.038770661170448 0.0409020542669786 0.043014344495014 0.0450734695658802 0.0470370774291461 0.0488529798295927 0.0504571942323178 0.0517717434156683 0.0527020948993645 0.0531339673831224 0.0529297817519965 0.0519243412550104 0.0499198337417743 0.0466799390063118 0.0419228858956062 0.03531336377761 0.0264528249221068 0.0148688849184075          0;          0 0.000131218311200633 0.00027293265762766 0.000425968423964701 0.000591216020426443 0.000769630657271013 0.000962240884124163 0.0011701496701302 0.00139454320648208 0.00163668261277392 0.00189792211425716 0.00217972688409394 0.00248365081045785 0.00281136302008394 0.00316464175859403 0.00354538660864537 0.00395563000976058 0.00439750305471558 0.00487329129210667 0.00538542737303741 0.00593646327927982 0.00652910664590766 0.00716619790643075 0.00785072792668013 0.00858582363767261 0.0093747276121643 0.0102208018316942 0.0111275275012723 0.0120984702622406 0.0131372437312248 0.014247484812576 0.0154328193770762 0.0166967979203418 0.0180428098851 0.0194740232832817 0.0209932665850252 0.0226029256117115 0.0243047679757032 0.0260997375102852 0.0279877713003013 0.029967500543442 0.0320359422332262 0.0341881016654509 0.0364165120081862 0.0387106815413357 0.0410564642408916 0.0434352580561864 0.0458230883574758 0.0481895134477031 0.0504963730802327 0.0526962346393895 0.0547306148510623 0.0565278081944258 0.0580005043087657 0.0590428190058222 0.0595266823515319 0.0592979109004581 0.058171477276742 0.0559258050850969 0.0522961252153162 0.0469667361021283 0.0395620032089954 0.0296354284771983 0.0166578015475358          0;          0 0.000146391751797137 0.000304502175009475 0.000475250049614636 0.000659625863889481 0.000858692820993019 0.00107359496980676 0.00130556042502911 0.00155590902917133 0.001826057109069 0.00211752306675382 0.00243193568697177 0.00277102821027979 0.00313666225822125 0.00353082273839466 0.00395562537665275 0.0044133297812647 0.00490632750001149 0.005437172596624 0.00600856991065283 0.00662336679036375 0.00728458507574957 0.0079953981541583 0.00875913580457893 0.00957927952089151 0.0104594581354994 0.0114034333802178 0.0124150811365637 0.0134983712455286 0.0146573409298491 0.0158960533048123 0.0172185453898658 0.0186287700537944 0.0201305196851072 0.0217273364972682 0.0234223751580717 0.0252182895230656 0.0271170477683895 0.0291197109364939 0.031226206275353 0.0334350107292602 0.0357427904240746 0.0381439712730841 0.040630225235214 0.0431898560286578 0.0458070681859771 0.0484611049904105 0.0511252227423569 0.053765477433872 0.0563392626801836 0.0587936575985471 0.0610634246462983 0.0630685839075455 0.0647117057948555 0.0658746034081748 0.0664144324754245 0.0661592027072049 0.0649024466981706 0.0623969291003988 0.0583472514772163 0.052401208091056 0.0441396812950765 0.0330645165793695 0.0185852545588586          0;          0 0.000162735554602077 0.000338505763262674 0.000528330410323819 0.000733308159780197 0.00095461897320149 0.00119353171576942 0.00145140973824415 0.00172971724982267 0.00203003636253073 0.00235406103962025 0.00270359662075065 0.00308057024467573 0.00348705058278206 0.00392524499863578 0.0043975027143694 0.00490632857944057 0.00545439405756222 0.00604454140643543 0.00667976934566542 0.00736324452706271 0.00809832631275177 0.00888854614556157 0.00973759985642941 0.0106493519255748 0.011627845640508 0.0126772717760551 0.0138019325225738 0.0150062343273218 0.0162946698635807 0.0176717605129713 0.0191419873957489 0.0207097379801546 0.0223792372482593 0.0241544287572331 0.0260388197748081 0.0280353534528262 0.030146213849182 0.032372588145504 0.0347143928345334 0.0371699381363883 0.0397355133849055 0.0424049209603481 0.0451689049063351 0.0480144702401818 0.0509240458204693 0.0538745535439083 0.0568362657001638 0.0597714622768569 0.0626327565322252 0.0653613193930502 0.0678846307057146 0.0701137977264739 0.0719404877908322 0.0732332608033346 0.0738333671734996 0.0735496416157104 0.0721525183210972 0.0693671159876788 0.0648650484949556 0.0582547907626513 0.0490703931268441 0.0367580601870221 0.0206613587586056          0;          0 0.000180343260136735 0.000375131031961926 0.000585493831201561 0.000812649055466488 0.00105790477584263 0.0013226669688396 0.0016084470135878 0.0019168673496985 0.00224968109336142 0.0026087645051554 0.00299611667324832 0.00341387614654309 0.00386433474731284 0.00434993942995189 0.00487329471926408 0.00543717464483268 0.0060445421458257 0.00669854237882815 0.00740249659555968 0.00815991932272449 0.00897453205946897 0.00985025007981288 0.0107911697872012 0.0118015747355971 0.012885942174946 0.0140489128396715 0.0152952554076887 0.0166298541099039 0.0180576893613778 0.019583773379985 0.0212130732192626 0.0229504519263803 0.0248005892238745 0.0267678500719136 0.0288561261950992 0.031068677784754 0.0334079229863822 0.0358751821562573 0.0384703606794013 0.0411915859212829 0.0440347471104107 0.0469929767715461 0.0500560148389139 0.0532094567197196 0.0564338362872865 0.0597035833186515 0.0629857435478122 0.0662385038039691 0.06940937228555 0.0724331751385888 0.0752295121633764 0.0776998523318843 0.0797241718604469 0.0811568210657218 0.0818218687822902 0.0815074409372788 0.0799591506331289 0.076872375977002 0.0718832068720874 0.0645577423146136 0.0543796306316138 0.0407351413916053 0.0228968411406123          0;          0 0.000199302226978275 0.000414561674776019 0.000647029317522734 0.000898051844343772 0.00116907678694685 0.0014616595281972 0.00177747226790386 0.00211830953982101 0.00248610420594827 0.00288292508297026 0.00331098220115839 0.00377264303151687 0.00427043864824876 0.00480707273143714 0.00538542691494872 0.00600856834742948 0.00667976899211927 0.00740249759849419 0.00818042660244817 0.009017446976928 0.00991766697299225 0.0108854114715614 0.0119252119691473 0.013041807180861 0.0142401371451649 0.0155253227914198 0.0169026394638145 0.0183774903542866 0.01995537591091 0.0216418317577335 0.0234423527140498 0.0253623183854289 0.0274068935938865 0.0295808929739889 0.0318886245641393 0.0343336933383279 0.0369187697355232 0.039645314322111 0.0425132210229075 0.0455204182182581 0.0486623672054763 0.0519314798187862 0.0553164156889281 0.0588012497037682 0.0623644793307041 0.0659778493845625 0.0696049364987415 0.073199517190034 0.0767036101761719 0.0800452005141042 0.0831354105228902 0.0858653454337854 0.0881023878030583 0.089685607468201 0.0904205620900935 0.0900730816753374 0.0883620706060094 0.0849509068151034 0.0794374333872553 0.0713421302646556 0.060094398654273 0.0450160038342346 0.0253030792010927          0;          0 0.000219705471113756 0.000456993075910761 0.000713243973943582 0.000989944703750415 0.00128869360876633 0.0016112077732399 0.00195933300996721 0.00233504981057396 0.00274048335984148 0.0031779091246649 0.00364976527101421 0.00415866570394719 0.00470739685064014 0.00529893625172544 0.00593646445652429 0.00662336567168244 0.0073632447309087 0.00815992096835788 0.00901744665615797 0.0099401177848473 0.0109324539722869 0.0119992154820078 0.013145403424148 0.0143762477623709 0.0156971899697096 0.0171138712257754 0.018632113719747 0.0202578807819761 0.0219972251847835 0.0238562385283123 0.0258409852300855 0.0279574024335451 0.0302111792591946 0.0326076171273957 0.0351514722472841 0.037846722118705 0.0406963076799452 0.0437018367429701 0.0468631914199043 0.0501780849754952 0.0536415175045536 0.0572451238702891 0.0609764072058679 0.0648178109705862 0.0687456326958593 0.0727287172823771 0.0767269297180054 0.0806893190531433 0.084551965797372 0.0882354533036477 0.0916418289746581 0.0946511088445138 0.0971170578448885 0.0988622730192048 0.0996724179136463 0.0992893861387913 0.0974033049216725 0.093643111634801 0.0875654931522603 0.0786418806818995 0.0662432748220392 0.0496220589234267 0.0278920939428851          0;          0 0.000241648886707686 0.000502627742284373 0.000784457638725247 0.00108877552187969 0.00141734189625677 0.00177204784075716 0.00215492557347245 0.00256815540762846 0.00301406943805119 0.00349516588624213 0.00401412824746493 0.00457383437278317 0.00517734638311316 0.00582793705422055 0.00652910765727255 0.00728458339585186 0.00809832628457569 0.00897453369810753 0.00991766639686927 0.0109324539603397 0.0120238603702323 0.0131971154305582 0.014457724385641 0.0158114445351003 0.0172642571188045 0.0188223633081369 0.020492172315983 0.022280248788491 0.0241932412924413 0.0262378411529703 0.0284207242183047 0.0307484261492307 0.0332272004091052 0.0358628731608372 0.038660680641227 0.0416250006191618 0.0447590663548979 0.0480646435582442 0.0515416021761481 0.0551874242272842 0.0589966135894141 0.062959970131016 0.0670637522386702 0.0712886489789499 0.0756085915612281 0.079989307164131 0.0843866657658661 0.0887446309772584 0.0929929013204478 0.097044102777653 0.100790521962111 0.104100238306986 0.106812374882404 0.108731814816287 0.109622826336392 0.109201559694566 0.107127191866734 0.102991616318656 0.0963072575088008 0.0864927916661479 0.0728564151938068 0.0545758910460989 0.0306765944550972          0;          0 0.000265233534220728 0.000551679033628944 0.000861007209682005 0.00119501597343882 0.00155563933807017 0.00194495466863869 0.00236519338083991 0.00281874947322837 0.00330817875391476 0.0038362205193799 0.00440582078777611 0.00502013886812501 0.00568253715557313 0.00639660927532672 0.00716619902679064 0.00799539654942159 0.00888854618745161 0.00985025165014983 0.0108854108382918 0.0119992154916459 0.0131971153349874 0.0144848522528371 0.0158684701442632 0.0173542897322462 0.0189488705226356 0.020659013586992 0.0224917553406238 0.0244543029228585 0.0265539553441267 0.0287980585824355 0.0311939417491897 0.0337487800019914 0.0364694326888797 0.0393622901695281 0.0424331005653328 0.0456866696574099 0.0491265484674337 0.052754674872118 0.0565709063007458 0.0605724773954456 0.0647533581031566 0.069103452574684 0.0736076741460868 0.0782448224721391 0.0829862931981115 0.0877944751166368 0.0926209190129448 0.097404104265914 0.102066903906303 0.106513431154202 0.110625437522377 0.114258096491876 0.117234857825886 0.119341593872848 0.120319558075637 0.11985718387745 0.11758040398124 0.113041285375392 0.105704687084637 0.0949325475503245 0.0799655717400045 0.0599012693546525 0.0336699426218102          0;          0 0.000290567560316209 0.000604374262177142 0.000943250183521883 0.00130916475851721 0.00170423678448387 0.00213074213205685 0.00259112420684407 0.00308800455645739 0.00362418399115753 0.00420266568840295 0.00482667538282969 0.00549967135336966 0.00622534084988975 0.00700762396134424 0.00785072882176717 0.00875913444542633 0.00973759998160209 0.0107911710949931 0.0119252114787884 0.0131454036043948 0.0144577243188592 0.0158684701272413 0.0173842581039131 0.0190120084826203 0.0207589090299631 0.0226324121217067 0.0246402215542993 0.0267902281376301 0.029090435974971 0.031548900625077 0.034173646295005 0.0369725286186448 0.0399530645501707 0.0431222582798601 0.0464864016706373 0.0500507562590344 0.0538192162675914 0.057793906008988 0.0619746700423575 0.0663584795028071 0.0709387267220412 0.0757043534396093 0.0806388276371142 0.0857189245384552 0.0909133090794214 0.0961807850994048 0.101468260007339 0.106708330157782 0.111816522423473 0.116687804708281 0.121192619113479 0.125172263816833 0.128433356644337 0.130741335116119 0.131812726601855 0.131306182464313 0.128811918085783 0.123839212380802 0.115801812407658 0.104000692496729 0.0876040438139508 0.0656231548243269 0.0368861665931386          0;          0 0.000317764027498624 0.000660951083590515 0.00103156033971603 0.00143174331104817 0.00186381478244642 0.00233026127742909 0.0028337509838249 0.00337714686203162 0.00396352068796278 0.00459616700069014 0.00527860844492853 0.00601461978147235 0.00680823769539906 0.00766377435371833 0.00858582403148496 0.00957927855671498 0.0106493520493792 0.0118015754406387 0.0130418068681558 0.0143762481063245 0.0158114445036733 0.0173542897258298 0.0190120085430293 0.0207921567871868 0.0227026124365827 0.0247515425313745 0.0269473584278664 0.0292986757838921 0.0318142584447558 0.0345029264778376 0.0373734410183205 0.0404343791558539 0.0436939779800705 0.0471599159535622 0.0508390605377125 0.0547371567676566 0.058858467506249 0.0632053177711961 0.0677775388989948 0.0725718223872574 0.0775809323768153 0.0827927746111538 0.0881892714134855 0.0937450385577582 0.0994257892215837 0.105186469820547 0.110969020203967 0.116699754909709 0.122286252347627 0.127613620913052 0.132540218984743 0.136892500086015 0.140458957566278 0.142983036159377 0.144154734051608 0.143600763431685 0.140872954743684 0.135434642661982 0.126644672231139 0.113738583832633 0.0958066649903794 0.0717676474764275 0.0403399221581258          0;          0 0.000346951899170879 0.000721670099503064 0.00112633539949535 0.00156329495183955 0.00203507382358001 0.00254438464104002 0.00309413726610338 0.00368745427477037 0.00432769743545675 0.0050184729287823 0.00576362294047628 0.00656726254448909 0.00743380283895617 0.00836795467424386 0.00937472767679438 0.010459457770983 0.01162784580669 0.012885942214864 0.0142401369765056 0.0156971903648836 0.0172642570250886 0.0189488704304937 0.0207589090689796 0.0227026124557979 0.0247885970934635 0.0270257948134939 0.0294233780702277 0.0319907421913302 0.0347374651324297 0.0376731861921084 0.040807459204003 0.0441496373416749 0.0477087283108241 0.0514931320149892 0.055510334949806 0.0597666025030501 0.0642665927998175 0.0690128456074696 0.0740051781187236 0.079239981316534 0.0847093466836705 0.090400068432439 0.096292409377881 0.102358665351524 0.108561384144551 0.114851372586482 0.121165239027887 0.127422552770216 0.133522364228685 0.139339207793106 0.144718466690631 0.149470659258396 0.1533648324166 0.156120830209589 0.157400178711598 0.15679530890022 0.153816860028713 0.147878859842843 0.138281232005811 0.124189288542414 0.10460971692872 0.0783619175461309 0.0440464965047592          0;          0 0.000378262864312909 0.000786798723442459 0.00122798534304062 0.00170438206844497 0.00221874089648952 0.00277401857053657 0.00337338761788505 0.00402025277204233 0.00471827838368985 0.00547139585379629 0.00628379497738171 0.0071599612921872 0.00810470568461089 0.00912316528467095 0.0102208016845388 0.011403433531234 0.0126772720019321 0.0140489124275785 0.0155253227781822 0.0171138716463122 0.0188223631845734 0.0206590134284097 0.0226324121063525 0.02475154249992 0.0270257947413971 0.0294649027787625 0.0320788670620297 0.0348779310550878 0.0378725409112824 0.0410732096776731 0.0444903535945326 0.0481341701961661 0.052014476771506 0.0561404290958605 0.0605201877137717 0.0651605843305429 0.0700667001379196 0.0752413034731119 0.0806841958952562 0.0863914422487986 0.0923544222027448 0.0985587401558307 0.104982872019303 0.111596607716408 0.11835912344409 0.125216794591851 0.132100494316574 0.138922518636211 0.145572829290596 0.151914667940283 0.157779434113647 0.162960499249355 0.167206106625216 0.170210835900301 0.171605658289588 0.170946196579054 0.167698940327331 0.161225027524846 0.150761211765471 0.135397457739678 0.114050821671924 0.0854341303820267 0.0480217251399322          0;          0 0.000411822319139306 0.000856600858932867 0.00133692569228059 0.00185558491229271 0.00241557378749605 0.00302011088682417 0.00367265239435122 0.00437690774299627 0.00513686176853157 0.00595678998413749 0.00684125786240118 0.00779515155548915 0.00882370711326692 0.00993251554169962 0.0111275270130296 0.0124150815232057 0.0138019326972264 0.0152952546893837 0.0169026396043649 0.0186321141744652 0.0204921722707561 0.0224917552450772 0.024640221589616 0.0269473584350873 0.0294233780024184 0.032078867034488 0.0349247208746252 0.0379720995893346 0.0412323716170719 0.0447169782706506 0.0484372679051607 0.0524043506924836 0.056628904450144 0.0611208872342378 0.0658891886528671 0.0709412526937505 0.0762826112531055 0.0819162748916012 0.0878420280449914 0.094055583795364 0.100547563866802 0.107302297586625 0.114296346566663 0.121496808856018 0.128859253000654 0.136325301247174 0.143819687863824 0.151246907537988 0.158487182290017 0.165391651964107 0.171776723842692 0.177417410753677 0.182039648330377 0.185310941361887 0.186829514595195 0.186111546782638 0.182576212172752 0.175527969062239 0.164135869407198 0.147409128705648 0.124168747559039 0.0930133438870202 0.0522819358992602          0;          0 0.000447760280691921 0.000931349050800507 0.00145358403056834 0.00201749861600524 0.00262634812183074 0.00328363108367872 0.00399310833375857 0.00475881654630572 0.00558508404138442 0.00647655443262555 0.00743819693845967 0.00847532847611341 0.00959363563412436 0.0107991908906999 0.0120984696124949 0.0134983717706726 0.0150062343800853 0.0166298531632259 0.0183774905051302 0.0202578810982451 0.0222802487430606 0.0244543028621374 0.0267902282343247 0.0292986759224636 0.0319907423042521 0.0348779312051633 0.0379720997594825 0.0412853931027218 0.0448301560458399 0.0486188126846803 0.0526637131973317 0.0569769486700841 0.0615701207713421 0.0664540486239336 0.0716384059141755 0.0771312948770894 0.0829387255846019 0.0890639643078667 0.0955067768694543 0.102262498965243 0.109320940693123 0.116665063501045 0.124269387305794 0.132098132316469 0.140102993522381 0.148220488475412 0.156368808860234 0.164444119986583 0.172316160000214 0.179823064730853 0.186765240667829 0.192898130315995 0.197923706694706 0.201480438271023 0.20313150285368 0.202350890457813 0.198507077714844 0.190843836597815 0.178457702976129 0.160271458416758 0.135003210374089 0.101129319376378 0.0568438442157293          0;          0 0.000486208964562601 0.0010113197208364 0.0015783929765014 0.00219072398559393 0.0028518469451229 0.00356556056014835 0.00433595130237503 0.00516740562925922 0.00606461967035874 0.00703263045399405 0.00807683901271537 0.00920302317944422 0.0104173517819288 0.0117264126922478 0.0131372430858105 0.0146573415352793 0.0162946698138272 0.0180576883834368 0.0199553760551626 0.0219972253020288 0.0241932412443529 0.0265539553091982 0.029090436085081 0.0318142586498988 0.0347374653597051 0.0378725411637185 0.0412323718848213 0.0448301561939247 0.0486792841284146 0.0527932318509705 0.0571854210708623 0.0618689920656205 0.0668565348188638 0.0721597894481459 0.0777892687326514 0.083753779119593 0.0900598416203438 0.0967109969960667 0.103706990966347 0.111042756217004 0.118707233574394 0.126681919835066 0.134939152051677 0.143440072853994 0.152132231894488 0.160946684603988 0.169794622144157 0.178563298155525 0.187111238541438 0.195262667843472 0.20280087063232 0.209460347073515 0.2149174371907 0.218779548363592 0.220572361386183 0.219724727846884 0.215550886382499 0.20722968294886 0.193780071793823 0.174032360510129 0.146594577275358 0.109812283240877 0.061724452022662          0;          0 0.00052730137298798 0.00109679096316244 0.00171178780573557 0.0023758655678971 0.00309285822663881 0.0038668869207695 0.00470238475284931 0.00560411050546006 0.00657715379104579 0.00762697171504685 0.00875942519240946 0.00998078312238476 0.011297734597804 0.0127174231315802 0.0142474843222187 0.0158960539701662 0.017671760469426 0.0195837726868029 0.0216418320050402 0.0238562384981654 0.0262378411761881 0.0287980585839131 0.0315489006425287 0.0345029265279191 0.0376731862251278 0.0410732096773207 0.044716978293617 0.0486188127467192 0.0527932319208947 0.0572548480959969 0.0620182242206583 0.067097618040482 0.0725066735683142 0.0782581130941045 0.0843633435045599 0.090831921423971 0.0976709168593952 0.104884169134028 0.112471402374669 0.120427120633227 0.128739333699252 0.137387972825936 0.146343037259252 0.155562378536848 0.164989123319649 0.174548501616582 0.184144191882387 0.193653899552332 0.202924224938893 0.211764568178281 0.219939858218663 0.227162120566002 0.233080375329578 0.237268879598602 0.239213217469608 0.238293947428794 0.233767369005724 0.224742926717218 0.210156676568801 0.188740056831221 0.15898347618959 0.119092655458401 0.0669408679176703          0;          0 0.000571168970668153 0.00118803892143242 0.00185420255513191 0.0025735285072367 0.00335017144106681 0.00418859720215437 0.005093606515275 0.00607035303004061 0.00712435093010217 0.00826150947537816 0.00948817753148712 0.0108111452146445 0.0122376599086372 0.0137754610141752 0.0154328191672021 0.0172185460222337 0.0191419873527823 0.0212130729919768 0.023442353039919 0.0258409849920655 0.0284207243179835 0.0311939417934573 0.0341736461953529 0.0373734408804708 0.0408074590140915 0.0444903533041409 0.0484372676436159 0.0526637131734023 0.0571854212451033 0.0620182243060835 0.06717789625252 0.0726798805749208 0.0785389534780906 0.0847688930507639 0.0913820553018241 0.0983887929975275 0.105796763196852 0.113610127857051 0.121828588022335 0.130446193486855 0.139449953545405 0.148818125323185 0.158518215316934 0.168504570459393 0.178715586283895 0.189070273595276 0.199464285957436 0.209765144064331 0.219806714585319 0.229382565430235 0.238238036220837 0.24606114548327 0.252471754031447 0.257008726998569 0.259114838983753 0.258119087578267 0.253215914446839 0.243440669600508 0.227640904159264 0.204442501701688 0.172210293393405 0.129000700940707 0.0725100915721805          0;          0 0.000617939774885312 0.00128533273268086 0.00200606058394745 0.00278430348756237 0.00362455770817128 0.0045316560796561 0.00551078794036796 0.00656752434885351 0.00770784031980404 0.00893813451648715 0.01026527182347 0.011696593724567 0.0132399439203933 0.0149036979464191 0.0166967980903673 0.0186287704871083 0.0207097378173117 0.0229504522109014 0.0253623186310082 0.027957401814943 0.0307484262616963 0.0337487800912699 0.0369725284592129 0.0404343789861723 0.0441496371803347 0.0481341698966216 0.0524043504095482 0.0569769487945754 0.0618689924910968 0.0670976181643262 0.0726798803661662 0.0786324766088621 0.0849714055667037 0.0917115868683948 0.098866380659649 0.106446981813576 0.114461672497312 0.12291496137419 0.131806524916035 0.141129933035383 0.150871117889313 0.161006546705381 0.171501078288543 0.182305341453841 0.193352661989634 0.204555407233139 0.215800693673496 0.226945220727305 0.237809221131952 0.248169330513302 0.257750065462818 0.266213905206574 0.273149563203916 0.278058122288323 0.280336721644309 0.279259417058261 0.2739546645217 0.263378817422351 0.246285025329051 0.221186641735619 0.186314562455374 0.139566051509264 0.0784487738033471          0;          0 0.000667748120110608 0.00138894421670412 0.00216777815712425 0.00300876216216059 0.00391675624476294 0.00489698393639651 0.005955048352525 0.00709696489775694 0.00832919968443323 0.00965867357351794 0.0110928002807755 0.0126395081210289 0.0143072761993824 0.0161051579481672 0.0180428103404233 0.020130519816967 0.0223792369242921 0.0248005899500711 0.0274068937117449 0.0302111783026967 0.0332272005363712 0.0364694328477887 0.0399530643976631 0.0436939778678564 0.0477087282860349 0.0520144765970382 0.0566289042683901 0.0615701210766262 0.0668565354430683 0.0725066736823297 0.0785389530091438 0.0849714051992466 0.0918213323562809 0.0991048712056201 0.10683645040851 0.115028160395996 0.123688949471636 0.132823695458828 0.142432048617968 0.152507067500573 0.163033537215658 0.173986020010994 0.185326552776141 0.197001803870299 0.208939703045454 0.221045547038118 0.23319735964754 0.245240317092703 0.256980127926338 0.268175387767446 0.27852845068649 0.287674611261536 0.295169401981559 0.300473659761594 0.302935935670946 0.301771787889305 0.296039396230097 0.284610983954522 0.266139177897832 0.239017505773556 0.201334226357885 0.150817110176244 0.0847728803245254          0;          0 0.000720710378643654 0.00149911075516378 0.0023397221117147 0.00324741325288151 0.00422743131887794 0.00528541567559291 0.00642741255131668 0.00765991302906951 0.00898989638716108 0.0104248318190098 0.0119727194277983 0.0136421151355427 0.0154421736012858 0.0173826694314588 0.0194740237371514 0.0217273362900245 0.0241544283103191 0.026767851053131 0.0295808930271034 0.0326076160897007 0.0358628733690203 0.0393622904434641 0.043122258208868 0.0471599159201171 0.0514931320903982 0.0561404290336431 0.0611208871357237 0.0664540489408567 0.0721597900201144 0.0782581131502734 0.0847688925149252 0.091711586359971 0.0991048709936441 0.106966164743233 0.115311038528264 0.124152539274989 0.133500325423693 0.143359664793773 0.153730179645919 0.164604379835661 0.175965841728619 0.187787109680541 0.200027205160921 0.21262856490962 0.225513408676835 0.238579532595732 0.25169526872931 0.264693502794484 0.277364546426123 0.289447847331522 0.300622151782623 0.310493811333849 0.318583109778187 0.324308112665278 0.326965703465203 0.32570921205728 0.319522114834537 0.307187166001874 0.287250123961729 0.257977074648858 0.21730464879125 0.162780364901311 0.091497321560584          0;          0 0.000776943550831537 0.00161607332118687 0.00252226436605865 0.00350076659571065 0.00455723765658031 0.00569775788582073 0.00692884596026271 0.00825749997368804 0.0096912414089047 0.0112381208967537 0.0129067624840567 0.0147063904762074 0.0166468752356368 0.0187387558201148 0.0209932669315136 0.0234223746972374 0.0260388192978942 0.0288561272443744 0.0318886245734154 0.0351514713145726 0.038660680910794 0.0424331009122254 0.0464864016797837 0.0508390605531837 0.0555103350665985 0.0605201877516495 0.0658891886378965 0.0716384061038446 0.0777892690381375 0.0843633434924801 0.0913820549253481 0.0988663802594835 0.106836450150928 0.11531103840211 0.124306931933586 0.133838195104092 0.143915240490932 0.154543746745443 0.165723306340331 0.177445843100175 0.189693657869265 0.202437159116495 0.215632159386618 0.22921659263666 0.243106627621299 0.257192102839388 0.271331059571331 0.285343325727507 0.299002882478891 0.312028860903368 0.324074929406082 0.334716713351428 0.343437084454366 0.349608715795786 0.352473640025777 0.351119124292859 0.344449348468249 0.331152092911653 0.309659682083552 0.278102924331552 0.234257484497269 0.175479523735507 0.0986353988387913          0;          0 0.000836526273278942 0.00173999968690399 0.00271567232673387 0.0037691997305942 0.0049066734301059 0.0061346398705267 0.00746011951294192 0.00889064879424474 0.0104343225640579 0.0120998081194001 0.013896391006953 0.0158340046916726 0.0179232753888273 0.0201755498847646 0.0226029259248721 0.0252182890171957 0.028035353094251 0.0310686787160146 0.0343336932842105 0.0378467214084942 0.0416250008468625 0.0456866699495682 0.0500507562725665 0.0547371567522098 0.0597666025806367 0.0651605844572699 0.0709412527806966 0.0771312948303171 0.0837537789801684 0.0908319213696471 0.0983887930381416 0.106446981791908 0.115028160268191 0.124152539107954 0.133838194975537 0.144100270599429 0.154949976694258 0.166393423579234 0.178430172150805 0.191051522867627 0.204238432566816 0.217959054127656 0.23216579766549 0.246791823191007 0.261746880441317 0.276912366221686 0.292135431983562 0.307222080526335 0.32192898154032 0.335953733285585 0.348923431441437 0.360381167225088 0.369770167507082 0.376415022411828 0.379499626811917 0.3780412469579 0.370860055949035 0.356543238362228 0.333402899396955 0.299426514195385 0.252219209005824 0.188934447412119 0.106198292572635          0;          0 0.000899512110839036 0.0018710059628042 0.002920133630648 0.00405298080164108 0.00527609641467155 0.00659651830306607 0.00802179804787852 0.00956004176146324 0.011219948557009 0.0130108373609024 0.014942692775906 0.0170261982027223 0.0192727777181879 0.0216946309737484 0.0243047682110393 0.0271170473436467 0.0301462137179431 0.0334079236066913 0.0369187696134944 0.0406963073361173 0.0447590664709547 0.0491265486198811 0.0538192162638478 0.0588584674476522 0.0642665928097134 0.0700667003187022 0.0762826114201525 0.0829387253135459 0.0900598410729491 0.0976709167850291 0.105796763659613 0.114461672876647 0.123688949520888 0.133500325268162 0.143915240269335 0.15494997655993 0.166616590288422 0.178921647574067 0.191864675948776 0.205436315170317 0.219616097918457 0.234369790115801 0.249646207720629 0.265373467410824 0.281454528699774 0.297761859455778 0.314131108002747 0.330353670472389 0.346167897718058 0.361248612654044 0.375194827326996 0.387515251550427 0.397611178033715 0.404756346995902 0.408073199360804 0.406505012599963 0.398783123090018 0.383388350290306 0.358505708905607 0.321971160748855 0.271209490813232 0.20315984137685 0.114194240527559          0;          0 0.000965950171303833 0.00200919043113193 0.00313579580115826 0.00435230663998172 0.00566575295896515 0.00708368940259241 0.00861422800759991 0.010266075894153 0.0120485707244659 0.0139717214061909 0.0160462491543925 0.0182836280817044 0.0206961239945434 0.0232968364052542 0.0260997375044532 0.0291197106361654 0.0323725883106058 0.0358751822650608 0.0396453141419048 0.0437018369350215 0.0480646435257044 0.0527546748421154 0.0577939060201598 0.0632053177248874 0.0690128455736549 0.0752413036501704 0.0819162750774132 0.0890639639467113 0.0967109962936124 0.104884169058448 0.113610128494509 0.122914961929103 0.132823695603766 0.143359664668458 0.154543746503322 0.166393423388184 0.17892164749813 0.192135468180863 0.206034377815478 0.220608318123887 0.235835312497543 0.251678603554493 0.268083223145337 0.284971977005694 0.302240660034987 0.319752320737065 0.337330476757482 0.354751121751351 0.371733275822571 0.387927739455519 0.402903914109572 0.416134241638668 0.426975782694594 0.434648632151658 0.438210431599869 0.436526432136833 0.428234266465094 0.411702554894177 0.384982264485828 0.345749539094439 0.291238986055006 0.218163715297343 0.122627788811212          0;          0 0.00103583097513374 0.00215453556927677 0.00336263470905227 0.00466714794627056 0.00607561002997675 0.00759611783890021 0.00923737320117379 0.0110087155771237 0.0129201540031932 0.0149824242599426 0.0172070217309591 0.0196062520169922 0.0221932665220507 0.02498211161518 0.0279877708887103 0.0312262061420035 0.0347143933648298 0.038470360076463 0.0425132207949404 0.0468631923182741 0.0515416019591574 0.0565709060467051 0.0619746701017345 0.0677775389213554 0.0740051780659099 0.0806841960113242 0.0878420281885202 0.0955067765524388 0.10370699036156 0.112471402316271 0.121828588586356 0.131806525420154 0.142432048776065 0.153730179568268 0.165723306148934 0.178430171979468 0.191864675854328 0.206034377778059 0.220938733188666 0.236566948437238 0.252895452518833 0.269884828421959 0.287476133938906 0.305586596253586 0.324104472880965 0.342882904152735 0.361732649485282 0.380413504248196 0.398624144467192 0.415990099696347 0.432049633853159 0.446237034276105 0.45786284109425 0.466090717829082 0.469910161351772 0.468104358791067 0.459212363681847 0.441484754609509 0.412831532682061 0.370760758003676 0.312306969243048 0.233945478334066 0.131498553845281          0;          0 0.0011091061081412 0.00230693924793599 0.00360048920898445 0.00499727925819153 0.00650537254749221 0.00813343361294955 0.00989078340980691 0.0117874250709011 0.0138340700771538 0.0160422162187217 0.0184241706039353 0.0209931110978445 0.0237631185700623 0.0267492332421357 0.0299674995608418 0.033435010805778 0.0371699391020304 0.0411915844083714 0.0455204179553942 0.0501780867532482 0.0551874237925274 0.0605724768779654 0.0663584796452493 0.0725718225353565 0.0792399812692084 0.0863914422456756 0.0940555838341219 0.102262498824866 0.11104275596077 0.120427120608675 0.130446193727877 0.141129933261426 0.152507067588949 0.164604379823222 0.177445843031193 0.19105152279312 0.205436315115591 0.220608318088397 0.236566948420172 0.253300639756217 0.270784149382946 0.288975272130175 0.307810901781262 0.327202419358957 0.347030173843061 0.367136910205159 0.387320002081654 0.407322250747697 0.426821020163288 0.445415365793027 0.462610887057923 0.477801830225112 0.490249991389415 0.499059881665029 0.503149507819252 0.501215955417051 0.491694971143848 0.472713397098365 0.4420333889618 0.396986696134074 0.334398143854383 0.250493726657997 0.140800196073586          0;          0 0.00118565881890186 0.00246616673778276 0.00384899973615727 0.00534220362678447 0.00695439432024359 0.00869483006754476 0.0105734768117495 0.0126010291468853 0.014788936309253 0.017149494163444 0.0196958572328438 0.0224421129946048 0.0254033142493613 0.028595539869808 0.0320359409623116 0.0357427907264796 0.0397355145758253 0.0440347449340993 0.0486623669691176 0.0536415198775175 0.0589966130077392 0.0647533574018512 0.0709387269176026 0.0775809326216149 0.0847093466489134 0.0923544220844632 0.100547563798949 0.109320940753497 0.118707233706853 0.128739333713025 0.139449953426522 0.150871117799278 0.163033537213621 0.175965841774421 0.189693657926022 0.204238432599531 0.219616097917563 0.235835312478336 0.252895452495843 0.270784149370379 0.289474415572489 0.308921134282274 0.329056849169281 0.349786833993396 0.370983167740312 0.392477731055074 0.414053912851129 0.435436765064502 0.45628137936094 0.476159151992233 0.494541558290979 0.510781020597321 0.524088389318752 0.533506367244454 0.537878275021396 0.535811263830115 0.52563310958387 0.505341363693964 0.472543733928355 0.424387816069542 0.357479242603 0.267783485447561 0.150518583600442          0;          0 0.0012652992806895 0.00263182987679843 0.00410756565360328 0.0057010881093531 0.00742159095957247 0.00927895286235728 0.0112838071342882 0.0134475640755941 0.0157824471489232 0.0183015842057063 0.0210190110087858 0.0239497585668367 0.0271098926743374 0.0305165734566197 0.0341881008371942 0.0381439717903276 0.0424049218855345 0.0469929746221001 0.0519314797175063 0.0572451260955692 0.0629599695759658 0.069103451886865 0.0757043535925056 0.0827927748368996 0.090400068399764 0.0985587399888696 0.107302297471483 0.116665063678629 0.126681920186492 0.13738797287128 0.148818125021084 0.161006546451409 0.173986019960763 0.187787109753654 0.202437159234308 0.217959054211396 0.234369790138595 0.251678603540514 0.269884828394241 0.28897527211159 0.308921134278339 0.329674268805273 0.351162686988998 0.373285300732574 0.395905590742121 0.418844146072912 0.441869800580314 0.464689142180769 0.486934082155534 0.508147234835416 0.52776455923536 0.545094974613105 0.55929631592255 0.569346996875299 0.574012605350093 0.571806730096677 0.560944801530064 0.539289892172778 0.504288936379726 0.452897917443703 0.381494437242095 0.285773030075263 0.160630355044508          0;          0 0.00134776000845003 0.00280336509708157 0.00437529871278043 0.00607269117892154 0.00790533906227594 0.00988376812016383 0.0120193014283864 0.0143240892383841 0.0168111576333757 0.0194944922872922 0.0223890440268339 0.0255108213116191 0.0288769377635417 0.0325056711328095 0.0364165123176308 0.0406302259215813 0.0451689050467416 0.050056013387479 0.0553164158233841 0.0609764085461431 0.0670637519013374 0.0736076736932794 0.0806388276771248 0.0881892715260224 0.0962924093515285 0.104982871877488 0.114296346463012 0.124269387508115 0.134939152436864 0.1463430373116 0.158518214992364 0.171501078012917 0.185326552717382 0.200027205233393 0.215632159507555 0.232165797752813 0.249646207746022 0.268083223133227 0.287476133912343 0.307810901763236 0.329056849165692 0.351162686989265 0.374051737505976 0.397616321775594 0.421711018302885 0.446144721653802 0.470671202042076 0.49497793043568 0.518672814890573 0.541268650357837 0.562164640547901 0.580624675723071 0.595751675451002 0.606457453446753 0.611427155082933 0.609077515542092 0.597507607312298 0.574441198123288 0.537158836655775 0.482418148079221 0.406360553354011 0.304399921705458 0.171100313525638          0;          0 0.00143266382409071 0.00297997844114806 0.00465094857551469 0.00645526651532718 0.0084033567249042 0.0105064187529289 0.0127764878201239 0.0152264783741522 0.0178702348623393 0.0207226139660898 0.0237995154003639 0.027117958995143 0.0306961348040574 0.0345534683451789 0.0387106836489676 0.0431898568029574 0.048014469045774 0.053209456613828 0.058801250161262 0.0648178106883228 0.0712886490624419 0.0782448224953954 0.0857189244176832 0.0937450384833367 0.10235866535135 0.111596607683363 0.121496808825589 0.132098132446127 0.143440073076268 0.155562378557304 0.168504570259602 0.182305341289857 0.197001803839396 0.212628564954625 0.22921659270701 0.24679182324049 0.26537346742429 0.284971976998021 0.305586596238155 0.327202419349141 0.349786833992507 0.373285300733601 0.397616321775722 0.422665423956368 0.448278037999773 0.474251019425626 0.500322627974041 0.526160626487205 0.551348247309516 0.575367578908145 0.597579983944523 0.617202951014871 0.633282924531382 0.644663147457045 0.649945949830398 0.647448259040381 0.635149473041761 0.610629924689846 0.570998877968667 0.512809567529393 0.431960490490514 0.323576530929747 0.181879380267792          0;          0 0.00151947918948416 0.00316056689886351 0.00493280082578485 0.00684644836278236 0.00891257690878921 0.0111430764867558 0.0135507081396367 0.0161491660479362 0.0189531352791847 0.0219783632197947 0.0252417184901722 0.0287612524028665 0.0325562576463486 0.0366473352483248 0.0410564674995238 0.0458070687965504 0.0509240436165279 0.0564338375828466 0.0623644799733636 0.0687456308239002 0.0756085920571965 0.0829862937117249 0.0909133088388029 0.0994257889861376 0.108561384175156 0.118359123526413 0.128859253046278 0.140102993547821 0.152132231904078 0.164989123303302 0.178715586252092 0.193352661972304 0.208939703048149 0.225513408684537 0.243106627626944 0.26174688044367 0.281454528699657 0.302240660034356 0.324104472880348 0.347030173843011 0.37098316774119 0.395905590743041 0.421711018303088 0.448278037999678 0.475442717993146 0.502989602246885 0.530641093817579 0.558044817570998 0.584758757260131 0.610233600259138 0.633792024968875 0.6546041065106 0.671658499131932 0.683728320385939 0.689331243055304 0.686682207104337 0.673638157515 0.647632741567116 0.605600133575778 0.543884714565789 0.4581364045968 0.343184533877241 0.192900815324344          0;          0 0.00160751319027915 0.00334368841907525 0.00521860805318675 0.00724312772918126 0.00942896280843912 0.0117887004618482 0.0143358325235139 0.0170848397350108 0.0200512699183323 0.0232517807405939 0.0267042159376185 0.0304276646095126 0.0344425458814744 0.0387706616313994 0.0434352605087641 0.0484611050148192 0.0538745515326238 0.0597035854829683 0.0659778498533078 0.0727287146283729 0.079989307857186 0.0877944759120606 0.0961807848716508 0.105186469551179 0.114851372637174 0.125216794717894 0.136325301310717 0.148220488428362 0.160946684495317 0.174548501589982 0.189070273668644 0.204555407298086 0.221045547049338 0.238579532573813 0.257192102806794 0.276912366200966 0.297761859454488 0.31975232074708 0.342882904164797 0.367136910210105 0.392477731052655 0.418844146070447 0.446144721653289 0.474251019425592 0.502989602246935 0.532132543311988 0.561386143406378 0.590377620895512 0.61863934226471 0.645590196278321 0.670513576397918 0.692531493322724 0.710573986399376 0.723343154723517 0.72927070280634 0.726468178151891 0.712668326221823 0.685156231125175 0.640688266586066 0.57539706618177 0.484680469176398 0.363068494310602 0.204077427196111          0;          0 0.00169588481896172 0.00352750275926735 0.00550549255271439 0.00764131121953972 0.00994731489816428 0.0124367823678442 0.0151239412227552 0.01802406559377 0.0211535710231247 0.0245300278658542 0.0281722611831688 0.0321004041677211 0.0363360010101545 0.040902054605938 0.0458230880617758 0.0511252217791396 0.0568362651077677 0.0629857460695769 0.0696049364475038 0.0767269270885237 0.0843866664261379 0.0926209198608703 0.101468259905232 0.110969020015797 0.121165239085609 0.132100494418161 0.143819687892688 0.156368808776237 0.169794622012831 0.184144191872583 0.199464286074917 0.215800693761311 0.233197359649792 0.251695268692504 0.271331059530337 0.292135431960391 0.314131108003186 0.337330476770794 0.361732649500109 0.387320002086849 0.414053912846754 0.441869800576517 0.470671202041702 0.500322627974415 0.530641093817713 0.561386143406225 0.592247930854898 0.622833200692817 0.65264858770137 0.681081038758269 0.707374550201534 0.730602905855687 0.749637271835389 0.763108402136734 0.769361783736393 0.766405228395126 0.751846740021215 0.722822166472055 0.675909563044846 0.607029115134246 0.511325456461909 0.383027915691982 0.215296322032945          0;          0 0.00178347890136264 0.00370967769557334 0.0057898031752761 0.00803592688401294 0.0104610263385995 0.0130790541738518 0.0159049787129348 0.0189548743042483 0.0222460023844682 0.0257968216121836 0.0296271445839628 0.0337581548899941 0.0382124952419137 0.0430143445469795 0.0481895084676029 0.0537654751010518 0.0597714643594705 0.066238506204612 0.0731995163007774 0.0806893172705221 0.088744631377248 0.0974041049312817 0.10670833028551 0.116699754911701 0.127422552819581 0.138922518644176 0.151246907477423 0.16444411989538 0.178563298088061 0.193653899577234 0.209765144158912 0.226945220779032 0.245240317075003 0.264693502766141 0.285343325714742 0.30722208052234 0.330353670472625 0.354751121753751 0.380413504250821 0.407322250748961 0.435436765064406 0.464689142180512 0.494977930435485 0.526160626487169 0.558044817571133 0.590377620895424 0.622833200692683 0.654997961507732 0.686353097163671 0.716253874556677 0.74390526921137 0.768333164119331 0.788350517054423 0.802517333493245 0.809093695367519 0.805984397164287 0.79067408023496 0.760150604133986 0.710815380981774 0.638377640341379 0.537731602198814 0.402808443086746 0.226414926416954          0;          0 0.0018688647549171 0.0038872631006703 0.0060669544556247 0.00842060724455309 0.010961805989555 0.0137051603096878 0.0166663593487211 0.0198622549325669 0.0233109347826244 0.0270317317242902 0.0310454136236161 0.0353741830330219 0.0400417581845592 0.0450734690953353 0.0504963647680717 0.0563392595255567 0.0626327605624754 0.0694093740656097 0.0767036088984412 0.0845519653541651 0.0929929013687461 0.102066904176645 0.111816522668627 0.122286252487826 0.133522364254837 0.145572829225051 0.158487182182151 0.17231615994059 0.187111238553899 0.202924224978756 0.219806714616968 0.237809221131116 0.256980127902075 0.277364546418505 0.299002882494713 0.321928981553407 0.346167897717901 0.371733275814989 0.398624144458799 0.426821020161155 0.456281379364847 0.486934082158364 0.518672814890293 0.55134824730891 0.584758757260195 0.618639342264829 0.652648587701322 0.686353097163617 0.719209226502411 0.750541350449205 0.779516430069438 0.805113714152225 0.826089329134748 0.840934277280171 0.847825440138634 0.844567317575111 0.8285241245367 0.796539392626123 0.744842452502818 0.668937148913134 0.563473225059906 0.42209104609613 0.237253417909387          0;          0 0.00195027886666381 0.00405660813541188 0.00633125728423223 0.00878744319534388 0.0114393480485544 0.0143022224573336 0.0173924316003679 0.0207275524728239 0.0243264694514418 0.0282093734035489 0.0323979167229606 0.0369152517487317 0.041786152776624 0.0470370761355017 0.0526962276391223 0.0587936550996682 0.0653613226568672 0.0724331757721653 0.0800452000579725 0.0882354543549082 0.0970441025114041 0.106513430833126 0.116687804737195 0.127613620976633 0.139339207782523 0.151914667913437 0.165391651952034 0.179823064755262 0.195262667886042 0.211764568179816 0.229382565389145 0.24816933048785 0.268175387774971 0.289447847345343 0.312028860910674 0.335953733288302 0.361248612653287 0.387927739452429 0.415990099693165 0.445415365792421 0.476159151993777 0.508147234836361 0.541268650357717 0.575367578907911 0.61023360025907 0.645590196278451 0.681081038758409 0.716253874556722 0.750541350449189 0.783238476402608 0.813475835421543 0.840188249311813 0.862077615623021 0.87756934076898 0.88476070275541 0.881360633658936 0.864618442462653 0.831240432702977 0.777291301759861 0.698079159241776 0.588020561008588 0.440479411734365 0.247589385720949          0;          0 0.00202556625081682 0.00421321575426966 0.00657568548187129 0.00912669234950238 0.0118809731834478 0.014854369938106 0.0180638790413919 0.0215277503494692 0.0252655953006494 0.0292984067149253 0.0336486561108774 0.0383403817773201 0.0433993262003354 0.048852978805767 0.054730615689134 0.061063425415886 0.0678846304995444 0.0752295104921031 0.0831354113046484 0.0916418312020079 0.100790521407738 0.110625436668535 0.121192618916356 0.132540218952625 0.144718466639347 0.157779434141895 0.17177672394914 0.186765240764615 0.202800870667029 0.219939858174964 0.238238036136689 0.257750065431867 0.278528450720458 0.300622151808352 0.32407492940046 0.348923431432592 0.375194827326408 0.40290391411281 0.432049633856827 0.462610887058892 0.494541558289035 0.527764559233958 0.562164640548356 0.597579983945054 0.633792024968735 0.670513576397845 0.707374550201608 0.743905269211395 0.779516430069424 0.813475835421573 0.844880500568075 0.872624201508869 0.895358620099698 0.911448385013744 0.918917317080688 0.91538605695375 0.897997525094154 0.863330893859244 0.807298936441931 0.725028937902542 0.610721499795374 0.457484360813485 0.257147487962984          0;          0 0.00209208738118921 0.00435157392137339 0.00679162151949186 0.00942639870130242 0.0122711202646814 0.0153421361878172 0.0186570293621652 0.0222346701966282 0.0260952644971767 0.0302604878470613 0.0347535708253502 0.0395993791724635 0.044824467274729 0.0504571960235059 0.0565278252668011 0.0630685915872055 0.070113791176754 0.0776998463698426 0.0858653469259815 0.0946511114109911 0.104100237542849 0.114258095535748 0.125172263824959 0.136892500198825 0.149470659170356 0.162960499214997 0.177417410835061 0.192898130384763 0.209460347078834 0.227162120537208 0.246061145448819 0.266213905193771 0.287674611272403 0.310493811343239 0.334716713350585 0.360381167222974 0.387515251550597 0.416134241639653 0.446237034277036 0.477801830225098 0.510781020596445 0.545094974612748 0.580624675723672 0.617202951015383 0.65460410651058 0.692531493322574 0.730602905855527 0.768333164119222 0.805113714152224 0.8401882493119 0.872624201508945 0.901278856073073 0.924759830132926 0.941377930502786 0.949092216735915 0.945444863958295 0.927485381367014 0.891680366843199 0.833808639396074 0.748836831038511 0.630775903012504 0.472506803483901 0.26559181480464          0;          0 0.00214658465880398 0.00446493509674468 0.00696855684990246 0.00967198290594035 0.0125908217067643 0.0157418402845381 0.019143097545516 0.0228139664800298 0.0267751435747033 0.0310488711383116 0.0356589958583139 0.0406310564382541 0.0459922796260776 0.0517717467930612 0.0580005264172663 0.0647117155233734 0.0719404793518992 0.0797241650592906 0.0881023888977269 0.0971170594346187 0.106812374342451 0.117234857318272 0.128433356913788 0.140458957803921 0.153364832342639 0.167206106523958 0.182039648312103 0.197923706686026 0.214917437172352 0.233080375340645 0.25247175406766 0.273149563215807 0.295169401962893 0.318583109765368 0.343437084457782 0.369770167512371 0.39761117803468 0.426975782693179 0.457862841092494 0.490249991389056 0.524088389319801 0.559296315923115 0.595751675450633 0.633282924531093 0.671658499132052 0.710573986399531 0.749637271835434 0.788350517054435 0.826089329134758 0.862077615623011 0.895358620099672 0.924759830132908 0.948852602417653 0.965903559184401 0.973818812358606 0.970076459216396 0.951649172578306 0.914911150213913 0.855531694780647 0.768346237772198 0.647209703524581 0.484816830902971 0.272511040689032          0;          0 0.00218514431994492 0.00454516408862958 0.00709378846480254 0.00984578902587291 0.0128170758775384 0.0160247344834472 0.0194871236528588 0.02322393532317 0.0272562714913053 0.0316068178152535 0.0362998112509481 0.041361212986246 0.0468187650649407 0.0527020947199039 0.0590428153436586 0.0658746019889997 0.0732332625774946 0.0811568226724393 0.0896856067574238 0.098862271925861 0.10873181517805 0.119341594270583 0.130741335109364 0.142983036116693 0.156120830241264 0.170210835903308 0.185310941318679 0.201480438235078 0.218779548356515 0.237268879614488 0.257008727022937 0.278058122295709 0.300473659750305 0.324308112657599 0.349608715797886 0.376415022414825 0.40475634699619 0.434648632150659 0.466090717828017 0.499059881664717 0.533506367245013 0.569346996875707 0.606457453446608 0.644663147456891 0.683728320386011 0.72334315472358 0.763108402136756 0.802517333493267 0.840934277280182 0.877569340768965 0.911448385013734 0.941377930502803 0.96590355918439 0.983261055440624 0.99131851496676 0.987508906647693 0.968750304043921 0.931352361439052 0.870905770799162 0.782153496654623 0.658839752790474 0.493529289306161 0.27740828893929          0;          0 0.00220305607917046 0.0045824225588149 0.00715193220587734 0.0099264693153537 0.0129220936889562 0.0161560506117868 0.0196468226843165 0.0234142371566435 0.0274796070489066 0.0318658286752636 0.0365973034202054 0.041700164477092 0.0472024168661995 0.0531339638100765 0.0595266562585187 0.0664144212368628 0.0738333775772805 0.0818218774316988 0.0904205602230585 0.0996724150643835 0.109622827314907 0.120319559025271 0.131812726292311 0.144154733745484 0.157400178817178 0.171605658396687 0.186829514569831 0.2031315028257 0.220572361397001 0.239213217475304 0.259114838973799 0.280336721639602 0.302935935676124 0.326965703469149 0.35247364002471 0.379499626810091 0.408073199360308 0.438210431600322 0.469910161352513 0.503149507819286 0.537878275020899 0.574012605349969 0.61142715508319 0.649945949830557 0.689331243055282 0.729270702806253 0.769361783736368 0.80909369536753 0.84782544013864 0.884760702755407 0.918917317080708 0.949092216735959 0.973818812358593 0.991318514966749 0.999441871692494 0.995601208757491 0.976688856520387 0.938984401346076 0.87804225331562 0.788563066697824 0.664238815976483 0.49757362791495 0.279681082974349          0;          0 0.00219461077876232 0.0045648138289281 0.00712442551116393 0.00988831696589345 0.012872449010317 0.0160939714282111 0.0195713144994641 0.0233242571525122 0.027374020837968 0.031743371727459 0.0364566497941171 0.041539909757995 0.047021029436781 0.0529297803110782 0.0592978998891692 0.0661591974717637 0.0735496452961707 0.0815074445497097 0.0900730812718112 0.099289385057917 0.109201560061108 0.119857184264378 0.131306182391202 0.143600763336956 0.156795308934259 0.170946196611897 0.186111546772612 0.202350890448144 0.219724727851064 0.23829394743099 0.258119087575133 0.279259417058415 0.301771787893475 0.325709212058601 0.351119124290044 0.378041246955402 0.406505012599662 0.436526432137863 0.468104358792415 0.501215955417605 0.535811263829821 0.571806730096317 0.609077515541901 0.647448259040275 0.686682207104324 0.726468178151953 0.766405228395251 0.805984397164377 0.844567317575116 0.88136063365889 0.915386056953706 0.945444863958287 0.97007645921639 0.987508906647706 0.995601208757515 0.99177507110165 0.972935456789406 0.935375879728542 0.874668220067333 0.785532401660695 0.661686000466594 0.495661254867649 0.278606791057405          0;          0 0.00215293716295131 0.00447810426231265 0.00698907870058671 0.00970047958131987 0.0126279367181477 0.0157882540285273 0.019199529731057 0.0228811938628775 0.0268540506067209 0.0311403837126776 0.0357641108126253 0.0407508194144609 0.0461278351498515 0.0519243428686274 0.0581714879381043 0.0649024505853173 0.0721525131012291 0.079959147196902 0.0883620718974296 0.0974033061204839 0.107127191430578 0.11758040360141 0.12881191827054 0.140872954899692 0.153816859975728 0.167698940276541 0.182576212190982 0.198507077730889 0.215550886375043 0.233767369001107 0.253215914451891 0.273954664524761 0.296039396228081 0.319522114832866 0.3444493484688 0.370860055949831 0.398783123090181 0.428234266464859 0.459212363681488 0.491694971143786 0.525633109584086 0.560944801530179 0.597507607312227 0.635149473041711 0.673638157515032 0.712668326221857 0.751846740021221 0.790674080234961 0.828524124536706 0.864618442462657 0.897997525094152 0.927485381367012 0.95164917257831 0.968750304043923 0.976688856520388 0.972935456789407 0.954453886137292 0.917607445249557 0.858052962668038 0.770610590262227 0.64911716778559 0.486245460871105 0.273313987351169          0;          0 0.00206979925316742 0.00430522441585882 0.00671928884311275 0.00932600770914767 0.0121404350198424 0.0151787539725128 0.0184583473548467 0.0219978788077864 0.0258173662686162 0.0299382271329756 0.0343834606716159 0.0391776601813907 0.0443470994596097 0.0499198348187581 0.0559258130850638 0.0623969324109613 0.06936711266346 0.0768723733271974 0.0849509074741408 0.0936431125610087 0.102991616000041 0.1130412850701 0.123839212461996 0.135434642745913 0.147878859814761 0.16122502750468 0.175527969082038 0.190843836612413 0.207229682945493 0.224742926712162 0.243440669599227 0.263378817421231 0.284610983953023 0.307187166002277 0.331152092914073 0.356543238364075 0.383388350290526 0.411702554893362 0.44148475460836 0.472713397097816 0.505341363694113 0.539289892173112 0.57444119812358 0.610629924690023 0.64763274156714 0.685156231125099 0.722822166471926 0.760150604133901 0.796539392626123 0.831240432703028 0.863330893859299 0.891680366843221 0.91491115021392 0.931352361439036 0.938984401346052 0.935375879728535 0.917607445249557 0.882183962680148 0.824928413656126 0.74086151507085 0.624057561426202 0.467474648998048 0.262763231061577          0;          0 0.00193543836776811 0.00402580241963601 0.00628321637387793 0.00872073958293373 0.0113524849921616 0.014193619776343 0.0172603739157796 0.0205701731434564 0.0241417588882025 0.0279951769728524 0.032151917343283 0.0366349571425416 0.0414688813709075 0.0466799385826113 0.05229612325029 0.0583472510384703 0.0648650498971947 0.0718832073191008 0.0794374328353048 0.0875654930094537 0.0963072575984107 0.105704687161264 0.115801812359912 0.126644672193765 0.138281232028907 0.150761211784167 0.164135869398579 0.178457702968836 0.193780071797805 0.210156676572343 0.227640904158186 0.246285025328321 0.266139177898878 0.287250123962169 0.309659682083011 0.333402899396547 0.35850570890567 0.384982264486059 0.412831532682241 0.442033388961897 0.472543733928294 0.504288936379633 0.537158836655762 0.57099887796868 0.605600133575771 0.640688266586087 0.675909563044873 0.710815380981785 0.744842452502818 0.777291301759863 0.807298936441925 0.833808639396059 0.855531694780652 0.870905770799168 0.87804225331562 0.874668220067343 0.858052962668039 0.824928413656116 0.771388482465308 0.692778358025613 0.583555253537886 0.43713467231106 0.245708525117807          0;          0 0.0017382155256716 0.00361554436944491 0.00564289652352964 0.00783202362613636 0.010195582885044 0.0127471807258109 0.0155014029380219 0.0184739118280905 0.0216815235552477 0.0251422486530336 0.0288753818348273 0.0329015672032314 0.0372428769336147 0.0419228855358364 0.0469667339040589 0.052401207389212 0.0582547919894255 0.0645577428978297 0.0713421298680301 0.0786418804895485 0.0864927917443611 0.0949325476304334 0.104000692477252 0.1137385838129 0.124189288556559 0.135397457747007 0.147409128694829 0.160271458408945 0.174032360512312 0.188740056835148 0.20444250170358 0.22118664173684 0.23901750577439 0.257977074648405 0.278102924330171 0.299426514194451 0.321971160748825 0.345749539094925 0.370760758004279 0.396986696134419 0.424387816069502 0.452897917443504 0.482418148079045 0.512809567529297 0.54388471456578 0.575397066181834 0.607029115134332 0.638377640341429 0.668937148913137 0.698079159241756 0.725028937902511 0.748836831038485 0.7683462377722 0.782153496654634 0.788563066697837 0.785532401660707 0.770610590262227 0.740861515070841 0.692778358025609 0.622178257109443 0.524086207087715 0.3925865936076 0.220669785244711          0;          0 0.00146419034283475 0.00304552542892511 0.00475322737083833 0.00659722715696246 0.00858816371979088 0.0107374758561411 0.0130574635172725 0.0155613336613496 0.0182632346884344 0.0211783466014763 0.0243229150470564 0.0277143357510621 0.0313711982976608 0.035313363948171 0.0395620040457926 0.0441396815853022 0.0490703926669382 0.0543796303983457 0.0600943988352573 0.0662432749154679 0.0728564151287832 0.0799655716821329 0.0876040438329328 0.0958066650091985 0.104609716918479 0.114050821664584 0.124168747565122 0.135003210378743 0.146594577273738 0.158983476187844 0.172210293393758 0.186314562455728 0.201334226357614 0.217304648791288 0.234257484497747 0.252219209006143 0.271209490813207 0.291238986054858 0.312306969242925 0.334398143854329 0.357479242603031 0.381494437242153 0.406360553354052 0.431960490490535 0.458136404596806 0.484680469176386 0.511325456461892 0.537731602198806 0.563473225059909 0.588020561008595 0.610721499795383 0.63077590301251 0.647209703524579 0.658839752790472 0.66423881597648 0.66168600046659 0.649117167785591 0.624057561426204 0.583555253537888 0.524086207087714 0.441460209977485 0.330691034305826 0.185878458702815          0;          0 0.00109680811304358 0.002281366399397 0.00356058687412933 0.00494190589707032 0.00643329442748158 0.00804331530150056 0.00978119072017523 0.0116568139686793 0.0136807769392492 0.0158644498074835 0.0182200073921878 0.0207604832566308 0.0234998001078194 0.0264528250550496 0.0296354291704688 0.0330645168332756 0.0367580598068137 0.0407351412668018 0.0450160039670349 0.0496220589194331 0.054575891032823 0.0599012693308689 0.0656231548230973 0.0717676474805352 0.0783619175415656 0.0854341303797854 0.0930133438919009 0.101129319380168 0.109812283240271 0.119092655456853 0.129000700940071 0.139566051508934 0.150817110176031 0.162780364901602 0.175479523736122 0.188934447412521 0.203159841376879 0.218163715297165 0.233945478333849 0.25049372665786 0.267783485447577 0.285773030075352 0.304399921705533 0.323576530929786 0.343184533877251 0.363068494310579 0.38302791569195 0.402808443086729 0.422091046096131 0.440479411734372 0.457484360813498 0.472506803483914 0.484816830902969 0.493529289306156 0.497573627914947 0.495661254867642 0.486245460871105 0.467474648998054 0.437134672311061 0.392586593607599 0.330691034305827 0.247717565978781 0.139240281508587          0;          0 0.000616497246611343 0.00128233288465257 0.00200138032221249 0.00277780102020031 0.00361609064506548 0.00452107011869194 0.00549791923878842 0.00655218655155436 0.00768983406237338 0.00891725819236224 0.0102412992014929 0.0116692727344319 0.0132090155368785 0.0148688848644381 0.016657801205672 0.0185852544723343 0.0206613589470409 0.0228968413223141 0.025303079111515 0.0278920937921094 0.0306765945223754 0.0336699426697206 0.0368861665733905 0.0403399221439312 0.0440464965118201 0.0480217251439951 0.0522819358955519 0.0568438442134567 0.0617244520238745 0.0669408679187818 0.0725100915722515 0.0784487738033543 0.0847728803247113 0.0914973215605947 0.0986353988385336 0.106198292572469 0.114194240527608 0.122627788811322 0.131498553845371 0.140800196073607 0.150518583600431 0.160630355044492 0.17110031352561 0.181879380267773 0.19290081532435 0.20407742719612 0.215296322032958 0.226414926416964 0.237253417909387 0.247589385720941 0.257147487962979 0.265591814804643 0.27251104068903 0.277408288939291 0.279681082974352 0.278606791057403 0.273313987351169 0.26276323106158 0.245708525117806 0.220669785244709 0.185878458702816 0.139240281508588 0.0782642064990426          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;
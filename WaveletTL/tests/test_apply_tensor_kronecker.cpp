@@ -0,0 +1,89 @@
+#define _WAVELETTL_USE_TBASIS 1
+
+#include <iostream>
+#include <time.h>
+
+#include <interval/p_basis.h>
+#include <utils/fixed_array1d.h>
+#include <cube/tbasis.h>
+#include <cube/tbasis_index.h>
+#include <numerics/bvp.h>
+#include <galerkin/tbasis_equation.h>
+#include <galerkin/cached_tproblem.h>
+#include <adaptive/apply_tensor.h>
+
+using namespace std;
+using namespace WaveletTL;
+
+using MathTL::FixedArray1D;
+
+/*
+  Compare APPLY_TENSOR_KRONECKER with APPLY_TENSOR for the Poisson equation on
+  the square and on the cube: both routines have to yield the same vector
+  (up to roundoff and the entries below 1e-16 which are dropped by the cache
+  of CachedTProblem).
+*/
+
+template <unsigned int DIM>
+void test_kronecker(const int jmax, const double eta, const int stride)
+{
+  typedef PBasis<3,3> Basis1D;
+  typedef TensorBasis<Basis1D,DIM> Basis;
+  typedef typename Basis::Index Index;
+  typedef TensorEquation<Basis1D,DIM,Basis> Problem;
+
+  cout << "* DIM=" << DIM << ", jmax=" << jmax << ", eta=" << eta << endl;
+
+  FixedArray1D<bool,2*DIM> bc;
+  for (unsigned int i = 0; i < 2*DIM; i++)
+    bc[i] = true;
+  ConstantFunction<DIM> rhs(Vector<double>(1, "1"));
+  PoissonBVP<DIM> poisson(&rhs);
+  Problem eq(&poisson, bc);
+  eq.set_jmax(jmax);
+  CachedTProblem<Problem> cproblem(&eq, 4.0, 10.0);
+
+  // a test vector with entries on all levels (every stride-th index)
+  InfiniteVector<double,Index> v, w, w_kronecker;
+  for (int n = 0; n < eq.basis().degrees_of_freedom(); n += stride)
+    v.set_coefficient(*eq.basis().get_wavelet(n), 1.0/(1+n%17) * (n%2 == 0 ? 1 : -1)
+		      * pow(2.0, -0.5*multi_degree(eq.basis().get_wavelet(n)->j())));
+  cout << "  " << v.size() << " entries in v" << endl;
+
+  clock_t tstart = clock();
+  APPLY_TENSOR_KRONECKER(cproblem, v, eta, w_kronecker, jmax);
+  clock_t tend = clock();
+  cout << "  APPLY_TENSOR_KRONECKER: " << w_kronecker.size() << " entries, "
+       << (double)(tend-tstart)/CLOCKS_PER_SEC << " s" << endl;
+
+  tstart = clock();
+  APPLY_TENSOR(cproblem, v, eta, w, jmax);
+  tend = clock();
+  cout << "  APPLY_TENSOR:           " << w.size() << " entries, "
+       << (double)(tend-tstart)/CLOCKS_PER_SEC << " s" << endl;
+
+  // the caches of CachedTProblem are filled now
+  tstart = clock();
+  APPLY_TENSOR(cproblem, v, eta, w, jmax);
+  tend = clock();
+  cout << "  APPLY_TENSOR (cached):  " << (double)(tend-tstart)/CLOCKS_PER_SEC << " s" << endl;
+  tstart = clock();
+  APPLY_TENSOR_KRONECKER(cproblem, v, eta, w_kronecker, jmax);
+  tend = clock();
+  cout << "  APPLY_TENSOR_KRONECKER (cached 1D integrals): " << (double)(tend-tstart)/CLOCKS_PER_SEC << " s" << endl;
+
+  const double error = linfty_norm(w-w_kronecker);
+  cout << "  ||APPLY_TENSOR-APPLY_TENSOR_KRONECKER||_infty = " << error
+       << (error < 1e-12 ? " (OK)" : " (failed)") << endl;
+}
+
+int main()
+{
+  cout << "Testing APPLY_TENSOR_KRONECKER..." << endl;
+
+  test_kronecker<2>(8, 1e-2, 3);
+  test_kronecker<2>(8, 1e-5, 3);
+  test_kronecker<3>(10, 1e-2, 4099);
+
+  return 0;
+}
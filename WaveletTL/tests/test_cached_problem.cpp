@@ -0,0 +1,116 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+
+#include <algebra/infinite_vector.h>
+#include <numerics/sturm_bvp.h>
+#include <interval/p_basis.h>
+#include <galerkin/sturm_equation.h>
+#include <galerkin/cached_problem.h>
+#include <galerkin/TestProblem.h>
+#include <adaptive/apply.h>
+
+using namespace std;
+using namespace MathTL;
+using namespace WaveletTL;
+
+/*
+  Test of the entries cache of CachedProblem under a small memory limit:
+  APPLY has to give the same result as with an unlimited cache, although
+  cached level blocks are evicted while APPLY works on them
+  (build with -fsanitize=address to detect reads from evicted blocks).
+  The partial level blocks cached by St04a may not be used for CDD1, neither
+  in memory nor after a cache file round trip.
+  Afterwards, the cache is saved into a cache file, which may only be loaded
+  again for the same operator and if it is intact.
+*/
+
+typedef PBasis<3,3> Basis;
+typedef Basis::Index Index;
+typedef CachedProblem<SturmEquation<Basis> > Problem;
+
+int main()
+{
+  cout << "Testing CachedProblem with a small cache memory limit..." << endl;
+
+  TestProblem<2> T;
+  Basis basis(1, 1);
+  const int jmax = 10;
+  basis.set_jmax(jmax);
+  SturmEquation<Basis> eq(T, basis);
+
+  InfiniteVector<double,Index> v;
+  for (Index lambda(basis.first_generator(basis.j0()));; ++lambda) {
+    v.set_coefficient(lambda, 1.0/(1+lambda.number()));
+    if (lambda == basis.last_wavelet(6)) break;
+  }
+
+  bool ok = true;
+  const CompressionStrategy strategies[2] = { CDD1, St04a };
+  for (int s = 0; s < 2; s++) {
+    Problem P(&eq), P_small(&eq);
+    P_small.set_max_cache_memory(4096);
+    for (int pass = 0; pass < 2; pass++) {
+      InfiniteVector<double,Index> w, w_small;
+      APPLY(P, v, 1e-6, w, jmax, strategies[s]);
+      APPLY(P_small, v, 1e-6, w_small, jmax, strategies[s]);
+      const double diff = linfty_norm(w-w_small);
+      cout << "- " << (s == 0 ? "CDD1" : "St04a") << ", pass " << pass
+	   << ": difference to the unlimited cache " << diff
+	   << " (" << w.size() << " coefficients)" << endl;
+      if (diff != 0) ok = false;
+    }
+  }
+
+  cout << "Testing St04a followed by CDD1..." << endl;
+  {
+    const char* filename = "test_cached_problem_st04a.cache";
+    InfiniteVector<double,Index> w, w_mixed, w_file;
+    Problem P(&eq), P_mixed(&eq), P_file(&eq);
+    APPLY(P, v, 1e-6, w, jmax, CDD1);
+    APPLY(P_mixed, v, 1e-1, w_mixed, jmax, St04a);
+    P_mixed.save_cache(filename);
+    P_file.load_cache(filename);
+    APPLY(P_mixed, v, 1e-6, w_mixed, jmax, CDD1);
+    APPLY(P_file, v, 1e-6, w_file, jmax, CDD1);
+    const double diff = linfty_norm(w-w_mixed), diff_file = linfty_norm(w-w_file);
+    cout << "- difference to CDD1 with an empty cache: " << diff
+	 << ", after a cache file round trip: " << diff_file << endl;
+    if (diff != 0 || diff_file != 0) ok = false;
+    remove(filename);
+  }
+
+  cout << "Testing cache files..." << endl;
+  const char* filename = "test_cached_problem.cache";
+  const char* truncated = "test_cached_problem_truncated.cache";
+  {
+    Problem P(&eq);
+    InfiniteVector<double,Index> w;
+    APPLY(P, v, 1e-6, w, jmax, CDD1);
+    P.save_cache(filename);
+  }
+  {
+    std::ifstream in(filename, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::ofstream out(truncated, std::ios::binary);
+    out.write(&bytes[0], bytes.size()/2);
+  }
+  TestProblem<5> T5; // mass matrix instead of -u''
+  SturmEquation<Basis> eq5(T5, basis);
+  Problem P_same(&eq), P_other(&eq5), P_truncated(&eq);
+  const bool same = P_same.load_cache(filename);
+  const bool other = P_other.load_cache(filename);
+  const bool corrupt = P_truncated.load_cache(truncated);
+  cout << "- same operator: " << (same ? "loaded" : "rejected") << endl
+       << "- other operator: " << (other ? "loaded" : "rejected") << endl
+       << "- truncated file: " << (corrupt ? "loaded" : "rejected") << endl;
+  if (!same || other || corrupt) ok = false;
+  remove(filename);
+  remove(truncated);
+
+  if (!ok) {
+    cout << "ERROR: test failed" << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,218 @@
+#include <iostream>
+#include <ctime>
+
+#include <algebra/vector.h>
+#include <utils/fixed_array1d.h>
+#include <utils/function.h>
+#include <numerics/bvp.h>
+
+#include <interval/p_basis.h>
+#include <cube/cube_basis.h>
+#include <galerkin/cube_equation.h>
+
+using namespace std;
+using namespace MathTL;
+using namespace WaveletTL;
+
+/*
+  Tests for the bilinear form of CubeEquation:
+  the sum-of-products evaluation with cached 1D integrals (constant and separable coefficients)
+  against the quadrature on the full tensor product Gauss grid.
+*/
+
+// a_i(t) = 1+t^2
+class AFactor : public Function<1>
+{
+public:
+  inline double value(const Point<1>& p, const unsigned int component = 0) const {
+    return 1+p[0]*p[0];
+  }
+  void vector_value(const Point<1>& p, Vector<double>& values) const {
+    values[0] = value(p);
+  }
+};
+
+// q_i(t) = exp(t)
+class QFactor : public Function<1>
+{
+public:
+  inline double value(const Point<1>& p, const unsigned int component = 0) const {
+    return exp(p[0]);
+  }
+  void vector_value(const Point<1>& p, Vector<double>& values) const {
+    values[0] = value(p);
+  }
+};
+
+// right-hand side f(x)=1
+template <unsigned int DIM>
+class RHS : public Function<DIM>
+{
+public:
+  inline double value(const Point<DIM>& p, const unsigned int component = 0) const {
+    return 1;
+  }
+  void vector_value(const Point<DIM>& p, Vector<double>& values) const {
+    values[0] = value(p);
+  }
+};
+
+// the same coefficients as a given problem, but neither constant nor separable
+template <unsigned int DIM>
+class PeakRHS : public Function<DIM>
+{
+public:
+  inline double value(const Point<DIM>& p, const unsigned int component = 0) const {
+    double r = 0;
+    for (unsigned int i = 0; i < DIM; i++)
+      r += (p[i]-0.3)*(p[i]-0.3);
+    return exp(-100*r);
+  }
+  
+  void vector_value(const Point<DIM>& p, Vector<double>& values) const {
+    values[0] = value(p);
+  }
+};
+
+template <unsigned int DIM>
+class GeneralBVP : public EllipticBVP<DIM>
+{
+public:
+  GeneralBVP(const EllipticBVP<DIM>* bvp, const Function<DIM>* f)
+    : EllipticBVP<DIM>(f, f, f), bvp_(bvp) {}
+  const double a(const Point<DIM>& x) const { return bvp_->a(x); }
+  const double q(const Point<DIM>& x) const { return bvp_->q(x); }
+protected:
+  const EllipticBVP<DIM>* bvp_;
+};
+
+template <class Equation>
+void compare(const Equation& eq, const Equation& eq_ref, const int step)
+{
+  typedef typename Equation::Index Index;
+  const typename Equation::WaveletBasis& basis(eq.basis());
+  const int jmax = basis.get_jmax_();
+
+  double err = 0, time = 0, time_ref = 0;
+  int entries = 0;
+  int n = 0;
+  for (Index lambda(basis.first_generator(basis.j0()));; ++lambda, ++n) {
+    if (n % step == 0) {
+      for (Index mu(basis.first_generator(basis.j0()));; ++mu) {
+	clock_t tstart = clock();
+	const double entry = eq.a(lambda, mu);
+	time += (double)(clock()-tstart)/CLOCKS_PER_SEC;
+	tstart = clock();
+	const double entry_ref = eq_ref.a(lambda, mu);
+	time_ref += (double)(clock()-tstart)/CLOCKS_PER_SEC;
+	err = max(err, fabs(entry-entry_ref));
+	if (entry_ref != 0) entries++;
+	if (mu == basis.last_wavelet(jmax)) break;
+      }
+    }
+    if (lambda == basis.last_wavelet(jmax)) break;
+  }
+  cout << "  " << entries << " nontrivial entries, max. error " << err
+       << " (time " << time << "s vs. " << time_ref << "s)" << endl;
+
+  // second sweep, all 1D integrals are cached now
+  n = 0;
+  time = 0;
+  for (Index lambda(basis.first_generator(basis.j0()));; ++lambda, ++n) {
+    if (n % step == 0) {
+      for (Index mu(basis.first_generator(basis.j0()));; ++mu) {
+	clock_t tstart = clock();
+	eq.a(lambda, mu);
+	time += (double)(clock()-tstart)/CLOCKS_PER_SEC;
+	if (mu == basis.last_wavelet(jmax)) break;
+      }
+    }
+    if (lambda == basis.last_wavelet(jmax)) break;
+  }
+  cout << "  with cached 1D integrals: " << time << "s" << endl;
+}
+
+template <unsigned int DIM>
+void test_cube_equation(const int step)
+{
+  typedef PBasis<3,3> Basis1D;
+  typedef CubeEquation<Basis1D,DIM,CubeBasis<Basis1D,DIM> > Equation;
+
+  FixedArray1D<bool,2*DIM> bc;
+  for (unsigned int i = 0; i < 2*DIM; i++)
+    bc[i] = true;
+  const int jmax = 3;
+
+  RHS<DIM> f;
+  AFactor a1;
+  QFactor q1;
+  FixedArray1D<const Function<1>*,DIM> a_factors, q_factors;
+  for (unsigned int i = 0; i < DIM; i++) {
+    a_factors[i] = &a1;
+    q_factors[i] = &q1;
+  }
+
+  {
+    cout << "- DIM=" << DIM << ", Poisson equation:" << endl;
+    PoissonBVP<DIM> poisson(&f);
+    GeneralBVP<DIM> poisson_ref(&poisson, &f);
+    Equation eq(&poisson, bc, jmax), eq_ref(&poisson_ref, bc, jmax);
+    compare(eq, eq_ref, step);
+  }
+
+  {
+    cout << "- DIM=" << DIM << ", separable coefficients:" << endl;
+    SeparableBVP<DIM> separable(a_factors, q_factors, &f);
+    GeneralBVP<DIM> separable_ref(&separable, &f);
+    Equation eq(&separable, bc, jmax), eq_ref(&separable_ref, bc, jmax);
+    compare(eq, eq_ref, step);
+  }
+}
+
+/*
+  Test of the right-hand side computed on demand against the precomputed one:
+  the error of RHS(eta) w.r.t. all coefficients up to jmax should not exceed eta.
+*/
+template <unsigned int DIM>
+void test_lazy_rhs(const int jmax)
+{
+  typedef PBasis<3,3> Basis1D;
+  typedef CubeEquation<Basis1D,DIM,CubeBasis<Basis1D,DIM> > Equation;
+  typedef typename Equation::Index Index;
+
+  FixedArray1D<bool,2*DIM> bc;
+  for (unsigned int i = 0; i < 2*DIM; i++)
+    bc[i] = true;
+  PeakRHS<DIM> f;
+  PoissonBVP<DIM> poisson(&f);
+  Equation eq(&poisson, bc, jmax), eq_lazy(&poisson, bc, jmax, false);
+
+  cout << "- DIM=" << DIM << ", jmax=" << jmax << ", ||F||=" << eq.F_norm()
+       << " (" << eq.fcoeffs.size() << " coefficients), estimate without precomputation: "
+       << eq_lazy.F_norm() << endl;
+  InfiniteVector<double,Index> F;
+  for (unsigned int i = 0; i < eq.fcoeffs.size(); i++)
+    F.set_coefficient(eq.fcoeffs[i].first, eq.fcoeffs[i].second);
+  for (double eta = 1e-3; eta >= 1e-6; eta /= 10) {
+    InfiniteVector<double,Index> coeffs, coeffs_lazy;
+    eq.RHS(eta, coeffs);
+    eq_lazy.RHS(eta, coeffs_lazy);
+    const double err = l2_norm(F-coeffs_lazy);
+    cout << "  eta=" << eta << ": " << coeffs.size() << " vs. " << coeffs_lazy.size()
+	 << " coefficients (" << eq_lazy.fcache.size() << " computed), error " << err
+	 << (err <= eta ? " (OK)" : " (ERROR)") << endl;
+  }
+}
+
+int main()
+{
+  cout << "Testing the bilinear form of CubeEquation..." << endl;
+
+  test_cube_equation<2>(1);
+  test_cube_equation<3>(97);
+
+  cout << "Testing the right-hand side of CubeEquation computed on demand..." << endl;
+  test_lazy_rhs<2>(6);
+
+  return 0;
+}
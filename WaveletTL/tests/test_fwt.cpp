@@ -0,0 +1,139 @@
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+
+#include <algebra/vector.h>
+#include <algebra/infinite_vector.h>
+#include <interval/p_basis.h>
+#include <interval/ds_basis.h>
+
+using namespace std;
+using namespace MathTL;
+using namespace WaveletTL;
+
+/*
+  Tests for the level-wise fast wavelet transform of an interval basis:
+  - apply_Tj/apply_Tjinv against the single index routines reconstruct_1/decompose_1,
+  - the level-wise reconstruct/decompose (primal and dual) against the old index-wise versions.
+*/
+
+// the i-th function of the full collection on the levels j0,...,j
+template <class IBASIS>
+typename IBASIS::Index number_to_index(const IBASIS& basis, const int i)
+{
+  typedef typename IBASIS::Index Index;
+  if (i < basis.Deltasize(basis.j0()))
+    return Index(basis.j0(), 0, basis.DeltaLmin()+i, &basis);
+  int j = basis.j0();
+  int k = i-basis.Deltasize(basis.j0());
+  while (k >= basis.Nablasize(j)) {
+    k -= basis.Nablasize(j);
+    j++;
+  }
+  return Index(j, 1, k, &basis);
+}
+
+template <class IBASIS>
+void test_fwt(const IBASIS& basis, const int jmax)
+{
+  typedef typename IBASIS::Index Index;
+  const int N = basis.Deltasize(jmax+1);
+
+  // a random coefficient vector on the levels j0,...,jmax, dense and sparse
+  Vector<double> x(N), y(N), z(N);
+  InfiniteVector<double,Index> c, c_sparse;
+  for (int i = 0; i < N; i++) {
+    x[i] = (double)rand()/RAND_MAX - 0.5;
+    c.set_coefficient(number_to_index(basis, i), x[i]);
+    if (i % 7 == 0)
+      c_sparse.set_coefficient(number_to_index(basis, i), x[i]);
+  }
+
+  // reference: index-wise reconstruction to the generators on level jmax+1
+  clock_t tstart = clock();
+  InfiniteVector<double,Index> r_ref, help;
+  for (typename InfiniteVector<double,Index>::const_iterator it(c.begin()); it != c.end(); ++it) {
+    basis.reconstruct_1(it.index(), jmax+1, help);
+    r_ref.add(*it, help);
+  }
+  const double time_ref = (double)(clock()-tstart)/CLOCKS_PER_SEC;
+
+  tstart = clock();
+  basis.apply_Tj(jmax, x, y);
+  const double time_Tj = (double)(clock()-tstart)/CLOCKS_PER_SEC;
+  double err = 0;
+  for (int i = 0; i < N; i++)
+    err = max(err, fabs(y[i]-r_ref.get_coefficient(Index(jmax+1, 0, basis.DeltaLmin()+i, &basis))));
+  cout << "* apply_Tj, jmax=" << jmax << ", N=" << N << ": error against reconstruct_1: " << err
+       << " (time " << time_Tj << "s vs. " << time_ref << "s)" << endl;
+
+  basis.apply_Tjinv(jmax, y, z);
+  cout << "* apply_Tjinv(apply_Tj(x))-x: " << linfty_norm(z-x) << endl;
+
+  tstart = clock();
+  InfiniteVector<double,Index> r;
+  basis.reconstruct(c, jmax+1, r);
+  const double time_r = (double)(clock()-tstart)/CLOCKS_PER_SEC;
+  cout << "* reconstruct: error against reconstruct_1: " << linfty_norm(r-r_ref)
+       << " (time " << time_r << "s)" << endl;
+
+  // decompose the single-scale representation back to the levels j0,...,jmax
+  InfiniteVector<double,Index> dcmp, dcmp_ref;
+  for (typename InfiniteVector<double,Index>::const_iterator it(r.begin()); it != r.end(); ++it) {
+    basis.decompose_1(it.index(), basis.j0(), help);
+    dcmp_ref.add(*it, help);
+  }
+  basis.decompose(r, basis.j0(), dcmp);
+  cout << "* decompose: error against decompose_1: " << linfty_norm(dcmp-dcmp_ref)
+       << ", decompose(reconstruct(c))-c: " << linfty_norm(dcmp-c) << endl;
+
+  // sparse input, primal and dual
+  InfiniteVector<double,Index> s, s_ref, t, t_ref;
+  for (typename InfiniteVector<double,Index>::const_iterator it(c_sparse.begin()); it != c_sparse.end(); ++it) {
+    basis.reconstruct_1(it.index(), jmax, help);
+    s_ref.add(*it, help);
+    basis.reconstruct_t_1(it.index(), jmax, help);
+    t_ref.add(*it, help);
+  }
+  basis.reconstruct(c_sparse, jmax, s);
+  basis.reconstruct_t(c_sparse, jmax, t);
+  cout << "* sparse reconstruct: error " << linfty_norm(s-s_ref)
+       << ", sparse reconstruct_t: error " << linfty_norm(t-t_ref) << endl;
+
+  InfiniteVector<double,Index> dt, dt_ref;
+  for (typename InfiniteVector<double,Index>::const_iterator it(t.begin()); it != t.end(); ++it) {
+    basis.decompose_t_1(it.index(), basis.j0(), help);
+    dt_ref.add(*it, help);
+  }
+  basis.decompose_t(t, basis.j0(), dt);
+  cout << "* decompose_t: error against decompose_t_1: " << linfty_norm(dt-dt_ref) << endl;
+}
+
+int main()
+{
+  cout << "Testing the fast wavelet transform of interval bases..." << endl;
+
+  srand(4711);
+
+  {
+    cout << "- PBasis<3,3>, homogeneous boundary conditions:" << endl;
+    PBasis<3,3> basis(1, 1);
+    for (int jmax = basis.j0(); jmax <= basis.j0()+4; jmax += 2)
+      test_fwt(basis, jmax);
+  }
+
+  {
+    cout << "- PBasis<2,2>, no boundary conditions:" << endl;
+    PBasis<2,2> basis(0, 0);
+    test_fwt(basis, basis.j0()+3);
+  }
+
+  {
+    cout << "- DSBasis<2,2>, homogeneous boundary conditions:" << endl;
+    DSBasis<2,2> basis(true, true);
+    for (int jmax = basis.j0(); jmax <= basis.j0()+4; jmax += 2)
+      test_fwt(basis, jmax);
+  }
+
+  return 0;
+}
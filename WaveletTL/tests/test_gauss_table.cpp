@@ -0,0 +1,110 @@
+#include <iostream>
+#include <ctime>
+
+#include <utils/array1d.h>
+#include <numerics/gauss_data.h>
+#include <interval/p_basis.h>
+#include <interval/ds_basis.h>
+#include <interval/gauss_table.h>
+
+using namespace std;
+using namespace MathTL;
+using namespace WaveletTL;
+
+/*
+  Tests for the tables of generator and wavelet values at Gauss points:
+  table lookups against the point evaluation routines of the basis,
+  for all generators and wavelets on some levels and granularities.
+*/
+
+template <class IBASIS>
+void test_gauss_table(const IBASIS& basis, const int jmax, const int N_Gauss)
+{
+  typedef typename IBASIS::Index Index;
+
+  GaussTable<IBASIS> table(&basis, N_Gauss);
+
+  double err = 0, time_table = 0, time_direct = 0;
+  int lookups = 0;
+  Array1D<double> values, der_values, values_ref, der_values_ref;
+  for (int sweep = 0; sweep < 2; sweep++) {
+    for (Index lambda(basis.first_generator(basis.j0()));; ++lambda) {
+      for (int J = lambda.j()+lambda.e(); J <= lambda.j()+lambda.e()+2; J++) {
+	int k1, k2;
+	basis.support(lambda, k1, k2);
+	k1 <<= J-lambda.j()-lambda.e();
+	k2 <<= J-lambda.j()-lambda.e();
+
+	// one subinterval more on both sides, clipped to [0,1]
+	const int a = std::max(0, k1-1), b = std::min(1<<J, k2+1);
+
+	clock_t tstart = clock();
+	table.evaluate(lambda, J, a, b, values, der_values);
+	time_table += (double)(clock()-tstart)/CLOCKS_PER_SEC;
+	lookups++;
+
+	if (sweep == 0) {
+	  tstart = clock();
+	  const double h = ldexp(1.0, -J);
+	  Array1D<double> points(N_Gauss*(b-a));
+	  for (int patch = a; patch < b; patch++)
+	    for (int n = 0; n < N_Gauss; n++)
+	      points[(patch-a)*N_Gauss+n] = h*(2*patch+1+GaussPoints[N_Gauss-1][n])/2.;
+	  evaluate(basis, 0, lambda, points, values_ref);
+	  evaluate(basis, 1, lambda, points, der_values_ref);
+	  time_direct += (double)(clock()-tstart)/CLOCKS_PER_SEC;
+
+	  double scale = 1, der_scale = 1;
+	  for (unsigned int m = 0; m < points.size(); m++) {
+	    scale = max(scale, fabs(values_ref[m]));
+	    der_scale = max(der_scale, fabs(der_values_ref[m]));
+	  }
+	  for (unsigned int m = 0; m < points.size(); m++) {
+	    err = max(err, fabs(values[m]-values_ref[m])/scale);
+	    err = max(err, fabs(der_values[m]-der_values_ref[m])/der_scale);
+	  }
+	}
+      }
+      if (lambda == basis.last_wavelet(jmax)) break;
+    }
+    if (sweep == 0)
+      cout << "* first sweep (computing the tables): " << lookups << " lookups, relative error "
+	   << err << ", " << table.size() << " tables" << endl
+	   << "  (time " << time_table << "s vs. " << time_direct << "s for direct evaluation)" << endl;
+    else
+      cout << "* second sweep: time " << time_table << "s for " << lookups << " lookups" << endl;
+    time_table = 0;
+    lookups = 0;
+  }
+}
+
+int main()
+{
+  cout << "Testing tables of generator and wavelet values at Gauss points..." << endl;
+
+  {
+    cout << "- PBasis<3,3>, homogeneous boundary conditions:" << endl;
+    PBasis<3,3> basis(1, 1);
+    test_gauss_table(basis, basis.j0()+4, 5);
+  }
+
+  {
+    cout << "- PBasis<2,2>, no boundary conditions:" << endl;
+    PBasis<2,2> basis(0, 0);
+    test_gauss_table(basis, basis.j0()+4, 2);
+  }
+
+  {
+    cout << "- DSBasis<2,2>, homogeneous boundary conditions:" << endl;
+    DSBasis<2,2> basis(true, true);
+    test_gauss_table(basis, basis.j0()+4, 2);
+  }
+
+  {
+    cout << "- DSBasis<3,5>, homogeneous boundary conditions:" << endl;
+    DSBasis<3,5> basis(true, true);
+    test_gauss_table(basis, basis.j0()+3, 5);
+  }
+
+  return 0;
+}
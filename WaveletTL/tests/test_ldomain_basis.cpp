@@ -48,6 +48,19 @@ int main()
     cout << (*ind) << endl;
   }
 
+  cout << "- checking the packed keys of the indices:" << endl;
+  bool keys_ok = true;
+  for (int i = 0; i < basis.degrees_of_freedom(); i++) {
+    const Index* ind = basis.get_wavelet(i);
+    if (Index(ind->key(), &basis) != *ind
+	|| (i+1 < basis.degrees_of_freedom()
+	    && (*ind < *basis.get_wavelet(i+1)) != (ind->key() < basis.get_wavelet(i+1)->key()))) {
+      cout << "  " << *ind << " has the key " << ind->key() << endl;
+      keys_ok = false;
+    }
+  }
+  cout << "  ... " << (keys_ok ? "OK" : "failed") << endl;
+
 
 #if 0
   // only for IBASIS != SplineBasis
@@ -0,0 +1,162 @@
+// parameters of steepest_descent_ks_SOLVE
+#define ONE_D
+#define JMAX 10
+#define PRIMALORDER 3
+#define DUALORDER 3
+
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+
+#include <algebra/infinite_vector.h>
+#include <numerics/sturm_bvp.h>
+#include <interval/p_basis.h>
+#include <interval/pq_frame.h>
+#include <galerkin/sturm_equation.h>
+#include <galerkin/cached_problem.h>
+#include <galerkin/TestProblem.h>
+#include <adaptive/cdd2.h>
+#include <adaptive/stevenson_AWGM.h>
+#include <adaptive/steepest_descent_ks.h>
+#include <adaptive/solver_checkpoint.h>
+
+using namespace std;
+using namespace MathTL;
+using namespace WaveletTL;
+
+/*
+  Tests for checkpoint/restart of the adaptive solvers:
+  a run which is interrupted at a coarser tolerance and resumed from its
+  checkpoint file has to yield the same iterate as an uninterrupted run.
+*/
+
+typedef PBasis<3,3> Basis;
+typedef Basis::Index Index;
+typedef CachedProblem<SturmEquation<Basis> > Problem;
+
+int main()
+{
+  cout << "Testing checkpoint/restart of adaptive solvers..." << endl;
+
+  TestProblem<2> T;
+  Basis basis(1, 1);
+  const int jmax = 10;
+  basis.set_jmax(jmax);
+  SturmEquation<Basis> eq(T, basis);
+
+  const double epsilon_coarse = 1e-2, epsilon = 1e-3;
+  bool ok = true;
+
+  {
+    cout << "- CDD2_SOLVE:" << endl;
+    Problem P(&eq);
+    const double nu = P.norm_Ainv() * P.F_norm();
+
+    InfiniteVector<double,Index> u_direct, u_resumed;
+    CDD2_SOLVE(P, nu, epsilon, u_direct, jmax);
+
+    remove("test_solver_checkpoint_cdd2.dat");
+    SolverCheckpoint checkpoint("test_solver_checkpoint_cdd2.dat");
+    {
+      // "interrupted" run: stop at a coarser tolerance
+      Problem P1(&eq);
+      CDD2_SOLVE(P1, nu, epsilon_coarse, u_resumed, jmax, CDD1, &checkpoint);
+    }
+    {
+      Problem P2(&eq);
+      CDD2_SOLVE(P2, nu, epsilon, u_resumed, jmax, CDD1, &checkpoint);
+    }
+    const double diff = linfty_norm(u_direct-u_resumed);
+    cout << "* difference between the uninterrupted and the resumed run: "
+	 << diff << " (" << u_direct.size() << " coefficients)" << endl;
+    if (diff != 0) ok = false;
+    remove("test_solver_checkpoint_cdd2.dat");
+  }
+
+  {
+    cout << "- AWGM_SOLVE (with the entries cache):" << endl;
+    Problem P(&eq);
+    MathTL::DummyLogger logger;
+
+    InfiniteVector<double,Index> u_direct, u_resumed;
+    AWGM_SOLVE(P, epsilon, u_direct, jmax, logger);
+
+    remove("test_solver_checkpoint_awgm.dat");
+    remove("test_solver_checkpoint_awgm.cache");
+    {
+      Problem P1(&eq);
+      CachedSolverCheckpoint<Problem> checkpoint(&P1, "test_solver_checkpoint_awgm.dat",
+						 "test_solver_checkpoint_awgm.cache", "TestProblem<2>",
+						 1, true, 1);
+      AWGM_SOLVE(P1, epsilon_coarse, u_resumed, jmax, logger,
+		 0.9, 0.01, 0.01, 0.4, InfiniteVector<double,Index>(), St04a, &checkpoint);
+    }
+    {
+      Problem P2(&eq);
+      CachedSolverCheckpoint<Problem> checkpoint(&P2, "test_solver_checkpoint_awgm.dat",
+						 "test_solver_checkpoint_awgm.cache", "TestProblem<2>",
+						 1, true, 1);
+      AWGM_SOLVE(P2, epsilon, u_resumed, jmax, logger,
+		 0.9, 0.01, 0.01, 0.4, InfiniteVector<double,Index>(), St04a, &checkpoint);
+    }
+    const double diff = linfty_norm(u_direct-u_resumed);
+    cout << "* difference between the uninterrupted and the resumed run: "
+	 << diff << " (" << u_direct.size() << " coefficients)" << endl;
+    if (diff != 0) ok = false;
+    remove("test_solver_checkpoint_awgm.dat");
+    remove("test_solver_checkpoint_awgm.cache");
+  }
+
+  {
+    cout << "- steepest_descent_ks_SOLVE:" << endl;
+    // the solver stops at a fixed residual (see steepest_descent_ks.cpp);
+    // the "interrupted" run ends its outer loop at a tolerance before that
+    const double epsilon_sd_coarse = 1.0, epsilon_sd = 1e-6;
+    Problem P(&eq);
+
+    InfiniteVector<double,Index> u_direct, u_resumed;
+    steepest_descent_ks_SOLVE(P, epsilon_sd, u_direct);
+
+    remove("test_solver_checkpoint_sd.dat");
+    SolverCheckpoint checkpoint("test_solver_checkpoint_sd.dat");
+    {
+      Problem P1(&eq);
+      steepest_descent_ks_SOLVE(P1, epsilon_sd_coarse, u_resumed, &checkpoint);
+    }
+    {
+      Problem P2(&eq);
+      steepest_descent_ks_SOLVE(P2, epsilon_sd, u_resumed, &checkpoint);
+    }
+    const double diff = linfty_norm(u_direct-u_resumed);
+    cout << "* difference between the uninterrupted and the resumed run: "
+	 << diff << " (" << u_direct.size() << " coefficients)" << endl;
+    if (diff != 0 || u_direct.size() == 0) ok = false;
+    remove("test_solver_checkpoint_sd.dat");
+  }
+
+  {
+    cout << "- persistent norm estimates:" << endl;
+    remove("test_solver_checkpoint.norms");
+    double normA, normAinv;
+    {
+      Problem P1(&eq);
+      P1.set_norm_store("test_solver_checkpoint.norms", "TestProblem<2>");
+      normA = P1.norm_A();
+      normAinv = P1.norm_Ainv();
+    }
+    Problem P2(&eq);
+    P2.set_norm_store("test_solver_checkpoint.norms", "TestProblem<2>");
+    const double diff = max(fabs(P2.norm_A()-normA), fabs(P2.norm_Ainv()-normAinv));
+    cout << "* ||A||=" << P2.norm_A() << ", ||A^{-1}||=" << P2.norm_Ainv()
+	 << ", difference to the computed estimates: " << diff << endl;
+    if (diff != 0) ok = false;
+    remove("test_solver_checkpoint.norms");
+  }
+
+  if (!ok) {
+    cout << "ERROR: the resumed runs differ" << endl;
+    return 1;
+  }
+  return 0;
+}
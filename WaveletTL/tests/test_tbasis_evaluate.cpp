@@ -0,0 +1,85 @@
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+
+#include <algebra/infinite_vector.h>
+#include <algebra/matrix.h>
+#include <utils/fixed_array1d.h>
+#include <interval/p_basis.h>
+#include <cube/tbasis.h>
+#include <cube/tbasis_evaluate.h>
+
+using namespace std;
+using namespace MathTL;
+using namespace WaveletTL;
+
+/*
+  Tests for the evaluation of wavelet expansions w.r.t. a TensorBasis on a grid:
+  the support-local evaluation and the evaluation via the fast wavelet transform
+  against the sum of the evaluations of the single wavelets on the full grid.
+*/
+
+// maximal pointwise difference
+double max_error(const Matrix<double>& A, const Matrix<double>& B)
+{
+  double r = 0;
+  for (unsigned int m = 0; m < A.row_dimension(); m++)
+    for (unsigned int n = 0; n < A.column_dimension(); n++)
+      r = max(r, fabs(A(m,n)-B(m,n)));
+  return r;
+}
+
+int main()
+{
+  cout << "Testing the evaluation of tensor product wavelet expansions..." << endl;
+
+  srand(4711);
+
+  const unsigned int DIM = 2;
+  typedef PBasis<3,3> Basis1D;
+  typedef TensorBasis<Basis1D,DIM> Basis;
+  typedef Basis::Index Index;
+
+  FixedArray1D<bool,2*DIM> bc;
+  bc[0] = bc[1] = bc[2] = bc[3] = true;
+  Basis basis(bc);
+  basis.set_jmax(multi_degree(basis.j0())+4);
+
+  // a random coefficient set, every fifth element of the full collection
+  InfiniteVector<double,Index> coeffs;
+  InfiniteVector<double,int> coeffs_int;
+  for (int n = 0; n < basis.degrees_of_freedom(); n += 5) {
+    const double c = (double)rand()/RAND_MAX - 0.5;
+    coeffs.set_coefficient(*basis.get_wavelet(n), c);
+    coeffs_int.set_coefficient(n, c);
+  }
+
+  for (int resolution = 6; resolution <= 8; resolution++) {
+    cout << "* " << coeffs.size() << " coefficients, resolution " << resolution << ":" << endl;
+
+    // reference: full grid evaluation of each single wavelet
+    clock_t tstart = clock();
+    Grid<DIM> grid(Point<DIM>(0), Point<DIM>(1), 1<<resolution);
+    SampledMapping<DIM> reference(grid);
+    for (InfiniteVector<double,Index>::const_iterator it(coeffs.begin()); it != coeffs.end(); ++it)
+      reference.add(*it, evaluate(basis, it.index(), true, resolution));
+    const double time_ref = (double)(clock()-tstart)/CLOCKS_PER_SEC;
+
+    tstart = clock();
+    SampledMapping<DIM> s(evaluate(basis, coeffs, true, resolution));
+    const double time_local = (double)(clock()-tstart)/CLOCKS_PER_SEC;
+    SampledMapping<DIM> s_int(evaluate(basis, coeffs_int, true, resolution));
+
+    tstart = clock();
+    SampledMapping<DIM> s_fwt(evaluate_single_scale(basis, coeffs, resolution));
+    const double time_fwt = (double)(clock()-tstart)/CLOCKS_PER_SEC;
+
+    cout << "  support-local: error " << max_error(s.values(), reference.values())
+	 << " (int indices: " << max_error(s_int.values(), reference.values()) << ")"
+	 << ", via fast wavelet transform: error " << max_error(s_fwt.values(), reference.values()) << endl
+	 << "  time " << time_local << "s (support-local), " << time_fwt << "s (single-scale) vs. "
+	 << time_ref << "s (full grid)" << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+
+#include <algebra/vector.h>
+#include <algebra/infinite_vector.h>
+#include <utils/fixed_array1d.h>
+#include <interval/p_basis.h>
+#include <cube/tbasis.h>
+#include <cube/tbasis_fwt.h>
+
+using namespace std;
+using namespace MathTL;
+
+// qtbasis.h needs the comparison functors from MathTL (utils/tiny_tools.h)
+#include <general_domain/qtbasis.h>
+
+using namespace WaveletTL;
+
+/*
+  Tests for the tensor product fast wavelet transform:
+  - tensor_reconstruct against the tensor products of the 1D routine reconstruct_1,
+  - apply_tensor_Tjinv(apply_tensor_Tj(x)) == x,
+  for TensorBasis and for a (single patch) QTBasis.
+*/
+
+template <class TBASIS, unsigned int DIM>
+void test_tensor_fwt(const TBASIS& basis, const FixedArray1D<typename TBASIS::IntervalBasis*,DIM>& bases)
+{
+  typedef typename TBASIS::Index Index;
+  typedef typename TBASIS::IntervalBasis IBASIS;
+  typedef typename IBASIS::Index Index1D;
+
+  // a random coefficient set, every third element of the full collection
+  InfiniteVector<double,Index> coeffs;
+  for (int n = 0; n < basis.degrees_of_freedom(); n += 3)
+    coeffs.set_coefficient(*basis.get_wavelet(n), (double)rand()/RAND_MAX - 0.5);
+
+  clock_t tstart = clock();
+  FixedArray1D<int,DIM> jmax;
+  Vector<double> y;
+  tensor_reconstruct(bases, coeffs, jmax, y);
+  const double time_fwt = (double)(clock()-tstart)/CLOCKS_PER_SEC;
+
+  // reference: tensor products of the 1D reconstructions of each single index
+  tstart = clock();
+  Vector<double> y_ref(y.size());
+  FixedArray1D<InfiniteVector<double,Index1D>,DIM> factors;
+  for (typename InfiniteVector<double,Index>::const_iterator it(coeffs.begin()); it != coeffs.end(); ++it) {
+    for (unsigned int i = 0; i < DIM; i++)
+      bases[i]->reconstruct_1(Index1D(it.index().j()[i], it.index().e()[i], it.index().k()[i], bases[i]),
+			      jmax[i]+1, factors[i]);
+    // only DIM=2 here
+    for (typename InfiniteVector<double,Index1D>::const_iterator it0(factors[0].begin()); it0 != factors[0].end(); ++it0)
+      for (typename InfiniteVector<double,Index1D>::const_iterator it1(factors[1].begin()); it1 != factors[1].end(); ++it1)
+	y_ref[(it0.index().k()-bases[0]->DeltaLmin())*bases[1]->Deltasize(jmax[1]+1)
+	      + it1.index().k()-bases[1]->DeltaLmin()] += *it * *it0 * *it1;
+  }
+  const double time_ref = (double)(clock()-tstart)/CLOCKS_PER_SEC;
+
+  cout << "* " << coeffs.size() << " coefficients, jmax=(" << jmax[0] << "," << jmax[1]
+       << "), tensor size " << y.size() << endl;
+  cout << "  tensor_reconstruct: error against reconstruct_1: " << linfty_norm(y-y_ref)
+       << " (time " << time_fwt << "s vs. " << time_ref << "s)" << endl;
+
+  Vector<double> x(y.size());
+  for (typename InfiniteVector<double,Index>::const_iterator it(coeffs.begin()); it != coeffs.end(); ++it)
+    x[tensor_position(bases, jmax, it.index())] = *it;
+  Vector<double> z;
+  apply_tensor_Tjinv(bases, jmax, y, z);
+  cout << "  apply_tensor_Tjinv(apply_tensor_Tj(x))-x: " << linfty_norm(z-x) << endl;
+}
+
+int main()
+{
+  cout << "Testing the tensor product fast wavelet transform..." << endl;
+
+  srand(4711);
+
+  const unsigned int DIM = 2;
+  typedef PBasis<3,3> Basis1d;
+
+  {
+    cout << "- TensorBasis<PBasis<3,3>,2>, homogeneous boundary conditions:" << endl;
+    FixedArray1D<bool,2*DIM> bc;
+    bc[0] = bc[1] = bc[2] = bc[3] = true;
+    TensorBasis<Basis1d,DIM> basis(bc);
+    basis.set_jmax(multi_degree(basis.j0())+4);
+    test_tensor_fwt<TensorBasis<Basis1d,DIM>,DIM>(basis, basis.bases());
+  }
+
+  {
+    cout << "- QTBasis<PBasis<3,3>,2>, one patch:" << endl;
+    Array1D<Point<DIM,int> > corners(1);
+    Array1D<FixedArray1D<int,2*DIM> > neighbours(1);
+    Array1D<FixedArray1D<bool,2*DIM> > bc(1);
+    for (unsigned int i = 0; i < 2*DIM; i++) {
+      neighbours[0][i] = -1;
+      bc[0][i] = true;
+    }
+    QTBasis<Basis1d,DIM> basis(corners, neighbours, bc);
+    basis.set_jmax(multi_degree(basis.j0()[0])+4);
+    test_tensor_fwt<QTBasis<Basis1d,DIM>,DIM>(basis, basis.bases()[0]);
+  }
+
+  return 0;
+}
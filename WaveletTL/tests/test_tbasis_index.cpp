@@ -161,6 +161,99 @@ int main()
     
     
     
+    // get_wavelet(i) computes the i-th index from the level offsets of the basis,
+    // compare with the enumeration by operator ++ and with the numbers of the indices
+    cout << "Testing get_wavelet" << endl;
+    for (unsigned int b=0; b<TBasisArray.size(); ++b)
+    {
+        bool ok = true;
+        Basis::Index lambda(TBasisArray[b]->first_generator());
+        for (int i=0; i<TBasisArray[b]->degrees_of_freedom(); ++i, ++lambda)
+        {
+            Basis::Index mu(*TBasisArray[b]->get_wavelet(i));
+            Basis::Index nu(mu.j(), mu.e(), mu.k(), TBasisArray[b]);
+            if (mu.j() != lambda.j() || mu.e() != lambda.e() || mu.k() != lambda.k()
+                || mu.number() != (unsigned int)i || nu.number() != (unsigned int)i)
+            {
+                cout << "i = " << i << "; get_wavelet(i) = " << mu << "; expected " << lambda << endl;
+                ok = false;
+            }
+        }
+        cout << "basis " << b << ": " << TBasisArray[b]->degrees_of_freedom() << " indices " << (ok ? "OK" : "failed") << endl;
+    }
+
+    // operator < compares the numbers of indices of the same basis,
+    // they have to be ordered as (j,e,k) w.r.t. "<" for indices without a basis
+    cout << "Testing the ordering of the numbers" << endl;
+    for (unsigned int b=0; b<TBasisArray.size(); ++b)
+    {
+        bool ok = true;
+        for (int i=0; i+1<TBasisArray[b]->degrees_of_freedom(); ++i)
+        {
+            Basis::Index lambda(*TBasisArray[b]->get_wavelet(i)), mu(*TBasisArray[b]->get_wavelet(i+1));
+            Basis::Index lambda0(lambda.j(), lambda.e(), lambda.k(), i, 0), mu0(mu.j(), mu.e(), mu.k(), i+1, 0);
+            if (!(lambda < mu) || !(lambda0 < mu0) || (mu0 < lambda0) || lambda0 == mu0)
+            {
+                cout << "i = " << i << ": " << lambda << " and " << mu << " are not ordered" << endl;
+                ok = false;
+            }
+        }
+        InfiniteVector<double,Basis::Index> v, v2;
+        InfiniteVector<double,int> w;
+        for (int i=0; i<TBasisArray[b]->degrees_of_freedom(); i+=3)
+            v.set_coefficient(*TBasisArray[b]->get_wavelet(i), 1.0+i);
+        index_to_number(v, w);
+        number_to_index(TBasisArray[b], w, v2);
+        if (w.size() != v.size() || v2.size() != v.size() || linfty_norm(v-v2) > 0)
+            ok = false;
+        cout << "basis " << b << ": " << (ok ? "OK" : "failed") << endl;
+    }
+
+    // the packed keys have to be ordered like the indices and yield the same indices again
+    cout << "Testing the packed keys" << endl;
+    for (unsigned int b=0; b<TBasisArray.size(); ++b)
+    {
+        bool ok = true;
+        for (int i=0; i<TBasisArray[b]->degrees_of_freedom(); ++i)
+        {
+            Basis::Index lambda(*TBasisArray[b]->get_wavelet(i));
+            Basis::Index mu(lambda.key(), TBasisArray[b]);
+            if (mu != lambda || (int)mu.number() != i
+                || (i+1 < TBasisArray[b]->degrees_of_freedom() && !(lambda.key() < TBasisArray[b]->get_wavelet(i+1)->key())))
+            {
+                cout << "i = " << i << ": " << lambda << " has the key " << lambda.key() << endl;
+                ok = false;
+            }
+        }
+        InfiniteVector<double,Basis::Index> v, v2;
+        InfiniteVector<double,Basis::Index::key_type> w;
+        for (int i=0; i<TBasisArray[b]->degrees_of_freedom(); i+=3)
+            v.set_coefficient(*TBasisArray[b]->get_wavelet(i), 1.0+i);
+        index_to_key(v, w);
+        key_to_index(TBasisArray[b], w, v2);
+        if (w.size() != v.size() || v2.size() != v.size() || linfty_norm(v-v2) > 0)
+            ok = false;
+        cout << "basis " << b << ": " << (ok ? "OK" : "failed") << endl;
+    }
+
+    // the 1D constructor from (int) j,e,k has to compute the number as well,
+    // otherwise all such indices would compare equal
+    cout << "Testing the 1D constructor" << endl;
+    {
+        typedef TensorBasis<Basis1d,1> Basis1D;
+        Basis1D basis1D;
+        basis1D.set_jmax(4);
+        bool ok = true;
+        for (int i=0; i<basis1D.degrees_of_freedom(); ++i)
+        {
+            Basis1D::Index lambda(*basis1D.get_wavelet(i));
+            Basis1D::Index mu(lambda.j()[0], lambda.e()[0], lambda.k()[0], &basis1D);
+            if (mu.number() != lambda.number() || !(mu == lambda))
+                ok = false;
+        }
+        cout << "1D basis: " << (ok ? "OK" : "failed") << endl;
+    }
+
 #if 1
     // some output for debugging
     for (unsigned int i=0; (int)i<TBasisArray[0]->degrees_of_freedom(); ++i)
@@ -0,0 +1,6 @@
+x = [         0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1;          0       0.01       0.02       0.03       0.04       0.05       0.06       0.07       0.08       0.09        0.1       0.11       0.12       0.13       0.14       0.15       0.16       0.17       0.18       0.19        0.2       0.21       0.22       0.23       0.24       0.25       0.26       0.27       0.28       0.29        0.3       0.31       0.32       0.33       0.34       0.35       0.36       0.37       0.38       0.39        0.4       0.41       0.42       0.43       0.44       0.45       0.46       0.47       0.48       0.49        0.5       0.51       0.52       0.53       0.54       0.55       0.56       0.57       0.58       0.59        0.6       0.61       0.62       0.63       0.64       0.65       0.66       0.67       0.68       0.69        0.7       0.71       0.72       0.73       0.74       0.75       0.76       0.77       0.78       0.79        0.8       0.81       0.82       0.83       0.84       0.85       0.86       0.87       0.88       0.89        0.9       0.91       0.92       0.93       0.94       0.95       0.96       0.97       0.98       0.99          1];
+;
+y = [         1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1          1;       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99       0.99;       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98       0.98;       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97       0.97;       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96       0.96;       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95       0.95;       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94       0.94;       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93       0.93;       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92       0.92;       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91       0.91;        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9        0.9;       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89       0.89;       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88       0.88;       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87       0.87;       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86       0.86;       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85       0.85;       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84       0.84;       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83       0.83;       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82       0.82;       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81       0.81;        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8        0.8;       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79       0.79;       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78       0.78;       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77       0.77;       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76       0.76;       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75       0.75;       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74       0.74;       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73       0.73;       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72       0.72;       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71       0.71;        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7        0.7;       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69       0.69;       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68       0.68;       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67       0.67;       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66       0.66;       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65       0.65;       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64       0.64;       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63       0.63;       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62       0.62;       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61       0.61;        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6        0.6;       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59       0.59;       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58       0.58;       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57       0.57;       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56       0.56;       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55       0.55;       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54       0.54;       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53       0.53;       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52       0.52;       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51       0.51;        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5        0.5;       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49       0.49;       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48       0.48;       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47       0.47;       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46       0.46;       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45       0.45;       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44       0.44;       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43       0.43;       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42       0.42;       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41       0.41;        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4        0.4;       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39       0.39;       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38       0.38;       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37       0.37;       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36       0.36;       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35       0.35;       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34       0.34;       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33       0.33;       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32       0.32;       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31       0.31;        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3        0.3;       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29       0.29;       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28       0.28;       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27       0.27;       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26       0.26;       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25       0.25;       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24       0.24;       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23       0.23;       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22       0.22;       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21       0.21;        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2        0.2;       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19       0.19;       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18       0.18;       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17       0.17;       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16       0.16;       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15       0.15;       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14       0.14;       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13       0.13;       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12       0.12;       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11       0.11;        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1        0.1;       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09       0.09;       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08       0.08;       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07       0.07; 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001 0.0600000000000001;       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05       0.05;       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04       0.04;       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03       0.03;       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02       0.02;       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01       0.01;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;
+z = [         0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0;          0 0.000259736804817835 0.000532595724231284 0.000819229048138135 0.00112032035454442 0.00143658588704307 0.00176877597907548 0.0021176765248671 0.00248411049665896 0.00286893950754603 0.00327306541887608 0.00369743199075291 0.00414302657371992 0.00461088183916632 0.00510207754539209 0.00561774233557923 0.00615905556313799 0.00672724913901542 0.00732360939455951 0.0079494789524113 0.00860625859663587 0.00929540913188494 0.0100184532197909 0.0107769771790052 0.011572632733292 0.0124071386898426 0.0132822825274714 0.0141999218715411 0.0151619858293374 0.016170476156104 0.017227468218049 0.0183351117142717 0.0194956311147006 0.020711325765725 0.0219845696091693 0.0233178104535529 0.0247135687291081 0.026174435649725 0.0277030706957548 0.0293021983213347 0.0309746037784937 0.032723127937618 0.0345506609697847 0.0364601347408388 0.038454513749745 0.0405367844244887 0.0427099425674409 0.0449769787184046 0.0473408611772779 0.049804516399125 0.0523708064421357 0.0550425031131346 0.0578222584156049 0.0607125708611969 0.0637157471569485 0.0668338587264402 0.0700686924632858 0.0734216950491026 0.0768939100947232 0.0804859072821522 0.0841977025947982 0.0880286686238937 0.0919774338287423 0.0960417695063505 0.100218463090893 0.104503176253903 0.108890286110587 0.113372707654502 0.117941695340179 0.122586621509019 0.127294729105709 0.132050855857869 0.136837126787999 0.141632611590865 0.146412943037831 0.151149892158618 0.155810895496329 0.160358529228675 0.164749924392221 0.168936116831325 0.172861324813231 0.176462146498472 0.179666668623865 0.182393476835432 0.184550557091344 0.186034076430186 0.186727030156085 0.186497741117067 0.185198195232502 0.18266219574433 0.178703316808092 0.173112634984762 0.165656214922436 0.156072323005182 0.144068339969428 0.129317340418433 0.111454303771581 0.0900719174334327 0.064715928820036 0.034879998295056          0;          0 0.000481912539970427 0.000988171693348185 0.00151998771095491 0.00207862889519152 0.0026654241557955 0.00328176565239866 0.00392911152368337 0.00460898870243559 0.0053229958152164 0.00607280616471044 0.00686017079204979 0.0076869216155432 0.00855497464125107 0.00946633323972094 0.0104230914819219 0.0114274375259698 0.0124816570446014 0.0135881366815101 0.0147493675225765 0.0159679485656872 0.0172465901702021 0.0185881174641785 0.0199954736841405 0.0214717234184699 0.0230200557213325 0.0246437870593957 0.0263463640483889 0.0281313659307397 0.0300025067390226 0.0319636370827095 0.0340187454876225 0.0361719592084807 0.0384275444248866 0.0407899057199149 0.0432635847280163 0.0458532578250935 0.0485637327181957 0.051399943775141 0.0543669459153289 0.0574699068618345 0.0607140975313635 0.0641048803125292 0.0676476949539157 0.0713480417512045 0.0752114616869177 0.0792435131366997 0.0834497447120897 0.0878356637609751 0.0924066999928424 0.0971681636359925 0.102125197467431 0.107282721982484 0.112645372889583 0.118217430025189 0.124002736683669 0.130004608245917 0.136225728867585 0.142668034851645 0.149332583179228 0.156219403505758 0.163327331744564 0.170653823155553 0.178194742630027 0.18594412961204 0.193893934819196 0.202033725618758 0.210350356575089 0.218827601308434 0.227445741389008 0.23618110753 0.245005567833814 0.253885957282446 0.262783442039602 0.271652811442692 0.28044168980019 0.289089659266289 0.297527284131765 0.305675025838076 0.313442036880461 0.320724820503671 0.327405741698232 0.333351373461596 0.338410660581764 0.342412881313537 0.345165385230639 0.346451083229289 0.34602566310734 0.343614501321939 0.338909238409484 0.331563982103064 0.321191098369712 0.307356546374503 0.289574708718168 0.267302663142727 0.239933836203826 0.206790973111677 0.167118350981469 0.120073155038933 0.0647159288200361          0;          0 0.000670728015525497 0.00137534175582684 0.00211552565337788 0.00289304493709859 0.00370974918946941 0.00456757602445491 0.00546855488595551 0.00641481096581086 0.00740856923957554 0.00845215861736488 0.00954801620601095 0.0106986916775599 0.0119068517377643 0.0131752846866585 0.0145069050615267 0.0159047583505623 0.0173720257632414 0.0189120290408666 0.020528235287841 0.022224261800977 0.0240038808704813 0.0258710245221434 0.0278297891656417 0.0298844401087102 0.0320394158911142 0.034299332385905 0.0366689866081771 0.0391533601634531 0.0417576222587814 0.0444871321895432 0.0473474412037093 0.0503442936327458 0.0534836271643892 0.0567715721169439 0.0602144495574287 0.0638187680866144 0.0675912190925452 0.0715386702502866 0.0756681570191312 0.0799868718590284 0.0845021508552816 0.089221457404202 0.0941523625720519 0.099302521694813 0.104679646736592 0.110291473869323 0.116145725675211 0.12225006730553 0.128612055854082 0.135239082120223 0.142138303843852 0.149316569392241 0.15678033076499 0.164535544657512 0.172587560183995 0.180940991706305 0.189599575044211 0.198566005152799 0.207841753143105 0.217426860289679 0.227319706411518 0.237516749728046 0.248012234976598 0.258797866228907 0.269862440457951 0.281191437479109 0.292766561416618 0.304565228323001 0.316559994000024 0.328717915429079 0.340999838510026 0.35335960402337 0.365743162863116 0.378087590628083 0.390319990597965 0.402356272946372 0.41409979674452 0.425439859873037 0.436250020370921 0.446386230994113 0.455684766813465 0.463959923533669 0.471001461839129 0.47657177044592 0.480402717634298 0.482192157824529 0.48160005620755 0.478244190515546 0.471695384676233 0.461472224294821 0.447035198600957 0.427780207631019 0.403031366929837 0.372033034885134 0.333940979880472 0.287812595688615 0.23259606383883 0.167118350981469 0.0900719174334327          0;          0 0.000829953731647113 0.00170183740072981 0.00261773531114629 0.00357983174370102 0.00459041535765096 0.00565188374174022 0.00676674811437528 0.00793763817173246 0.00916730708159602 0.0104586366195831 0.0118146424431032 0.013238479496903 0.0147334475423455 0.0163029968006303 0.0179507336979676 0.0196804266982239 0.0214960122057461 0.0234016005178915 0.0254014818032093 0.0275001320771908 0.0297022191429716 0.0320126084592789 0.0344363688922111 0.0369787783010323 0.039645328901001 0.0424417323382318 0.045373924402622 0.0484480692948572 0.0516705633523202 0.0550480381262474 0.0585873626885457 0.0622956450311669 0.0661802324036371 0.0702487104150783 0.0745089007056171 0.0789688569682145 0.0836368590754101 0.0885214050359593 0.0936312004735402 0.0989751452832471 0.104562317081091 0.110401951016755 0.116503415469897 0.122876183094883 0.12952979661729 0.136473828717275 0.14371783525917 0.151271301042708 0.159143577158132 0.167343808924205 0.175880853273695 0.184763184324041 0.193998785730347 0.203595028262095 0.213558530872388 0.223895003337413 0.234609068332063 0.245704060573209 0.257181800402432 0.269042338892544 0.281283671243927 0.293901414884305 0.306888448295543 0.320234506159265 0.333925725935268 0.347944140457825 0.362267110549789 0.376866691006768 0.391708922587147 0.406753041850915 0.421950599813138 0.437244479407605 0.452567800682722 0.46784270146431 0.482978979906548 0.497872583899504 0.512403930694857 0.526436038334274 0.53981244849942 0.552354918228954 0.563860855544066 0.574100471365863 0.582813617168449 0.589706274561044 0.594446659398326 0.596660899044001 0.595928237018334 0.591775714401841 0.583672271995441 0.571022211298137 0.553157945796837 0.529331966803234 0.498707940046586 0.460350840358152 0.413216021973598 0.356137111135367 0.287812595688615 0.206790973111677 0.111454303771581          0;          0 0.000962972317936867 0.0019745947804585 0.00303728574762472 0.00415357957992951 0.00532613174529307 0.00655772409950125 0.00785127033968864 0.00920982162946329 0.0106365723931187 0.0121348662750535 0.0137082022589999 0.0153602409399284 0.0170948109395165 0.0189159154538213 0.0208277389192451 0.0228346537799933 0.0249412273369571 0.0271522286542694 0.0294726354956231 0.0319076412577686 0.0344626618633453 0.0371433425692994 0.0399555646405134 0.042905451830849 0.0459993766054888 0.0492439660291577 0.0526461072344009 0.0562129523724719 0.0599519229364026 0.063870713331341 0.067977293551088 0.0722799108017526 0.0767870898933774 0.0815076321980399 0.0864506129480519 0.0916253766201991 0.0970415301211651 0.102708933455041 0.108637687515758 0.114838118604992 0.121320759229071 0.128096324676278 0.135175684817946 0.142569830512462 0.150289833919897 0.158346801955789 0.166751822024744 0.175515899077081 0.184649882923704 0.194164384624568 0.204069680633351 0.214375603233709 0.225091415639447 0.236225669950157 0.247786045953723 0.259779168545245 0.272210401286315 0.285083613356517 0.298400916847746 0.312162371018373 0.32636564975495 0.341005668080302 0.356074163094264 0.371559224232362 0.38744476717331 0.403709945112563 0.420328490440175 0.437267979109816 0.454489009154406 0.471944283883996 0.489577589283825 0.507322654004606 0.525101879091656 0.542824923221729 0.560387127692492 0.577667763723934 0.594528082766654 0.610809148449981 0.626329426522399 0.640882106614737 0.654232126867529 0.666112869379681 0.676222491024959 0.68421985041139 0.689719987588448 0.692289108495745 0.691439021048435 0.686620964117293 0.677218764428556 0.662541249517514 0.641813837250946 0.614169214010261 0.578637004314807 0.534132324369573 0.479443100639924 0.413216021973598 0.333940979880472 0.239933836203826 0.129317340418433          0;          0 0.00107281686147252 0.00219983330319406 0.00338374354326515 0.00462737103218417 0.00593367414238491 0.00730575205100636 0.00874685081544497 0.0102603696401274 0.0118498673316578 0.0135190689380181 0.0152718725658061 0.0171123563675649 0.0190447856890529 0.0210736203637979 0.0232035221394375 0.0254393622171286 0.0277862288816708 0.0302494351958798 0.0328345267281201 0.0355472892766939 0.0383937565489256 0.0413802177462039 0.0445132249988603 0.047799600586493 0.0512464438700803 0.0548611378518606 0.0586513552673674 0.0626250641010566 0.0667905324025008 0.0711563322639897 0.0757313428023746 0.0805247519679308 0.0855460569806555 0.0908050631695211 0.0963118809624855 0.10207692074422 0.108110885264206 0.114424759239704 0.121029795755695 0.127937499016761 0.135159602953537 0.142708045128228 0.150594935319101 0.158832518092255 0.167433128589414 0.176409140672262 0.185772906465975 0.195536686236028 0.205712567411998 0.216312371438623 0.227347546986416 0.238829047890184 0.25076719400209 0.263171512944554 0.276050560525236 0.289411717329263 0.30326095873018 0.317602595258022 0.332438979927259 0.347770178755757 0.363593600294436 0.379903579531798 0.396690911033317 0.413942325617567 0.431639904253272 0.449760422177885 0.468274615481805 0.487146361565274 0.506331763948742 0.525778130892769 0.545422836149677 0.565192048914963 0.584999318658881 0.604743998983753 0.624309492954783 0.643561300474255 0.662344846191944 0.680483064147405 0.697773712799181 0.713986391286268 0.728859224660004 0.742095182388423 0.753357990635495 0.762267594616013 0.768395122680996 0.771257298651344 0.770310243237379 0.764942599101629 0.754467907178377 0.738116154186332 0.715024402782816 0.684226406423791 0.644641100619435 0.595059850805341 0.534132324369573 0.460350840358152 0.372033034885134 0.267302663142727 0.144068339969428          0;          0 0.00116220551833023 0.00238312660454419 0.00366568196290211 0.00501293029789286 0.0064280764778321 0.00791447790779295 0.00947565111138202 0.0111152785196688 0.0128372154641854 0.014645497369314 0.0165443471375478 0.0185381827190147 0.0206316248542678 0.0228295049766327 0.0251368732573214 0.0275590067730361 0.0301014177718458 0.0327698620086657 0.0355703471166596 0.0385091409752354 0.041592780028963 0.0448280775046122 0.0482221314655167 0.0517823326335054 0.05551637189861 0.0594322474255233 0.0635382712532316 0.0678430752702119 0.0723556164319189 0.0770851810698045 0.0820413881216137 0.0872341910909645 0.0926738785199987 0.0983710727319197 0.104336726570206 0.11058211782788 0.117118841023031 0.123958796135494 0.131114173873612 0.138597436988976 0.146421297100342 0.154598686424911 0.163142723745237 0.172066673862428 0.181383899700104 0.191107806128054 0.201251774468436 0.211829086529826 0.222852836883967 0.234335831955515 0.246290474334816 0.258728630546079 0.271661480306518 0.285099345093871 0.299051493598101 0.313525921365392 0.32852910164608 0.344065704129812 0.360138277887638 0.37674689443813 0.39388874640891 0.411557696771505 0.429743773081235 0.448432600549232 0.467604767104545 0.487235112863728 0.50729193560579 0.527736102943568 0.548520060879174 0.569586727321013 0.590868257911622 0.612284670156788 0.633742310343241 0.655132146069476 0.676327865374985 0.697183761418836 0.717532379408436 0.73718189999071 0.755913230565642 0.77347677293833 0.789588832359577 0.803927629282698 0.816128871047929 0.825780836154147 0.832418918744564 0.835519575367918 0.8344936099233 0.828678725893197 0.817331267446931 0.799617062679826 0.774601273058249 0.741237142974719 0.698353532078201 0.644641100619436 0.578637004314808 0.498707940046587 0.403031366929838 0.289574708718169 0.156072323005182          0;          0 0.00123357276563482 0.00252946663052257 0.00389077952702508 0.00532075798468994 0.00682280367233499 0.00840048016231992 0.0100575199164877 0.0117978314919799 0.0136255069636537 0.0155448295581306 0.0175602814925617 0.0196765520089716 0.0218985455925083 0.0242313903590473 0.0266804465943305 0.0292513154231155 0.0319498475826323 0.0347821522699182 0.0377546060272798 0.0408738616241405 0.0441468568867955 0.0475808234200313 0.0511832951560819 0.0549621166568798 0.0589254510849093 0.0630817877460502 0.0674399490944713 0.0720090970747457 0.0767987386597259 0.0818187304241664 0.0870792819733821 0.0925909580231586 0.0983646789014276 0.104411719213588 0.110743704381485 0.117372604730598 0.124310726760526 0.131570701190025 0.139165467319042 0.147108253196066 0.155412551018868 0.164092087129894 0.173160785893315 0.182632726658375 0.192522092922218 0.202843112703929 0.213609989028983 0.224836819298468 0.236537502179032 0.248725630496073 0.261414368442522 0.274616311227108 0.288343325076987 0.302606365278153 0.317415269680567 0.332778524810806 0.348703001420378 0.365193655949332 0.382253193998847 0.399881691479219 0.418076168626494 0.436830111557316 0.456132935451726 0.475969382811992 0.496318849535252 0.517154630751739 0.538443077510553 0.560142654432367 0.582202887383505 0.60456318904745 0.627151548966199 0.649883073181642 0.672658357011674 0.695361672730907 0.717858951973636 0.739995540517432 0.761593700717482 0.782449834220356 0.80233139466462 0.820973456844938 0.83807490524358 0.853294200882223 0.866244681077963 0.876489341856199 0.883535047431008 0.886826105256693 0.885737138622994 0.87956518154507 0.867520912715063 0.848718936454467 0.822167008846721 0.786754096439222 0.741237142974719 0.684226406423791 0.614169214010261 0.529331966803234 0.427780207631019 0.307356546374503 0.165656214922436          0;          0 0.00128909761704063 0.00264332149397965 0.00406590900548732 0.00556025281198873 0.00712990769621677 0.00877859763195314 0.0105102230844168 0.0123288685404234 0.0142388102648954 0.0162445242785305 0.0183506945494007 0.0205622213889329 0.0228842300400744 0.0253220794424351 0.027881371155784 0.0305679584194102 0.0333879553204851 0.0363477460396279 0.0394539941363151 0.0427136518305125 0.0461339692298696 0.049722503443912 0.0534871275177981 0.0574360391082657 0.0615777688132651 0.0659211880543164 0.0704755163967042 0.0752503281770588 0.0802555582905002 0.0855015069701257 0.0909988433699963 0.0967586077386677 0.102792211943446 0.109111438075634 0.115728434833723 0.122655711344439 0.1299061280403 0.13749288416654 0.145429501439262 0.153729803320089 0.162407889309658 0.171478103592464 0.180954997287964 0.190853283476785 0.201187784075298 0.21197336752581 0.22322487615202 0.234957041898938 0.247184389031819 0.259921122208314 0.273180998160263 0.286977179024518 0.301322065143867 0.316227104917193 0.331702579009968 0.34775735593931 0.36439861571895 0.381631537885301 0.399458949822469 0.41788093085758 0.436894367103299 0.456492451477184 0.476664122721591 0.497393436577278 0.518658861521627 0.540432490660993 0.562679160457695 0.585355465966358 0.6084086611413 0.631775431545369 0.655380525428202 0.679135227634803 0.702935659138014 0.726660883144174 0.750170796681196 0.773303784321801 0.795874108198899 0.81766900570979 0.838445463253063 0.857926630965941 0.875797839696208 0.891702177314034 0.905235576903371 0.915941364323879 0.923304207051833 0.926743400035678 0.925605417476687 0.919155651898785 0.906569253527897 0.886920973776263 0.859173906428058 0.822167008846721 0.774601273058248 0.715024402782816 0.641813837250946 0.553157945796837 0.447035198600957 0.321191098369712 0.173112634984762          0;          0 0.00133072909366117 0.00272868770327403 0.00419721775469731 0.00573982147450632 0.0073601684473328 0.00906210291289127 0.010849651302134 0.0127270300105971 0.014698653405408 0.0167691420605926 0.0189433312132228 0.0212262794305457 0.0236232774755041 0.0261398573549498 0.0287818015313247 0.0315551522745946 0.0344662211267034 0.0375215984457257 0.0407281629911484 0.0440930915052534 0.0476238682383055 0.0513282943570874 0.0552144971671726 0.0592909390690627 0.0635664261568257 0.0680501163550154 0.0727515269752711 0.0776805415579376 0.0828474158461053 0.0882627827194513 0.0939376558929387 0.0998834321605417 0.106111891936433 0.112635197815185 0.119465890838158 0.126616884114996 0.134101453406574 0.141933224228459 0.150126154981299 0.158694515556151 0.167652860797782 0.177015998136892 0.186798948622122 0.197016900493825 0.207685154342956 0.218819058788964 0.230433935489187 0.242544992157587 0.255167222121344 0.268315288778291 0.282003393134659 0.296245122399214 0.311053277384479 0.326439676215993 0.342414931573871 0.358988198384464 0.376166888540436 0.3939563488516 0.412359498012587 0.431376417912396 0.451003894100534 0.471234899659467 0.49205801610764 0.513456784265108 0.535408977247574 0.557885786906768 0.580850914096676 0.604259552106884 0.628057251455341 0.652178652961752 0.676546074616446 0.70106793620374 0.725637003917728 0.750128435304519 0.774397602759033 0.798277671475107 0.82157690517128 0.844075670065197 0.865523104418167 0.88563341748626 0.904081777860126 0.920499746913578 0.93447020836786 0.945521739766799 0.953122365895201 0.956672627800753 0.955497894034039 0.948839832931179 0.935846956150442 0.915564134151347 0.886920973776263 0.848718936454467 0.799617062679825 0.738116154186332 0.662541249517514 0.571022211298137 0.461472224294821 0.331563982103064 0.178703316808092          0;          0 0.0013602092145276 0.00278913730468609 0.00429020023122133 0.00586697780679527 0.00752322090966956 0.00926285894238561 0.0110900075348707 0.0130089764899897 0.0150242779679348 0.0171406349039725 0.0193629896519229 0.0216965128432949 0.0241466124492086 0.0267189430290557 0.0294194151462511 0.0322542049273431 0.0352297637361377 0.0383528279292852 0.0416304286539086 0.0450699016412466 0.0486788969428553 0.0524653885475746 0.0564376838081056 0.0606044325955557 0.0649746360885664 0.0695576550904923 0.0743632177534048 0.0794014265712779 0.084682764486372 0.0902180999323768 0.0960186906150499 0.102096185805647 0.108462626894098 0.115130445917313 0.12211246174286 0.129421873549149 0.137072251199769 0.145077522061239 0.153451953759684 0.162210132312198 0.171366935002264 0.180937497294928 0.190937173005531 0.201381486844986 0.212286078363748 0.223666636204761 0.235538821451556 0.24791817872006 0.260820033490029 0.274259374002829 0.288250715864697 0.302807947286727 0.317944152662455 0.333671411928608 0.350000572871826 0.366940993230843 0.384500249096647 0.402683805728858 0.421494646480999 0.440932855056185 0.460995145793043 0.481674336104204 0.502958754550382 0.524831577325487 0.547270085145052 0.570244831663521 0.593718713586828 0.617645931585365 0.641970829938095 0.666626601539264 0.691533843461663 0.71659894668011 0.741712301799577 0.76674630068633 0.791553111747867 0.815962204226479 0.839777594237811 0.862774782373225 0.884697349463589 0.905253173539695 0.924110227084996 0.940891909319727 0.955171863437989 0.966468223392155 0.974237228928502 0.977866141064654 0.976665382997733 0.969859823469398 0.956579110810026 0.935846956150442 0.906569253527897 0.867520912715063 0.81733126744693 0.754467907178377 0.677218764428556 0.583672271995441 0.471695384676233 0.338909238409484 0.18266219574433          0;          0 0.0013790937453841 0.00282786042825472 0.00434976343501508 0.0059484322788305 0.00762766991346361 0.00939146029550731 0.0112439761944373 0.0131895872484765 0.0152328682626128 0.0173786077432143 0.019631816661511 0.0219977374357264 0.0244818531188105 0.0270898967755059 0.0298278610288224 0.032702007751862 0.0357188778762542 0.0388853012831846 0.04220840673705 0.0456956318150706 0.0493547327786658 0.0531937943239381 0.0572212391391239 0.0614458371862374 0.0658767146122223 0.0705233621816019 0.0753956431077208 0.0805038001430198 0.0858584617701987 0.0914706473153756 0.0973517707812139 0.103513643172194 0.109968473055469 0.11672886506874 0.123807816050945 0.131218708431931 0.138975300473149 0.147091712902389 0.155582411431059 0.164462184581929 0.173746116187974 0.183449551848205 0.193588058543406 0.204177376522569 0.215233362468611 0.226771922838512 0.23880893614722 0.251360162825094 0.264441141123935 0.278067067375086 0.292252658712911 0.307011996166159 0.322358345786181 0.338303955222093 0.354859822866309 0.372035436376185 0.389838477025737 0.408274485951782 0.427346487927377 0.447054567817734 0.467395394344842 0.488361685201528 0.50994160690751 0.532118102082569 0.554868136017945 0.578161853548311 0.601961636254209 0.626221048948809 0.650883663212163 0.675881744418811 0.701134787247137 0.7265478830465 0.752009900654501 0.777391460283667 0.802542677914384 0.827290655216866 0.851436687354957 0.874753158071549 0.89698008818949 0.91782130004999 0.936940156416309 0.953954827953422 0.968433038509954 0.979886232027547 0.98776309893052 0.991442393245001 0.990224964394994 0.983324919549594 0.969859823469398 0.948839832931179 0.919155651898785 0.87956518154507 0.828678725893196 0.764942599101629 0.686620964117293 0.591775714401841 0.478244190515546 0.343614501321939 0.185198195232502          0;          0 0.00138877092176799 0.00284770367984284 0.00438028596339993 0.00599017275409736 0.00768119369123272 0.00945736068704063 0.0113228757915489 0.0132821393049712 0.0153397581339528 0.0175005543860735 0.0197695741948227 0.0221520967647601 0.0246536436237187 0.0272799880656705 0.0300371647641894 0.0329314795322841 0.0359695191996596 0.0391581615731524 0.0425045854400894 0.0460162805675778 0.0497010576431486 0.0535670580936595 0.0576227637098122 0.0618770059929248 0.066338975128614 0.0710182284786182 0.0759246984669903 0.0810686997201264 0.0864609353013716 0.0921125018600595 0.0980348934915354 0.104240004078745 0.110740127857028 0.117547957911516 0.124676582280681 0.132139477299612 0.139950497772234 0.148123863512259 0.156674141737783 0.165616224743453 0.174965302206325 0.18473682740632 0.194946476558577 0.205610100362281 0.21674366676756 0.228363193847875 0.240484671538583 0.253123970861846 0.26629673910223 0.280018279224569 0.294303411634163 0.309166316167113 0.324620351963378 0.3406778526145 0.357349893689216 0.374646029420292 0.392573994981665 0.411139370392613 0.430345201651192 0.450191574218117 0.470675133439616 0.491788545908168 0.513519895107313 0.535852003964258 0.558761676134431 0.582218846957173 0.606185634042515 0.630615276365378 0.655450949544496 0.680624443656833 0.706054688470519 0.731646109355711 0.757286795336553 0.782846458760513 0.808174163863598 0.833095799078969 0.857411265247744 0.880891348917067 0.903274246621651 0.924261702407847 0.943514716836977 0.960648781256648 0.975228586210043 0.986762147414169 0.994694286723841 0.998399398848147 0.997173427233187 0.990224964394994 0.976665382997733 0.955497894034039 0.925605417476687 0.885737138622994 0.834493609923299 0.770310243237379 0.691439021048435 0.595928237018334 0.48160005620755 0.34602566310734 0.186497741117067          0;          0 0.00139047834164428 0.00285120477983604 0.00438567129167872 0.0059975373524357 0.00769063730974208 0.00946898800826491 0.0113367966642287 0.0132984689877818 0.0153586175495159 0.017522070385535 0.0197938798332812 0.0221793315878147 0.0246839539653931 0.0273135273579457 0.0300740938583561 0.0329719670322943 0.0360137418076215 0.0392063044470714 0.0425568425639076 0.0460728551335071 0.0497621624462249 0.0536329159383697 0.0576936078285527 0.0619530804759528 0.0664205353650304 0.0711055416077909 0.0760180438396736 0.0811683693683584 0.0865672344160367 0.0922257492747813 0.0981554221713156 0.104368161611481 0.110876276945724 0.11769247686465 0.124829865497774 0.132301935748625 0.140122559454869 0.148305973912721 0.156866764249899 0.16581984107033 0.175180412725969 0.184963951495723 0.195186152867803 0.205862887028982 0.217010141561134 0.228643954231087 0.240780334632973 0.25343517330153 0.266624136758826 0.280362546783876 0.294665242002879 0.309546419685289 0.325019455395416 0.341096697888296 0.357789236349487 0.375106636758176 0.393056643798285 0.411644844349428 0.430874288154553 0.450745060779444 0.471253803445961 0.492393173730551 0.514151240466029 0.536510805461308 0.559448643853146 0.582934654017982 0.606930906991469 0.631390584258338 0.656256791574774 0.681461235157272 0.70692274510243 0.732545629276489 0.758217839115009 0.783808926783729 0.809167770951175 0.834120045989607 0.858465406728888 0.88197435791043 0.904384774195532 0.925398032940733 0.944674717925604 0.961829847764843 0.976427577811844 0.987975318915142 0.995917210367595 0.999626877729908 0.998399398848147 0.991442393245 0.977866141064654 0.956672627800753 0.926743400035678 0.886826105256693 0.835519575367917 0.771257298651344 0.692289108495745 0.596660899044001 0.482192157824529 0.346451083229289 0.186727030156085          0;          0 0.00138531820416007 0.00284062381052573 0.00436939583729166 0.00597528017921812 0.0076620969544766 0.00943384810101455 0.0112947252218581 0.0132491176773361 0.0153016209205506 0.0174570450705125 0.0197204237151766 0.0220970229341138 0.0245923505277122 0.0272121654365661 0.0299624873310378 0.0328496063468266 0.0358800929376733 0.0390608078110321 0.0423989119065598 0.0459018763705456 0.04957749247184 0.0534338813963473 0.0574795038476137 0.0617231693703628 0.0661740453018675 0.0708416652426605 0.0757359369231216 0.0808671493257544 0.086245978904292 0.0918834947199353 0.0977911622917795 0.103980845932581 0.110464809312146 0.117255713958468 0.124366615370956 0.131810956380271 0.139602557344968 0.147755602725915 0.156284623524661 0.165204475011106 0.174530309098222 0.184277540646481 0.194461806897321 0.205098919142427 0.216204805632924 0.227795444618653 0.239886786281309 0.252494662185028 0.265634680712601 0.279322106783122 0.293571723955877 0.308397676813514 0.323813291282927 0.339830870292281 0.356461461874588 0.37371459650919 0.391597990139082 0.410117208910678 0.429275291249171 0.449072322402806 0.469504956058045 0.490565877039448 0.512243198457014 0.534519785943038 0.557372500822953 0.580771353181891 0.604678554811866 0.629047460943553 0.653821388470638 0.6789322970514 0.704299318008174 0.729827114325688 0.755404053257554 0.780900171068214 0.806164907245319 0.831024583092605 0.855279596931287 0.878701305171625 0.901028555235689 0.921963832684189 0.941168980887951 0.95826044714763 0.972804004258783 0.98430889109392 0.992221309773909 0.995917210367596 0.994694286723841 0.987763098930519 0.974237228928502 0.953122365895201 0.923304207051833 0.883535047431008 0.832418918744563 0.768395122680996 0.689719987588448 0.594446659398326 0.480402717634298 0.345165385230639 0.186034076430186          0;          0 0.00137427105416606 0.00281797139953654 0.0043345523110514 0.00592763060946741 0.0076009959496168 0.00935861835619516 0.0112046560065022 0.0131434632581346 0.015179598917986 0.0173178347470164 0.0195631641930879 0.021920811341686 0.0243962400715231 0.0269951633988127 0.0297235529903603 0.0325876488214957 0.0355939689502088 0.0387493193735888 0.0420608039267412 0.0455358341776767 0.0491821392641664 0.0530077756101279 0.0570211364496548 0.0612309610762016 0.0656463437225734 0.0702767419640874 0.0751319845224283 0.0802222783311288 0.0855582147050815 0.0911507744358181 0.0970113316112313 0.103151655932716 0.109583913274062 0.116320664194548 0.123374860083164 0.130759836571396 0.13848930380805 0.146577333140727 0.155038339694238 0.163887060275886 0.173138525970476 0.182808028713457 0.192911081047874 0.203463368179066 0.214480691339125 0.225978901360146 0.237973821229906 0.250481156264534 0.26351639037856 0.277094666761754 0.291230651082654 0.30593837512865 0.321231058559706 0.337120906194906 0.353618877965283 0.370734428349853 0.388475211761213 0.406846749958824 0.425852057138112 0.445491217867513 0.465760912518496 0.486653884250121 0.508158340963788 0.530257284928941 0.552927761989205 0.576140021382772 0.59985657624181 0.62403115376335 0.648607522857643 0.673518185767234 0.69868291869764 0.724007144893798 0.749380121819016 0.774672922126972 0.799736185942515 0.824397619561364 0.848459213018232 0.871694146030127 0.893843348567153 0.914611678703876 0.93366367642407 0.95061884765 0.965046427900118 0.976459569596738 0.98430889109392 0.987975318915142 0.986762147414168 0.979886232027547 0.966468223392155 0.945521739766799 0.915941364323879 0.876489341856199 0.825780836154146 0.762267594616013 0.68421985041139 0.589706274561044 0.47657177044592 0.342412881313537 0.184550557091344          0;          0 0.00135820817684976 0.0027850341352797 0.00428388881073068 0.00585834674951301 0.00751215331187786 0.00924923211972462 0.0110736927483747 0.0129898386604348 0.0150021753781457 0.0171154188887459 0.0193345042752357 0.0216645945624794 0.0241110897657957 0.026679636126013 0.0293761355113692 0.032206754962559 0.0351779363526261 0.0382964061281986 0.041569185092704 0.0450035981856036 0.0486072842042722 0.0523882054068159 0.0563546569247822 0.0605152759042375 0.0648790502819652 0.0694553270904085 0.074253820170312 0.079284617153619 0.0845581855608721 0.0900853778369377 0.0958774351260815 0.101945989562026 0.108303064820312 0.114961074648771 0.121932819056815 0.129231477805214 0.136870600794591 0.14486409490257 0.153226206765816 0.161971500943569 0.17111483283297 0.180671315632906 0.190656280571336 0.201085229520383 0.211973779022772 0.223337594641492 0.235192314420664 0.247553460108142 0.260436334637989 0.273855904201994 0.287826663052123 0.302362478968179 0.317476417094918 0.333180539597972 0.349485678305533 0.366401177189931 0.383934601196778 0.402091407545613 0.420874575201076 0.440284187743141 0.460316964344057 0.480965732982936 0.502218839390636 0.524059484510991 0.546464982482437 0.569405930278672 0.59284527918921 0.616737297260979 0.641026410649459 0.665645910530497 0.690516510788506 0.715544740108877 0.740621150345694 0.765618321092727 0.790388638236218 0.814761821890504 0.838542176488006 0.861505532886765 0.883395849142276 0.903921433033243 0.922750745497073 0.939507739780796 0.953766686302636 0.965046427900118 0.972804004258783 0.976427577811844 0.975228586210043 0.968433038509954 0.955171863437989 0.93447020836786 0.905235576903372 0.866244681077963 0.816128871047928 0.753357990635495 0.676222491024959 0.582813617168449 0.471001461839129 0.338410660581764 0.182393476835432          0;          0 0.00133790277298385 0.00274339748203235 0.00421984406862031 0.00577076363908637 0.00739984556001753 0.00911095479461223 0.0109081394794611 0.0127956387397975 0.0147778907396692 0.0168595409616403 0.0190454507085237 0.0213407058172337 0.023750625572098 0.0262807718018482 0.0289369581409594 0.0317252594319976 0.0346520212410957 0.037723869453556 0.0409477199108039 0.0443307880434225 0.047880598447688 0.0516049943448247 0.0555121468529929 0.0596105639917068 0.063909099326827 0.0684169601513427 0.0731437150827091 0.0780993009413486 0.0832940287568949 0.0887385887286327 0.0944440539441347 0.100421882635083 0.106683918721374 0.113242390363556 0.120109906209095 0.127299448979478 0.134824366002403 0.14269835624571 0.150935453356838 0.159550004152808 0.168556641940482 0.177970253974287 0.187805942278164 0.198078976969061 0.208804741120185 0.219998666092148 0.231676156138105 0.24385250095359 0.256542774691643 0.269761719797374 0.283523613831637 0.297842117248971 0.312730099868374 0.328199443524401 0.344260818107883 0.360923427897446 0.378194724741697 0.396080084273975 0.414582440922976 0.433701877019144 0.453435160783564 0.473775227418072 0.494710596886495 0.516224721280926 0.538295253896633 0.560893231286704 0.583982158624102 0.607516987654906 0.631442975371414 0.655694410255802 0.6801931915311 0.704847245292038 0.729548759657924 0.754172219175578 0.778572216583068 0.802581017703046 0.826005852644278 0.848625903625104 0.870188956564212 0.890407680080169 0.908955491666143 0.925461966521173 0.939507739780796 0.950618847650001 0.958260447147631 0.961829847764843 0.960648781256648 0.953954827953422 0.940891909319728 0.920499746913578 0.891702177314034 0.853294200882223 0.803927629282698 0.742095182388423 0.666112869379682 0.574100471365863 0.463959923533669 0.333351373461596 0.179666668623865          0;          0 0.0013140400327745 0.00269446643657325 0.0041445792251901 0.00566783670275751 0.00726786243257828 0.00894845244263778 0.0107135826672457 0.0125674166228947 0.014514313314849 0.0165588353691709 0.0187057573828167 0.0209600744820693 0.0233270110768738 0.0258120297955736 0.0284208405810662 0.031159409925451 0.0340339702157876 0.0370510291585514 0.0402173792447047 0.0435401072109156 0.0470266034452878 0.0506845712779008 0.0545220360874235 0.0585473541449294 0.0627692211046982 0.0671966800390859 0.0718391289003566 0.076706327276499 0.0818084022903443 0.0871558534715306 0.0927595564088161 0.0986307649656648 0.104781111814646 0.111222607015694 0.117967634329319 0.125028944918098 0.132419648047726 0.140153198352212 0.14824337917584 0.156704281446809 0.165550277473341 0.174795988981839 0.1844562486376 0.194546054200835 0.205080514373334 0.216074785283041 0.227543996433931 0.239503164815599 0.251967095719545 0.26495026864566 0.278466706501224 0.292529826093863 0.307152267697385 0.322345701222775 0.338120606253439 0.354486022901133 0.371449270103815 0.389015627615402 0.407187977526326 0.425966400698592 0.445347722995066 0.465325005624831 0.485886973308835 0.507017373286497 0.528694257427348 0.550889178874487 0.573566293720058 0.596681357187643 0.620180602661994 0.643999490651319 0.66806131337864 0.692275639162415 0.71653657904711 0.740720856264383 0.764685657026047 0.7882662388498 0.811273270074696 0.83348987140957 0.854668327245812 0.874526431024395 0.892743425141217 0.908955491666142 0.922750745497073 0.93366367642407 0.941168980887951 0.944674717925604 0.943514716836977 0.936940156416309 0.924110227084996 0.904081777860126 0.875797839696208 0.83807490524358 0.789588832359576 0.728859224660004 0.654232126867529 0.563860855544066 0.455684766813465 0.327405741698232 0.176462146498472          0;          0 0.00128722621497176 0.00263948414508757 0.00406000646527305 0.00555218091077796 0.00711955710380455 0.00876585361198673 0.0104949652381805 0.0123109705396914 0.0142181395735252 0.0162209418624739 0.0183240545748239 0.0205323709081476 0.0228510086650014 0.0252853190053431 0.0278408953570748 0.0305235824622515 0.0333394855321339 0.0362949794793317 0.0393967181897337 0.0426516437906651 0.0460669958646871 0.0496503205505576 0.0534094794640188 0.0573526583611492 0.0614883754559039 0.0658254892910293 0.0703732060476305 0.0751410861631321 0.0801390501100198 0.0853773831683901 0.0908667390037356 0.0966181418373197 0.102642986969672 0.108953039387859 0.115560430153928 0.12247765023492 0.129717541393672 0.13729328371388 0.145218379281971 0.153506631491844 0.162172119375685 0.171229166294321 0.180692302243136 0.190576218943558 0.200895716794765 0.211665642654327 0.222900817299121 0.234615951287574 0.24682554779985 0.259543790872492 0.272784417266485 0.286560570011015 0.300884631447108 0.315768033353836 0.331221041472079 0.347252511444396 0.363869612861188 0.381077517739655 0.398879049359351 0.41727428693224 0.436260121091464 0.455829754636522 0.475972142367562 0.49667136317186 0.517905916784426 0.539647936824465 0.561862310801726 0.584505696782432 0.607525425293117 0.630858273811132 0.654429099830194 0.678149316984409 0.701915197049337 0.725605978797051 0.749081762645017 0.772181167785462 0.794718725989705 0.81648198352566 0.837228279578355 0.856681166192052 0.874526431024395 0.890407680080169 0.903921433033243 0.914611678703876 0.921963832684189 0.925398032940733 0.924261702407847 0.91782130004999 0.905253173539695 0.88563341748626 0.857926630965941 0.820973456844938 0.773476772938329 0.713986391286269 0.640882106614737 0.552354918228954 0.446386230994113 0.320724820503671 0.172861324813231          0;          0 0.00125799682766385 0.00257954867805581 0.00396781482089396 0.00542610606522464 0.00695789143103662 0.0085668050474616 0.0102566532770334 0.0120314220641743 0.0138952845045723 0.0158526086303793 0.0179079654041798 0.0200661369124104 0.0223321247463263 0.0247111585556761 0.0272087047569098 0.0298304753739734 0.0325824369854751 0.0354708197471921 0.0385021264534601 0.0416831415948767 0.0450209403628803 0.0485228975440534 0.052196696238343 0.0560503363256915 0.060092142594709 0.0643307724348606 0.0687752229800536 0.0734348375763226 0.0783193114293516 0.083438696268652 0.0888034038441065 0.0944242080470604 0.10031224542193 0.106479013805097 0.112936368795364 0.119696517724067 0.126772010752728 0.134175728681382 0.141920867000997 0.150020915668144 0.158489634018687 0.167341020169098 0.176589274178298 0.1862487541589 0.196333924433487 0.206859294728094 0.217839349280284 0.229288464611931 0.241220814575637 0.253650261127261 0.266590229103513 0.280053563091324 0.294052364262617 0.308597804812025 0.323699917373521 0.339367356502242 0.355607128986794 0.372424289402011 0.389821596918489 0.407799128949504 0.426353846733417 0.445479107415563 0.465164116602374 0.485393314706059 0.506145689673852 0.527394007894261 0.549103954185671 0.571233170791099 0.593730184216793 0.616533207550706 0.639568804567386 0.662750400455063 0.685976622373621 0.709129451252385 0.732072164245774 0.754647045062849 0.776672836951222 0.797941910422092 0.818217114824014 0.837228279578355 0.854668327245812 0.870188956564212 0.883395849142276 0.893843348567153 0.901028555235689 0.904384774195532 0.903274246621651 0.89698008818949 0.884697349463589 0.865523104418167 0.838445463253063 0.80233139466462 0.755913230565641 0.697773712799181 0.626329426522399 0.53981244849942 0.436250020370921 0.313442036880461 0.168936116831325          0;          0 0.00122682399791518 0.00251562814185004 0.0038694934156519 0.00529164858739175 0.00678547671565757 0.00835452187681921 0.0100024961127503 0.0117332865972214 0.0135509630177092 0.0154597851676805 0.017464210742472 0.019568903329679 0.0217787405824441 0.0240988225611737 0.0265344802259593 0.0290912840582993 0.031775052786557 0.0345918621848918 0.0375480539101102 0.0406502443349212 0.0439053333293847 0.0473205129348158 0.0509032758659702 0.0546614237678744 0.0586030751430715 0.0627366728531977 0.0670709910855542 0.0716151416605239 0.0763785795391497 0.081371107371736 0.0866028789077478 0.0920844010643434 0.0978265344253041 0.103840491913658 0.110137835349593 0.116730469569995 0.12363063374669 0.130850889496886 0.138404105330763 0.146303436927322 0.154562302669714 0.163194353804774 0.172213438517708 0.181633559130882 0.191468821544779 0.201733375938248 0.212441347633265 0.22360675690528 0.235243426382564 0.247364874525366 0.25998419350648 0.273113909627359 0.286765824196078 0.30095083256323 0.315678718756764 0.330957922874221 0.346795278077835 0.363195713691406 0.38016192051401 0.397693974040644 0.41578891080938 0.434440252573741 0.453637472422386 0.473365396330007 0.493603532916966 0.514325323413486 0.535497302959104 0.55707816341089 0.579017706774696 0.601255677201866 0.623720458197259 0.646327620250114 0.668978302512569 0.691557410395408 0.71393160900912 0.735947090230876 0.75742708880283 0.778169120240175 0.797941910422091 0.81648198352566 0.83348987140957 0.848625903625103 0.861505532886765 0.871694146030127 0.878701305171625 0.88197435791043 0.880891348917066 0.874753158071549 0.862774782373225 0.844075670065197 0.81766900570979 0.782449834220356 0.737181899990709 0.680483064147405 0.610809148449981 0.526436038334274 0.425439859873037 0.305675025838076 0.164749924392221          0;          0 0.00119412310903258 0.00244857428858634 0.00376635239914732 0.00515060014624931 0.00660461041334259 0.00813183280974407 0.00973588043316832 0.0114205368451009 0.0131897632558466 0.015047705914441 0.0169987036967324 0.0190472958827871 0.0211982301123198 0.0234564705040623 0.0258272059218201 0.0283158583663833 0.0309280914684073 0.0336698190528104 0.0365472137400785 0.0395667155440712 0.0427350404194012 0.0460591887041366 0.0495464533953614 0.0532044281859201 0.0570410151803638 0.0610644321965731 0.065283219546636 0.0697062461761412 0.0743427150249528 0.0792021674545684 0.0842944865671283 0.0896298992188112 0.0952189765054655 0.101072632470613 0.107202120755114 0.113619028873441 0.120335269763343 0.127363070213192 0.134714955724129 0.142403731311657 0.150442457693066 0.158844422242377 0.167623104022598 0.176792132125392 0.186365236459666 0.196356190032463 0.206778741656506 0.217646537898002 0.228973032944246 0.240771384922082 0.253054337033558 0.265834081692632 0.279122105644518 0.292929013825171 0.307264329470111 0.322136267706799 0.337551479560113 0.353514762963149 0.370028736991964 0.387093475129241 0.404706092903877 0.422860284746502 0.441545804339697 0.460747882120502 0.480446572905256 0.500616025845918 0.521223668085026 0.542229292544669 0.563584039253948 0.585229258478705 0.607095242655361 0.629099812734552 0.651146742995874 0.673124006686555 0.694901822947177 0.716330483397288 0.737237934441892 0.75742708880283 0.776672836951222 0.794718725989705 0.811273270074696 0.826005852644278 0.838542176488006 0.848459213018232 0.855279596931287 0.858465406728888 0.857411265247744 0.851436687354957 0.839777594237811 0.82157690517128 0.795874108198899 0.761593700717482 0.717532379408436 0.662344846191944 0.594528082766654 0.512403930694857 0.414099796744521 0.297527284131765 0.160358529228675          0;          0 0.00116025877666853 0.00237913477024896 0.0036595417960528 0.00500453343511411 0.00641730918746336 0.00790122083438318 0.00945977900915969 0.0110966599746401 0.0128157126045188 0.0146209655636776 0.0165166346810757 0.0185071305065943 0.0205970660408574 0.0227912646243429 0.0250947679690198 0.0275128443122716 0.0300509966689267 0.0327149711527763 0.0355107653339532 0.0384446365929118 0.0415231104254106 0.0447529886457865 0.0481413574278275 0.0516955951136022 0.0554233797105873 0.0593326959862235 0.0634318420564928 0.0677294353511068 0.0722344178222542 0.076956060246403 0.081903965449185 0.0870880702616935 0.0925186459923423 0.0982062971715103 0.104161958296217 0.110396888268719 0.116922662185817 0.123751160094394 0.130894552282857 0.138365280627182 0.146176035453645 0.154339727317454 0.162869453026669 0.171778455163312 0.181080074267563 0.190787692755506 0.20091466953504 0.211474264167168 0.222479549289691 0.233943309875984 0.245877927741544 0.258295249533672 0.271206436243096 0.284621792058659 0.29855057014489 0.313000752655108 0.327978801996689 0.343489380037361 0.359535031578375 0.376115828018506 0.393228966687839 0.410868320837676 0.429023934727587 0.447681457647063 0.466821510041163 0.486418974170273 0.506442200915914 0.526852123439271 0.547601267397339 0.568632646313359 0.589878529471933 0.611259068352789 0.632680766116449 0.654034772995127 0.675194988606005 0.696015950173053 0.716330483397288 0.735947090230877 0.754647045062849 0.772181167785462 0.7882662388498 0.802581017703045 0.814761821890504 0.824397619561364 0.831024583092606 0.834120045989607 0.833095799078969 0.827290655216866 0.815962204226479 0.798277671475107 0.773303784321801 0.739995540517432 0.697183761418836 0.643561300474255 0.577667763723934 0.497872583899504 0.402356272946372 0.289089659266289 0.155810895496329          0;          0 0.00112555022812041 0.00230796416905531 0.00355006847281979 0.0048548253741313 0.00622533866161145 0.00766485984971818 0.00917679455293637 0.0107647090605883 0.0124323371092781 0.0141835868484359 0.0160225479926512 0.0179534991524589 0.0199809153329261 0.0221094755867643 0.0243440708057047 0.0266898116305011 0.0291520364561045 0.0317363195042477 0.0344484789308171 0.0372945849299275 0.0402809677904655 0.0434142258539672 0.0467012333149518 0.0501491477961544 0.0537654176213807 0.0575577886978325 0.0615343109075918 0.0657033438943627 0.0700735621164025 0.0746539590196374 0.0794538501660765 0.0844828751315872 0.0897509979636399 0.0952685059635046 0.101046006528308 0.107094421756 0.113424980480272 0.120049207362474 0.126978908623053 0.134226153945623 0.14180325403183 0.149722733224221 0.157997296546531 0.16663979043571 0.175663156356493 0.185080376396822 0.194904409839691 0.205148119593111 0.215824187233602 0.22694501527859 0.23852261514789 0.250568479102398 0.26309343425751 0.276107476557521 0.289619582363272 0.303637495046042 0.318167483693593 0.333214070716262 0.348779724788869 0.364864515174332 0.381465723043176 0.398577404925258 0.416189902901038 0.43428929555418 0.452856783059229 0.471867999060918 0.49129224120798 0.511091611326122 0.53122005524306 0.551622291203371 0.572232614621407 0.592973565604585 0.613754444223616 0.634469656895908 0.65499687546717 0.675194988606005 0.694901822947177 0.71393160900912 0.732072164245774 0.749081762645017 0.764685657026046 0.778572216583067 0.790388638236218 0.799736185942515 0.806164907245319 0.809167770951175 0.808174163863598 0.802542677914384 0.791553111747867 0.774397602759033 0.750170796681196 0.717858951973636 0.676327865374984 0.624309492954783 0.560387127692492 0.482978979906548 0.390319990597965 0.28044168980019 0.151149892158618          0;          0 0.00109027614298972 0.00223563392332849 0.00343881140547494 0.00470267798944488 0.00603024019294183 0.0074246476298644 0.00888919918473353 0.0104273493814522 0.0120427149435056 0.0137390815412088 0.0155204107198908 0.0173908470009373 0.019354725145377 0.0214165775671489 0.023581141880301 0.0258533685610981 0.0282384287023194 0.030741721832852 0.0333688837709836 0.0361257944744996 0.0390185858447393 0.0420536494350783 0.0452376440068047 0.0485775028669477 0.0520804409132061 0.0557539613005854 0.0596058616325762 0.0636442395665437 0.0678774977083023 0.0723143476544486 0.0769638130227327 0.0818352312903585 0.0869382542373825 0.0922828467670762 0.0978792838469516 0.103738145282802 0.109870308003248 0.116286935493499 0.122999463973968 0.130019584871447 0.137359223077406 0.145030510428824 0.153045753781437 0.161417396972377 0.170157975888455 0.179280065766577 0.188796219753397 0.198718897640918 0.209060383572479 0.21983269137787 0.231047456046043 0.242715809677166 0.254848240071177 0.267454429905331 0.280543074226575 0.294121673733467 0.308196301044228 0.322771336839502 0.337849172427288 0.353429874899844 0.369510810634217 0.38608622242514 0.403146755026617 0.420678923311348 0.4386645166294 0.457079932252814 0.475895430024036 0.495074299475364 0.514571929745309 0.534334771576295 0.554299179525918 0.574390121249275 0.594519739299755 0.614585749335819 0.634469656895908 0.654034772995128 0.673124006686555 0.691557410395408 0.709129451252385 0.725605978797051 0.740720856264383 0.754172219175578 0.765618321092727 0.774672922126973 0.780900171068214 0.783808926783729 0.782846458760513 0.777391460283667 0.76674630068633 0.750128435304519 0.726660883144174 0.695361672730907 0.655132146069475 0.604743998983753 0.542824923221729 0.46784270146431 0.378087590628083 0.271652811442692 0.146412943037831          0;          0 0.00105467900776334 0.00216264125665675 0.00332653541429069 0.00454913719577279 0.00583335495705373 0.00718223547823852 0.00859896993642082 0.0100869000665049 0.0116495245072174 0.0132905053280601 0.0150136747312908 0.0168230419211196 0.0187228001301418 0.0207173337905644 0.0228112258349919 0.025009265108368 0.0273164538690992 0.0297380153533403 0.0322794013718808 0.034946299903938 0.0377446426464147 0.0406806124707013 0.0437606507318558 0.0469914643668547 0.0503800327095073 0.0539336139394289 0.0576597510710799 0.0615662773761413 0.0656613211182827 0.0699533094635147 0.07445097141162 0.0791633395744334 0.084099750604764 0.0892698440552725 0.0946835594193705 0.100351131075888 0.106283080825525 0.112490207669599 0.118983574439921 0.125774490842282 0.132874492424611 0.140295314923648 0.148048863380587 0.156147175345626 0.164602377413248 0.173426634243269 0.182632089126488 0.192230795047053 0.202234635075312 0.212655230793712 0.223503837312876 0.234791223273793 0.246527534053395 0.258722136192908 0.271383440849032 0.284518703825138 0.298133799470583 0.312232965438319 0.326818514960973 0.341890512940265 0.357446411740111 0.373480642125985 0.389984154297405 0.406943903411767 0.424342273390498 0.44215643212646 0.460357610467856 0.478910296530932 0.497771335983243 0.516888927931767 0.536201504935563 0.55563648442958 0.57510887748215 0.594519739299755 0.613754444223616 0.632680766116448 0.651146742995874 0.668978302512569 0.685976622373621 0.701915197049337 0.71653657904711 0.729548759657923 0.740621150345693 0.749380121819016 0.755404053257554 0.758217839115009 0.757286795336553 0.752009900654501 0.741712301799577 0.725637003917728 0.702935659138014 0.672658357011673 0.63374231034324 0.584999318658881 0.525101879091656 0.452567800682722 0.365743162863116 0.262783442039602 0.141632611590865          0;          0 0.00101896903181344 0.00208941720773285 0.00321390351513805 0.00439510968725307 0.00563584560710907 0.00693905489504068 0.00830782067928835 0.00974537154822345 0.0112550876814928 0.0128405071559778 0.0145053324208555 0.0162534369342133 0.0180888719515768 0.0200158734543281 0.0220388692032971 0.0241624858997457 0.0263915564325125 0.0287311271861836 0.0311864653807572 0.033763066408323 0.036466661126711 0.0393032230638175 0.0422789754793062 0.0454003982225217 0.0486742343166607 0.0521074961893917 0.0557074714591134 0.0594817281737358 0.0634381193851363 0.0675847869271123 0.071930164247558 0.0764829781265349 0.0812522490906706 0.0862472903106734 0.0914777047424228 0.0969533802428031 0.10268448235886 0.108681444452628 0.114954954783696 0.121515940126825 0.128375545452204 0.135545109140723 0.143036133145306 0.150860247441313 0.159029168033468 0.167554647702992 0.176448418585612 0.185722125568064 0.195387249376329 0.20545501810211 0.215936305773513 0.226841516420202 0.238180451910645 0.249962161647905 0.262194771998524 0.27488529309438 0.288039400387468 0.301661188049658 0.315752890990711 0.330314571914865 0.345343769445478 0.360835102914623 0.376779828935572 0.393165344346094 0.409974629523729 0.427185625424984 0.444770536981845 0.462695054693943 0.480917485374983 0.499387782038708 0.518046461832775 0.536823399737636 0.55563648442958 0.574390121249275 0.592973565604585 0.611259068352789 0.629099812734552 0.646327620250114 0.662750400455063 0.678149316984409 0.692275639162415 0.704847245292038 0.715544740108877 0.724007144893798 0.729827114325688 0.732545629276489 0.731646109355711 0.7265478830465 0.71659894668011 0.70106793620374 0.679135227634803 0.649883073181642 0.612284670156787 0.565192048914963 0.507322654004606 0.437244479407605 0.35335960402337 0.253885957282446 0.136837126787999          0;          0 0.000983327667732279 0.00201633384887382 0.0031014880228822 0.00424137812167128 0.00543871574455503 0.00669634155030518 0.0080172308259102 0.00940449923060424 0.0108614087125573 0.0123913735942654 0.0139979668211277 0.0156849263659269 0.0174561617799081 0.0193157608788569 0.0212679965499703 0.0233173336623649 0.0254684360607326 0.0277261736178866 0.0300956293177004 0.0325821063351656 0.0351911350749246 0.037928480123605 0.0408001470645163 0.0438123890956899 0.0469717133837482 0.0502848870765919 0.0537589428872668 0.0574011841495037 0.0612191892321697 0.0652208151850759 0.0694142004720911 0.0738077666291174 0.0784102186639949 0.0832305439925778 0.0882780096798246 0.0935621577264685 0.099092798110395 0.10487999925688 0.110934075572983 0.117265571638179 0.123885242595367 0.130804030233047 0.138033034190355 0.145583477650909 0.15346666681857 0.161693943387331 0.170276629127827 0.179225961613484 0.18855301999897 0.198268639641277 0.208383314218197 0.218907083848618 0.229849407552549 0.24121901820423 0.253023757927226 0.265270391653952 0.277964396321192 0.291109722895413 0.304708528113998 0.318760872487925 0.33326438073426 0.348213860389365 0.363600873891539 0.379413258910291 0.395634591133268 0.412243583095282 0.429213411940534 0.446510968241823 0.464096017151613 0.481920262220514 0.49992630117953 0.518046461832775 0.536201504935563 0.554299179525918 0.572232614621407 0.589878529471933 0.607095242655361 0.623720458197259 0.639568804567386 0.654429099830194 0.66806131337864 0.6801931915311 0.690516510788506 0.69868291869764 0.704299318008174 0.70692274510243 0.706054688470519 0.701134787247137 0.691533843461663 0.676546074616446 0.655380525428202 0.6271515489662 0.590868257911621 0.545422836149676 0.489577589283825 0.421950599813138 0.340999838510026 0.245005567833814 0.132050855857869          0;          0 0.000947910774776477 0.00194371077272931 0.00298978052911927 0.00408861476531547 0.00524282741591056 0.00645515682657053 0.00772847112222156 0.00906577374419403 0.010470209153809 0.0119450686985885 0.0134937966357753 0.0151199963061404 0.0168274364491097 0.0186200576480265 0.0205019788918566 0.0224775042367989 0.0245511295480471 0.0267275492983215 0.0290116633956994 0.0314085840086675 0.033923642351145 0.0365623953844133 0.0393306323863649 0.0422343813311789 0.0452799150143406 0.0484737568487672 0.0518226862475586 0.0553337434974496 0.0590142340142646 0.0628717318574125 0.0669140823645612 0.0711494037498966 0.0755860874896244 0.0802327972963658 0.0850984664596161 0.0901922933021773 0.095523734472167 0.101102495756494 0.106938520064227 0.113041972186647 0.119423219894508 0.126092810881684 0.133061445007312 0.140339941225267 0.147939198519492 0.155870150085799 0.164143709914231 0.172770710830188 0.181761832946136 0.191127521357824 0.200877891788193 0.211022622737285 0.221570832535926 0.232530939523046 0.243910503369415 0.255716045352258 0.267952845143409 0.280624711405848 0.293733723196914 0.307279938848136 0.321261068628066 0.335672107092035 0.350504920577268 0.365747784808635 0.381384867034592 0.397395646508821 0.413754266464693 0.430428809990055 0.447380491391437 0.464562753731347 0.481920262220514 0.499387782038708 0.516888927931767 0.534334771576295 0.551622291203371 0.568632646313359 0.585229258478705 0.601255677201866 0.616533207550706 0.630858273811132 0.643999490651319 0.655694410255802 0.665645910530496 0.673518185767234 0.6789322970514 0.681461235157272 0.680624443656833 0.675881744418811 0.666626601539264 0.652178652961752 0.631775431545369 0.60456318904745 0.569586727321012 0.525778130892769 0.471944283883996 0.406753041850915 0.328717915429078 0.23618110753 0.127294729105709          0;          0 0.00091285146045087 0.00187182091900837 0.00287920086474138 0.0039373937495534 0.00504891682936547 0.00621640716971892 0.00744262681541511 0.00873046812286328 0.0100829592527149 0.0115032698191069 0.0129947166903965 0.0145607699346246 0.0162050589010725 0.0179313784271399 0.0197436951573605 0.0216461539586265 0.0236430844126 0.025739007362796 0.0279386414898788 0.030246909884284 0.0326689465802918 0.0352101030100793 0.0378759543300008 0.0406723055643046 0.043605197503614 0.0466809122866778 0.0499059785840352 0.0532871762912196 0.0568315406268211 0.060546365516995 0.0644392061326902 0.0685178804287957 0.0727904695153837 0.0772653166700386 0.081951024776681 0.0868564519500479 0.0919907050758029 0.0973631309637832 0.102983304775815 0.108861015349425 0.115006246994243 0.121429157288398 0.128140050347323 0.135149344976359 0.142467537050936 0.150105155392995 0.158072710329053 0.166380634022925 0.175039211573719 0.184058501756124 0.193448246154164 0.203217765300038 0.213375840275082 0.223930578058551 0.234889258720137 0.246258162341887 0.258042373322325 0.27024555945768 0.282869722909524 0.295914919851944 0.309378945241223 0.323256978763471 0.337541187586588 0.352220281068081 0.367279012044655 0.382697618747858 0.398451200746333 0.414509021603013 0.430833730147441 0.447380491391437 0.464096017151613 0.480917485374983 0.497771335983243 0.514571929745309 0.53122005524306 0.547601267397339 0.563584039253948 0.579017706774696 0.593730184216793 0.607525425293117 0.620180602661994 0.631442975371413 0.641026410649459 0.648607522857643 0.653821388470638 0.656256791574774 0.655450949544496 0.650883663212163 0.641970829938095 0.628057251455341 0.6084086611413 0.582202887383505 0.548520060879173 0.506331763948742 0.454489009154406 0.391708922587147 0.316559994000024 0.227445741389008 0.122586621509019          0;          0 0.000878262631876292 0.00180089580611222 0.00277010514713894 0.0037882020756236 0.00485760846621516 0.00598086146347993 0.00716061845565874 0.00839966220496686 0.00970090613210714 0.0110673997514579 0.0125023342520123 0.0140090482175625 0.0155910334778198 0.0172519410801087 0.0189955873689484 0.020825960158198 0.022747224977465 0.0247637313711118 0.0268800192244089 0.0291008250871129 0.0314310884599579 0.0338759580041576 0.0364407976279763 0.0391311923976545 0.0419529542123909 0.0449121271745947 0.0480149925771363 0.0512680734187216 0.0546781383466742 0.0582522049132022 0.0619975420164881 0.0659216713815159 0.0700323679172473 0.0743376587663743 0.0788458208411889 0.0835653766138564 0.0885050879012957 0.0936739473536401 0.0990811673205327 0.104736165730938 0.110648548579295 0.116828088563231 0.123284699365234 0.130028405011992 0.137069303680018 0.144417525243963 0.152083181783861 0.160076310178708 0.168406805815215 0.177084346331328 0.186118304192988 0.195517646768377 0.205290822415127 0.215445630931175 0.225989076537301 0.236927201357142 0.248264897136424 0.260005692695013 0.272151514330635 0.284702416088885 0.297656276477296 0.311008457828353 0.324751424103573 0.338874312473873 0.35336245350579 0.368196834223472 0.383353497697095 0.398802872123051 0.414509021603013 0.430428809990055 0.446510968241823 0.462695054693942 0.478910296530932 0.495074299475364 0.511091611326122 0.52685212343927 0.542229292544669 0.557078163410889 0.571233170791099 0.584505696782431 0.596681357187643 0.607516987654906 0.616737297260978 0.62403115376335 0.629047460943553 0.631390584258338 0.630615276365377 0.626221048948809 0.617645931585365 0.604259552106884 0.585355465966357 0.560142654432367 0.527736102943567 0.487146361565274 0.437267979109816 0.376866691006768 0.304565228323001 0.218827601308434 0.117941695340178          0;          0 0.000844239285524875 0.00173113022628416 0.00266279300219478 0.00364144949092949 0.00466942774522452 0.00574916662224879 0.00688322056468079 0.00807426453226393 0.00932509908160091 0.0106386555907859 0.0120180016241415 0.013466346430807 0.0149870465691896 0.0165836116473184 0.0182597101669073 0.0200191754563949 0.0218660116753705 0.0238043998695622 0.0258387040519177 0.0279734772812115 0.0302134677050015 0.0325636245285784 0.0350291038657473 0.0376152744207675 0.0403277229434892 0.0431722593915653 0.0461549217245001 0.0492819802440997 0.0525599413845136 0.0559955508423562 0.0595957959232299 0.0633679069651864 0.0673193576820652 0.0714578642500592 0.0757913829390428 0.0803281060659272 0.0850764560203112 0.0900450770826729 0.0952428247219784 0.100678752022501 0.106362092848448 0.112302241309239 0.118508727037489 0.124991185735346 0.131759324382265 0.138822880427876 0.14619157421654 0.153875053804824 0.161882831238332 0.170224209249356 0.178908197220353 0.187943415129256 0.197337984049597 0.207099401620006 0.217234400722119 0.227748789411475 0.238647269930624 0.249933234395149 0.261608534479207 0.273673222134699 0.286125258054453 0.298960184231299 0.312170756568183 0.325746533055244 0.339673412543715 0.353933118608568 0.368502622396491 0.383353497697095 0.398451200746333 0.413754266464693 0.429213411940534 0.444770536981845 0.460357610467856 0.475895430024036 0.49129224120798 0.506442200915914 0.521223668085026 0.535497302959104 0.549103954185671 0.561862310801726 0.573566293720058 0.583982158624102 0.59284527918921 0.59985657624181 0.604678554811866 0.606930906991469 0.606185634042515 0.601961636254208 0.593718713586828 0.580850914096676 0.562679160457695 0.538443077510553 0.507291935605789 0.468274615481805 0.420328490440175 0.362267110549789 0.292766561416618 0.210350356575089 0.113372707654502          0;          0 0.000810860561139207 0.0016626864572135 0.00255751404249666 0.00349747734818978 0.00448481238270945 0.00552186157802544 0.00661107838170787 0.00775503199350349 0.00895641224428999 0.0102180346141417 0.0115428453849606 0.0129339269216671 0.0143945030742761 0.0159279446912958 0.0175377752327323 0.0192276764685553 0.0210014942457271 0.0228632443037935 0.0248171181155376 0.0268674887252564 0.0290189165527965 0.0312761551265095 0.0336441567027107 0.0361280777229718 0.0387332840535773 0.0414653559436386 0.0443300926295992 0.0473335165040772 0.0504818767560596 0.053781652377268 0.0572395544159075 0.0608625273438477 0.0646577493863877 0.0686326316449356 0.0727948158219866 0.0771521703344713 0.0817127845756143 0.0864849610566103 0.0914772051273739 0.0966982119400022 0.102156850279022 0.107862142838551 0.113823242477716 0.120049403931501 0.126549950394104 0.133334234325194 0.140411591755469 0.147791289285873 0.15548246288386 0.163494047479201 0.171834696250018 0.180512688365812 0.189535823816886 0.198911303807413 0.208645595020805 0.218744275879262 0.22921186271257 0.240051613522096 0.251265306772277 0.262852992360989 0.274812711609235 0.287140182766263 0.299828448145191 0.312867478582343 0.32624373044667 0.339939649908932 0.353933118608568 0.368196834223472 0.382697618747857 0.39739564650882 0.412243583095282 0.427185625424984 0.44215643212646 0.457079932252814 0.471867999060917 0.486418974170273 0.500616025845918 0.514325323413486 0.527394007894261 0.539647936824465 0.550889178874487 0.560893231286703 0.569405930278672 0.576140021382772 0.580771353181891 0.582934654017982 0.582218846957172 0.57816185354831 0.570244831663521 0.557885786906767 0.540432490660992 0.517154630751739 0.487235112863728 0.449760422177885 0.403709945112563 0.347944140457825 0.281191437479108 0.202033725618758 0.108890286110587          0;          0 0.000778191583150136 0.00159569803790116 0.00245447367530495 0.00335656654800884 0.0043041225772884 0.00529938982024533 0.00634472287684449 0.00744258743565698 0.00859556495624496 0.00980635748505307 0.011077792600444 0.0124128284811133 0.0138145590905208 0.0152862194681576 0.0168311911164072 0.0184530074694247 0.0201553594278154 0.021942100939921 0.0238172546071563 0.0257850172870675 0.0278497656635263 0.0300160617487095 0.0322886582761533 0.0346725039381758 0.03717274841424 0.0397947471293086 0.0425440656728372 0.0454264837996569 0.0484479989235088 0.0516148290022843 0.0549334147009726 0.0584104207037591 0.0620527360305043 0.0658674731947696 0.069861966020455 0.0740437659117371 0.0784206363461136 0.0830005453326854 0.0877916555470499 0.0928023118199961 0.0980410256192191 0.103516456121101 0.109237387422779 0.115212701392745 0.121451345600532 0.127962295702061 0.134754511586191 0.141836886509305 0.14921818835742 0.156906992078531 0.164911602220554 0.173239964391316 0.181899564325223 0.19089731309521 0.200239416846749 0.209931229251498 0.219977084679623 0.230380109870005 0.241142011634049 0.252262837859285 0.263740708780456 0.275571515155411 0.287748579617375 0.300262277070331 0.313099609546202 0.32624373044667 0.339673412543715 0.35336245350579 0.367279012044655 0.381384867034592 0.395634591133268 0.409974629523729 0.424342273390498 0.4386645166294 0.452856783059229 0.466821510041163 0.480446572905255 0.493603532916966 0.506145689673852 0.517905916784426 0.528694257427348 0.538295253896632 0.546464982482437 0.552927761989205 0.557372500822953 0.559448643853146 0.558761676134431 0.554868136017945 0.547270085145052 0.535408977247574 0.518658861521627 0.496318849535252 0.467604767104545 0.431639904253272 0.38744476717331 0.333925725935268 0.269862440457951 0.193893934819196 0.104503176253903          0;          0 0.000746285110646699 0.00153027315195729 0.00235383830667951 0.00321894465567679 0.00412765013574931 0.0050821106318735 0.00608458420354698 0.0071374354441526 0.00824313997136174 0.0094042890455704 0.0106235943121843 0.011903892662225 0.0132481512041947 0.0146594723383982 0.0161410989229375 0.0176964195183631 0.0193289736954264 0.0210424573875283 0.0228407282662334 0.0247278111145976 0.0267079031689804 0.0287853793954388 0.0309647976616621 0.0332509037596561 0.0356486362279388 0.0381631309147992 0.0407997252161081 0.0435639619121618 0.0464615925179782 0.0494985800502403 0.0526811011015613 0.0560155470987858 0.0595085246064926 0.0631668545195425 0.0669975699692352 0.0710079127461831 0.0752053280191453 0.0795974571025256 0.0841921279957442 0.0889973433849047 0.0940212657607719 0.0992721992666243 0.104758567844645 0.110488889199668 0.116471744043776 0.122715740023873 0.129229469666264 0.136021461596762 0.1431001242111 0.150473680877599 0.158150095651121 0.166136988363263 0.174441537827383 0.183070371756939 0.192029441840514 0.201323882244979 0.210957849627883 0.220934342529332 0.231254997780109 0.241919861304316 0.252927130408564 0.264272864332892 0.275950659487862 0.287951285414032 0.300262277070331 0.312867478582343 0.325746533055244 0.338874312473873 0.352220281068081 0.365747784808635 0.379413258910291 0.393165344346094 0.406943903411767 0.420678923311348 0.43428929555418 0.447681457647063 0.460747882120502 0.473365396330007 0.485393314706059 0.49667136317186 0.507017373286497 0.516224721280926 0.524059484510991 0.530257284928942 0.534519785943038 0.536510805461309 0.535852003964258 0.532118102082569 0.524831577325487 0.513456784265108 0.497393436577278 0.475969382811992 0.448432600549232 0.413942325617567 0.371559224232362 0.320234506159266 0.258797866228907 0.18594412961204 0.100218463090893          0;          0 0.000715183014907609 0.00146649765731035 0.00225574000172305 0.00308479227419227 0.0039556266451717 0.00487030915121391 0.00583100374517862 0.00683997647391635 0.00789959978153021 0.00901235693533448 0.0101808465705009 0.0114077873480944 0.0126960227197316 0.014048525790425 0.0154684042692812 0.0169589054955759 0.0185234215253013 0.0201654942605466 0.0218888206009829 0.0236972575932525 0.0255948275501567 0.0275857231071509 0.0296743121787346 0.0318651427718107 0.0341629476069123 0.0365726484912829 0.0390993603800734 0.0417483950532813 0.0445252643264207 0.047435682702151 0.0504855693580945 0.0536810493526975 0.0570284539160841 0.0605343196762551 0.0642053866525081 0.0680485948273908 0.0720710790856321 0.0762801622830623 0.0806833461802632 0.0852882999442773 0.0901028458868072 0.0951349420685744 0.100392661356479 0.10588416647243 0.111617680519703 0.117601452413862 0.123843716580036 0.13035264620597 0.137136299260027 0.14420255639434 0.1515590497547 0.159213081609448 0.167171531588507 0.175440751189484 0.184026444059046 0.192933530393094 0.202165993616776 0.211726707303372 0.221617240067286 0.231837635918694 0.242386167293055 0.253259057665085 0.264450170320633 0.275950659487862 0.287748579617375 0.299828448145191 0.312170756568183 0.324751424103573 0.337541187586588 0.350504920577268 0.363600873891539 0.376779828935572 0.389984154297405 0.403146755026617 0.416189902901038 0.429023934727587 0.441545804339697 0.453637472422386 0.465164116602374 0.475972142367562 0.485886973308835 0.494710596886495 0.502218839390636 0.508158340963788 0.512243198457014 0.514151240466029 0.513519895107313 0.50994160690751 0.502958754550382 0.49205801610764 0.476664122721591 0.456132935451725 0.429743773081234 0.396690911033317 0.356074163094264 0.306888448295543 0.248012234976598 0.178194742630027 0.0960417695063505          0;          0 0.000684917601656178 0.0014044377975184 0.00216028065507071 0.00295424874753244 0.00378823078622508 0.00466420537630427 0.00558424489556966 0.00655051949535558 0.00756530122168562 0.00863096825393168 0.00975000925713792 0.0109250278429359 0.0121587471325703 0.0134540144139551 0.0148138058828662 0.0162412314563206 0.0177395396438697 0.0193121224599123 0.0209625203571764 0.0226944271581952 0.0245116949578584 0.0264183389659247 0.0284185422536653 0.0305166603635291 0.0327172257348069 0.0350249518916496 0.0374447373324015 0.039981669050938 0.0426410256114641 0.0454282796879312 0.0483490999677331 0.0514093523065369 0.0546151000068285 0.0579726030768575 0.0614883163089723 0.0651688859966431 0.0690211450875701 0.0730521065459147 0.0772689546696239 0.0816790340787297 0.0862898360570834 0.0911089818928726 0.0961442028220474 0.101403316133045 0.106894196940425 0.1126247450787 0.118602846505161 0.124836328531184 0.131332908124664 0.138100132441009 0.14514531064568 0.152475435986577 0.160097096958577 0.168016376273957 0.176238736210087 0.184768888747964 0.193610648740489 0.202766768155867 0.212238749227226 0.222026634102298 0.232128768324341 0.242541535184645 0.253259057665085 0.264272864332892 0.275571515155411 0.287140182766263 0.298960184231299 0.311008457828353 0.323256978763471 0.335672107092035 0.348213860389365 0.360835102914623 0.373480642125985 0.38608622242514 0.398577404925258 0.410868320837676 0.422860284746502 0.434440252573742 0.445479107415563 0.455829754636522 0.465325005624831 0.473775227418072 0.480965732982936 0.486653884250121 0.490565877039448 0.492393173730551 0.491788545908168 0.488361685201528 0.481674336104204 0.471234899659467 0.456492451477184 0.436830111557316 0.411557696771504 0.379903579531798 0.341005668080302 0.293901414884305 0.237516749728046 0.170653823155553 0.0919774338287423          0;          0 0.000655512793530698 0.00134414262644915 0.00206753572048889 0.00282741726099146 0.00362559487332894 0.0044639622173952 0.00534450269989114 0.00626929330344959 0.0072405085308609 0.0082604244617583 0.00933142291808846 0.010455995733511 0.0116367491205249 0.0128764081275884 0.0141778211767636 0.0155439646704476 0.0169779476535325 0.0184830165148229 0.0200625597087148 0.0217201124749533 0.0234593615307085 0.0252841497051896 0.0271984804825059 0.0292065224134309 0.0313126133510636 0.0335212644590478 0.0358371639339287 0.0382651803753127 0.0408103657286594 0.0434779577156761 0.046273381656285 0.0492022515738742 0.0522703704618856 0.055483729574574 0.0588485065878435 0.0623710624572146 0.0660579367790184 0.0699158414376001 0.0739516522954074 0.0781723986540421 0.0825852501823706 0.0871975009722631 0.0920165503430872 0.0970498799723017 0.102305026880902 0.107789551748565 0.113511001973517 0.119476868825852 0.125694537969438 0.132171232546026 0.138913947924778 0.145929377120237 0.153223825770729 0.160803115446191 0.168672473918092 0.176836410873173 0.185298577385485 0.194061607276033 0.203126938284234 0.212494610748339 0.222163041240563 0.232128768324341 0.242386167293055 0.252927130408564 0.263740708780456 0.274812711609235 0.286125258054453 0.297656276477296 0.309378945241223 0.321261068628066 0.33326438073426 0.345343769445478 0.357446411740111 0.369510810634217 0.381465723043176 0.393228966687839 0.404706092903877 0.41578891080938 0.426353846733417 0.436260121091464 0.445347722995066 0.453435160783563 0.460316964344057 0.465760912518496 0.469504956058045 0.471253803445961 0.470675133439616 0.467395394344842 0.460995145793043 0.451003894100534 0.436894367103299 0.418076168626494 0.393888746408909 0.363593600294436 0.32636564975495 0.281283671243927 0.227319706411518 0.163327331744564 0.0880286686238938          0;          0 0.000626985186753148 0.00128564617500119 0.00197755754368633 0.0027043693988999 0.00346781069901262 0.0042696926927353 0.0051119124698472 0.00599645662367919 0.00692540502368851 0.00790093469559913 0.00892532380559299 0.0100009557439072 0.0111303233019054 0.0123160329352255 0.0135608091039486 0.014867498678847 0.0162390754006493 0.0176786443768546 0.0191894465979262 0.0207748634516471 0.0224384212109997 0.0241837954670834 0.0260148154742722 0.0279354683699814 0.0299499032259946 0.0320624348822469 0.0342775475071872 0.0365998978212693 0.0390343179116755 0.0415858175569415 0.044259585969632 0.0470609928534922 0.0499955886584337 0.0530691039021595 0.0562874474110398 0.0596567033148189 0.0631831266096882 0.0668731370819604 0.0707333113598011 0.0747703728329305 0.0789911791496167 0.083402706966301 0.0880120335874714 0.0928263150915217 0.0978527604918585 0.103098601430953 0.108571056847832 0.114277291996057 0.120224371118896 0.126419203010388 0.132868478604538 0.139578599639059 0.14655559733388 0.153805039906969 0.161331927619652 0.169140573899235 0.177234470926753 0.185616137900567 0.194286949990353 0.203246945778863 0.212494610748339 0.222026634102298 0.231837635918694 0.241919861304316 0.252262837859285 0.262852992360989 0.273673222134699 0.284702416088885 0.295914919851944 0.307279938848136 0.318760872487925 0.330314571914865 0.341890512940265 0.353429874899844 0.364864515174332 0.376115828018506 0.387093475129241 0.397693974040644 0.407799128949504 0.41727428693224 0.425966400698592 0.433701877019144 0.440284187743141 0.445491217867513 0.449072322402806 0.450745060779444 0.450191574218117 0.447054567817734 0.440932855056185 0.431376417912396 0.41788093085758 0.399881691479218 0.37674689443813 0.347770178755757 0.312162371018373 0.269042338892544 0.217426860289679 0.156219403505758 0.0841977025947982          0;          0 0.000599344994615263 0.00122896938574179 0.00189037833813879 0.00258514921415439 0.00331493475226994 0.0040814663535963 0.00488655747607084 0.00573210713548268 0.00662010351173621 0.00755262765793825 0.00853185730894901 0.00956007078495698 0.0106396509844068 0.0117730894592098 0.0129629905635787 0.0142120756660304 0.015523187412067 0.0168992940227513 0.0183434936118069 0.0198590185009626 0.0214492395099861 0.0231176701941801 0.024867970997987 0.0267039532887294 0.0286295832293381 0.0306489854431254 0.032766446417191 0.0349864175838085 0.0373135180110635 0.0397525366249991 0.0423084338754669 0.0449863427466751 0.0477915690009329 0.0507295905301816 0.05380605567442 0.0570267803488978 0.0603977438027868 0.0639250828107257 0.0676150840749458 0.0714741745893552 0.0755089096877178 0.079725958465581 0.0841320862295421 0.0887341335874128 0.0935389917484156 0.0985535735532517 0.1037847796992 0.109239459564759 0.114924365971101 0.120846103143037 0.127011067049544 0.133425377212323 0.1400947989693 0.147024655067546 0.154219725335456 0.161684133045988 0.16942121642988 0.177433383628441 0.18572194918798 0.194286949990353 0.203126938284234 0.212238749227226 0.221617240067286 0.231254997780109 0.24114201163405 0.251265306772277 0.261608534479207 0.272151514330635 0.282869722909524 0.293733723196914 0.304708528113998 0.315752890990711 0.326818514960973 0.337849172427288 0.348779724788869 0.359535031578375 0.370028736991964 0.38016192051401 0.389821596918489 0.398879049359351 0.407187977526327 0.414582440922976 0.420874575201076 0.425852057138112 0.429275291249171 0.430874288154553 0.430345201651193 0.427346487927377 0.421494646480999 0.412359498012587 0.399458949822469 0.382253193998847 0.360138277887638 0.332438979927259 0.298400916847746 0.257181800402432 0.207841753143105 0.149332583179228 0.0804859072821523          0;          0 0.000572596889168546 0.00117412183880981 0.00180601283984146 0.0024697768586714 0.00316699287388715 0.00389931501607941 0.00466847581055982 0.00547628952213931 0.00632465560044804 0.00721556222349009 0.00815108993622305 0.00913341537992059 0.0101648151069004 0.0112476694738627 0.0123844666055668 0.0135778064188571 0.0148304046951051 0.0161450971869443 0.0175248437427032 0.0189727324291601 0.020491983630118 0.0220859540947851 0.0237581409060096 0.025512185333998 0.0273518765362081 0.0292811550585672 0.031304116086988 0.033425012391236 0.0356482568954875 0.0379784248013031 0.0404202551791337 0.0429786519337692 0.0456586840372041 0.04846558490911 0.0514047508103072 0.0544817380981683 0.0577022591745756 0.0610721769366906 0.0645974975181643 0.0682843610832619 0.0721390304084385 0.0761678769548697 0.0803773641009879 0.0847740271658303 0.0893644498115594 0.0941552363664277 0.0991529795572121 0.104364223082211 0.109795418391644 0.115452874971056 0.121342703344393 0.127470749925856 0.133842522752706 0.140463107023688 0.147337069248732 0.154468348683675 0.161860134577705 0.169514727599441 0.177433383628441 0.185616137900567 0.194061607276033 0.202766768155867 0.211726707303372 0.220934342529332 0.230380109870005 0.240051613522096 0.24993323439515 0.260005692695013 0.27024555945768 0.280624711405848 0.291109722895413 0.301661188049658 0.312232965438319 0.322771336839503 0.333214070716262 0.343489380037362 0.353514762963149 0.363195713691406 0.372424289402011 0.381077517739655 0.389015627615402 0.396080084273975 0.402091407545613 0.406846749958824 0.410117208910678 0.411644844349428 0.411139370392613 0.408274485951782 0.402683805728858 0.3939563488516 0.381631537885301 0.365193655949332 0.344065704129812 0.317602595258022 0.285083613356517 0.24570406057321 0.198566005152799 0.142668034851645 0.0768939100947232          0;          0 0.000546740751391219 0.00112110329014861 0.00172446067339087 0.00235825181907541 0.00302398440556322 0.00372323786966084 0.00445766650291019 0.00522900264533044 0.0060390599751613 0.00688973689240534 0.00778301999310407 0.00872098763029781 0.00970581355649609 0.0107397706412087 0.0118252346556392 0.0129646881150018 0.0141607241670691 0.0154160505134631 0.0167334933478461 0.0181160012925082 0.0195666493118676 0.021088642578043 0.0226853202598986 0.0243601592027447 0.026116777461158 0.0279589376421 0.0298905500096069 0.0319156752957244 0.0340385271549895 0.0362634741915395 0.038595041478752 0.0410379114810976 0.0435969242764906 0.0462770769647369 0.0490835221335491 0.0520215652378861 0.0550966607308828 0.0583144067652017 0.061680538262019 0.0652009181208502 0.0688815263167347 0.0727284466016742 0.076747850494319 0.0809459782053803 0.0853291161057164 0.0899035702990792 0.0946756358116208 0.0996515608549406 0.104837505558104 0.11023949449605 0.11586336226641 0.12171469128319 0.127798740863175 0.134120366578295 0.140683928733535 0.147493188704024 0.154551191725474 0.161860134577705 0.16942121642988 0.177234470926753 0.185298577385485 0.193610648740489 0.202165993616776 0.210957849627884 0.219977084679624 0.22921186271257 0.238647269930624 0.248264897136425 0.258042373322326 0.267952845143409 0.277964396321192 0.288039400387468 0.298133799470583 0.308196301044228 0.318167483693594 0.32797880199669 0.337551479560113 0.346795278077835 0.355607128986794 0.363869612861188 0.371449270103815 0.378194724741698 0.383934601196778 0.388475211761213 0.391597990139082 0.393056643798286 0.392573994981665 0.389838477025737 0.384500249096648 0.376166888540436 0.364398615718951 0.348703001420379 0.32852910164608 0.303260958730181 0.272210401286315 0.234609068332063 0.189599575044212 0.136225728867585 0.0734216950491026          0;          0 0.00052177233909891 0.00106990504107084 0.00164570845862449 0.00225055579759186 0.00288588588407659 0.00355320602558212 0.00425409496590099 0.00499020593300569 0.00576326977855693 0.00657509820692712 0.00742758709081423 0.00832271986958064 0.00926257102538014 0.0102493096309178 0.0112852029613051 0.0123726201609068 0.0135140359543076 0.0147120343885268 0.0159693125913605 0.0172886845281946 0.0186730847367841 0.0201255720162935 0.0216493330433047 0.0232476858834745 0.0249240833630184 0.0266821162591565 0.0285255162630192 0.0304581586622132 0.0324840646832126 0.0346074034258943 0.0368324933137795 0.0391638029737876 0.0416059514484325 0.0441637076312853 0.0468419888030434 0.0496458581305492 0.052580520974412 0.0556513198323362 0.058863727724632 0.0622233398054676 0.065735862957961 0.0694071031029335 0.0732429499197513 0.07724935864283 0.0814323285587033 0.0857978777856419 0.0903520138702053 0.0951006996823152 0.100049814031889 0.105205106365169 0.110572144826921 0.116156256894942 0.121962461704926 0.127995393085828 0.134259212217376 0.14075750870121 0.147493188704024 0.154468348683675 0.161684133045988 0.169140573899235 0.176836410873173 0.184768888747964 0.192933530393094 0.201323882244979 0.209931229251498 0.218744275879262 0.227748789411476 0.236927201357142 0.246258162341887 0.255716045352258 0.265270391653952 0.27488529309438 0.284518703825138 0.294121673733467 0.303637495046042 0.313000752655108 0.322136267706799 0.330957922874221 0.339367356502242 0.347252511444396 0.354486022901133 0.360923427897445 0.366401177189931 0.370734428349853 0.37371459650919 0.375106636758176 0.374646029420292 0.372035436376185 0.366940993230843 0.358988198384464 0.34775735593931 0.332778524810806 0.313525921365392 0.289411717329263 0.259779168545245 0.223895003337413 0.180940991706305 0.130004608245917 0.0700686924632858          0;          0 0.00049768388095686 0.00102051115629283 0.00156973168417904 0.00214665527419451 0.00275265432672466 0.00338916656200088 0.00405769783857266 0.00475982506048759 0.00549719917185926 0.00627154823681764 0.0070846806020523 0.00793848813826153 0.0088349495557983 0.00977613378864215 0.0107642034395071 0.011801418277403 0.0128901387772789 0.0140328296894727 0.0152320636245436 0.0164905246366455 0.0178110117858841 0.0191964426570474 0.0206498568086742 0.0221744191225905 0.0237734230197433 0.0254502935033547 0.0272085899850399 0.0290520088435285 0.0309843856589153 0.0330096970578845 0.0351320620969992 0.0373557431018389 0.0396851458694006 0.0421248191296235 0.0446794531490433 0.047353877345272 0.0501530567650853 0.0530820872611997 0.0561461891831514 0.0593506993758292 0.0627010612549252 0.0662028127016001 0.0698615714887117 0.073683017917713 0.0776728743084387 0.0818368809430624 0.0861807680201072 0.0907102231240269 0.095430853660036 0.100348143641955 0.105467404152205 0.110793716717011 0.116331868755606 0.122086280168789 0.12806092002874 0.134259212217376 0.140683928733535 0.147337069248732 0.154219725335456 0.161331927619652 0.168672473918092 0.176238736210087 0.184026444059046 0.192029441840514 0.200239416846749 0.208645595020805 0.217234400722119 0.225989076537301 0.234889258720137 0.243910503369415 0.253023757927226 0.262194771998524 0.271383440849032 0.280543074226575 0.289619582363272 0.29855057014489 0.307264329470111 0.315678718756764 0.323699917373521 0.331221041472079 0.338120606253439 0.344260818107883 0.349485678305533 0.353618877965283 0.356461461874588 0.357789236349487 0.357349893689216 0.354859822866309 0.350000572871826 0.342414931573871 0.331702579009968 0.317415269680567 0.2990514935981 0.276050560525236 0.247786045953723 0.213558530872388 0.172587560183995 0.124002736683669 0.0668338587264402          0;          0 0.00047446460413023 0.000972899545892534 0.00149649637173852 0.00204650378251461 0.00262423014972026 0.00323104611722506 0.00386838728824603 0.00453775699689408 0.00524072916303134 0.00597895122852744 0.00675414717225539 0.00756812060031189 0.00842275790697298 0.0093200315007878 0.0102620030889562 0.0112508270117124 0.0122887536168275 0.0133781326625279 0.0145214167350781 0.0157211646649734 0.0169800449230962 0.0183008389752815 0.0196864445704698 0.0211398789339727 0.0226642818332723 0.0242629184791983 0.0259391822201947 0.0276965969816642 0.029538819395981 0.0314696405616271 0.033492987361944 0.0356129232651216 0.0378336485171553 0.0401594996284938 0.0425949480428391 0.0451445978629223 0.0478131824929042 0.0506055600401785 0.0535267073006009 0.0565817121303272 0.0597757639842913 0.0631141423756403 0.0666022029818976 0.0702453610919312 0.0740490720526368 0.0780188083352224 0.0821600327976942 0.0864781676721351 0.0909785587521243 0.095666434196632 0.100546857301284 0.105624672515383 0.110904443902701 0.116390385155025 0.122086280168789 0.127995393085828 0.134120366578294 0.140463107023688 0.147024655067546 0.153805039906969 0.160803115446191 0.168016376273957 0.175440751189484 0.183070371756939 0.19089731309521 0.198911303807413 0.207099401620006 0.215445630931176 0.223930578058551 0.232530939523046 0.24121901820423 0.249962161647905 0.258722136192908 0.267454429905331 0.276107476557521 0.284621792058659 0.292929013825171 0.30095083256323 0.308597804812025 0.315768033353836 0.322345701222775 0.328199443524401 0.333180539597972 0.337120906194906 0.339830870292281 0.341096697888296 0.3406778526145 0.338303955222093 0.333671411928608 0.326439676215993 0.316227104917193 0.302606365278153 0.285099345093871 0.263171512944554 0.236225669950157 0.203595028262095 0.164535544657512 0.118217430025189 0.0637157471569485          0;          0 0.000452101202367285 0.000927042925123812 0.0014259605524031 0.00195004392881982 0.00250053975712667 0.00307875407730236 0.00368605482688085 0.00432387448186393 0.00499371277701767 0.00569713950373139 0.00643579738290472 0.00721140500951359 0.00802575986457747 0.00888074138919453 0.00977831411411346 0.0107205308369544 0.0117095358376577 0.0127475681210095 0.0138369646731397 0.0149801637166967 0.0161797079469288 0.0174382477281358 0.0187585442268385 0.0201434724545323 0.0215960241889845 0.023119310738666 0.0247165655100276 0.0263911463318675 0.0281465374849492 0.0299863513782216 0.0319143298054136 0.0339343447073157 0.0360503983556428 0.0382666228638777 0.0405872789188167 0.0430167536135375 0.045559557248058 0.0482203189478699 0.0510037809326682 0.0539147912477349 0.0569582947483759 0.0601393221033091 0.0634629765556991 0.0669344181503354 0.0705588451019413 0.0743414719424155 0.0782875040435634 0.0824021080661281 0.0866903778351996 0.091157295085845 0.0958076844604522 0.100646162070181 0.105677076856346 0.110904443902701 0.116331868755606 0.121962461704926 0.127798740863174 0.133842522752706 0.1400947989693 0.14655559733388 0.153223825770729 0.160097096958577 0.167171531588507 0.174441537827383 0.181899564325223 0.189535823816886 0.197337984049597 0.205290822415127 0.213375840275082 0.221570832535926 0.229849407552549 0.238180451910645 0.246527534053396 0.254848240071177 0.26309343425751 0.271206436243096 0.279122105644518 0.286765824196079 0.294052364262617 0.300884631447108 0.307152267697385 0.312730099868374 0.317476417094918 0.321231058559706 0.323813291282927 0.325019455395416 0.324620351963378 0.322358345786181 0.317944152662455 0.311053277384479 0.301322065143867 0.288343325076987 0.271661480306518 0.25076719400209 0.225091415639447 0.193998785730347 0.15678033076499 0.112645372889583 0.0607125708611969          0;          0 0.000430578250640257 0.000882909664646189 0.00135807557449702 0.00185720918048072 0.00238149783420688 0.002932185399674 0.00351057469171041 0.00411802999116232 0.00475597963568646 0.00542591868441285 0.00612941165406373 0.00686809532333914 0.00764368160149494 0.00845796045603398 0.00931280289328994 0.010210163984392 0.0111520859276372 0.012140701136651 0.0131782353418547 0.0142670106906724 0.0154094488295548 0.0166080739482578 0.0178655157638539 0.01918451241863 0.0205679132623128 0.0220186814848951 0.0235398965616932 0.0251347564670596 0.0268065796073778 0.0285588064174833 0.0303950005574362 0.0323188496385136 0.0343341653983186 0.0364448832349119 0.0386550609987426 0.0409688769287827 0.0433906266054935 0.0459247187779466 0.0485756699053989 0.0513480972347094 0.0542467102139752 0.0572763000194304 0.0604417269467407 0.0637479053890711 0.0671997860923832 0.0708023353430111 0.0745605107032754 0.0784792328673319 0.0825633531611334 0.0868176161568226 0.0912466168124937 0.0958547514824535 0.100646162070181 0.105624672515383 0.110793716717011 0.116156256894942 0.12171469128319 0.127470749925856 0.133425377212323 0.139578599639059 0.145929377120237 0.152475435986577 0.159213081609448 0.166136988363263 0.173239964391316 0.180512688365812 0.187943415129256 0.195517646768377 0.203217765300038 0.211022622737285 0.218907083848618 0.226841516420202 0.234791223273793 0.242715809677166 0.250568479102398 0.258295249533672 0.265834081692632 0.273113909627359 0.280053563091324 0.286560570011015 0.292529826093863 0.297842117248971 0.302362478968179 0.30593837512865 0.308397676813514 0.309546419685289 0.309166316167113 0.307011996166159 0.302807947286727 0.296245122399214 0.286977179024518 0.274616311227108 0.258728630546079 0.238829047890184 0.214375603233709 0.184763184324041 0.149316569392241 0.107282721982484 0.0578222584156049          0;          0 0.00040987857186357 0.000840464542488177 0.00129278726022487 0.00176792544773318 0.0022670093757161 0.00279122311048105 0.00334180683515491 0.0039200592439565 0.00452734000843918 0.00516507231405215 0.00583474546472291 0.00653791755242435 0.00727621818784841 0.00805135128735095 0.00886509791024665 0.00971931913930294 0.0106159589958917 0.0115570473796887 0.0125447030210411 0.0135811364321344 0.0146686528408506 0.0158096550886958 0.0170066464713577 0.0182622334972899 0.0195791285361833 0.0209601523252225 0.0224082362965986 0.0239264246848 0.0255178763666792 0.0271858663811288 0.0289337870683187 0.030765148760788 0.0326835799501357 0.034692826843548 0.0367967522138065 0.038999333434641 0.0413046595801796 0.0437169274526773 0.0462404363864996 0.0488795816583371 0.0516388463136234 0.0545227911969192 0.0575360429493595 0.060683279708888 0.0639692142186157 0.0673985740149358 0.0709760783296276 0.074706411298711 0.0785941910248194 0.0826439339888735 0.0868600142503124 0.0912466168124937 0.0958076844604522 0.100546857301284 0.105467404152205 0.110572144826921 0.11586336226641 0.121342703344392 0.127011067049544 0.132868478604538 0.138913947924778 0.14514531064568 0.1515590497547 0.15815009565112 0.164911602220554 0.171834696250018 0.178908197220353 0.186118304192988 0.193448246154164 0.200877891788193 0.208383314218197 0.215936305773513 0.223503837312876 0.231047456046043 0.23852261514789 0.245877927741544 0.253054337033558 0.25998419350648 0.266590229103513 0.272784417266485 0.278466706501224 0.283523613831637 0.287826663052123 0.291230651082654 0.293571723955877 0.294665242002879 0.294303411634163 0.292252658712911 0.288250715864697 0.282003393134659 0.273180998160263 0.261414368442522 0.246290474334816 0.227347546986416 0.204069680633351 0.175880853273695 0.142138303843852 0.102125197467431 0.0550425031131346          0;          0 0.000389983560662665 0.000799669407942007 0.00123003692686243 0.00168211248018745 0.00215697147664427 0.00265574050939077 0.00317959956456161 0.00372978429932561 0.00430758838841991 0.00491436593758962 0.00555153396174702 0.00622057492496108 0.00692303933858752 0.0076605484129387 0.00843479675685973 0.0092475551184066 0.0101006731585001 0.0109960822479354 0.0119357982764459 0.0129219244606233 0.0139566541353704 0.0150422735111667 0.0161811643767482 0.017375806723794 0.0186287812668438 0.0199427718279035 0.0213205675509835 0.0227650649071042 0.0242792694450484 0.0258662972372729 0.0275293759638504 0.0292718455700149 0.0310971584247624 0.0330088788989035 0.0350106822708911 0.0371063528575341 0.0392997812542378 0.0415949605555405 0.0439959814113067 0.0465070257568008 0.0491323590358417 0.0518763207150995 0.0547433128641325 0.0577377865497144 0.0608642257640934 0.0641271285747518 0.067530985147654 0.0710802522565105 0.0747793238468266 0.0786324971749899 0.0826439339888735 0.0868176161568226 0.091157295085845 0.095666434196632 0.100348143641956 0.105205106365169 0.11023949449605 0.115452874971056 0.120846103143037 0.126419203010388 0.132171232546026 0.138100132441009 0.14420255639434 0.150473680877599 0.156906992078531 0.163494047479201 0.170224209249356 0.177084346331328 0.184058501756124 0.191127521357824 0.198268639641277 0.20545501810211 0.212655230793712 0.21983269137787 0.22694501527859 0.233943309875984 0.240771384922082 0.247364874525366 0.253650261127261 0.259543790872492 0.26495026864566 0.269761719797374 0.273855904201994 0.277094666761754 0.279322106783122 0.280362546783876 0.280018279224569 0.278067067375086 0.274259374002829 0.268315288778291 0.259921122208314 0.248725630496073 0.234335831955515 0.216312371438623 0.194164384624568 0.167343808924205 0.135239082120224 0.0971681636359925 0.0523708064421357          0;          0 0.000370873468673299 0.000760483766575776 0.00116976228661165 0.00159968509740696 0.00205127491018627 0.00252560311244998 0.00302379186829649 0.0035470162848496 0.00409650664380701 0.00467355069661597 0.0052794960211969 0.00591575243746763 0.00658379447815905 0.00728516391054714 0.00802147230374357 0.00879440363507436 0.00960571692781831 0.0104572489111568 0.0113509166915867 0.0122887204232466 0.0132727459625811 0.0143051674904946 0.0153882500825937 0.0165243522052576 0.0177159281120743 0.0189655301115948 0.020275810673354 0.0216495243346263 0.0230895293653869 0.0245987891433712 0.0261803731848998 0.0278374577702037 0.0295733260942527 0.0313913678654846 0.0332950782652496 0.035288056170124 0.037374001527384 0.0395567117607459 0.0418400770688163 0.0442280744624076 0.0467247603687748 0.0493342616107341 0.0520607645463046 0.0549085021297442 0.0578817386273614 0.0609847516909801 0.0642218114580983 0.0675971563102581 0.0711149648795226 0.0747793238468266 0.0785941910248194 0.0825633531611334 0.0866903778351995 0.0909785587521243 0.095430853660036 0.100049814031889 0.104837505558104 0.109795418391644 0.114924365971101 0.120224371118896 0.125694537969438 0.131332908124664 0.137136299260027 0.1431001242111 0.14921818835742 0.15548246288386 0.161882831238332 0.168406805815215 0.175039211573719 0.181761832946136 0.18855301999897 0.195387249376329 0.202234635075312 0.209060383572478 0.215824187233602 0.222479549289691 0.228973032944246 0.235243426382564 0.241220814575637 0.24682554779985 0.251967095719545 0.256542774691643 0.260436334637989 0.26351639037856 0.265634680712601 0.266624136758826 0.26629673910223 0.264441141123935 0.260820033490029 0.255167222121344 0.247184389031819 0.236537502179032 0.222852836883966 0.205712567411998 0.184649882923704 0.159143577158132 0.128612055854082 0.0924066999928424 0.049804516399125          0;          0 0.000352527655405698 0.000722865294635602 0.00111189823784476 0.00152055427095832 0.00194980551525378 0.00240067036043935 0.00287421546108057 0.00337155779586204 0.00389386678874912 0.00444236649062923 0.00501833781945656 0.00562312085628882 0.00625811719388027 0.00692479233367249 0.00762467812609008 0.00835937524799091 0.0091305557099248 0.00993996538450499 0.0107894265456756 0.0116808404069459 0.012616189644738 0.0135975408908319 0.0146270471754666 0.0157069502999389 0.016839583114496 0.0180273716739124 0.0192728372393328 0.0205785980907074 0.0219473711093933 0.0233819730851944 0.0248853216961954 0.0264604361031543 0.0281104370928694 0.0298385466967585 0.0316480872017759 0.0335424794606614 0.0355252403972412 0.0375999795899627 0.0397703948029147 0.042040266318095 0.0444134499054909 0.0468938682484287 0.0494855006204388 0.0521923705863381 0.0550185314740962 0.0579680493350633 0.0610449830779716 0.0642533614264529 0.0675971563102581 0.0710802522565105 0.074706411298711 0.0784792328673319 0.0824021080661281 0.086478167672135 0.0907102231240269 0.0951006996823152 0.0996515608549405 0.104364223082211 0.109239459564759 0.114277291996057 0.119476868825852 0.124836328531184 0.13035264620597 0.136021461596762 0.141836886509305 0.147791289285873 0.153875053804824 0.160076310178708 0.166380634022925 0.172770710830188 0.179225961613484 0.185722125568064 0.192230795047053 0.198718897640918 0.205148119593111 0.211474264167168 0.217646537898002 0.22360675690528 0.229288464611931 0.234615951287574 0.239503164815599 0.24385250095359 0.247553460108142 0.250481156264534 0.252494662185028 0.25343517330153 0.253123970861846 0.251360162825094 0.24791817872006 0.242544992157587 0.234957041898938 0.224836819298468 0.211829086529826 0.195536686236028 0.175515899077081 0.151271301042708 0.12225006730553 0.0878356637609751 0.0473408611772779          0;          0 0.000334924808305797 0.000686770290285797 0.00105637755919359 0.00144462807359948 0.00185244541361847 0.00228079711746372 0.00273069657818513 0.00320320500010552 0.00369943341406579 0.00422054475012981 0.00476775596587153 0.00534234022776308 0.00594562914249502 0.00657901503427758 0.00724395326328446 0.00794196457939602 0.00867463750426241 0.00944363073342524 0.0102506755487912 0.0110975782301241 0.0119862224523936 0.0129185716537645 0.0138966713567058 0.0149226514221178 0.0159987282134828 0.0171272066448063 0.0183104820825017 0.0195510420673249 0.0208514678179513 0.0222144354727509 0.023642717020696 0.0251391808660737 0.0267067919646944 0.0283486114615162 0.0300677957509503 0.0318675948714847 0.0337513501355532 0.0357224908836659 0.0377845302385793 0.0399410597205732 0.0421957425685566 0.0445523055935781 0.0470145293711586 0.0495862365564976 0.0522712780817771 0.05507351696724 0.0579968094471654 0.0610449830779716 0.0642218114580983 0.067530985147654 0.0709760783296277 0.0745605107032754 0.0782875040435634 0.0821600327976942 0.0861807680201072 0.0903520138702053 0.0946756358116208 0.0991529795572121 0.1037847796992 0.108571056847832 0.113511001973517 0.118602846505161 0.123843716580036 0.129229469666264 0.134754511586191 0.140411591755469 0.14619157421654 0.152083181783861 0.158072710329053 0.164143709914231 0.170276629127827 0.176448418585612 0.182632089126488 0.188796219753397 0.194904409839691 0.20091466953504 0.206778741656506 0.212441347633265 0.217839349280285 0.222900817299121 0.227543996433931 0.231676156138105 0.235192314420664 0.237973821229906 0.239886786281309 0.240780334632973 0.240484671538583 0.23880893614722 0.235538821451556 0.230433935489187 0.22322487615202 0.213609989028983 0.201251774468436 0.185772906465975 0.166751822024744 0.14371783525917 0.116145725675211 0.0834497447120896 0.0449769787184046          0;          0 0.000318043135282857 0.000652154068390736 0.00100313151679593 0.0013718125097073 0.0017590740747686 0.00216583498204158 0.00259305754514076 0.00304174947905659 0.00351296581382348 0.00400781086275135 0.00452744024343772 0.00507306294920434 0.00564594346794917 0.00624740394466168 0.00687882638300698 0.00754165488043004 0.00823739789015242 0.0089676305022166 0.00973399673436026 0.0105382118219588 0.0113820644945371 0.0122674192244015 0.0131962184307554 0.0141704846202084 0.0151923224418438 0.0162639206319352 0.0173875538199677 0.0185655841637797 0.0198004627773524 0.0210947309099949 0.0224510208303294 0.02387205636254 0.0253606530157157 0.0269197176397402 0.0285522475329616 0.0302613289177345 0.032050134689754 0.0339219213357917 0.035880024901875 0.0379278558799762 0.0400688928657656 0.0423066748227391 0.0446447917689006 0.0470868736809334 0.0496365773872199 0.0522975711949119 0.05507351696724 0.0579680493350633 0.06098475169098 0.0641271285747518 0.0673985740149358 0.0708023353430111 0.0743414719424154 0.0780188083352223 0.0818368809430624 0.0857978777856419 0.0899035702990791 0.0941552363664276 0.0985535735532516 0.103098601430953 0.107789551748565 0.1126247450787 0.117601452413862 0.122715740023873 0.127962295702061 0.133334234325194 0.138822880427876 0.144417525243963 0.150105155392995 0.155870150085799 0.161693943387331 0.167554647702992 0.173426634243269 0.179280065766577 0.185080376396822 0.190787692755506 0.196356190032463 0.201733375938248 0.206859294728094 0.211665642654326 0.216074785283041 0.219998666092148 0.223337594641492 0.225978901360146 0.227795444618653 0.228643954231087 0.228363193847874 0.226771922838512 0.223666636204761 0.218819058788964 0.21197336752581 0.202843112703929 0.191107806128054 0.176409140672262 0.158346801955789 0.136473828717275 0.110291473869323 0.0792435131366996 0.0427099425674409          0;          0 0.000301860532645108 0.000618971304870395 0.000952090393976934 0.0013020122396328 0.00166956924474914 0.00205563343072639 0.002461118146944 0.00288697983405427 0.00333421984027954 0.00380388628949661 0.00429707599941608 0.00481493644762068 0.00535866778260618 0.00592952487626409 0.00652881941344525 0.00715792201333798 0.00781826437637036 0.00851134144919093 0.00923871359897926 0.010002008786872 0.0108029247286418 0.0116432310289147 0.0125247712731366 0.0134494650591692 0.0144193099477924 0.0154363833084698 0.0165028440334768 0.0176209340898426 0.0187929798744925 0.0200213933334329 0.0213086728007581 0.022657403507614 0.0240702577049596 0.0255499943369659 0.0270994581940889 0.0287215784661789 0.0304193666063324 0.032195913405459 0.0340543851656072 0.0359980188468279 0.038030116047632 0.0401540356627334 0.0423731850436096 0.0446910094672483 0.0471109796960738 0.0496365773872199 0.0522712780817771 0.0550185314740962 0.0578817386273614 0.0608642257640934 0.0639692142186157 0.0671997860923832 0.0705588451019413 0.0740490720526368 0.0776728743084387 0.0814323285587033 0.0853291161057163 0.0893644498115594 0.0935389917484155 0.0978527604918585 0.102305026880902 0.106894196940425 0.111617680519703 0.116471744043776 0.121451345600532 0.126549950394104 0.131759324382265 0.137069303680018 0.142467537050936 0.147939198519492 0.15346666681857 0.159029168033468 0.164602377413248 0.170157975888455 0.175663156356493 0.181080074267563 0.186365236459666 0.191468821544779 0.196333924433487 0.200895716794765 0.205080514373334 0.208804741120185 0.211973779022772 0.214480691339125 0.216204805632924 0.217010141561134 0.21674366676756 0.215233362468611 0.212286078363748 0.207685154342956 0.201187784075298 0.192522092922218 0.181383899700104 0.167433128589414 0.150289833919897 0.12952979661729 0.104679646736592 0.0752114616869176 0.0405367844244887          0;          0 0.000286354731089479 0.000587176336055335 0.000903183951711482 0.00123513120939728 0.00158380775362073 0.00195004081227888 0.00233469681833548 0.00273868308253897 0.00316294951642108 0.00360849040442257 0.00407634622354063 0.00456760550837681 0.005083406758876 0.00562494038737826 0.00619345070084698 0.0067902379132772 0.00741666018231706 0.00807413566303898 0.00876414457056149 0.00948823124183195 0.0102480061853168 0.0110451481055902 0.0118814058878405 0.0127586005251097 0.0136786269686021 0.0146434558786387 0.0156551352507343 0.0167157918878206 0.0178276326857781 0.0189929456951311 0.0202141009169576 0.0214935507857084 0.0228338302856629 0.0242375566411039 0.0257074285128963 0.0272462246259186 0.0288568017426433 0.0305420918879764 0.0323050987191486 0.0341488929218732 0.0360766065000112 0.0380914258104677 0.0401965831778115 0.0423953469039857 0.0446910094672483 0.0470868736809334 0.0495862365564975 0.052192370586338 0.0549085021297442 0.0577377865497143 0.060683279708888 0.063747905389071 0.0669344181503354 0.0702453610919312 0.073683017917713 0.0772493586428299 0.0809459782053801 0.0847740271658303 0.0887341335874127 0.0928263150915217 0.0970498799723016 0.101403316133045 0.10588416647243 0.110488889199668 0.115212701392745 0.120049403931501 0.124991185735346 0.130028405011992 0.135149344976359 0.140339941225267 0.145583477650909 0.150860247441313 0.156147175345626 0.161417396972377 0.16663979043571 0.171778455163311 0.176792132125391 0.181633559130882 0.1862487541589 0.190576218943558 0.194546054200835 0.198078976969061 0.201085229520383 0.203463368179066 0.205098919142427 0.205862887028982 0.205610100362281 0.204177376522569 0.201381486844986 0.197016900493825 0.190853283476785 0.182632726658375 0.172066673862427 0.158832518092255 0.142569830512462 0.122876183094883 0.0993025216948129 0.0713480417512045 0.038454513749745          0;          0 0.000271503422124752 0.000556723417919997 0.000856341827372144 0.00117107319599221 0.0015016662146971 0.00184890520859321 0.00221361167454845 0.0025966458671575 0.00299890843238002 0.00342134208775799 0.0038649333476902 0.00433071429175256 0.00481976437349539 0.00533321226651468 0.00587223774387528 0.00643807358614905 0.00703200751241035 0.0076553841274918 0.00830960687763167 0.00899614000532573 0.00971651049271373 0.0104723099811659 0.0112651966528671 0.012096897058102 0.0129692078696018 0.0138839975426873 0.014843207857013 0.0158488553124353 0.0169030323478726 0.0180079083479376 0.0191657303975681 0.0203788237398058 0.0216495918862122 0.0229805163231123 0.0243741557498409 0.0258331447773603 0.0273601920069377 0.0289580773989135 0.0306296488308624 0.0323778177325212 0.0342055536716117 0.0361158777499697 0.0381118546530591 0.0401965831778116 0.0423731850436096 0.0446447917689006 0.0470145293711586 0.0494855006204388 0.0520607645463046 0.0547433128641325 0.0575360429493596 0.0604417269467407 0.0634629765556991 0.0666022029818976 0.0698615714887117 0.0732429499197513 0.076747850494319 0.080377364100988 0.0841320862295421 0.0880120335874715 0.0920165503430873 0.0961442028220474 0.100392661356479 0.104758567844645 0.109237387422779 0.113823242477716 0.118508727037489 0.123284699365235 0.128140050347323 0.133061445007312 0.138033034190355 0.143036133145306 0.148048863380587 0.153045753781437 0.157997296546531 0.162869453026669 0.167623104022599 0.172213438517708 0.176589274178298 0.180692302243136 0.1844562486376 0.187805942278164 0.190656280571336 0.192911081047874 0.194461806897322 0.195186152867803 0.194946476558577 0.193588058543406 0.190937173005531 0.186798948622122 0.180954997287964 0.173160785893315 0.163142723745237 0.150594935319101 0.135175684817946 0.116503415469897 0.094152362572052 0.0676476949539157 0.0364601347408388          0;          0 0.000257284367066846 0.000527566949579821 0.000811493878508365 0.00110974227750751 0.00142302162739034 0.00175207517694169 0.00209768139996515 0.00246065549818885 0.0028418509493475 0.00324216109940416 0.00366252079746941 0.00410390807151202 0.00456734584242666 0.00505390367342363 0.00556469955102367 0.00610090169316924 0.00666373037909074 0.00725445979458153 0.00787441988522498 0.00852499820886772 0.00920764177722796 0.00992385887495031 0.0106752208426483 0.0114633638084919 0.0122899903506765 0.0131568710706217 0.0140658460539716 0.0150188261933594 0.016017794343434 0.0170648062747733 0.0181619913889939 0.0193115531525551 0.0205157692013924 0.0217769910625456 0.0230976434322992 0.0244802229429557 0.0259272963421355 0.0274414979993469 0.0290255266444016 0.0306821412309484 0.0324141558058444 0.0342244332511396 0.0361158777499697 0.0380914258104677 0.0401540356627334 0.0423066748227391 0.0445523055935781 0.0468938682484287 0.0493342616107341 0.0518763207150995 0.0545227911969192 0.0572763000194304 0.0601393221033091 0.0631141423756403 0.0662028127016001 0.0694071031029335 0.0727284466016741 0.0761678769548697 0.079725958465581 0.0834027069663011 0.0871975009722631 0.0911089818928726 0.0951349420685744 0.0992721992666243 0.103516456121101 0.107862142838551 0.112302241309239 0.116828088563231 0.121429157288398 0.126092810881684 0.130804030233047 0.135545109140723 0.140295314923648 0.145030510428824 0.149722733224221 0.154339727317454 0.158844422242377 0.163194353804774 0.167341020169098 0.171229166294321 0.174795988981839 0.177970253974287 0.180671315632906 0.182808028713457 0.184277540646481 0.184963951495723 0.18473682740632 0.183449551848205 0.180937497294928 0.177015998136892 0.171478103592464 0.164092087129894 0.154598686424911 0.142708045128228 0.128096324676278 0.110401951016755 0.089221457404202 0.0641048803125292 0.0345506609697847          0;          0 0.000243675490527959 0.000499661664992655 0.000768570477718087 0.00105104323637743 0.00134775189429268 0.00165940038662435 0.001986726010349 0.00233050084766985 0.00269153323221414 0.00307066925703539 0.00346879432305474 0.003886834726136 0.00432575928048901 0.00478658097552655 0.00527035866265478 0.00577819876774564 0.00631125702421365 0.00687074022068635 0.0074579079562062 0.00807407439471862 0.00872061000926966 0.00939894330484319 0.0101105625070907 0.0108570172023276 0.0116399199120672 0.0124609475830061 0.0133218429707459 0.0142244158925915 0.0151705443214828 0.0161621752894516 0.0172013255649062 0.0182900820634897 0.0194306019471786 0.0206251123606359 0.0218759097475327 0.0231853586825533 0.0245558901469989 0.0259899991672464 0.0274902417256827 0.0290592308430343 0.030699631719119 0.0324141558058444 0.0342055536716117 0.0360766065000113 0.038030116047632 0.0400688928657657 0.0421957425685566 0.044413449905491 0.0467247603687748 0.0491323590358417 0.0516388463136235 0.0542467102139752 0.0569582947483759 0.0597757639842913 0.0627010612549252 0.065735862957961 0.0688815263167347 0.0721390304084385 0.0755089096877178 0.0789911791496168 0.0825852501823706 0.0862898360570835 0.0901028458868073 0.094021265760772 0.0980410256192192 0.102156850279022 0.106362092848448 0.110648548579295 0.115006246994243 0.119423219894509 0.123885242595367 0.128375545452204 0.132874492424611 0.137359223077406 0.14180325403183 0.146176035453646 0.150442457693067 0.154562302669714 0.158489634018687 0.162172119375685 0.165550277473341 0.168556641940482 0.171114832832971 0.173138525970476 0.174530309098222 0.17518041272597 0.174965302206325 0.173746116187974 0.171366935002264 0.167652860797782 0.162407889309658 0.155412551018868 0.146421297100342 0.135159602953537 0.121320759229071 0.104562317081092 0.0845021508552816 0.0607140975313635 0.0327231279376181          0;          0 0.000230654960125521 0.00047296279640364 0.000727502764055696 0.000994881903188444 0.00127573626204111 0.00157073216177725 0.00188056750272472 0.00220597311172789 0.00254771413000043 0.00290659144054907 0.00328344313387572 0.00367914601024892 0.00409461711636243 0.00453081531365985 0.00498874287499321 0.00546944710559137 0.00597402198353177 0.00650360981402595 0.00705940289083433 0.00764264515700496 0.00825463385587202 0.00889672116183509 0.00957031577885345 0.0102768844928113 0.0110179536619177 0.0117951106270768 0.0126100050216716 0.0134643499574204 0.0143599230598556 0.0152985673235052 0.0162821917529876 0.017312771751916 0.0183923492167019 0.0195230322869957 0.0207069946985403 0.0219464746775861 0.0232437733086366 0.0246012522990929 0.0260213310552493 0.0275064829739589 0.0290592308430343 0.0306821412309484 0.0323778177325212 0.0341488929218732 0.0359980188468279 0.0379278558799763 0.0399410597205732 0.042040266318095 0.0442280744624076 0.0465070257568008 0.0488795816583371 0.0513480972347093 0.0539147912477349 0.0565817121303272 0.0593506993758292 0.0622233398054676 0.0652009181208502 0.0682843610832619 0.0714741745893551 0.0747703728329305 0.078172398654042 0.0816790340787296 0.0852882999442773 0.0889973433849047 0.0928023118199961 0.0966982119400022 0.100678752022501 0.104736165730939 0.108861015349425 0.113041972186647 0.117265571638179 0.121515940126825 0.125774490842282 0.130019584871447 0.134226153945623 0.138365280627182 0.142403731311657 0.146303436927322 0.150020915668144 0.153506631491844 0.156704281446809 0.159550004152808 0.161971500943569 0.163887060275886 0.165204475011106 0.16581984107033 0.165616224743453 0.164462184581929 0.162210132312198 0.158694515556151 0.153729803320089 0.147108253196066 0.138597436988976 0.127937499016761 0.114838118604992 0.0989751452832471 0.0799868718590284 0.0574699068618345 0.0309746037784936          0;          0 0.000218201253960519 0.000447426212710911 0.000688222855863626 0.000941165447732885 0.00120685569453521 0.00148592394089162 0.00177903040554008 0.00208686645594038 0.00241015592119286 0.00274965644239161 0.0031061608591892 0.0034804986309563 0.00387353729047179 0.00428618392756912 0.00471938669958688 0.00517413636481656 0.00565146783440062 0.0061524617372986 0.00667824599199733 0.00722999737758189 0.00780894309559198 0.00841636231275093 0.0090535876731528 0.009722006766811 0.0104230635395875 0.0111582596274132 0.0119291555953526 0.0127373720594328 0.0135845906662138 0.0144725549017964 0.0154030706983024 0.0163780068017811 0.0173992948609479 0.0184689291910996 0.019588966161909 0.0207615231515336 0.0219887770024911 0.023272961906997 0.0246163666408358 0.0260213310552493 0.0274902417256827 0.0290255266444016 0.0306296488308623 0.0323050987191486 0.0340543851656072 0.035880024901875 0.0377845302385793 0.0397703948029147 0.0418400770688164 0.0439959814113067 0.0462404363864996 0.0485756699053989 0.0510037809326682 0.0535267073006009 0.0561461891831514 0.058863727724632 0.061680538262019 0.0645974975181643 0.0676150840749458 0.0707333113598012 0.0739516522954074 0.0772689546696239 0.0806833461802632 0.0841921279957442 0.0877916555470499 0.091477205127374 0.0952428247219785 0.0990811673205328 0.102983304775815 0.106938520064227 0.110934075572983 0.114954954783696 0.118983574439921 0.122999463973968 0.126978908623053 0.130894552282857 0.134714955724129 0.138404105330763 0.141920867000997 0.145218379281971 0.14824337917584 0.150935453356838 0.153226206765816 0.155038339694238 0.156284623524661 0.156866764249899 0.156674141737783 0.155582411431059 0.153451953759684 0.150126154981299 0.145429501439262 0.139165467319042 0.131114173873612 0.121029795755695 0.108637687515758 0.0936312004735403 0.0756681570191312 0.0543669459153289 0.0293021983213347          0;          0 0.000206293217255628 0.000423008535603263 0.000650664029413198 0.000889802623305642 0.0011409931861986 0.00140483166251262 0.00168194224044584 0.00197297855701914 0.00227862493934402 0.00259959768128219 0.00293664635434033 0.00329055515127195 0.00366214426043426 0.00405227126846661 0.00446183258831022 0.00489176490897014 0.0053430466627206 0.00581669950466521 0.00631378979867324 0.00683543010271147 0.00738278064546446 0.00795705078487112 0.00855950043778632 0.0091914414683855 0.00985423902114879 0.0105493127822682 0.0112781381510921 0.0120422473007318 0.012843230104173 0.0136827348991335 0.0145624690614456 0.0154841993528841 0.0164497520050628 0.017461012496233 0.0185199249724891 0.0196284912589551 0.0207887693999284 0.022002871659623 0.023272961906997 0.0246012522990929 0.0259899991672464 0.0274414979993469 0.0289580773989135 0.0305420918879764 0.032195913405459 0.0339219213357918 0.0357224908836659 0.0375999795899627 0.0395567117607459 0.0415949605555405 0.0437169274526773 0.0459247187779466 0.0482203189478699 0.0506055600401785 0.0530820872611997 0.0556513198323362 0.0583144067652016 0.0610721769366906 0.0639250828107257 0.0668731370819605 0.0699158414376001 0.0730521065459147 0.0762801622830623 0.0795974571025256 0.0830005453326854 0.0864849610566103 0.0900450770826729 0.0936739473536401 0.0973631309637832 0.101102495756494 0.10487999925688 0.108681444452628 0.112490207669599 0.116286935493499 0.120049207362474 0.123751160094394 0.127363070213192 0.130850889496886 0.134175728681382 0.13729328371388 0.140153198352212 0.14269835624571 0.14486409490257 0.146577333140727 0.147755602725915 0.148305973912721 0.148123863512259 0.147091712902389 0.145077522061239 0.141933224228459 0.13749288416654 0.131570701190025 0.123958796135494 0.114424759239704 0.102708933455041 0.0885214050359593 0.0715386702502866 0.051399943775141 0.0277030706957548          0;          0 0.000194910109400242 0.000399667236026969 0.00061476086728813 0.000840703969623088 0.00107803402218176 0.00132731408561029 0.00158913390586157 0.00186411105274689 0.00215289209271152 0.00245615379504923 0.00277460437046279 0.00310898474052688 0.003460069836209 0.00382866992314909 0.00421563195088219 0.00462184092260368 0.00504822128141519 0.00549573830824386 0.0059653995257857 0.00645825610187797 0.00697540424464055 0.00751798658053163 0.00808719350512157 0.00868426449488638 0.00931048936663884 0.009967209469332 0.0106558187908644 0.0113777649601631 0.0121345501221928 0.0129277316606097 0.0137589227395045 0.014629792632038 0.015542066799708 0.0164975266814639 0.0174980091468501 0.0185454055617538 0.0196416604091035 0.0207887693999284 0.0219887770024911 0.0232437733086366 0.0245558901469989 0.0259272963421355 0.0273601920069377 0.0288568017426433 0.0304193666063324 0.032050134689754 0.0337513501355532 0.0355252403972412 0.037374001527384 0.0392997812542378 0.0413046595801796 0.0433906266054935 0.045559557248058 0.0478131824929042 0.0501530567650853 0.052580520974412 0.0550966607308828 0.0577022591745756 0.0603977438027867 0.0631831266096882 0.0660579367790184 0.0690211450875701 0.0720710790856322 0.0752053280191452 0.0784206363461136 0.0817127845756144 0.0850764560203113 0.0885050879012958 0.091990705075803 0.095523734472167 0.099092798110395 0.10268448235886 0.106283080825525 0.109870308003248 0.113424980480271 0.116922662185817 0.120335269763343 0.12363063374669 0.126772010752728 0.129717541393672 0.132419648047726 0.134824366002403 0.136870600794591 0.13848930380805 0.139602557344968 0.140122559454869 0.139950497772234 0.138975300473149 0.137072251199769 0.134101453406574 0.1299061280403 0.124310726760526 0.117118841023031 0.108110885264206 0.0970415301211651 0.0836368590754101 0.0675912190925452 0.0485637327181957 0.026174435649725          0;          0 0.000184031642520302 0.000377360713274019 0.000580449380036618 0.000793781979185955 0.00101786599168894 0.00125323305223536 0.00150043999144174 0.00176006991085724 0.00203273329028351 0.00231906912666697 0.00261974610353198 0.00293546378959145 0.00326695386479376 0.00361498137163495 0.00398034598907753 0.00436388332586533 0.00476646622939933 0.00518900610563511 0.0056324542446684 0.00609780314578127 0.00658608783471697 0.00709838716482249 0.00763582509243204 0.00819957191544575 0.00879084546246848 0.00941091221809554 0.0100610883679441 0.0107427407448069 0.0114572876548255 0.0122061995598098 0.0129909995887458 0.0138132638480886 0.0146746214966054 0.0155767545462603 0.0165213973458788 0.0175103356990393 0.0185454055617538 0.0196284912589551 0.0207615231515336 0.0219464746775861 0.0231853586825533 0.0244802229429557 0.0258331447773603 0.0272462246259186 0.0287215784661789 0.0302613289177345 0.0318675948714847 0.0335424794606614 0.035288056170124 0.0371063528575341 0.038999333434641 0.0409688769287827 0.0430167536135375 0.0451445978629223 0.047353877345272 0.0496458581305492 0.052021565237886 0.0544817380981683 0.0570267803488978 0.0596567033148189 0.0623710624572146 0.0651688859966431 0.0680485948273908 0.0710079127461831 0.0740437659117371 0.0771521703344714 0.0803281060659273 0.0835653766138564 0.086856451950048 0.0901922933021773 0.0935621577264685 0.0969533802428031 0.100351131075888 0.103738145282802 0.107094421756 0.110396888268719 0.113619028873441 0.116730469569995 0.119696517724067 0.12247765023492 0.125028944918098 0.127299448979478 0.129231477805214 0.130759836571396 0.131810956380271 0.132301935748625 0.132139477299612 0.131218708431931 0.129421873549149 0.126616884114996 0.122655711344439 0.117372604730598 0.11058211782788 0.10207692074422 0.0916253766201991 0.0789688569682145 0.0638187680866144 0.0458532578250935 0.0247135687291081          0;          0 0.00017363801257445 0.000356048358745422 0.000547667104250898 0.000748951231406076 0.000960379559968834 0.0011824536992803 0.00141569903160772 0.00166066572643684 0.00191792978525317 0.00218809411611264 0.00247178963702815 0.0027696764068858 0.00308244478224786 0.00341081659799405 0.00375554636929278 0.0041174225118729 0.00449726857697762 0.00489594449671758 0.00531434783479072 0.0057534150366934 0.00621412267259887 0.00669748866501472 0.007204573492136 0.00773648135647223 0.00829436130682667 0.0088794083000289 0.00949286418694547 0.0101360186051975 0.0108102097586735 0.0115168250613135 0.0122573016197281 0.0130331265259669 0.0138458369281347 0.0146970198425213 0.0155883116664283 0.0165213973458787 0.0174980091468501 0.0185199249724891 0.019588966161909 0.0207069946985403 0.0218759097475327 0.0230976434322992 0.0243741557498408 0.0257074285128963 0.0270994581940889 0.0285522475329616 0.0300677957509503 0.0316480872017759 0.0332950782652496 0.035010682270891 0.0367967522138065 0.0386550609987426 0.0405872789188166 0.0425949480428391 0.0446794531490433 0.0468419888030434 0.0490835221335491 0.0514047508103072 0.05380605567442 0.0562874474110398 0.0588485065878435 0.0614883163089722 0.0642053866525081 0.0669975699692352 0.069861966020455 0.0727948158219866 0.0757913829390429 0.078845820841189 0.081951024776681 0.0850984664596161 0.0882780096798246 0.0914777047424228 0.0946835594193705 0.0978792838469516 0.101046006528308 0.104161958296217 0.107202120755114 0.110137835349593 0.112936368795364 0.115560430153928 0.117967634329319 0.120109906209095 0.121932819056815 0.123374860083164 0.124366615370956 0.124829865497774 0.124676582280681 0.123807816050945 0.12211246174286 0.119465890838158 0.115728434833723 0.110743704381485 0.104336726570206 0.0963118809624855 0.0864506129480519 0.0745089007056171 0.0602144495574287 0.0432635847280163 0.0233178104535529          0;          0 0.000163709923873198 0.000335690606228276 0.000516353179902511 0.000706128498364697 0.000905468003928352 0.00111484462545181 0.00133475370545656 0.0015657139564255 0.00180826844584685 0.00206298560934406 0.00233046029097423 0.00261131480948191 0.00290620004895971 0.00321579657198409 0.00354081575286156 0.00388200092812909 0.00424012856089709 0.00461600941499705 0.00501048973418913 0.00542445242088992 0.00585881820798708 0.00631454681630297 0.00679263808914385 0.00729413309410828 0.00782011518091517 0.00837171098242962 0.00895009134429662 0.00955647216661573 0.0101921151388838 0.0108583283469694 0.0115564667281373 0.0122879323470773 0.0130541744624827 0.0138566893499223 0.0146970198425213 0.0155767545462603 0.0164975266814639 0.017461012496233 0.0184689291910996 0.0195230322869957 0.0206251123606358 0.0217769910625456 0.0229805163231123 0.0242375566411039 0.0255499943369659 0.0269197176397402 0.0283486114615162 0.0298385466967585 0.0313913678654846 0.0330088788989035 0.034692826843548 0.0364448832349119 0.0382666228638777 0.0401594996284938 0.0421248191296235 0.0441637076312853 0.0462770769647368 0.04846558490911 0.0507295905301815 0.0530691039021595 0.055483729574574 0.0579726030768575 0.0605343196762551 0.0631668545195425 0.0658674731947696 0.0686326316449355 0.0714578642500592 0.0743376587663743 0.0772653166700386 0.0802327972963658 0.0832305439925778 0.0862472903106734 0.0892698440552725 0.0922828467670761 0.0952685059635045 0.0982062971715102 0.101072632470613 0.103840491913658 0.106479013805097 0.108953039387859 0.111222607015694 0.113242390363556 0.114961074648771 0.116320664194548 0.117255713958468 0.11769247686465 0.117547957911516 0.11672886506874 0.115130445917313 0.112635197815185 0.109111438075633 0.104411719213588 0.0983710727319195 0.0908050631695211 0.0815076321980399 0.0702487104150782 0.0567715721169438 0.0407899057199149 0.0219845696091693          0;          0 0.000154228607823447 0.000316248970331798 0.000486448409463904 0.000665232825663037 0.000853027515807231 0.00105027801891877 0.00125745098958814 0.00147503509888798 0.00170354196236777 0.00194350709450809 0.00219549088876965 0.0024600796220948 0.002737886482402 0.00302955261725411 0.00333574820147218 0.00365717352100423 0.00399456006983493 0.00434867165613209 0.00472030551316 0.00511029340974084 0.00551950275420317 0.00594883768481078 0.00639924013860399 0.0068716908893965 0.00736721054433893 0.00788686048696993 0.00843174375300981 0.00900300582328938 0.00960183531612811 0.0102294645591557 0.0108871700179832 0.0115762725562461 0.0122981374983262 0.0130541744624827 0.0138458369281347 0.0146746214966054 0.015542066799708 0.0164497520050628 0.0173992948609479 0.0183923492167019 0.0194306019471786 0.0205157692013924 0.0216495918862122 0.0228338302856629 0.0240702577049596 0.0253606530157157 0.0267067919646944 0.0281104370928694 0.0295733260942527 0.0310971584247624 0.0326835799501357 0.0343341653983186 0.0360503983556427 0.0378336485171553 0.0396851458694006 0.0416059514484325 0.0435969242764906 0.0456586840372041 0.0477915690009328 0.0499955886584337 0.0522703704618856 0.0546151000068285 0.0570284539160841 0.0595085246064926 0.0620527360305043 0.0646577493863877 0.0673193576820652 0.0700323679172473 0.0727904695153837 0.0755860874896244 0.0784102186639949 0.0812522490906706 0.0840997506047641 0.0869382542373824 0.0897509979636399 0.0925186459923423 0.0952189765054655 0.0978265344253041 0.10031224542193 0.102642986969672 0.104781111814646 0.106683918721374 0.108303064820312 0.109583913274062 0.110464809312146 0.110876276945724 0.110740127857028 0.109968473055469 0.108462626894098 0.106111891936433 0.102792211943446 0.0983646789014275 0.0926738785199986 0.0855460569806555 0.0767870898933774 0.0661802324036371 0.0534836271643892 0.0384275444248866 0.0207113257657249          0;          0 0.000145175836615716 0.000297686074553268 0.000457895301078962 0.000626185591459288 0.000802957278881132 0.000988629750520564 0.00118364226969936 0.0013884548239179 0.00160354899837928 0.00182942887441986 0.00206662195203229 0.00231568009540568 0.00257718050010915 0.00285172668020629 0.00313994947320318 0.00344250806029719 0.00376009099890126 0.00409341726386281 0.00444323729316966 0.00481033403323061 0.00519552397802538 0.00559965819552841 0.0060236233338123 0.00646834259811729 0.00693477668891935 0.007423924689627 0.00793682489096836 0.00847455553737736 0.00903823547873135 0.00962902470860837 0.0102481247677966 0.0108967789890734 0.0115762725562461 0.0122879323470773 0.0130331265259669 0.0138132638480886 0.014629792632038 0.0154841993528841 0.016378006801781 0.017312771751916 0.0182900820634897 0.0193115531525551 0.0203788237398058 0.0214935507857084 0.022657403507614 0.02387205636254 0.0251391808660736 0.0264604361031542 0.0278374577702036 0.0292718455700149 0.030765148760788 0.0323188496385135 0.0339343447073157 0.0356129232651215 0.0373557431018388 0.0391638029737875 0.0410379114810975 0.0429786519337692 0.0449863427466751 0.0470609928534922 0.0492022515738742 0.0514093523065369 0.0536810493526975 0.0560155470987857 0.0584104207037591 0.0608625273438477 0.0633679069651864 0.065921671381516 0.0685178804287957 0.0711494037498966 0.0738077666291174 0.0764829781265348 0.0791633395744334 0.0818352312903584 0.0844828751315872 0.0870880702616934 0.0896298992188112 0.0920844010643433 0.0944242080470604 0.0966181418373197 0.0986307649656647 0.100421882635083 0.101945989562026 0.103151655932716 0.103980845932581 0.104368161611481 0.104240004078745 0.103513643172194 0.102096185805647 0.0998834321605417 0.0967586077386676 0.0925909580231586 0.0872341910909644 0.0805247519679307 0.0722799108017525 0.0622956450311669 0.0503442936327458 0.0361719592084807 0.0194956311147006          0;          0 0.000136533932495003 0.000279965670288125 0.000430638097803985 0.000588910546456535 0.000755159518738118 0.000929779436900548 0.001113183416171 0.00130580406230389 0.00150809429310666 0.00172052818338924 0.00194360183257193 0.00217783425394026 0.00242376828425488 0.00268197151210586 0.00295303722303904 0.00323758535907234 0.00353626348975679 0.00384974779141464 0.0041787440305974 0.00452398854714383 0.00488624923147227 0.00526632648990431 0.00566505419087781 0.00608330058385414 0.00652196918154585 0.00698199959477134 0.00746436830776854 0.00797008938015086 0.00850021505984873 0.00905583628932592 0.00963808308506923 0.0102481247677966 0.0108871700179833 0.0115564667281373 0.0122573016197281 0.0129909995887458 0.0137589227395045 0.0145624690614456 0.0154030706983024 0.0162821917529876 0.0172013255649062 0.0181619913889939 0.0191657303975681 0.0202141009169576 0.0213086728007581 0.0224510208303294 0.023642717020696 0.0248853216961954 0.0261803731848998 0.0275293759638504 0.0289337870683187 0.0303950005574362 0.0319143298054136 0.033492987361944 0.0351320620969992 0.0368324933137795 0.038595041478752 0.0404202551791337 0.0423084338754669 0.044259585969632 0.046273381656285 0.0483490999677331 0.0504855693580945 0.0526811011015613 0.0549334147009726 0.0572395544159075 0.05959579592323 0.0619975420164882 0.0644392061326902 0.0669140823645612 0.0694142004720911 0.071930164247558 0.07445097141162 0.0769638130227327 0.0794538501660765 0.081903965449185 0.0842944865671283 0.0866028789077478 0.0888034038441066 0.0908667390037356 0.0927595564088161 0.0944440539441347 0.0958774351260815 0.0970113316112314 0.0977911622917795 0.0981554221713156 0.0980348934915354 0.0973517707812139 0.0960186906150499 0.0939376558929387 0.0909988433699963 0.0870792819733821 0.0820413881216137 0.0757313428023746 0.067977293551088 0.0585873626885457 0.0473474412037093 0.0340187454876225 0.0183351117142717          0;          0 0.000128285773187412 0.000263052647957376 0.000404622794723666 0.000553333837309366 0.000709539533292934 0.000873610477460676 0.00104593482831184 0.00122691905742955 0.00141698872137732 0.00161658925560428 0.0018261867896399 0.00204626898262805 0.00227734587798637 0.00251995077567772 0.00277464112024047 0.00304199940233935 0.00332263407116373 0.00361718045450887 0.00392630168282225 0.00425068961287396 0.00459106574600977 0.0049481821351586 0.00532282227388379 0.0057158019597782 0.00612797012339554 0.00656020961267061 0.00701343792139545 0.00748860784876942 0.00798670807531224 0.00850876363849929 0.00905583628932592 0.00962902470860838 0.0102294645591557 0.0108583283469694 0.0115168250613135 0.0122061995598098 0.0129277316606097 0.0136827348991335 0.0144725549017964 0.0152985673235052 0.0161621752894516 0.0170648062747733 0.0180079083479376 0.0189929456951311 0.0200213933334329 0.0210947309099949 0.0222144354727509 0.0233819730851944 0.0245987891433712 0.0258662972372729 0.0271858663811288 0.0285588064174833 0.0299863513782216 0.0314696405616271 0.0330096970578845 0.0346074034258943 0.0362634741915394 0.0379784248013031 0.0397525366249991 0.0415858175569415 0.0434779577156761 0.0454282796879312 0.047435682702151 0.0494985800502403 0.0516148290022844 0.053781652377268 0.0559955508423562 0.0582522049132023 0.060546365516995 0.0628717318574126 0.0652208151850759 0.0675847869271123 0.0699533094635147 0.0723143476544486 0.0746539590196374 0.076956060246403 0.0792021674545684 0.081371107371736 0.0834386962686521 0.0853773831683901 0.0871558534715306 0.0887385887286326 0.0900853778369377 0.0911507744358181 0.0918834947199354 0.0922257492747813 0.0921125018600595 0.0914706473153756 0.0902180999323769 0.0882627827194513 0.0855015069701257 0.0818187304241665 0.0770851810698045 0.0711563322639897 0.063870713331341 0.0550480381262474 0.0444871321895432 0.0319636370827095 0.017227468218049          0;          0 0.00012041479399283 0.000246913041298676 0.000379797145551557 0.000519384015650206 0.000666005704361466 0.000820010068612408 0.000981761451420668 0.00115164138528771 0.00133004931673559 0.00151740335150206 0.00171414101971905 0.00192072006018243 0.00213761922257376 0.0023653390862135 0.0026044028936061 0.00285535739667623 0.00311877371318676 0.00339524819036845 0.00368540327227132 0.00398988836676323 0.0043093807074435 0.00464458620500089 0.00499624028171706 0.00536510868188808 0.00575198824989659 0.00615770766650397 0.00658312813263074 0.00702914398843991 0.00749668325391491 0.00798670807531224 0.00850021505984873 0.00903823547873136 0.00960183531612812 0.0101921151388838 0.0108102097586735 0.0114572876548255 0.0121345501221928 0.012843230104173 0.0135845906662138 0.0143599230598556 0.0151705443214828 0.016017794343434 0.0169030323478726 0.0178276326857781 0.0187929798744925 0.0198004627773524 0.0208514678179513 0.0219473711093933 0.0230895293653869 0.0242792694450484 0.0255178763666793 0.0268065796073778 0.0281465374849492 0.029538819395981 0.0309843856589153 0.0324840646832126 0.0340385271549895 0.0356482568954876 0.0373135180110636 0.0390343179116756 0.0408103657286594 0.0426410256114641 0.0445252643264208 0.0464615925179782 0.0484479989235089 0.0504818767560596 0.0525599413845136 0.0546781383466743 0.0568315406268211 0.0590142340142646 0.0612191892321697 0.0634381193851363 0.0656613211182827 0.0678774977083023 0.0700735621164025 0.0722344178222543 0.0743427150249529 0.0763785795391498 0.0783193114293516 0.0801390501100198 0.0818084022903443 0.083294028756895 0.0845581855608722 0.0855582147050815 0.0862459789042921 0.0865672344160368 0.0864609353013717 0.0858584617701987 0.084682764486372 0.0828474158461054 0.0802555582905003 0.0767987386597259 0.0723556164319189 0.0667905324025008 0.0599519229364026 0.0516705633523202 0.0417576222587814 0.0300025067390226 0.016170476156104          0;          0 0.000112904986998339 0.000231514025753408 0.000356110660149103 0.00048699203469653 0.00062446949331017 0.000768869198420121 0.00092053277037306 0.00107981794695759 0.0012470992627544 0.00142276874785649 0.00160723664532635 0.00180093214655385 0.00200430414344654 0.00221782199612035 0.00244197631445969 0.00267727975157718 0.00292426780682015 0.00318349963553906 0.00345555886234549 0.00374105439403941 0.00404062122776852 0.00435492124929031 0.00468464401543079 0.0050305075139631 0.00539325889315431 0.00577367515213789 0.00617256378204934 0.00659076334649975 0.0070291439884399 0.00748860784876942 0.00797008938015086 0.00847455553737736 0.00900300582328938 0.00955647216661574 0.0101360186051975 0.0107427407448069 0.0113777649601631 0.0120422473007318 0.0127373720594328 0.0134643499574204 0.0142244158925915 0.0150188261933594 0.0158488553124353 0.0167157918878207 0.0176209340898426 0.0185655841637797 0.0195510420673249 0.0205785980907074 0.0216495243346263 0.0227650649071042 0.0239264246848 0.0251347564670596 0.0263911463318675 0.0276965969816642 0.0290520088435285 0.0304581586622132 0.0319156752957244 0.033425012391236 0.0349864175838085 0.0365998978212693 0.0382651803753127 0.039981669050938 0.0417483950532813 0.0435639619121618 0.0454264837996569 0.0473335165040772 0.0492819802440997 0.0512680734187217 0.0532871762912196 0.0553337434974496 0.0574011841495037 0.0594817281737358 0.0615662773761413 0.0636442395665436 0.0657033438943627 0.0677294353511068 0.0697062461761412 0.0716151416605239 0.0734348375763226 0.0751410861631321 0.076706327276499 0.0780993009413485 0.079284617153619 0.0802222783311288 0.0808671493257544 0.0811683693683584 0.0810686997201264 0.0805038001430198 0.0794014265712779 0.0776805415579376 0.0752503281770588 0.0720090970747457 0.0678430752702119 0.0626250641010566 0.0562129523724719 0.0484480692948572 0.0391533601634531 0.0281313659307397 0.0151619858293374          0;          0 0.000105740897817067 0.000216823911779637 0.000333514594239743 0.000456091235184578 0.000584845423018893 0.000720082624393093 0.000862122783032702 0.00101130093741525 0.00116796785701408 0.00133249069668307 0.00150525366858949 0.00168665873091171 0.00187712629230117 0.00207709593086136 0.00228702712611603 0.00250740000212204 0.00273871607952319 0.00298149903393689 0.00323629545760905 0.00350367562075916 0.00378423422845997 0.00407859116824799 0.00438739224293333 0.00471130988226219 0.00505104382617223 0.00540732177135923 0.00578089997173117 0.00617256378204934 0.00658312813263073 0.00701343792139545 0.00746436830776854 0.00793682489096837 0.00843174375300981 0.00895009134429662 0.00949286418694547 0.0100610883679441 0.0106558187908644 0.0112781381510921 0.0119291555953526 0.0126100050216716 0.0133218429707459 0.0140658460539716 0.014843207857013 0.0156551352507343 0.0165028440334768 0.0173875538199678 0.0183104820825017 0.0192728372393328 0.020275810673354 0.0213205675509835 0.0224082362965986 0.0235398965616932 0.0247165655100276 0.0259391822201947 0.0272085899850399 0.0285255162630192 0.0298905500096069 0.031304116086988 0.032766446417191 0.0342775475071872 0.0358371639339287 0.0374447373324015 0.0390993603800734 0.0407997252161081 0.0425440656728372 0.0443300926295992 0.0461549217245002 0.0480149925771363 0.0499059785840352 0.0518226862475586 0.0537589428872668 0.0557074714591134 0.0576597510710799 0.0596058616325762 0.0615343109075917 0.0634318420564928 0.065283219546636 0.0670709910855542 0.0687752229800536 0.0703732060476305 0.0718391289003566 0.073143715082709 0.074253820170312 0.0751319845224283 0.0757359369231216 0.0760180438396736 0.0759246984669903 0.0753956431077208 0.0743632177534048 0.0727515269752711 0.0704755163967042 0.0674399490944713 0.0635382712532315 0.0586513552673674 0.0526461072344009 0.045373924402622 0.0366689866081771 0.0263463640483889 0.0141999218715411          0;          0 9.89076202123026e-05 0.00020281213382874 0.000311961932452975 0.000426617322181609 0.000547051048147235 0.000673548836876386 0.000806409956420939 0.000945947794118965 0.00109249045172265 0.00124638135749481 0.00140797989471955 0.00157766204589435 0.00175582105166773 0.00194286808335569 0.00213923292760815 0.00234536468149966 0.00256173245598341 0.00278882608526878 0.00302715683925593 0.00327725813568057 0.00353968624808199 0.00381502100510076 0.00410386647593238 0.00440685163600006 0.00472463100605624 0.00505788525696622 0.00540732177135923 0.00577367515213788 0.00615770766650397 0.00656020961267061 0.00698199959477134 0.00742392468962701 0.00788686048696993 0.00837171098242962 0.0088794083000289 0.00941091221809554 0.009967209469332 0.0105493127822682 0.0111582596274132 0.0117951106270768 0.0124609475830061 0.0131568710706217 0.0138839975426873 0.0146434558786387 0.0154363833084698 0.0162639206319352 0.0171272066448063 0.0180273716739124 0.0189655301115948 0.0199427718279034 0.0209601523252225 0.0220186814848951 0.023119310738666 0.0242629184791983 0.0254502935033546 0.0266821162591565 0.0279589376421 0.0292811550585672 0.0306489854431254 0.0320624348822469 0.0335212644590478 0.0350249518916496 0.0365726484912829 0.0381631309147992 0.0397947471293086 0.0414653559436386 0.0431722593915653 0.0449121271745947 0.0466809122866778 0.0484737568487672 0.0502848870765919 0.0521074961893917 0.0539336139394289 0.0557539613005854 0.0575577886978325 0.0593326959862235 0.0610644321965731 0.0627366728531977 0.0643307724348606 0.0658254892910293 0.0671966800390859 0.0684169601513426 0.0694553270904085 0.0702767419640874 0.0708416652426605 0.0711055416077909 0.0710182284786182 0.0705233621816019 0.0695576550904923 0.0680501163550154 0.0659211880543164 0.0630817877460502 0.0594322474255232 0.0548611378518606 0.0492439660291577 0.0424417323382318 0.034299332385905 0.0246437870593957 0.0132822825274713          0;          0 9.23907889263928e-05 0.000189449235640913 0.000291407365706159 0.000398508334154837 0.00051100691547168 0.000629170010216494 0.000753277168249584 0.00088362112842506 0.00102050837450694 0.00116425970693581 0.00131521082992813 0.00147371295322375 0.00164013340760748 0.00181485627311467 0.00199828301858637 0.0021908331509618 0.00239294487238319 0.00260507574283379 0.00282770334563153 0.00306132595265198 0.00330646318564967 0.00356365666948053 0.0038334706723922 0.00411649272783703 0.00441333423146438 0.00472463100605624 0.00505104382617223 0.00539325889315431 0.00575198824989659 0.00612797012339554 0.00652196918154585 0.00693477668891935 0.00736721054433893 0.00782011518091517 0.00829436130682667 0.00879084546246848 0.00931048936663884 0.00985423902114879 0.0104230635395875 0.0110179536619177 0.0116399199120672 0.0122899903506765 0.0129692078696018 0.0136786269686021 0.0144193099477924 0.0151923224418438 0.0159987282134828 0.016839583114496 0.0177159281120743 0.0186287812668438 0.0195791285361833 0.0205679132623128 0.0215960241889845 0.0226642818332723 0.0237734230197433 0.0249240833630184 0.026116777461158 0.0273518765362081 0.0286295832293381 0.0299499032259946 0.0313126133510636 0.0327172257348069 0.0341629476069123 0.0356486362279388 0.03717274841424 0.0387332840535773 0.0403277229434892 0.041952954212391 0.043605197503614 0.0452799150143406 0.0469717133837482 0.0486742343166607 0.0503800327095073 0.0520804409132061 0.0537654176213806 0.0554233797105873 0.0570410151803638 0.0586030751430715 0.060092142594709 0.0614883754559039 0.0627692211046982 0.0639090993268269 0.0648790502819652 0.0656463437225734 0.0661740453018675 0.0664205353650304 0.0663389751286141 0.0658767146122223 0.0649746360885664 0.0635664261568257 0.0615777688132651 0.0589254510849093 0.05551637189861 0.0512464438700804 0.0459993766054888 0.039645328901001 0.0320394158911142 0.0230200557213325 0.0124071386898426          0;          0 8.61765709977572e-05 0.000176706852440527 0.000271807263817751 0.000371704605519197 0.000476636515860623 0.000586851943631284 0.000702611636127136 0.000824188642544299 0.000951868832504151 0.00108595142936289 0.00122674955782246 0.00137459080520441 0.00152981779557143 0.00169278877567972 0.00186387821151755 0.0020434773939263 0.00223199505150822 0.00242985796869541 0.00263751160648223 0.00285542072290528 0.00308406998988416 0.00332396460250802 0.00357563087625995 0.00383961682700667 0.00411649272783703 0.00440685163600006 0.00471130988226219 0.0050305075139631 0.00536510868188807 0.0057158019597782 0.00608330058385414 0.00646834259811729 0.00687169088939651 0.00729413309410828 0.00773648135647223 0.00819957191544575 0.00868426449488638 0.00919144146838549 0.009722006766811 0.0102768844928113 0.0108570172023276 0.0114633638084919 0.012096897058102 0.0127586005251097 0.0134494650591692 0.0141704846202084 0.0149226514221178 0.0157069502999389 0.0165243522052576 0.017375806723794 0.0182622334972899 0.01918451241863 0.0201434724545323 0.0211398789339727 0.0221744191225905 0.0232476858834745 0.0243601592027446 0.025512185333998 0.0267039532887294 0.0279354683699814 0.0292065224134309 0.0305166603635291 0.0318651427718107 0.0332509037596561 0.0346725039381758 0.0361280777229718 0.0376152744207676 0.0391311923976546 0.0406723055643046 0.0422343813311789 0.0438123890956899 0.0454003982225217 0.0469914643668547 0.0485775028669477 0.0501491477961544 0.0516955951136022 0.0532044281859201 0.0546614237678745 0.0560503363256915 0.0573526583611492 0.0585473541449294 0.0596105639917068 0.0605152759042375 0.0612309610762016 0.0617231693703628 0.0619530804759528 0.0618770059929248 0.0614458371862374 0.0606044325955557 0.0592909390690626 0.0574360391082657 0.0549621166568798 0.0517823326335054 0.047799600586493 0.042905451830849 0.0369787783010323 0.0298844401087102 0.0214717234184699 0.011572632733292          0;          0 8.02516558169187e-05 0.000164557690545813 0.000253119644143282 0.000346148723746115 0.000443866229274979 0.00054650399349277 0.000654304836483974 0.000767523034438211 0.000886424802525079 0.00101128879153697 0.00114240659784998 0.00128008328610843 0.00142463792387365 0.00157640412729032 0.00173573061661102 0.00190298178017892 0.00207853824519619 0.00226279745329872 0.0024561742386112 0.00265910140556713 0.00287203030333979 0.00309543139323839 0.00332979480487138 0.00357563087625995 0.0038334706723922 0.00410386647593238 0.00438739224293333 0.00468464401543079 0.00499624028171705 0.00532282227388379 0.00566505419087781 0.0060236233338123 0.00639924013860399 0.00679263808914385 0.007204573492136 0.00763582509243203 0.00808719350512157 0.00855950043778632 0.00905358767315279 0.00957031577885344 0.0101105625070906 0.0106752208426483 0.0112651966528671 0.0118814058878405 0.0125247712731366 0.0131962184307554 0.0138966713567058 0.0146270471754666 0.0153882500825937 0.0161811643767482 0.0170066464713577 0.0178655157638538 0.0187585442268385 0.0196864445704698 0.0206498568086742 0.0216493330433047 0.0226853202598985 0.0237581409060095 0.0248679709979869 0.0260148154742722 0.0271984804825059 0.0284185422536653 0.0296743121787346 0.0309647976616621 0.0322886582761533 0.0336441567027107 0.0350291038657473 0.0364407976279763 0.0378759543300008 0.0393306323863649 0.0408001470645163 0.0422789754793061 0.0437606507318558 0.0452376440068047 0.0467012333149518 0.0481413574278275 0.0495464533953613 0.0509032758659702 0.052196696238343 0.0534094794640188 0.0545220360874234 0.0555121468529929 0.0563546569247822 0.0570211364496548 0.0574795038476137 0.0576936078285527 0.0576227637098122 0.0572212391391239 0.0564376838081056 0.0552144971671726 0.0534871275177981 0.0511832951560819 0.0482221314655166 0.0445132249988603 0.0399555646405133 0.0344363688922111 0.0278297891656417 0.0199954736841405 0.0107769771790052          0;          0 7.46032441433424e-05 0.000152975504847661 0.000235304136933661 0.000321785481989938 0.000412625264021095 0.00050803899853313 0.000608252415024847 0.000713501892776664 0.000824034909738909 0.000940110504219065 0.00106199974894973 0.00118998623698461 0.0013243665787168 0.00146545090913899 0.00161356340426819 0.00176904280543319 0.00193224294987014 0.00210353330578618 0.00228329950972886 0.00247194390373697 0.00266988606934095 0.00287756335502358 0.00309543139323839 0.00332396460250802 0.00356365666948053 0.00381502100510076 0.00407859116824799 0.00435492124929031 0.00464458620500088 0.0049481821351586 0.00526632648990431 0.00559965819552841 0.00594883768481078 0.00631454681630297 0.00669748866501472 0.00709838716482249 0.00751798658053163 0.00795705078487111 0.00841636231275093 0.00889672116183508 0.00939894330484319 0.0099238588749503 0.0104723099811659 0.0110451481055902 0.0116432310289147 0.0122674192244015 0.0129185716537645 0.0135975408908319 0.0143051674904946 0.0150422735111667 0.0158096550886958 0.0166080739482578 0.0174382477281358 0.0183008389752815 0.0191964426570474 0.0201255720162934 0.021088642578043 0.0220859540947851 0.0231176701941801 0.0241837954670834 0.0252841497051896 0.0264183389659247 0.0275857231071509 0.0287853793954388 0.0300160617487095 0.0312761551265095 0.0325636245285784 0.0338759580041576 0.0352101030100793 0.0365623953844133 0.037928480123605 0.0393032230638175 0.0406806124707013 0.0420536494350783 0.0434142258539672 0.0447529886457865 0.0460591887041366 0.0473205129348158 0.0485228975440534 0.0496503205505576 0.0506845712779008 0.0516049943448247 0.0523882054068159 0.0530077756101279 0.0534338813963472 0.0536329159383696 0.0535670580936595 0.0531937943239381 0.0524653885475746 0.0513282943570874 0.049722503443912 0.0475808234200313 0.0448280775046121 0.0413802177462039 0.0371433425692994 0.0320126084592789 0.0258710245221433 0.0185881174641785 0.0100184532197909          0;          0 6.92190362788101e-05 0.000141935074558879 0.000218321948033123 0.000298561828076261 0.000382845591338518 0.00047137319930682 0.000564354090304476 0.000662007583828577 0.000764563297041469 0.000872261573137461 0.000985353921196714 0.00110410346701355 0.00122878541424425 0.00135968751505773 0.00149711054928926 0.00164136881088938 0.00179279060022582 0.0019517187205309 0.00211851097648835 0.00229354067261728 0.00247719710873315 0.00266988606934095 0.00287203030333979 0.00308406998988416 0.00330646318564967 0.00353968624808199 0.00378423422845997 0.00404062122776852 0.0043093807074435 0.00459106574600976 0.00488624923147227 0.00519552397802538 0.00551950275420317 0.00585881820798708 0.00621412267259887 0.00658608783471697 0.00697540424464055 0.00738278064546446 0.00780894309559198 0.00825463385587202 0.00872061000926965 0.00920764177722796 0.00971651049271373 0.0102480061853168 0.0108029247286418 0.0113820644945371 0.0119862224523936 0.012616189644738 0.0132727459625811 0.0139566541353704 0.0146686528408506 0.0154094488295548 0.0161797079469288 0.0169800449230962 0.0178110117858841 0.018673084736784 0.0195666493118676 0.0204919836301179 0.0214492395099861 0.0224384212109997 0.0234593615307085 0.0245116949578584 0.0255948275501567 0.0267079031689804 0.0278497656635263 0.0290189165527965 0.0302134677050015 0.0314310884599579 0.0326689465802918 0.033923642351145 0.0351911350749246 0.036466661126711 0.0377446426464147 0.0390185858447393 0.0402809677904655 0.0415231104254106 0.0427350404194012 0.0439053333293847 0.0450209403628803 0.0460669958646871 0.0470266034452878 0.047880598447688 0.0486072842042721 0.0491821392641663 0.0495774924718399 0.0497621624462249 0.0497010576431486 0.0493547327786658 0.0486788969428553 0.0476238682383055 0.0461339692298696 0.0441468568867955 0.0415927800289629 0.0383937565489256 0.0344626618633453 0.0297022191429716 0.0240038808704813 0.0172465901702021 0.00929540913188494          0;          0 6.40872195697059e-05 0.000131412177587368 0.000202135819460519 0.000276426810595651 0.000354461876276029 0.00043642615308267 0.000522513551831646 0.000612927131934375 0.000707879487010928 0.000807593141498134 0.000912300957893227 0.00102224655415829 0.00113768473067907 0.00125888190602227 0.00138611656056523 0.00151967968688025 0.00165987524553776 0.00180702062474771 0.00196144710198174 0.00212350030540762 0.00229354067261728 0.00247194390373697 0.00265910140556713 0.00285542072290528 0.00306132595265197 0.00327725813568057 0.00350367562075916 0.00374105439403941 0.00398988836676323 0.00425068961287395 0.00452398854714383 0.00481033403323061 0.00511029340974084 0.00542445242088992 0.0057534150366934 0.00609780314578126 0.00645825610187797 0.00683543010271147 0.00722999737758189 0.00764264515700496 0.00807407439471862 0.00852499820886772 0.00899614000532572 0.00948823124183195 0.010002008786872 0.0105382118219588 0.0110975782301241 0.0116808404069459 0.0122887204232466 0.0129219244606233 0.0135811364321344 0.0142670106906724 0.0149801637166967 0.0157211646649734 0.0164905246366455 0.0172886845281946 0.0181160012925081 0.0189727324291601 0.0198590185009626 0.0207748634516471 0.0217201124749533 0.0226944271581952 0.0236972575932525 0.0247278111145975 0.0257850172870675 0.0268674887252564 0.0279734772812116 0.0291008250871129 0.030246909884284 0.0314085840086675 0.0325821063351655 0.033763066408323 0.034946299903938 0.0361257944744996 0.0372945849299275 0.0384446365929118 0.0395667155440712 0.0406502443349212 0.0416831415948767 0.0426516437906651 0.0435401072109156 0.0443307880434225 0.0450035981856036 0.0455358341776767 0.0459018763705456 0.0460728551335071 0.0460162805675778 0.0456956318150706 0.0450699016412466 0.0440930915052534 0.0427136518305125 0.0408738616241405 0.0385091409752353 0.0355472892766939 0.0319076412577686 0.0275001320771908 0.022224261800977 0.0159679485656872 0.00860625859663587          0;          0 5.91964553896955e-05 0.000121383563843837 0.000186709988351724 0.000255331522756158 0.000327411405693754 0.000403120645197516 0.000482638353936866 0.000566152095008945 0.000653858238124142 0.000745962325947381 0.000842679450263296 0.000944234637526788 0.00105086324323885 0.00116281135444934 0.00128033619953149 0.00140370656419548 0.00153320321250733 0.00166911931145319 0.00181176085733317 0.00196144710198174 0.00211851097648835 0.00228329950972886 0.0024561742386112 0.00263751160648223 0.00282770334563153 0.00302715683925593 0.00323629545760905 0.00345555886234549 0.00368540327227131 0.00392630168282225 0.0041787440305974 0.00444323729316966 0.00472030551316 0.00501048973418913 0.00531434783479072 0.00563245424466839 0.0059653995257857 0.00631378979867324 0.00667824599199733 0.00705940289083433 0.0074579079562062 0.00787441988522498 0.00830960687763167 0.00876414457056149 0.00923871359897925 0.00973399673436027 0.0102506755487912 0.0107894265456756 0.0113509166915867 0.0119357982764459 0.0125447030210411 0.0131782353418547 0.0138369646731397 0.0145214167350781 0.0152320636245436 0.0159693125913605 0.0167334933478461 0.0175248437427032 0.0183434936118069 0.0191894465979262 0.0200625597087148 0.0209625203571764 0.0218888206009829 0.0228407282662334 0.0238172546071563 0.0248171181155376 0.0258387040519177 0.0268800192244089 0.0279386414898788 0.0290116633956994 0.0300956293177004 0.0311864653807572 0.0322794013718808 0.0333688837709836 0.0344484789308171 0.0355107653339532 0.0365472137400784 0.0375480539101102 0.0385021264534601 0.0393967181897337 0.0402173792447047 0.0409477199108039 0.041569185092704 0.0420608039267412 0.0423989119065598 0.0425568425639076 0.0425045854400894 0.04220840673705 0.0416304286539086 0.0407281629911484 0.0394539941363151 0.0377546060272798 0.0355703471166595 0.0328345267281201 0.0294726354956231 0.0254014818032093 0.020528235287841 0.0147493675225765 0.0079494789524113          0;          0 5.45358657355895e-05 0.000111826927756339 0.000172010144682 0.000235229044567377 0.000301634014125842 0.000371382597775657 0.000444639806486262 0.000521578436345111 0.000602379396700407 0.000687232047660003 0.000776334546640764 0.000869894203564387 0.00096812784418366 0.00107126218089583 0.00117953419025523 0.00129319149623367 0.00141249275809222 0.00153770806151911 0.0016691193114532 0.00180702062474771 0.0019517187205309 0.00210353330578618 0.00226279745329872 0.00242985796869541 0.00260507574283379 0.00278882608526878 0.00298149903393689 0.00318349963553906 0.00339524819036845 0.00361718045450887 0.00384974779141464 0.00409341726386282 0.00434867165613209 0.00461600941499706 0.00489594449671758 0.00518900610563512 0.00549573830824386 0.00581669950466522 0.0061524617372986 0.00650360981402595 0.00687074022068634 0.00725445979458154 0.00765538412749181 0.00807413566303899 0.00851134144919093 0.00896763050221661 0.00944363073342524 0.009939965384505 0.0104572489111568 0.0109960822479354 0.0115570473796887 0.012140701136651 0.0127475681210095 0.0133781326625279 0.0140328296894727 0.0147120343885268 0.0154160505134631 0.0161450971869443 0.0168992940227513 0.0176786443768547 0.0184830165148229 0.0193121224599123 0.0201654942605466 0.0210424573875283 0.021942100939921 0.0228632443037936 0.0238043998695623 0.0247637313711119 0.025739007362796 0.0267275492983215 0.0277261736178866 0.0287311271861836 0.0297380153533404 0.030741721832852 0.0317363195042477 0.0327149711527763 0.0336698190528104 0.0345918621848918 0.0354708197471921 0.0362949794793317 0.0370510291585515 0.037723869453556 0.0382964061281986 0.0387493193735888 0.0390608078110321 0.0392063044470715 0.0391581615731524 0.0388853012831846 0.0383528279292852 0.0375215984457257 0.036347746039628 0.0347821522699182 0.0327698620086657 0.0302494351958798 0.0271522286542694 0.0234016005178915 0.0189120290408666 0.0135881366815101 0.00732360939455952          0;          0 5.00950195524827e-05 0.000102720880229689 0.000158003388134479 0.000216074383856799 0.000277072008145771 0.000341140976604729 0.000408432863388203 0.000479106393827916 0.000553327745854907 0.000631270860015961 0.00071311775780351 0.000799058867927922 0.000889293360058166 0.000984029485439908 0.00108348492366734 0.00118788713473478 0.00129747371532407 0.00141249275809222 0.00153320321250733 0.00165987524553776 0.00179279060022582 0.00193224294987014 0.00207853824519619 0.00223199505150822 0.00239294487238319 0.00256173245598342 0.00273871607952319 0.00292426780682015 0.00311877371318676 0.00332263407116373 0.00353626348975679 0.00376009099890127 0.00399456006983493 0.00424012856089709 0.00449726857697762 0.00476646622939933 0.00504822128141519 0.00534304666272061 0.00565146783440062 0.00597402198353177 0.00631125702421365 0.00666373037909074 0.00703200751241035 0.00741666018231706 0.00781826437637036 0.00823739789015243 0.00867463750426241 0.0091305557099248 0.00960571692781831 0.0101006731585001 0.0106159589958917 0.0111520859276372 0.0117095358376577 0.0122887536168275 0.0128901387772789 0.0135140359543076 0.0141607241670691 0.0148304046951051 0.015523187412067 0.0162390754006493 0.0169779476535325 0.0177395396438697 0.0185234215253013 0.0193289736954264 0.0201553594278154 0.0210014942457271 0.0218660116753705 0.022747224977465 0.0236430844126 0.0245511295480471 0.0254684360607326 0.0263915564325125 0.0273164538690992 0.0282384287023194 0.0291520364561045 0.0300509966689267 0.0309280914684073 0.031775052786557 0.0325824369854751 0.0333394855321339 0.0340339702157876 0.0346520212410957 0.0351779363526261 0.0355939689502088 0.0358800929376733 0.0360137418076215 0.0359695191996596 0.0357188778762542 0.0352297637361377 0.0344662211267034 0.0333879553204851 0.0319498475826323 0.0301014177718458 0.0277862288816708 0.0249412273369571 0.0214960122057461 0.0173720257632414 0.0124816570446014 0.00672724913901542          0;          0 4.58639188893459e-05 9.40449202572108e-05 0.000144658184433874 0.000197824416554848 0.000253670089793907 0.000312327696856964 0.000373936009717586 0.000438640347527353 0.00050659285257942 0.000577952774140493 0.000652886759894107 0.000731569154655465 0.000814182305923867 0.00090091687573169 0.000991972158127351 0.00108755640149208 0.00118788713473478 0.00129319149623367 0.00140370656419548 0.00151967968688025 0.00164136881088938 0.00176904280543319 0.00190298178017892 0.0020434773939263 0.0021908331509618 0.00234536468149966 0.00250740000212204 0.00267727975157718 0.00285535739667623 0.00304199940233935 0.00323758535907234 0.00344250806029719 0.00365717352100423 0.00388200092812909 0.0041174225118729 0.00436388332586533 0.00462184092260368 0.00489176490897014 0.00517413636481656 0.00546944710559138 0.00577819876774564 0.00610090169316924 0.00643807358614905 0.0067902379132772 0.00715792201333798 0.00754165488043004 0.00794196457939602 0.00835937524799091 0.00879440363507436 0.0092475551184066 0.00971931913930294 0.010210163984392 0.0107205308369544 0.0112508270117124 0.011801418277403 0.0123726201609068 0.0129646881150018 0.0135778064188571 0.0142120756660304 0.014867498678847 0.0155439646704476 0.0162412314563206 0.0169589054955759 0.0176964195183631 0.0184530074694247 0.0192276764685553 0.0200191754563949 0.020825960158198 0.0216461539586265 0.0224775042367989 0.0233173336623649 0.0241624858997457 0.0250092651083681 0.0258533685610981 0.0266898116305011 0.0275128443122716 0.0283158583663833 0.0290912840582993 0.0298304753739734 0.0305235824622515 0.031159409925451 0.0317252594319976 0.032206754962559 0.0325876488214957 0.0328496063468266 0.0329719670322943 0.0329314795322841 0.0327020077518621 0.0322542049273431 0.0315551522745946 0.0305679584194102 0.0292513154231155 0.0275590067730361 0.0254393622171286 0.0228346537799933 0.0196804266982239 0.0159047583505622 0.0114274375259698 0.00615905556313799          0;          0 4.18329849729394e-05 8.57794063650127e-05 0.000131944321422579 0.00018043782662763 0.000231375279553309 0.000284877528254248 0.000341071148174181 0.000400088686509936 0.000462068913920836 0.00052715708341496 0.00059550519617777 0.000667272274033199 0.000742624638141384 0.000821736193439549 0.00090478871822171 0.000991972158127351 0.00108348492366734 0.00117953419025523 0.00128033619953149 0.00138611656056523 0.00149711054928926 0.00161356340426819 0.00173573061661102 0.00186387821151755 0.00199828301858637 0.00213923292760815 0.00228702712611603 0.00244197631445969 0.0026044028936061 0.00277464112024047 0.00295303722303904 0.00313994947320318 0.00333574820147218 0.00354081575286156 0.00375554636929278 0.00398034598907753 0.00421563195088219 0.00446183258831022 0.00471938669958688 0.00498874287499321 0.00527035866265477 0.00556469955102367 0.00587223774387528 0.00619345070084698 0.00652881941344525 0.00687882638300699 0.00724395326328446 0.00762467812609008 0.00802147230374357 0.00843479675685973 0.00886509791024665 0.00931280289328995 0.00977831411411346 0.0102620030889562 0.0107642034395071 0.0112852029613051 0.0118252346556392 0.0123844666055668 0.0129629905635787 0.0135608091039486 0.0141778211767636 0.0148138058828662 0.0154684042692812 0.0161410989229375 0.0168311911164072 0.0175377752327323 0.0182597101669074 0.0189955873689484 0.0197436951573605 0.0205019788918566 0.0212679965499703 0.0220388692032971 0.0228112258349919 0.023581141880301 0.0243440708057047 0.0250947679690198 0.0258272059218201 0.0265344802259593 0.0272087047569098 0.0278408953570748 0.0284208405810662 0.0289369581409594 0.0293761355113692 0.0297235529903603 0.0299624873310378 0.0300740938583561 0.0300371647641894 0.0298278610288224 0.0294194151462511 0.0287818015313247 0.027881371155784 0.0266804465943305 0.0251368732573214 0.0232035221394375 0.0208277389192451 0.0179507336979676 0.0145069050615267 0.0104230914819219 0.00561774233557923          0;          0 3.799304427606e-05 7.79055280446339e-05 0.000119832865118889 0.000163875045985223 0.000210136839294185 0.000258728000194572 0.000309763485494776 0.000363363675596077 0.000419654603097088 0.000478768187916283 0.000540842478719637 0.000606021900371918 0.000674457507052148 0.00074630724058504 0.000821736193439548 0.00090091687573169 0.000984029485439907 0.00107126218089583 0.00116281135444934 0.00125888190602227 0.00135968751505773 0.00146545090913899 0.00157640412729032 0.00169278877567972 0.00181485627311467 0.00194286808335569 0.00207709593086136 0.00221782199612035 0.0023653390862135 0.00251995077567772 0.00268197151210585 0.00285172668020629 0.00302955261725411 0.00321579657198409 0.00341081659799405 0.00361498137163495 0.00382866992314908 0.00405227126846661 0.00428618392756912 0.00453081531365985 0.00478658097552655 0.00505390367342363 0.00533321226651468 0.00562494038737826 0.00592952487626409 0.00624740394466169 0.00657901503427757 0.00692479233367249 0.00728516391054714 0.0076605484129387 0.00805135128735095 0.00845796045603398 0.00888074138919453 0.0093200315007878 0.00977613378864214 0.0102493096309178 0.0107397706412087 0.0112476694738627 0.0117730894592098 0.0123160329352255 0.0128764081275884 0.0134540144139551 0.014048525790425 0.0146594723383982 0.0152862194681576 0.0159279446912958 0.0165836116473184 0.0172519410801087 0.0179313784271399 0.0186200576480265 0.0193157608788569 0.0200158734543281 0.0207173337905644 0.0214165775671489 0.0221094755867643 0.0227912646243429 0.0234564705040623 0.0240988225611737 0.0247111585556761 0.0252853190053431 0.0258120297955736 0.0262807718018482 0.026679636126013 0.0269951633988127 0.0272121654365661 0.0273135273579457 0.0272799880656705 0.0270898967755059 0.0267189430290556 0.0261398573549498 0.0253220794424351 0.0242313903590473 0.0228295049766327 0.0210736203637979 0.0189159154538213 0.0163029968006303 0.0131752846866585 0.00946633323972094 0.00510207754539209          0;          0 3.43353146455685e-05 7.04052773082774e-05 0.000108296115963774 0.000148098194647832 0.000189906195548996 0.000233819307285596 0.000279941419352724 0.000328381322689191 0.000379252916273387 0.000432675419609701 0.000488773590913038 0.000547677950737066 0.000609525010721325 0.000674457507052148 0.000742624638141384 0.000814182305923867 0.000889293360058166 0.00096812784418366 0.00105086324323885 0.00113768473067907 0.00122878541424425 0.0013243665787168 0.00142463792387365 0.00152981779557143 0.00164013340760748 0.00175582105166773 0.00187712629230117 0.00200430414344654 0.00213761922257376 0.00227734587798637 0.00242376828425488 0.00257718050010915 0.002737886482402 0.00290620004895971 0.00308244478224786 0.00326695386479376 0.003460069836209 0.00366214426043426 0.00387353729047179 0.00409461711636243 0.004325759280489 0.00456734584242666 0.00481976437349539 0.005083406758876 0.00535866778260618 0.00564594346794918 0.00594562914249502 0.00625811719388027 0.00658379447815905 0.00692303933858751 0.00727621818784842 0.00764368160149495 0.00802575986457747 0.00842275790697298 0.0088349495557983 0.00926257102538014 0.00970581355649608 0.0101648151069004 0.0106396509844068 0.0111303233019054 0.0116367491205249 0.0121587471325703 0.0126960227197316 0.0132481512041947 0.0138145590905208 0.0143945030742761 0.0149870465691896 0.0155910334778198 0.0162050589010725 0.0168274364491097 0.0174561617799081 0.0180888719515768 0.0187228001301418 0.019354725145377 0.0199809153329261 0.0205970660408574 0.0211982301123198 0.0217787405824441 0.0223321247463263 0.0228510086650014 0.0233270110768738 0.023750625572098 0.0241110897657957 0.0243962400715231 0.0245923505277122 0.0246839539653931 0.0246536436237187 0.0244818531188105 0.0241466124492086 0.0236232774755041 0.0228842300400744 0.0218985455925083 0.0206316248542678 0.0190447856890529 0.0170948109395165 0.0147334475423455 0.0119068517377643 0.00855497464125107 0.00461088183916632          0;          0 3.08513915462525e-05 6.32614204815651e-05 9.73075654330136e-05 0.000133071021411568 0.000170636863428233 0.000210094215667031 0.000251536426201914 0.000295061247212659 0.000340771020617937 0.000388772869001241 0.000439178891656734 0.000492106365526468 0.000547677950737066 0.000606021900371918 0.000667272274033199 0.000731569154655465 0.000799058867927922 0.000869894203564386 0.000944234637526788 0.00102224655415829 0.00110410346701355 0.00118998623698462 0.00128008328610843 0.00137459080520441 0.00147371295322375 0.00157766204589435 0.00168665873091171 0.00180093214655385 0.00192072006018243 0.00204626898262805 0.00217783425394026 0.00231568009540568 0.0024600796220948 0.00261131480948192 0.0027696764068858 0.00293546378959144 0.00310898474052688 0.00329055515127195 0.0034804986309563 0.00367914601024892 0.003886834726136 0.00410390807151202 0.00433071429175256 0.00456760550837681 0.00481493644762068 0.00507306294920434 0.00534234022776308 0.00562312085628882 0.00591575243746763 0.00622057492496108 0.00653791755242435 0.00686809532333914 0.00721140500951359 0.00756812060031189 0.00793848813826153 0.00832271986958064 0.00872098763029781 0.00913341537992059 0.00956007078495698 0.0100009557439072 0.010455995733511 0.0109250278429359 0.0114077873480944 0.011903892662225 0.0124128284811133 0.0129339269216671 0.013466346430807 0.0140090482175625 0.0145607699346246 0.0151199963061404 0.0156849263659269 0.0162534369342133 0.0168230419211196 0.0173908470009373 0.0179534991524589 0.0185071305065943 0.0190472958827871 0.019568903329679 0.0200661369124104 0.0205323709081476 0.0209600744820693 0.0213407058172337 0.0216645945624794 0.021920811341686 0.0220970229341138 0.0221793315878147 0.0221520967647601 0.0219977374357264 0.0216965128432949 0.0212262794305457 0.0205622213889329 0.0196765520089716 0.0185381827190147 0.0171123563675649 0.0153602409399284 0.013238479496903 0.0106986916775599 0.0076869216155432 0.00414302657371992          0;          0 2.75332344682348e-05 5.64574703316453e-05 8.68418531651517e-05 0.000118758845219649 0.000152284371440755 0.000187497970446747 0.000224482950454155 0.000263326550110922 0.000304120104164087 0.000346959213851076 0.000391943921860249 0.000439178891656734 0.000488773590913038 0.000540842478719637 0.00059550519617777 0.000652886759894107 0.00071311775780351 0.000776334546640763 0.000842679450263296 0.000912300957893228 0.000985353921196714 0.00106199974894973 0.00114240659784998 0.00122674955782246 0.00131521082992813 0.00140797989471955 0.00150525366858949 0.00160723664532635 0.00171414101971905 0.0018261867896399 0.00194360183257193 0.00206662195203229 0.00219549088876965 0.00233046029097423 0.00247178963702815 0.00261974610353198 0.00277460437046278 0.00293664635434033 0.0031061608591892 0.00328344313387572 0.00346879432305474 0.00366252079746941 0.0038649333476902 0.00407634622354063 0.00429707599941608 0.00452744024343772 0.00476775596587153 0.00501833781945656 0.0052794960211969 0.00555153396174701 0.00583474546472291 0.00612941165406373 0.00643579738290472 0.00675414717225539 0.0070846806020523 0.00742758709081423 0.00778301999310406 0.00815108993622304 0.00853185730894901 0.00892532380559299 0.00933142291808846 0.00975000925713792 0.0101808465705009 0.0106235943121843 0.011077792600444 0.0115428453849606 0.0120180016241415 0.0125023342520123 0.0129947166903965 0.0134937966357753 0.0139979668211277 0.0145053324208555 0.0150136747312908 0.0155204107198908 0.0160225479926512 0.0165166346810757 0.0169987036967324 0.017464210742472 0.0179079654041798 0.0183240545748239 0.0187057573828167 0.0190454507085237 0.0193345042752357 0.0195631641930879 0.0197204237151766 0.0197938798332812 0.0197695741948227 0.019631816661511 0.0193629896519228 0.0189433312132228 0.0183506945494007 0.0175602814925617 0.0165443471375478 0.0152718725658061 0.0137082022589999 0.0118146424431032 0.00954801620601095 0.00686017079204979 0.00369743199075291          0;          0 2.43731535382306e-05 4.99776586132966e-05 7.68747247324196e-05 0.000105128497412859 0.000134806187441603 0.000165978204525063 0.000198718295318571 0.000233103685800179 0.000269215227924116 0.000307137550455699 0.000346959213851076 0.000388772869001241 0.000432675419609701 0.000478768187916282 0.00052715708341496 0.000577952774140493 0.000631270860015961 0.000687232047660002 0.000745962325947381 0.000807593141498134 0.000872261573137461 0.000940110504219065 0.00101128879153697 0.00108595142936289 0.00116425970693581 0.00124638135749481 0.00133249069668307 0.00142276874785649 0.00151740335150206 0.00161658925560428 0.00172052818338924 0.00182942887441986 0.00194350709450809 0.00206298560934406 0.00218809411611264 0.00231906912666697 0.00245615379504922 0.00259959768128218 0.00274965644239161 0.00290659144054907 0.00307066925703539 0.00324216109940416 0.00342134208775799 0.00360849040442257 0.0038038862894966 0.00400781086275136 0.00422054475012981 0.00444236649062923 0.00467355069661597 0.00491436593758961 0.00516507231405215 0.00542591868441285 0.00569713950373139 0.00597895122852744 0.00627154823681764 0.00657509820692712 0.00688973689240534 0.00721556222349009 0.00755262765793825 0.00790093469559913 0.0082604244617583 0.00863096825393167 0.00901235693533448 0.0094042890455704 0.00980635748505306 0.0102180346141417 0.0106386555907859 0.0110673997514579 0.0115032698191069 0.0119450686985885 0.0123913735942654 0.0128405071559778 0.0132905053280601 0.0137390815412088 0.0141835868484359 0.0146209655636776 0.015047705914441 0.0154597851676805 0.0158526086303793 0.0162209418624739 0.0165588353691709 0.0168595409616403 0.0171154188887459 0.0173178347470164 0.0174570450705125 0.017522070385535 0.0175005543860734 0.0173786077432143 0.0171406349039725 0.0167691420605926 0.0162445242785305 0.0155448295581305 0.014645497369314 0.0135190689380181 0.0121348662750535 0.0104586366195831 0.00845215861736488 0.00607280616471044 0.00327306541887608          0;          0 2.13637963683983e-05 4.38069091022232e-05 6.73829901610392e-05 9.21482650048194e-05 0.00011816164589392 0.000145484849037029 0.000174182515578138 0.000204322336391423 0.000235975180627377 0.000269215227924116 0.000304120104164087 0.000340771020617937 0.000379252916273387 0.000419654603097088 0.000462068913920836 0.00050659285257942 0.000553327745854907 0.000602379396700406 0.000653858238124142 0.000707879487010928 0.000764563297041469 0.000824034909738909 0.000886424802525079 0.000951868832504151 0.00102050837450694 0.00109249045172265 0.00116796785701408 0.0012470992627544 0.00133004931673559 0.00141698872137732 0.00150809429310666 0.00160354899837928 0.00170354196236777 0.00180826844584685 0.00191792978525317 0.0020327332902835 0.00215289209271152 0.00227862493934402 0.00241015592119286 0.00254771413000043 0.00269153323221414 0.0028418509493475 0.00299890843238002 0.00316294951642108 0.00333421984027954 0.00351296581382348 0.00369943341406579 0.00389386678874912 0.004096506643807 0.0043075883884199 0.00452734000843918 0.00475597963568646 0.00499371277701767 0.00524072916303133 0.00549719917185926 0.00576326977855692 0.0060390599751613 0.00632465560044803 0.00662010351173621 0.0069254050236885 0.00724050853086089 0.00756530122168562 0.00789959978153021 0.00824313997136174 0.00859556495624496 0.00895641224428999 0.00932509908160091 0.00970090613210714 0.0100829592527149 0.010470209153809 0.0108614087125573 0.0112550876814928 0.0116495245072174 0.0120427149435056 0.0124323371092781 0.0128157126045188 0.0131897632558466 0.0135509630177092 0.0138952845045723 0.0142181395735251 0.014514313314849 0.0147778907396692 0.0150021753781456 0.015179598917986 0.0153016209205506 0.0153586175495159 0.0153397581339528 0.0152328682626128 0.0150242779679348 0.014698653405408 0.0142388102648954 0.0136255069636537 0.0128372154641854 0.0118498673316578 0.0106365723931187 0.00916730708159602 0.00740856923957554 0.00532299581521639 0.00286893950754603          0;          0 1.84981351707261e-05 3.7930811172836e-05 5.83444832890466e-05 7.97878351025882e-05 0.000102311876599537 0.000125970045602967 0.000150818312531176 0.000176915288453036 0.000204322336391423 0.000233103685800179 0.000263326550110922 0.000295061247212659 0.000328381322689191 0.000363363675596077 0.000400088686509936 0.000438640347527352 0.000479106393827916 0.000521578436345111 0.000566152095008945 0.000612927131934375 0.000662007583828577 0.000713501892776664 0.000767523034438211 0.000824188642544298 0.00088362112842506 0.000945947794118964 0.00101130093741525 0.00107981794695759 0.00115164138528771 0.00122691905742954 0.00130580406230389 0.0013884548239179 0.00147503509888798 0.0015657139564255 0.00166066572643683 0.00176006991085724 0.00186411105274689 0.00197297855701914 0.00208686645594038 0.00220597311172789 0.00233050084766985 0.00246065549818885 0.0025966458671575 0.00273868308253897 0.00288697983405426 0.00304174947905659 0.00320320500010552 0.00337155779586203 0.0035470162848496 0.00372978429932561 0.0039200592439565 0.00411802999116231 0.00432387448186393 0.00453775699689408 0.00475982506048759 0.00499020593300569 0.00522900264533043 0.00547628952213931 0.00573210713548268 0.00599645662367919 0.00626929330344959 0.00655051949535558 0.00683997647391635 0.0071374354441526 0.00744258743565698 0.00775503199350349 0.00807426453226393 0.00839966220496686 0.00873046812286328 0.00906577374419402 0.00940449923060423 0.00974537154822345 0.0100869000665049 0.0104273493814522 0.0107647090605883 0.0110966599746401 0.0114205368451009 0.0117332865972214 0.0120314220641743 0.0123109705396914 0.0125674166228947 0.0127956387397975 0.0129898386604348 0.0131434632581346 0.0132491176773361 0.0132984689877818 0.0132821393049712 0.0131895872484765 0.0130089764899897 0.0127270300105971 0.0123288685404234 0.0117978314919799 0.0111152785196688 0.0102603696401274 0.00920982162946329 0.00793763817173245 0.00641481096581086 0.00460898870243558 0.00248411049665896          0;          0 1.57694541597693e-05 3.23355939673038e-05 4.97380220335977e-05 6.80182405710092e-05 8.72197350244055e-05 0.000107388060542649 0.000128570931283814 0.000150818312531176 0.000174182515578138 0.000198718295318571 0.000224482950454155 0.000251536426201914 0.000279941419352724 0.000309763485494776 0.00034107114817418 0.000373936009717585 0.000408432863388203 0.000444639806486261 0.000482638353936866 0.000522513551831646 0.000564354090304476 0.000608252415024847 0.000654304836483973 0.000702611636127135 0.000753277168249583 0.000806409956420939 0.000862122783032702 0.000920532770373059 0.000981761451420666 0.00104593482831184 0.00111318341617099 0.00118364226969936 0.00125745098958814 0.00133475370545656 0.00141569903160772 0.00150043999144174 0.00158913390586157 0.00168194224044584 0.00177903040554007 0.00188056750272471 0.001986726010349 0.00209768139996515 0.00221361167454844 0.00233469681833548 0.002461118146944 0.00259305754514076 0.00273069657818513 0.00287421546108056 0.00302379186829649 0.0031795995645616 0.0033418068351549 0.0035105746917104 0.00368605482688085 0.00386838728824602 0.00405769783857265 0.00425409496590098 0.00445766650291018 0.00466847581055982 0.00488655747607083 0.0051119124698472 0.00534450269989113 0.00558424489556965 0.00583100374517861 0.00608458420354698 0.00634472287684449 0.00661107838170787 0.00688322056468079 0.00716061845565874 0.0074426268154151 0.00772847112222155 0.00801723082591019 0.00830782067928834 0.00859896993642081 0.00888919918473351 0.00917679455293636 0.00945977900915968 0.0097358804331683 0.0100024961127503 0.0102566532770333 0.0104949652381805 0.0107135826672457 0.0109081394794611 0.0110736927483747 0.0112046560065022 0.0112947252218581 0.0113367966642286 0.0113228757915489 0.0112439761944373 0.0110900075348707 0.010849651302134 0.0105102230844168 0.0100575199164877 0.00947565111138201 0.00874685081544496 0.00785127033968862 0.00676674811437527 0.0054685548859555 0.00392911152368336 0.0021176765248671          0;          0 1.31713372620412e-05 2.70081011934032e-05 4.15433696254795e-05 5.68118070197377e-05 7.28497343201076e-05 8.96952011777445e-05 0.000107388060542649 0.000125970045602968 0.000145484849037029 0.000165978204525063 0.000187497970446747 0.000210094215667032 0.000233819307285596 0.000258728000194572 0.000284877528254248 0.000312327696856965 0.000341140976604729 0.000371382597775658 0.000403120645197516 0.000436426153082671 0.00047137319930682 0.00050803899853313 0.000546503993492771 0.000586851943631284 0.000629170010216494 0.000673548836876387 0.000720082624393093 0.000768869198420121 0.000820010068612408 0.000873610477460677 0.000929779436900549 0.000988629750520566 0.00105027801891877 0.00111484462545181 0.0011824536992803 0.00125323305223536 0.00132731408561029 0.00140483166251262 0.00148592394089162 0.00157073216177725 0.00165940038662435 0.00175207517694169 0.00184890520859321 0.00195004081227888 0.0020556334307264 0.00216583498204158 0.00228079711746372 0.00240067036043936 0.00252560311244998 0.00265574050939077 0.00279122311048105 0.002932185399674 0.00307875407730236 0.00323104611722506 0.00338916656200089 0.00355320602558213 0.00372323786966084 0.00389931501607941 0.0040814663535963 0.0042696926927353 0.0044639622173952 0.00466420537630428 0.00487030915121391 0.0050821106318735 0.00529938982024534 0.00552186157802545 0.0057491666222488 0.00598086146347994 0.00621640716971892 0.00645515682657053 0.00669634155030518 0.00693905489504068 0.00718223547823853 0.00742464762986441 0.00766485984971818 0.00790122083438319 0.00813183280974408 0.00835452187681922 0.0085668050474616 0.00876585361198674 0.00894845244263779 0.00911095479461223 0.00924923211972462 0.00935861835619517 0.00943384810101456 0.00946898800826491 0.00945736068704063 0.00939146029550731 0.00926285894238562 0.00906210291289127 0.00877859763195314 0.00840048016231993 0.00791447790779294 0.00730575205100636 0.00655772409950126 0.00565188374174022 0.00456757602445491 0.00328176565239866 0.00176877597907548          0;          0 1.06976561463838e-05 2.19357665805448e-05 3.37411968560157e-05 4.61421011747509e-05 5.91679791206833e-05 7.28497343201077e-05 8.72197350244057e-05 0.000102311876599537 0.00011816164589392 0.000134806187441603 0.000152284371440755 0.000170636863428233 0.000189906195548996 0.000210136839294186 0.000231375279553309 0.000253670089793907 0.000277072008145771 0.000301634014125843 0.000327411405693755 0.000354461876276029 0.000382845591338519 0.000412625264021096 0.00044386622927498 0.000476636515860624 0.00051100691547168 0.000547051048147236 0.000584845423018894 0.000624469493310171 0.000666005704361467 0.000709539533292935 0.000755159518738119 0.000802957278881133 0.000853027515807232 0.000905468003928354 0.000960379559968835 0.00101786599168894 0.00107803402218176 0.00114099318619861 0.00120685569453521 0.00127573626204111 0.00134775189429268 0.00142302162739034 0.0015016662146971 0.00158380775362073 0.00166956924474914 0.0017590740747686 0.00185244541361848 0.00194980551525379 0.00205127491018628 0.00215697147664428 0.00226700937571611 0.00238149783420689 0.00250053975712668 0.00262423014972026 0.00275265432672466 0.0028858858840766 0.00302398440556323 0.00316699287388716 0.00331493475226994 0.00346781069901262 0.00362559487332895 0.00378823078622509 0.00395562664517171 0.00412765013574932 0.00430412257728841 0.00448481238270946 0.00466942774522453 0.00485760846621517 0.00504891682936548 0.00524282741591057 0.00543871574455504 0.00563584560710908 0.00583335495705374 0.00603024019294184 0.00622533866161146 0.00641730918746337 0.0066046104133426 0.00678547671565758 0.00695789143103663 0.00711955710380456 0.00726786243257829 0.00739984556001754 0.00751215331187787 0.00760099594961681 0.00766209695447661 0.00769063730974209 0.00768119369123273 0.00762766991346362 0.00752322090966957 0.00736016844733281 0.00712990769621678 0.006822803672335 0.0064280764778321 0.00593367414238492 0.00532613174529308 0.00459041535765097 0.00370974918946942 0.0026654241557955 0.00143658588704308          0;          0 8.34255858616249e-06 1.71065900162103e-05 2.63130453705698e-05 3.59838806811079e-05 4.61421011747509e-05 5.68118070197378e-05 6.80182405710093e-05 7.97878351025883e-05 9.21482650048195e-05 0.00010512849741286 0.00011875884521965 0.000133071021411568 0.000148098194647832 0.000163875045985223 0.00018043782662763 0.000197824416554848 0.000216074383856799 0.000235229044567378 0.000255331522756158 0.000276426810595652 0.000298561828076262 0.000321785481989939 0.000346148723746116 0.000371704605519197 0.000398508334154837 0.00042661732218161 0.000456091235184579 0.00048699203469653 0.000519384015650207 0.000553333837309366 0.000588910546456536 0.000626185591459289 0.000665232825663037 0.000706128498364698 0.000748951231406076 0.000793781979185956 0.000840703969623089 0.000889802623305643 0.000941165447732885 0.000994881903188446 0.00105104323637743 0.00110974227750751 0.00117107319599221 0.00123513120939729 0.0013020122396328 0.00137181250970731 0.00144462807359948 0.00152055427095832 0.00159968509740696 0.00168211248018746 0.00176792544773318 0.00185720918048072 0.00195004392881982 0.00204650378251461 0.00214665527419451 0.00225055579759186 0.00235825181907541 0.0024697768586714 0.00258514921415439 0.0027043693988999 0.00282741726099147 0.00295424874753244 0.00308479227419227 0.00321894465567679 0.00335656654800885 0.00349747734818978 0.0036414494909295 0.00378820207562361 0.0039373937495534 0.00408861476531547 0.00424137812167128 0.00439510968725307 0.0045491371957728 0.00470267798944489 0.0048548253741313 0.00500453343511412 0.00515060014624932 0.00529164858739176 0.00542610606522465 0.00555218091077796 0.00566783670275751 0.00577076363908637 0.00585834674951302 0.00592763060946741 0.00597528017921813 0.0059975373524357 0.00599017275409737 0.0059484322788305 0.00586697780679528 0.00573982147450632 0.00556025281198873 0.00532075798468995 0.00501293029789286 0.00462737103218418 0.00415357957992951 0.00357983174370102 0.00289304493709859 0.00207862889519152 0.00112032035454442          0;          0 6.10045716107492e-06 1.2509114378778e-05 1.92412920332179e-05 2.63130453705698e-05 3.37411968560157e-05 4.15433696254795e-05 4.97380220335979e-05 5.83444832890467e-05 6.73829901610393e-05 7.68747247324197e-05 8.68418531651519e-05 9.73075654330137e-05 0.000108296115963774 0.000119832865118889 0.000131944321422579 0.000144658184433874 0.000158003388134479 0.000172010144682 0.000186709988351724 0.000202135819460519 0.000218321948033123 0.000235304136933661 0.000253119644143283 0.000271807263817752 0.00029140736570616 0.000311961932452975 0.000333514594239743 0.000356110660149103 0.000379797145551558 0.000404622794723667 0.000430638097803985 0.000457895301078963 0.000486448409463905 0.000516353179902512 0.000547667104250899 0.000580449380036619 0.00061476086728813 0.000650664029413199 0.000688222855863627 0.000727502764055697 0.000768570477718087 0.000811493878508366 0.000856341827372145 0.000903183951711483 0.000952090393976935 0.00100313151679593 0.00105637755919359 0.00111189823784476 0.00116976228661166 0.00123003692686243 0.00129278726022487 0.00135807557449702 0.00142596055240311 0.00149649637173852 0.00156973168417904 0.00164570845862449 0.00172446067339087 0.00180601283984146 0.00189037833813879 0.00197755754368633 0.00206753572048889 0.00216028065507071 0.00225574000172305 0.00235383830667951 0.00245447367530495 0.00255751404249666 0.00266279300219478 0.00277010514713895 0.00287920086474138 0.00298978052911928 0.00310148802288221 0.00321390351513805 0.0033265354142907 0.00343881140547494 0.0035500684728198 0.0036595417960528 0.00376635239914732 0.00386949341565191 0.00396781482089397 0.00406000646527305 0.0041445792251901 0.00421984406862031 0.00428388881073068 0.00433455231105141 0.00436939583729167 0.00438567129167873 0.00438028596339994 0.00434976343501509 0.00429020023122134 0.00419721775469731 0.00406590900548732 0.00389077952702509 0.00366568196290211 0.00338374354326516 0.00303728574762472 0.00261773531114629 0.00211552565337788 0.00151998771095491 0.000819229048138136          0;          0 3.96601830370738e-06 8.13240307725738e-06 1.25091143787779e-05 1.71065900162102e-05 2.19357665805448e-05 2.70081011934032e-05 3.23355939673039e-05 3.79308111728361e-05 4.38069091022233e-05 4.99776586132966e-05 5.64574703316454e-05 6.32614204815652e-05 7.04052773082774e-05 7.79055280446339e-05 8.57794063650128e-05 9.40449202572109e-05 0.000102720880229689 0.000111826927756339 0.000121383563843837 0.000131412177587368 0.000141935074558879 0.000152975504847661 0.000164557690545813 0.000176706852440527 0.000189449235640913 0.00020281213382874 0.000216823911779637 0.000231514025753408 0.000246913041298676 0.000263052647957376 0.000279965670288125 0.000297686074553268 0.000316248970331798 0.000335690606228276 0.000356048358745422 0.000377360713274019 0.000399667236026969 0.000423008535603263 0.000447426212710911 0.00047296279640364 0.000499661664992654 0.000527566949579821 0.000556723417919997 0.000587176336055335 0.000618971304870395 0.000652154068390736 0.000686770290285797 0.000722865294635602 0.000760483766575776 0.000799669407942007 0.000840464542488177 0.000882909664646189 0.000927042925123812 0.000972899545892534 0.00102051115629283 0.00106990504107084 0.00112110329014861 0.00117412183880981 0.00122896938574179 0.00128564617500119 0.00134414262644915 0.0014044377975184 0.00146649765731035 0.00153027315195729 0.00159569803790116 0.0016626864572135 0.00173113022628416 0.00180089580611222 0.00187182091900837 0.00194371077272931 0.00201633384887382 0.00208941720773285 0.00216264125665675 0.00223563392332849 0.00230796416905531 0.00237913477024896 0.00244857428858634 0.00251562814185004 0.00257954867805581 0.00263948414508758 0.00269446643657325 0.00274339748203235 0.0027850341352797 0.00281797139953654 0.00284062381052573 0.00285120477983604 0.00284770367984284 0.00282786042825472 0.00278913730468609 0.00272868770327403 0.00264332149397965 0.00252946663052257 0.00238312660454419 0.00219983330319406 0.0019745947804585 0.00170183740072981 0.00137534175582684 0.000988171693348185 0.000532595724231284          0;          0 1.93415169365247e-06 3.96601830370738e-06 6.10045716107491e-06 8.34255858616248e-06 1.06976561463838e-05 1.31713372620412e-05 1.57694541597693e-05 1.84981351707261e-05 2.13637963683984e-05 2.43731535382306e-05 2.75332344682348e-05 3.08513915462525e-05 3.43353146455685e-05 3.799304427606e-05 4.18329849729394e-05 4.58639188893459e-05 5.00950195524827e-05 5.45358657355895e-05 5.91964553896955e-05 6.4087219569706e-05 6.92190362788101e-05 7.46032441433425e-05 8.02516558169187e-05 8.61765709977572e-05 9.23907889263928e-05 9.89076202123026e-05 0.000105740897817067 0.000112904986998339 0.00012041479399283 0.000128285773187412 0.000136533932495003 0.000145175836615716 0.000154228607823447 0.000163709923873198 0.00017363801257445 0.000184031642520302 0.000194910109400242 0.000206293217255628 0.000218201253960519 0.000230654960125521 0.000243675490527959 0.000257284367066846 0.000271503422124752 0.00028635473108948 0.000301860532645108 0.000318043135282857 0.000334924808305797 0.000352527655405698 0.000370873468673299 0.000389983560662665 0.00040987857186357 0.000430578250640257 0.000452101202367285 0.00047446460413023 0.00049768388095686 0.000521772339098909 0.000546740751391218 0.000572596889168546 0.000599344994615263 0.000626985186753148 0.000655512793530698 0.000684917601656178 0.000715183014907609 0.000746285110646699 0.000778191583150136 0.000810860561139207 0.000844239285524875 0.000878262631876292 0.00091285146045087 0.000947910774776477 0.000983327667732279 0.00101896903181344 0.00105467900776334 0.00109027614298972 0.00112555022812041 0.00116025877666853 0.00119412310903258 0.00122682399791518 0.00125799682766385 0.00128722621497176 0.0013140400327745 0.00133790277298385 0.00135820817684976 0.00137427105416606 0.00138531820416007 0.00139047834164428 0.00138877092176799 0.0013790937453841 0.0013602092145276 0.00133072909366117 0.00128909761704063 0.00123357276563482 0.00116220551833023 0.00107281686147252 0.000962972317936867 0.000829953731647113 0.000670728015525497 0.000481912539970427 0.000259736804817835          0;          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0          0];
+;